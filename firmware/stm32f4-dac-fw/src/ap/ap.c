@@ -2,34 +2,164 @@
 
 
 
+#ifdef _USE_HW_RTOS
+// 우선순위가 높은 순서 : audio > cli > log, storage (EEPROM, 스펙트럼)
+//
+#define AP_AUDIO_PRIORITY     4
+#define AP_CLI_PRIORITY       2
+#define AP_LOG_PRIORITY       1
+#define AP_STORAGE_PRIORITY   1
+
+#define AP_AUDIO_STACK        256     // words
+#define AP_CLI_STACK          512
+#define AP_LOG_STACK          256
+#define AP_STORAGE_STACK      256
+
+
+static void apCreateTask(TaskFunction_t func, const char *name, uint32_t stack_size,
+                         StackType_t *p_stack, StaticTask_t *p_tcb, UBaseType_t priority);
+static void audioThread(void *arg);
+static void cliThread(void *arg);
+static void logThread(void *arg);
+static void storageThread(void *arg);
+
+static StackType_t  audio_stack[AP_AUDIO_STACK];
+static StackType_t  cli_stack[AP_CLI_STACK];
+static StackType_t  log_stack[AP_LOG_STACK];
+static StackType_t  storage_stack[AP_STORAGE_STACK];
+static StaticTask_t audio_tcb;
+static StaticTask_t cli_tcb;
+static StaticTask_t log_tcb;
+static StaticTask_t storage_tcb;
+#endif
+
 
 
 
 void apInit(void)
-{  
-  cliOpen(_DEF_UART1, 115200);
+{
+  cliOpen(_DEF_UART1, HW_UART_BAUD);
 }
 
 void apUpdate(void)
 {
 }
 
+#ifdef _USE_HW_RTOS
 void apMain(void)
+{
+  apCreateTask(audioThread,   "audio",   AP_AUDIO_STACK,   audio_stack,   &audio_tcb,   AP_AUDIO_PRIORITY);
+  apCreateTask(cliThread,     "cli",     AP_CLI_STACK,     cli_stack,     &cli_tcb,     AP_CLI_PRIORITY);
+  apCreateTask(logThread,     "log",     AP_LOG_STACK,     log_stack,     &log_tcb,     AP_LOG_PRIORITY);
+  apCreateTask(storageThread, "storage", AP_STORAGE_STACK, storage_stack, &storage_tcb, AP_STORAGE_PRIORITY);
+
+  vTaskStartScheduler();
+
+  while(1)
+  {
+  }
+}
+
+void apCreateTask(TaskFunction_t func, const char *name, uint32_t stack_size,
+                  StackType_t *p_stack, StaticTask_t *p_tcb, UBaseType_t priority)
+{
+  if (xTaskCreateStatic(func, name, stack_size, NULL, priority, p_stack, p_tcb) == NULL)
+  {
+    logPrintf("[NG] task create : %s\n", name);
+  }
+}
+
+// USB 인터럽트에서 넘어온 코덱 제어(I2C)를 처리한다.
+//
+void audioThread(void *arg)
+{
+  while(1)
+  {
+    eventWait(EVENT_BIT(EVENT_AUDIO_CTRL) | EVENT_BIT(EVENT_USB_CTRL), 10);
+    usbUpdate();
+    es8156Update();
+    i2sPowerUpdate();
+    genUpdate();
+    loudnessUpdate();
+    governorUpdate();
+    convUpdate();
+    Audio_CtrlUpdate();
+  }
+}
+
+void cliThread(void *arg)
 {
   uint32_t pre_time;
 
   pre_time = millis();
   while(1)
   {
+    eventWait(EVENT_BIT(EVENT_UART_RX) | EVENT_BIT(EVENT_SWTIMER) | EVENT_BIT(EVENT_BUTTON), 10);
+
     if (millis()-pre_time >= 500)
     {
       pre_time = millis();
       ledToggle(_DEF_LED1);
     }
-    cliMain();    
-
+    cliMain();
+    swtimerUpdate();
     apUpdate();
   }
 }
 
+void logThread(void *arg)
+{
+  while(1)
+  {
+    eventWait(EVENT_BIT(EVENT_LOG), 10);
+    logUpdate();
+    telemetryUpdate();
+  }
+}
+
+void storageThread(void *arg)
+{
+  while(1)
+  {
+    eventWait(EVENT_BIT(EVENT_STORAGE) | EVENT_BIT(EVENT_DSP), 1000);
+    eepromUpdate();
+    meterUpdate();
+  }
+}
+
+#else
+void apMain(void)
+{
+  uint32_t pre_time;
+
+  pre_time = millis();
+  while(1)
+  {
+    // 이벤트가 없으면 최대 10ms 동안 WFI로 대기한다.
+    //
+    eventWait(EVENT_ALL, 10);
+
+    if (millis()-pre_time >= 500)
+    {
+      pre_time = millis();
+      ledToggle(_DEF_LED1);
+    }
+    cliMain();
+    swtimerUpdate();
+    logUpdate();
+    telemetryUpdate();
+    eepromUpdate();
+    usbUpdate();
+    es8156Update();
+    i2sPowerUpdate();
+    genUpdate();
+    loudnessUpdate();
+    governorUpdate();
+    convUpdate();
+    meterUpdate();
+
+    apUpdate();
+  }
+}
+#endif
 
@@ -0,0 +1,80 @@
+#ifndef FREERTOS_CONFIG_H_
+#define FREERTOS_CONFIG_H_
+
+
+// _USE_HW_RTOS 빌드에서만 사용된다. (cmake -DUSE_RTOS=ON)
+//
+
+#include <stdint.h>
+extern uint32_t SystemCoreClock;
+
+
+#define configUSE_PREEMPTION                      1
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION   1
+#define configUSE_TICKLESS_IDLE                   0
+#define configCPU_CLOCK_HZ                        (SystemCoreClock)
+#define configTICK_RATE_HZ                        ((TickType_t)1000)
+#define configMAX_PRIORITIES                      (7)
+#define configMINIMAL_STACK_SIZE                  ((uint16_t)128)
+#define configMAX_TASK_NAME_LEN                   (16)
+#define configUSE_16_BIT_TICKS                    0
+#define configIDLE_SHOULD_YIELD                   1
+#define configUSE_TASK_NOTIFICATIONS              1
+#define configUSE_MUTEXES                         1
+#define configUSE_RECURSIVE_MUTEXES               0
+#define configUSE_COUNTING_SEMAPHORES             0
+#define configQUEUE_REGISTRY_SIZE                 0
+#define configUSE_TIME_SLICING                    1
+
+// 모든 객체는 정적으로 할당한다.
+//
+#define configSUPPORT_STATIC_ALLOCATION           1
+#define configSUPPORT_DYNAMIC_ALLOCATION          0
+
+#define configUSE_IDLE_HOOK                       1
+#define configUSE_TICK_HOOK                       0
+#define configCHECK_FOR_STACK_OVERFLOW            2
+#define configUSE_MALLOC_FAILED_HOOK              0
+
+#define configUSE_TRACE_FACILITY                  1
+#define configGENERATE_RUN_TIME_STATS             0
+#define configUSE_STATS_FORMATTING_FUNCTIONS      0
+
+#define configUSE_CO_ROUTINES                     0
+#define configUSE_TIMERS                          0
+
+
+#define INCLUDE_vTaskPrioritySet                  1
+#define INCLUDE_uxTaskPriorityGet                 1
+#define INCLUDE_vTaskDelete                       0
+#define INCLUDE_vTaskSuspend                      1
+#define INCLUDE_vTaskDelayUntil                   1
+#define INCLUDE_vTaskDelay                        1
+#define INCLUDE_xTaskGetSchedulerState            1
+#define INCLUDE_xTaskGetCurrentTaskHandle         1
+#define INCLUDE_uxTaskGetStackHighWaterMark       1
+
+
+// 인터럽트 우선순위 (STM32F4 : 4비트)
+//
+// I2S DMA(4) 까지는 FromISR API를 호출할 수 있다.
+// 이보다 높은 우선순위의 인터럽트는 커널 임계영역에서도 막히지 않는다.
+//
+#define configPRIO_BITS                           4
+#define configLIBRARY_LOWEST_INTERRUPT_PRIORITY   15
+#define configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY 4
+
+#define configKERNEL_INTERRUPT_PRIORITY           (configLIBRARY_LOWEST_INTERRUPT_PRIORITY << (8 - configPRIO_BITS))
+#define configMAX_SYSCALL_INTERRUPT_PRIORITY      (configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY << (8 - configPRIO_BITS))
+
+
+#define configASSERT(x)     if ((x) == 0) { taskDISABLE_INTERRUPTS(); for( ;; ); }
+
+
+// SVC, PendSV는 커널이 사용한다. SysTick은 stm32f4xx_it.c 에서 전달한다.
+//
+#define vPortSVCHandler     SVC_Handler
+#define xPortPendSVHandler  PendSV_Handler
+
+
+#endif
@@ -4,6 +4,11 @@
 
 static void SystemClock_Config(void);
 static void PeriphCommonClock_Config(void);
+static void bspInitCycles(void);
+
+static uint32_t cycles_per_us = 1;
+static volatile uint32_t cycles_high = 0;
+static volatile uint32_t cycles_last = 0;
 
 
 
@@ -23,15 +28,46 @@ bool bspInit(void)
   __HAL_RCC_GPIOA_CLK_ENABLE();
   __HAL_RCC_GPIOB_CLK_ENABLE();
 
+  bspInitCycles();
+
   return true;
 }
 
+void bspInitCycles(void)
+{
+  // DWT 사이클 카운터를 타임스탬프로 사용한다.
+  //
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  // WFI 중에도 CYCCNT 가 멈추지 않도록 sleep 모드에서 HCLK를 유지한다.
+  // micros(), cycles64(), i2s ISR 주기 통계가 모두 CYCCNT 를 기준으로 하므로 빌드 종류와 관계없이 켠다.
+  // (sleep 전류는 조금 늘지만 코어는 여전히 멈추고, USB suspend 는 STOP 모드로 따로 줄인다)
+  //
+  DBGMCU->CR |= DBGMCU_CR_DBG_SLEEP;
+
+  cycles_per_us = SystemCoreClock / 1000000;
+  cycles_high   = 0;
+  cycles_last   = 0;
+}
+
 void delay(uint32_t ms)
 {
   uint32_t tickstart = HAL_GetTick();
   uint32_t wait = ms;
 
 
+#ifdef _USE_HW_RTOS
+  // 태스크에서는 다른 태스크가 실행되도록 양보한다.
+  //
+  if (__get_IPSR() == 0 && xTaskGetSchedulerState() == taskSCHEDULER_RUNNING)
+  {
+    vTaskDelay(pdMS_TO_TICKS(ms));
+    return;
+  }
+#endif
+
   if (wait < HAL_MAX_DELAY)
   {
     wait += (uint32_t)(uwTickFreq);
@@ -42,11 +78,98 @@ void delay(uint32_t ms)
   }
 }
 
+void delayUs(uint32_t us)
+{
+  uint32_t start = DWT->CYCCNT;
+  uint32_t wait  = us * cycles_per_us;
+
+
+  while ((DWT->CYCCNT - start) < wait)
+  {
+  }
+}
+
 uint32_t millis(void)
 {
   return HAL_GetTick();
 }
 
+uint32_t micros(void)
+{
+  return (uint32_t)(cycles64() / cycles_per_us);
+}
+
+uint32_t cycles(void)
+{
+  return DWT->CYCCNT;
+}
+
+uint64_t cycles64(void)
+{
+  uint32_t primask;
+  uint32_t now;
+  uint64_t ret;
+
+
+  // 32비트 카운터는 96MHz에서 약 44초마다 넘치므로 상위 32비트를 확장한다.
+  // SysTick에서 1ms 마다 호출되어 넘침을 놓치지 않는다.
+  //
+  primask = __get_PRIMASK();
+  __disable_irq();
+  now = DWT->CYCCNT;
+  if (now < cycles_last)
+  {
+    cycles_high++;
+  }
+  cycles_last = now;
+  ret = ((uint64_t)cycles_high << 32) | now;
+  __set_PRIMASK(primask);
+
+  return ret;
+}
+
+// STOP 모드로 진입하고 깨어나면 PLL, PLLI2S를 다시 설정한다.
+// 인터럽트를 막은 상태로 진입하여 클럭이 복원된 후에 깨운 인터럽트가 처리된다.
+// *p_req 는 인터럽트를 막은 후에 다시 보고, 그 사이에 풀렸으면 들어가지 않고 false 를 반환한다.
+// (막은 후에 풀어 준 인터럽트는 pending 으로 남아서 WFI 가 바로 깨어난다)
+// p_exit_us 에는 클럭 복원에 걸린 시간(us)을 넣는다.
+//
+bool bspEnterStop(volatile bool *p_req, uint32_t *p_exit_us)
+{
+  uint32_t primask;
+  uint32_t hsi_cycles;
+  uint32_t pll_cycles;
+
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if (*p_req != true)
+  {
+    __set_PRIMASK(primask);
+    return false;
+  }
+
+  HAL_SuspendTick();
+  HAL_PWR_EnterSTOPMode(PWR_LOWPOWERREGULATOR_ON, PWR_STOPENTRY_WFI);
+
+  // 깨어난 직후는 HSI 로 동작하고 SystemClock_Config() 끝에서 PLL 로 바뀐다.
+  // DWT 는 HCLK 를 세므로 두 구간을 각각의 클럭으로 나눠서 변환한다.
+  // (SystemClock_Config() 안에서 PLL 로 바뀐 후의 짧은 구간은 HSI 로 계산된다)
+  //
+  hsi_cycles = DWT->CYCCNT;
+  SystemClock_Config();
+  pll_cycles = DWT->CYCCNT;
+  PeriphCommonClock_Config();
+  hsi_cycles = pll_cycles - hsi_cycles;
+  pll_cycles = DWT->CYCCNT - pll_cycles;
+  HAL_ResumeTick();
+
+  __set_PRIMASK(primask);
+
+  *p_exit_us = hsi_cycles / (HSI_VALUE / 1000000) + pll_cycles / (SystemCoreClock / 1000000);
+  return true;
+}
 
 
 void Error_Handler(void)
@@ -12,6 +12,17 @@ extern "C" {
 
 #include "assert_def.h"
 
+#ifdef _USE_HW_RTOS
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#endif
+
+
+// 지정한 함수를 SRAM에서 실행한다. (startup에서 .ramfunc 복사)
+//
+#define __RAMFUNC     __attribute__((section(".ramfunc"), noinline))
 
 
 bool bspInit(void);
@@ -19,7 +30,12 @@ bool bspInit(void);
 
 void logPrintf(const char *fmt, ...);
 void delay(uint32_t time_ms);
+void delayUs(uint32_t time_us);
 uint32_t millis(void);
+uint32_t micros(void);
+uint32_t cycles(void);
+uint64_t cycles64(void);
+bool bspEnterStop(volatile bool *p_req, uint32_t *p_exit_us);
 void Error_Handler(void);
 
 
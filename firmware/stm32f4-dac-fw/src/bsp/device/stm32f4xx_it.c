@@ -3,6 +3,10 @@
 #include "fault.h"
 #include "stm32f4xx_it.h"
 
+#ifdef _USE_HW_RTOS
+extern void xPortSysTickHandler(void);
+#endif
+
 /******************************************************************************/
 /*           Cortex Processor Interruption and Exception Handlers          */
 /******************************************************************************/
@@ -63,9 +67,11 @@ void UsageFault_Handler_C(uint32_t *p_stack)
 /**
   * @brief This function handles System service call via SWI instruction.
   */
+#ifndef _USE_HW_RTOS
 void SVC_Handler(void)
 {
 }
+#endif
 
 /**
   * @brief This function handles Debug monitor.
@@ -77,9 +83,11 @@ void DebugMon_Handler(void)
 /**
   * @brief This function handles Pendable request for system service.
   */
+#ifndef _USE_HW_RTOS
 void PendSV_Handler(void)
 {
 }
+#endif
 
 /**
   * @brief This function handles System tick timer.
@@ -87,6 +95,14 @@ void PendSV_Handler(void)
 void SysTick_Handler(void)
 {
   HAL_IncTick();
+  cycles64();
+
+#ifdef _USE_HW_RTOS
+  if (xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED)
+  {
+    xPortSysTickHandler();
+  }
+#endif
 }
 
 /******************************************************************************/
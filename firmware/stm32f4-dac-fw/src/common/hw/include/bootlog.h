@@ -0,0 +1,24 @@
+#ifndef BOOTLOG_H_
+#define BOOTLOG_H_
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "hw_def.h"
+
+#ifdef _USE_HW_BOOTLOG
+
+
+bool     bootlogInit(void);
+void     bootlogMark(const char *name);
+uint32_t bootlogGetCount(void);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
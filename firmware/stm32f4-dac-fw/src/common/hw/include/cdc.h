@@ -19,6 +19,7 @@ bool     cdcIsConnect(void);
 uint32_t cdcAvailable(void);
 uint8_t  cdcRead(void);
 uint32_t cdcWrite(uint8_t *p_data, uint32_t length);
+uint32_t cdcAvailableForWrite(void);
 uint32_t cdcGetBaud(void);
 uint8_t  cdcGetType(void);
 
@@ -0,0 +1,52 @@
+#ifndef CONV_H_
+#define CONV_H_
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "hw_def.h"
+
+#ifdef _USE_HW_CONV
+
+
+#define CONV_TAP_MAX      (HW_CONV_PART_LEN * HW_CONV_PART_MAX)
+
+
+typedef struct
+{
+  uint32_t fixed_cycles;              // 채널당 FFT + IFFT
+  uint32_t part_cycles;               // 채널당 파티션 1개 곱셈-누적
+  uint32_t block_cycles;              // 마지막 파티션 블록 처리 시간 (2채널)
+  uint32_t block_cycles_max;
+  uint32_t clip_cnt;
+} conv_stat_t;
+
+
+bool     convInit(void);
+bool     convSetEnable(bool enable);
+bool     convIsEnable(void);
+bool     convLoadBegin(uint32_t taps, bool stereo);
+bool     convLoadTaps(uint8_t ch, uint32_t index, const int16_t *p_taps, uint32_t count);
+bool     convLoadEnd(void);
+bool     convLoadEndAsync(void);
+void     convUpdate(void);
+bool     convLoadDelta(void);
+bool     convSave(void);
+bool     convLoad(void);
+uint32_t convGetTaps(void);
+bool     convSetPartLimit(uint32_t parts);
+uint32_t convGetPartLimit(void);
+uint32_t convGetMaxTaps(uint32_t sample_rate);
+bool     convBench(void);
+void     convGetStat(conv_stat_t *p_stat);
+void     convProcess(int32_t *p_buf, uint32_t frames, void *arg);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,35 @@
+#ifndef CROSSFEED_H_
+#define CROSSFEED_H_
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "hw_def.h"
+
+#ifdef _USE_HW_CROSSFEED
+
+
+typedef enum
+{
+  CROSSFEED_OFF = 0,
+  CROSSFEED_LOW,                      // 700Hz, 4.5dB (bs2b default)
+  CROSSFEED_MID,                      // 700Hz, 6.0dB (Chu Moy)
+  CROSSFEED_HIGH,                     // 650Hz, 9.5dB (Jan Meier)
+  CROSSFEED_MAX,
+} CrossfeedPreset_t;
+
+
+bool              crossfeedInit(void);
+bool              crossfeedSetPreset(CrossfeedPreset_t preset, bool save);
+CrossfeedPreset_t crossfeedGetPreset(void);
+void              crossfeedProcess(int32_t *p_buf, uint32_t frames, void *arg);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
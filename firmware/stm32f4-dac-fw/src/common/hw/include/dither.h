@@ -0,0 +1,37 @@
+#ifndef DITHER_H_
+#define DITHER_H_
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "hw_def.h"
+
+#ifdef _USE_HW_DITHER
+
+
+typedef enum
+{
+  DITHER_MODE_OFF = 0,                // 반올림만
+  DITHER_MODE_TPDF,
+  DITHER_MODE_SHAPE1,                 // TPDF + 1차 error feedback
+  DITHER_MODE_SHAPE2,                 // TPDF + 2차 error feedback
+  DITHER_MODE_MAX,
+} DitherMode_t;
+
+
+bool         ditherInit(void);
+bool         ditherSetMode(DitherMode_t mode);
+DitherMode_t ditherGetMode(void);
+bool         ditherSetBits(uint8_t bits);
+uint8_t      ditherGetBits(void);
+void         ditherProcess(int32_t *p_buf, uint32_t frames, void *arg);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -22,6 +22,9 @@ bool     eepromWrite(uint32_t addr, uint8_t *p_data, uint32_t length);
 uint32_t eepromGetLength(void);
 bool     eepromFormat(void);
 
+bool     eepromWriteAsync(uint32_t addr, uint8_t *p_data, uint32_t length);
+uint32_t eepromUpdate(void);
+
 
 #endif
 
@@ -117,12 +117,26 @@ typedef union
   };
 } REG11_t;
 
+typedef enum
+{
+  ES8156_STATE_NONE = 0,
+  ES8156_STATE_RESET,                 // 리셋 유지 (10ms)
+  ES8156_STATE_POWER_UP,              // 리셋 해제 후 안정화 (30ms)
+  ES8156_STATE_READY,
+} Es8156State_t;
+
+
 bool es8156Init(void);
+bool es8156Update(void);
+bool es8156IsReady(void);
 bool es8156SetVolume(uint8_t volume);
+bool es8156SetVolumeTrim(uint8_t trim);
 uint8_t es8156GetVolume(void);
+uint8_t es8156GetVolumeTrim(void);
 bool es8156SetConfig(uint32_t sample_rate, uint32_t sample_depth);
 bool es8156SetMute(bool enable);
 bool es8156SetEnable(bool enable);
+bool es8156SetPowerDown(bool enable);
 
 #endif
 
@@ -0,0 +1,42 @@
+#ifndef EVENT_H_
+#define EVENT_H_
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "hw_def.h"
+
+#ifdef _USE_HW_EVENT
+
+
+typedef enum
+{
+  EVENT_UART_RX = 0,
+  EVENT_USB_CTRL,
+  EVENT_BUTTON,
+  EVENT_SWTIMER,
+  EVENT_LOG,
+  EVENT_AUDIO_CTRL,
+  EVENT_STORAGE,
+  EVENT_DSP,                          // 낮은 우선순위 DSP 작업 (스펙트럼)
+  EVENT_MAX,
+} EventId_t;
+
+#define EVENT_BIT(id)       (1UL << (id))
+#define EVENT_ALL           ((1UL << EVENT_MAX) - 1)
+
+
+bool     eventInit(void);
+void     eventPost(EventId_t id);
+uint32_t eventWait(uint32_t mask, uint32_t timeout_ms);
+uint32_t eventGet(void);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
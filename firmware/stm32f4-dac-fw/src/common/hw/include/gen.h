@@ -0,0 +1,63 @@
+#ifndef GEN_H_
+#define GEN_H_
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "hw_def.h"
+
+#ifdef _USE_HW_GEN
+
+
+#define GEN_TONE_MAX      HW_GEN_TONE_MAX
+#define GEN_MELODY_MAX    HW_GEN_MELODY_MAX
+
+
+typedef enum
+{
+  GEN_SINE = 0,
+  GEN_SQUARE,
+  GEN_MULTI,                          // 여러 사인파의 합
+  GEN_SWEEP,                          // 로그 스윕
+  GEN_NOISE,                          // 백색 잡음
+  GEN_MODE_MAX,
+} GenMode_t;
+
+typedef enum
+{
+  GEN_CH_L    = 0x01,
+  GEN_CH_R    = 0x02,
+  GEN_CH_BOTH = 0x03,
+} GenCh_t;
+
+typedef struct
+{
+  GenMode_t mode;
+  float     freq_hz[GEN_TONE_MAX];    // SWEEP : [0] 시작, [1] 끝
+  uint8_t   tone_cnt;                 // MULTI
+  int16_t   level_db10;               // dBFS x 10, MULTI 는 합계 기준
+  uint8_t   ch;                       // GenCh_t
+  uint32_t  time_ms;                  // 0 : 정지할 때까지, SWEEP 은 필수
+  bool      mix;                      // true : 스트림에 섞음, false : 스트림 대신 출력
+} gen_cfg_t;
+
+
+bool     genInit(void);
+bool     genStart(const gen_cfg_t *p_cfg);
+bool     genStop(void);
+bool     genIsBusy(void);
+bool     genBeep(uint32_t freq_hz, uint16_t volume, uint32_t time_ms);
+bool     genMelody(const uint16_t *p_freq, const uint16_t *p_time_ms, uint8_t cnt, uint16_t volume);
+uint32_t genGetSampleCount(void);
+void     genUpdate(void);
+void     genProcess(int32_t *p_buf, uint32_t frames, void *arg);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
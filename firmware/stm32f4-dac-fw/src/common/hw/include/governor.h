@@ -0,0 +1,38 @@
+#ifndef GOVERNOR_H_
+#define GOVERNOR_H_
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "hw_def.h"
+
+#ifdef _USE_HW_GOVERNOR
+
+
+typedef struct
+{
+  bool     enable;
+  uint8_t  level;                     // 적용된 단계 수
+  uint8_t  level_max;
+  uint32_t load;                      // 마지막 부하, 1/1000
+  uint32_t load_max;
+  uint32_t degrade_cnt;
+  uint32_t restore_cnt;
+} governor_stat_t;
+
+
+bool governorInit(void);
+bool governorSetEnable(bool enable);
+bool governorRestoreAll(void);
+void governorGetStat(governor_stat_t *p_stat);
+void governorUpdate(void);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -11,6 +11,19 @@ extern "C" {
 #ifdef _USE_HW_I2S
 
 
+// 처리 단계 : 스테레오 인터리브, 24비트 left-justified (Q31) 샘플
+//
+typedef void (*I2sStageFunc_t)(int32_t *p_buf, uint32_t frames, void *arg);
+
+typedef enum
+{
+  I2S_POWER_ACTIVE = 0,
+  I2S_POWER_IDLE,                     // 코덱 저전력, I2S 클럭 정지
+  I2S_POWER_SUSPEND,                  // USB suspend, MCU STOP 모드
+  I2S_POWER_MAX,
+} I2sPower_t;
+
+
 
 bool i2sInit(void);
 bool i2sIsInit(void);
@@ -23,12 +36,14 @@ bool i2sCfgSave(void);
 int8_t   i2sGetEmptyChannel(void);
 uint32_t i2sAvailableForWrite(uint8_t ch);
 uint32_t i2sAvailableForRead(uint8_t ch);
-bool     i2sWrite(uint8_t ch, void *p_data, uint32_t samples);
-bool     i2sPlayNote(int8_t octave, int8_t note, uint16_t volume, uint32_t time_ms);
-bool     i2sPlayBeep(uint32_t freq_hz, uint16_t volume, uint32_t time_ms);
+bool     i2sWrite(uint8_t ch, const int16_t *p_data, uint32_t samples);
 uint32_t i2sGetFrameSize(void);
 bool     i2sSetSampleRate(uint32_t sample_rate);
 uint32_t i2sGetSampleRate(void);
+uint32_t i2sGetSampleRateMilliHz(void);
+uint32_t i2sGetStreamRate(void);
+bool     i2sSetFixedRate(bool enable);
+bool     i2sIsFixedRate(void);
 
 int16_t  i2sGetVolume(void);
 bool     i2sSetVolume(int16_t volume);
@@ -38,6 +53,28 @@ bool     i2sIsMute(void);
 bool i2sWriteBytes(uint8_t ch, uint8_t *p_data, uint32_t length);
 uint32_t i2sZeroCntGet(void);
 uint32_t i2sZeroCntClear(void);
+uint32_t i2sZeroTotalGet(void);
+uint32_t i2sGetIsrCycles(void);
+uint32_t i2sGetIsrCyclesMax(void);
+void     i2sClearStat(void);
+
+bool     i2sStageAdd(const char *name, I2sStageFunc_t func, void *arg);
+bool     i2sStageAddTap(const char *name, I2sStageFunc_t func, void *arg);
+bool     i2sStageEnable(const char *name, bool enable);
+bool     i2sStageSetQuantizer(const char *name, I2sStageFunc_t func, void *arg);
+bool     i2sSetSource(const char *name, I2sStageFunc_t func, void *arg);
+bool     i2sSourceEnable(bool enable, bool solo);
+bool     i2sStageIsEnable(const char *name);
+uint32_t i2sStageGetCycles(const char *name);
+uint32_t i2sGetProcMissCount(void);
+uint32_t i2sGetProcLoad(bool clear);
+void     i2sSetProcLoadAlarm(uint32_t load);
+
+void       i2sSetStream(bool enable);
+void       i2sSetSuspend(bool enable);
+void       i2sPowerUpdate(void);
+uint32_t   i2sGetFirstSampleUs(void);
+I2sPower_t i2sGetPowerState(void);
 
 #endif
 
@@ -0,0 +1,43 @@
+#ifndef LIMITER_H_
+#define LIMITER_H_
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "hw_def.h"
+
+#ifdef _USE_HW_LIMITER
+
+
+typedef struct
+{
+  float    threshold_db;              // -20 ~ 0 dBFS
+  float    attack_ms;
+  float    release_ms;
+  float    lookahead_ms;              // 0 ~ HW_LIMITER_LOOKAHEAD_MS
+  float    clip_knee_db;              // soft clip 시작 레벨
+} limiter_cfg_t;
+
+typedef struct
+{
+  uint32_t gr_ms;                     // 게인 감소가 걸린 시간
+  uint32_t gr_max_db10;               // 최대 게인 감소 (0.1 dB)
+  uint32_t clip_cnt;                  // soft clip 구간에 들어간 샘플
+} limiter_stat_t;
+
+
+bool limiterInit(void);
+bool limiterSetConfig(const limiter_cfg_t *p_cfg);
+void limiterGetConfig(limiter_cfg_t *p_cfg);
+void limiterGetStat(limiter_stat_t *p_stat);
+void limiterProcess(int32_t *p_buf, uint32_t frames, void *arg);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -23,6 +23,7 @@ bool logOpen(uint8_t ch, uint32_t baud);
 bool logIsOpen(void);
 void logBoot(uint8_t enable);
 void logPrintf(const char *fmt, ...);
+void logUpdate(void);
 
 #endif
 
@@ -0,0 +1,40 @@
+#ifndef LOUDNESS_H_
+#define LOUDNESS_H_
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "hw_def.h"
+
+#ifdef _USE_HW_LOUDNESS
+
+
+#define LOUDNESS_RATE_MAX     8
+#define LOUDNESS_STEP_MAX     101       // 볼륨 0 ~ 100
+#define LOUDNESS_BIQUAD_MAX   2         // low shelf, high shelf
+
+
+// tools/loudness_coef.py 로 생성한 테이블 (loudness_coef.c)
+//
+extern const uint32_t loudness_rate[LOUDNESS_RATE_MAX];
+extern const uint8_t  loudness_makeup[LOUDNESS_STEP_MAX];
+extern const int16_t  loudness_gain[LOUDNESS_STEP_MAX][LOUDNESS_BIQUAD_MAX];
+extern const float    loudness_coef[LOUDNESS_RATE_MAX][LOUDNESS_STEP_MAX][LOUDNESS_BIQUAD_MAX][5];
+
+
+bool loudnessInit(void);
+bool loudnessSetEnable(bool enable, bool save);
+bool loudnessIsEnable(void);
+bool loudnessSetVolume(int16_t volume);
+void loudnessUpdate(void);
+void loudnessProcess(int32_t *p_buf, uint32_t frames, void *arg);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
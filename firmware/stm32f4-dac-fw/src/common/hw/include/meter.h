@@ -0,0 +1,46 @@
+#ifndef METER_H_
+#define METER_H_
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "hw_def.h"
+
+#ifdef _USE_HW_METER
+
+
+#define METER_CH          2
+
+
+typedef struct
+{
+  int16_t  peak_db10[METER_CH];       // dBFS x 10, 마지막 측정 구간
+  int16_t  rms_db10[METER_CH];
+  int16_t  peak_hold_db10[METER_CH];  // clear 이후 최대
+  uint32_t clip_cnt[METER_CH];        // full scale 에 닿은 샘플
+  uint32_t window_ms;
+  uint32_t update_cnt;
+} meter_level_t;
+
+
+bool     meterInit(void);
+bool     meterSetEnable(bool enable);
+bool     meterIsEnable(void);
+bool     meterSetWindow(uint32_t window_ms);
+bool     meterSetFft(bool enable);
+bool     meterIsFft(void);
+void     meterClear(void);
+void     meterGetLevel(meter_level_t *p_level);
+bool     meterGetSpectrum(int16_t *p_db10, uint32_t *p_hz, uint32_t bands);
+void     meterUpdate(void);
+void     meterProcess(int32_t *p_buf, uint32_t frames, void *arg);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -21,36 +21,68 @@ extern "C" {
 
 #define MIXER_MAX_CH        HW_MIXER_MAX_CH
 #define MIXER_MAX_BUF_LEN   HW_MIXER_MAX_BUF_LEN
+#define MIXER_MAX_SRC       HW_MIXER_MAX_SRC
 
 
+typedef void (*MixerSrcFunc_t)(int32_t *p_buf, uint32_t frames, void *arg);
 
+
+
+// 채널 버퍼 : 16비트 스테레오 인터리브, 출력 샘플레이트
+//
 typedef struct
 {
   uint32_t length;
-  uint32_t in;
-  uint32_t out;
+  volatile uint32_t in;               // 쓰기 : 스레드
+  volatile uint32_t out;              // 읽기 : 처리 인터럽트
+  int32_t  volume;                    // 0 ~ 100
+  int32_t  gain;                      // Q15, 채널 x 전체 볼륨
   int16_t  buf[MIXER_MAX_BUF_LEN];
 } mixer_buf_t;
 
+// 소스 채널 : 처리 인터럽트에서 Q31 스테레오 샘플을 만든다. 링 버퍼가 없다.
+//
+typedef struct
+{
+  const char     *name;
+  MixerSrcFunc_t  func;
+  void           *arg;
+  volatile bool   enable;
+  volatile bool   solo;               // true : 채널 0(USB 스트림) 대신 출력
+  int32_t         volume;
+  int32_t         gain;
+} mixer_src_t;
+
 typedef struct
 {
   int32_t volume;
   mixer_buf_t buf[MIXER_MAX_CH];
+  mixer_src_t src[MIXER_MAX_SRC];
+  uint8_t     src_cnt;
 } mixer_t;
 
 
 bool mixerInit(mixer_t *p_mixer);
-bool mixerWrite(mixer_t *p_mixer, uint8_t ch, int16_t *p_data, uint32_t length);
+bool mixerWrite(mixer_t *p_mixer, uint8_t ch, const int16_t *p_data, uint32_t length);
 bool mixerRead(mixer_t *p_mixer, int16_t *p_data, uint32_t length);
 bool mixerIsEmpty(mixer_t *p_mixer, uint8_t ch);
 bool mixerSetVolume(mixer_t *p_mixer, int32_t volume);
 int32_t mixerGetVolume(mixer_t *p_mixer);
+bool mixerSetChVolume(mixer_t *p_mixer, uint8_t ch, int32_t volume);
+int32_t mixerGetChVolume(mixer_t *p_mixer, uint8_t ch);
 
 uint32_t mixerAvailable(mixer_t *p_mixer);
 uint32_t mixerAvailableForWrite(mixer_t *p_mixer, uint8_t ch);
 int8_t   mixerGetEmptyChannel(mixer_t *p_mixer);
 int8_t   mixerGetValidChannel(mixer_t *p_mixer, uint32_t length);
 
+int8_t   mixerAddSource(mixer_t *p_mixer, const char *name, MixerSrcFunc_t func, void *arg);
+bool     mixerSetSource(mixer_t *p_mixer, uint8_t src, bool enable, bool solo);
+bool     mixerIsSource(mixer_t *p_mixer, uint8_t src);
+bool     mixerIsActive(mixer_t *p_mixer);
+
+uint8_t  mixerMix(mixer_t *p_mixer, int32_t *p_buf, uint32_t frames);
+
 int16_t mixerSamples(int16_t a, int16_t b);
 
 
@@ -0,0 +1,42 @@
+#ifndef PERF_H_
+#define PERF_H_
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "hw_def.h"
+
+#ifdef _USE_HW_PERF
+
+
+typedef enum
+{
+  PERF_PROFILE_FLASH_ART = 0,         // prefetch + I/D cache
+  PERF_PROFILE_FLASH_NO_PREFETCH,
+  PERF_PROFILE_FLASH_NO_ICACHE,
+  PERF_PROFILE_FLASH_NO_ART,
+  PERF_PROFILE_SRAM,
+  PERF_PROFILE_MAX,
+} PerfProfile_t;
+
+typedef struct
+{
+  uint32_t cold_cycles;               // 캐시 리셋 후 첫 실행
+  uint32_t min_cycles;
+  uint32_t avg_cycles;
+} perf_result_t;
+
+
+bool     perfInit(void);
+bool     perfBench(PerfProfile_t profile, perf_result_t *p_result);
+uint32_t perfGetRamFuncSize(void);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,31 @@
+#ifndef RESAMPLE_H_
+#define RESAMPLE_H_
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "hw_def.h"
+
+#ifdef _USE_HW_RESAMPLE
+
+
+#define RESAMPLE_PHASE    320         // 96000 / 300, 44.1k 와 48k 의 위상이 정확히 맞는다.
+#define RESAMPLE_TAPS     64          // 위상당 탭 (입력 샘플 단위)
+
+
+extern const float resample_coef[RESAMPLE_PHASE][RESAMPLE_TAPS];
+
+bool     resampleIsValid(uint32_t in_rate, uint32_t out_rate);
+bool     resampleSetRate(uint32_t in_rate, uint32_t out_rate);
+uint32_t resampleGetInFrames(uint32_t out_frames);
+uint32_t resampleProcess(int32_t *p_out, uint32_t out_frames, const int32_t *p_in, uint32_t *p_in_frames);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,22 @@
+#ifndef RTOS_H_
+#define RTOS_H_
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "hw_def.h"
+
+#ifdef _USE_HW_RTOS
+
+
+bool rtosInit(void);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -30,6 +30,8 @@ void swtimerSet  (swtimer_handle_t handle, uint32_t period_ms, SwtimerMode_t mod
 void swtimerStart(swtimer_handle_t handle);
 void swtimerStop (swtimer_handle_t handle);
 void swtimerReset(swtimer_handle_t handle);
+void swtimerSetDeferred(swtimer_handle_t handle, bool enable);
+void swtimerUpdate(void);
 void swtimerISR(void);
 
 
@@ -0,0 +1,54 @@
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "hw_def.h"
+
+#ifdef _USE_HW_TELEMETRY
+
+#define TELEMETRY_CH            HW_TELEMETRY_CH
+#define TELEMETRY_TYPE_AUDIO    0x01
+#define TELEMETRY_VERSION       0x01
+
+
+typedef enum
+{
+  TELEMETRY_FIELD_TIME = 0,
+  TELEMETRY_FIELD_ALT,
+  TELEMETRY_FIELD_BUF_LEVEL,
+  TELEMETRY_FIELD_FREQ,
+  TELEMETRY_FIELD_FREQ_REAL,
+  TELEMETRY_FIELD_HOST_RATE,
+  TELEMETRY_FIELD_DRIFT,
+  TELEMETRY_FIELD_FEEDBACK,
+  TELEMETRY_FIELD_FILL,
+  TELEMETRY_FIELD_UNDERRUN,
+  TELEMETRY_FIELD_EMPTY_SOF,
+  TELEMETRY_FIELD_ISR_CYCLES,
+  TELEMETRY_FIELD_ISR_CYCLES_MAX,
+  TELEMETRY_FIELD_ISO_OUT_INC,
+  TELEMETRY_FIELD_MAX,
+} TelemetryField_t;
+
+#define TELEMETRY_MASK_ALL      ((1UL << TELEMETRY_FIELD_MAX) - 1)
+
+
+bool telemetryInit(void);
+bool telemetryStart(void);
+bool telemetryStop(void);
+bool telemetryIsStarted(void);
+void telemetrySetPeriod(uint32_t period_ms);
+void telemetrySetMask(uint32_t mask);
+void telemetryUpdate(void);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -21,10 +21,15 @@ uint32_t uartAvailable(uint8_t ch);
 bool     uartFlush(uint8_t ch);
 uint8_t  uartRead(uint8_t ch);
 uint32_t uartWrite(uint8_t ch, uint8_t *p_data, uint32_t length);
+uint32_t uartAvailableForWrite(uint8_t ch);
+bool     uartIsTxBusy(uint8_t ch);
+bool     uartFlushTx(uint8_t ch, uint32_t timeout);
+bool     uartSetTxDoneCallback(uint8_t ch, void (*p_func)(void));
 uint32_t uartPrintf(uint8_t ch, const char *fmt, ...);
 uint32_t uartGetBaud(uint8_t ch);
 uint32_t uartGetRxCnt(uint8_t ch);
 uint32_t uartGetTxCnt(uint8_t ch);
+uint32_t uartGetTxBps(uint8_t ch);
 
 #ifdef __cplusplus
 }
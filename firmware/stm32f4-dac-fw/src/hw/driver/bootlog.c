@@ -0,0 +1,89 @@
+#include "bootlog.h"
+
+
+#ifdef _USE_HW_BOOTLOG
+#include "cli.h"
+
+
+typedef struct
+{
+  const char *name;
+  uint32_t    time_us;                  // bspInit() 이후 시간
+} bootlog_mark_t;
+
+
+#if CLI_USE(HW_BOOTLOG)
+static void cliBootlog(cli_args_t *args);
+#endif
+
+static bootlog_mark_t bootlog_tbl[HW_BOOTLOG_MAX];
+static volatile uint32_t bootlog_cnt = 0;
+
+
+
+
+bool bootlogInit(void)
+{
+#if CLI_USE(HW_BOOTLOG)
+  cliAdd("bootlog", cliBootlog);
+#endif
+  return true;
+}
+
+void bootlogMark(const char *name)
+{
+  uint32_t time_us = micros();
+  uint32_t index;
+
+
+  index = __atomic_fetch_add(&bootlog_cnt, 1, __ATOMIC_RELAXED);
+  if (index >= HW_BOOTLOG_MAX)
+  {
+    bootlog_cnt = HW_BOOTLOG_MAX;
+    return;
+  }
+  bootlog_tbl[index].name    = name;
+  bootlog_tbl[index].time_us = time_us;
+
+  logPrintf("[%4d.%03d ms] %s\n", time_us/1000, time_us%1000, name);
+}
+
+uint32_t bootlogGetCount(void)
+{
+  return bootlog_cnt;
+}
+
+
+#if CLI_USE(HW_BOOTLOG)
+void cliBootlog(cli_args_t *args)
+{
+  bool ret = false;
+
+
+  if (args->argc == 1 && args->isStr(0, "info"))
+  {
+    uint32_t pre_us = 0;
+
+    cliPrintf("      time ms     step ms  name\n");
+    for (uint32_t i=0; i<bootlog_cnt; i++)
+    {
+      uint32_t time_us = bootlog_tbl[i].time_us;
+      uint32_t step_us = time_us - pre_us;
+
+      cliPrintf("%6d.%03d  %6d.%03d   %s\n",
+        time_us/1000, time_us%1000,
+        step_us/1000, step_us%1000,
+        bootlog_tbl[i].name);
+      pre_us = time_us;
+    }
+    ret = true;
+  }
+
+  if (ret == false)
+  {
+    cliPrintf("bootlog info\n");
+  }
+}
+#endif
+
+#endif
@@ -5,6 +5,7 @@
 #include "gpio.h"
 #include "cli.h"
 #include "swtimer.h"
+#include "event.h"
 
 
 typedef struct
@@ -123,6 +124,9 @@ void buttonISR(void *arg)
         {
           p_btn->pressed = true;
           p_btn->state = BTN_PRESSED;
+          #ifdef _USE_HW_EVENT
+          eventPost(EVENT_BUTTON);
+          #endif
         }
         else
         {
@@ -137,6 +141,9 @@ void buttonISR(void *arg)
         if (buttonGetPin(i) == false)
         {
           p_btn->state = BTN_IDLE;    
+          #ifdef _USE_HW_EVENT
+          eventPost(EVENT_BUTTON);
+          #endif
         }      
         break;
     }
@@ -56,6 +56,11 @@ uint32_t cdcWrite(uint8_t *p_data, uint32_t length)
   return cdcIfWrite(p_data, length);
 }
 
+uint32_t cdcAvailableForWrite(void)
+{
+  return cdcIfAvailableForWrite();
+}
+
 uint32_t cdcGetBaud(void)
 {
   return cdcIfGetBaud();
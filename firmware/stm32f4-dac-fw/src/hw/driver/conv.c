@@ -0,0 +1,706 @@
+#include "conv.h"
+
+
+#ifdef _USE_HW_CONV
+#include "cli.h"
+#include "i2s.h"
+#include "eeprom.h"
+#include "event.h"
+#include "arm_math.h"
+
+
+#define CONV_CH                 2
+#define CONV_PART_LEN           HW_CONV_PART_LEN
+#define CONV_FFT_LEN            (HW_CONV_PART_LEN * 2)
+#define CONV_MAGIC              0xC0
+#define CONV_FLAG_STEREO        0x01
+#define CONV_FLAG_ENABLE        0x02
+#define CONV_EEPROM_HEAD        4
+#define CONV_EEPROM_TAP_MAX     ((HW_EEPROM_MAX_SIZE - HW_EEPROM_ADDR_CONV - CONV_EEPROM_HEAD) / 2)
+#define CONV_Q15_TO_F           (1.0f / 32768.0f)
+#define CONV_Q31_TO_F           (1.0f / 2147483648.0f)
+#define CONV_F_TO_Q31           (2147483647.0f)
+
+
+#if CLI_USE(HW_CONV)
+static void cliConv(cli_args_t *args);
+static int32_t convParseHex(const char *p_str, int16_t *p_taps, uint32_t max);
+#endif
+static void convReset(void);
+static void convApply(void);
+static void convBlock(void);
+static void convMac(float *p_acc, const float *p_x, const float *p_h);
+
+static arm_rfft_fast_instance_f32 conv_fft;
+
+// uniformly partitioned overlap-save
+// IR 은 파티션별 스펙트럼으로, 입력은 스펙트럼 지연선(FDL)으로 보관한다.
+//
+static float conv_ir[CONV_CH][HW_CONV_PART_MAX][CONV_FFT_LEN];
+static float conv_fdl[CONV_CH][HW_CONV_PART_MAX][CONV_FFT_LEN];
+static float conv_in[CONV_CH][CONV_FFT_LEN];          // [이전 파티션 | 현재 파티션]
+static float conv_out[CONV_CH][CONV_PART_LEN];
+static float conv_tmp[CONV_FFT_LEN];
+static float conv_acc[CONV_FFT_LEN];
+static int16_t conv_load_buf[CONV_CH][CONV_TAP_MAX];  // 업로드 중인 Q15 탭, 적용 후에는 EEPROM 저장용 사본
+
+static uint32_t conv_pos = 0;
+static uint32_t conv_fdl_index = 0;
+static uint32_t conv_rate = 0;
+static uint32_t conv_taps = 0;
+static uint32_t conv_part_cnt = 0;
+static volatile uint32_t conv_part_limit = 0;        // 0 : 전체, 부하가 높을 때 IR 뒷부분을 생략
+static bool     conv_stereo = false;
+static uint32_t conv_load_taps = 0;
+static bool     conv_load_stereo = false;
+static volatile bool conv_loading = false;
+static volatile bool conv_end_req = false;          // USB 에서 요청한 변환, 스레드에서 처리
+static volatile bool conv_ready = false;
+static volatile bool conv_enable = false;
+
+static conv_stat_t conv_stat;
+
+
+
+
+bool convInit(void)
+{
+  arm_rfft_fast_init_f32(&conv_fft, CONV_FFT_LEN);
+
+  i2sStageAdd("conv", convProcess, NULL);
+  i2sStageEnable("conv", false);
+
+  // EEPROM 에 IR 이 없으면 단위 임펄스로 시작한다.
+  //
+  if (convLoad() != true)
+  {
+    convLoadDelta();
+  }
+
+#if CLI_USE(HW_CONV)
+  cliAdd("conv", cliConv);
+#endif
+  return true;
+}
+
+bool convSetEnable(bool enable)
+{
+  if (enable == true && conv_ready != true)
+  {
+    return false;
+  }
+
+  // 스테이지가 꺼져 있는 동안에만 상태를 초기화한다.
+  //
+  if (enable == true && conv_enable != true)
+  {
+    convReset();
+  }
+  conv_enable = enable;
+  i2sStageEnable("conv", enable);
+
+  return true;
+}
+
+bool convIsEnable(void)
+{
+  return conv_enable;
+}
+
+uint32_t convGetTaps(void)
+{
+  return conv_taps;
+}
+
+// 앞쪽 parts 개 파티션만 계산한다. 0 이면 전체
+//
+bool convSetPartLimit(uint32_t parts)
+{
+  conv_part_limit = parts;
+  return true;
+}
+
+uint32_t convGetPartLimit(void)
+{
+  return conv_part_limit;
+}
+
+void convReset(void)
+{
+  memset(conv_fdl, 0, sizeof(conv_fdl));
+  memset(conv_in, 0, sizeof(conv_in));
+  memset(conv_out, 0, sizeof(conv_out));
+  conv_pos       = 0;
+  conv_fdl_index = 0;
+}
+
+// USB 인터럽트(우선순위 6)는 처리 인터럽트(7)의 convBlock() 을 선점할 수 있으므로
+// begin/taps 는 conv_load_buf 에만 쓰고, conv_ir 은 스레드의 convLoadEnd() 에서만 바꾼다.
+// 업로드하는 동안에는 이전 IR 이 계속 적용된다.
+//
+bool convLoadBegin(uint32_t taps, bool stereo)
+{
+  if (taps == 0 || taps > CONV_TAP_MAX || conv_end_req == true)
+  {
+    return false;
+  }
+
+  conv_loading = false;
+  memset(conv_load_buf, 0, sizeof(conv_load_buf));
+  conv_load_taps   = taps;
+  conv_load_stereo = stereo;
+  conv_loading     = true;
+
+  return true;
+}
+
+bool convLoadTaps(uint8_t ch, uint32_t index, const int16_t *p_taps, uint32_t count)
+{
+  if (conv_loading != true || conv_end_req == true || ch >= (conv_load_stereo ? CONV_CH : 1))
+  {
+    return false;
+  }
+  if (index + count > conv_load_taps)
+  {
+    return false;
+  }
+
+  memcpy(&conv_load_buf[ch][index], p_taps, count * sizeof(int16_t));
+
+  return true;
+}
+
+bool convLoadEnd(void)
+{
+  uint8_t ch_cnt = conv_load_stereo ? CONV_CH : 1;
+
+
+  if (conv_loading != true)
+  {
+    return false;
+  }
+
+  // 스레드보다 처리 인터럽트가 우선이므로 conv_ready 를 내린 뒤에는 convBlock() 이 돌지 않는다.
+  //
+  conv_ready    = false;
+  conv_taps     = conv_load_taps;
+  conv_part_cnt = (conv_taps + CONV_PART_LEN - 1) / CONV_PART_LEN;
+  conv_stereo   = conv_load_stereo;
+
+  // 변환 전까지는 각 파티션 앞쪽 절반에 시간 영역 탭을 둔다.
+  //
+  memset(conv_ir, 0, sizeof(conv_ir));
+  for (int ch=0; ch<ch_cnt; ch++)
+  {
+    for (uint32_t i=0; i<conv_taps; i++)
+    {
+      conv_ir[ch][i / CONV_PART_LEN][i % CONV_PART_LEN] = (float)conv_load_buf[ch][i] * CONV_Q15_TO_F;
+    }
+  }
+  conv_loading = false;
+
+  convApply();
+
+  return true;
+}
+
+// conv_ir 의 시간 영역 탭을 파티션별 스펙트럼으로 바꾸고 스테이지를 다시 켠다.
+//
+void convApply(void)
+{
+  uint8_t ch_cnt = conv_stereo ? CONV_CH : 1;
+
+
+  for (int ch=0; ch<ch_cnt; ch++)
+  {
+    for (uint32_t k=0; k<conv_part_cnt; k++)
+    {
+      memcpy(conv_tmp, conv_ir[ch][k], sizeof(conv_tmp));
+      arm_rfft_fast_f32(&conv_fft, conv_tmp, conv_ir[ch][k], 0);
+    }
+  }
+  if (conv_stereo != true)
+  {
+    memcpy(conv_ir[1], conv_ir[0], sizeof(conv_ir[0]));
+  }
+
+  convReset();
+  conv_ready = true;
+  i2sStageEnable("conv", conv_enable);
+}
+
+// 파티션 FFT 는 인터럽트에서 돌리기에 길어서 audio 스레드의 convUpdate() 로 넘긴다.
+//
+bool convLoadEndAsync(void)
+{
+  if (conv_loading != true)
+  {
+    return false;
+  }
+  conv_end_req = true;
+  eventPost(EVENT_AUDIO_CTRL);
+
+  return true;
+}
+
+void convUpdate(void)
+{
+  if (conv_end_req == true)
+  {
+    convLoadEnd();
+    conv_end_req = false;
+  }
+}
+
+// 바이패스와 같은 결과가 나와야 하는 단위 임펄스
+//
+bool convLoadDelta(void)
+{
+  if (conv_loading == true || conv_end_req == true)
+  {
+    return false;
+  }
+
+  conv_ready    = false;
+  conv_taps     = 1;
+  conv_part_cnt = 1;
+  conv_stereo   = false;
+
+  memset(conv_load_buf, 0, sizeof(conv_load_buf));
+  conv_load_buf[0][0] = 32767;
+  memset(conv_ir, 0, sizeof(conv_ir));
+  conv_ir[0][0][0] = 1.0f;
+
+  convApply();
+
+  return true;
+}
+
+bool convSave(void)
+{
+  bool ret = false;
+
+
+  #ifdef _USE_HW_EEPROM
+  uint8_t ch_cnt = conv_stereo ? CONV_CH : 1;
+  uint8_t head[CONV_EEPROM_HEAD];
+
+  // 업로드 중에는 conv_load_buf 가 적용된 IR 과 다르다.
+  //
+  if (conv_ready != true || conv_loading == true || conv_taps * ch_cnt > CONV_EEPROM_TAP_MAX)
+  {
+    return false;
+  }
+
+  head[0] = CONV_MAGIC;
+  head[1] = (conv_stereo ? CONV_FLAG_STEREO : 0) | (conv_enable ? CONV_FLAG_ENABLE : 0);
+  head[2] = (conv_taps >> 0) & 0xFF;
+  head[3] = (conv_taps >> 8) & 0xFF;
+
+  ret = true;
+  for (uint8_t ch=0; ch<ch_cnt && ret == true; ch++)
+  {
+    ret = eepromWrite(HW_EEPROM_ADDR_CONV + CONV_EEPROM_HEAD + ch * conv_taps * 2, (uint8_t *)conv_load_buf[ch], conv_taps * 2);
+  }
+  if (ret == true)
+  {
+    ret = eepromWrite(HW_EEPROM_ADDR_CONV, head, CONV_EEPROM_HEAD);
+  }
+  #endif
+  return ret;
+}
+
+bool convLoad(void)
+{
+  bool ret = false;
+
+
+  #ifdef _USE_HW_EEPROM
+  uint8_t  head[CONV_EEPROM_HEAD] = {0, };
+  int16_t  taps[16];
+  uint32_t len;
+  uint8_t  ch_cnt;
+
+  if (eepromRead(HW_EEPROM_ADDR_CONV, head, CONV_EEPROM_HEAD) != true || head[0] != CONV_MAGIC)
+  {
+    return false;
+  }
+  len    = head[2] | (head[3] << 8);
+  ch_cnt = (head[1] & CONV_FLAG_STEREO) ? CONV_CH : 1;
+  if (len * ch_cnt > CONV_EEPROM_TAP_MAX || convLoadBegin(len, ch_cnt == CONV_CH) != true)
+  {
+    return false;
+  }
+
+  ret = true;
+  for (uint8_t ch=0; ch<ch_cnt && ret == true; ch++)
+  {
+    for (uint32_t i=0; i<len && ret == true; i+=16)
+    {
+      uint32_t cnt = len - i < 16 ? len - i : 16;
+      uint32_t addr = HW_EEPROM_ADDR_CONV + CONV_EEPROM_HEAD + (ch * len + i) * 2;
+
+      ret = eepromRead(addr, (uint8_t *)taps, cnt * 2);
+      ret = ret && convLoadTaps(ch, i, taps, cnt);
+    }
+  }
+
+  if (ret == true)
+  {
+    convLoadEnd();
+    convSetEnable((head[1] & CONV_FLAG_ENABLE) ? true : false);
+  }
+  else
+  {
+    conv_loading = false;
+    convLoadDelta();
+  }
+  #endif
+  return ret;
+}
+
+// CPU 비율 HW_CONV_LOAD_PCT 안에서 처리 가능한 채널당 탭 수
+//
+uint32_t convGetMaxTaps(uint32_t sample_rate)
+{
+  uint32_t budget;
+  uint32_t parts;
+
+
+  if (sample_rate == 0 || conv_stat.part_cycles == 0)
+  {
+    return 0;
+  }
+
+  budget = (uint32_t)(((uint64_t)SystemCoreClock * CONV_PART_LEN * HW_CONV_LOAD_PCT) / (100ULL * sample_rate));
+  budget = budget / CONV_CH;
+  if (budget <= conv_stat.fixed_cycles)
+  {
+    return 0;
+  }
+  parts = (budget - conv_stat.fixed_cycles) / conv_stat.part_cycles;
+
+  return parts * CONV_PART_LEN;
+}
+
+// 처리 중이 아닐 때 FFT, IFFT, 파티션 곱셈 시간을 잰다.
+//
+bool convBench(void)
+{
+  uint32_t fixed = UINT32_MAX;
+  uint32_t part  = UINT32_MAX;
+  uint32_t pre_time;
+  uint32_t t_fft;
+  uint32_t t_mac;
+
+
+  i2sStageEnable("conv", false);
+
+  for (int i=0; i<8; i++)
+  {
+    memcpy(conv_tmp, conv_in[0], sizeof(conv_tmp));
+
+    pre_time = DWT->CYCCNT;
+    arm_rfft_fast_f32(&conv_fft, conv_tmp, conv_acc, 0);
+    t_fft = DWT->CYCCNT - pre_time;
+
+    pre_time = DWT->CYCCNT;
+    convMac(conv_acc, conv_fdl[0][0], conv_ir[0][0]);
+    t_mac = DWT->CYCCNT - pre_time;
+
+    pre_time = DWT->CYCCNT;
+    arm_rfft_fast_f32(&conv_fft, conv_acc, conv_tmp, 1);
+    t_fft += DWT->CYCCNT - pre_time;
+
+    fixed = t_fft < fixed ? t_fft : fixed;
+    part  = t_mac < part  ? t_mac : part;
+  }
+  conv_stat.fixed_cycles = fixed;
+  conv_stat.part_cycles  = part;
+
+  if (conv_enable == true && conv_ready == true)
+  {
+    convReset();
+    i2sStageEnable("conv", true);
+  }
+  return true;
+}
+
+void convGetStat(conv_stat_t *p_stat)
+{
+  *p_stat = conv_stat;
+}
+
+// packed 형식 : [0] = DC, [1] = Nyquist 실수, 이후 (re, im)
+//
+__RAMFUNC void convMac(float *p_acc, const float *p_x, const float *p_h)
+{
+  p_acc[0] += p_x[0] * p_h[0];
+  p_acc[1] += p_x[1] * p_h[1];
+
+  for (uint32_t i=2; i<CONV_FFT_LEN; i+=2)
+  {
+    float xr = p_x[i + 0];
+    float xi = p_x[i + 1];
+    float hr = p_h[i + 0];
+    float hi = p_h[i + 1];
+
+    p_acc[i + 0] += xr * hr - xi * hi;
+    p_acc[i + 1] += xr * hi + xi * hr;
+  }
+}
+
+void convBlock(void)
+{
+  uint32_t pre_block = DWT->CYCCNT;
+  uint32_t pre_time;
+  uint32_t t_fft = 0;
+  uint32_t t_mac = 0;
+  uint32_t slot  = conv_fdl_index;
+  uint32_t part_use = conv_part_cnt;
+
+
+  if (conv_part_limit > 0 && conv_part_limit < conv_part_cnt)
+  {
+    part_use = conv_part_limit;
+  }
+
+  for (int ch=0; ch<CONV_CH; ch++)
+  {
+    uint32_t k_slot = slot;
+
+    pre_time = DWT->CYCCNT;
+    memcpy(conv_tmp, conv_in[ch], sizeof(conv_tmp));
+    arm_rfft_fast_f32(&conv_fft, conv_tmp, conv_fdl[ch][slot], 0);
+    memcpy(&conv_in[ch][0], &conv_in[ch][CONV_PART_LEN], CONV_PART_LEN * sizeof(float));
+    t_fft += DWT->CYCCNT - pre_time;
+
+    // Y = sum X[n-k] * H[k]
+    //
+    pre_time = DWT->CYCCNT;
+    memset(conv_acc, 0, sizeof(conv_acc));
+    for (uint32_t k=0; k<part_use; k++)
+    {
+      convMac(conv_acc, conv_fdl[ch][k_slot], conv_ir[ch][k]);
+      k_slot = k_slot > 0 ? k_slot - 1 : conv_part_cnt - 1;
+    }
+    t_mac += DWT->CYCCNT - pre_time;
+
+    // 뒤쪽 절반만 유효한 선형 컨볼루션 결과
+    //
+    pre_time = DWT->CYCCNT;
+    arm_rfft_fast_f32(&conv_fft, conv_acc, conv_tmp, 1);
+    memcpy(conv_out[ch], &conv_tmp[CONV_PART_LEN], CONV_PART_LEN * sizeof(float));
+    t_fft += DWT->CYCCNT - pre_time;
+  }
+  conv_fdl_index = slot + 1 < conv_part_cnt ? slot + 1 : 0;
+
+  conv_stat.fixed_cycles = t_fft / CONV_CH;
+  conv_stat.part_cycles  = t_mac / (CONV_CH * part_use);
+  conv_stat.block_cycles = DWT->CYCCNT - pre_block;
+  if (conv_stat.block_cycles > conv_stat.block_cycles_max)
+  {
+    conv_stat.block_cycles_max = conv_stat.block_cycles;
+  }
+}
+
+static inline int32_t convToQ31(float x)
+{
+  if (x >= 1.0f)
+  {
+    conv_stat.clip_cnt++;
+    return INT32_MAX;
+  }
+  if (x < -1.0f)
+  {
+    conv_stat.clip_cnt++;
+    return INT32_MIN;
+  }
+  return (int32_t)(x * CONV_F_TO_Q31);
+}
+
+// DMA 블록(176/192/384 프레임)은 2의 거듭제곱이 아니므로
+// 파티션 단위로 모아서 처리하고, 출력은 파티션 하나만큼 늦게 나간다.
+//
+__RAMFUNC void convProcess(int32_t *p_buf, uint32_t frames, void *arg)
+{
+  uint32_t rate = i2sGetSampleRate();
+
+
+  if (conv_ready != true)
+  {
+    return;
+  }
+  if (rate != conv_rate)
+  {
+    conv_rate = rate;
+    convReset();
+  }
+
+  for (uint32_t i=0; i<frames; i++)
+  {
+    for (int ch=0; ch<CONV_CH; ch++)
+    {
+      conv_in[ch][CONV_PART_LEN + conv_pos] = (float)p_buf[ch] * CONV_Q31_TO_F;
+      p_buf[ch] = convToQ31(conv_out[ch][conv_pos]);
+    }
+    p_buf += CONV_CH;
+
+    conv_pos++;
+    if (conv_pos == CONV_PART_LEN)
+    {
+      convBlock();
+      conv_pos = 0;
+    }
+  }
+}
+
+
+#if CLI_USE(HW_CONV)
+int32_t convParseHex(const char *p_str, int16_t *p_taps, uint32_t max)
+{
+  uint32_t len = strlen(p_str);
+  uint32_t cnt = len / 4;
+
+
+  if (len % 4 != 0 || cnt > max)
+  {
+    return -1;
+  }
+
+  for (uint32_t i=0; i<cnt; i++)
+  {
+    char hex[5];
+
+    memcpy(hex, &p_str[i * 4], 4);
+    hex[4] = 0;
+    p_taps[i] = (int16_t)strtoul(hex, NULL, 16);
+  }
+  return cnt;
+}
+
+void cliConv(cli_args_t *args)
+{
+  bool ret = false;
+
+
+  if (args->argc == 1 && args->isStr(0, "info"))
+  {
+    const uint32_t rate_tbl[3] = {44100, 48000, 96000};
+    uint32_t rate = conv_rate > 0 ? conv_rate : i2sGetSampleRate();
+    uint32_t period = (uint32_t)(((uint64_t)SystemCoreClock * CONV_PART_LEN) / rate);
+
+    cliPrintf("enable   : %s\n", conv_enable ? "on" : "off");
+    cliPrintf("ir       : %d taps, %d part, %s\n", conv_taps, conv_part_cnt, conv_stereo ? "stereo" : "mono");
+    if (conv_part_limit > 0)
+    {
+      cliPrintf("limit    : %d part\n", conv_part_limit);
+    }
+    cliPrintf("latency  : %d frames, %d us\n", CONV_PART_LEN, (int)(((uint64_t)CONV_PART_LEN * 1000000) / rate));
+    cliPrintf("cycles   : %d, max %d per part\n", conv_stat.block_cycles, conv_stat.block_cycles_max);
+    cliPrintf("load     : %d %%\n", (int)(((uint64_t)conv_stat.block_cycles * 100) / period));
+    cliPrintf("clip     : %d\n", conv_stat.clip_cnt);
+    cliPrintf("fft      : %d cycles/ch\n", conv_stat.fixed_cycles);
+    cliPrintf("mac      : %d cycles/part\n", conv_stat.part_cycles);
+    for (int i=0; i<3; i++)
+    {
+      cliPrintf("max taps : %6d Hz, cpu %d, ram %d\n", rate_tbl[i], convGetMaxTaps(rate_tbl[i]), CONV_TAP_MAX);
+    }
+    ret = true;
+  }
+
+  if (args->argc == 1 && args->isStr(0, "on"))
+  {
+    if (convSetEnable(true) != true)
+    {
+      cliPrintf("no ir\n");
+    }
+    ret = true;
+  }
+
+  if (args->argc == 1 && args->isStr(0, "off"))
+  {
+    convSetEnable(false);
+    ret = true;
+  }
+
+  if (args->argc == 1 && args->isStr(0, "delta"))
+  {
+    convLoadDelta();
+    ret = true;
+  }
+
+  if (args->argc >= 2 && args->isStr(0, "begin"))
+  {
+    bool stereo = args->argc == 3 && args->isStr(2, "stereo");
+
+    if (convLoadBegin(args->getData(1), stereo) != true)
+    {
+      cliPrintf("taps 1 ~ %d\n", CONV_TAP_MAX);
+    }
+    ret = true;
+  }
+
+  if (args->argc == 4 && args->isStr(0, "tap"))
+  {
+    int16_t taps[8];
+    int32_t cnt;
+
+    cnt = convParseHex(args->getStr(3), taps, 8);
+    if (cnt < 0 || convLoadTaps(args->getData(1), args->getData(2), taps, cnt) != true)
+    {
+      cliPrintf("tap fail\n");
+    }
+    ret = true;
+  }
+
+  if (args->argc == 1 && args->isStr(0, "end"))
+  {
+    if (convLoadEnd() != true)
+    {
+      cliPrintf("not loading\n");
+    }
+    ret = true;
+  }
+
+  if (args->argc == 1 && args->isStr(0, "save"))
+  {
+    if (convSave() != true)
+    {
+      cliPrintf("save fail, max %d taps\n", CONV_EEPROM_TAP_MAX);
+    }
+    ret = true;
+  }
+
+  if (args->argc == 1 && args->isStr(0, "load"))
+  {
+    if (convLoad() != true)
+    {
+      cliPrintf("load fail\n");
+    }
+    ret = true;
+  }
+
+  if (args->argc == 1 && args->isStr(0, "bench"))
+  {
+    convBench();
+    cliPrintf("fft : %d cycles/ch\n", conv_stat.fixed_cycles);
+    cliPrintf("mac : %d cycles/part\n", conv_stat.part_cycles);
+    ret = true;
+  }
+
+  if (ret == false)
+  {
+    cliPrintf("conv info\n");
+    cliPrintf("conv on:off\n");
+    cliPrintf("conv delta\n");
+    cliPrintf("conv begin taps [stereo]\n");
+    cliPrintf("conv tap ch index hex(Q15 x 8)\n");
+    cliPrintf("conv end\n");
+    cliPrintf("conv save:load\n");
+    cliPrintf("conv bench\n");
+  }
+}
+#endif
+
+#endif
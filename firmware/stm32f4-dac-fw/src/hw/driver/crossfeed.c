@@ -0,0 +1,275 @@
+#include "crossfeed.h"
+
+
+#ifdef _USE_HW_CROSSFEED
+#include "cli.h"
+#include "i2s.h"
+#include "eeprom.h"
+
+
+#define CROSSFEED_RATE_MAX      8
+#define CROSSFEED_MAGIC         0xCF
+#define CROSSFEED_Q31_TO_F      (1.0f / 2147483648.0f)
+#define CROSSFEED_F_TO_Q31      (2147483647.0f)
+
+
+typedef struct
+{
+  const char *name;
+  float       fc_hz;                  // 반대 채널 저역 통과 차단 주파수
+  float       level_db;               // 저역에서의 좌우 레벨 차이
+} crossfeed_preset_t;
+
+// 1차 IIR 2개 (반대 채널 lowpass, 같은 채널 high shelf) 계수
+//
+typedef struct
+{
+  float a0_lo;
+  float b1_lo;
+  float a0_hi;
+  float a1_hi;
+  float b1_hi;
+  float gain;
+} crossfeed_coef_t;
+
+
+#if CLI_USE(HW_CROSSFEED)
+static void cliCrossfeed(cli_args_t *args);
+#endif
+static void crossfeedCalcCoef(crossfeed_coef_t *p_coef, const crossfeed_preset_t *p_preset, uint32_t rate);
+static void crossfeedLoad(void);
+
+static const crossfeed_preset_t crossfeed_preset_tbl[CROSSFEED_MAX] =
+{
+  {"off",  0.0f,   0.0f},
+  {"low",  700.0f, 4.5f},
+  {"mid",  700.0f, 6.0f},
+  {"high", 650.0f, 9.5f},
+};
+
+static const uint32_t crossfeed_rate_tbl[CROSSFEED_RATE_MAX] =
+{
+  96000, 48000, 44100, 32000, 22050, 16000, 11025, 8000,
+};
+
+static crossfeed_coef_t crossfeed_coef_tbl[CROSSFEED_MAX][CROSSFEED_RATE_MAX];
+static volatile CrossfeedPreset_t crossfeed_preset = CROSSFEED_OFF;
+static const crossfeed_coef_t *crossfeed_coef = NULL;
+static uint32_t crossfeed_rate = 0;
+static CrossfeedPreset_t crossfeed_coef_preset = CROSSFEED_OFF;
+
+static float crossfeed_lo[2];
+static float crossfeed_hi[2];
+static float crossfeed_in_pre[2];
+
+
+
+
+bool crossfeedInit(void)
+{
+  // 계수는 미리 모두 계산해 두고 처리 중에는 테이블만 바꾼다.
+  //
+  for (int p=1; p<CROSSFEED_MAX; p++)
+  {
+    for (int r=0; r<CROSSFEED_RATE_MAX; r++)
+    {
+      crossfeedCalcCoef(&crossfeed_coef_tbl[p][r], &crossfeed_preset_tbl[p], crossfeed_rate_tbl[r]);
+    }
+  }
+
+  i2sStageAdd("crossfeed", crossfeedProcess, NULL);
+  crossfeedLoad();
+
+#if CLI_USE(HW_CROSSFEED)
+  cliAdd("crossfeed", cliCrossfeed);
+#endif
+  return true;
+}
+
+// bs2b 방식의 계수 계산
+//
+void crossfeedCalcCoef(crossfeed_coef_t *p_coef, const crossfeed_preset_t *p_preset, uint32_t rate)
+{
+  float gb_lo;
+  float gb_hi;
+  float g_lo;
+  float g_hi;
+  float fc_hi;
+  float x;
+
+  gb_lo = p_preset->level_db * -5.0f / 6.0f - 3.0f;
+  gb_hi = p_preset->level_db / 6.0f - 3.0f;
+  g_lo  = powf(10.0f, gb_lo / 20.0f);
+  g_hi  = 1.0f - powf(10.0f, gb_hi / 20.0f);
+  fc_hi = p_preset->fc_hz * powf(2.0f, (gb_lo - 20.0f * log10f(g_hi)) / 12.0f);
+
+  x = expf(-2.0f * M_PI * p_preset->fc_hz / rate);
+  p_coef->a0_lo = g_lo * (1.0f - x);
+  p_coef->b1_lo = x;
+
+  x = expf(-2.0f * M_PI * fc_hi / rate);
+  p_coef->a0_hi = 1.0f - g_hi * (1.0f - x);
+  p_coef->a1_hi = -x;
+  p_coef->b1_hi = x;
+
+  p_coef->gain = 1.0f / (1.0f - g_hi + g_lo);
+}
+
+void crossfeedLoad(void)
+{
+  uint8_t data[2] = {0, };
+
+  #ifdef _USE_HW_EEPROM
+  eepromRead(HW_EEPROM_ADDR_CROSSFEED, data, 2);
+  #endif
+  if (data[0] == CROSSFEED_MAGIC && data[1] < CROSSFEED_MAX)
+  {
+    crossfeedSetPreset(data[1], false);
+  }
+  else
+  {
+    crossfeedSetPreset(CROSSFEED_OFF, false);
+  }
+}
+
+bool crossfeedSetPreset(CrossfeedPreset_t preset, bool save)
+{
+  if (preset >= CROSSFEED_MAX)
+  {
+    return false;
+  }
+
+  crossfeed_preset = preset;
+  i2sStageEnable("crossfeed", preset != CROSSFEED_OFF);
+
+  #ifdef _USE_HW_EEPROM
+  if (save == true)
+  {
+    uint8_t data[2];
+
+    data[0] = CROSSFEED_MAGIC;
+    data[1] = preset;
+    eepromWriteAsync(HW_EEPROM_ADDR_CROSSFEED, data, 2);
+  }
+  #endif
+  return true;
+}
+
+CrossfeedPreset_t crossfeedGetPreset(void)
+{
+  return crossfeed_preset;
+}
+
+__RAMFUNC void crossfeedProcess(int32_t *p_buf, uint32_t frames, void *arg)
+{
+  const crossfeed_coef_t *p_coef;
+  uint32_t rate = i2sGetSampleRate();
+  float lo_l, lo_r;
+  float hi_l, hi_r;
+  float pre_l, pre_r;
+
+
+  if (crossfeed_preset == CROSSFEED_OFF)
+  {
+    return;
+  }
+
+  if (rate != crossfeed_rate || crossfeed_preset != crossfeed_coef_preset || crossfeed_coef == NULL)
+  {
+    crossfeed_coef = NULL;
+    for (int r=0; r<CROSSFEED_RATE_MAX; r++)
+    {
+      if (crossfeed_rate_tbl[r] == rate)
+      {
+        crossfeed_coef = &crossfeed_coef_tbl[crossfeed_preset][r];
+        break;
+      }
+    }
+    crossfeed_rate        = rate;
+    crossfeed_coef_preset = crossfeed_preset;
+    memset(crossfeed_lo, 0, sizeof(crossfeed_lo));
+    memset(crossfeed_hi, 0, sizeof(crossfeed_hi));
+    memset(crossfeed_in_pre, 0, sizeof(crossfeed_in_pre));
+
+    if (crossfeed_coef == NULL)
+    {
+      return;
+    }
+  }
+  p_coef = crossfeed_coef;
+
+  lo_l  = crossfeed_lo[0];
+  lo_r  = crossfeed_lo[1];
+  hi_l  = crossfeed_hi[0];
+  hi_r  = crossfeed_hi[1];
+  pre_l = crossfeed_in_pre[0];
+  pre_r = crossfeed_in_pre[1];
+
+  for (uint32_t i=0; i<frames; i++)
+  {
+    float in_l = (float)p_buf[0] * CROSSFEED_Q31_TO_F;
+    float in_r = (float)p_buf[1] * CROSSFEED_Q31_TO_F;
+
+    lo_l = p_coef->a0_lo * in_l + p_coef->b1_lo * lo_l;
+    lo_r = p_coef->a0_lo * in_r + p_coef->b1_lo * lo_r;
+    hi_l = p_coef->a0_hi * in_l + p_coef->a1_hi * pre_l + p_coef->b1_hi * hi_l;
+    hi_r = p_coef->a0_hi * in_r + p_coef->a1_hi * pre_r + p_coef->b1_hi * hi_r;
+    pre_l = in_l;
+    pre_r = in_r;
+
+    p_buf[0] = (int32_t)((hi_l + lo_r) * p_coef->gain * CROSSFEED_F_TO_Q31);
+    p_buf[1] = (int32_t)((hi_r + lo_l) * p_coef->gain * CROSSFEED_F_TO_Q31);
+    p_buf += 2;
+  }
+
+  crossfeed_lo[0]     = lo_l;
+  crossfeed_lo[1]     = lo_r;
+  crossfeed_hi[0]     = hi_l;
+  crossfeed_hi[1]     = hi_r;
+  crossfeed_in_pre[0] = pre_l;
+  crossfeed_in_pre[1] = pre_r;
+}
+
+
+#if CLI_USE(HW_CROSSFEED)
+void cliCrossfeed(cli_args_t *args)
+{
+  bool ret = false;
+
+
+  if (args->argc == 1 && args->isStr(0, "info"))
+  {
+    const crossfeed_preset_t *p_preset = &crossfeed_preset_tbl[crossfeed_preset];
+
+    cliPrintf("preset : %s\n", p_preset->name);
+    cliPrintf("fc     : %d Hz\n", (int)p_preset->fc_hz);
+    cliPrintf("level  : %d.%d dB\n", (int)p_preset->level_db, (int)(p_preset->level_db * 10) % 10);
+    if (crossfeed_coef != NULL && crossfeed_preset != CROSSFEED_OFF)
+    {
+      cliPrintf("rate   : %d Hz\n", crossfeed_rate);
+      cliPrintf("gain   : %d/1000\n", (int)(crossfeed_coef->gain * 1000));
+    }
+    ret = true;
+  }
+
+  if (args->argc >= 2 && args->isStr(0, "preset"))
+  {
+    for (int i=0; i<CROSSFEED_MAX; i++)
+    {
+      if (args->isStr(1, crossfeed_preset_tbl[i].name))
+      {
+        crossfeedSetPreset(i, args->argc == 3 && args->isStr(2, "save"));
+        ret = true;
+      }
+    }
+  }
+
+  if (ret == false)
+  {
+    cliPrintf("crossfeed info\n");
+    cliPrintf("crossfeed preset off:low:mid:high [save]\n");
+  }
+}
+#endif
+
+#endif
@@ -0,0 +1,182 @@
+#include "dither.h"
+
+
+#ifdef _USE_HW_DITHER
+#include "cli.h"
+#include "i2s.h"
+
+
+#define DITHER_CH               2
+
+
+#if CLI_USE(HW_DITHER)
+static void cliDither(cli_args_t *args);
+#endif
+
+static DitherMode_t dither_mode = DITHER_MODE_TPDF;
+static uint8_t  dither_bits  = HW_DITHER_BITS;
+static uint32_t dither_shift = 32 - HW_DITHER_BITS;   // Q31 에서 버려지는 비트 수
+static uint32_t dither_rng   = 0x12345678;
+static int32_t  dither_err[DITHER_CH][2];             // 채널별 양자화 오차 e[n-1], e[n-2]
+static uint32_t dither_clip  = 0;
+static const char *dither_mode_str[DITHER_MODE_MAX] = {"off", "tpdf", "shape1", "shape2"};
+
+
+
+
+bool ditherInit(void)
+{
+  i2sStageSetQuantizer("dither", ditherProcess, NULL);
+
+#if CLI_USE(HW_DITHER)
+  cliAdd("dither", cliDither);
+#endif
+  return true;
+}
+
+bool ditherSetMode(DitherMode_t mode)
+{
+  if (mode >= DITHER_MODE_MAX)
+  {
+    return false;
+  }
+  dither_mode = mode;
+  memset(dither_err, 0, sizeof(dither_err));
+  return true;
+}
+
+DitherMode_t ditherGetMode(void)
+{
+  return dither_mode;
+}
+
+// 테스트용으로 16비트 까지 줄여볼 수 있다. DAC 출력은 24비트
+//
+bool ditherSetBits(uint8_t bits)
+{
+  if (bits < 8 || bits > 24)
+  {
+    return false;
+  }
+  dither_bits  = bits;
+  dither_shift = 32 - bits;
+  memset(dither_err, 0, sizeof(dither_err));
+  return true;
+}
+
+uint8_t ditherGetBits(void)
+{
+  return dither_bits;
+}
+
+// Q31 샘플을 dither_bits 로 양자화한다. 하위 비트는 0으로 채워진다.
+//
+__RAMFUNC void ditherProcess(int32_t *p_buf, uint32_t frames, void *arg)
+{
+  uint32_t rng   = dither_rng;
+  uint32_t shift = dither_shift;
+  int32_t  mask  = (int32_t)(0xFFFFFFFFUL << shift);
+  int32_t  half  = (int32_t)(1UL << (shift - 1));
+  int32_t  d_shift = (int32_t)shift - 16;
+  DitherMode_t mode = dither_mode;
+
+
+  for (uint32_t i=0; i<frames; i++)
+  {
+    // xorshift32 한 번으로 두 개의 균일 난수를 얻어 TPDF (+-1 LSB) 를 만든다.
+    //
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+
+    for (int ch=0; ch<DITHER_CH; ch++)
+    {
+      int32_t *p_err = dither_err[ch];
+      int32_t  x     = p_buf[ch];
+      int32_t  v;
+      int32_t  q;
+      int32_t  d = 0;
+
+      if (mode != DITHER_MODE_OFF)
+      {
+        uint32_t r = ch == 0 ? rng : __ROR(rng, 8);
+
+        // 16비트 균일 난수 두 개의 합 (+-2^16) 을 +-1 LSB 로 맞춘다.
+        //
+        d = (int32_t)(int16_t)r + (int32_t)(int16_t)(r >> 16);
+        d = d_shift >= 0 ? d << d_shift : d >> -d_shift;
+      }
+
+      // 양자화 오차를 되먹여 잡음을 고역으로 보낸다.
+      //
+      if (mode == DITHER_MODE_SHAPE1)
+      {
+        x = __QSUB(x, p_err[0]);
+      }
+      else if (mode == DITHER_MODE_SHAPE2)
+      {
+        x = __QADD(__QSUB(x, 2 * p_err[0]), p_err[1]);
+      }
+      v = x;
+
+      q = __QADD(v, d + half);
+      if (q == INT32_MAX || q == INT32_MIN)
+      {
+        dither_clip++;
+      }
+      q &= mask;
+
+      p_err[1] = p_err[0];
+      p_err[0] = q - v;
+
+      p_buf[ch] = q;
+    }
+    p_buf += DITHER_CH;
+  }
+
+  dither_rng = rng;
+}
+
+
+#if CLI_USE(HW_DITHER)
+void cliDither(cli_args_t *args)
+{
+  bool ret = false;
+
+
+  if (args->argc == 1 && args->isStr(0, "info"))
+  {
+    cliPrintf("mode  : %s\n", dither_mode_str[dither_mode]);
+    cliPrintf("bits  : %d\n", dither_bits);
+    cliPrintf("clip  : %d\n", dither_clip);
+    cliPrintf("cost  : see 'i2s stage' (dither)\n");
+    ret = true;
+  }
+
+  if (args->argc == 2 && args->isStr(0, "mode"))
+  {
+    for (int i=0; i<DITHER_MODE_MAX; i++)
+    {
+      if (args->isStr(1, dither_mode_str[i]))
+      {
+        ditherSetMode(i);
+        ret = true;
+      }
+    }
+  }
+
+  if (args->argc == 2 && args->isStr(0, "bits"))
+  {
+    ret = ditherSetBits(args->getData(1));
+  }
+
+  if (ret == false)
+  {
+    cliPrintf("dither info\n");
+    cliPrintf("dither mode off:tpdf:shape1:shape2\n");
+    cliPrintf("dither bits 8~24\n");
+  }
+}
+#endif
+
+#endif
@@ -1,6 +1,8 @@
 #include "eeprom.h"
 #include "i2c.h"
 #include "cli.h"
+#include "qbuffer.h"
+#include "event.h"
 
 
 #ifdef _USE_HW_EEPROM
@@ -13,11 +15,23 @@ void cliEeprom(cli_args_t *args);
 
 
 #define EEPROM_MAX_SIZE   HW_EEPROM_MAX_SIZE
+#define EEPROM_REQ_MAX    (HW_EEPROM_REQ_MAX + 1)
+#define EEPROM_REQ_DATA   16
+
+
+typedef struct
+{
+  uint16_t addr;
+  uint16_t length;
+  uint8_t  data[EEPROM_REQ_DATA];
+} eeprom_req_t;
 
 
 static bool is_init = false;
 static uint8_t i2c_ch = _DEF_I2C1;
 static uint8_t i2c_addr = 0x50;
+static qbuffer_t    req_q;
+static eeprom_req_t req_buf[EEPROM_REQ_MAX];
 
 
 
@@ -27,6 +41,8 @@ bool eepromInit()
   bool ret;
 
 
+  qbufferCreateBySize(&req_q, (uint8_t *)req_buf, sizeof(eeprom_req_t), EEPROM_REQ_MAX);
+
   ret = i2cBegin(i2c_ch, 400);
 
 
@@ -128,7 +144,7 @@ bool eepromRead(uint32_t addr, uint8_t *p_data, uint32_t length)
 
   for (i=0; i<length; i++)
   {
-    ret = eepromReadByte(addr, &p_data[i]);
+    ret = eepromReadByte(addr + i, &p_data[i]);
     if (ret != true)
     {
       break;
@@ -146,7 +162,7 @@ bool eepromWrite(uint32_t addr, uint8_t *p_data, uint32_t length)
 
   for (i=0; i<length; i++)
   {
-    ret = eepromWriteByte(addr, p_data[i]);
+    ret = eepromWriteByte(addr + i, p_data[i]);
     if (ret == false)
     {
       break;
@@ -166,6 +182,84 @@ bool eepromFormat(void)
   return true;
 }
 
+bool eepromWriteAsync(uint32_t addr, uint8_t *p_data, uint32_t length)
+{
+  eeprom_req_t req;
+  uint32_t primask;
+  bool ret = true;
+
+
+  if (addr + length > EEPROM_MAX_SIZE)
+  {
+    return false;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (qbufferAvailableForWrite(&req_q) < (length + EEPROM_REQ_DATA - 1) / EEPROM_REQ_DATA)
+  {
+    ret = false;
+  }
+  while (ret == true && length > 0)
+  {
+    req.addr   = addr;
+    req.length = length > EEPROM_REQ_DATA ? EEPROM_REQ_DATA:length;
+    memcpy(req.data, p_data, req.length);
+    qbufferWrite(&req_q, (uint8_t *)&req, 1);
+
+    addr   += req.length;
+    p_data += req.length;
+    length -= req.length;
+  }
+  __set_PRIMASK(primask);
+
+  #ifdef _USE_HW_EVENT
+  if (ret == true)
+  {
+    eventPost(EVENT_STORAGE);
+  }
+  #endif
+
+  return ret;
+}
+
+uint32_t eepromUpdate(void)
+{
+  eeprom_req_t req;
+  uint32_t primask;
+  uint32_t cnt = 0;
+
+
+  // 느린 EEPROM 쓰기는 요청한 곳이 아닌 여기서 처리한다.
+  //
+  while(1)
+  {
+    bool is_req;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    is_req = qbufferAvailable(&req_q) > 0;
+    if (is_req)
+    {
+      qbufferRead(&req_q, (uint8_t *)&req, 1);
+    }
+    __set_PRIMASK(primask);
+
+    if (is_req == false)
+    {
+      break;
+    }
+
+    if (eepromWrite(req.addr, req.data, req.length) != true)
+    {
+      logPrintf("[NG] eepromUpdate() 0x%X\n", req.addr);
+    }
+    cnt++;
+  }
+
+  return cnt;
+}
+
 
 
 
@@ -187,6 +281,7 @@ void cliEeprom(cli_args_t *args)
     {
       cliPrintf("eeprom init   : %s\n", eepromIsInit() ? "True":"False");
       cliPrintf("eeprom length : %d bytes\n", eepromGetLength());
+      cliPrintf("eeprom queue  : %d\n", qbufferAvailable(&req_q));
     }
     else if(args->isStr(0, "format") == true)
     {
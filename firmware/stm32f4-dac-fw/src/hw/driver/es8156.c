@@ -4,6 +4,7 @@
 #ifdef _USE_HW_ES8156
 #include "i2c.h"
 #include "cli.h"
+#include "bootlog.h"
 
 #ifdef _USE_HW_RTOS
 #define lock()      xSemaphoreTake(mutex_lock, portMAX_DELAY);
@@ -15,6 +16,12 @@
 
 static void cliCmd(cli_args_t *args);
 static bool es8156InitRegs(void);
+static bool es8156ApplyConfig(void);
+static bool writeConfig(uint32_t sample_rate, uint32_t sample_depth);
+static bool writeVolume(uint8_t volume);
+static bool writeMute(bool enable);
+static bool writeEnable(bool enable);
+static bool writePowerDown(bool enable);
 static bool readReg(uint8_t reg_addr, uint8_t *p_data);
 static bool writeReg(uint8_t reg_addr, uint8_t data);
 static bool readRegs(uint8_t reg_addr, uint8_t *p_data, uint32_t length);
@@ -28,8 +35,21 @@ static bool    is_init = false;
 static bool    is_detected = false;
 #ifdef _USE_HW_RTOS
 static SemaphoreHandle_t mutex_lock = NULL;
+static StaticSemaphore_t mutex_buf;
 #endif
 static uint8_t main_volume = 45;
+static uint8_t main_trim = 0;                         // 0.5dB 단위로 더 올리는 양 (loudness)
+
+// 코덱이 준비되기 전의 설정은 저장해 두었다가 준비되면 적용한다.
+//
+static volatile Es8156State_t state = ES8156_STATE_NONE;
+static uint32_t state_time = 0;
+static volatile bool cfg_dirty = false;
+static uint32_t cfg_sample_rate = 48000;
+static uint32_t cfg_sample_depth = 24;
+static bool     cfg_mute = true;
+static bool     cfg_enable = false;
+static bool     cfg_power_down = false;
 
 
 
@@ -41,7 +61,7 @@ bool es8156Init(void)
   bool ret;
 
 #ifdef _USE_HW_RTOS
-  mutex_lock = xSemaphoreCreateMutex();
+  mutex_lock = xSemaphoreCreateMutexStatic(&mutex_buf);
 #endif
 
   if (i2cIsBegin(i2c_ch) == true)
@@ -53,8 +73,11 @@ bool es8156Init(void)
   {    
     is_detected = true;
 
-    es8156InitRegs();
-    es8156SetVolume(main_volume);
+    // 리셋 이후의 시퀀스는 es8156Update()에서 진행한다.
+    //
+    writeReg(ES8156_RESET_REG00, 0x1C);
+    state = ES8156_STATE_RESET;
+    state_time = millis();
   }
 
   is_init = ret;
@@ -70,11 +93,6 @@ bool es8156InitRegs(void)
   bool ret = true;
   uint8_t reg;
 
-  ret &= writeReg(ES8156_RESET_REG00, 0x1C);
-  delay(10);
-  ret &= writeReg(ES8156_RESET_REG00, 0x03);
-  delay(30);
-
   ret &= writeReg(ES8156_SCLK_MODE_REG02,      0x04);
   ret &= writeReg(ES8156_VOLUME_CONTROL_REG14, 0);
   ret &= writeReg(ES8156_ANALOG_SYS2_REG21,    0x07);
@@ -117,7 +135,166 @@ bool es8156InitRegs(void)
   return ret;
 }
 
+bool es8156Update(void)
+{
+  switch(state)
+  {
+    case ES8156_STATE_RESET:
+      if (millis()-state_time >= 10)
+      {
+        writeReg(ES8156_RESET_REG00, 0x03);
+        state = ES8156_STATE_POWER_UP;
+        state_time = millis();
+      }
+      break;
+
+    case ES8156_STATE_POWER_UP:
+      if (millis()-state_time >= 30)
+      {
+        es8156InitRegs();
+        es8156ApplyConfig();
+        #ifdef _USE_HW_BOOTLOG
+        bootlogMark("es8156 ready");
+        #endif
+      }
+      break;
+
+    default:
+      break;
+  }
+
+  return state == ES8156_STATE_READY;
+}
+
+bool es8156IsReady(void)
+{
+  return state == ES8156_STATE_READY;
+}
+
+bool es8156ApplyConfig(void)
+{
+  bool ret = true;
+  uint32_t primask;
+
+
+  // 적용 중에 설정이 바뀌면 다시 적용한다.
+  //
+  while(1)
+  {
+    cfg_dirty = false;
+
+    ret &= writeConfig(cfg_sample_rate, cfg_sample_depth);
+    ret &= writeVolume(main_volume);
+    ret &= writeMute(cfg_mute);
+    ret &= writeEnable(cfg_enable);
+    ret &= writePowerDown(cfg_power_down);
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if (cfg_dirty == false)
+    {
+      state = ES8156_STATE_READY;
+      __set_PRIMASK(primask);
+      break;
+    }
+    __set_PRIMASK(primask);
+  }
+
+  return ret;
+}
+
 bool es8156SetConfig(uint32_t sample_rate, uint32_t sample_depth)
+{
+  cfg_sample_rate  = sample_rate;
+  cfg_sample_depth = sample_depth;
+  if (state != ES8156_STATE_READY)
+  {
+    cfg_dirty = true;
+    return true;
+  }
+  return writeConfig(sample_rate, sample_depth);
+}
+
+bool es8156SetVolume(uint8_t volume)
+{
+  main_volume = constrain(volume, 0, 100);
+  if (state != ES8156_STATE_READY)
+  {
+    cfg_dirty = true;
+    return true;
+  }
+  return writeVolume(main_volume);
+}
+
+// 레지스터 값에 더하며 0dB(0xBF) 를 넘지 않는다.
+//
+bool es8156SetVolumeTrim(uint8_t trim)
+{
+  if (trim == main_trim)
+  {
+    return true;
+  }
+  main_trim = trim;
+  if (state != ES8156_STATE_READY)
+  {
+    cfg_dirty = true;
+    return true;
+  }
+  return writeVolume(main_volume);
+}
+
+uint8_t es8156GetVolume(void)
+{
+  return main_volume;
+}
+
+// 0dB(0xBF) 에서 잘린 만큼을 뺀, 실제로 더해진 보정
+//
+uint8_t es8156GetVolumeTrim(void)
+{
+  uint8_t d = cmap(main_volume, 0, 100, 0, 0xBF);
+
+  if (main_volume == 0)
+  {
+    return 0;
+  }
+  return cmin(main_trim, 0xBF - d);
+}
+
+bool es8156SetMute(bool enable)
+{
+  cfg_mute = enable;
+  if (state != ES8156_STATE_READY)
+  {
+    cfg_dirty = true;
+    return true;
+  }
+  return writeMute(enable);
+}
+
+bool es8156SetEnable(bool enable)
+{
+  cfg_enable = enable;
+  if (state != ES8156_STATE_READY)
+  {
+    cfg_dirty = true;
+    return true;
+  }
+  return writeEnable(enable);
+}
+
+bool es8156SetPowerDown(bool enable)
+{
+  cfg_power_down = enable;
+  if (state != ES8156_STATE_READY)
+  {
+    cfg_dirty = true;
+    return true;
+  }
+  return writePowerDown(enable);
+}
+
+bool writeConfig(uint32_t sample_rate, uint32_t sample_depth)
 {
   bool ret = true;
 
@@ -146,38 +323,43 @@ bool es8156SetConfig(uint32_t sample_rate, uint32_t sample_depth)
   return ret;
 }
 
-bool es8156SetVolume(uint8_t volume)
+bool writeVolume(uint8_t volume)
 {
-  bool ret;
-
-
-  main_volume = constrain(volume, 0, 100); 
-
   uint8_t d;
   
-  d = cmap(main_volume, 0, 100, 0, 0xBF);
-  if (0 == main_volume) 
+  d = cmap(volume, 0, 100, 0, 0xBF);
+  if (0 == volume) 
   {
     d = 0;
   }
-  ret = writeReg(ES8156_VOLUME_CONTROL_REG14, d);
-
-  return ret;
+  else
+  {
+    d = constrain(d + main_trim, 0, 0xBF);
+  }
+  return writeReg(ES8156_VOLUME_CONTROL_REG14, d);
 }
 
-uint8_t es8156GetVolume(void)
+bool writeMute(bool enable)
 {
-  return main_volume;
+  return modifyReg(ES8156_DAC_SDP_REG11, 3, 1, enable);
 }
 
-bool es8156SetMute(bool enable)
+bool writeEnable(bool enable)
 {
-  return modifyReg(ES8156_DAC_SDP_REG11, 3, 1, enable);
+  return modifyReg(ES8156_ANALOG_SYS5_REG25, 0, 1, !enable);
 }
 
-bool es8156SetEnable(bool enable)
+bool writePowerDown(bool enable)
 {
-  return modifyReg(ES8156_ANALOG_SYS5_REG25, 0, 1, !enable);
+  bool ret = true;
+
+  // VMID는 유지하여 다시 켤 때 팝 노이즈 없이 빠르게 복귀한다.
+  // DAC 기준 회로와 내부 클럭만 끈다.
+  //
+  ret &= modifyReg(ES8156_ANALOG_SYS5_REG25, 2, 1, enable);
+  ret &= writeReg(ES8156_CLOCK_ON_OFF_REG08, enable ? 0x00:0x3F);
+
+  return ret;
 }
 
 bool modifyReg(uint8_t reg_addr, uint8_t offset, uint8_t bit_len, uint8_t data)
@@ -255,6 +437,7 @@ void cliCmd(cli_args_t *args)
   {
     cliPrintf("is_init     : %s\n", is_init ? "True" : "False");
     cliPrintf("is_detected : %s\n", is_detected ? "True" : "False");
+    cliPrintf("is_ready    : %s\n", es8156IsReady() ? "True" : "False");
     cliPrintf("volume      : %d%%\n", main_volume);
     ret = true;
   }
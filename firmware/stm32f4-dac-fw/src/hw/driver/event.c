@@ -0,0 +1,217 @@
+#include "event.h"
+
+
+#ifdef _USE_HW_EVENT
+#include "cli.h"
+
+
+typedef struct
+{
+  uint32_t post_cnt[EVENT_MAX];
+  uint32_t wait_cnt;
+  uint32_t sleep_cnt;
+  uint32_t wake_cnt;
+  uint32_t timeout_cnt;
+
+  uint32_t latency_cur;                 // 이벤트 발생부터 처리까지 (cycles)
+  uint32_t latency_max;
+  uint64_t latency_sum;
+  uint32_t latency_cnt;
+} event_stat_t;
+
+
+#if CLI_USE(HW_EVENT)
+static void cliEvent(cli_args_t *args);
+#endif
+
+static bool is_init = false;
+static volatile uint32_t event_flags = 0;
+static volatile uint32_t event_post_cycles = 0;
+static event_stat_t event_stat;
+#ifdef _USE_HW_RTOS
+static TaskHandle_t event_task[EVENT_MAX];   // 이벤트를 기다리는 태스크
+#endif
+
+static const char *event_name[EVENT_MAX] =
+{
+  "UART_RX",
+  "USB_CTRL",
+  "BUTTON",
+  "SWTIMER",
+  "LOG",
+  "AUDIO_CTRL",
+  "STORAGE",
+  "DSP",
+};
+
+
+
+
+bool eventInit(void)
+{
+  memset(&event_stat, 0, sizeof(event_stat));
+
+  is_init = true;
+
+  logPrintf("[OK] eventInit()\n");
+
+#if CLI_USE(HW_EVENT)
+  cliAdd("event", cliEvent);
+#endif
+  return true;
+}
+
+void eventPost(EventId_t id)
+{
+  uint32_t pre_flags;
+
+  if (id >= EVENT_MAX) return;
+
+  pre_flags = __atomic_fetch_or(&event_flags, EVENT_BIT(id), __ATOMIC_RELEASE);
+  if (pre_flags == 0)
+  {
+    event_post_cycles = cycles();
+  }
+  __atomic_fetch_add(&event_stat.post_cnt[id], 1, __ATOMIC_RELAXED);
+
+#ifdef _USE_HW_RTOS
+  // 이벤트를 기다리는 태스크에 알림을 보낸다.
+  //
+  if (event_task[id] != NULL && xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED)
+  {
+    if (__get_IPSR() != 0)
+    {
+      BaseType_t is_woken = pdFALSE;
+
+      vTaskNotifyGiveFromISR(event_task[id], &is_woken);
+      portYIELD_FROM_ISR(is_woken);
+    }
+    else
+    {
+      xTaskNotifyGive(event_task[id]);
+    }
+  }
+#endif
+}
+
+uint32_t eventGet(void)
+{
+  return event_flags;
+}
+
+uint32_t eventWait(uint32_t mask, uint32_t timeout_ms)
+{
+  uint32_t flags;
+  uint32_t pre_time;
+
+
+  event_stat.wait_cnt++;
+
+#ifdef _USE_HW_RTOS
+  // 호출한 태스크를 mask의 이벤트 대기 태스크로 등록한다.
+  //
+  if (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING)
+  {
+    for (int i=0; i<EVENT_MAX; i++)
+    {
+      if (mask & EVENT_BIT(i))
+      {
+        event_task[i] = xTaskGetCurrentTaskHandle();
+      }
+    }
+  }
+#endif
+
+  pre_time = millis();
+  while(1)
+  {
+    flags = __atomic_fetch_and(&event_flags, ~mask, __ATOMIC_ACQUIRE) & mask;
+    if (flags != 0)
+    {
+      event_stat.latency_cur  = cycles() - event_post_cycles;
+      event_stat.latency_sum += event_stat.latency_cur;
+      event_stat.latency_cnt++;
+      if (event_stat.latency_cur > event_stat.latency_max)
+      {
+        event_stat.latency_max = event_stat.latency_cur;
+      }
+      break;
+    }
+
+    if (millis()-pre_time >= timeout_ms)
+    {
+      event_stat.timeout_cnt++;
+      break;
+    }
+
+#ifdef _USE_HW_RTOS
+    // 알림은 카운트되므로 검사 이후에 발생한 이벤트도 놓치지 않는다.
+    //
+    event_stat.sleep_cnt++;
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(timeout_ms - (millis()-pre_time)));
+#else
+    // 검사와 WFI 사이에 발생한 이벤트를 놓치지 않도록 인터럽트를 막고 잠든다.
+    // PRIMASK가 설정되어 있어도 인터럽트 요청이 들어오면 깨어난다.
+    //
+    __disable_irq();
+    if ((event_flags & mask) == 0)
+    {
+      event_stat.sleep_cnt++;
+      __DSB();
+      __WFI();
+    }
+    __enable_irq();
+#endif
+    event_stat.wake_cnt++;
+  }
+
+  return flags;
+}
+
+
+#if CLI_USE(HW_EVENT)
+void cliEvent(cli_args_t *args)
+{
+  bool ret = false;
+
+
+  if (args->argc == 1 && args->isStr(0, "info"))
+  {
+    uint32_t cycles_per_us = SystemCoreClock / 1000000;
+    uint32_t latency_avg = 0;
+
+    if (event_stat.latency_cnt > 0)
+    {
+      latency_avg = (uint32_t)(event_stat.latency_sum / event_stat.latency_cnt);
+    }
+
+    for (int i=0; i<EVENT_MAX; i++)
+    {
+      cliPrintf("%-10s : %d\n", event_name[i], event_stat.post_cnt[i]);
+    }
+    cliPrintf("wait       : %d\n", event_stat.wait_cnt);
+    cliPrintf("sleep      : %d\n", event_stat.sleep_cnt);
+    cliPrintf("wake       : %d\n", event_stat.wake_cnt);
+    cliPrintf("timeout    : %d\n", event_stat.timeout_cnt);
+    cliPrintf("latency    : %d us, avg %d us, max %d us\n",
+      event_stat.latency_cur / cycles_per_us,
+      latency_avg / cycles_per_us,
+      event_stat.latency_max / cycles_per_us);
+    ret = true;
+  }
+
+  if (args->argc == 1 && args->isStr(0, "clear"))
+  {
+    memset(&event_stat, 0, sizeof(event_stat));
+    ret = true;
+  }
+
+  if (ret == false)
+  {
+    cliPrintf("event info\n");
+    cliPrintf("event clear\n");
+  }
+}
+#endif
+
+#endif
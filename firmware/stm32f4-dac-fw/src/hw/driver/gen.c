@@ -0,0 +1,610 @@
+#include "gen.h"
+
+
+#ifdef _USE_HW_GEN
+#include "cli.h"
+#include "i2s.h"
+#include "event.h"
+#include "buzzer.h"
+
+
+#define GEN_CH                  2
+#define GEN_TBL_BITS            8                     // 1/4 주기 테이블, 한 주기 1024 포인트
+#define GEN_TBL_LEN             (1 << GEN_TBL_BITS)
+#define GEN_LEVEL_DEF           (-200)                // -20 dBFS
+#define GEN_PHASE_ONE           4294967296.0f
+
+
+typedef enum
+{
+  GEN_STATE_IDLE = 0,
+  GEN_STATE_RUN,
+  GEN_STATE_DONE,                     // 처리 인터럽트에서 끝남, 스레드에서 정리
+} GenState_t;
+
+typedef struct
+{
+  gen_cfg_t cfg;
+  uint32_t  rate;
+  int32_t   amp;                      // Q31, MULTI 는 톤당
+  uint32_t  phase[GEN_TONE_MAX];
+  uint32_t  inc[GEN_TONE_MAX];
+  float     sweep_inc;                // 시작 주파수의 위상 증가량
+  float     sweep_log2;               // log2(끝/시작)
+  uint32_t  rng;
+  uint32_t  frames;
+  uint32_t  frames_total;             // 0 : 계속
+} gen_t;
+
+typedef struct
+{
+  uint16_t  freq_hz;                  // 0 : 쉼표
+  uint16_t  time_ms;
+} gen_note_t;
+
+
+#if CLI_USE(HW_GEN)
+static void cliGen(cli_args_t *args);
+#endif
+static bool genRun(const gen_cfg_t *p_cfg, uint8_t melody_cnt);
+static void genSetRate(gen_t *p_gen, uint32_t rate);
+static void genNextNote(gen_t *p_gen);
+
+static gen_t gen;
+static volatile GenState_t gen_state = GEN_STATE_IDLE;
+static volatile uint32_t gen_sample_cnt = 0;
+static bool    gen_unmute = false;                    // 시작할 때 뮤트를 풀었으면 끝날 때 되돌린다.
+static int32_t gen_sin_tbl[GEN_TBL_LEN + 1];
+
+// 음표 사이의 쉼표까지 큐에 넣고, 처리 인터럽트에서 한 음이 끝날 때마다 다음 음으로 바꾼다.
+//
+static gen_note_t gen_melody[GEN_MELODY_MAX * 2];
+static volatile uint8_t gen_melody_cnt = 0;
+static volatile uint8_t gen_melody_pos = 0;
+static int32_t gen_melody_amp = 0;
+
+#if CLI_USE(HW_GEN)
+static uint8_t gen_ch = GEN_CH_BOTH;
+static bool    gen_mix = false;
+static const char *gen_mode_str[GEN_MODE_MAX] = {"sine", "square", "multi", "sweep", "noise"};
+#endif
+
+
+
+
+bool genInit(void)
+{
+  for (int i=0; i<=GEN_TBL_LEN; i++)
+  {
+    float s = sinf((float)M_PI * 0.5f * (float)i / GEN_TBL_LEN);
+
+    gen_sin_tbl[i] = s >= 1.0f ? INT32_MAX : (int32_t)(s * 2147483648.0f);
+  }
+
+  i2sSetSource("gen", genProcess, NULL);
+
+#if CLI_USE(HW_GEN)
+  cliAdd("gen", cliGen);
+#endif
+  return true;
+}
+
+// CLI 등 스레드에서 호출한다. 바로 반환하고 재생은 처리 인터럽트에서 진행된다.
+//
+bool genStart(const gen_cfg_t *p_cfg)
+{
+  return genRun(p_cfg, 0);
+}
+
+bool genRun(const gen_cfg_t *p_cfg, uint8_t melody_cnt)
+{
+  gen_t    next;
+  uint32_t primask;
+
+
+  if (p_cfg->mode >= GEN_MODE_MAX || (p_cfg->ch & GEN_CH_BOTH) == 0)
+  {
+    return false;
+  }
+  if (p_cfg->mode == GEN_MULTI && (p_cfg->tone_cnt == 0 || p_cfg->tone_cnt > GEN_TONE_MAX))
+  {
+    return false;
+  }
+  if (p_cfg->mode == GEN_SWEEP && (p_cfg->time_ms == 0 || p_cfg->freq_hz[0] <= 0.0f || p_cfg->freq_hz[1] <= 0.0f))
+  {
+    return false;
+  }
+
+  memset(&next, 0, sizeof(next));
+  next.cfg = *p_cfg;
+  next.amp = p_cfg->level_db10 >= 0 ? INT32_MAX : (int32_t)(powf(10.0f, p_cfg->level_db10 / 200.0f) * 2147483648.0f);
+  if (p_cfg->mode == GEN_MULTI)
+  {
+    next.amp /= p_cfg->tone_cnt;
+  }
+  if (melody_cnt > 0 && p_cfg->freq_hz[0] == 0.0f)
+  {
+    next.amp = 0;                                     // 쉼표로 시작하는 멜로디
+  }
+  next.rng = 0x12345678;
+  genSetRate(&next, i2sGetSampleRate());
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  gen = next;
+  gen_melody_cnt = melody_cnt;
+  gen_melody_pos = 1;
+  gen_state = GEN_STATE_RUN;
+  __set_PRIMASK(primask);
+
+  if (i2sIsMute() == true)
+  {
+    gen_unmute = true;
+    i2sMute(false);
+  }
+  i2sSourceEnable(true, p_cfg->mix != true);
+
+  return true;
+}
+
+bool genStop(void)
+{
+  i2sSourceEnable(false, false);
+  gen_melody_cnt = 0;
+  gen_state = GEN_STATE_IDLE;
+
+  if (gen_unmute == true)
+  {
+    gen_unmute = false;
+    i2sMute(true);
+  }
+  return true;
+}
+
+bool genIsBusy(void)
+{
+  return gen_state != GEN_STATE_IDLE;
+}
+
+// 기존 i2sPlayBeep() 과 같은 음량 : volume 100 = INT16_MAX/40
+//
+bool genBeep(uint32_t freq_hz, uint16_t volume, uint32_t time_ms)
+{
+  gen_cfg_t cfg;
+
+
+  if (freq_hz == 0 || time_ms == 0 || volume == 0)
+  {
+    return true;
+  }
+  volume = constrain(volume, 0, 100);
+
+  memset(&cfg, 0, sizeof(cfg));
+  cfg.mode       = GEN_SINE;
+  cfg.freq_hz[0] = freq_hz;
+  cfg.level_db10 = (int16_t)(200.0f * log10f((float)volume / (100.0f * 40.0f)));
+  cfg.ch         = GEN_CH_BOTH;
+  cfg.time_ms    = time_ms;
+  cfg.mix        = true;                              // 시스템 음은 USB 스트림 위에 섞는다.
+
+  return genStart(&cfg);
+}
+
+// 예전 gen melody 와 같은 간격 : 음 길이의 30% 만큼 쉰다.
+// 큐에 넣고 바로 반환한다.
+//
+bool genMelody(const uint16_t *p_freq, const uint16_t *p_time_ms, uint8_t cnt, uint16_t volume)
+{
+  gen_cfg_t cfg;
+  uint8_t   q_cnt = 0;
+  uint32_t  primask;
+
+
+  if (cnt == 0 || cnt > GEN_MELODY_MAX || volume == 0)
+  {
+    return false;
+  }
+
+  // 재생 중인 큐를 처리 인터럽트가 더 읽지 않도록 먼저 비운다.
+  //
+  primask = __get_PRIMASK();
+  __disable_irq();
+  gen_melody_cnt = 0;
+  __set_PRIMASK(primask);
+
+  for (int i=0; i<cnt; i++)
+  {
+    uint16_t rest_ms = p_time_ms[i] * 3 / 10;
+
+    if (p_time_ms[i] == 0)
+    {
+      continue;
+    }
+    gen_melody[q_cnt].freq_hz = p_freq[i];
+    gen_melody[q_cnt].time_ms = p_time_ms[i];
+    q_cnt++;
+    if (rest_ms > 0)
+    {
+      gen_melody[q_cnt].freq_hz = 0;
+      gen_melody[q_cnt].time_ms = rest_ms;
+      q_cnt++;
+    }
+  }
+  if (q_cnt == 0)
+  {
+    return false;
+  }
+
+  volume = constrain(volume, 0, 100);
+
+  memset(&cfg, 0, sizeof(cfg));
+  cfg.mode       = GEN_SINE;
+  cfg.freq_hz[0] = gen_melody[0].freq_hz;
+  cfg.level_db10 = (int16_t)(200.0f * log10f((float)volume / (100.0f * 40.0f)));
+  cfg.ch         = GEN_CH_BOTH;
+  cfg.time_ms    = gen_melody[0].time_ms;
+  cfg.mix        = true;
+
+  gen_melody_amp = (int32_t)(powf(10.0f, cfg.level_db10 / 200.0f) * 2147483648.0f);
+  return genRun(&cfg, q_cnt);
+}
+
+uint32_t genGetSampleCount(void)
+{
+  return gen_sample_cnt;
+}
+
+// 재생이 끝나면 처리 인터럽트가 EVENT_AUDIO_CTRL 로 알린다.
+//
+void genUpdate(void)
+{
+  if (gen_state == GEN_STATE_DONE)
+  {
+    genStop();
+  }
+}
+
+void genSetRate(gen_t *p_gen, uint32_t rate)
+{
+  gen_cfg_t *p_cfg = &p_gen->cfg;
+
+
+  p_gen->rate = rate;
+  for (int i=0; i<GEN_TONE_MAX; i++)
+  {
+    float f = p_cfg->freq_hz[i] < rate / 2 ? p_cfg->freq_hz[i] : 0.0f;
+
+    p_gen->inc[i] = (uint32_t)(f / rate * GEN_PHASE_ONE);
+  }
+  if (p_cfg->mode == GEN_SWEEP)
+  {
+    float f_end = p_cfg->freq_hz[1] < rate / 2 ? p_cfg->freq_hz[1] : rate / 2;
+
+    p_gen->sweep_inc  = p_cfg->freq_hz[0] / rate * GEN_PHASE_ONE;
+    p_gen->sweep_log2 = log2f(f_end / p_cfg->freq_hz[0]);
+  }
+  p_gen->frames_total = (uint32_t)(((uint64_t)rate * p_cfg->time_ms) / 1000);
+}
+
+// 처리 인터럽트에서 호출한다. 음의 경계는 믹서 소스 단위(32 프레임)이다.
+//
+void genNextNote(gen_t *p_gen)
+{
+  const gen_note_t *p_note = &gen_melody[gen_melody_pos];
+
+  p_gen->cfg.freq_hz[0] = p_note->freq_hz;
+  p_gen->cfg.time_ms    = p_note->time_ms;
+  p_gen->amp            = p_note->freq_hz > 0 ? gen_melody_amp : 0;
+  p_gen->phase[0]       = 0;
+  p_gen->frames         = 0;
+  genSetRate(p_gen, p_gen->rate);
+
+  gen_melody_pos++;
+}
+
+// 1/4 주기 테이블 + 선형 보간, 오차 약 -105 dB
+//
+static inline int32_t genSin(uint32_t phase)
+{
+  uint32_t p    = (phase & 0x40000000) ? ~phase : phase;
+  uint32_t idx  = (p >> (30 - GEN_TBL_BITS)) & (GEN_TBL_LEN - 1);
+  int32_t  frac = (p >> (30 - GEN_TBL_BITS - 15)) & 0x7FFF;
+  int32_t  a    = gen_sin_tbl[idx];
+  int32_t  s;
+
+  s = a + (int32_t)(((int64_t)(gen_sin_tbl[idx + 1] - a) * frac) >> 15);
+
+  return (phase & 0x80000000) ? -s : s;
+}
+
+static inline int32_t genMul(int32_t x, int32_t amp)
+{
+  return (int32_t)(((int64_t)x * amp) >> 31);
+}
+
+static inline void genOut(int32_t *p_out, int32_t s, int32_t mask_l, int32_t mask_r)
+{
+  p_out[0] = s & mask_l;
+  p_out[1] = s & mask_r;
+}
+
+// 믹서 소스 : 버퍼를 항상 덮어쓴다. 스트림에 섞을지는 믹서가 정한다(cfg.mix).
+//
+__RAMFUNC void genProcess(int32_t *p_buf, uint32_t frames, void *arg)
+{
+  gen_t   *p_gen = &gen;
+  uint32_t rate  = i2sGetSampleRate();
+  uint32_t run   = frames;
+  int32_t  mask_l;
+  int32_t  mask_r;
+  int32_t  amp;
+
+
+  if (gen_state != GEN_STATE_RUN)
+  {
+    memset(p_buf, 0, frames * GEN_CH * sizeof(int32_t));
+    return;
+  }
+  if (rate != p_gen->rate)
+  {
+    genSetRate(p_gen, rate);
+  }
+  if (p_gen->frames_total > 0 && p_gen->frames_total - p_gen->frames < run)
+  {
+    run = p_gen->frames_total - p_gen->frames;
+  }
+
+  mask_l = (p_gen->cfg.ch & GEN_CH_L) ? -1 : 0;
+  mask_r = (p_gen->cfg.ch & GEN_CH_R) ? -1 : 0;
+  amp    = p_gen->amp;
+
+  switch(p_gen->cfg.mode)
+  {
+    case GEN_SINE:
+      {
+        uint32_t phase = p_gen->phase[0];
+        uint32_t inc   = p_gen->inc[0];
+
+        for (uint32_t i=0; i<run; i++)
+        {
+          int32_t s = genMul(genSin(phase), amp);
+
+          genOut(&p_buf[i*2], s, mask_l, mask_r);
+          phase += inc;
+        }
+        p_gen->phase[0] = phase;
+      }
+      break;
+
+    case GEN_SQUARE:
+      {
+        uint32_t phase = p_gen->phase[0];
+        uint32_t inc   = p_gen->inc[0];
+
+        for (uint32_t i=0; i<run; i++)
+        {
+          int32_t s = (phase & 0x80000000) ? -amp : amp;
+
+          genOut(&p_buf[i*2], s, mask_l, mask_r);
+          phase += inc;
+        }
+        p_gen->phase[0] = phase;
+      }
+      break;
+
+    case GEN_MULTI:
+      for (uint32_t i=0; i<run; i++)
+      {
+        int32_t s = 0;
+
+        for (int t=0; t<p_gen->cfg.tone_cnt; t++)
+        {
+          s += genMul(genSin(p_gen->phase[t]), amp);
+          p_gen->phase[t] += p_gen->inc[t];
+        }
+        genOut(&p_buf[i*2], s, mask_l, mask_r);
+      }
+      break;
+
+    case GEN_SWEEP:
+      {
+        // 블록 양 끝의 위상 증가량만 지수로 구하고 블록 안에서는 선형으로 잇는다.
+        //
+        uint32_t phase = p_gen->phase[0];
+        float    inc_a = p_gen->sweep_inc * exp2f(p_gen->sweep_log2 * p_gen->frames / p_gen->frames_total);
+        float    inc_b = p_gen->sweep_inc * exp2f(p_gen->sweep_log2 * (p_gen->frames + run) / p_gen->frames_total);
+        uint32_t inc   = (uint32_t)inc_a;
+        int32_t  step  = run > 0 ? (int32_t)((inc_b - inc_a) / run) : 0;
+
+        for (uint32_t i=0; i<run; i++)
+        {
+          int32_t s = genMul(genSin(phase), amp);
+
+          genOut(&p_buf[i*2], s, mask_l, mask_r);
+          phase += inc;
+          inc   += step;
+        }
+        p_gen->phase[0] = phase;
+      }
+      break;
+
+    case GEN_NOISE:
+      {
+        uint32_t x = p_gen->rng;
+
+        for (uint32_t i=0; i<run; i++)
+        {
+          int32_t s;
+
+          x ^= x << 13;
+          x ^= x >> 17;
+          x ^= x << 5;
+          s = genMul((int32_t)x, amp);
+          genOut(&p_buf[i*2], s, mask_l, mask_r);
+        }
+        p_gen->rng = x;
+      }
+      break;
+
+    default:
+      run = 0;
+      break;
+  }
+
+  if (run < frames)
+  {
+    memset(&p_buf[run * GEN_CH], 0, (frames - run) * GEN_CH * sizeof(int32_t));
+  }
+  p_gen->frames  += run;
+  gen_sample_cnt += run;
+
+  if (p_gen->frames_total > 0 && p_gen->frames >= p_gen->frames_total)
+  {
+    if (gen_melody_pos < gen_melody_cnt)
+    {
+      genNextNote(p_gen);
+    }
+    else
+    {
+      gen_state = GEN_STATE_DONE;
+      eventPost(EVENT_AUDIO_CTRL);
+    }
+  }
+}
+
+
+#if CLI_USE(HW_GEN)
+static int16_t cliGenLevel(cli_args_t *args, uint8_t index)
+{
+  if (args->argc > index)
+  {
+    return (int16_t)(args->getFloat(index) * 10.0f);
+  }
+  return GEN_LEVEL_DEF;
+}
+
+void cliGen(cli_args_t *args)
+{
+  bool ret = false;
+  gen_cfg_t cfg;
+
+
+  memset(&cfg, 0, sizeof(cfg));
+  cfg.ch  = gen_ch;
+  cfg.mix = gen_mix;
+
+  if (args->argc == 1 && args->isStr(0, "info"))
+  {
+    gen_cfg_t *p_cfg = &gen.cfg;
+
+    cliPrintf("state   : %s\n", gen_state == GEN_STATE_IDLE ? "idle":"run");
+    cliPrintf("mode    : %s\n", gen_mode_str[p_cfg->mode]);
+    cliPrintf("ch      : %s\n", gen_ch == GEN_CH_BOTH ? "lr":(gen_ch == GEN_CH_L ? "l":"r"));
+    cliPrintf("mix     : %s\n", gen_mix ? "on":"off");
+    cliPrintf("level   : %c%d.%d dBFS\n", p_cfg->level_db10 < 0 ? '-':' ', abs(p_cfg->level_db10)/10, abs(p_cfg->level_db10)%10);
+    cliPrintf("samples : %d / %d\n", gen.frames, gen.frames_total);
+    if (gen_melody_cnt > 0)
+    {
+      cliPrintf("melody  : %d / %d\n", gen_melody_pos, gen_melody_cnt);
+    }
+    cliPrintf("total   : %d\n", gen_sample_cnt);
+    ret = true;
+  }
+
+  if (args->argc >= 2 && args->argc <= 4 && (args->isStr(0, "sine") || args->isStr(0, "square")))
+  {
+    cfg.mode       = args->isStr(0, "sine") ? GEN_SINE : GEN_SQUARE;
+    cfg.freq_hz[0] = args->getFloat(1);
+    cfg.level_db10 = cliGenLevel(args, 2);
+    cfg.time_ms    = args->argc > 3 ? args->getData(3) : 0;
+    ret = genStart(&cfg);
+  }
+
+  if (args->argc >= 3 && args->argc <= 2 + GEN_TONE_MAX && args->isStr(0, "multi"))
+  {
+    cfg.mode       = GEN_MULTI;
+    cfg.level_db10 = cliGenLevel(args, 1);
+    cfg.tone_cnt   = args->argc - 2;
+    for (int i=0; i<cfg.tone_cnt; i++)
+    {
+      cfg.freq_hz[i] = args->getFloat(2 + i);
+    }
+    ret = genStart(&cfg);
+  }
+
+  if ((args->argc == 4 || args->argc == 5) && args->isStr(0, "sweep"))
+  {
+    cfg.mode       = GEN_SWEEP;
+    cfg.freq_hz[0] = args->getFloat(1);
+    cfg.freq_hz[1] = args->getFloat(2);
+    cfg.time_ms    = args->getData(3);
+    cfg.level_db10 = cliGenLevel(args, 4);
+    ret = genStart(&cfg);
+  }
+
+  if (args->argc >= 1 && args->argc <= 3 && args->isStr(0, "noise"))
+  {
+    cfg.mode       = GEN_NOISE;
+    cfg.level_db10 = cliGenLevel(args, 1);
+    cfg.time_ms    = args->argc > 2 ? args->getData(2) : 0;
+    ret = genStart(&cfg);
+  }
+
+  if (args->argc == 2 && args->isStr(0, "ch"))
+  {
+    if (args->isStr(1, "l"))
+      gen_ch = GEN_CH_L;
+    else if (args->isStr(1, "r"))
+      gen_ch = GEN_CH_R;
+    else
+      gen_ch = GEN_CH_BOTH;
+    ret = true;
+  }
+
+  if (args->argc == 2 && args->isStr(0, "mix"))
+  {
+    gen_mix = args->isStr(1, "on");
+    ret = true;
+  }
+
+  if (args->argc == 3 && args->isStr(0, "beep"))
+  {
+    ret = genBeep(args->getData(1), 100, args->getData(2));
+  }
+
+  if (args->argc == 1 && args->isStr(0, "melody"))
+  {
+    uint16_t melody[] = {NOTE_C4, NOTE_G3, NOTE_G3, NOTE_A3, NOTE_G3, 0, NOTE_B3, NOTE_C4};
+    uint16_t note_durations[] = { 4, 8, 8, 4, 4, 4, 4, 4 };
+    uint16_t note_ms[8];
+
+    for (int i=0; i<8; i++)
+    {
+      note_ms[i] = 1000 / note_durations[i];
+    }
+    ret = genMelody(melody, note_ms, 8, 100);
+  }
+
+  if (args->argc == 1 && args->isStr(0, "stop"))
+  {
+    ret = genStop();
+  }
+
+  if (ret != true)
+  {
+    cliPrintf("gen info\n");
+    cliPrintf("gen sine   freq [dBFS] [ms]\n");
+    cliPrintf("gen square freq [dBFS] [ms]\n");
+    cliPrintf("gen multi  dBFS f1 f2 ..\n");
+    cliPrintf("gen sweep  f1 f2 ms [dBFS]\n");
+    cliPrintf("gen noise  [dBFS] [ms]\n");
+    cliPrintf("gen beep   freq ms\n");
+    cliPrintf("gen melody\n");
+    cliPrintf("gen ch l:r:lr\n");
+    cliPrintf("gen mix on:off\n");
+    cliPrintf("gen stop\n");
+  }
+}
+#endif
+
+#endif
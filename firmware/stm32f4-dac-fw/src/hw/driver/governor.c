@@ -0,0 +1,428 @@
+#include "governor.h"
+
+
+#ifdef _USE_HW_GOVERNOR
+#include "cli.h"
+#include "i2s.h"
+#include "meter.h"
+#include "crossfeed.h"
+#include "dither.h"
+#include "conv.h"
+
+
+typedef enum
+{
+  GOVERNOR_APPLY = 0,                 // 적용했을 때만 true, 원래 설정을 *p_value 에 저장
+  GOVERNOR_HELD,                      // 설정이 아직 governor 가 바꾼 값이면 true
+  GOVERNOR_RESTORE,                   // *p_value 로 되돌린다.
+} GovernorOp_t;
+
+typedef struct
+{
+  const char *name;
+  const char *act;
+  bool      (*func)(GovernorOp_t op, int32_t *p_value);
+} governor_step_t;
+
+typedef struct
+{
+  bool     applied;
+  int32_t  value;                     // 적용 전 설정
+  uint32_t load;                      // 적용 직전 부하
+  uint32_t cost;                      // 적용 후 줄어든 부하
+  uint32_t rate;                      // cost 를 측정한 샘플레이트
+} governor_state_t;
+
+
+#if CLI_USE(HW_GOVERNOR)
+static void cliGovernor(cli_args_t *args);
+#endif
+static bool governorRestore(uint8_t level);
+static bool governorMeter(GovernorOp_t op, int32_t *p_value);
+static bool governorCrossfeed(GovernorOp_t op, int32_t *p_value);
+#ifdef _USE_HW_DITHER
+static bool governorDither(GovernorOp_t op, int32_t *p_value);
+#endif
+#ifdef _USE_HW_CONV
+static bool governorConvCheap(GovernorOp_t op, int32_t *p_value);
+static bool governorConv(GovernorOp_t op, int32_t *p_value);
+#endif
+
+
+// 부하가 높으면 위에서부터 적용하고 낮아지면 역순으로 복귀한다.
+// limiter 와 업샘플러는 출력 보호/형식에 필요하므로 대상이 아니다.
+// 적용 중에 사용자가 바꾼 설정은 되돌리지 않고 그 단계만 버린다.
+//
+static const governor_step_t governor_step[] =
+{
+  {"meter",     "bypass", governorMeter},
+#ifdef _USE_HW_DITHER
+  {"dither",    "tpdf",   governorDither},
+#endif
+#ifdef _USE_HW_CONV
+  {"conv",      "1 part", governorConvCheap},
+#endif
+  {"crossfeed", "bypass", governorCrossfeed},
+#ifdef _USE_HW_CONV
+  {"conv",      "bypass", governorConv},
+#endif
+};
+
+#define GOVERNOR_STEP_MAX       (sizeof(governor_step) / sizeof(governor_step[0]))
+
+static bool     governor_enable = true;
+static uint8_t  governor_level = 0;
+static uint8_t  governor_level_max = 0;
+static uint32_t governor_load = 0;
+static uint32_t governor_load_max = 0;
+static uint32_t governor_pre_ms = 0;                  // 마지막 전환
+static uint32_t governor_low_ms = 0;                  // LOW 아래로 내려간 시점
+static bool     governor_measure = false;
+static bool     governor_is_full = false;
+static uint32_t governor_degrade_cnt = 0;
+static uint32_t governor_restore_cnt = 0;
+static uint32_t governor_drop_cnt = 0;                // 사용자가 바꿔서 되돌리지 않은 단계
+static governor_state_t governor_state[GOVERNOR_STEP_MAX];
+
+
+
+
+bool governorInit(void)
+{
+  i2sSetProcLoadAlarm(HW_GOVERNOR_LOAD_HIGH);
+
+#if CLI_USE(HW_GOVERNOR)
+  cliAdd("gov", cliGovernor);
+#endif
+  return true;
+}
+
+bool governorSetEnable(bool enable)
+{
+  governor_enable = enable;
+  i2sSetProcLoadAlarm(enable ? HW_GOVERNOR_LOAD_HIGH : 0);
+
+  if (enable != true)
+  {
+    governorRestoreAll();
+  }
+  return true;
+}
+
+bool governorRestoreAll(void)
+{
+  while(governor_level > 0)
+  {
+    governor_level--;
+    if (governor_state[governor_level].applied == true && governorRestore(governor_level) == true)
+    {
+      logPrintf("[  ] gov : %s restore\n", governor_step[governor_level].name);
+    }
+  }
+  governor_measure = false;
+  governor_is_full = false;
+  return true;
+}
+
+void governorGetStat(governor_stat_t *p_stat)
+{
+  p_stat->enable      = governor_enable;
+  p_stat->level       = governor_level;
+  p_stat->level_max   = governor_level_max;
+  p_stat->load        = governor_load;
+  p_stat->load_max    = governor_load_max;
+  p_stat->degrade_cnt = governor_degrade_cnt;
+  p_stat->restore_cnt = governor_restore_cnt;
+}
+
+// 스레드에서 호출한다. 처리 인터럽트가 HIGH 를 넘으면 EVENT_AUDIO_CTRL 로 바로 깨운다.
+//
+void governorUpdate(void)
+{
+  uint32_t load = i2sGetProcLoad(true);
+  uint32_t rate = i2sGetSampleRate();
+
+
+  governor_load = load;
+  if (load > governor_load_max)
+  {
+    governor_load_max = load;
+  }
+  if (load >= HW_GOVERNOR_LOAD_LOW)
+  {
+    governor_low_ms = millis();
+  }
+
+  if (governor_enable != true || millis() - governor_pre_ms < HW_GOVERNOR_SETTLE_MS)
+  {
+    return;
+  }
+
+  // 직전 단계로 줄어든 부하, 복귀할 때 다시 늘어날 양으로 본다.
+  //
+  if (governor_measure == true)
+  {
+    governor_state_t *p_state = &governor_state[governor_level - 1];
+
+    p_state->cost    = p_state->load > load ? p_state->load - load : 0;
+    governor_measure = false;
+  }
+
+  if (load >= HW_GOVERNOR_LOAD_HIGH)
+  {
+    while(governor_level < GOVERNOR_STEP_MAX)
+    {
+      const governor_step_t *p_step = &governor_step[governor_level];
+      governor_state_t *p_state = &governor_state[governor_level];
+
+      governor_level++;
+      p_state->applied = p_step->func(GOVERNOR_APPLY, &p_state->value);
+      if (p_state->applied == true)
+      {
+        p_state->load = load;
+        p_state->rate = rate;
+        p_state->cost = 0;
+        governor_measure = true;
+        governor_pre_ms  = millis();
+        governor_degrade_cnt++;
+        i2sGetProcLoad(true);
+        logPrintf("[  ] gov : %s %s, load %d.%d%%\n", p_step->name, p_step->act, load/10, load%10);
+        break;
+      }
+    }
+    if (governor_level > governor_level_max)
+    {
+      governor_level_max = governor_level;
+    }
+    if (governor_measure != true && governor_is_full != true)
+    {
+      governor_is_full = true;
+      logPrintf("[NG] gov : no more steps, load %d.%d%%\n", load/10, load%10);
+    }
+  }
+  else if (governor_level > 0 && millis() - governor_low_ms >= HW_GOVERNOR_RESTORE_MS &&
+           millis() - governor_pre_ms >= HW_GOVERNOR_RESTORE_MS)
+  {
+    const governor_step_t *p_step = &governor_step[governor_level - 1];
+    governor_state_t *p_state = &governor_state[governor_level - 1];
+    uint32_t cost;
+
+    governor_is_full = false;
+    if (p_state->applied != true)
+    {
+      governor_level--;
+      return;
+    }
+
+    // 사용자가 이미 바꿨으면 부하와 관계없이 단계만 버린다.
+    //
+    if (p_step->func(GOVERNOR_HELD, &p_state->value) != true)
+    {
+      governorRestore(governor_level - 1);
+      governor_level--;
+      return;
+    }
+
+    // 샘플당 처리량은 같으므로 부하는 샘플레이트에 비례한다.
+    //
+    cost = p_state->rate > 0 ? (uint32_t)(((uint64_t)p_state->cost * rate) / p_state->rate) : 0;
+    if (load + cost < HW_GOVERNOR_LOAD_LOW)
+    {
+      governorRestore(governor_level - 1);
+      governor_level--;
+      governor_pre_ms = millis();
+      logPrintf("[  ] gov : %s restore, load %d.%d%% + %d.%d%%\n", p_step->name, load/10, load%10, cost/10, cost%10);
+    }
+  }
+}
+
+// 설정이 governor 가 바꾼 값 그대로일 때만 되돌리고, 아니면 단계만 버린다.
+//
+bool governorRestore(uint8_t level)
+{
+  const governor_step_t *p_step = &governor_step[level];
+  governor_state_t *p_state = &governor_state[level];
+  bool ret = false;
+
+
+  if (p_step->func(GOVERNOR_HELD, &p_state->value) == true)
+  {
+    p_step->func(GOVERNOR_RESTORE, &p_state->value);
+    governor_restore_cnt++;
+    ret = true;
+  }
+  else
+  {
+    governor_drop_cnt++;
+    logPrintf("[  ] gov : %s changed by user, drop\n", p_step->name);
+  }
+  p_state->applied = false;
+
+  return ret;
+}
+
+bool governorMeter(GovernorOp_t op, int32_t *p_value)
+{
+  switch(op)
+  {
+    case GOVERNOR_APPLY:
+      if (meterIsEnable() != true)
+      {
+        return false;
+      }
+      return meterSetEnable(false);
+
+    case GOVERNOR_HELD:
+      return meterIsEnable() != true;
+
+    default:
+      return meterSetEnable(true);
+  }
+}
+
+bool governorCrossfeed(GovernorOp_t op, int32_t *p_value)
+{
+  switch(op)
+  {
+    case GOVERNOR_APPLY:
+      *p_value = crossfeedGetPreset();
+      if (*p_value == CROSSFEED_OFF)
+      {
+        return false;
+      }
+      return crossfeedSetPreset(CROSSFEED_OFF, false);
+
+    case GOVERNOR_HELD:
+      return crossfeedGetPreset() == CROSSFEED_OFF;
+
+    default:
+      return crossfeedSetPreset((CrossfeedPreset_t)*p_value, false);
+  }
+}
+
+#ifdef _USE_HW_DITHER
+// noise shaping 을 끄고 TPDF 만 남긴다.
+//
+bool governorDither(GovernorOp_t op, int32_t *p_value)
+{
+  switch(op)
+  {
+    case GOVERNOR_APPLY:
+      *p_value = ditherGetMode();
+      if (*p_value <= DITHER_MODE_TPDF)
+      {
+        return false;
+      }
+      return ditherSetMode(DITHER_MODE_TPDF);
+
+    case GOVERNOR_HELD:
+      return ditherGetMode() == DITHER_MODE_TPDF;
+
+    default:
+      return ditherSetMode((DitherMode_t)*p_value);
+  }
+}
+#endif
+
+#ifdef _USE_HW_CONV
+// IR 뒷부분을 생략하고 첫 파티션만 계산한다.
+//
+bool governorConvCheap(GovernorOp_t op, int32_t *p_value)
+{
+  switch(op)
+  {
+    case GOVERNOR_APPLY:
+      *p_value = convGetPartLimit();
+      if (convIsEnable() != true || convGetTaps() <= HW_CONV_PART_LEN || *p_value == 1)
+      {
+        return false;
+      }
+      return convSetPartLimit(1);
+
+    case GOVERNOR_HELD:
+      return convGetPartLimit() == 1;
+
+    default:
+      return convSetPartLimit(*p_value);
+  }
+}
+
+bool governorConv(GovernorOp_t op, int32_t *p_value)
+{
+  switch(op)
+  {
+    case GOVERNOR_APPLY:
+      if (convIsEnable() != true)
+      {
+        return false;
+      }
+      return convSetEnable(false);
+
+    case GOVERNOR_HELD:
+      return convIsEnable() != true;
+
+    default:
+      return convSetEnable(true);
+  }
+}
+#endif
+
+
+#if CLI_USE(HW_GOVERNOR)
+void cliGovernor(cli_args_t *args)
+{
+  bool ret = false;
+
+
+  if (args->argc == 1 && args->isStr(0, "info"))
+  {
+    cliPrintf("enable   : %s\n", governor_enable ? "on":"off");
+    cliPrintf("load     : %d.%d%% (max %d.%d%%)\n", governor_load/10, governor_load%10, governor_load_max/10, governor_load_max%10);
+    cliPrintf("thresh   : %d%% / %d%%\n", HW_GOVERNOR_LOAD_HIGH/10, HW_GOVERNOR_LOAD_LOW/10);
+    cliPrintf("level    : %d/%d (max %d)\n", governor_level, GOVERNOR_STEP_MAX, governor_level_max);
+    cliPrintf("count    : degrade %d, restore %d, drop %d\n", governor_degrade_cnt, governor_restore_cnt, governor_drop_cnt);
+    for (int i=0; i<GOVERNOR_STEP_MAX; i++)
+    {
+      governor_state_t *p_state = &governor_state[i];
+
+      cliPrintf("%d %-10s %-7s %-3s cost %d.%d%%, %d cycles\n",
+        i,
+        governor_step[i].name,
+        governor_step[i].act,
+        p_state->applied ? "on":"off",
+        p_state->cost/10, p_state->cost%10,
+        i2sStageGetCycles(governor_step[i].name));
+    }
+    ret = true;
+  }
+
+  if (args->argc == 2 && args->isStr(0, "enable"))
+  {
+    governorSetEnable(args->isStr(1, "on"));
+    ret = true;
+  }
+
+  if (args->argc == 1 && args->isStr(0, "restore"))
+  {
+    governorRestoreAll();
+    ret = true;
+  }
+
+  if (args->argc == 1 && args->isStr(0, "clear"))
+  {
+    governor_load_max  = 0;
+    governor_level_max = governor_level;
+    ret = true;
+  }
+
+  if (ret == false)
+  {
+    cliPrintf("gov info\n");
+    cliPrintf("gov enable on:off\n");
+    cliPrintf("gov restore\n");
+    cliPrintf("gov clear\n");
+  }
+}
+#endif
+
+#endif
@@ -24,7 +24,6 @@
 #endif
 
 static uint32_t i2cGetTimming(uint32_t freq_khz);
-static void delayUs(uint32_t us);
 #if CLI_USE(HW_I2C)
 static void cliI2C(cli_args_t *args);
 #endif
@@ -39,6 +38,7 @@ static bool is_init = false;
 static bool is_begin[I2C_MAX_CH];
 #ifdef _USE_HW_RTOS
 static SemaphoreHandle_t mutex_lock;
+static StaticSemaphore_t mutex_buf;
 #endif
 
 I2C_HandleTypeDef hi2c1;
@@ -70,7 +70,7 @@ bool i2cInit(void)
   uint32_t i;
 
 #ifdef _USE_HW_RTOS
-  mutex_lock = xSemaphoreCreateMutex();
+  mutex_lock = xSemaphoreCreateMutexStatic(&mutex_buf);
 #endif
 
   for (i=0; i<I2C_MAX_CH; i++)
@@ -417,16 +417,6 @@ uint32_t i2cGetErrCount(uint8_t ch)
   return i2c_errcount[ch];
 }
 
-void delayUs(uint32_t us)
-{
-  volatile uint32_t i;
-
-  for (i=0; i<us*1000; i++)
-  {
-
-  }
-}
-
 
 
 
@@ -5,8 +5,11 @@
 #include "cli.h"
 #include "gpio.h"
 #include "qbuffer.h"
-#include "buzzer.h"
 #include "es8156.h"
+#include "event.h"
+#include "resample.h"
+#include "mixer.h"
+#include "loudness.h"
 
 
 typedef enum
@@ -22,23 +25,49 @@ typedef struct
   int16_t volume;
 } i2s_cfg_t;
 
+typedef struct
+{
+  const char    *name;
+  I2sStageFunc_t func;
+  void          *arg;
+  bool           enable;
+  bool           is_tap;            // 샘플을 읽기만 하는 단계 (미터), 양자화가 필요 없다.
+  uint32_t       cycles;
+  uint32_t       cycles_max;
+} i2s_stage_t;
+
 #define I2S_SAMPLERATE_MAX      I2S_AUDIOFREQ_96K
 #define I2S_SAMPLERATE_HZ       I2S_AUDIOFREQ_48K
 #define I2S_BUF_CH              (2)
 #define I2S_BUF_MS              (4)
 #define I2S_BUF_FRAME_LEN       ((I2S_SAMPLERATE_MAX * I2S_BUF_CH * I2S_BUF_MS) / 1000)  // 96Khz, Stereo, 4ms
 #define I2S_BUF_CNT             16
+#define I2S_DMA_BUF_CNT         3                     // M0, M1 + 다음 블록
+#define I2S_RING_NONE           0xFFFFFFFF
 
 
 
 #ifdef _USE_HW_CLI
 static void cliI2s(cli_args_t *args);
 #endif
+static void i2sProcStart(uint8_t index);
+static void i2sProcess(void);
+static void i2sSetPowerState(I2sPower_t power);
+static void i2sPowerDown(I2sPower_t power);
+static void i2sDmaM0Callback(DMA_HandleTypeDef *hdma);
+static void i2sDmaM1Callback(DMA_HandleTypeDef *hdma);
+static void i2sDmaErrorCallback(DMA_HandleTypeDef *hdma);
+static uint32_t i2sRingHold(void);
+static void i2sWake(void);
+static uint32_t i2sGetOutRate(uint32_t freq);
+static void i2sResample(int32_t *p_buf, uint32_t frames);
+static bool i2sStageInsert(const char *name, I2sStageFunc_t func, void *arg, bool is_tap);
 
 static bool is_init = false;
 static bool is_started = false;
 static bool is_busy = false;
-static uint32_t i2s_sample_rate = I2S_SAMPLERATE_HZ;
+static uint32_t i2s_sample_rate = I2S_SAMPLERATE_HZ;   // USB 스트림
+static uint32_t i2s_out_rate = I2S_SAMPLERATE_HZ;      // I2S 출력, 처리 단계
 static uint16_t i2s_sample_bytes = 4;
 static uint16_t i2s_num_of_ch = 2;
 static uint16_t i2s_num_of_bytes = 3;
@@ -46,12 +75,87 @@ static uint16_t i2s_num_of_bytes = 3;
 static I2sBitDepth_t i2s_sample_depth = I2S_BIT_DEPTH_24BIT;
 
 
-static int32_t  i2s_frame_buf[I2S_BUF_FRAME_LEN * 2];
 static uint32_t i2s_frame_len = 0;
 static int16_t  i2s_volume = 0;
 static i2s_cfg_t i2s_cfg;
 static bool     i2s_mute = true;
 static uint32_t i2s_zero_cnt = 0;
+static uint32_t i2s_zero_total = 0;
+static uint32_t i2s_isr_cycles = 0;
+static uint32_t i2s_isr_cycles_max = 0;
+static uint32_t i2s_isr_pre_cycles = 0;
+static uint32_t i2s_isr_period = 0;                 // DMA 콜백 주기 (cycles), CLI 에서 us 로 변환
+static uint32_t i2s_isr_period_min = 0;
+static uint32_t i2s_isr_period_max = 0;
+
+// DMA는 double buffer 모드(M0AR/M1AR)로 동작한다.
+// 처리가 필요 없으면 링 버퍼의 블록 주소를 그대로 DMA에 넘기고(복사 없음),
+// 처리가 필요하거나 블록이 링 끝에서 나뉘면 바운스 버퍼로 복사한다.
+//
+static int32_t  i2s_dma_buf[I2S_DMA_BUF_CNT][I2S_BUF_FRAME_LEN];
+static int32_t *volatile i2s_dma_addr[2];           // M0AR, M1AR 에 설정된 버퍼
+static volatile uint32_t i2s_dma_ring_pos[2];       // 링 버퍼를 넘긴 경우 시작 위치
+static uint32_t i2s_copy_bytes = 0;                 // 실제 복사한 바이트
+static uint32_t i2s_copy_saved = 0;                 // 기존 방식(링->작업->DMA 2회 복사) 대비 절약
+static uint32_t i2s_copy_pre_ms = 0;
+static uint32_t i2s_copy_bytes_sec = 0;
+static uint32_t i2s_copy_saved_sec = 0;
+static uint32_t i2s_zero_copy_cnt = 0;
+
+// DMA 인터럽트는 버퍼만 교체하고, 다음 블록 처리는 낮은 우선순위의 인터럽트에서 한다.
+//
+static volatile uint8_t  i2s_proc_index = 0;
+static volatile uint32_t i2s_proc_seq = 0;          // DMA 인터럽트마다 증가
+static volatile uint32_t i2s_proc_done_seq = 0;     // 처리가 끝난 seq
+static volatile uint32_t i2s_proc_deadline = 0;     // 처리 중인 블록을 DMA가 읽기 시작하는 시점 (cycles)
+static uint32_t i2s_proc_period = 0;                // 블록 재생 시간 (cycles)
+static uint32_t i2s_proc_cycles = 0;
+static uint32_t i2s_proc_cycles_max = 0;
+static uint32_t i2s_proc_slack_us = 0;
+static uint32_t i2s_proc_slack_min = 0;
+static uint32_t i2s_proc_miss = 0;
+static volatile uint32_t i2s_proc_load_peak = 0;    // 블록 시간 대비 처리 시간, 1/1000
+static uint32_t i2s_proc_load_alarm = 0;            // 넘으면 EVENT_AUDIO_CTRL (0 : 사용 안함)
+static i2s_stage_t i2s_stage[HW_I2S_STAGE_MAX];
+static uint8_t     i2s_stage_cnt = 0;
+static i2s_stage_t i2s_quant;                       // 처리 후 출력 비트로 줄이는 단계 (dither)
+#ifdef _USE_HW_MIXER
+static mixer_t  i2s_mixer;                          // 채널 0(USB 스트림) 외의 채널, 1 ~ MIXER_MAX_CH
+static int8_t   i2s_mix_src = -1;                   // 믹서 소스 채널 (신호 발생기)
+static uint8_t  i2s_mix_cnt = 0;
+static uint32_t i2s_mix_cycles = 0;
+static uint32_t i2s_mix_cycles_max = 0;
+#endif
+
+// 고정 출력 모드 : I2S 는 96kHz 그대로 두고 스트림을 업샘플링한다.
+// 샘플레이트 변경시 PLL 재설정과 DMA 재시작이 없다.
+//
+static bool     i2s_fixed = HW_I2S_FIXED_OUT;
+static volatile uint32_t i2s_rs_req = 0;            // 업샘플링할 입력 샘플레이트 (0 : 사용 안함)
+static uint32_t i2s_rs_rate = 0;                    // 처리 인터럽트에서 적용된 값
+static uint32_t i2s_rs_cycles = 0;
+static uint32_t i2s_rs_cycles_max = 0;
+
+// 스트림이 없을 때의 전원 관리
+//
+#define I2S_RAMP_ONE            (1UL << 16)
+
+static volatile I2sPower_t i2s_power = I2S_POWER_ACTIVE;
+static volatile bool     i2s_stream_on = false;       // USB alt setting != 0
+static volatile uint32_t i2s_idle_periods = 0;        // 연속된 무음 채움 횟수
+static volatile bool     i2s_wake_req = false;
+static volatile uint32_t i2s_wake_start = 0;
+static volatile uint32_t i2s_ramp_gain = I2S_RAMP_ONE;
+static uint32_t i2s_ramp_step = 0;
+static uint32_t i2s_wake_cnt = 0;
+static uint32_t i2s_wake_us = 0;
+static uint32_t i2s_wake_us_max = 0;
+static uint32_t i2s_power_enter_ms = 0;
+static uint32_t i2s_power_time_ms[I2S_POWER_MAX];
+static const char *i2s_power_str[I2S_POWER_MAX] = {"active", "idle", "suspend"};
+static volatile bool     i2s_first_req = false;       // resume 후 첫 샘플 대기
+static volatile uint32_t i2s_first_start = 0;
+static uint32_t i2s_first_us = 0;
 
 
 static qbuffer_t i2s_q;
@@ -76,7 +180,10 @@ bool i2sInit(void)
   hi2s2.Init.Standard           = I2S_STANDARD_PHILIPS;
   hi2s2.Init.DataFormat         = I2S_DATAFORMAT_24B;
   hi2s2.Init.MCLKOutput         = I2S_MCLKOUTPUT_ENABLE;
-  hi2s2.Init.AudioFreq          = I2S_SAMPLERATE_HZ;
+  i2s_out_rate = i2sGetOutRate(i2s_sample_rate);
+  i2s_rs_req   = i2s_out_rate != i2s_sample_rate ? i2s_sample_rate : 0;
+
+  hi2s2.Init.AudioFreq          = i2s_out_rate;
   hi2s2.Init.CPOL               = I2S_CPOL_LOW;
   hi2s2.Init.ClockSource        = I2S_CLOCK_PLL;
   hi2s2.Init.FullDuplexMode     = I2S_FULLDUPLEXMODE_DISABLE;
@@ -85,13 +192,19 @@ bool i2sInit(void)
     ret = false;
   }
 
-  es8156SetConfig(i2s_sample_rate, i2s_sample_depth);
+  es8156SetConfig(i2s_out_rate, i2s_sample_depth);
 
   qbufferCreateBySize(&i2s_q, (uint8_t *)i2s_q_buf, sizeof(int32_t), I2S_BUF_FRAME_LEN * I2S_BUF_CNT);
+#ifdef _USE_HW_MIXER
+  mixerInit(&i2s_mixer);
+#endif
 
-  i2s_frame_len = (i2s_sample_rate * 2 * I2S_BUF_MS) / 1000;
+  i2s_frame_len = (i2s_out_rate * 2 * I2S_BUF_MS) / 1000;
   i2s_sample_bytes = hi2s2.Init.DataFormat == I2S_DATAFORMAT_16B ? 2:4;
 
+  HAL_NVIC_SetPriority(HW_I2S_PROC_IRQn, HW_I2S_PROC_PRIORITY, 0);
+  HAL_NVIC_EnableIRQ(HW_I2S_PROC_IRQn);
+
   i2sCfgLoad();
 
   i2sMute(true);
@@ -133,6 +246,7 @@ bool i2sSetSampleRate(uint32_t freq)
 {
   bool ret = true;
   uint32_t frame_len;
+  uint32_t out_rate;
   const uint32_t freq_tbl[8] = 
   {
     I2S_AUDIOFREQ_96K,
@@ -159,38 +273,125 @@ bool i2sSetSampleRate(uint32_t freq)
     return false;
   }
 
+  // 출력 샘플레이트가 그대로면 I2S 는 건드리지 않고 업샘플러 비율만 바꾼다.
+  //
+  out_rate = i2sGetOutRate(freq);
+  i2s_sample_rate = freq;
+  i2s_rs_req = out_rate != freq ? freq : 0;
+  if (out_rate == i2s_out_rate && is_started == true)
+  {
+    return true;
+  }
+
   i2sStop();
   
 
-  i2s_sample_rate = freq;
-  frame_len = (i2s_sample_rate * 2 * I2S_BUF_MS) / 1000;
+  i2s_out_rate = out_rate;
+  frame_len = (i2s_out_rate * 2 * I2S_BUF_MS) / 1000;
   i2s_frame_len = frame_len;
 
-  hi2s2.Init.AudioFreq = freq;
+  hi2s2.Init.AudioFreq = out_rate;
   if (HAL_I2S_Init(&hi2s2) != HAL_OK)
   {
     ret = false;
   }
-  i2sStart();
+  if (i2s_power == I2S_POWER_ACTIVE)
+  {
+    i2sStart();
+  }
 
   return ret;
 }
 
+uint32_t i2sGetOutRate(uint32_t freq)
+{
+  if (i2s_fixed == true && resampleIsValid(freq, HW_RESAMPLE_OUT_RATE) == true)
+  {
+    return HW_RESAMPLE_OUT_RATE;
+  }
+  return freq;
+}
+
+bool i2sSetFixedRate(bool enable)
+{
+  i2s_fixed = enable;
+  return i2sSetSampleRate(i2s_sample_rate);
+}
+
+bool i2sIsFixedRate(void)
+{
+  return i2s_fixed;
+}
+
+// 처리 단계와 I2S 출력의 샘플레이트
+//
 uint32_t i2sGetSampleRate(void)
+{
+  return i2s_out_rate;
+}
+
+uint32_t i2sGetStreamRate(void)
 {
   return i2s_sample_rate;
 }
 
+// 설정된 분주비로 실제 출력되는 샘플레이트를 mHz 단위로 계산한다.
+// 업샘플링 중이면 링 버퍼를 소비하는 입력 샘플레이트로 환산한다.
+// 
+uint32_t i2sGetSampleRateMilliHz(void)
+{
+  uint32_t i2s_clk;
+  uint32_t i2s_pr;
+  uint32_t div;
+  uint32_t frame_bits;
+
+
+  i2s_pr = hi2s2.Instance->I2SPR;
+  div    = 2 * (i2s_pr & SPI_I2SPR_I2SDIV) + ((i2s_pr & SPI_I2SPR_ODD) ? 1:0);
+  if (div == 0)
+  {
+    return 0;
+  }
+
+  // MCLK 출력시 256*Fs, 아니면 채널당 32bit * 2ch
+  //
+  frame_bits = (i2s_pr & SPI_I2SPR_MCKOE) ? 256 : 64;
+  i2s_clk    = HAL_RCCEx_GetPeriphCLKFreq(RCC_PERIPHCLK_I2S);
+
+  return (uint32_t)(((uint64_t)i2s_clk * 1000 * i2s_sample_rate) / ((uint64_t)frame_bits * div * i2s_out_rate));
+}
+
 bool i2sStart(void)
 {
   bool ret = false;
   HAL_StatusTypeDef status;
   I2S_HandleTypeDef *p_i2s = &hi2s2;
 
-  memset(i2s_frame_buf, 0, sizeof(i2s_frame_buf));
-  status = HAL_I2S_Transmit_DMA(p_i2s, (uint16_t *)i2s_frame_buf, i2s_frame_len * 2);
+  memset(i2s_dma_buf, 0, sizeof(i2s_dma_buf));
+  i2s_dma_addr[0]     = i2s_dma_buf[0];
+  i2s_dma_addr[1]     = i2s_dma_buf[1];
+  i2s_dma_ring_pos[0] = I2S_RING_NONE;
+  i2s_dma_ring_pos[1] = I2S_RING_NONE;
+  i2s_proc_period   = (uint32_t)(((uint64_t)SystemCoreClock * (i2s_frame_len / I2S_BUF_CH)) / i2s_out_rate);
+  i2s_proc_done_seq = i2s_proc_seq;
+  i2s_ramp_step     = I2S_RAMP_ONE * 1000 / (i2s_out_rate * HW_I2S_RAMP_MS);
+  i2s_idle_periods  = 0;
+
+  // DMA는 16비트 단위로 전송한다.
+  //
+  hdma_spi2_tx.XferCpltCallback   = i2sDmaM0Callback;
+  hdma_spi2_tx.XferM1CpltCallback = i2sDmaM1Callback;
+  hdma_spi2_tx.XferErrorCallback  = i2sDmaErrorCallback;
+  status = HAL_DMAEx_MultiBufferStart_IT(&hdma_spi2_tx,
+                                         (uint32_t)i2s_dma_addr[0],
+                                         (uint32_t)&p_i2s->Instance->DR,
+                                         (uint32_t)i2s_dma_addr[1],
+                                         i2s_frame_len * 2);
   if (status == HAL_OK)
   {
+    p_i2s->State = HAL_I2S_STATE_BUSY_TX;
+    __HAL_I2S_ENABLE(p_i2s);
+    SET_BIT(p_i2s->Instance->CR2, SPI_CR2_TXDMAEN);
     is_started = true;
   }
   else
@@ -209,9 +410,17 @@ bool i2sStop(void)
   return true;
 }
 
+// 채널 0 은 USB 스트림, 나머지는 믹서 채널이다. 비어있는 믹서 채널이 없으면 -1
+//
 int8_t i2sGetEmptyChannel(void)
 {
+#ifdef _USE_HW_MIXER
+  int8_t ch = mixerGetEmptyChannel(&i2s_mixer);
+
+  return ch >= 0 ? ch + 1 : -1;
+#else
   return 0;
+#endif
 }
 
 uint32_t i2sGetFrameSize(void)
@@ -221,25 +430,117 @@ uint32_t i2sGetFrameSize(void)
 
 uint32_t i2sAvailableForWrite(uint8_t ch)
 {
-  return qbufferAvailableForWrite(&i2s_q);
+  uint32_t wr_len;
+  uint32_t hold;
+
+#ifdef _USE_HW_MIXER
+  if (ch > 0)
+  {
+    return mixerAvailableForWrite(&i2s_mixer, ch - 1);
+  }
+#endif
+
+  // DMA가 아직 읽고 있는 링 버퍼 영역은 쓸 수 없다.
+  //
+  wr_len = qbufferAvailableForWrite(&i2s_q);
+  hold   = i2sRingHold();
+
+  return wr_len > hold ? wr_len - hold : 0;
+}
+
+// DMA에 넘겨진 링 버퍼 블록 중 가장 오래된 블록부터 out 까지의 길이
+//
+uint32_t i2sRingHold(void)
+{
+  uint32_t hold = 0;
+
+  for (int i=0; i<2; i++)
+  {
+    uint32_t pos = i2s_dma_ring_pos[i];
+
+    if (pos != I2S_RING_NONE)
+    {
+      uint32_t len = (i2s_q.len + i2s_q.out - pos) % i2s_q.len;
+
+      if (len > hold)
+      {
+        hold = len;
+      }
+    }
+  }
+  return hold;
 }
 
 uint32_t i2sAvailableForRead(uint8_t ch)
 {
+#ifdef _USE_HW_MIXER
+  if (ch > 0)
+  {
+    return MIXER_MAX_BUF_LEN - 2 - mixerAvailableForWrite(&i2s_mixer, ch - 1);
+  }
+#endif
   return qbufferAvailable(&i2s_q);
 }
 
-bool i2sWrite(uint8_t ch, void *p_data, uint32_t samples)
+// 믹서 채널은 16비트 스테레오 샘플을 출력 샘플레이트로 쓴다.
+//
+// 모든 채널이 16비트 스테레오 샘플(L, R 순서)을 받는다.
+// 채널 0 은 i2sWriteBytes() 와 같은 DMA 형식(Q31 의 상/하위 16비트 교환)으로 바꿔서 넣는다.
+//
+bool i2sWrite(uint8_t ch, const int16_t *p_data, uint32_t samples)
 {
-  return qbufferWrite(&i2s_q, p_data, samples);
+  int32_t  wr_buf[32];
+  uint32_t wr_len;
+
+
+  if (samples & 1)
+  {
+    return false;
+  }
+
+#ifdef _USE_HW_MIXER
+  if (ch > 0)
+  {
+    if (mixerWrite(&i2s_mixer, ch - 1, p_data, samples) != true)
+    {
+      return false;
+    }
+    i2sWake();
+    return true;
+  }
+#endif
+
+  if (samples > i2sAvailableForWrite(ch))
+  {
+    return false;
+  }
+  while (samples > 0)
+  {
+    wr_len = samples < 32 ? samples : 32;
+    for (uint32_t i=0; i<wr_len; i++)
+    {
+      wr_buf[i] = (int32_t)(uint16_t)p_data[i];
+    }
+    qbufferWrite(&i2s_q, (uint8_t *)wr_buf, wr_len);
+    p_data  += wr_len;
+    samples -= wr_len;
+  }
+  return true;
 }
 
 bool i2sWriteBytes(uint8_t ch, uint8_t *p_data, uint32_t length)
 {
   data_t wr_data;
   uint8_t *p_buf;
+  uint32_t wr_len;
 
 
+  wr_len = i2sAvailableForWrite(ch) * i2s_num_of_bytes;
+  if (length > wr_len)
+  {
+    length = wr_len;
+  }
+
   wr_data.u32D = 0;
   for (int i=0; i<length; i+=i2s_num_of_bytes)
   {
@@ -258,145 +559,670 @@ bool i2sWriteBytes(uint8_t ch, uint8_t *p_data, uint32_t length)
   return true;
 }
 
-// https://m.blog.naver.com/PostView.nhn?blogId=hojoon108&logNo=80145019745&proxyReferer=https:%2F%2Fwww.google.com%2F
-//
-float i2sGetNoteHz(int8_t octave, int8_t note)
+int16_t i2sGetVolume(void)
+{
+  return i2s_volume;
+}
+
+bool i2sSetVolume(int16_t volume)
+{
+  volume = constrain(volume, 0, 100);
+  i2s_volume = volume;
+
+  // loudness 는 코덱에 실제로 더해진 보정을 다시 읽으므로 코덱 볼륨을 먼저 바꾼다.
+  //
+  es8156SetVolume(i2s_volume);
+  #ifdef _USE_HW_LOUDNESS
+  loudnessSetVolume(i2s_volume);
+  #endif
+
+  return true;
+}
+
+bool i2sSetBitDepth(I2sBitDepth_t bit_depth)
+{
+  return true;
+}
+
+bool i2sGetBitDepth(I2sBitDepth_t *bit_depth)
 {
-  float hz;
-  float f_note;
+  return true;
+}
 
-  if (octave < 1) octave = 1;
-  if (octave > 8) octave = 8;
+bool i2sMute(bool enable)
+{
+  bool ret = true;
 
-  if (note <  1) note = 1;
-  if (note > 12) note = 12;
+  i2s_mute = enable;
 
-  f_note = (float)(note-10)/12.0f;
+  // 저전력 상태에서는 복귀할 때 적용한다.
+  //
+  if (i2s_power == I2S_POWER_ACTIVE)
+  {
+    ret = es8156SetMute(enable);
+    es8156SetEnable(!enable);
+  }
 
-  hz = pow(2, (octave-1)) * 55 * pow(2, f_note);
+  return ret;
+}
 
-  return hz;
+bool i2sIsMute(void)
+{
+  return i2s_mute;
 }
 
-// https://gamedev.stackexchange.com/questions/4779/is-there-a-faster-sine-function
-//
-float i2sSin(float x)
+__RAMFUNC void i2sUpdateBuffer(uint8_t index)
 {
-  const float B = 4 / M_PI;
-  const float C = -4 / (M_PI * M_PI);
+  uint32_t cycles_start = cycles();
+
+
+  // DMA 콜백 주기 (jitter 측정)
+  // ISR 에서는 사이클 차이만 저장하고 us 변환은 CLI 에서 한다.
+  //
+  if (i2s_isr_pre_cycles != 0)
+  {
+    i2s_isr_period = cycles_start - i2s_isr_pre_cycles;
+    if (i2s_isr_period_min == 0 || i2s_isr_period < i2s_isr_period_min)
+    {
+      i2s_isr_period_min = i2s_isr_period;
+    }
+    if (i2s_isr_period > i2s_isr_period_max)
+    {
+      i2s_isr_period_max = i2s_isr_period;
+    }
+  }
+  i2s_isr_pre_cycles = cycles_start;
+
+  i2sProcStart(index);
 
-  return -(B * x + C * x * ((x < 0) ? -x : x));
+  i2s_isr_cycles = cycles() - cycles_start;
+  if (i2s_isr_cycles > i2s_isr_cycles_max)
+  {
+    i2s_isr_cycles_max = i2s_isr_cycles;
+  }
 }
 
-bool i2sPlayBeep(uint32_t freq_hz, uint16_t volume, uint32_t time_ms)
+__RAMFUNC void i2sProcStart(uint8_t index)
 {
-  uint32_t pre_time;
-  int32_t sample_rate = i2s_sample_rate;
-  int32_t num_samples = i2s_frame_len;
-  float sample_point;
-  int32_t sample[num_samples];
-  int16_t sample_index = 0;
-  float div_freq;
-  int8_t mix_ch;
-  int32_t volume_out;
-  uint32_t sample_num;
-  uint32_t sample_num_max;
+  // 이전 처리가 끝나지 않았으면 DMA가 지금 재생을 시작한 버퍼에는
+  // 이전 데이터가 남아있다. 늦은 결과는 버리고 무음으로 대체한다.
+  //
+  if (i2s_proc_done_seq != i2s_proc_seq)
+  {
+    memset(i2s_dma_addr[index ^ 1], 0, i2s_frame_len * i2s_sample_bytes);
+    i2s_proc_done_seq = i2s_proc_seq;
+    i2s_proc_miss++;
+  }
 
+  i2s_proc_index    = index;
+  i2s_proc_deadline = cycles() + i2s_proc_period;
+  i2s_proc_seq++;
 
-  if (time_ms == 0)
-    return true;
+  NVIC_SetPendingIRQ(HW_I2S_PROC_IRQn);
+}
 
-  if (freq_hz == 0)
+__RAMFUNC void i2sProcess(void)
+{
+  uint32_t cycles_start = cycles();
+  uint32_t seq   = i2s_proc_seq;
+  uint8_t  index = i2s_proc_index;
+  uint32_t deadline = i2s_proc_deadline;
+  uint32_t frames = i2s_frame_len / I2S_BUF_CH;
+  uint32_t block_bytes = i2s_frame_len * i2s_sample_bytes;
+  uint32_t primask;
+  uint32_t ring_pos = I2S_RING_NONE;
+  int32_t *p_buf = NULL;
+  int32_t  slack;
+  bool     is_proc;
+  bool     is_resample;
+  bool     is_mix = false;
+  bool     is_requant;
+  uint8_t  stage_on = 0;
+  uint8_t  stage_mod = 0;
+
+
+  if (seq == i2s_proc_done_seq)
   {
-    delay(time_ms);
-    return true;
+    return;
   }
 
-  volume = constrain(volume, 0, 100);
-  volume_out = (INT16_MAX/40) * volume / 100;
+  // M0, M1에 걸려있지 않은 바운스 버퍼
+  //
+  for (int i=0; i<I2S_DMA_BUF_CNT; i++)
+  {
+    if (i2s_dma_buf[i] != i2s_dma_addr[0] && i2s_dma_buf[i] != i2s_dma_addr[1])
+    {
+      p_buf = i2s_dma_buf[i];
+      break;
+    }
+  }
 
-  mix_ch =  i2sGetEmptyChannel();
+  if (i2s_rs_req != i2s_rs_rate)
+  {
+    i2s_rs_rate = i2s_rs_req;
+    if (i2s_rs_rate != 0)
+    {
+      resampleSetRate(i2s_rs_rate, i2s_out_rate);
+    }
+  }
+  is_resample = (i2s_rs_rate != 0);
+#ifdef _USE_HW_MIXER
+  is_mix      = mixerIsActive(&i2s_mixer);
+#endif
+  for (int i=0; i<i2s_stage_cnt; i++)
+  {
+    stage_on  += i2s_stage[i].enable ? 1:0;
+    stage_mod += (i2s_stage[i].enable && i2s_stage[i].is_tap != true) ? 1:0;
+  }
+  is_proc     = (is_resample == true || is_mix == true || stage_on > 0 || i2s_ramp_gain < I2S_RAMP_ONE);
 
-  div_freq = (float)sample_rate/(float)freq_hz;
-  sample_num_max = (sample_rate/1000) * time_ms * i2s_num_of_ch;
+  // 샘플 값을 새로 계산한 블록만 양자화(dither) 한다.
+  // 미터만 돌았거나 램프만 걸린 블록은 원래 24비트 샘플에 잡음을 더하지 않는다.
+  //
+  is_requant  = (is_resample == true || is_mix == true || stage_mod > 0);
 
-  sample_num = 0;
-  pre_time = millis();
-  while(millis()-pre_time <= time_ms)
+  if (is_resample == true && qbufferAvailable(&i2s_q) >= resampleGetInFrames(frames) * I2S_BUF_CH)
   {
-    if (i2sAvailableForWrite(mix_ch) >= num_samples)
+    i2sResample(p_buf, frames);
+    is_busy = true;
+  }
+  else if (is_resample == false && qbufferAvailable(&i2s_q) >= i2s_frame_len)
+  {
+    if (is_proc == false && i2s_q.len - i2s_q.out >= i2s_frame_len)
     {
-      if (sample_num < sample_num_max)
+      // 링 버퍼 블록을 그대로 DMA에 넘긴다. out은 커밋할 때 옮긴다.
+      //
+      ring_pos = i2s_q.out;
+      p_buf    = (int32_t *)qbufferPeekRead(&i2s_q);
+    }
+    else
+    {
+      qbufferRead(&i2s_q, (uint8_t *)p_buf, i2s_frame_len);
+      i2s_copy_bytes += block_bytes;
+    }
+    is_busy = true;
+  }
+  else
+  {
+    memset(p_buf, 0, block_bytes);
+    is_busy = is_mix;
+    if (is_busy != true)
+    {
+      i2s_zero_cnt++;
+      i2s_zero_total++;
+    }
+  }
+  i2s_idle_periods = is_busy ? 0 : i2s_idle_periods + 1;
+  if (is_busy == true && i2s_first_req == true)
+  {
+    i2s_first_us  = (cycles() - i2s_first_start) / (SystemCoreClock / 1000000);
+    i2s_first_req = false;
+  }
+
+  if (is_proc == true)
+  {
+    // DMA는 16비트씩 전송하므로 버퍼는 상/하위 16비트가 바뀌어 있다.
+    // 업샘플러 출력은 이미 Q31 이다.
+    //
+    for (uint32_t i=0; i<i2s_frame_len && is_resample == false; i++)
+    {
+      p_buf[i] = (int32_t)__ROR((uint32_t)p_buf[i], 16);
+    }
+
+    // 스트림은 계속 소비한다. 솔로 소스(신호 발생기)가 켜져 있으면 믹서가 스트림을 버린다.
+    //
+#ifdef _USE_HW_MIXER
+    if (is_mix == true)
+    {
+      uint32_t stage_start = cycles();
+
+      i2s_mix_cnt    = mixerMix(&i2s_mixer, p_buf, frames);
+      i2s_mix_cycles = cycles() - stage_start;
+      if (i2s_mix_cycles > i2s_mix_cycles_max)
+      {
+        i2s_mix_cycles_max = i2s_mix_cycles;
+      }
+    }
+#endif
+
+    for (int i=0; i<i2s_stage_cnt; i++)
+    {
+      i2s_stage_t *p_stage = &i2s_stage[i];
+      uint32_t stage_start;
+
+      if (p_stage->enable != true)
       {
-        for (int i=0; i<num_samples; i+=2)
-        {
-          sample_point = i2sSin(2.0f * M_PI * (float)(sample_index) / ((float)div_freq));
-          sample[i + 0] = (int32_t)(sample_point * volume_out);
-          sample[i + 1] = (int32_t)(sample_point * volume_out);
-          sample_index = (sample_index + 1) % (int)(div_freq);
-        }
-        i2sWrite(mix_ch, sample, num_samples);
-        sample_num += num_samples;
+        continue;
       }
-    }  
+      stage_start = cycles();
+      p_stage->func(p_buf, frames, p_stage->arg);
+      p_stage->cycles = cycles() - stage_start;
+      if (p_stage->cycles > p_stage->cycles_max)
+      {
+        p_stage->cycles_max = p_stage->cycles;
+      }
+    }
+
+    // 저전력에서 복귀한 직후에는 출력을 서서히 올린다.
+    //
+    if (i2s_ramp_gain < I2S_RAMP_ONE)
+    {
+      uint32_t gain = i2s_ramp_gain;
+
+      for (uint32_t i=0; i<i2s_frame_len; i+=I2S_BUF_CH)
+      {
+        p_buf[i + 0] = (int32_t)(((int64_t)p_buf[i + 0] * gain) >> 16);
+        p_buf[i + 1] = (int32_t)(((int64_t)p_buf[i + 1] * gain) >> 16);
+        gain = gain + i2s_ramp_step < I2S_RAMP_ONE ? gain + i2s_ramp_step : I2S_RAMP_ONE;
+      }
+      i2s_ramp_gain = gain;
+    }
+
+    // 처리 결과는 32비트이므로 24비트로 줄일 때 양자화 단계를 거친다.
+    //
+    if (is_requant == true && i2s_quant.func != NULL && i2s_quant.enable == true)
+    {
+      uint32_t stage_start = cycles();
+
+      i2s_quant.func(p_buf, frames, i2s_quant.arg);
+      i2s_quant.cycles = cycles() - stage_start;
+      if (i2s_quant.cycles > i2s_quant.cycles_max)
+      {
+        i2s_quant.cycles_max = i2s_quant.cycles;
+      }
+    }
+
+    for (uint32_t i=0; i<i2s_frame_len; i++)
+    {
+      p_buf[i] = (int32_t)__ROR((uint32_t)p_buf[i], 16);
+    }
+  }
+
+  // DMA 인터럽트가 이미 다음 블록으로 넘어갔으면 결과를 쓰지 않는다.
+  // 사용 중인 메모리 주소 레지스터에 쓰면 DMA가 전송 에러로 멈추므로 CT도 확인한다.
+  //
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (seq == i2s_proc_seq && ((hdma_spi2_tx.Instance->CR & DMA_SxCR_CT) ? 1:0) != index)
+  {
+    if (index == 0)
+      hdma_spi2_tx.Instance->M0AR = (uint32_t)p_buf;
+    else
+      hdma_spi2_tx.Instance->M1AR = (uint32_t)p_buf;
+
+    if (ring_pos != I2S_RING_NONE)
+    {
+      i2s_q.out = (i2s_q.out + i2s_frame_len) % i2s_q.len;
+      i2s_zero_copy_cnt++;
+      i2s_copy_saved += block_bytes * 2;
+    }
+    else if (is_busy == true)
+    {
+      i2s_copy_saved += block_bytes;
+    }
+    i2s_dma_addr[index]     = p_buf;
+    i2s_dma_ring_pos[index] = ring_pos;
+    i2s_proc_done_seq = seq;
+  }
+  __set_PRIMASK(primask);
+
+  if (millis() - i2s_copy_pre_ms >= 1000)
+  {
+    i2s_copy_pre_ms    = millis();
+    i2s_copy_bytes_sec = i2s_copy_bytes;
+    i2s_copy_saved_sec = i2s_copy_saved;
+    i2s_copy_bytes     = 0;
+    i2s_copy_saved     = 0;
+  }
+
+  i2s_proc_cycles = cycles() - cycles_start;
+  if (i2s_proc_cycles > i2s_proc_cycles_max)
+  {
+    i2s_proc_cycles_max = i2s_proc_cycles;
+  }
+  if (i2s_proc_period > 0)
+  {
+    uint32_t load = i2s_proc_cycles * 1000 / i2s_proc_period;
+
+    if (load > i2s_proc_load_peak)
+    {
+      i2s_proc_load_peak = load;
+    }
+    if (i2s_proc_load_alarm > 0 && load >= i2s_proc_load_alarm)
+    {
+      eventPost(EVENT_AUDIO_CTRL);
+    }
+  }
+
+  slack = (int32_t)(deadline - cycles());
+  i2s_proc_slack_us = slack > 0 ? (uint32_t)slack / (SystemCoreClock / 1000000) : 0;
+  if (i2s_proc_slack_min == 0 || i2s_proc_slack_us < i2s_proc_slack_min)
+  {
+    i2s_proc_slack_min = i2s_proc_slack_us;
   }
-  logPrintf("%d/%d ms\n", millis()-pre_time, time_ms);
-  return true;
 }
 
-int16_t i2sGetVolume(void)
+// 링 버퍼의 스트림을 출력 샘플레이트로 변환한다.
+// 링 끝에서 나뉘면 두 번에 나눠서 넘긴다.
+//
+__RAMFUNC void i2sResample(int32_t *p_buf, uint32_t frames)
 {
-  return i2s_volume;
+  uint32_t cycles_start = cycles();
+  uint32_t out_cnt = 0;
+
+
+  for (int i=0; i<2 && out_cnt < frames; i++)
+  {
+    uint32_t in_frames = qbufferAvailable(&i2s_q);
+
+    if (in_frames > i2s_q.len - i2s_q.out)
+    {
+      in_frames = i2s_q.len - i2s_q.out;
+    }
+    in_frames /= I2S_BUF_CH;
+
+    out_cnt += resampleProcess(&p_buf[out_cnt * I2S_BUF_CH], frames - out_cnt,
+                               (int32_t *)qbufferPeekRead(&i2s_q), &in_frames);
+    i2s_q.out = (i2s_q.out + in_frames * I2S_BUF_CH) % i2s_q.len;
+    i2s_copy_bytes += in_frames * I2S_BUF_CH * i2s_sample_bytes;
+  }
+  if (out_cnt < frames)
+  {
+    memset(&p_buf[out_cnt * I2S_BUF_CH], 0, (frames - out_cnt) * I2S_BUF_CH * sizeof(int32_t));
+  }
+
+  i2s_rs_cycles = cycles() - cycles_start;
+  if (i2s_rs_cycles > i2s_rs_cycles_max)
+  {
+    i2s_rs_cycles_max = i2s_rs_cycles;
+  }
 }
 
-bool i2sSetVolume(int16_t volume)
+// 스테이지 처리가 있을 때만 마지막에 호출된다.
+//
+bool i2sStageSetQuantizer(const char *name, I2sStageFunc_t func, void *arg)
 {
-  volume = constrain(volume, 0, 100);
-  i2s_volume = volume;
+  uint32_t primask;
 
-  es8156SetVolume(i2s_volume);
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  i2s_quant.name       = name;
+  i2s_quant.func       = func;
+  i2s_quant.arg        = arg;
+  i2s_quant.enable     = true;
+  i2s_quant.cycles     = 0;
+  i2s_quant.cycles_max = 0;
+  __set_PRIMASK(primask);
 
   return true;
 }
 
-bool i2sSetBitDepth(I2sBitDepth_t bit_depth)
+// 믹서 소스 채널로 등록만 하고 i2sSourceEnable() 로 켠다.
+//
+bool i2sSetSource(const char *name, I2sStageFunc_t func, void *arg)
+{
+#ifdef _USE_HW_MIXER
+  uint32_t primask;
+
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (i2s_mix_src < 0)
+  {
+    i2s_mix_src = mixerAddSource(&i2s_mixer, name, func, arg);
+  }
+  __set_PRIMASK(primask);
+
+  return i2s_mix_src >= 0;
+#else
+  return false;
+#endif
+}
+
+// 스레드에서 호출한다. 저전력 상태이면 스트림과 같이 깨운다.
+// solo : 스트림 대신 출력, 아니면 스트림 위에 섞는다.
+//
+bool i2sSourceEnable(bool enable, bool solo)
 {
+#ifdef _USE_HW_MIXER
+  if (mixerSetSource(&i2s_mixer, i2s_mix_src, enable, solo) != true)
+  {
+    return false;
+  }
+
+  if (enable == true)
+  {
+    i2sWake();
+  }
   return true;
+#else
+  return false;
+#endif
 }
 
-bool i2sGetBitDepth(I2sBitDepth_t *bit_depth)
+bool i2sStageAdd(const char *name, I2sStageFunc_t func, void *arg)
 {
+  return i2sStageInsert(name, func, arg, false);
+}
+
+// 샘플을 바꾸지 않는 단계 (미터, 스펙트럼), 이 단계만 돈 블록은 양자화하지 않는다.
+//
+bool i2sStageAddTap(const char *name, I2sStageFunc_t func, void *arg)
+{
+  return i2sStageInsert(name, func, arg, true);
+}
+
+bool i2sStageInsert(const char *name, I2sStageFunc_t func, void *arg, bool is_tap)
+{
+  uint32_t primask;
+
+
+  if (i2s_stage_cnt >= HW_I2S_STAGE_MAX || func == NULL)
+  {
+    return false;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  i2s_stage[i2s_stage_cnt].name       = name;
+  i2s_stage[i2s_stage_cnt].func       = func;
+  i2s_stage[i2s_stage_cnt].arg        = arg;
+  i2s_stage[i2s_stage_cnt].enable     = true;
+  i2s_stage[i2s_stage_cnt].is_tap     = is_tap;
+  i2s_stage[i2s_stage_cnt].cycles     = 0;
+  i2s_stage[i2s_stage_cnt].cycles_max = 0;
+  i2s_stage_cnt++;
+  __set_PRIMASK(primask);
+
   return true;
 }
 
-bool i2sMute(bool enable)
+bool i2sStageEnable(const char *name, bool enable)
 {
-  bool ret;
+  for (int i=0; i<i2s_stage_cnt; i++)
+  {
+    if (strcmp(i2s_stage[i].name, name) == 0)
+    {
+      i2s_stage[i].enable = enable;
+      return true;
+    }
+  }
+  if (i2s_quant.func != NULL && strcmp(i2s_quant.name, name) == 0)
+  {
+    i2s_quant.enable = enable;
+    return true;
+  }
+  return false;
+}
 
-  ret = es8156SetMute(enable);
-  es8156SetEnable(!enable);
-  i2s_mute = enable;
+uint32_t i2sGetProcMissCount(void)
+{
+  return i2s_proc_miss;
+}
 
-  return ret;
+// 마지막으로 읽은 이후 블록 처리 부하의 최대값 (1/1000)
+//
+uint32_t i2sGetProcLoad(bool clear)
+{
+  uint32_t load = i2s_proc_load_peak;
+
+  if (clear == true)
+  {
+    i2s_proc_load_peak = 0;
+  }
+  return load;
 }
 
-bool i2sIsMute(void)
+void i2sSetProcLoadAlarm(uint32_t load)
 {
-  return i2s_mute;
+  i2s_proc_load_alarm = load;
 }
 
-void i2sUpdateBuffer(uint8_t index)
+bool i2sStageIsEnable(const char *name)
 {
-  if (qbufferAvailable(&i2s_q) >= i2s_frame_len)
+  for (int i=0; i<i2s_stage_cnt; i++)
   {
-    qbufferRead(&i2s_q, (uint8_t *)&i2s_frame_buf[index * i2s_frame_len], i2s_frame_len);
-    is_busy = true;
+    if (strcmp(i2s_stage[i].name, name) == 0)
+    {
+      return i2s_stage[i].enable;
+    }
   }
-  else
+  return false;
+}
+
+uint32_t i2sStageGetCycles(const char *name)
+{
+  for (int i=0; i<i2s_stage_cnt; i++)
+  {
+    if (strcmp(i2s_stage[i].name, name) == 0)
+    {
+      return i2s_stage[i].cycles;
+    }
+  }
+  if (i2s_quant.func != NULL && strcmp(i2s_quant.name, name) == 0)
+  {
+    return i2s_quant.cycles;
+  }
+  return 0;
+}
+
+void i2sSetStream(bool enable)
+{
+  i2s_stream_on = enable;
+
+  if (enable == true)
+  {
+    i2sWake();
+  }
+}
+
+// 스트림 외의 출력(발생기, 믹서 채널)도 저전력 상태에서 깨운다.
+// suspend 중이면 resume 후에 깨어난다.
+//
+void i2sWake(void)
+{
+  if (i2s_power != I2S_POWER_ACTIVE && i2s_wake_req == false)
+  {
+    i2s_wake_start = cycles();
+    i2s_wake_req   = true;
+    eventPost(EVENT_AUDIO_CTRL);
+  }
+}
+
+I2sPower_t i2sGetPowerState(void)
+{
+  return i2s_power;
+}
+
+void i2sSetPowerState(I2sPower_t power)
+{
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  i2s_power_time_ms[i2s_power] += millis() - i2s_power_enter_ms;
+  i2s_power_enter_ms = millis();
+  i2s_power = power;
+  __set_PRIMASK(primask);
+}
+
+void i2sPowerDown(I2sPower_t power)
+{
+  i2sSetPowerState(power);
+  es8156SetMute(true);
+  es8156SetEnable(false);
+  es8156SetPowerDown(true);
+  i2sStop();
+}
+
+// USB suspend/resume 시 스레드에서 호출한다.
+// 샘플레이트, 볼륨, 뮤트는 i2s/es8156 에 캐시된 값으로 그대로 복원된다.
+//
+void i2sSetSuspend(bool enable)
+{
+  if (enable == true)
+  {
+    if (i2s_power == I2S_POWER_ACTIVE)
+    {
+      i2sPowerDown(I2S_POWER_SUSPEND);
+    }
+    else
+    {
+      i2sSetPowerState(I2S_POWER_SUSPEND);
+    }
+    i2s_first_req = false;
+  }
+  else if (i2s_power == I2S_POWER_SUSPEND)
+  {
+    i2sSetPowerState(I2S_POWER_IDLE);
+    if (i2s_stream_on == true)
+    {
+      i2s_wake_start  = cycles();
+      i2s_first_start = i2s_wake_start;
+      i2s_first_req   = true;
+      i2s_wake_req    = true;
+    }
+    i2sPowerUpdate();
+  }
+}
+
+uint32_t i2sGetFirstSampleUs(void)
+{
+  return i2s_first_us;
+}
+
+void i2sPowerUpdate(void)
+{
+  if (i2s_power == I2S_POWER_ACTIVE)
   {
-    memset(&i2s_frame_buf[index * i2s_frame_len], 0, i2s_frame_len * i2s_sample_bytes);
-    is_busy = false;
-    i2s_zero_cnt++;
+    // alt setting 0 이고 일정 시간 무음이면 코덱을 저전력으로 내리고 I2S 클럭을 멈춘다.
+    //
+    if (i2s_stream_on == false && es8156IsReady() == true &&
+        i2s_idle_periods * I2S_BUF_MS >= HW_I2S_IDLE_MS)
+    {
+      i2sPowerDown(I2S_POWER_IDLE);
+      logPrintf("[  ] i2s power idle\n");
+    }
+  }
+  else if (i2s_power == I2S_POWER_IDLE && i2s_wake_req == true)
+  {
+    // 클럭을 먼저 켜고 코덱을 복귀시킨 후, 0에서부터 램프로 unmute 한다.
+    //
+    i2s_ramp_gain = 0;
+    i2sStart();
+    es8156SetPowerDown(false);
+    i2sSetPowerState(I2S_POWER_ACTIVE);
+    i2sMute(i2s_mute);
+
+    i2s_wake_us = (cycles() - i2s_wake_start) / (SystemCoreClock / 1000000);
+    if (i2s_wake_us > i2s_wake_us_max)
+    {
+      i2s_wake_us_max = i2s_wake_us;
+    }
+    i2s_wake_cnt++;
+    i2s_wake_req = false;
+    logPrintf("[  ] i2s power wake %d us\n", i2s_wake_us);
   }
 }
 
@@ -411,27 +1237,70 @@ uint32_t i2sZeroCntClear(void)
   return 0;
 }
 
-void HAL_I2S_TxHalfCpltCallback(I2S_HandleTypeDef *hi2s)
+uint32_t i2sZeroTotalGet(void)
+{
+  return i2s_zero_total;
+}
+
+uint32_t i2sGetIsrCycles(void)
+{
+  return i2s_isr_cycles;
+}
+
+uint32_t i2sGetIsrCyclesMax(void)
+{
+  return i2s_isr_cycles_max;
+}
+
+void i2sClearStat(void)
+{
+  i2s_zero_total = 0;
+  i2s_isr_cycles_max = 0;
+  i2s_isr_period_min = 0;
+  i2s_isr_period_max = 0;
+  i2s_proc_cycles_max = 0;
+  i2s_proc_slack_min = 0;
+  i2s_proc_miss = 0;
+  i2s_rs_cycles_max = 0;
+  for (int i=0; i<i2s_stage_cnt; i++)
+  {
+    i2s_stage[i].cycles_max = 0;
+  }
+}
+
+// M0 전송이 끝나고 M1을 재생 중이다.
+//
+__RAMFUNC void i2sDmaM0Callback(DMA_HandleTypeDef *hdma)
 {
   i2sUpdateBuffer(0);
 }
 
-void HAL_I2S_TxCpltCallback(I2S_HandleTypeDef *hi2s)
+__RAMFUNC void i2sDmaM1Callback(DMA_HandleTypeDef *hdma)
 {
   i2sUpdateBuffer(1);
 }
 
+void i2sDmaErrorCallback(DMA_HandleTypeDef *hdma)
+{
+  HAL_I2S_ErrorCallback(&hi2s2);
+}
+
 void HAL_I2S_ErrorCallback(I2S_HandleTypeDef *hi2s)
 {
   return;
 }
 
+__RAMFUNC void HW_I2S_PROC_IRQHandler(void)
+{
+  i2sProcess();
+}
+
 void SPI2_IRQHandler(void)
 {
   HAL_I2S_IRQHandler(&hi2s2);
 }
 
-void DMA1_Stream4_IRQHandler(void)
+__RAMFUNC void DMA1_Stream4_IRQHandler(void)
 {
   HAL_DMA_IRQHandler(&hdma_spi2_tx);
 }
@@ -535,17 +1404,127 @@ void cliI2s(cli_args_t *args)
 
   if (args->argc == 1 && args->isStr(0, "info") == true)
   {
+    uint32_t cycles_per_us = SystemCoreClock / 1000000;
 
     cliPrintf("i2s init      : %d\n", is_init);
-    cliPrintf("i2s rate      : %d Khz\n", i2s_sample_rate/1000);
+    cliPrintf("i2s rate      : %d Hz (out %d Hz)\n", i2s_sample_rate, i2s_out_rate);
+    cliPrintf("i2s fixed out : %s\n", i2s_fixed ? "on":"off");
+    if (i2s_rs_rate != 0)
+    {
+      cliPrintf("i2s resample  : %d cycles (max %d)\n", i2s_rs_cycles, i2s_rs_cycles_max);
+    }
     cliPrintf("i2s depth     : %d bit\n", i2s_sample_depth);
     cliPrintf("i2s ch        : %d \n", i2s_num_of_ch);
     cliPrintf("i2s buf ms    : %d ms\n", I2S_BUF_MS);
     cliPrintf("i2s frame len : %d \n", i2s_frame_len);
     cliPrintf("i2s mute      : %s \n", i2sIsMute() ? "ON":"OFF");
+    cliPrintf("i2s underrun  : %d \n", i2s_zero_total);
+    cliPrintf("i2s isr cycle : %d (max %d)\n", i2s_isr_cycles, i2s_isr_cycles_max);
+    cliPrintf("i2s isr period: %d us (min %d, max %d)\n",
+      i2s_isr_period / cycles_per_us, i2s_isr_period_min / cycles_per_us, i2s_isr_period_max / cycles_per_us);
+    cliPrintf("i2s proc cycle: %d (max %d)\n", i2s_proc_cycles, i2s_proc_cycles_max);
+    cliPrintf("i2s proc slack: %d us (min %d)\n", i2s_proc_slack_us, i2s_proc_slack_min);
+    cliPrintf("i2s proc miss : %d\n", i2s_proc_miss);
+    cliPrintf("i2s proc load : %d.%d %%\n", i2s_proc_load_peak/10, i2s_proc_load_peak%10);
+    cliPrintf("i2s copy      : %d B/s (saved %d B/s)\n", i2s_copy_bytes_sec, i2s_copy_saved_sec);
+    cliPrintf("i2s zero copy : %d blocks\n", i2s_zero_copy_cnt);
+    ret = true;
+  }
+
+  if (args->argc == 1 && args->isStr(0, "power") == true)
+  {
+    uint32_t time_ms[I2S_POWER_MAX];
+
+    for (int i=0; i<I2S_POWER_MAX; i++)
+    {
+      time_ms[i] = i2s_power_time_ms[i];
+    }
+    time_ms[i2s_power] += millis() - i2s_power_enter_ms;
+
+    cliPrintf("power state   : %s\n", i2s_power_str[i2s_power]);
+    cliPrintf("stream        : %s\n", i2s_stream_on ? "on":"off");
+    for (int i=0; i<I2S_POWER_MAX; i++)
+    {
+      cliPrintf("time %-8s : %d.%03d s\n", i2s_power_str[i], time_ms[i]/1000, time_ms[i]%1000);
+    }
+    cliPrintf("wake count    : %d\n", i2s_wake_cnt);
+    cliPrintf("wake latency  : %d us (max %d)\n", i2s_wake_us, i2s_wake_us_max);
+    cliPrintf("first sample  : %d us\n", i2s_first_us);
     ret = true;
   }
 
+  if (args->argc == 1 && args->isStr(0, "stage") == true)
+  {
+    for (int i=0; i<i2s_stage_cnt; i++)
+    {
+      cliPrintf("%d %-12s %-3s %6d cycles (max %d)\n",
+        i,
+        i2s_stage[i].name,
+        i2s_stage[i].enable ? "on":"off",
+        i2s_stage[i].cycles,
+        i2s_stage[i].cycles_max);
+    }
+    if (i2s_quant.func != NULL)
+    {
+      cliPrintf("q %-12s %-3s %6d cycles (max %d)\n",
+        i2s_quant.name,
+        i2s_quant.enable ? "on":"off",
+        i2s_quant.cycles,
+        i2s_quant.cycles_max);
+    }
+#ifdef _USE_HW_MIXER
+    cliPrintf("m %-12s %-3d %6d cycles (max %d)\n",
+      "mixer",
+      i2s_mix_cnt,
+      i2s_mix_cycles,
+      i2s_mix_cycles_max);
+    for (int i=0; i<i2s_mixer.src_cnt; i++)
+    {
+      cliPrintf("s %-12s %-3s %s\n",
+        i2s_mixer.src[i].name,
+        i2s_mixer.src[i].enable ? "on":"off",
+        i2s_mixer.src[i].solo ? "solo":"mix");
+    }
+#endif
+    ret = true;
+  }
+
+#ifdef _USE_HW_MIXER
+  if (args->argc == 1 && args->isStr(0, "mixer"))
+  {
+    cliPrintf("volume : %d\n", mixerGetVolume(&i2s_mixer));
+    for (int i=0; i<MIXER_MAX_CH; i++)
+    {
+      cliPrintf("ch %d   : vol %3d, %4d/%d\n",
+        i + 1,
+        mixerGetChVolume(&i2s_mixer, i),
+        i2sAvailableForRead(i + 1),
+        MIXER_MAX_BUF_LEN);
+    }
+    for (int i=0; i<i2s_mixer.src_cnt; i++)
+    {
+      cliPrintf("src %d  : vol %3d, %s %s\n",
+        i,
+        i2s_mixer.src[i].volume,
+        i2s_mixer.src[i].name,
+        i2s_mixer.src[i].enable ? "on":"off");
+    }
+    ret = true;
+  }
+
+  if (args->argc == 3 && args->isStr(0, "mixer"))
+  {
+    uint8_t ch = args->getData(1);
+    int32_t volume = args->getData(2);
+
+    if (ch == 0)
+      mixerSetVolume(&i2s_mixer, volume);
+    else
+      mixerSetChVolume(&i2s_mixer, ch - 1, volume);
+    ret = true;
+  }
+#endif
+
   if (args->argc == 1 && args->isStr(0, "show") == true)
   {
     uint32_t pre_time;
@@ -565,38 +1544,19 @@ void cliI2s(cli_args_t *args)
     ret = true;
   }
 
-  if (args->argc == 3 && args->isStr(0, "beep") == true)
+  if (args->argc == 3 && args->isStr(0, "stage"))
   {
-    uint32_t freq;
-    uint32_t time_ms;
-
-    freq = args->getData(1);
-    time_ms = args->getData(2);
-    
-    i2sMute(false);
-    i2sPlayBeep(freq, 100, time_ms);
-    i2sMute(true);
-
+    if (i2sStageEnable(args->getStr(1), args->isStr(2, "on")) != true)
+    {
+      cliPrintf("no stage : %s\n", args->getStr(1));
+    }
     ret = true;
   }
 
-  if (args->argc == 1 && args->isStr(0, "melody"))
+  if (args->argc == 2 && args->isStr(0, "fixed"))
   {
-    uint16_t melody[] = {NOTE_C4, NOTE_G3, NOTE_G3, NOTE_A3, NOTE_G3, 0, NOTE_B3, NOTE_C4};
-    int note_durations[] = { 4, 8, 8, 4, 4, 4, 4, 4 };
-
-    i2sMute(false);
-
-    uint32_t pre_time = millis();
-    for (int i=0; i<8; i++) 
-    {
-      int note_duration = 1000 / note_durations[i];
-
-      i2sPlayBeep(melody[i], 100, note_duration);
-      delay(note_duration * 0.3);    
-    }
-    logPrintf("%d ms\n", millis()-pre_time);
-    i2sMute(true);
+    i2sSetFixedRate(args->isStr(1, "on"));
+    cliPrintf("rate %d Hz, out %d Hz\n", i2s_sample_rate, i2s_out_rate);
     ret = true;
   }
 
@@ -613,9 +1573,14 @@ void cliI2s(cli_args_t *args)
   {
     cliPrintf("i2s info\n");
     cliPrintf("i2s show\n");
-    cliPrintf("i2s melody\n");
-    cliPrintf("i2s beep freq time_ms\n");
+    cliPrintf("i2s stage\n");
+    cliPrintf("i2s power\n");
+    cliPrintf("i2s stage name on:off\n");
+#ifdef _USE_HW_MIXER
+    cliPrintf("i2s mixer [ch(0:all) volume]\n");
+#endif
     cliPrintf("i2s mute on:off\n");
+    cliPrintf("i2s fixed on:off\n");
   }
 }
 #endif
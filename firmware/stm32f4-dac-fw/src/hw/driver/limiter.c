@@ -0,0 +1,314 @@
+#include "limiter.h"
+
+
+#ifdef _USE_HW_LIMITER
+#include "cli.h"
+#include "i2s.h"
+
+
+#define LIMITER_CH              2
+#define LIMITER_DELAY_MAX       ((96000 * HW_LIMITER_LOOKAHEAD_MS) / 1000)
+#define LIMITER_Q31_TO_F        (1.0f / 2147483648.0f)
+#define LIMITER_F_TO_Q31        (2147483647.0f)
+
+
+#if CLI_USE(HW_LIMITER)
+static void cliLimiter(cli_args_t *args);
+#endif
+static void limiterUpdateCoef(uint32_t sample_rate);
+
+static limiter_cfg_t limiter_cfg =
+{
+  .threshold_db = -1.0f,
+  .attack_ms    = 0.5f,
+  .release_ms   = 80.0f,
+  .lookahead_ms = 1.0f,
+  .clip_knee_db = -0.5f,
+};
+
+// sample rate 에 따라 계산되는 값
+//
+static volatile bool limiter_coef_dirty = true;
+static uint32_t limiter_rate = 0;
+static float    limiter_thr;
+static float    limiter_att;
+static float    limiter_rel;
+static float    limiter_knee;
+static uint32_t limiter_delay_len;
+
+// 처리 상태
+//
+static float    limiter_delay[LIMITER_DELAY_MAX][LIMITER_CH];
+static uint32_t limiter_delay_index = 0;
+static float    limiter_env  = 0.0f;                  // peak hold 포락선
+static uint32_t limiter_hold = 0;
+static float    limiter_gain = 1.0f;
+static float    limiter_gain_min = 1.0f;
+static uint32_t limiter_gr_samples = 0;
+static uint32_t limiter_clip_cnt = 0;
+
+
+
+
+bool limiterInit(void)
+{
+  i2sStageAdd("limiter", limiterProcess, NULL);
+
+  // EQ 등 게인을 올리는 스테이지가 있을 때만 켠다.
+  //
+  i2sStageEnable("limiter", false);
+
+#if CLI_USE(HW_LIMITER)
+  cliAdd("limiter", cliLimiter);
+#endif
+  return true;
+}
+
+bool limiterSetConfig(const limiter_cfg_t *p_cfg)
+{
+  if (p_cfg->threshold_db < -20.0f || p_cfg->threshold_db > 0.0f)
+    return false;
+  if (p_cfg->lookahead_ms < 0.0f || p_cfg->lookahead_ms > HW_LIMITER_LOOKAHEAD_MS)
+    return false;
+  if (p_cfg->attack_ms <= 0.0f || p_cfg->release_ms <= 0.0f)
+    return false;
+  if (p_cfg->clip_knee_db < p_cfg->threshold_db || p_cfg->clip_knee_db > 0.0f)
+    return false;
+
+  limiter_cfg = *p_cfg;
+  limiter_coef_dirty = true;
+  return true;
+}
+
+void limiterGetConfig(limiter_cfg_t *p_cfg)
+{
+  *p_cfg = limiter_cfg;
+}
+
+void limiterGetStat(limiter_stat_t *p_stat)
+{
+  uint32_t rate = limiter_rate > 0 ? limiter_rate : 48000;
+
+  p_stat->gr_ms       = (uint32_t)(((uint64_t)limiter_gr_samples * 1000) / rate);
+  p_stat->gr_max_db10 = (uint32_t)(-200.0f * log10f(limiter_gain_min));
+  p_stat->clip_cnt    = limiter_clip_cnt;
+}
+
+void limiterUpdateCoef(uint32_t sample_rate)
+{
+  limiter_rate      = sample_rate;
+  limiter_thr       = powf(10.0f, limiter_cfg.threshold_db / 20.0f);
+  limiter_knee      = powf(10.0f, limiter_cfg.clip_knee_db / 20.0f);
+  limiter_att       = 1.0f - expf(-1000.0f / (limiter_cfg.attack_ms * sample_rate));
+  limiter_rel       = 1.0f - expf(-1000.0f / (limiter_cfg.release_ms * sample_rate));
+  limiter_delay_len = (uint32_t)(limiter_cfg.lookahead_ms * sample_rate / 1000.0f);
+  if (limiter_delay_len > LIMITER_DELAY_MAX)
+  {
+    limiter_delay_len = LIMITER_DELAY_MAX;
+  }
+
+  memset(limiter_delay, 0, sizeof(limiter_delay));
+  limiter_delay_index = 0;
+  limiter_env  = 0.0f;
+  limiter_hold = 0;
+  limiter_gain = 1.0f;
+  limiter_coef_dirty = false;
+}
+
+// 게인 감소 후 남는 피크를 잡는 마지막 안전 단계
+// knee 위는 y = k + (1-k) * t/(1+t) 로 1.0 을 넘지 않는다.
+//
+static inline float limiterSoftClip(float x)
+{
+  float a = fabsf(x);
+  float t;
+
+  if (a <= limiter_knee)
+  {
+    return x;
+  }
+  limiter_clip_cnt++;
+
+  t = (a - limiter_knee) / (1.0f - limiter_knee);
+  a = limiter_knee + (1.0f - limiter_knee) * t / (1.0f + t);
+
+  return x < 0.0f ? -a : a;
+}
+
+// 스테레오 연동 look-ahead 리미터
+// 입력 피크로 포락선을 만들고(look-ahead 동안 hold), 지연된 신호에 게인을 곱한다.
+//
+__RAMFUNC void limiterProcess(int32_t *p_buf, uint32_t frames, void *arg)
+{
+  uint32_t rate = i2sGetSampleRate();
+  uint32_t index;
+  uint32_t delay_len;
+  float    env;
+  float    gain;
+  float    gain_min;
+  uint32_t hold;
+  uint32_t gr_samples = 0;
+
+
+  if (limiter_coef_dirty == true || rate != limiter_rate)
+  {
+    limiterUpdateCoef(rate);
+  }
+
+  index     = limiter_delay_index;
+  delay_len = limiter_delay_len;
+  env       = limiter_env;
+  gain      = limiter_gain;
+  gain_min  = limiter_gain_min;
+  hold      = limiter_hold;
+
+  for (uint32_t i=0; i<frames; i++)
+  {
+    float in_l = (float)p_buf[0] * LIMITER_Q31_TO_F;
+    float in_r = (float)p_buf[1] * LIMITER_Q31_TO_F;
+    float out_l;
+    float out_r;
+    float peak;
+    float target;
+
+    peak = fmaxf(fabsf(in_l), fabsf(in_r));
+    if (peak >= env)
+    {
+      env  = peak;
+      hold = delay_len;
+    }
+    else if (hold > 0)
+    {
+      hold--;
+    }
+    else
+    {
+      env += (peak - env) * limiter_rel;
+    }
+
+    // 대부분의 구간은 threshold 아래이므로 나눗셈을 하지 않는다.
+    //
+    target = env > limiter_thr ? limiter_thr / env : 1.0f;
+    if (target < gain)
+      gain += (target - gain) * limiter_att;
+    else
+      gain += (target - gain) * limiter_rel;
+
+    if (delay_len > 0)
+    {
+      out_l = limiter_delay[index][0];
+      out_r = limiter_delay[index][1];
+      limiter_delay[index][0] = in_l;
+      limiter_delay[index][1] = in_r;
+      index = (index + 1) < delay_len ? index + 1 : 0;
+    }
+    else
+    {
+      out_l = in_l;
+      out_r = in_r;
+    }
+
+    if (gain < 0.9999f)
+    {
+      out_l *= gain;
+      out_r *= gain;
+      gr_samples++;
+      if (gain < gain_min)
+      {
+        gain_min = gain;
+      }
+    }
+
+    out_l = limiterSoftClip(out_l);
+    out_r = limiterSoftClip(out_r);
+
+    p_buf[0] = (int32_t)(out_l * LIMITER_F_TO_Q31);
+    p_buf[1] = (int32_t)(out_r * LIMITER_F_TO_Q31);
+    p_buf += LIMITER_CH;
+  }
+
+  limiter_delay_index = index;
+  limiter_env         = env;
+  limiter_gain        = gain;
+  limiter_gain_min    = gain_min;
+  limiter_hold        = hold;
+  limiter_gr_samples += gr_samples;
+}
+
+
+#if CLI_USE(HW_LIMITER)
+static void limiterPrintDb(const char *p_name, float db)
+{
+  int32_t db10     = (int32_t)lroundf(db * 10.0f);
+  int32_t abs_db10 = db10 < 0 ? -db10 : db10;
+
+  cliPrintf("%s%c%d.%d dB\n", p_name, db10 < 0 ? '-':' ', (int)(abs_db10/10), (int)(abs_db10%10));
+}
+
+void cliLimiter(cli_args_t *args)
+{
+  bool ret = false;
+
+
+  if (args->argc == 1 && args->isStr(0, "info"))
+  {
+    limiter_stat_t stat;
+
+    limiterGetStat(&stat);
+    limiterPrintDb("threshold : ", limiter_cfg.threshold_db);
+    cliPrintf("attack    : %d us\n", (int)(limiter_cfg.attack_ms * 1000));
+    cliPrintf("release   : %d ms\n", (int)limiter_cfg.release_ms);
+    cliPrintf("lookahead : %d us, %d frames\n", (int)(limiter_cfg.lookahead_ms * 1000), limiter_delay_len);
+    limiterPrintDb("clip knee : ", limiter_cfg.clip_knee_db);
+    cliPrintf("gr time   : %d ms\n", stat.gr_ms);
+    cliPrintf("gr max    : %d.%d dB\n", stat.gr_max_db10/10, stat.gr_max_db10%10);
+    cliPrintf("clip      : %d samples\n", stat.clip_cnt);
+    ret = true;
+  }
+
+  if (args->argc == 1 && args->isStr(0, "clear"))
+  {
+    limiter_gr_samples = 0;
+    limiter_gain_min   = 1.0f;
+    limiter_clip_cnt   = 0;
+    ret = true;
+  }
+
+  if (args->argc == 3 && args->isStr(0, "set"))
+  {
+    limiter_cfg_t cfg = limiter_cfg;
+    float value = args->getFloat(2);
+
+    ret = true;
+    if (args->isStr(1, "thr"))
+      cfg.threshold_db = value;
+    else if (args->isStr(1, "att"))
+      cfg.attack_ms = value;
+    else if (args->isStr(1, "rel"))
+      cfg.release_ms = value;
+    else if (args->isStr(1, "look"))
+      cfg.lookahead_ms = value;
+    else if (args->isStr(1, "knee"))
+      cfg.clip_knee_db = value;
+    else
+      ret = false;
+
+    // 모르는 항목은 아래 사용법을 출력한다.
+    //
+    if (ret == true && limiterSetConfig(&cfg) != true)
+    {
+      cliPrintf("invalid value\n");
+    }
+  }
+
+  if (ret == false)
+  {
+    cliPrintf("limiter info\n");
+    cliPrintf("limiter clear\n");
+    cliPrintf("limiter set thr:att:rel:look:knee value\n");
+    cliPrintf("i2s stage limiter on:off\n");
+  }
+}
+#endif
+
+#endif
@@ -4,6 +4,7 @@
 #ifdef _USE_HW_LOG
 #include "uart.h"
 #include "cli.h"
+#include "event.h"
 
 #ifdef _USE_HW_RTOS
 #define lock()      xSemaphoreTake(mutex_lock, portMAX_DELAY);
@@ -14,6 +15,42 @@
 #endif
 
 
+#define LOG_RING_SIZE     HW_LOG_RING_BUF_MAX   // 2의 거듭제곱
+#define LOG_LINE_MAX      128
+
+#define LOG_REC_EMPTY     0
+#define LOG_REC_READY     1
+#define LOG_REC_PAD       2
+
+#define LOG_REC_HDR_SIZE  4
+#define LOG_REC_ALIGN(x)  (((x) + 3) & ~3)
+
+
+// logPrintf()는 어느 컨텍스트에서든 호출될 수 있으므로 포맷된 문자열을
+// lock-free 링버퍼에 기록만 하고, UART 송신 버퍼로 옮기는 것은 하나의 소비자가 처리한다.
+//
+typedef struct
+{
+  volatile uint16_t state;
+  uint16_t length;
+} log_rec_t;
+
+typedef struct
+{
+  volatile uint32_t head;       // 생산자 예약 위치 (free running)
+  volatile uint32_t tail;       // 소비자 위치 (free running)
+  volatile uint32_t drain_lock;
+
+  uint32_t rec_cnt;
+  uint32_t drop_cnt;
+  uint32_t drop_bytes;
+  uint32_t trunc_cnt;
+  uint32_t tx_busy_cnt;
+  uint32_t used_max;
+
+  uint8_t  buf[LOG_RING_SIZE] __attribute__((aligned(4)));
+} log_ring_t;
+
 typedef struct
 {
   uint16_t line_index;
@@ -38,10 +75,11 @@ static bool is_open = false;
 static uint8_t  log_ch = LOG_CH;
 static uint32_t log_baud = 115200;
 
-static char print_buf[256];
+static log_ring_t log_ring;
 
 #ifdef _USE_HW_RTOS
 static SemaphoreHandle_t mutex_lock;
+static StaticSemaphore_t mutex_buf;
 #endif
 
 
@@ -49,6 +87,10 @@ static SemaphoreHandle_t mutex_lock;
 #if CLI_USE(HW_LOG)
 static void cliCmd(cli_args_t *args);
 #endif
+static bool logRingPush(const char *p_data, uint32_t length);
+static void logRingDrain(void);
+static bool logRingIsReady(void);
+static void logTxDone(void);
 
 
 
@@ -57,7 +99,7 @@ static void cliCmd(cli_args_t *args);
 bool logInit(void)
 {
 #ifdef _USE_HW_RTOS
-  mutex_lock = xSemaphoreCreateMutex();
+  mutex_lock = xSemaphoreCreateMutexStatic(&mutex_buf);
 #endif
   
   log_buf_boot.line_index     = 0;
@@ -73,6 +115,11 @@ bool logInit(void)
   log_buf_list.buf_index      = 0;
   log_buf_list.buf            = buf_list;
 
+  log_ring.head       = 0;
+  log_ring.tail       = 0;
+  log_ring.drain_lock = 0;
+  memset(log_ring.buf, 0, sizeof(log_ring.buf));
+
 
   is_init = true;
 
@@ -105,6 +152,11 @@ bool logOpen(uint8_t ch, uint32_t baud)
   is_open  = true;
 
   is_open = uartOpen(ch, baud);
+  if (is_open)
+  {
+    uartSetTxDoneCallback(ch, logTxDone);
+  }
+  logRingDrain();
 
   return is_open;
 }
@@ -135,7 +187,7 @@ bool logBufPrintf(log_buf_t *p_log, char *p_data, uint32_t length)
 
   p_buf = &p_log->buf[p_log->buf_index];
 
-  buf_len = snprintf((char *)p_buf, length + 8, "%04X\t%s", p_log->line_index, p_data);
+  buf_len = snprintf((char *)p_buf, length + 8, "%04X\t%.*s", p_log->line_index, (int)length, p_data);
   p_log->line_index++;
   p_log->buf_index += buf_len;
 
@@ -150,8 +202,7 @@ bool logBufPrintf(log_buf_t *p_log, char *p_data, uint32_t length)
 
 void logPrintf(const char *fmt, ...)
 {
-  lock();
-
+  char print_buf[LOG_LINE_MAX];
   va_list args;
   int len;
 
@@ -159,22 +210,179 @@ void logPrintf(const char *fmt, ...)
 
 
   va_start(args, fmt);
-  len = vsnprintf(print_buf, 256, fmt, args);
+  len = vsnprintf(print_buf, LOG_LINE_MAX, fmt, args);
+  va_end(args);
+
+  if (len < 0)
+  {
+    return;
+  }
+  if (len >= LOG_LINE_MAX)
+  {
+    len = LOG_LINE_MAX - 1;
+    log_ring.trunc_cnt++;
+  }
 
-  if (is_open == true && is_enable == true)
+  if (logRingPush(print_buf, len) == true)
   {
-    uartWrite(log_ch, (uint8_t *)print_buf, len);
+    logRingDrain();
+    #ifdef _USE_HW_EVENT
+    eventPost(EVENT_LOG);
+    #endif
   }
+}
+
+void logUpdate(void)
+{
+  logRingDrain();
+}
+
+bool logRingPush(const char *p_data, uint32_t length)
+{
+  uint32_t head;
+  uint32_t pos;
+  uint32_t rec_size;
+  uint32_t need;
+  log_rec_t *p_rec;
+
 
-  if (is_boot_log)
+  rec_size = LOG_REC_ALIGN(LOG_REC_HDR_SIZE + length);
+
+  // 여러 생산자(ISR 포함)가 CAS로 영역을 예약한다.
+  // 끝부분에 레코드가 들어가지 않으면 남은 공간은 PAD로 버린다.
+  //
+  head = __atomic_load_n(&log_ring.head, __ATOMIC_RELAXED);
+  do
   {
-    logBufPrintf(&log_buf_boot, print_buf, len);
+    pos  = head & (LOG_RING_SIZE - 1);
+    need = rec_size;
+    if (pos + rec_size > LOG_RING_SIZE)
+    {
+      need += LOG_RING_SIZE - pos;
+    }
+    if (head + need - __atomic_load_n(&log_ring.tail, __ATOMIC_ACQUIRE) > LOG_RING_SIZE)
+    {
+      __atomic_fetch_add(&log_ring.drop_cnt, 1, __ATOMIC_RELAXED);
+      __atomic_fetch_add(&log_ring.drop_bytes, length, __ATOMIC_RELAXED);
+      return false;
+    }
+  } while (!__atomic_compare_exchange_n(&log_ring.head, &head, head + need, true, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED));
+
+  if (need != rec_size)
+  {
+    p_rec = (log_rec_t *)&log_ring.buf[pos];
+    p_rec->length = LOG_RING_SIZE - pos;
+    __atomic_store_n(&p_rec->state, LOG_REC_PAD, __ATOMIC_RELEASE);
+    pos = 0;
   }
-  logBufPrintf(&log_buf_list, print_buf, len);
 
-  va_end(args);
+  p_rec = (log_rec_t *)&log_ring.buf[pos];
+  p_rec->length = length;
+  memcpy(&log_ring.buf[pos + LOG_REC_HDR_SIZE], p_data, length);
+  __atomic_store_n(&p_rec->state, LOG_REC_READY, __ATOMIC_RELEASE);
 
-  unLock();
+  __atomic_fetch_add(&log_ring.rec_cnt, 1, __ATOMIC_RELAXED);
+  if (need + head - log_ring.tail > log_ring.used_max)
+  {
+    log_ring.used_max = need + head - log_ring.tail;
+  }
+  return true;
+}
+
+bool logRingIsReady(void)
+{
+  uint32_t tail = __atomic_load_n(&log_ring.tail, __ATOMIC_ACQUIRE);
+  log_rec_t *p_rec;
+
+  if (tail == __atomic_load_n(&log_ring.head, __ATOMIC_ACQUIRE))
+  {
+    return false;
+  }
+  p_rec = (log_rec_t *)&log_ring.buf[tail & (LOG_RING_SIZE - 1)];
+
+  return __atomic_load_n(&p_rec->state, __ATOMIC_ACQUIRE) != LOG_REC_EMPTY;
+}
+
+void logRingDrain(void)
+{
+  uint32_t tail;
+  uint32_t pos;
+  uint32_t rec_size;
+  uint16_t state;
+  log_rec_t *p_rec;
+  bool is_tx;
+  bool is_full;
+
+
+  while(1)
+  {
+    // 소비자는 하나만 실행되어야 한다.
+    // 실행중에 호출된 경우는 실행중인 쪽에서 다시 확인한다.
+    //
+    if (__atomic_exchange_n(&log_ring.drain_lock, 1, __ATOMIC_ACQUIRE) != 0)
+    {
+      return;
+    }
+
+    is_tx   = (is_open == true && is_enable == true);
+    is_full = false;
+    tail    = log_ring.tail;
+    while(tail != __atomic_load_n(&log_ring.head, __ATOMIC_ACQUIRE))
+    {
+      pos   = tail & (LOG_RING_SIZE - 1);
+      p_rec = (log_rec_t *)&log_ring.buf[pos];
+      state = __atomic_load_n(&p_rec->state, __ATOMIC_ACQUIRE);
+
+      if (state == LOG_REC_EMPTY)
+      {
+        break;                          // 아직 기록중인 레코드
+      }
+      if (state == LOG_REC_READY)
+      {
+        uint8_t *p_data = &log_ring.buf[pos + LOG_REC_HDR_SIZE];
+
+        // UART 송신 버퍼가 부족하면 전송 완료 콜백에서 다시 처리한다.
+        //
+        if (is_tx)
+        {
+          if (uartAvailableForWrite(log_ch) < p_rec->length)
+          {
+            log_ring.tx_busy_cnt++;
+            is_full = true;
+            break;
+          }
+          uartWrite(log_ch, p_data, p_rec->length);
+        }
+        if (is_boot_log)
+        {
+          logBufPrintf(&log_buf_boot, (char *)p_data, p_rec->length);
+        }
+        logBufPrintf(&log_buf_list, (char *)p_data, p_rec->length);
+        rec_size = LOG_REC_ALIGN(LOG_REC_HDR_SIZE + p_rec->length);
+      }
+      else
+      {
+        rec_size = p_rec->length;
+      }
+
+      // 다음 예약시 헤더로 오인되지 않도록 영역을 지운다.
+      //
+      memset(&log_ring.buf[pos], 0, rec_size);
+      tail += rec_size;
+      __atomic_store_n(&log_ring.tail, tail, __ATOMIC_RELEASE);
+    }
+    __atomic_store_n(&log_ring.drain_lock, 0, __ATOMIC_RELEASE);
+
+    if (is_full == true || logRingIsReady() != true)
+    {
+      break;
+    }
+  }
+}
+
+void logTxDone(void)
+{
+  logRingDrain();
 }
 
 
@@ -192,6 +400,15 @@ void cliCmd(cli_args_t *args)
     cliPrintf("\n");
     cliPrintf("list.line_index %d\n", log_buf_list.line_index);
     cliPrintf("list.buf_length %d\n", log_buf_list.buf_length);
+    cliPrintf("\n");
+    cliPrintf("ring.size       %d\n", LOG_RING_SIZE);
+    cliPrintf("ring.used       %d\n", log_ring.head - log_ring.tail);
+    cliPrintf("ring.used_max   %d\n", log_ring.used_max);
+    cliPrintf("ring.rec_cnt    %d\n", log_ring.rec_cnt);
+    cliPrintf("ring.drop_cnt   %d\n", log_ring.drop_cnt);
+    cliPrintf("ring.drop_bytes %d\n", log_ring.drop_bytes);
+    cliPrintf("ring.trunc_cnt  %d\n", log_ring.trunc_cnt);
+    cliPrintf("ring.tx_busy    %d\n", log_ring.tx_busy_cnt);
 
     ret = true;
   }
@@ -0,0 +1,380 @@
+#include "loudness.h"
+
+
+#ifdef _USE_HW_LOUDNESS
+#include "cli.h"
+#include "i2s.h"
+#include "es8156.h"
+#include "eeprom.h"
+#include "event.h"
+
+
+#define LOUDNESS_MAGIC          0x1D
+#define LOUDNESS_Q31_TO_F       (1.0f / 2147483648.0f)
+#define LOUDNESS_F_TO_Q31       (2147483647.0f)
+#define LOUDNESS_SETTLE_MS      20                    // 새 필터를 0 상태에서 혼자 돌려서 과도 응답을 없애는 시간
+#define LOUDNESS_FADE_MS        20                    // 그 다음 이전/새 필터를 섞는 시간
+
+
+// 채널별 DF1 상태 : x1, x2, y1, y2
+//
+typedef struct
+{
+  float s[2][LOUDNESS_BIQUAD_MAX][4];
+} loudness_state_t;
+
+
+#if CLI_USE(HW_LOUDNESS)
+static void cliLoudness(cli_args_t *args);
+#endif
+static void loudnessLoad(void);
+static void loudnessUpdateStep(void);
+
+
+static bool     is_init = false;
+static volatile bool loudness_enable = false;
+static int16_t  loudness_volume = 0;
+static volatile uint8_t loudness_step_req = 0;        // 스레드에서 요청한 단계, 꺼지면 0
+static uint8_t  loudness_step = 0;                    // 처리 중인 단계
+static uint8_t  loudness_step_new = 0;                // 페이드 중인 새 단계
+static uint32_t loudness_rate_cur = 0;
+static int8_t   loudness_rate_idx = -1;
+static uint32_t loudness_fade_cnt = 0;
+static uint32_t loudness_fade_pos = 0;
+static uint32_t loudness_fade_settle = 0;
+static uint32_t loudness_fade_len = 0;                // 0 : 페이드 중이 아님, settle 포함
+
+// 코덱 보정(0.5dB 단위)은 처리에서 목표를 정하고 스레드에서 블록마다 한 단계씩 옮긴다.
+//
+static volatile uint8_t loudness_trim_req = 0;        // 목표 = loudness_makeup[loudness_step]
+static volatile bool    loudness_trim_step = false;   // 처리 인터럽트가 블록마다 세운다.
+static volatile uint8_t loudness_trim_set = 0;        // 코덱에 쓴 값
+static volatile uint8_t loudness_trim = 0;            // 실제로 더해진 값 (0dB 에서 잘린 만큼 제외)
+
+static loudness_state_t loudness_state;
+static loudness_state_t loudness_state_new;
+
+
+
+
+bool loudnessInit(void)
+{
+  i2sStageAdd("loudness", loudnessProcess, NULL);
+  i2sStageEnable("loudness", false);
+
+  is_init = true;
+  loudnessSetVolume(i2sGetVolume());
+  loudnessLoad();
+
+#if CLI_USE(HW_LOUDNESS)
+  cliAdd("loudness", cliLoudness);
+#endif
+  return true;
+}
+
+void loudnessLoad(void)
+{
+  uint8_t data[2] = {0, };
+
+  #ifdef _USE_HW_EEPROM
+  eepromRead(HW_EEPROM_ADDR_LOUDNESS, data, 2);
+  #endif
+  loudnessSetEnable(data[0] == LOUDNESS_MAGIC && data[1] == 1, false);
+}
+
+bool loudnessSetEnable(bool enable, bool save)
+{
+  loudness_enable = enable;
+  loudnessUpdateStep();
+
+  // 끌 때는 0 단계(평탄)로 페이드한 후 처리에서 스테이지를 끈다.
+  //
+  if (enable == true)
+  {
+    i2sStageEnable("loudness", true);
+  }
+
+  #ifdef _USE_HW_EEPROM
+  if (save == true)
+  {
+    uint8_t data[2];
+
+    data[0] = LOUDNESS_MAGIC;
+    data[1] = enable ? 1:0;
+    eepromWriteAsync(HW_EEPROM_ADDR_LOUDNESS, data, 2);
+  }
+  #endif
+  return true;
+}
+
+bool loudnessIsEnable(void)
+{
+  return loudness_enable;
+}
+
+// i2sSetVolume() 에서 호출한다. 계수는 테이블에서 고르기만 한다.
+//
+bool loudnessSetVolume(int16_t volume)
+{
+  if (is_init != true)
+  {
+    return false;
+  }
+  loudness_volume = constrain(volume, 0, LOUDNESS_STEP_MAX - 1);
+  loudness_trim   = es8156GetVolumeTrim();
+  loudnessUpdateStep();
+
+  return true;
+}
+
+void loudnessUpdateStep(void)
+{
+  loudness_step_req = loudness_enable ? loudness_volume : 0;
+}
+
+// 디지털로 미리 줄인 만큼 코덱 볼륨을 올려서 1kHz 레벨은 그대로 둔다.
+// 코덱이 아직 다 올리지 못한 만큼은 처리에서 디지털로 채우므로, 한 번에 0.5dB 씩만 옮긴다.
+//
+void loudnessUpdate(void)
+{
+  uint8_t trim;
+
+
+  if (is_init != true || loudness_trim_step != true)
+  {
+    return;
+  }
+  loudness_trim_step = false;
+
+  trim = loudness_trim_set;
+  if (trim < loudness_trim_req)
+  {
+    trim++;
+  }
+  else if (trim > loudness_trim_req)
+  {
+    trim--;
+  }
+  else
+  {
+    return;
+  }
+  es8156SetVolumeTrim(trim);
+  loudness_trim_set = trim;
+  loudness_trim     = es8156GetVolumeTrim();
+}
+
+static inline void loudnessSetTrimReq(uint8_t trim)
+{
+  if (trim != loudness_trim_set)
+  {
+    loudness_trim_req  = trim;
+    loudness_trim_step = true;
+    eventPost(EVENT_AUDIO_CTRL);
+  }
+}
+
+// makeup - trim (0.5dB 단위) 만큼의 디지털 이득
+//
+static inline float loudnessTrimGain(int32_t diff)
+{
+  return diff == 0 ? 1.0f : powf(10.0f, (float)diff * 0.025f);
+}
+
+static inline void loudnessGain(int32_t *p_buf, uint32_t frames, float gain)
+{
+  for (uint32_t i=0; i<frames*2; i++)
+  {
+    p_buf[i] = (int32_t)((float)p_buf[i] * gain);
+  }
+}
+
+static inline float loudnessBiquad(float (*p_s)[4], const float (*p_coef)[5], float x)
+{
+  for (int b=0; b<LOUDNESS_BIQUAD_MAX; b++)
+  {
+    const float *c = p_coef[b];
+    float *s = p_s[b];
+    float y;
+
+    y = c[0] * x + c[1] * s[0] + c[2] * s[1] - c[3] * s[2] - c[4] * s[3];
+    s[1] = s[0];
+    s[0] = x;
+    s[3] = s[2];
+    s[2] = y;
+    x = y;
+  }
+  return x;
+}
+
+__RAMFUNC void loudnessProcess(int32_t *p_buf, uint32_t frames, void *arg)
+{
+  const float (*p_coef)[5];
+  const float (*p_coef_new)[5];
+  uint32_t rate = i2sGetSampleRate();
+  uint8_t  step = loudness_step_req;
+  int32_t  trim = loudness_trim;
+  uint32_t pos;
+  float gain;
+  float gain_new;
+  float mix;
+  float mix_inc;
+
+
+  if (rate != loudness_rate_cur)
+  {
+    loudness_rate_idx = -1;
+    for (int r=0; r<LOUDNESS_RATE_MAX; r++)
+    {
+      if (loudness_rate[r] == rate)
+      {
+        loudness_rate_idx = r;
+        break;
+      }
+    }
+    loudness_rate_cur = rate;
+    loudness_step     = 0;
+    loudness_fade_len = 0;
+    memset(&loudness_state, 0, sizeof(loudness_state));
+  }
+  if (loudness_rate_idx < 0)
+  {
+    // 필터 없이 통과하고 코덱 보정은 0 으로 되돌린다.
+    //
+    loudnessSetTrimReq(0);
+    gain = loudnessTrimGain(-trim);
+    if (gain != 1.0f)
+    {
+      loudnessGain(p_buf, frames, gain);
+    }
+    else if (step == 0 && loudness_enable != true && loudness_trim_set == 0)
+    {
+      i2sStageEnable("loudness", false);
+    }
+    return;
+  }
+  p_coef = loudness_coef[loudness_rate_idx][loudness_step];
+  gain   = loudnessTrimGain(loudness_makeup[loudness_step] - trim);
+
+  // 새 필터는 0 상태에서 자기 계수로 돌기 시작하고, 시작 과도 응답이 사라진 후에 섞는다.
+  // 페이드 중에 들어온 요청은 페이드가 끝난 다음 블록에서 시작한다.
+  //
+  if (loudness_fade_len == 0 && step != loudness_step)
+  {
+    loudness_step_new    = step;
+    loudness_fade_pos    = 0;
+    loudness_fade_settle = rate * LOUDNESS_SETTLE_MS / 1000;
+    loudness_fade_len    = loudness_fade_settle + rate * LOUDNESS_FADE_MS / 1000;
+    memset(&loudness_state_new, 0, sizeof(loudness_state_new));
+  }
+
+  if (loudness_fade_len == 0)
+  {
+    // 꺼질 때는 평탄한 0 단계에서 코덱 보정까지 0 으로 돌아온 후에 스테이지를 끈다.
+    //
+    loudnessSetTrimReq(loudness_makeup[loudness_step]);
+    if (step == 0 && loudness_enable != true && trim == 0 && loudness_trim_set == 0)
+    {
+      i2sStageEnable("loudness", false);
+      return;
+    }
+
+    for (uint32_t i=0; i<frames; i++)
+    {
+      for (int ch=0; ch<2; ch++)
+      {
+        float x = (float)p_buf[ch] * LOUDNESS_Q31_TO_F;
+
+        p_buf[ch] = (int32_t)(loudnessBiquad(loudness_state.s[ch], p_coef, x) * gain * LOUDNESS_F_TO_Q31);
+      }
+      p_buf += 2;
+    }
+    return;
+  }
+
+  // 이전/새 필터를 각자의 상태로 같이 돌리고 LOUDNESS_FADE_MS 동안 선형으로 섞는다.
+  // 코덱 보정은 페이드 동안 그대로 두고, 새 단계의 makeup 차이는 디지털로 맞춘다.
+  //
+  p_coef_new = loudness_coef[loudness_rate_idx][loudness_step_new];
+  gain_new   = loudnessTrimGain(loudness_makeup[loudness_step_new] - trim);
+  pos        = loudness_fade_pos;
+  mix_inc    = 1.0f / (float)(loudness_fade_len - loudness_fade_settle);
+
+  for (uint32_t i=0; i<frames; i++)
+  {
+    pos++;
+    if (pos <= loudness_fade_settle)
+    {
+      mix = 0.0f;
+    }
+    else if (pos < loudness_fade_len)
+    {
+      mix = (float)(pos - loudness_fade_settle) * mix_inc;
+    }
+    else
+    {
+      mix = 1.0f;
+    }
+
+    for (int ch=0; ch<2; ch++)
+    {
+      float x = (float)p_buf[ch] * LOUDNESS_Q31_TO_F;
+      float y_old;
+      float y_new;
+
+      y_old = loudnessBiquad(loudness_state.s[ch], p_coef, x) * gain;
+      y_new = loudnessBiquad(loudness_state_new.s[ch], p_coef_new, x) * gain_new;
+      p_buf[ch] = (int32_t)((y_old + (y_new - y_old) * mix) * LOUDNESS_F_TO_Q31);
+    }
+    p_buf += 2;
+  }
+
+  // 다 섞였으면 새 필터가 이어서 돈다.
+  //
+  loudness_fade_pos = pos;
+  if (loudness_fade_pos >= loudness_fade_len)
+  {
+    memcpy(&loudness_state, &loudness_state_new, sizeof(loudness_state));
+    loudness_step     = loudness_step_new;
+    loudness_fade_len = 0;
+    loudness_fade_cnt++;
+  }
+}
+
+
+#if CLI_USE(HW_LOUDNESS)
+void cliLoudness(cli_args_t *args)
+{
+  bool ret = false;
+
+
+  if (args->argc == 1 && args->isStr(0, "info"))
+  {
+    uint8_t step = loudness_step_req;
+
+    cliPrintf("enable : %s\n", loudness_enable ? "on":"off");
+    cliPrintf("volume : %d\n", loudness_volume);
+    cliPrintf("rate   : %d Hz%s\n", loudness_rate_cur, loudness_rate_idx < 0 ? " (bypass)":"");
+    cliPrintf("bass   : +%d.%d dB\n", loudness_gain[step][0]/10, loudness_gain[step][0]%10);
+    cliPrintf("treble : +%d.%d dB\n", loudness_gain[step][1]/10, loudness_gain[step][1]%10);
+    cliPrintf("makeup : %d.%d dB\n", loudness_makeup[step]/2, (loudness_makeup[step]%2) * 5);
+    cliPrintf("trim   : %d.%d dB\n", loudness_trim/2, (loudness_trim%2) * 5);
+    cliPrintf("fade   : %d\n", loudness_fade_cnt);
+    ret = true;
+  }
+
+  if (args->argc >= 1 && (args->isStr(0, "on") || args->isStr(0, "off")))
+  {
+    loudnessSetEnable(args->isStr(0, "on"), args->argc == 2 && args->isStr(1, "save"));
+    ret = true;
+  }
+
+  if (ret == false)
+  {
+    cliPrintf("loudness info\n");
+    cliPrintf("loudness on:off [save]\n");
+  }
+}
+#endif
+
+#endif
@@ -0,0 +1,881 @@
+// tools/loudness_coef.py 로 생성된 파일, 직접 수정하지 않는다.
+//
+#include "loudness.h"
+
+
+#ifdef _USE_HW_LOUDNESS
+
+const uint32_t loudness_rate[LOUDNESS_RATE_MAX] =
+{
+  96000, 48000, 44100, 32000, 22050, 16000, 11025, 8000,
+};
+
+// 0.5dB 단위 코덱 레지스터 보정
+//
+const uint8_t loudness_makeup[LOUDNESS_STEP_MAX] =
+{
+  0, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+  30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+  30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+  30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+  29, 28, 27, 27, 26, 25, 25, 24, 23, 22, 21, 20, 20, 19, 18, 17,
+  17, 16, 15, 14, 13, 12, 12, 11, 10, 9, 9, 8, 7, 6, 5, 4,
+  4, 3, 2, 1, 0,
+};
+
+// 0.1dB 단위 low/high shelf 이득
+//
+const int16_t loudness_gain[LOUDNESS_STEP_MAX][LOUDNESS_BIQUAD_MAX] =
+{
+  {0, 0}, {150, 58}, {150, 58}, {150, 58}, {150, 58}, {150, 58}, {150, 58}, {150, 58},
+  {150, 58}, {150, 58}, {150, 58}, {150, 58}, {150, 58}, {150, 58}, {150, 58}, {150, 58},
+  {150, 58}, {150, 58}, {150, 58}, {150, 58}, {150, 58}, {150, 58}, {150, 58}, {150, 58},
+  {150, 58}, {150, 58}, {150, 58}, {150, 58}, {150, 58}, {150, 58}, {150, 58}, {150, 58},
+  {150, 58}, {150, 58}, {150, 58}, {150, 58}, {150, 58}, {150, 58}, {150, 58}, {150, 58},
+  {150, 60}, {150, 60}, {150, 60}, {150, 60}, {150, 60}, {150, 58}, {150, 58}, {150, 58},
+  {150, 58}, {150, 58}, {150, 58}, {150, 55}, {150, 55}, {150, 55}, {150, 55}, {150, 52},
+  {150, 52}, {150, 52}, {150, 50}, {150, 50}, {150, 50}, {150, 48}, {150, 48}, {148, 45},
+  {145, 45}, {140, 45}, {135, 42}, {132, 42}, {130, 42}, {125, 40}, {122, 40}, {118, 38},
+  {112, 38}, {110, 35}, {105, 35}, {100, 32}, {98, 32}, {92, 30}, {90, 30}, {85, 28},
+  {82, 28}, {78, 25}, {72, 25}, {70, 22}, {65, 22}, {60, 20}, {58, 20}, {52, 18},
+  {48, 15}, {45, 15}, {42, 15}, {38, 12}, {32, 12}, {30, 10}, {25, 8}, {20, 8},
+  {18, 5}, {12, 5}, {8, 2}, {5, 2}, {0, 0},
+};
+
+const float loudness_coef[LOUDNESS_RATE_MAX][LOUDNESS_STEP_MAX][LOUDNESS_BIQUAD_MAX][5] =
+{
+  // 96000 Hz
+  {
+    {{1.000000000e+00f, -1.981488509e+00f, 9.816582826e-01f, -1.981488509e+00f, 9.816582826e-01f}, {1.000000000e+00f, -1.193913368e+00f, 4.359073982e-01f, -1.193913368e+00f, 4.359073982e-01f}},  // 0
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 1
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 2
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 3
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 4
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 5
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 6
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 7
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 8
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 9
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 10
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 11
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 12
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 13
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 14
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 15
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 16
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 17
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 18
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 19
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 20
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 21
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 22
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 23
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 24
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 25
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 26
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 27
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 28
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 29
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 30
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 31
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 32
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 33
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 34
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 35
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 36
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 37
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 38
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 39
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.735191861e+00f, -2.274949554e+00f, 8.568135885e-01f, -1.061099909e+00f, 3.781558050e-01f}},  // 40
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.735191861e+00f, -2.274949554e+00f, 8.568135885e-01f, -1.061099909e+00f, 3.781558050e-01f}},  // 41
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.735191861e+00f, -2.274949554e+00f, 8.568135885e-01f, -1.061099909e+00f, 3.781558050e-01f}},  // 42
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.735191861e+00f, -2.274949554e+00f, 8.568135885e-01f, -1.061099909e+00f, 3.781558050e-01f}},  // 43
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.735191861e+00f, -2.274949554e+00f, 8.568135885e-01f, -1.061099909e+00f, 3.781558050e-01f}},  // 44
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 45
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 46
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 47
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 48
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 49
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.695859979e+00f, -2.215620272e+00f, 8.333402448e-01f, -1.066951814e+00f, 3.805317666e-01f}},  // 50
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.657412200e+00f, -2.157759075e+00f, 8.104824771e-01f, -1.072776010e+00f, 3.829116116e-01f}},  // 51
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.657412200e+00f, -2.157759075e+00f, 8.104824771e-01f, -1.072776010e+00f, 3.829116116e-01f}},  // 52
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.657412200e+00f, -2.157759075e+00f, 8.104824771e-01f, -1.072776010e+00f, 3.829116116e-01f}},  // 53
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.657412200e+00f, -2.157759075e+00f, 8.104824771e-01f, -1.072776010e+00f, 3.829116116e-01f}},  // 54
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.619829133e+00f, -2.101331478e+00f, 7.882250175e-01f, -1.078572492e+00f, 3.852951639e-01f}},  // 55
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.619829133e+00f, -2.101331478e+00f, 7.882250175e-01f, -1.078572492e+00f, 3.852951639e-01f}},  // 56
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.619829133e+00f, -2.101331478e+00f, 7.882250175e-01f, -1.078572492e+00f, 3.852951639e-01f}},  // 57
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.583091796e+00f, -2.046303758e+00f, 7.665529515e-01f, -1.084341259e+00f, 3.876822488e-01f}},  // 58
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.583091796e+00f, -2.046303758e+00f, 7.665529515e-01f, -1.084341259e+00f, 3.876822488e-01f}},  // 59
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.583091796e+00f, -2.046303758e+00f, 7.665529515e-01f, -1.084341259e+00f, 3.876822488e-01f}},  // 60
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.547181606e+00f, -1.992642938e+00f, 7.454517110e-01f, -1.090082313e+00f, 3.900726925e-01f}},  // 61
+    {{1.792997568e-01f, -3.534886295e-01f, 1.742606983e-01f, -1.987978683e+00f, 9.880505091e-01f}, {1.547181606e+00f, -1.992642938e+00f, 7.454517110e-01f, -1.090082313e+00f, 3.900726925e-01f}},  // 62
+    {{1.792736541e-01f, -3.534737994e-01f, 1.742709415e-01f, -1.987891874e+00f, 9.879647379e-01f}, {1.512080371e+00f, -1.940316772e+00f, 7.249070668e-01f, -1.095795657e+00f, 3.924663227e-01f}},  // 63
+    {{1.898687202e-01f, -3.744026054e-01f, 1.846078018e-01f, -1.987804438e+00f, 9.878783549e-01f}, {1.512080371e+00f, -1.940316772e+00f, 7.249070668e-01f, -1.095795657e+00f, 3.924663227e-01f}},  // 64
+    {{2.010610102e-01f, -3.965534129e-01f, 1.955684709e-01f, -1.987627668e+00f, 9.877037360e-01f}, {1.512080371e+00f, -1.940316772e+00f, 7.249070668e-01f, -1.095795657e+00f, 3.924663227e-01f}},  // 65
+    {{2.129133958e-01f, -4.200141586e-01f, 2.071790453e-01f, -1.987448335e+00f, 9.875266176e-01f}, {1.477770282e+00f, -1.889293731e+00f, 7.049051212e-01f, -1.101481295e+00f, 3.948629680e-01f}},  // 66
+    {{2.128829109e-01f, -4.199956828e-01f, 2.071899323e-01f, -1.987357697e+00f, 9.874371101e-01f}, {1.477770282e+00f, -1.889293731e+00f, 7.049051212e-01f, -1.101481295e+00f, 3.948629680e-01f}},  // 67
+    {{2.254648142e-01f, -4.448622678e-01f, 2.194780145e-01f, -1.987266404e+00f, 9.873469645e-01f}, {1.477770282e+00f, -1.889293731e+00f, 7.049051212e-01f, -1.101481295e+00f, 3.948629680e-01f}},  // 68
+    {{2.387564994e-01f, -4.711797386e-01f, 2.325061449e-01f, -1.987081835e+00f, 9.871647407e-01f}, {1.444233909e+00f, -1.839542988e+00f, 6.854323008e-01f, -1.107139237e+00f, 3.972624583e-01f}},  // 69
+    {{2.387226612e-01f, -4.711583535e-01f, 2.325174096e-01f, -1.986988550e+00f, 9.870726535e-01f}, {1.444233909e+00f, -1.839542988e+00f, 6.854323008e-01f, -1.107139237e+00f, 3.972624583e-01f}},  // 70
+    {{2.527964565e-01f, -4.990304073e-01f, 2.463180464e-01f, -1.986799954e+00f, 9.868865056e-01f}, {1.411454186e+00f, -1.791034401e+00f, 6.664753502e-01f, -1.112769490e+00f, 3.996646249e-01f}},  // 71
+    {{2.677003202e-01f, -5.285505134e-01f, 2.609367362e-01f, -1.986608625e+00f, 9.866976954e-01f}, {1.411454186e+00f, -1.791034401e+00f, 6.664753502e-01f, -1.112769490e+00f, 3.996646249e-01f}},  // 72
+    {{2.835228411e-01f, -5.598426844e-01f, 2.764102001e-01f, -1.986511924e+00f, 9.866022803e-01f}, {1.379414413e+00f, -1.743738504e+00f, 6.480213244e-01f, -1.118372066e+00f, 4.020693001e-01f}},  // 73
+    {{3.002387712e-01f, -5.929588385e-01f, 2.928130535e-01f, -1.986316420e+00f, 9.864094062e-01f}, {1.379414413e+00f, -1.743738504e+00f, 6.480213244e-01f, -1.118372066e+00f, 4.020693001e-01f}},  // 74
+    {{3.179406123e-01f, -6.280329687e-01f, 3.101880483e-01f, -1.986118083e+00f, 9.862137750e-01f}, {1.348098242e+00f, -1.697626487e+00f, 6.300575825e-01f, -1.123946980e+00f, 4.044763176e-01f}},  // 75
+    {{3.178965438e-01f, -6.280021734e-01f, 3.101999495e-01f, -1.986017839e+00f, 9.861149134e-01f}, {1.348098242e+00f, -1.697626487e+00f, 6.300575825e-01f, -1.123946980e+00f, 4.044763176e-01f}},  // 76
+    {{3.366400308e-01f, -6.651476513e-01f, 3.286046848e-01f, -1.985815175e+00f, 9.859150736e-01f}, {1.317489671e+00f, -1.652670186e+00f, 6.125717810e-01f, -1.129494247e+00f, 4.068855125e-01f}},  // 77
+    {{3.565380652e-01f, -7.045247767e-01f, 3.480880529e-01f, -1.985712744e+00f, 9.858140854e-01f}, {1.317489671e+00f, -1.652670186e+00f, 6.125717810e-01f, -1.129494247e+00f, 4.068855125e-01f}},  // 78
+    {{3.775604702e-01f, -7.461947457e-01f, 3.687385654e-01f, -1.985505658e+00f, 9.856099478e-01f}, {1.287573040e+00f, -1.608842072e+00f, 5.955518677e-01f, -1.135013885e+00f, 4.092967208e-01f}},  // 79
+    {{3.775087146e-01f, -7.461564392e-01f, 3.687505190e-01f, -1.985400992e+00f, 9.855067882e-01f}, {1.287573040e+00f, -1.608842072e+00f, 5.955518677e-01f, -1.135013885e+00f, 4.092967208e-01f}},  // 80
+    {{3.997681627e-01f, -7.902869095e-01f, 3.906245317e-01f, -1.985189388e+00f, 9.852982617e-01f}, {1.258333022e+00f, -1.566115230e+00f, 5.789860748e-01f, -1.140505913e+00f, 4.117097803e-01f}},  // 81
+    {{4.233404831e-01f, -8.370260901e-01f, 4.137944691e-01f, -1.984974717e+00f, 9.850867578e-01f}, {1.258333022e+00f, -1.566115230e+00f, 5.789860748e-01f, -1.140505913e+00f, 4.117097803e-01f}},  // 82
+    {{4.483639972e-01f, -8.865757273e-01f, 4.383253889e-01f, -1.984866217e+00f, 9.849798763e-01f}, {1.229754617e+00f, -1.524463355e+00f, 5.628629130e-01f, -1.145970354e+00f, 4.141245297e-01f}},  // 83
+    {{4.748023337e-01f, -9.390073503e-01f, 4.643219816e-01f, -1.984646863e+00f, 9.847638278e-01f}, {1.229754617e+00f, -1.524463355e+00f, 5.628629130e-01f, -1.145970354e+00f, 4.141245297e-01f}},  // 84
+    {{5.028000019e-01f, -9.945381196e-01f, 4.918584847e-01f, -1.984424329e+00f, 9.845446961e-01f}, {1.201823145e+00f, -1.483860732e+00f, 5.471711658e-01f, -1.151407230e+00f, 4.165408092e-01f}},  // 85
+    {{5.027320735e-01f, -9.944830481e-01f, 4.918696151e-01f, -1.984311856e+00f, 9.844339607e-01f}, {1.201823145e+00f, -1.483860732e+00f, 5.471711658e-01f, -1.151407230e+00f, 4.165408092e-01f}},  // 86
+    {{5.323771946e-01f, -1.053291889e+00f, 5.210367849e-01f, -1.984084467e+00f, 9.842101231e-01f}, {1.174524239e+00f, -1.444282229e+00f, 5.318998829e-01f, -1.156816568e+00f, 4.189584604e-01f}},  // 87
+    {{5.637707579e-01f, -1.115576503e+00f, 5.519313864e-01f, -1.983853783e+00f, 9.839830932e-01f}, {1.147843841e+00f, -1.405703282e+00f, 5.170383746e-01f, -1.162198393e+00f, 4.213773261e-01f}},  // 88
+    {{5.970960307e-01f, -1.181610627e+00f, 5.846457733e-01f, -1.983737190e+00f, 9.838683672e-01f}, {1.147843841e+00f, -1.405703282e+00f, 5.170383746e-01f, -1.162198393e+00f, 4.213773261e-01f}},  // 89
+    {{5.970158710e-01f, -1.181542180e+00f, 5.846556047e-01f, -1.983619755e+00f, 9.837528262e-01f}, {1.147843841e+00f, -1.405703282e+00f, 5.170383746e-01f, -1.162198393e+00f, 4.213773261e-01f}},  // 90
+    {{6.322217191e-01f, -1.251406326e+00f, 6.193176622e-01f, -1.983382336e+00f, 9.835192767e-01f}, {1.121768191e+00f, -1.368099884e+00f, 5.025762062e-01f, -1.167552737e+00f, 4.237972506e-01f}},  // 91
+    {{6.695039230e-01f, -1.325399174e+00f, 6.560321747e-01f, -1.983141477e+00f, 9.832823987e-01f}, {1.121768191e+00f, -1.368099884e+00f, 5.025762062e-01f, -1.167552737e+00f, 4.237972506e-01f}},  // 92
+    {{7.090796857e-01f, -1.403849591e+00f, 6.949128608e-01f, -1.983019741e+00f, 9.831626971e-01f}, {1.096283829e+00f, -1.331448572e+00f, 4.885031925e-01f, -1.172879629e+00f, 4.262180794e-01f}},  // 93
+    {{7.508946036e-01f, -1.486852064e+00f, 7.361045728e-01f, -1.982773627e+00f, 9.829207389e-01f}, {1.071377581e+00f, -1.295726417e+00f, 4.748093919e-01f, -1.178179103e+00f, 4.286396595e-01f}},  // 94
+    {{7.951755955e-01f, -1.574759178e+00f, 7.797349712e-01f, -1.982523945e+00f, 9.826753345e-01f}, {1.071377581e+00f, -1.295726417e+00f, 4.748093919e-01f, -1.178179103e+00f, 4.286396595e-01f}},  // 95
+    {{7.950695301e-01f, -1.574660892e+00f, 7.797405785e-01f, -1.982397751e+00f, 9.825513250e-01f}, {1.047036556e+00f, -1.260911011e+00f, 4.614851013e-01f, -1.183451193e+00f, 4.310618393e-01f}},  // 96
+    {{8.419558221e-01f, -1.667754882e+00f, 8.259526142e-01f, -1.982142623e+00f, 9.823006610e-01f}, {1.047036556e+00f, -1.260911011e+00f, 4.614851013e-01f, -1.183451193e+00f, 4.310618393e-01f}},  // 97
+    {{8.916071832e-01f, -1.766349258e+00f, 8.749000921e-01f, -1.981883797e+00f, 9.820464291e-01f}, {1.023248143e+00f, -1.226980460e+00f, 4.485208508e-01f, -1.188695935e+00f, 4.334844685e-01f}},  // 98
+    {{9.443124180e-01f, -1.870890842e+00f, 9.267434022e-01f, -1.981752981e+00f, 9.819179598e-01f}, {1.023248143e+00f, -1.226980460e+00f, 4.485208508e-01f, -1.188695935e+00f, 4.334844685e-01f}},  // 99
+    {{1.000000000e+00f, -1.981488509e+00f, 9.816582826e-01f, -1.981488509e+00f, 9.816582826e-01f}, {1.000000000e+00f, -1.193913368e+00f, 4.359073982e-01f, -1.193913368e+00f, 4.359073982e-01f}},  // 100
+  },
+  // 48000 Hz
+  {
+    {{1.000000000e+00f, -1.962980089e+00f, 9.636529842e-01f, -1.962980089e+00f, 9.636529842e-01f}, {1.000000000e+00f, -4.629380253e-01f, 2.097153578e-01f, -4.629380253e-01f, 2.097153578e-01f}},  // 0
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 1
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 2
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 3
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 4
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 5
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 6
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 7
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 8
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 9
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 10
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 11
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 12
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 13
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 14
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 15
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 16
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 17
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 18
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 19
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 20
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 21
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 22
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 23
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 24
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 25
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 26
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 27
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 28
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 29
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 30
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 31
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 32
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 33
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 34
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 35
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 36
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 37
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 38
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 39
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.529673717e+00f, -9.911090088e-01f, 3.774992911e-01f, -2.682589736e-01f, 1.843229725e-01f}},  // 40
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.529673717e+00f, -9.911090088e-01f, 3.774992911e-01f, -2.682589736e-01f, 1.843229725e-01f}},  // 41
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.529673717e+00f, -9.911090088e-01f, 3.774992911e-01f, -2.682589736e-01f, 1.843229725e-01f}},  // 42
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.529673717e+00f, -9.911090088e-01f, 3.774992911e-01f, -2.682589736e-01f, 1.843229725e-01f}},  // 43
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.529673717e+00f, -9.911090088e-01f, 3.774992911e-01f, -2.682589736e-01f, 1.843229725e-01f}},  // 44
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 45
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 46
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 47
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 48
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 49
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.502853524e+00f, -9.625022736e-01f, 3.682539299e-01f, -2.765167622e-01f, 1.851219422e-01f}},  // 50
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.476499489e+00f, -9.345589734e-01f, 3.592398200e-01f, -2.847639642e-01f, 1.859442997e-01f}},  // 51
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.476499489e+00f, -9.345589734e-01f, 3.592398200e-01f, -2.847639642e-01f, 1.859442997e-01f}},  // 52
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.476499489e+00f, -9.345589734e-01f, 3.592398200e-01f, -2.847639642e-01f, 1.859442997e-01f}},  // 53
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.476499489e+00f, -9.345589734e-01f, 3.592398200e-01f, -2.847639642e-01f, 1.859442997e-01f}},  // 54
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.450603752e+00f, -9.072657185e-01f, 3.504516273e-01f, -2.930002798e-01f, 1.867899410e-01f}},  // 55
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.450603752e+00f, -9.072657185e-01f, 3.504516273e-01f, -2.930002798e-01f, 1.867899410e-01f}},  // 56
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.450603752e+00f, -9.072657185e-01f, 3.504516273e-01f, -2.930002798e-01f, 1.867899410e-01f}},  // 57
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.425158580e+00f, -8.806093580e-01f, 3.418841263e-01f, -3.012254110e-01f, 1.876587597e-01f}},  // 58
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.425158580e+00f, -8.806093580e-01f, 3.418841263e-01f, -3.012254110e-01f, 1.876587597e-01f}},  // 59
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.425158580e+00f, -8.806093580e-01f, 3.418841263e-01f, -3.012254110e-01f, 1.876587597e-01f}},  // 60
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.400156363e+00f, -8.545769755e-01f, 3.335321979e-01f, -3.094390615e-01f, 1.885506465e-01f}},  // 61
+    {{1.807834102e-01f, -3.512630672e-01f, 1.707652621e-01f, -1.975957622e+00f, 9.762432271e-01f}, {1.400156363e+00f, -8.545769755e-01f, 3.335321979e-01f, -3.094390615e-01f, 1.885506465e-01f}},  // 62
+    {{1.807307860e-01f, -3.512346151e-01f, 1.707853290e-01f, -1.975784024e+00f, 9.760737440e-01f}, {1.375589611e+00f, -8.291558861e-01f, 3.253908276e-01f, -3.176409371e-01f, 1.894654894e-01f}},  // 63
+    {{1.913841924e-01f, -3.720161748e-01f, 1.809258761e-01f, -1.975609173e+00f, 9.759030670e-01f}, {1.375589611e+00f, -8.291558861e-01f, 3.253908276e-01f, -3.176409371e-01f, 1.894654894e-01f}},  // 64
+    {{2.026072497e-01f, -3.939942808e-01f, 1.916894531e-01f, -1.975255676e+00f, 9.755580980e-01f}, {1.375589611e+00f, -8.291558861e-01f, 3.253908276e-01f, -3.176409371e-01f, 1.894654894e-01f}},  // 65
+    {{2.144891237e-01f, -4.172696155e-01f, 2.030916889e-01f, -1.974897057e+00f, 9.752082540e-01f}, {1.351450957e+00f, -8.043336323e-01f, 3.174551039e-01f, -3.258307454e-01f, 1.904031739e-01f}},  // 66
+    {{2.144277169e-01f, -4.172340186e-01f, 2.031130246e-01f, -1.974715804e+00f, 9.750314830e-01f}, {1.351450957e+00f, -8.043336323e-01f, 3.174551039e-01f, -3.258307454e-01f, 1.904031739e-01f}},  // 67
+    {{2.270685009e-01f, -4.419186626e-01f, 2.151703876e-01f, -1.974533242e+00f, 9.748534680e-01f}, {1.351450957e+00f, -8.043336323e-01f, 3.174551039e-01f, -3.258307454e-01f, 1.904031739e-01f}},  // 68
+    {{2.403863393e-01f, -4.680224094e-01f, 2.279655859e-01f, -1.974164156e+00f, 9.744936720e-01f}, {1.327733151e+00f, -7.800979806e-01f, 3.097202163e-01f, -3.340081960e-01f, 1.913635826e-01f}},  // 69
+    {{2.403182158e-01f, -4.679811048e-01f, 2.279876664e-01f, -1.973977613e+00f, 9.743118738e-01f}, {1.327733151e+00f, -7.800979806e-01f, 3.097202163e-01f, -3.340081960e-01f, 1.913635826e-01f}},  // 70
+    {{2.544142285e-01f, -4.956221259e-01f, 2.415420955e-01f, -1.973600477e+00f, 9.739444336e-01f}, {1.304429060e+00f, -7.564369178e-01f, 3.021814532e-01f, -3.421730004e-01f, 1.923465959e-01f}},  // 71
+    {{2.693377621e-01f, -5.248941657e-01f, 2.559002947e-01f, -1.973217877e+00f, 9.735718098e-01f}, {1.304429060e+00f, -7.564369178e-01f, 3.021814532e-01f, -3.421730004e-01f, 1.923465959e-01f}},  // 72
+    {{2.852171177e-01f, -5.559449381e-01f, 2.710868488e-01f, -1.973024503e+00f, 9.733835319e-01f}, {1.281531666e+00f, -7.333386478e-01f, 2.948342010e-01f, -3.503248724e-01f, 1.933520912e-01f}},  // 73
+    {{3.019486291e-01f, -5.887770201e-01f, 2.871978310e-01f, -1.972633559e+00f, 9.730029993e-01f}, {1.281531666e+00f, -7.333386478e-01f, 2.948342010e-01f, -3.503248724e-01f, 1.933520912e-01f}},  // 74
+    {{3.196624015e-01f, -6.235461163e-01f, 3.042638673e-01f, -1.972236951e+00f, 9.726171038e-01f}, {1.259034063e+00f, -7.107915880e-01f, 2.876739417e-01f, -3.584635276e-01f, 1.943799439e-01f}},  // 75
+    {{3.195738042e-01f, -6.234863272e-01f, 3.042872062e-01f, -1.972036498e+00f, 9.724221222e-01f}, {1.259034063e+00f, -7.107915880e-01f, 2.876739417e-01f, -3.584635276e-01f, 1.943799439e-01f}},  // 76
+    {{3.383226741e-01f, -6.603020091e-01f, 3.223648811e-01f, -1.971631240e+00f, 9.720280447e-01f}, {1.236929457e+00f, -6.887843657e-01f, 2.806962512e-01f, -3.665886840e-01f, 1.954300264e-01f}},  // 77
+    {{3.582707970e-01f, -6.993586395e-01f, 3.414903572e-01f, -1.971426415e+00f, 9.718289302e-01f}, {1.236929457e+00f, -6.887843657e-01f, 2.806962512e-01f, -3.665886840e-01f, 1.954300264e-01f}},  // 78
+    {{3.792911131e-01f, -7.406508955e-01f, 3.617739650e-01f, -1.971012320e+00f, 9.714265026e-01f}, {1.215211165e+00f, -6.673058154e-01f, 2.738967981e-01f, -3.747000616e-01f, 1.965022091e-01f}},  // 79
+    {{3.791871461e-01f, -7.405763361e-01f, 3.617974119e-01f, -1.970803028e+00f, 9.712231704e-01f}, {1.215211165e+00f, -6.673058154e-01f, 2.738967981e-01f, -3.747000616e-01f, 1.965022091e-01f}},  // 80
+    {{4.014357797e-01f, -7.842983957e-01f, 3.832826694e-01f, -1.970379902e+00f, 9.708122213e-01f}, {1.193872610e+00f, -6.463449747e-01f, 2.672713416e-01f, -3.827973826e-01f, 1.975963596e-01f}},  // 81
+    {{4.249905735e-01f, -8.305989818e-01f, 4.060406347e-01f, -1.969950647e+00f, 9.703954943e-01f}, {1.193872610e+00f, -6.463449747e-01f, 2.672713416e-01f, -3.827973826e-01f, 1.975963596e-01f}},  // 82
+    {{4.500504207e-01f, -8.797228804e-01f, 4.301237065e-01f, -1.969733693e+00f, 9.701849397e-01f}, {1.172907323e+00f, -6.258910816e-01f, 2.608157302e-01f, -3.908803714e-01f, 1.987123434e-01f}},  // 83
+    {{4.764588752e-01f, -9.316521313e-01f, 4.556575776e-01f, -1.969295077e+00f, 9.697593984e-01f}, {1.172907323e+00f, -6.258910816e-01f, 2.608157302e-01f, -3.908803714e-01f, 1.987123434e-01f}},  // 84
+    {{5.044176750e-01f, -9.866433789e-01f, 4.827034777e-01f, -1.968850107e+00f, 9.693278811e-01f}, {1.152308940e+00f, -6.059335711e-01f, 2.545258999e-01f, -3.989487550e-01f, 1.998500235e-01f}},  // 85
+    {{5.042814035e-01f, -9.865358255e-01f, 4.827253162e-01f, -1.968625211e+00f, 9.691098560e-01f}, {1.152308940e+00f, -6.059335711e-01f, 2.545258999e-01f, -3.989487550e-01f, 1.998500235e-01f}},  // 86
+    {{5.338738822e-01f, -1.044761227e+00f, 5.113718793e-01f, -1.968170539e+00f, 9.686692221e-01f}, {1.132071198e+00f, -5.864620721e-01f, 2.483978725e-01f, -4.070022623e-01f, 2.010092607e-01f}},  // 87
+    {{5.652035772e-01f, -1.106419237e+00f, 5.417142276e-01f, -1.967709281e+00f, 9.682224075e-01f}, {1.112187939e+00f, -5.674664043e-01f, 2.424277544e-01f, -4.150406249e-01f, 2.021899136e-01f}},  // 88
+    {{5.985331228e-01f, -1.171845833e+00f, 5.738332137e-01f, -1.967476153e+00f, 9.679966563e-01f}, {1.112187939e+00f, -5.674664043e-01f, 2.424277544e-01f, -4.150406249e-01f, 2.021899136e-01f}},  // 89
+    {{5.983724429e-01f, -1.171711942e+00f, 5.738525057e-01f, -1.967241342e+00f, 9.677693285e-01f}, {1.112187939e+00f, -5.674664043e-01f, 2.424277544e-01f, -4.150406249e-01f, 2.021899136e-01f}},  // 90
+    {{6.334884121e-01f, -1.240853308e+00f, 6.078927574e-01f, -1.966766626e+00f, 9.673099005e-01f}, {1.092653102e+00f, -5.489365750e-01f, 2.366117351e-01f, -4.230635765e-01f, 2.033918383e-01f}},  // 91
+    {{6.706657456e-01f, -1.314069874e+00f, 6.439472723e-01f, -1.966285033e+00f, 9.668440376e-01f}, {1.092653102e+00f, -5.489365750e-01f, 2.366117351e-01f, -4.230635765e-01f, 2.033918383e-01f}},  // 92
+    {{7.102152119e-01f, -1.391768080e+00f, 6.821199058e-01f, -1.966041628e+00f, 9.666086661e-01f}, {1.073460727e+00f, -5.308627764e-01f, 2.309460850e-01f, -4.310708534e-01f, 2.046148889e-01f}},  // 93
+    {{7.518961645e-01f, -1.473881253e+00f, 7.225685404e-01f, -1.965549536e+00f, 9.661329880e-01f}, {1.054604950e+00f, -5.132353820e-01f, 2.254271548e-01f, -4.390621942e-01f, 2.058589174e-01f}},  // 94
+    {{7.960237186e-01f, -1.560833213e+00f, 7.654098336e-01f, -1.965050317e+00f, 9.656506562e-01f}, {1.054604950e+00f, -5.132353820e-01f, 2.254271548e-01f, -4.390621942e-01f, 2.058589174e-01f}},  // 95
+    {{7.958113935e-01f, -1.560640544e+00f, 7.654208379e-01f, -1.964798002e+00f, 9.654069671e-01f}, {1.036080004e+00f, -4.960449443e-01f, 2.200513736e-01f, -4.470373403e-01f, 2.071237735e-01f}},  // 96
+    {{8.425167829e-01f, -1.652701494e+00f, 8.107935208e-01f, -1.964287900e+00f, 9.649144864e-01f}, {1.036080004e+00f, -4.960449443e-01f, 2.200513736e-01f, -4.470373403e-01f, 2.071237735e-01f}},  // 97
+    {{8.919635115e-01f, -1.750186310e+00f, 8.588492227e-01f, -1.963770409e+00f, 9.644151261e-01f}, {1.017880214e+00f, -4.792821917e-01f, 2.148152474e-01f, -4.549960352e-01f, 2.084093051e-01f}},  // 98
+    {{9.445639849e-01f, -1.853653604e+00f, 9.097435959e-01f, -1.963508861e+00f, 9.641628373e-01f}, {1.017880214e+00f, -4.792821917e-01f, 2.148152474e-01f, -4.549960352e-01f, 2.084093051e-01f}},  // 99
+    {{1.000000000e+00f, -1.962980089e+00f, 9.636529842e-01f, -1.962980089e+00f, 9.636529842e-01f}, {1.000000000e+00f, -4.629380253e-01f, 2.097153578e-01f, -4.629380253e-01f, 2.097153578e-01f}},  // 100
+  },
+  // 44100 Hz
+  {
+    {{1.000000000e+00f, -1.959707034e+00f, 9.605029194e-01f, -1.959707034e+00f, 9.605029194e-01f}, {1.000000000e+00f, -3.391511849e-01f, 1.919799727e-01f, -3.391511849e-01f, 1.919799727e-01f}},  // 0
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 1
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 2
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 3
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 4
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 5
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 6
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 7
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 8
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 9
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 10
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 11
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 12
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 13
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 14
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 15
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 16
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 17
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 18
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 19
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 20
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 21
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 22
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 23
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 24
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 25
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 26
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 27
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 28
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 29
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 30
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 31
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 32
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 33
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 34
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 35
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 36
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 37
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 38
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 39
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.497422705e+00f, -7.947493053e-01f, 3.321513376e-01f, -1.402263109e-01f, 1.750510479e-01f}},  // 40
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.497422705e+00f, -7.947493053e-01f, 3.321513376e-01f, -1.402263109e-01f, 1.750510479e-01f}},  // 41
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.497422705e+00f, -7.947493053e-01f, 3.321513376e-01f, -1.402263109e-01f, 1.750510479e-01f}},  // 42
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.497422705e+00f, -7.947493053e-01f, 3.321513376e-01f, -1.402263109e-01f, 1.750510479e-01f}},  // 43
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.497422705e+00f, -7.947493053e-01f, 3.321513376e-01f, -1.402263109e-01f, 1.750510479e-01f}},  // 44
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 45
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 46
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 47
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 48
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 49
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.472466945e+00f, -7.700370714e-01f, 3.244417415e-01f, -1.486079516e-01f, 1.754795669e-01f}},  // 50
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.447924063e+00f, -7.458990352e-01f, 3.169238722e-01f, -1.569838049e-01f, 1.759327053e-01f}},  // 51
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.447924063e+00f, -7.458990352e-01f, 3.169238722e-01f, -1.569838049e-01f, 1.759327053e-01f}},  // 52
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.447924063e+00f, -7.458990352e-01f, 3.169238722e-01f, -1.569838049e-01f, 1.759327053e-01f}},  // 53
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.447924063e+00f, -7.458990352e-01f, 3.169238722e-01f, -1.569838049e-01f, 1.759327053e-01f}},  // 54
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.423787405e+00f, -7.223238633e-01f, 3.095933130e-01f, -1.653535494e-01f, 1.764104045e-01f}},  // 55
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.423787405e+00f, -7.223238633e-01f, 3.095933130e-01f, -1.653535494e-01f, 1.764104045e-01f}},  // 56
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.423787405e+00f, -7.223238633e-01f, 3.095933130e-01f, -1.653535494e-01f, 1.764104045e-01f}},  // 57
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.400050420e+00f, -6.993004177e-01f, 3.024457357e-01f, -1.737168649e-01f, 1.769126030e-01f}},  // 58
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.400050420e+00f, -6.993004177e-01f, 3.024457357e-01f, -1.737168649e-01f, 1.769126030e-01f}},  // 59
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.400050420e+00f, -6.993004177e-01f, 3.024457357e-01f, -1.737168649e-01f, 1.769126030e-01f}},  // 60
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.376706657e+00f, -6.768177526e-01f, 2.954768996e-01f, -1.820734322e-01f, 1.774392362e-01f}},  // 61
+    {{1.810470391e-01f, -3.508634424e-01f, 1.701544048e-01f, -1.973831492e+00f, 9.741694936e-01f}, {1.376706657e+00f, -6.768177526e-01f, 2.954768996e-01f, -1.820734322e-01f, 1.774392362e-01f}},  // 62
+    {{1.809896808e-01f, -3.508327060e-01f, 1.701761658e-01f, -1.973642548e+00f, 9.739854160e-01f}, {1.353749766e+00f, -6.548651120e-01f, 2.886826495e-01f, -1.904229331e-01f, 1.779902363e-01f}},  // 63
+    {{1.916534304e-01f, -3.715880059e-01f, 1.802823808e-01f, -1.973452239e+00f, 9.738000445e-01f}, {1.353749766e+00f, -6.548651120e-01f, 2.886826495e-01f, -1.904229331e-01f, 1.779902363e-01f}},  // 64
+    {{2.028819083e-01f, -3.935354793e-01f, 1.910114636e-01f, -1.973067492e+00f, 9.734253844e-01f}, {1.353749766e+00f, -6.548651120e-01f, 2.886826495e-01f, -1.904229331e-01f, 1.779902363e-01f}},  // 65
+    {{2.147689742e-01f, -4.167779391e-01f, 2.023772362e-01f, -1.972677170e+00f, 9.730454417e-01f}, {1.331173493e+00f, -6.334319265e-01f, 2.820589149e-01f, -1.987650509e-01f, 1.785655325e-01f}},  // 66
+    {{2.147020531e-01f, -4.167394541e-01f, 2.024003746e-01f, -1.972479894e+00f, 9.728534669e-01f}, {1.331173493e+00f, -6.334319265e-01f, 2.820589149e-01f, -1.987650509e-01f, 1.785655325e-01f}},  // 67
+    {{2.273532702e-01f, -4.413917033e-01f, 2.144173830e-01f, -1.972281194e+00f, 9.726601443e-01f}, {1.331173493e+00f, -6.334319265e-01f, 2.820589149e-01f, -1.987650509e-01f, 1.785655325e-01f}},  // 68
+    {{2.406757054e-01f, -4.674575811e-01f, 2.271718129e-01f, -1.971879482e+00f, 9.722694189e-01f}, {1.308971684e+00f, -6.125078105e-01f, 2.756017077e-01f, -2.070994699e-01f, 1.791650510e-01f}},  // 69
+    {{2.406014717e-01f, -4.674129050e-01f, 2.271957600e-01f, -1.971676448e+00f, 9.720719975e-01f}, {1.308971684e+00f, -6.125078105e-01f, 2.756017077e-01f, -2.070994699e-01f, 1.791650510e-01f}},  // 70
+    {{2.547013819e-01f, -4.950130104e-01f, 2.407070966e-01f, -1.971265975e+00f, 9.716729908e-01f}, {1.287138277e+00f, -5.920825593e-01f, 2.693071216e-01f, -2.154258758e-01f, 1.797887150e-01f}},  // 71
+    {{2.696283598e-01f, -5.242411319e-01f, 2.550197032e-01f, -1.970849555e+00f, 9.712683690e-01f}, {1.287138277e+00f, -5.920825593e-01f, 2.693071216e-01f, -2.154258758e-01f, 1.797887150e-01f}},  // 72
+    {{2.855177777e-01f, -5.552490053e-01f, 2.701560674e-01f, -1.970639089e+00f, 9.710639285e-01f}, {1.265667306e+00f, -5.721461467e-01f, 2.631713302e-01f, -2.237439556e-01f, 1.804364447e-01f}},  // 73
+    {{3.022520052e-01f, -5.880308173e-01f, 2.862159644e-01f, -1.970213588e+00f, 9.706507402e-01f}, {1.265667306e+00f, -5.721461467e-01f, 2.631713302e-01f, -2.237439556e-01f, 1.804364447e-01f}},  // 74
+    {{3.199678454e-01f, -6.227459498e-01f, 3.032279247e-01f, -1.969781923e+00f, 9.702317436e-01f}, {1.244552895e+00f, -5.526887217e-01f, 2.571905859e-01f, -2.320533977e-01f, 1.811081573e-01f}},  // 75
+    {{3.198713250e-01f, -6.226812188e-01f, 3.032532386e-01f, -1.969563752e+00f, 9.700200426e-01f}, {1.244552895e+00f, -5.526887217e-01f, 2.571905859e-01f, -2.320533977e-01f, 1.811081573e-01f}},  // 76
+    {{3.386211020e-01f, -6.594385812e-01f, 3.212736694e-01f, -1.969122674e+00f, 9.695921853e-01f}, {1.223789263e+00f, -5.337006065e-01f, 2.513612182e-01f, -2.403538921e-01f, 1.818037672e-01f}},  // 77
+    {{3.585780840e-01f, -6.984383522e-01f, 3.403365318e-01f, -1.968899745e+00f, 9.693760089e-01f}, {1.223789263e+00f, -5.337006065e-01f, 2.513612182e-01f, -2.403538921e-01f, 1.818037672e-01f}},  // 78
+    {{3.795979808e-01f, -7.396638425e-01f, 3.605559221e-01f, -1.968449049e+00f, 9.689391097e-01f}, {1.203370716e+00f, -5.151722930e-01f, 2.456796328e-01f, -2.486451299e-01f, 1.825231857e-01f}},  // 79
+    {{3.794847324e-01f, -7.395830832e-01f, 3.605813542e-01f, -1.968221259e+00f, 9.687183665e-01f}, {1.203370716e+00f, -5.151722930e-01f, 2.456796328e-01f, -2.486451299e-01f, 1.825231857e-01f}},  // 80
+    {{4.017314016e-01f, -7.832329794e-01f, 3.819985706e-01f, -1.967760736e+00f, 9.682722411e-01f}, {1.183291648e+00f, -4.970944411e-01f, 2.401423098e-01f, -2.569268042e-01f, 1.832663212e-01f}},  // 81
+    {{4.252830422e-01f, -8.294560884e-01f, 4.046844319e-01f, -1.967293542e+00f, 9.678198606e-01f}, {1.183291648e+00f, -4.970944411e-01f, 2.401423098e-01f, -2.569268042e-01f, 1.832663212e-01f}},  // 82
+    {{4.503493056e-01f, -8.785045681e-01f, 4.286891469e-01f, -1.967057414e+00f, 9.675912983e-01f}, {1.163546543e+00f, -4.794578755e-01f, 2.347458028e-01f, -2.651986095e-01f, 1.840330795e-01f}},  // 83
+    {{4.767524178e-01f, -9.303451083e-01f, 4.541420335e-01f, -1.966580033e+00f, 9.671293764e-01f}, {1.163546543e+00f, -4.794578755e-01f, 2.347458028e-01f, -2.651986095e-01f, 1.840330795e-01f}},  // 84
+    {{5.047042849e-01f, -9.852411081e-01f, 4.811020705e-01f, -1.966095739e+00f, 9.666609860e-01f}, {1.144129967e+00f, -4.622535832e-01f, 2.294867374e-01f, -2.734602418e-01f, 1.848233632e-01f}},  // 85
+    {{5.045558832e-01f, -9.851245398e-01f, 4.811257593e-01f, -1.965850968e+00f, 9.664243380e-01f}, {1.144129967e+00f, -4.622535832e-01f, 2.294867374e-01f, -2.734602418e-01f, 1.848233632e-01f}},  // 86
+    {{5.341389941e-01f, -1.043246976e+00f, 5.096812106e-01f, -1.965356114e+00f, 9.659460811e-01f}, {1.125036575e+00f, -4.454727114e-01f, 2.243618100e-01f, -2.817113989e-01f, 1.856370725e-01f}},  // 87
+    {{5.654573361e-01f, -1.104794428e+00f, 5.399269106e-01f, -1.964854094e+00f, 9.654611357e-01f}, {1.106261102e+00f, -4.291065644e-01f, 2.193677864e-01f, -2.899517804e-01f, 1.864741044e-01f}},  // 88
+    {{5.987876185e-01f, -1.170113576e+00f, 5.719417202e-01f, -1.964600364e+00f, 9.652161268e-01f}, {1.106261102e+00f, -4.291065644e-01f, 2.193677864e-01f, -2.899517804e-01f, 1.864741044e-01f}},  // 89
+    {{5.986126604e-01f, -1.169968420e+00f, 5.719626472e-01f, -1.964344803e+00f, 9.649694119e-01f}, {1.106261102e+00f, -4.291065644e-01f, 2.193677864e-01f, -2.899517804e-01f, 1.864741044e-01f}},  // 90
+    {{6.337126790e-01f, -1.238982315e+00f, 6.058940834e-01f, -1.963828137e+00f, 9.644708187e-01f}, {1.087798367e+00f, -4.131466018e-01f, 2.145015011e-01f, -2.981810876e-01f, 1.873343535e-01f}},  // 91
+    {{6.708714130e-01f, -1.312062002e+00f, 6.418331024e-01f, -1.963303989e+00f, 9.639652639e-01f}, {1.087798367e+00f, -4.131466018e-01f, 2.145015011e-01f, -2.981810876e-01f, 1.873343535e-01f}},  // 92
+    {{7.104162086e-01f, -1.389627287e+00f, 6.798818500e-01f, -1.963039075e+00f, 9.637098468e-01f}, {1.069643268e+00f, -3.975844356e-01f, 2.097598551e-01f, -3.063990237e-01f, 1.882177114e-01f}},  // 93
+    {{7.520734206e-01f, -1.471583703e+00f, 7.202004557e-01f, -1.962503501e+00f, 9.631936744e-01f}, {1.051790786e+00f, -3.824118281e-01f, 2.051398157e-01f, -3.146052935e-01f, 1.891240673e-01f}},  // 94
+    {{7.961737958e-01f, -1.558367332e+00f, 7.629036702e-01f, -1.961960171e+00f, 9.626703051e-01f}, {1.051790786e+00f, -3.824118281e-01f, 2.051398157e-01f, -3.146052935e-01f, 1.891240673e-01f}},  // 95
+    {{7.959426575e-01f, -1.558158374e+00f, 7.629156071e-01f, -1.961685563e+00f, 9.624058916e-01f}, {1.034235978e+00f, -3.676206895e-01f, 2.006384148e-01f, -3.227996041e-01f, 1.900533073e-01f}},  // 96
+    {{8.426160228e-01f, -1.650037321e+00f, 8.081414263e-01f, -1.961130390e+00f, 9.618715464e-01f}, {1.034235978e+00f, -3.676206895e-01f, 2.006384148e-01f, -3.227996041e-01f, 1.900533073e-01f}},  // 97
+    {{8.920265399e-01f, -1.747326690e+00f, 8.560410975e-01f, -1.960567178e+00f, 9.613297619e-01f}, {1.016973979e+00f, -3.532030754e-01f, 1.962527478e-01f, -3.309816643e-01f, 1.910053154e-01f}},  // 98
+    {{9.446084793e-01f, -1.850604400e+00f, 9.067694480e-01f, -1.960282522e+00f, 9.610560490e-01f}, {1.016973979e+00f, -3.532030754e-01f, 1.962527478e-01f, -3.309816643e-01f, 1.910053154e-01f}},  // 99
+    {{1.000000000e+00f, -1.959707034e+00f, 9.605029194e-01f, -1.959707034e+00f, 9.605029194e-01f}, {1.000000000e+00f, -3.391511849e-01f, 1.919799727e-01f, -3.391511849e-01f, 1.919799727e-01f}},  // 100
+  },
+  // 32000 Hz
+  {
+    {{1.000000000e+00f, -1.944477658e+00f, 9.459779362e-01f, -1.944477658e+00f, 9.459779362e-01f}, {1.000000000e+00f, 2.303962527e-01f, 1.809722302e-01f, 2.303962527e-01f, 1.809722302e-01f}},  // 0
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 1
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 2
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 3
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 4
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 5
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 6
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 7
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 8
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 9
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 10
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 11
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 12
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 13
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 14
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 15
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 16
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 17
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 18
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 19
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 20
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 21
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 22
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 23
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 24
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 25
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 26
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 27
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 28
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 29
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 30
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 31
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 32
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 33
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 34
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 35
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 36
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 37
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 38
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 39
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.357637906e+00f, 3.964921579e-02f, 2.331385410e-01f, 4.265102485e-01f, 2.039154147e-01f}},  // 40
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.357637906e+00f, 3.964921579e-02f, 2.331385410e-01f, 4.265102485e-01f, 2.039154147e-01f}},  // 41
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.357637906e+00f, 3.964921579e-02f, 2.331385410e-01f, 4.265102485e-01f, 2.039154147e-01f}},  // 42
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.357637906e+00f, 3.964921579e-02f, 2.331385410e-01f, 4.265102485e-01f, 2.039154147e-01f}},  // 43
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.357637906e+00f, 3.964921579e-02f, 2.331385410e-01f, 4.265102485e-01f, 2.039154147e-01f}},  // 44
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 45
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 46
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 47
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 48
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 49
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.340436772e+00f, 5.044343988e-02f, 2.303181797e-01f, 4.184940080e-01f, 2.027043836e-01f}},  // 50
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.323455492e+00f, 6.095591201e-02f, 2.275654005e-01f, 4.104622428e-01f, 2.015145619e-01f}},  // 51
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.323455492e+00f, 6.095591201e-02f, 2.275654005e-01f, 4.104622428e-01f, 2.015145619e-01f}},  // 52
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.323455492e+00f, 6.095591201e-02f, 2.275654005e-01f, 4.104622428e-01f, 2.015145619e-01f}},  // 53
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.323455492e+00f, 6.095591201e-02f, 2.275654005e-01f, 4.104622428e-01f, 2.015145619e-01f}},  // 54
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.306691153e+00f, 7.119167504e-02f, 2.248784844e-01f, 4.024152180e-01f, 2.003460942e-01f}},  // 55
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.306691153e+00f, 7.119167504e-02f, 2.248784844e-01f, 4.024152180e-01f, 2.003460942e-01f}},  // 56
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.306691153e+00f, 7.119167504e-02f, 2.248784844e-01f, 4.024152180e-01f, 2.003460942e-01f}},  // 57
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.290140880e+00f, 8.115569647e-02f, 2.222557476e-01f, 3.943532011e-01f, 1.991991230e-01f}},  // 58
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.290140880e+00f, 8.115569647e-02f, 2.222557476e-01f, 3.943532011e-01f, 1.991991230e-01f}},  // 59
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.290140880e+00f, 8.115569647e-02f, 2.222557476e-01f, 3.943532011e-01f, 1.991991230e-01f}},  // 60
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.273801840e+00f, 9.085286954e-02f, 2.196955405e-01f, 3.862764621e-01f, 1.980737885e-01f}},  // 61
+    {{1.822786652e-01f, -3.489802579e-01f, 1.673404437e-01f, -1.963937043e+00f, 9.645758942e-01f}, {1.273801840e+00f, 9.085286954e-02f, 2.196955405e-01f, 3.862764621e-01f, 1.980737885e-01f}},  // 62
+    {{1.821991050e-01f, -3.489393819e-01f, 1.673699179e-01f, -1.963676697e+00f, 9.643247237e-01f}, {1.257671240e+00f, 1.002880142e-01f, 2.171962475e-01f, 3.781852731e-01f, 1.969702286e-01f}},  // 63
+    {{1.929110847e-01f, -3.695716306e-01f, 1.773178799e-01f, -1.963414472e+00f, 9.640718062e-01f}, {1.257671240e+00f, 1.002880142e-01f, 2.171962475e-01f, 3.781852731e-01f, 1.969702286e-01f}},  // 64
+    {{2.041647041e-01f, -3.913762141e-01f, 1.878878591e-01f, -1.962884334e+00f, 9.635606829e-01f}, {1.257671240e+00f, 1.002880142e-01f, 2.171962475e-01f, 3.781852731e-01f, 1.969702286e-01f}},  // 65
+    {{2.160758370e-01f, -4.144653702e-01f, 1.990854448e-01f, -1.962346519e+00f, 9.630424303e-01f}, {1.241746323e+00f, 1.094658784e-01f, 2.147562862e-01f, 3.700799088e-01f, 1.958885791e-01f}},  // 66
+    {{2.159830762e-01f, -4.144139952e-01f, 1.991167942e-01f, -1.962074698e+00f, 9.627806008e-01f}, {1.241746323e+00f, 1.094658784e-01f, 2.147562862e-01f, 3.700799088e-01f, 1.958885791e-01f}},  // 67
+    {{2.286829189e-01f, -4.389146498e-01f, 2.109477681e-01f, -1.961800916e+00f, 9.625169531e-01f}, {1.241746323e+00f, 1.094658784e-01f, 2.147562862e-01f, 3.700799088e-01f, 1.958885791e-01f}},  // 68
+    {{2.420266310e-01f, -4.648040381e-01f, 2.235141489e-01f, -1.961247413e+00f, 9.619841547e-01f}, {1.226024374e+00f, 1.183911385e-01f, 2.123741068e-01f, 3.619606459e-01f, 1.948289730e-01f}},  // 69
+    {{2.419237806e-01f, -4.647442669e-01f, 2.235466000e-01f, -1.960967663e+00f, 9.617149796e-01f}, {1.226024374e+00f, 1.183911385e-01f, 2.123741068e-01f, 3.619606459e-01f, 1.948289730e-01f}},  // 70
+    {{2.560417016e-01f, -4.921537619e-01f, 2.368591654e-01f, -1.960402095e+00f, 9.611710162e-01f}, {1.210502712e+00f, 1.270684011e-01f, 2.100481920e-01f, 3.538277634e-01f, 1.937915413e-01f}},  // 71
+    {{2.709845710e-01f, -5.211773384e-01f, 2.509614677e-01f, -1.959828339e+00f, 9.606194854e-01f}, {1.210502712e+00f, 1.270684011e-01f, 2.100481920e-01f, 3.538277634e-01f, 1.937915413e-01f}},  // 72
+    {{2.869208532e-01f, -5.519847829e-01f, 2.658664279e-01f, -1.959538353e+00f, 9.603408509e-01f}, {1.195178695e+00f, 1.355022033e-01f, 2.077770562e-01f, 3.456815426e-01f, 1.927764123e-01f}},  // 73
+    {{3.036675635e-01f, -5.845325575e-01f, 2.816906835e-01f, -1.958952091e+00f, 9.597777801e-01f}, {1.195178695e+00f, 1.355022033e-01f, 2.077770562e-01f, 3.456815426e-01f, 1.927764123e-01f}},  // 74
+    {{3.213928592e-01f, -6.189965186e-01f, 2.984532067e-01f, -1.958357341e+00f, 9.592068883e-01f}, {1.180049720e+00f, 1.436970141e-01f, 2.055592449e-01f, 3.375222667e-01f, 1.917837121e-01f}},  // 75
+    {{3.212592801e-01f, -6.189095206e-01f, 2.984875235e-01f, -1.958056745e+00f, 9.589184773e-01f}, {1.180049720e+00f, 1.436970141e-01f, 2.055592449e-01f, 3.375222667e-01f, 1.917837121e-01f}},  // 76
+    {{3.400131010e-01f, -6.553955347e-01f, 3.162439038e-01f, -1.957449034e+00f, 9.583356594e-01f}, {1.165113216e+00f, 1.516572351e-01f, 2.033933343e-01f, 3.293502213e-01f, 1.908135641e-01f}},  // 77
+    {{3.600113088e-01f, -6.941300254e-01f, 3.350180557e-01f, -1.957141887e+00f, 9.580412262e-01f}, {1.165113216e+00f, 1.516572351e-01f, 2.033933343e-01f, 3.293502213e-01f, 1.908135641e-01f}},  // 78
+    {{3.810290573e-01f, -7.350449758e-01f, 3.549412313e-01f, -1.956520932e+00f, 9.574462451e-01f}, {1.150366650e+00f, 1.593872018e-01f, 2.012779310e-01f, 3.211656938e-01f, 1.898660891e-01f}},  // 79
+    {{3.808724316e-01f, -7.349361978e-01f, 3.549757149e-01f, -1.956207092e+00f, 9.571456703e-01f}, {1.150366650e+00f, 1.593872018e-01f, 2.012779310e-01f, 3.211656938e-01f, 1.898660891e-01f}},  // 80
+    {{4.031097561e-01f, -7.782505586e-01f, 3.760790827e-01f, -1.955572606e+00f, 9.565382844e-01f}, {1.135807524e+00f, 1.668911839e-01f, 1.992116711e-01f, 3.129689738e-01f, 1.889414056e-01f}},  // 81
+    {{4.266465119e-01f, -8.241135026e-01f, 3.984323583e-01f, -1.954928936e+00f, 9.559224927e-01f}, {1.135807524e+00f, 1.668911839e-01f, 1.992116711e-01f, 3.129689738e-01f, 1.889414056e-01f}},  // 82
+    {{4.517425941e-01f, -8.728105495e-01f, 4.220757501e-01f, -1.954603615e+00f, 9.556114101e-01f}, {1.121433375e+00f, 1.741733869e-01f, 1.971932200e-01f, 3.047603529e-01f, 1.880396291e-01f}},  // 83
+    {{4.781206199e-01f, -9.242388323e-01f, 4.471550940e-01f, -1.953945920e+00f, 9.549828020e-01f}, {1.121433375e+00f, 1.741733869e-01f, 1.971932200e-01f, 3.047603529e-01f, 1.880396291e-01f}},  // 84
+    {{5.060399955e-01f, -9.786922840e-01f, 4.737190914e-01f, -1.953278707e+00f, 9.543455095e-01f}, {1.107241773e+00f, 1.812379526e-01f, 1.952212720e-01f, 2.965401246e-01f, 1.871608730e-01f}},  // 85
+    {{5.058349772e-01f, -9.785348132e-01f, 4.737512190e-01f, -1.952941487e+00f, 9.540235711e-01f}, {1.107241773e+00f, 1.812379526e-01f, 1.952212720e-01f, 2.965401246e-01f, 1.871608730e-01f}},  // 86
+    {{5.353742693e-01f, -1.036178985e+00f, 5.018864309e-01f, -1.952259737e+00f, 9.533730385e-01f}, {1.093230322e+00f, 1.880889600e-01f, 1.932945497e-01f, 2.883085841e-01f, 1.863052475e-01f}},  // 87
+    {{5.666395554e-01f, -1.097213002e+00f, 5.316863629e-01f, -1.951568121e+00f, 9.527135350e-01f}, {1.079396659e+00f, 1.947304266e-01f, 1.914118032e-01f, 2.800660288e-01f, 1.854728604e-01f}},  // 88
+    {{5.999731915e-01f, -1.162032152e+00f, 5.632207749e-01f, -1.951218569e+00f, 9.523803827e-01f}, {1.079396659e+00f, 1.947304266e-01f, 1.914118032e-01f, 2.800660288e-01f, 1.854728604e-01f}},  // 89
+    {{5.997316439e-01f, -1.161835791e+00f, 5.632491595e-01f, -1.950866497e+00f, 9.520449437e-01f}, {1.079396659e+00f, 1.947304266e-01f, 1.914118032e-01f, 2.800660288e-01f, 1.854728604e-01f}},  // 90
+    {{6.347572225e-01f, -1.230257924e+00f, 5.966787293e-01f, -1.950154720e+00f, 9.513671463e-01f}, {1.065738456e+00f, 2.011663084e-01f, 1.895718104e-01f, 2.718127577e-01f, 1.846638167e-01f}},  // 91
+    {{6.718292009e-01f, -1.302702295e+00f, 6.320850830e-01f, -1.949432644e+00f, 9.506800234e-01f}, {1.065738456e+00f, 2.011663084e-01f, 1.895718104e-01f, 2.718127577e-01f, 1.846638167e-01f}},  // 92
+    {{7.113521828e-01f, -1.379649502e+00f, 6.695625489e-01f, -1.949067698e+00f, 9.503329271e-01f}, {1.052253413e+00f, 2.074005016e-01f, 1.877733759e-01f, 2.635490716e-01f, 1.838782187e-01f}},  // 93
+    {{7.528987333e-01f, -1.460878525e+00f, 7.092814861e-01f, -1.948329895e+00f, 9.496315888e-01f}, {1.038939265e+00f, 2.134368430e-01f, 1.860153307e-01f, 2.552752730e-01f, 1.831161659e-01f}},  // 94
+    {{7.968724696e-01f, -1.546881191e+00f, 7.513479243e-01f, -1.947581417e+00f, 9.489206201e-01f}, {1.038939265e+00f, 2.134368430e-01f, 1.860153307e-01f, 2.552752730e-01f, 1.831161659e-01f}},  // 95
+    {{7.965537075e-01f, -1.546598005e+00f, 7.513641158e-01f, -1.947203128e+00f, 9.485614856e-01f}, {1.025793778e+00f, 2.192791111e-01f, 1.842965320e-01f, 2.469916662e-01f, 1.823777548e-01f}},  // 96
+    {{8.430779352e-01f, -1.637632772e+00f, 7.959126750e-01f, -1.946438351e+00f, 9.478358380e-01f}, {1.025793778e+00f, 2.192791111e-01f, 1.842965320e-01f, 2.469916662e-01f, 1.823777548e-01f}},  // 97
+    {{8.923198667e-01f, -1.734015757e+00f, 8.430928355e-01f, -1.945662510e+00f, 9.471002469e-01f}, {1.012814747e+00f, 2.249310263e-01f, 1.826158626e-01f, 2.386985569e-01f, 1.816630792e-01f}},  // 98
+    {{9.448155374e-01f, -1.836412883e+00f, 8.930556364e-01f, -1.945270392e+00f, 9.467286826e-01f}, {1.012814747e+00f, 2.249310263e-01f, 1.826158626e-01f, 2.386985569e-01f, 1.816630792e-01f}},  // 99
+    {{1.000000000e+00f, -1.944477658e+00f, 9.459779362e-01f, -1.944477658e+00f, 9.459779362e-01f}, {1.000000000e+00f, 2.303962527e-01f, 1.809722302e-01f, 2.303962527e-01f, 1.809722302e-01f}},  // 100
+  },
+  // 22050 Hz
+  {
+    {{1.000000000e+00f, -1.919444572e+00f, 9.225658767e-01f, -1.919444572e+00f, 9.225658767e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 0
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 1
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 2
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 3
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 4
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 5
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 6
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 7
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 8
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 9
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 10
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 11
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 12
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 13
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 14
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 15
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 16
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 17
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 18
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 19
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 20
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 21
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 22
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 23
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 24
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 25
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 26
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 27
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 28
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 29
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 30
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 31
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 32
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 33
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 34
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 35
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 36
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 37
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 38
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 39
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 40
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 41
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 42
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 43
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 44
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 45
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 46
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 47
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 48
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 49
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 50
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 51
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 52
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 53
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 54
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 55
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 56
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 57
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 58
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 59
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 60
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 61
+    {{1.843209372e-01f, -3.458005420e-01f, 1.628145728e-01f, -1.947665405e+00f, 9.490003728e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 62
+    {{1.842042591e-01f, -3.457447384e-01f, 1.628561245e-01f, -1.947287721e+00f, 9.486417834e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 63
+    {{1.949958873e-01f, -3.661716576e-01f, 1.725491990e-01f, -1.946907315e+00f, 9.482807433e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 64
+    {{2.062905444e-01f, -3.877401020e-01f, 1.828625473e-01f, -1.946138258e+00f, 9.475512477e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 65
+    {{2.182409127e-01f, -4.105760734e-01f, 1.937888429e-01f, -1.945358077e+00f, 9.468117591e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 66
+    {{2.181050264e-01f, -4.105054584e-01f, 1.938330612e-01f, -1.944963765e+00f, 9.464382274e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 67
+    {{2.308850867e-01f, -4.347538734e-01f, 2.053643247e-01f, -1.944566611e+00f, 9.460621492e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 68
+    {{2.442633727e-01f, -4.603521459e-01f, 2.176273635e-01f, -1.943763698e+00f, 9.453022885e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 69
+    {{2.441128165e-01f, -4.602696679e-01f, 2.176731502e-01f, -1.943357898e+00f, 9.449184731e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 70
+    {{2.582598975e-01f, -4.873650323e-01f, 2.306650699e-01f, -1.942537504e+00f, 9.441429899e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 71
+    {{2.732284050e-01f, -5.160517053e-01f, 2.444281178e-01f, -1.941705247e+00f, 9.433569256e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 72
+    {{2.892418822e-01f, -5.465267860e-01f, 2.589601716e-01f, -1.941284616e+00f, 9.429598835e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 73
+    {{3.060085541e-01f, -5.786893977e-01f, 2.744042966e-01f, -1.940434242e+00f, 9.421576948e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 74
+    {{3.237487967e-01f, -6.127402169e-01f, 2.907644334e-01f, -1.939571573e+00f, 9.413445859e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 75
+    {{3.235536140e-01f, -6.126192002e-01f, 2.908128850e-01f, -1.939135572e+00f, 9.409338933e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 76
+    {{3.423134480e-01f, -6.486592272e-01f, 3.081433070e-01f, -1.938254128e+00f, 9.401041448e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 77
+    {{3.623794384e-01f, -6.869551322e-01f, 3.264521083e-01f, -1.937808639e+00f, 9.396850538e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 78
+    {{3.833929493e-01f, -7.273600582e-01f, 3.458974455e-01f, -1.936908014e+00f, 9.388383501e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 79
+    {{3.831643389e-01f, -7.272081648e-01f, 3.459461482e-01f, -1.936452831e+00f, 9.384107017e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 80
+    {{4.053855691e-01f, -7.699718420e-01f, 3.665432424e-01f, -1.935532608e+00f, 9.375467222e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 81
+    {{4.288970963e-01f, -8.152439524e-01f, 3.883600294e-01f, -1.934599086e+00f, 9.366710451e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 82
+    {{4.540420655e-01f, -8.633615241e-01f, 4.114209548e-01f, -1.934127278e+00f, 9.362287743e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 83
+    {{4.803780360e-01f, -9.141139723e-01f, 4.358977649e-01f, -1.933173448e+00f, 9.353352765e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 84
+    {{5.082431670e-01f, -9.678422481e-01f, 4.618229589e-01f, -1.932205835e+00f, 9.344297131e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 85
+    {{5.079444588e-01f, -9.676212447e-01f, 4.618683522e-01f, -1.931716799e+00f, 9.339723601e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 86
+    {{5.374108970e-01f, -1.024482213e+00f, 4.893257611e-01f, -1.930728141e+00f, 9.330484173e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 87
+    {{5.685881468e-01f, -1.084675778e+00f, 5.184067426e-01f, -1.929725201e+00f, 9.321120320e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 88
+    {{6.019270292e-01f, -1.148672901e+00f, 5.491666862e-01f, -1.929218311e+00f, 9.316391255e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 89
+    {{6.015754754e-01f, -1.148396657e+00f, 5.492067969e-01f, -1.928707774e+00f, 9.311630507e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 90
+    {{6.364778980e-01f, -1.215850900e+00f, 5.818270106e-01f, -1.927675652e+00f, 9.302013186e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 91
+    {{6.734065093e-01f, -1.287256548e+00f, 6.163743819e-01f, -1.926628624e+00f, 9.292266794e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 92
+    {{7.128933459e-01f, -1.363189205e+00f, 6.529308755e-01f, -1.926099454e+00f, 9.287344704e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 93
+    {{7.542572909e-01f, -1.443229642e+00f, 6.916828598e-01f, -1.925029666e+00f, 9.277401743e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 94
+    {{7.980222337e-01f, -1.527956664e+00f, 7.327225713e-01f, -1.923944432e+00f, 9.267325737e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 95
+    {{7.975591295e-01f, -1.527557031e+00f, 7.327454509e-01f, -1.923395955e+00f, 9.262237339e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 96
+    {{8.438377468e-01f, -1.617213651e+00f, 7.762021144e-01f, -1.922287137e+00f, 9.251958736e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 97
+    {{8.928022281e-01f, -1.712117472e+00f, 8.222223427e-01f, -1.921162315e+00f, 9.241543026e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 98
+    {{9.451559849e-01f, -1.813072621e+00f, 8.709511297e-01f, -1.920593831e+00f, 9.236283240e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 99
+    {{1.000000000e+00f, -1.919444572e+00f, 9.225658767e-01f, -1.919444572e+00f, 9.225658767e-01f}, {1.000000000e+00f, 1.209579277e+00f, 4.432602843e-01f, 1.209579277e+00f, 4.432602843e-01f}},  // 100
+  },
+  // 16000 Hz
+  {
+    {{1.000000000e+00f, -1.889033079e+00f, 8.948743446e-01f, -1.889033079e+00f, 8.948743446e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 0
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 1
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 2
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 3
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 4
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 5
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 6
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 7
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 8
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 9
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 10
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 11
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 12
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 13
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 14
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 15
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 16
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 17
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 18
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 19
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 20
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 21
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 22
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 23
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 24
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 25
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 26
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 27
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 28
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 29
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 30
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 31
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 32
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 33
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 34
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 35
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 36
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 37
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 38
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 39
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 40
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 41
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 42
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 43
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 44
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 45
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 46
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 47
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 48
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 49
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 50
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 51
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 52
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 53
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 54
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 55
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 56
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 57
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 58
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 59
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 60
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 61
+    {{1.868318313e-01f, -3.417984352e-01f, 1.574782546e-01f, -1.927880049e+00f, 9.303917001e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 62
+    {{1.866690144e-01f, -3.417273788e-01f, 1.575334837e-01f, -1.927359883e+00f, 9.299072768e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 63
+    {{1.975580243e-01f, -3.618997957e-01f, 1.669254127e-01f, -1.926835973e+00f, 9.294196148e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 64
+    {{2.089020519e-01f, -3.831792919e-01f, 1.769349154e-01f, -1.925776820e+00f, 9.284344957e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 65
+    {{2.208995404e-01f, -4.057057261e-01f, 1.875399957e-01f, -1.924702374e+00f, 9.274361840e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 66
+    {{2.207101703e-01f, -4.056149627e-01f, 1.875988089e-01f, -1.924159348e+00f, 9.269320307e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 67
+    {{2.335881684e-01f, -4.295519017e-01f, 1.987758369e-01f, -1.923612415e+00f, 9.264245191e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 68
+    {{2.470077852e-01f, -4.547948545e-01f, 2.106796860e-01f, -1.922506722e+00f, 9.253993391e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 69
+    {{2.467981551e-01f, -4.546882760e-01f, 2.107406099e-01f, -1.921947905e+00f, 9.248816300e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 70
+    {{2.609799139e-01f, -4.814006853e-01f, 2.233528370e-01f, -1.920818187e+00f, 9.238358707e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 71
+    {{2.759787569e-01f, -5.096769547e-01f, 2.367141501e-01f, -1.919672165e+00f, 9.227761851e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 72
+    {{2.920862857e-01f, -5.397434641e-01f, 2.508052782e-01f, -1.919092968e+00f, 9.222410678e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 73
+    {{3.088762747e-01f, -5.714374050e-01f, 2.657992570e-01f, -1.917922053e+00f, 9.211601792e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 74
+    {{3.266336766e-01f, -6.049858681e-01f, 2.816828913e-01f, -1.916734244e+00f, 9.200649440e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 75
+    {{3.263625002e-01f, -6.048277932e-01f, 2.817474165e-01f, -1.916133930e+00f, 9.195118932e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 76
+    {{3.451285760e-01f, -6.403260904e-01f, 2.985734251e-01f, -1.914920329e+00f, 9.183948178e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 77
+    {{3.652769423e-01f, -6.780850031e-01f, 3.163318306e-01f, -1.914306980e+00f, 9.178307499e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 78
+    {{3.862841207e-01f, -7.178710354e-01f, 3.352113288e-01f, -1.913067031e+00f, 9.166914453e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 79
+    {{3.859669135e-01f, -7.176716213e-01f, 3.352762147e-01f, -1.912440368e+00f, 9.161161648e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 80
+    {{4.081673615e-01f, -7.597677125e-01f, 3.552738159e-01f, -1.911173505e+00f, 9.149542375e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 81
+    {{4.316469626e-01f, -8.043240126e-01f, 3.764553488e-01f, -1.909888380e+00f, 9.137770071e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 82
+    {{4.568511089e-01f, -8.517346247e-01f, 3.988272261e-01f, -1.909238887e+00f, 9.131825976e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 83
+    {{4.831346147e-01f, -9.016690294e-01f, 4.225906144e-01f, -1.907925878e+00f, 9.119820778e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 84
+    {{5.109324439e-01f, -9.545200586e-01f, 4.477594726e-01f, -1.906593948e+00f, 9.107658062e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 85
+    {{5.105188656e-01f, -9.542279808e-01f, 4.478199785e-01f, -1.905920804e+00f, 9.101517067e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 86
+    {{5.398954119e-01f, -1.010142327e+00f, 4.744749338e-01f, -1.904559987e+00f, 9.089114658e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 87
+    {{5.709643265e-01f, -1.069320650e+00f, 5.027047936e-01f, -1.903179568e+00f, 9.076550157e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 88
+    {{6.043091359e-01f, -1.132318868e+00f, 5.325484658e-01f, -1.902481921e+00f, 9.070206544e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 89
+    {{6.038230195e-01f, -1.131952649e+00f, 5.326019379e-01f, -1.901779269e+00f, 9.063821711e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 90
+    {{6.385744921e-01f, -1.198238989e+00f, 5.642641243e-01f, -1.900358807e+00f, 9.050927453e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 91
+    {{6.753276553e-01f, -1.268391933e+00f, 5.977947986e-01f, -1.898917895e+00f, 9.037865503e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 92
+    {{7.147700961e-01f, -1.343094384e+00f, 6.332617131e-01f, -1.898189681e+00f, 9.031271053e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 93
+    {{7.559110189e-01f, -1.421702507e+00f, 6.708693400e-01f, -1.896717549e+00f, 9.017954013e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 94
+    {{7.994212499e-01f, -1.504893090e+00f, 7.106940574e-01f, -1.895224235e+00f, 9.004464526e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 95
+    {{7.987822698e-01f, -1.504361164e+00f, 7.107245493e-01f, -1.894469541e+00f, 8.997654514e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 96
+    {{8.447617244e-01f, -1.592359141e+00f, 7.528892787e-01f, -1.892943888e+00f, 8.983902745e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 97
+    {{8.933885761e-01f, -1.685483622e+00f, 7.975372082e-01f, -1.891396293e+00f, 8.969973697e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 98
+    {{9.455697431e-01f, -1.784696002e+00f, 8.448062970e-01f, -1.890614170e+00f, 8.962942082e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 99
+    {{1.000000000e+00f, -1.889033079e+00f, 8.948743446e-01f, -1.889033079e+00f, 8.948743446e-01f}, {1.000000000e+00f, 2.533252160e+00f, 1.741972379e+00f, 2.533252160e+00f, 1.741972379e+00f}},  // 100
+  },
+  // 11025 Hz
+  {
+    {{1.000000000e+00f, -1.839116797e+00f, 8.511283412e-01f, -1.839116797e+00f, 8.511283412e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 0
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 1
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 2
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 3
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 4
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 5
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 6
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 7
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 8
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 9
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 10
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 11
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 12
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 13
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 14
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 15
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 16
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 17
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 18
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 19
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 20
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 21
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 22
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 23
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 24
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 25
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 26
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 27
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 28
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 29
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 30
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 31
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 32
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 33
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 34
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 35
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 36
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 37
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 38
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 39
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 40
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 41
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 42
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 43
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 44
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 45
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 46
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 47
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 48
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 49
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 50
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 51
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 52
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 53
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 54
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 55
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 56
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 57
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 58
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 59
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 60
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 61
+    {{1.910243243e-01f, -3.349038323e-01f, 1.490897622e-01f, -1.895347228e+00f, 9.005574821e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 62
+    {{1.907832775e-01f, -3.348145133e-01f, 1.491651052e-01f, -1.894593415e+00f, 8.998771959e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 63
+    {{2.018336046e-01f, -3.545574019e-01f, 1.580821281e-01f, -1.893834200e+00f, 8.991925303e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 64
+    {{2.132575051e-01f, -3.753578424e-01f, 1.676108926e-01f, -1.892299408e+00f, 8.978099637e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 65
+    {{2.253310277e-01f, -3.973717058e-01f, 1.777077193e-01f, -1.890742546e+00f, 8.964095876e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 66
+    {{2.250512612e-01f, -3.972554436e-01f, 1.777880491e-01f, -1.889955741e+00f, 8.957026597e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 67
+    {{2.380911650e-01f, -4.206693817e-01f, 1.884061219e-01f, -1.889163301e+00f, 8.949912060e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 68
+    {{2.515770130e-01f, -4.453253169e-01f, 1.997415707e-01f, -1.887561355e+00f, 8.935546219e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 69
+    {{2.512677496e-01f, -4.451873569e-01f, 1.998248438e-01f, -1.886751769e+00f, 8.928294420e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 70
+    {{2.655046397e-01f, -4.712681447e-01f, 2.118361912e-01f, -1.885115170e+00f, 8.913651822e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 71
+    {{2.805513339e-01f, -4.988682483e-01f, 2.245617246e-01f, -1.883455061e+00f, 8.898822225e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 72
+    {{2.968138792e-01f, -5.282529654e-01f, 2.379566679e-01f, -1.882616086e+00f, 8.891336675e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 73
+    {{3.136399078e-01f, -5.591759470e-01f, 2.522382336e-01f, -1.880920087e+00f, 8.876222810e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 74
+    {{3.314230870e-01f, -5.918988728e-01f, 2.673677373e-01f, -1.879199739e+00f, 8.860916906e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 75
+    {{3.310244219e-01f, -5.916899720e-01f, 2.674560662e-01f, -1.878330328e+00f, 8.853191304e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 76
+    {{3.497982029e-01f, -6.262993362e-01f, 2.834837761e-01f, -1.876572813e+00f, 8.837593526e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 77
+    {{3.700818463e-01f, -6.631671316e-01f, 3.003727469e-01f, -1.875684622e+00f, 8.829720838e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 78
+    {{3.910758030e-01f, -7.019390525e-01f, 3.183567544e-01f, -1.873889153e+00f, 8.813826581e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 79
+    {{3.906104420e-01f, -7.016730065e-01f, 3.184456388e-01f, -1.872981786e+00f, 8.805804496e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 80
+    {{4.127738423e-01f, -7.426767005e-01f, 3.374945304e-01f, -1.871147560e+00f, 8.789609126e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 81
+    {{4.361979939e-01f, -7.860627344e-01f, 3.576708004e-01f, -1.869287042e+00f, 8.773210426e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 82
+    {{4.614987600e-01f, -8.323060372e-01f, 3.789538869e-01f, -1.868346808e+00f, 8.764934178e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 83
+    {{4.876928752e-01f, -8.809047762e-01f, 4.015883998e-01f, -1.866446159e+00f, 8.748226582e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 84
+    {{5.153768925e-01f, -9.323246864e-01f, 4.255605504e-01f, -1.864518288e+00f, 8.731310446e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 85
+    {{5.147722665e-01f, -9.319302184e-01f, 4.256434965e-01f, -1.863544025e+00f, 8.722773521e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 86
+    {{5.439979649e-01f, -9.863021799e-01f, 4.510289094e-01f, -1.861574604e+00f, 8.705540644e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 87
+    {{5.748857624e-01f, -1.043827646e+00f, 4.779123395e-01f, -1.859577000e+00f, 8.688093978e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 88
+    {{6.082392361e-01f, -1.105185705e+00f, 5.063079446e-01f, -1.858567505e+00f, 8.679289816e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 89
+    {{6.075300584e-01f, -1.104688307e+00f, 5.063812560e-01f, -1.857550818e+00f, 8.670431415e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 90
+    {{6.420305905e-01f, -1.169076240e+00f, 5.365281786e-01f, -1.855495660e+00f, 8.652550840e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 91
+    {{6.784927345e-01f, -1.237194491e+00f, 5.684509657e-01f, -1.853411123e+00f, 8.634450139e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 92
+    {{7.178611514e-01f, -1.309883160e+00f, 6.021959562e-01f, -1.852357710e+00f, 8.625316578e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 93
+    {{7.586331955e-01f, -1.386167483e+00f, 6.379941219e-01f, -1.850228337e+00f, 8.606881711e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 94
+    {{8.017228320e-01f, -1.466867177e+00f, 6.758979329e-01f, -1.848068553e+00f, 8.588221412e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 95
+    {{8.007939345e-01f, -1.466139488e+00f, 6.759396799e-01f, -1.846977126e+00f, 8.578806063e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 96
+    {{8.462804927e-01f, -1.551451383e+00f, 7.160622859e-01f, -1.844770934e+00f, 8.559803634e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 97
+    {{8.943518188e-01f, -1.641696379e+00f, 7.585413865e-01f, -1.842533267e+00f, 8.540570463e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 98
+    {{9.462492623e-01f, -1.738069251e+00f, 8.035041629e-01f, -1.841402494e+00f, 8.530866684e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 99
+    {{1.000000000e+00f, -1.839116797e+00f, 8.511283412e-01f, -1.839116797e+00f, 8.511283412e-01f}, {1.000000000e+00f, -2.290712356e+00f, 4.659107261e+00f, -2.290712356e+00f, 4.659107261e+00f}},  // 100
+  },
+  // 8000 Hz
+  {
+    {{1.000000000e+00f, -1.778631778e+00f, 8.008026467e-01f, -1.778631778e+00f, 8.008026467e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 0
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 1
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 2
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 3
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 4
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 5
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 6
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 7
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 8
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 9
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 10
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 11
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 12
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 13
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 14
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 15
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 16
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 17
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 18
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 19
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 20
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 21
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 22
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 23
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 24
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 25
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 26
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 27
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 28
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 29
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 30
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 31
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 32
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 33
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 34
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 35
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 36
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 37
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 38
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 39
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 40
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 41
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 42
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 43
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 44
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 45
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 46
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 47
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 48
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 49
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 50
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 51
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 52
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 53
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 54
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 55
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 56
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 57
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 58
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 59
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 60
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 61
+    {{1.962238327e-01f, -3.260169215e-01f, 1.395130550e-01f, -1.855797587e+00f, 8.655175529e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 62
+    {{1.958837938e-01f, -3.259166215e-01f, 1.396089267e-01f, -1.854761166e+00f, 8.646168926e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 63
+    {{2.071320617e-01f, -3.451198281e-01f, 1.479811112e-01f, -1.853717365e+00f, 8.637107104e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 64
+    {{2.186507804e-01f, -3.653321131e-01f, 1.569555904e-01f, -1.851607416e+00f, 8.618816741e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 65
+    {{2.308142272e-01f, -3.867176689e-01f, 1.664663472e-01f, -1.849467327e+00f, 8.600302320e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 66
+    {{2.304205430e-01f, -3.865829551e-01f, 1.665687361e-01f, -1.848385848e+00f, 8.590960423e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 67
+    {{2.436585571e-01f, -4.093440340e-01f, 1.765449710e-01f, -1.847296677e+00f, 8.581561715e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 68
+    {{2.572219481e-01f, -4.332825988e-01f, 1.872248856e-01f, -1.845095046e+00f, 8.562592804e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 69
+    {{2.567874732e-01f, -4.331200386e-01f, 1.873311311e-01f, -1.843982477e+00f, 8.553022068e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 70
+    {{2.710881559e-01f, -4.584306408e-01f, 1.986494226e-01f, -1.841733565e+00f, 8.533706710e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 71
+    {{2.861895671e-01f, -4.852074139e-01f, 2.106416128e-01f, -1.839452587e+00f, 8.514157731e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 72
+    {{3.026410188e-01f, -5.137478227e-01f, 2.232363655e-01f, -1.838299935e+00f, 8.504294970e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 73
+    {{3.195069639e-01f, -5.437339921e-01f, 2.366961583e-01f, -1.835970028e+00f, 8.484391579e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 74
+    {{3.373173662e-01f, -5.754551333e-01f, 2.509557557e-01f, -1.833606938e+00f, 8.464249263e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 75
+    {{3.367596008e-01f, -5.752010252e-01f, 2.510686797e-01f, -1.832412807e+00f, 8.454087847e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 76
+    {{3.555384535e-01f, -6.087337864e-01f, 2.661755360e-01f, -1.829999086e+00f, 8.433583177e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 77
+    {{3.759861228e-01f, -6.445060252e-01f, 2.820644627e-01f, -1.828779379e+00f, 8.423239395e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 78
+    {{3.969593130e-01f, -6.820520664e-01f, 2.990155347e-01f, -1.826313981e+00f, 8.402367623e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 79
+    {{3.963098507e-01f, -6.817238718e-01f, 2.991292685e-01f, -1.825068171e+00f, 8.391839108e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 80
+    {{4.184234356e-01f, -7.214094800e-01f, 3.170839001e-01f, -1.822550030e+00f, 8.370595508e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 81
+    {{4.417752903e-01f, -7.633851603e-01f, 3.361007428e-01f, -1.819996127e+00f, 8.349101409e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 82
+    {{4.671922727e-01f, -8.082027826e-01f, 3.561308752e-01f, -1.818705612e+00f, 8.338259771e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 83
+    {{4.932725824e-01f, -8.551946537e-01f, 3.774635261e-01f, -1.816097147e+00f, 8.316386022e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 84
+    {{5.208130904e-01f, -9.048948255e-01f, 4.000557046e-01f, -1.813451689e+00f, 8.294256588e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 85
+    {{5.199727781e-01f, -9.043995687e-01f, 4.001619203e-01f, -1.812114931e+00f, 8.283095347e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 86
+    {{5.490101642e-01f, -9.569211882e-01f, 4.240835916e-01f, -1.809413038e+00f, 8.260578535e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 87
+    {{5.796729793e-01f, -1.012465949e+00f, 4.494148103e-01f, -1.806672885e+00f, 8.237800923e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 88
+    {{6.130351713e-01f, -1.071835668e+00f, 4.761435663e-01f, -1.805288299e+00f, 8.226313685e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 89
+    {{6.120520354e-01f, -1.071206205e+00f, 4.762374256e-01f, -1.803893953e+00f, 8.214760489e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 90
+    {{6.462431871e-01f, -1.133324028e+00f, 5.046379663e-01f, -1.801075720e+00f, 8.191455224e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 91
+    {{6.823476086e-01f, -1.199011740e+00f, 5.347079026e-01f, -1.798217655e+00f, 8.167883137e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 92
+    {{7.216244012e-01f, -1.269269113e+00f, 5.664708358e-01f, -1.796773518e+00f, 8.155996419e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 93
+    {{7.619447600e-01f, -1.342781811e+00f, 6.001843916e-01f, -1.793854700e+00f, 8.132020407e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 94
+    {{8.045205448e-01f, -1.420513585e+00f, 6.358756072e-01f, -1.790894701e+00f, 8.107772678e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 95
+    {{8.032382754e-01f, -1.419583431e+00f, 6.359288472e-01f, -1.789399086e+00f, 8.095546317e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 96
+    {{8.481244719e-01f, -1.501699601e+00f, 6.736999365e-01f, -1.786376279e+00f, 8.070887412e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 97
+    {{8.955203963e-01f, -1.588522131e+00f, 7.136821550e-01f, -1.783310902e+00f, 8.045952024e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 98
+    {{9.470733090e-01f, -1.681488395e+00f, 7.559910191e-01f, -1.781762073e+00f, 8.033380066e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 99
+    {{1.000000000e+00f, -1.778631778e+00f, 8.008026467e-01f, -1.778631778e+00f, 8.008026467e-01f}, {1.000000000e+00f, -9.428090416e-01f, 3.333333333e-01f, -9.428090416e-01f, 3.333333333e-01f}},  // 100
+  },
+};
+
+#endif
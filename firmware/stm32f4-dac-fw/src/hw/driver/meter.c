@@ -0,0 +1,541 @@
+#include "meter.h"
+
+
+#ifdef _USE_HW_METER
+#include "cli.h"
+#include "i2s.h"
+#include "event.h"
+#include "arm_math.h"
+
+
+#define METER_CLIP_LEVEL        0x7FFF0000            // 24비트 full scale 근처
+#define METER_DB10_MIN          (-1200)
+#define METER_FFT_LEN           HW_METER_FFT_LEN
+#define METER_BAND_MAX          HW_METER_BAND_MAX
+
+
+typedef enum
+{
+  METER_FFT_IDLE = 0,                 // 다음 캡처 대기
+  METER_FFT_READY,                    // 캡처 완료, 스레드에서 변환
+} MeterFftState_t;
+
+typedef struct
+{
+  uint32_t peak[METER_CH];
+  uint64_t sum[METER_CH];             // (x >> 16)^2 의 합
+  uint32_t frames;
+} meter_acc_t;
+
+
+#if CLI_USE(HW_METER)
+static void cliMeter(cli_args_t *args);
+#endif
+static int16_t meterPeakDb10(uint32_t peak);
+static int16_t meterRmsDb10(uint64_t sum, uint32_t frames);
+
+// 처리 인터럽트에서 누적하고, 측정 구간이 끝나면 결과로 옮긴다.
+//
+static meter_acc_t meter_acc;
+static meter_acc_t meter_result;
+static volatile uint32_t meter_update_cnt = 0;
+static uint32_t meter_clip_cnt[METER_CH];
+static uint32_t meter_peak_hold[METER_CH];
+static uint32_t meter_window_ms = HW_METER_WINDOW_MS;
+static volatile uint32_t meter_window_frames = 0;
+static uint32_t meter_rate = 0;
+static bool     meter_enable = false;
+
+// 스펙트럼 : 갱신 주기마다 한 블록(FFT_LEN)만 캡처하고 변환은 스레드에서 한다.
+//
+static arm_rfft_fast_instance_f32 meter_fft;
+static float    meter_fft_in[METER_FFT_LEN];
+static float    meter_fft_out[METER_FFT_LEN];
+static volatile MeterFftState_t meter_fft_state = METER_FFT_IDLE;
+static volatile bool meter_fft_enable = false;
+static uint32_t meter_fft_pos = 0;
+static uint32_t meter_fft_wait = 0;                   // 다음 캡처까지 남은 프레임
+static uint32_t meter_fft_rate = 0;
+static uint32_t meter_fft_cycles = 0;
+static uint16_t meter_band_edge[METER_BAND_MAX + 1];  // FFT bin
+static int16_t  meter_band_db10[METER_BAND_MAX];
+static bool     meter_band_valid = false;
+
+
+
+
+bool meterInit(void)
+{
+  arm_rfft_fast_init_f32(&meter_fft, METER_FFT_LEN);
+
+  // 로그 간격 밴드, 저역은 최소 1 bin
+  //
+  meter_band_edge[0] = 1;
+  for (int i=1; i<=METER_BAND_MAX; i++)
+  {
+    uint32_t edge = (uint32_t)(powf(METER_FFT_LEN / 2, (float)i / METER_BAND_MAX) + 0.5f);
+
+    if (edge <= meter_band_edge[i - 1])
+    {
+      edge = meter_band_edge[i - 1] + 1;
+    }
+    meter_band_edge[i] = edge;
+  }
+  meter_band_edge[METER_BAND_MAX] = METER_FFT_LEN / 2;
+
+  // 보지 않을 때는 처리 경로에 넣지 않는다. (meter on)
+  //
+  i2sStageAddTap("meter", meterProcess, NULL);
+  i2sStageEnable("meter", false);
+
+#if CLI_USE(HW_METER)
+  cliAdd("meter", cliMeter);
+#endif
+  return true;
+}
+
+bool meterSetEnable(bool enable)
+{
+  if (enable == true && meter_enable != true)
+  {
+    // 꺼지기 전에 쌓인 누적값과 캡처 중이던 블록은 버린다.
+    //
+    meter_rate = 0;
+    if (meter_fft_state == METER_FFT_IDLE)
+    {
+      meter_fft_pos  = 0;
+      meter_fft_wait = 0;
+    }
+  }
+  meter_enable = enable;
+  i2sStageEnable("meter", enable);
+
+  return true;
+}
+
+bool meterIsEnable(void)
+{
+  return meter_enable;
+}
+
+bool meterSetWindow(uint32_t window_ms)
+{
+  if (window_ms < 10 || window_ms > 10000)
+  {
+    return false;
+  }
+  meter_window_ms = window_ms;
+  meter_rate = 0;                     // 다음 블록에서 다시 계산
+  return true;
+}
+
+bool meterSetFft(bool enable)
+{
+  meter_fft_enable = enable;
+  if (enable != true)
+  {
+    meter_band_valid = false;
+  }
+  return true;
+}
+
+bool meterIsFft(void)
+{
+  return meter_fft_enable;
+}
+
+void meterClear(void)
+{
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  memset(meter_clip_cnt, 0, sizeof(meter_clip_cnt));
+  memset(meter_peak_hold, 0, sizeof(meter_peak_hold));
+  __set_PRIMASK(primask);
+}
+
+int16_t meterPeakDb10(uint32_t peak)
+{
+  if (peak == 0)
+  {
+    return METER_DB10_MIN;
+  }
+  return (int16_t)(200.0f * log10f((float)peak / 2147483648.0f));
+}
+
+int16_t meterRmsDb10(uint64_t sum, uint32_t frames)
+{
+  float power;
+
+  if (frames == 0 || sum == 0)
+  {
+    return METER_DB10_MIN;
+  }
+  power = (float)sum / ((float)frames * 1073741824.0f);
+
+  return (int16_t)(100.0f * log10f(power));
+}
+
+void meterGetLevel(meter_level_t *p_level)
+{
+  meter_acc_t result;
+  uint32_t peak_hold[METER_CH];
+  uint32_t primask;
+
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  result = meter_result;
+  memcpy(peak_hold, meter_peak_hold, sizeof(peak_hold));
+  memcpy(p_level->clip_cnt, meter_clip_cnt, sizeof(meter_clip_cnt));
+  __set_PRIMASK(primask);
+
+  for (int ch=0; ch<METER_CH; ch++)
+  {
+    p_level->peak_db10[ch]      = meterPeakDb10(result.peak[ch]);
+    p_level->rms_db10[ch]       = meterRmsDb10(result.sum[ch], result.frames);
+    p_level->peak_hold_db10[ch] = meterPeakDb10(peak_hold[ch]);
+  }
+  p_level->window_ms  = meter_window_ms;
+  p_level->update_cnt = meter_update_cnt;
+}
+
+bool meterGetSpectrum(int16_t *p_db10, uint32_t *p_hz, uint32_t bands)
+{
+  if (meter_band_valid != true || bands > METER_BAND_MAX)
+  {
+    return false;
+  }
+
+  for (uint32_t i=0; i<bands; i++)
+  {
+    p_db10[i] = meter_band_db10[i];
+    if (p_hz != NULL)
+    {
+      p_hz[i] = (meter_band_edge[i + 1] * meter_fft_rate) / METER_FFT_LEN;
+    }
+  }
+  return true;
+}
+
+// 스레드 : 캡처된 블록에 Hann 창을 씌우고 밴드별 에너지를 구한다.
+//
+void meterUpdate(void)
+{
+  uint32_t pre_time;
+  float    ref;
+
+
+  if (meter_fft_state != METER_FFT_READY)
+  {
+    return;
+  }
+  pre_time = DWT->CYCCNT;
+
+  for (int i=0; i<METER_FFT_LEN; i++)
+  {
+    meter_fft_in[i] *= 0.5f - 0.5f * arm_cos_f32(2.0f * PI * i / METER_FFT_LEN);
+  }
+  arm_rfft_fast_f32(&meter_fft, meter_fft_in, meter_fft_out, 0);
+
+  // full scale 사인파가 0 dB : Hann 창에서 bin 크기는 N/4
+  //
+  ref = (float)(METER_FFT_LEN / 4) * (float)(METER_FFT_LEN / 4);
+  for (int b=0; b<METER_BAND_MAX; b++)
+  {
+    float sum = 0.0f;
+
+    for (int k=meter_band_edge[b]; k<meter_band_edge[b + 1]; k++)
+    {
+      sum += meter_fft_out[k*2 + 0] * meter_fft_out[k*2 + 0] + meter_fft_out[k*2 + 1] * meter_fft_out[k*2 + 1];
+    }
+    if (sum > 0.0f)
+    {
+      int32_t db10 = (int32_t)(100.0f * log10f(sum / ref));
+
+      meter_band_db10[b] = db10 > METER_DB10_MIN ? db10 : METER_DB10_MIN;
+    }
+    else
+    {
+      meter_band_db10[b] = METER_DB10_MIN;
+    }
+  }
+  meter_band_valid = meter_fft_enable;
+  meter_fft_cycles = DWT->CYCCNT - pre_time;
+
+  // 다음 캡처는 갱신 주기만큼 쉬었다가 시작한다.
+  //
+  meter_fft_pos  = 0;
+  meter_fft_wait = (meter_fft_rate * HW_METER_FFT_MS) / 1000;
+  meter_fft_wait = meter_fft_wait > METER_FFT_LEN ? meter_fft_wait - METER_FFT_LEN : 0;
+  meter_fft_state = METER_FFT_IDLE;
+}
+
+// 채널마다 두 프레임의 상위 16비트를 한 워드로 묶어서 SIMD 로 처리한다.
+//   PKHTB  : [x1 >> 16 : x0 >> 16]
+//   SMLALD : 두 제곱을 64비트 합에 한 번에 누적
+//   SSUB16 + SEL : 레인별 비교, 한 번의 비교로 최대/최소를 같이 고른다.
+// 클립 개수는 블록 최대/최소가 full scale 에 닿았을 때만 다시 센다.
+//
+static inline void meterMinMax(uint32_t a, uint32_t b, uint32_t *p_max, uint32_t *p_min)
+{
+  uint32_t hi, lo;
+
+  __SSUB16(a, b);
+  hi = __SEL(a, b);
+  lo = __SEL(b, a);
+  __SSUB16(hi, *p_max);
+  *p_max = __SEL(hi, *p_max);
+  __SSUB16(*p_min, lo);
+  *p_min = __SEL(lo, *p_min);
+}
+
+static inline uint32_t meterPeak16(uint32_t max, uint32_t min)
+{
+  int32_t hi = cmax((int16_t)(max >> 16), (int16_t)max);
+  int32_t lo = cmin((int16_t)(min >> 16), (int16_t)min);
+
+  // ~x 로 음수 쪽을 접는다. (-32768 -> 32767)
+  //
+  return (uint32_t)cmax(hi, ~lo);
+}
+
+static inline uint32_t meterClipCount(const int32_t *p_in, uint32_t frames)
+{
+  uint32_t cnt = 0;
+
+  for (uint32_t i=0; i<frames; i++)
+  {
+    int32_t  x  = p_in[i * METER_CH];
+    uint32_t ax = x < 0 ? ~x : x;
+
+    cnt += ax >= METER_CLIP_LEVEL;
+  }
+  return cnt;
+}
+
+__RAMFUNC void meterProcess(int32_t *p_buf, uint32_t frames, void *arg)
+{
+  uint32_t rate = i2sGetSampleRate();
+  uint32_t max_l = 0x80008000;
+  uint32_t max_r = 0x80008000;
+  uint32_t min_l = 0x7FFF7FFF;
+  uint32_t min_r = 0x7FFF7FFF;
+  uint32_t peak_l, peak_r;
+  uint64_t sum_l, sum_r;
+  uint32_t n = frames;
+  int32_t *p_in = p_buf;
+
+
+  if (rate != meter_rate)
+  {
+    meter_rate = rate;
+    meter_window_frames = (rate * meter_window_ms) / 1000;
+    memset(&meter_acc, 0, sizeof(meter_acc));
+  }
+
+  sum_l = meter_acc.sum[0];
+  sum_r = meter_acc.sum[1];
+
+  for (; n >= 4; n -= 4)
+  {
+    uint32_t l01 = __PKHTB(p_in[2], p_in[0], 16);
+    uint32_t r01 = __PKHTB(p_in[3], p_in[1], 16);
+    uint32_t l23 = __PKHTB(p_in[6], p_in[4], 16);
+    uint32_t r23 = __PKHTB(p_in[7], p_in[5], 16);
+
+    sum_l = __SMLALD(l01, l01, sum_l);
+    sum_l = __SMLALD(l23, l23, sum_l);
+    sum_r = __SMLALD(r01, r01, sum_r);
+    sum_r = __SMLALD(r23, r23, sum_r);
+    meterMinMax(l01, l23, &max_l, &min_l);
+    meterMinMax(r01, r23, &max_r, &min_r);
+    p_in += METER_CH * 4;
+  }
+
+  // 남은 프레임은 두 레인에 같은 값을 넣는다. (제곱은 한 번만)
+  //
+  for (; n > 0; n--)
+  {
+    uint32_t vl = __PKHTB(p_in[0], p_in[0], 16);
+    uint32_t vr = __PKHTB(p_in[1], p_in[1], 16);
+
+    sum_l = __SMLALD(vl, vl & 0xFFFF, sum_l);
+    sum_r = __SMLALD(vr, vr & 0xFFFF, sum_r);
+    meterMinMax(vl, vl, &max_l, &min_l);
+    meterMinMax(vr, vr, &max_r, &min_r);
+    p_in += METER_CH;
+  }
+
+  peak_l = meterPeak16(max_l, min_l);
+  peak_r = meterPeak16(max_r, min_r);
+  if (peak_l >= (METER_CLIP_LEVEL >> 16))
+  {
+    meter_clip_cnt[0] += meterClipCount(&p_buf[0], frames);
+  }
+  if (peak_r >= (METER_CLIP_LEVEL >> 16))
+  {
+    meter_clip_cnt[1] += meterClipCount(&p_buf[1], frames);
+  }
+  peak_l = cmax(peak_l << 16, meter_acc.peak[0]);
+  peak_r = cmax(peak_r << 16, meter_acc.peak[1]);
+
+  meter_acc.peak[0] = peak_l;
+  meter_acc.peak[1] = peak_r;
+  meter_acc.sum[0]  = sum_l;
+  meter_acc.sum[1]  = sum_r;
+  meter_acc.frames += frames;
+
+  if (meter_acc.frames >= meter_window_frames)
+  {
+    meter_result = meter_acc;
+    meter_peak_hold[0] = peak_l > meter_peak_hold[0] ? peak_l : meter_peak_hold[0];
+    meter_peak_hold[1] = peak_r > meter_peak_hold[1] ? peak_r : meter_peak_hold[1];
+    memset(&meter_acc, 0, sizeof(meter_acc));
+    meter_update_cnt++;
+  }
+
+  // 스펙트럼용 모노 캡처
+  //
+  if (meter_fft_enable == true && meter_fft_state == METER_FFT_IDLE)
+  {
+    uint32_t start = meter_fft_wait < frames ? meter_fft_wait : frames;
+
+    meter_fft_wait -= start;
+    for (uint32_t i=start; i<frames && meter_fft_pos < METER_FFT_LEN; i++)
+    {
+      meter_fft_in[meter_fft_pos++] = ((float)p_buf[i*2 + 0] + (float)p_buf[i*2 + 1]) * (0.5f / 2147483648.0f);
+    }
+    if (meter_fft_pos >= METER_FFT_LEN)
+    {
+      meter_fft_rate  = rate;
+      meter_fft_state = METER_FFT_READY;
+      eventPost(EVENT_DSP);
+    }
+  }
+}
+
+
+#if CLI_USE(HW_METER)
+static void meterPrintDb(const char *p_name, int16_t db10)
+{
+  int16_t abs_db10 = db10 < 0 ? -db10 : db10;
+
+  cliPrintf("%s%c%d.%d dB", p_name, db10 < 0 ? '-':' ', abs_db10/10, abs_db10%10);
+}
+
+static void meterPrintLevel(void)
+{
+  meter_level_t level;
+
+  meterGetLevel(&level);
+  for (int ch=0; ch<METER_CH; ch++)
+  {
+    cliPrintf("%c ", ch == 0 ? 'L':'R');
+    meterPrintDb("peak ", level.peak_db10[ch]);
+    meterPrintDb(", rms ", level.rms_db10[ch]);
+    meterPrintDb(", hold ", level.peak_hold_db10[ch]);
+    cliPrintf(", clip %d\n", level.clip_cnt[ch]);
+  }
+}
+
+void cliMeter(cli_args_t *args)
+{
+  bool ret = false;
+
+
+  if (args->argc == 1 && args->isStr(0, "info"))
+  {
+    cliPrintf("enable : %s\n", meter_enable ? "on":"off");
+    cliPrintf("window : %d ms\n", meter_window_ms);
+    cliPrintf("update : %d\n", meter_update_cnt);
+    cliPrintf("fft    : %s, %d cycles\n", meter_fft_enable ? "on":"off", meter_fft_cycles);
+    meterPrintLevel();
+    ret = true;
+  }
+
+  if (args->argc == 1 && args->isStr(0, "show"))
+  {
+    uint32_t pre_cnt = meter_update_cnt;
+
+    while(cliKeepLoop())
+    {
+      if (meter_update_cnt != pre_cnt)
+      {
+        pre_cnt = meter_update_cnt;
+        meterPrintLevel();
+      }
+      delay(1);
+    }
+    ret = true;
+  }
+
+  if (args->argc == 1 && (args->isStr(0, "on") || args->isStr(0, "off")))
+  {
+    meterSetEnable(args->isStr(0, "on"));
+    ret = true;
+  }
+
+  if (args->argc == 2 && args->isStr(0, "window"))
+  {
+    if (meterSetWindow(args->getData(1)) != true)
+    {
+      cliPrintf("window 10 ~ 10000 ms\n");
+    }
+    ret = true;
+  }
+
+  if (args->argc == 1 && args->isStr(0, "clear"))
+  {
+    meterClear();
+    ret = true;
+  }
+
+  if (args->argc == 2 && args->isStr(0, "fft"))
+  {
+    meterSetFft(args->isStr(1, "on"));
+    ret = true;
+  }
+
+  if (args->argc == 1 && args->isStr(0, "fft"))
+  {
+    int16_t  db10[METER_BAND_MAX];
+    uint32_t hz[METER_BAND_MAX];
+
+    if (meterGetSpectrum(db10, hz, METER_BAND_MAX) == true)
+    {
+      for (int i=0; i<METER_BAND_MAX; i++)
+      {
+        int bar = (db10[i] + 900) / 20;
+
+        cliPrintf("%5d Hz ", hz[i]);
+        meterPrintDb("", db10[i]);
+        cliPrintf(" ");
+        for (int j=0; j<bar; j++)
+        {
+          cliPrintf("#");
+        }
+        cliPrintf("\n");
+      }
+    }
+    else
+    {
+      cliPrintf("no spectrum, meter on, meter fft on\n");
+    }
+    ret = true;
+  }
+
+  if (ret == false)
+  {
+    cliPrintf("meter info\n");
+    cliPrintf("meter on:off\n");
+    cliPrintf("meter show\n");
+    cliPrintf("meter clear\n");
+    cliPrintf("meter window ms\n");
+    cliPrintf("meter fft [on:off]\n");
+  }
+}
+#endif
+
+#endif
@@ -0,0 +1,358 @@
+#include "mixer.h"
+
+
+#ifdef _USE_HW_MIXER
+
+
+#define MIXER_SRC_FRAMES    32                        // 소스 채널을 만드는 단위 (스택 256 바이트)
+
+
+static void mixerUpdateGain(mixer_t *p_mixer, uint8_t ch);
+static void mixerUpdateSrcGain(mixer_t *p_mixer, uint8_t src);
+static uint32_t mixerAvailableCh(mixer_buf_t *p_buf);
+
+
+
+
+bool mixerInit(mixer_t *p_mixer)
+{
+  p_mixer->volume = 100;
+
+  for (int i=0; i<MIXER_MAX_CH; i++)
+  {
+    p_mixer->buf[i].length = MIXER_MAX_BUF_LEN;
+    p_mixer->buf[i].in     = 0;
+    p_mixer->buf[i].out    = 0;
+    p_mixer->buf[i].volume = 100;
+    mixerUpdateGain(p_mixer, i);
+  }
+  memset(p_mixer->src, 0, sizeof(p_mixer->src));
+  p_mixer->src_cnt = 0;
+
+  return true;
+}
+
+void mixerUpdateGain(mixer_t *p_mixer, uint8_t ch)
+{
+  p_mixer->buf[ch].gain = (32768 * p_mixer->buf[ch].volume / 100) * p_mixer->volume / 100;
+}
+
+void mixerUpdateSrcGain(mixer_t *p_mixer, uint8_t src)
+{
+  p_mixer->src[src].gain = (32768 * p_mixer->src[src].volume / 100) * p_mixer->volume / 100;
+}
+
+uint32_t mixerAvailableCh(mixer_buf_t *p_buf)
+{
+  return (p_buf->length + p_buf->in - p_buf->out) % p_buf->length;
+}
+
+// 스레드에서 호출한다. 공간이 모자라면 쓰지 않는다.
+//
+bool mixerWrite(mixer_t *p_mixer, uint8_t ch, const int16_t *p_data, uint32_t length)
+{
+  mixer_buf_t *p_buf;
+  uint32_t in;
+
+
+  // 스테레오 쌍 단위로만 쓴다.
+  //
+  if (ch >= MIXER_MAX_CH || (length & 1) || length > mixerAvailableForWrite(p_mixer, ch))
+  {
+    return false;
+  }
+  p_buf = &p_mixer->buf[ch];
+  in    = p_buf->in;
+
+  for (uint32_t i=0; i<length; i++)
+  {
+    p_buf->buf[in] = p_data[i];
+    in = (in + 1) % p_buf->length;
+  }
+
+  // 데이터를 다 쓴 후에 in 을 옮긴다.
+  //
+  __DMB();
+  p_buf->in = in;
+
+  return true;
+}
+
+// 모든 채널을 섞어서 16비트로 읽는다. 모자란 채널은 무음으로 본다.
+//
+bool mixerRead(mixer_t *p_mixer, int16_t *p_data, uint32_t length)
+{
+  memset(p_data, 0, length * sizeof(int16_t));
+
+  for (int ch=0; ch<MIXER_MAX_CH; ch++)
+  {
+    mixer_buf_t *p_buf = &p_mixer->buf[ch];
+    uint32_t len = mixerAvailableCh(p_buf);
+    uint32_t out = p_buf->out;
+
+    len = len < length ? len : length;
+    for (uint32_t i=0; i<len; i++)
+    {
+      int16_t sample = (int16_t)(((int32_t)p_buf->buf[out] * p_buf->gain) >> 15);
+
+      p_data[i] = mixerSamples(p_data[i], sample);
+      out = (out + 1) % p_buf->length;
+    }
+    p_buf->out = out;
+  }
+
+  return true;
+}
+
+// 소스 채널을 작은 단위로 만들어서 게인을 곱해 더한다.
+// 게인 32768(볼륨 100) 이면 소스 샘플이 그대로 더해진다.
+//
+static inline void mixerSrc(mixer_src_t *p_src, int32_t *p_buf, uint32_t frames)
+{
+  int32_t tmp[MIXER_SRC_FRAMES * 2];
+  int32_t gain = p_src->gain;
+
+  while (frames > 0)
+  {
+    uint32_t len = frames < MIXER_SRC_FRAMES ? frames : MIXER_SRC_FRAMES;
+
+    p_src->func(tmp, len, p_src->arg);
+    for (uint32_t i=0; i<len*2; i++)
+    {
+      p_buf[i] = __QADD(p_buf[i], (int32_t)(((int64_t)tmp[i] * gain) >> 15));
+    }
+    p_buf  += len * 2;
+    frames -= len;
+  }
+}
+
+// 처리 인터럽트 : 각 채널을 게인을 곱해 Q31 스테레오 블록에 포화 덧셈한다.
+// 솔로 소스가 켜져 있으면 채널 0(입력 블록)은 버린다.
+// 섞은 채널 수를 반환한다.
+//
+__RAMFUNC uint8_t mixerMix(mixer_t *p_mixer, int32_t *p_buf, uint32_t frames)
+{
+  uint8_t mix_cnt = 0;
+
+
+  for (int src=0; src<p_mixer->src_cnt; src++)
+  {
+    if (p_mixer->src[src].enable == true && p_mixer->src[src].solo == true)
+    {
+      memset(p_buf, 0, frames * 2 * sizeof(int32_t));
+      break;
+    }
+  }
+
+  for (int ch=0; ch<MIXER_MAX_CH; ch++)
+  {
+    mixer_buf_t *p_ch = &p_mixer->buf[ch];
+    uint32_t len  = mixerAvailableCh(p_ch) / 2;
+    uint32_t out  = p_ch->out;
+    int32_t  gain = p_ch->gain;
+    int32_t *p_out = p_buf;
+
+    if (len == 0)
+    {
+      continue;
+    }
+    len = len < frames ? len : frames;
+
+    for (uint32_t i=0; i<len; i++)
+    {
+      // 16비트 x Q15 = Q30, 한 비트 올려 Q31
+      //
+      p_out[0] = __QADD(p_out[0], ((int32_t)p_ch->buf[out + 0] * gain) << 1);
+      p_out[1] = __QADD(p_out[1], ((int32_t)p_ch->buf[out + 1] * gain) << 1);
+      p_out += 2;
+      out   += 2;
+      if (out >= p_ch->length)
+      {
+        out = 0;
+      }
+    }
+    p_ch->out = out;
+    mix_cnt++;
+  }
+
+  for (int src=0; src<p_mixer->src_cnt; src++)
+  {
+    mixer_src_t *p_src = &p_mixer->src[src];
+
+    if (p_src->enable != true)
+    {
+      continue;
+    }
+    mixerSrc(p_src, p_buf, frames);
+    mix_cnt++;
+  }
+
+  return mix_cnt;
+}
+
+// 초기화 때 등록만 하고 mixerSetSource() 로 켠다.
+//
+int8_t mixerAddSource(mixer_t *p_mixer, const char *name, MixerSrcFunc_t func, void *arg)
+{
+  mixer_src_t *p_src;
+
+  if (p_mixer->src_cnt >= MIXER_MAX_SRC || func == NULL)
+  {
+    return -1;
+  }
+  p_src = &p_mixer->src[p_mixer->src_cnt];
+  p_src->name   = name;
+  p_src->func   = func;
+  p_src->arg    = arg;
+  p_src->enable = false;
+  p_src->solo   = false;
+  p_src->volume = 100;
+  mixerUpdateSrcGain(p_mixer, p_mixer->src_cnt);
+
+  return p_mixer->src_cnt++;
+}
+
+bool mixerSetSource(mixer_t *p_mixer, uint8_t src, bool enable, bool solo)
+{
+  if (src >= p_mixer->src_cnt)
+  {
+    return false;
+  }
+  p_mixer->src[src].solo   = solo;
+  p_mixer->src[src].enable = enable;
+
+  return true;
+}
+
+bool mixerIsSource(mixer_t *p_mixer, uint8_t src)
+{
+  if (src >= p_mixer->src_cnt)
+  {
+    return false;
+  }
+  return p_mixer->src[src].enable;
+}
+
+// 섞을 것이 있는지 : 데이터가 남은 링 채널 또는 켜진 소스
+//
+bool mixerIsActive(mixer_t *p_mixer)
+{
+  for (int src=0; src<p_mixer->src_cnt; src++)
+  {
+    if (p_mixer->src[src].enable == true)
+    {
+      return true;
+    }
+  }
+  return mixerAvailable(p_mixer) > 0;
+}
+
+bool mixerIsEmpty(mixer_t *p_mixer, uint8_t ch)
+{
+  if (ch >= MIXER_MAX_CH)
+  {
+    return false;
+  }
+  return mixerAvailableCh(&p_mixer->buf[ch]) == 0;
+}
+
+bool mixerSetVolume(mixer_t *p_mixer, int32_t volume)
+{
+  p_mixer->volume = constrain(volume, 0, 100);
+
+  for (int i=0; i<MIXER_MAX_CH; i++)
+  {
+    mixerUpdateGain(p_mixer, i);
+  }
+  for (int i=0; i<p_mixer->src_cnt; i++)
+  {
+    mixerUpdateSrcGain(p_mixer, i);
+  }
+  return true;
+}
+
+int32_t mixerGetVolume(mixer_t *p_mixer)
+{
+  return p_mixer->volume;
+}
+
+bool mixerSetChVolume(mixer_t *p_mixer, uint8_t ch, int32_t volume)
+{
+  if (ch >= MIXER_MAX_CH)
+  {
+    return false;
+  }
+  p_mixer->buf[ch].volume = constrain(volume, 0, 100);
+  mixerUpdateGain(p_mixer, ch);
+
+  return true;
+}
+
+int32_t mixerGetChVolume(mixer_t *p_mixer, uint8_t ch)
+{
+  if (ch >= MIXER_MAX_CH)
+  {
+    return 0;
+  }
+  return p_mixer->buf[ch].volume;
+}
+
+// 가장 많이 남은 채널 기준
+//
+uint32_t mixerAvailable(mixer_t *p_mixer)
+{
+  uint32_t ret = 0;
+
+  for (int i=0; i<MIXER_MAX_CH; i++)
+  {
+    uint32_t len = mixerAvailableCh(&p_mixer->buf[i]);
+
+    if (len > ret)
+    {
+      ret = len;
+    }
+  }
+  return ret;
+}
+
+uint32_t mixerAvailableForWrite(mixer_t *p_mixer, uint8_t ch)
+{
+  if (ch >= MIXER_MAX_CH)
+  {
+    return 0;
+  }
+  // 가득 찬 것과 빈 것을 구분하기 위해 한 쌍을 비워둔다.
+  //
+  return p_mixer->buf[ch].length - 2 - mixerAvailableCh(&p_mixer->buf[ch]);
+}
+
+int8_t mixerGetEmptyChannel(mixer_t *p_mixer)
+{
+  for (int i=0; i<MIXER_MAX_CH; i++)
+  {
+    if (mixerAvailableCh(&p_mixer->buf[i]) == 0)
+    {
+      return i;
+    }
+  }
+  return -1;
+}
+
+int8_t mixerGetValidChannel(mixer_t *p_mixer, uint32_t length)
+{
+  for (int i=0; i<MIXER_MAX_CH; i++)
+  {
+    if (mixerAvailableForWrite(p_mixer, i) >= length)
+    {
+      return i;
+    }
+  }
+  return -1;
+}
+
+int16_t mixerSamples(int16_t a, int16_t b)
+{
+  return (int16_t)__SSAT((int32_t)a + (int32_t)b, 16);
+}
+
+#endif
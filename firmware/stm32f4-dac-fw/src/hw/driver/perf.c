@@ -0,0 +1,202 @@
+#include "perf.h"
+
+
+#ifdef _USE_HW_PERF
+#include "cli.h"
+
+
+#define PERF_BENCH_FRAMES       96                  // 96kHz 1ms
+#define PERF_BENCH_CH           2
+#define PERF_BENCH_LEN          (PERF_BENCH_FRAMES * PERF_BENCH_CH)
+#define PERF_BENCH_RING_LEN     1024                // 2의 배수
+#define PERF_BENCH_ITER         16
+
+
+#if CLI_USE(HW_PERF)
+static void cliPerf(cli_args_t *args);
+#endif
+static void perfKernelFlash(int32_t *p_dst, uint32_t index, int32_t gain);
+static void perfKernelRam(int32_t *p_dst, uint32_t index, int32_t gain);
+
+extern uint32_t _sramfunc;
+extern uint32_t _eramfunc;
+
+static int32_t perf_ring[PERF_BENCH_RING_LEN];
+static int32_t perf_out[PERF_BENCH_LEN];
+static const char *perf_profile_str[PERF_PROFILE_MAX] =
+{
+  "flash art",
+  "flash no prefetch",
+  "flash no icache",
+  "flash no art",
+  "sram",
+};
+
+
+
+
+bool perfInit(void)
+{
+  for (int i=0; i<PERF_BENCH_RING_LEN; i++)
+  {
+    perf_ring[i] = (int32_t)(i * 0x01234567);
+  }
+
+#if CLI_USE(HW_PERF)
+  cliAdd("perf", cliPerf);
+#endif
+  return true;
+}
+
+uint32_t perfGetRamFuncSize(void)
+{
+  return (uint32_t)&_eramfunc - (uint32_t)&_sramfunc;
+}
+
+// 오디오 경로와 같은 형태의 처리 : 링 버퍼 읽기, 워드 스왑, Q31 게인, 워드 스왑
+//
+static inline __attribute__((always_inline)) void perfKernel(int32_t *p_dst, uint32_t index, int32_t gain)
+{
+  for (uint32_t i=0; i<PERF_BENCH_LEN; i++)
+  {
+    int32_t sample;
+
+    sample = (int32_t)__ROR((uint32_t)perf_ring[index], 16);
+    sample = (int32_t)(((int64_t)sample * gain) >> 31);
+    p_dst[i] = (int32_t)__ROR((uint32_t)sample, 16);
+    index = (index + 1) & (PERF_BENCH_RING_LEN - 1);
+  }
+}
+
+void perfKernelFlash(int32_t *p_dst, uint32_t index, int32_t gain)
+{
+  perfKernel(p_dst, index, gain);
+}
+
+__RAMFUNC void perfKernelRam(int32_t *p_dst, uint32_t index, int32_t gain)
+{
+  perfKernel(p_dst, index, gain);
+}
+
+bool perfBench(PerfProfile_t profile, perf_result_t *p_result)
+{
+  uint32_t acr;
+  uint32_t primask;
+  uint32_t pre_cycles;
+  uint32_t exe_cycles;
+  uint32_t sum = 0;
+  void (*kernel)(int32_t *, uint32_t, int32_t);
+
+
+  if (profile >= PERF_PROFILE_MAX)
+  {
+    return false;
+  }
+  kernel = (profile == PERF_PROFILE_SRAM) ? perfKernelRam : perfKernelFlash;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  // 캐시는 꺼진 상태에서만 리셋할 수 있다.
+  //
+  acr = FLASH->ACR;
+  FLASH->ACR = acr & ~(FLASH_ACR_PRFTEN | FLASH_ACR_ICEN | FLASH_ACR_DCEN);
+  FLASH->ACR |= FLASH_ACR_ICRST | FLASH_ACR_DCRST;
+  FLASH->ACR &= ~(FLASH_ACR_ICRST | FLASH_ACR_DCRST);
+
+  switch(profile)
+  {
+    case PERF_PROFILE_FLASH_NO_PREFETCH:
+      FLASH->ACR |= FLASH_ACR_ICEN | FLASH_ACR_DCEN;
+      break;
+
+    case PERF_PROFILE_FLASH_NO_ICACHE:
+      FLASH->ACR |= FLASH_ACR_PRFTEN | FLASH_ACR_DCEN;
+      break;
+
+    case PERF_PROFILE_FLASH_NO_ART:
+      break;
+
+    default:
+      FLASH->ACR |= FLASH_ACR_PRFTEN | FLASH_ACR_ICEN | FLASH_ACR_DCEN;
+      break;
+  }
+
+  p_result->min_cycles = 0xFFFFFFFF;
+  for (int i=0; i<PERF_BENCH_ITER; i++)
+  {
+    pre_cycles = DWT->CYCCNT;
+    kernel(perf_out, i * 7, 0x40000000);
+    exe_cycles = DWT->CYCCNT - pre_cycles;
+
+    if (i == 0)
+    {
+      p_result->cold_cycles = exe_cycles;
+    }
+    if (exe_cycles < p_result->min_cycles)
+    {
+      p_result->min_cycles = exe_cycles;
+    }
+    sum += exe_cycles;
+  }
+  p_result->avg_cycles = sum / PERF_BENCH_ITER;
+
+  FLASH->ACR = acr;
+  __set_PRIMASK(primask);
+
+  return true;
+}
+
+
+#if CLI_USE(HW_PERF)
+void cliPerf(cli_args_t *args)
+{
+  bool ret = false;
+
+
+  if (args->argc == 1 && args->isStr(0, "info"))
+  {
+    cliPrintf("ramfunc     : 0x%X, %d bytes\n", (int)&_sramfunc, perfGetRamFuncSize());
+    cliPrintf("flash acr   : prefetch %d, icache %d, dcache %d, latency %d\n",
+      (FLASH->ACR & FLASH_ACR_PRFTEN) ? 1:0,
+      (FLASH->ACR & FLASH_ACR_ICEN) ? 1:0,
+      (FLASH->ACR & FLASH_ACR_DCEN) ? 1:0,
+      (int)(FLASH->ACR & FLASH_ACR_LATENCY));
+    ret = true;
+  }
+
+  if (args->argc == 1 && args->isStr(0, "bench"))
+  {
+    perf_result_t result;
+    uint32_t      base_cycles = 0;
+
+    cliPrintf("%d frames x %d ch, %d iter\n", PERF_BENCH_FRAMES, PERF_BENCH_CH, PERF_BENCH_ITER);
+    cliPrintf("profile              cold     min      avg   cyc/smp  vs art\n");
+    for (int i=0; i<PERF_PROFILE_MAX; i++)
+    {
+      perfBench(i, &result);
+      if (i == PERF_PROFILE_FLASH_ART)
+      {
+        base_cycles = result.avg_cycles;
+      }
+      cliPrintf("%-18s %6d  %6d  %6d   %3d.%02d  %3d%%\n",
+        perf_profile_str[i],
+        result.cold_cycles,
+        result.min_cycles,
+        result.avg_cycles,
+        result.avg_cycles / PERF_BENCH_LEN,
+        (result.avg_cycles * 100 / PERF_BENCH_LEN) % 100,
+        result.avg_cycles * 100 / base_cycles);
+    }
+    ret = true;
+  }
+
+  if (ret == false)
+  {
+    cliPrintf("perf info\n");
+    cliPrintf("perf bench\n");
+  }
+}
+#endif
+
+#endif
@@ -0,0 +1,143 @@
+#include "resample.h"
+
+
+#ifdef _USE_HW_RESAMPLE
+#include "arm_math.h"
+
+
+#define RESAMPLE_CH             2
+#define RESAMPLE_Q31_TO_F       (1.0f / 2147483648.0f)
+#define RESAMPLE_F_TO_Q31       (2147483647.0f)
+
+
+// polyphase FIR 업샘플러
+// 원형 필터 : Kaiser windowed sinc, 64 x 320 탭 (tools/resample_coef.py)
+//   통과 대역 0 ~ 20kHz ripple +-0.0001 dB, 저지 대역 24.1kHz ~ 92.8 dB (44.1k 입력 기준, float 테이블)
+//   지연 32 입력 샘플
+//
+static float    resample_hist[RESAMPLE_CH][RESAMPLE_TAPS * 2];   // 같은 샘플을 두 번 써서 항상 연속된 창을 만든다.
+static uint32_t resample_hist_pos = 0;
+static uint32_t resample_phase = 0;
+static uint32_t resample_step = RESAMPLE_PHASE;                 // 출력 샘플당 위상 증가
+static uint32_t resample_pending = 0;                            // 다음 출력 전에 넣어야 할 입력
+
+
+
+
+bool resampleIsValid(uint32_t in_rate, uint32_t out_rate)
+{
+  // 업샘플링이면서 출력 샘플마다 위상이 테이블에 정확히 떨어지는 비율만 지원한다.
+  //
+  if (in_rate == 0 || in_rate > out_rate)
+  {
+    return false;
+  }
+  return ((uint64_t)in_rate * RESAMPLE_PHASE) % out_rate == 0;
+}
+
+bool resampleSetRate(uint32_t in_rate, uint32_t out_rate)
+{
+  if (resampleIsValid(in_rate, out_rate) != true)
+  {
+    return false;
+  }
+
+  memset(resample_hist, 0, sizeof(resample_hist));
+  resample_hist_pos = 0;
+  resample_phase    = 0;
+  resample_pending  = 0;
+  resample_step     = (uint32_t)(((uint64_t)in_rate * RESAMPLE_PHASE) / out_rate);
+
+  return true;
+}
+
+uint32_t resampleGetInFrames(uint32_t out_frames)
+{
+  if (out_frames == 0)
+  {
+    return resample_pending;
+  }
+  return resample_pending + (resample_phase + resample_step * (out_frames - 1)) / RESAMPLE_PHASE;
+}
+
+static inline void resamplePush(const int32_t *p_in)
+{
+  uint32_t pos = resample_hist_pos;
+
+  // 링 버퍼 샘플은 DMA 전송 형식(상/하위 16비트 교환)이다.
+  //
+  for (int ch=0; ch<RESAMPLE_CH; ch++)
+  {
+    float x = (float)(int32_t)__ROR((uint32_t)p_in[ch], 16) * RESAMPLE_Q31_TO_F;
+
+    resample_hist[ch][pos] = x;
+    resample_hist[ch][pos + RESAMPLE_TAPS] = x;
+  }
+  resample_hist_pos = pos + 1 < RESAMPLE_TAPS ? pos + 1 : 0;
+}
+
+static inline int32_t resampleToQ31(float x)
+{
+  if (x >= 1.0f)
+    return INT32_MAX;
+  if (x < -1.0f)
+    return INT32_MIN;
+  return (int32_t)(x * RESAMPLE_F_TO_Q31);
+}
+
+// p_in 의 *p_in_frames 프레임 안에서 최대 out_frames 를 만든다. (Q31 출력)
+// 사용한 입력 프레임 수를 *p_in_frames 로 돌려준다.
+//
+__RAMFUNC uint32_t resampleProcess(int32_t *p_out, uint32_t out_frames, const int32_t *p_in, uint32_t *p_in_frames)
+{
+  uint32_t in_max = *p_in_frames;
+  uint32_t in_cnt = 0;
+  uint32_t out_cnt = 0;
+
+
+  while (out_cnt < out_frames)
+  {
+    while (resample_pending > 0 && in_cnt < in_max)
+    {
+      resamplePush(&p_in[in_cnt * RESAMPLE_CH]);
+      resample_pending--;
+      in_cnt++;
+    }
+    if (resample_pending > 0)
+    {
+      break;
+    }
+
+    for (int ch=0; ch<RESAMPLE_CH; ch++)
+    {
+      float *p_win = &resample_hist[ch][resample_hist_pos];
+      float  y;
+
+      // 위상 0 은 정수 위치라서 지연된 입력 그대로이다. (48k 에서는 출력의 절반)
+      //
+      if (resample_phase == 0)
+      {
+        y = p_win[RESAMPLE_TAPS/2 - 1];
+      }
+      else
+      {
+        arm_dot_prod_f32(p_win, (float *)resample_coef[resample_phase], RESAMPLE_TAPS, &y);
+      }
+      p_out[ch] = resampleToQ31(y);
+    }
+    p_out += RESAMPLE_CH;
+    out_cnt++;
+
+    resample_phase += resample_step;
+    while (resample_phase >= RESAMPLE_PHASE)
+    {
+      resample_phase -= RESAMPLE_PHASE;
+      resample_pending++;
+    }
+  }
+
+  *p_in_frames = in_cnt;
+  return out_cnt;
+}
+
+#endif
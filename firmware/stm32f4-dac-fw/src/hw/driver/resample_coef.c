@@ -0,0 +1,3212 @@
+// tools/resample_coef.py 로 생성된 파일, 직접 수정하지 않는다.
+//
+#include "resample.h"
+
+
+#ifdef _USE_HW_RESAMPLE
+
+const float resample_coef[RESAMPLE_PHASE][RESAMPLE_TAPS] =
+{
+  {
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 1.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+    0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f,
+  },
+  {
+    -1.984943955e-07f, 4.269140135e-07f, -7.942016303e-07f, 1.351940338e-06f, -2.163157430e-06f, 3.303430053e-06f, -4.861921144e-06f, 6.942356258e-06f,
+    -9.663977064e-06f, 1.316254179e-05f, -1.759148963e-05f, 2.312345002e-05f, -2.995236608e-05f, 3.829662745e-05f, -4.840379173e-05f, 6.055775229e-05f,
+    -7.508964567e-05f, 9.239449811e-05f, -1.129567954e-04f, 1.373902270e-04f, -1.665006043e-04f, 2.013880768e-04f, -2.436190078e-04f, 2.955281407e-04f,
+    -3.607808514e-04f, 4.454981809e-04f, -5.607312750e-04f, 7.286438470e-04f, -1.001044386e-03f, 1.533422895e-03f, -3.101810134e-03f, 9.999839623e-01f,
+    3.121424463e-03f, -1.538387415e-03f, 1.003293924e-03f, -7.299407579e-04f, 5.615847433e-04f, -4.461082387e-04f, 3.612416733e-04f, -2.958897537e-04f,
+    2.439104138e-04f, -2.016272642e-04f, 1.666993666e-04f, -1.375566764e-04f, 1.130967593e-04f, -9.251233460e-05f, 7.518873796e-05f, -6.064081795e-05f,
+    4.847308009e-05f, -3.835404755e-05f, 2.999957033e-05f, -2.316188909e-05f, 1.762244859e-05f, -1.318716395e-05f, 9.683279941e-06f, -6.957242591e-06f,
+    4.873187033e-06f, -3.311771574e-06f, 2.169176650e-06f, -1.356151292e-06f, 7.970365856e-07f, -4.287301646e-07f, 1.995809807e-07f, -6.822160196e-08f,
+  },
+  {
+    -3.958859908e-07f, 8.519749185e-07f, -1.585497556e-06f, 2.699547203e-06f, -4.320097343e-06f, 6.598213260e-06f, -9.712124254e-06f, 1.386917747e-05f,
+    -1.930774478e-05f, 2.629922296e-05f, -3.515036093e-05f, 4.620627520e-05f, -5.985469169e-05f, 7.653220319e-05f, -9.673369959e-05f, 1.210266839e-04f,
+    -1.500730577e-04f, 1.846623679e-04f, -2.257628749e-04f, 2.746009255e-04f, -3.327865989e-04f, 4.025178080e-04f, -4.869234566e-04f, 5.906666276e-04f,
+    -7.210667384e-04f, 8.903443259e-04f, -1.120556637e-03f, 1.455923589e-03f, -1.999749775e-03f, 3.061756745e-03f, -6.183890307e-03f, 9.999357141e-01f,
+    6.262346136e-03f, -3.081614013e-03f, 2.008747522e-03f, -1.461110992e-03f, 1.123970350e-03f, -8.927844413e-04f, 7.229099385e-04f, -5.921130105e-04f,
+    4.880890248e-04f, -4.034745119e-04f, 3.335816101e-04f, -2.752666911e-04f, 2.263227037e-04f, -1.851336912e-04f, 1.504694079e-04f, -1.213589306e-04f,
+    9.701083973e-05f, -7.676187259e-05f, 6.004349963e-05f, -4.636002411e-05f, 3.527419083e-05f, -2.639770688e-05f, 1.938495258e-05f, -1.392871995e-05f,
+    9.757185653e-06f, -6.631577751e-06f, 4.344173074e-06f, -2.716390214e-06f, 1.596836838e-06f, -8.592391793e-07f, 4.002321268e-07f, -1.370242684e-07f,
+  },
+  {
+    -5.921587496e-07f, 1.275146047e-06f, -2.373817463e-06f, 4.042698704e-06f, -6.470622311e-06f, 9.884045472e-06f, -1.455015872e-05f, 2.077981688e-05f,
+    -2.893039913e-05f, 3.940880811e-05f, -5.267495825e-05f, 6.924629422e-05f, -8.970414587e-05f, 1.147031018e-04f, -1.449851352e-04f, 1.814010482e-04f,
+    -2.249431043e-04f, 2.767948283e-04f, -3.384074989e-04f, 4.116190312e-04f, -4.988421534e-04f, 6.033700560e-04f, -7.298902183e-04f, 8.853874513e-04f,
+    -1.080823560e-03f, 1.334496516e-03f, -1.679423733e-03f, 2.181772181e-03f, -2.996026984e-03f, 4.584877641e-03f, -9.246125958e-03f, 9.998552583e-01f,
+    9.422645991e-03f, -4.629553444e-03f, 3.016270396e-03f, -2.193442933e-03f, 1.687103984e-03f, -1.339986342e-03f, 1.084970431e-03f, -8.886415539e-04f,
+    7.325125374e-04f, -6.055224678e-04f, 5.006307855e-04f, -4.131168840e-04f, 3.396670130e-04f, -2.778552210e-04f, 2.258348207e-04f, -1.821485435e-04f,
+    1.456086506e-04f, -1.152198166e-04f, 9.012892975e-05f, -6.959220159e-05f, 5.295355323e-05f, -3.963037923e-05f, 2.910410282e-05f, -2.091377677e-05f,
+    1.465153878e-05f, -9.959109596e-06f, 6.524788397e-06f, -4.080592469e-06f, 2.399328827e-06f, -1.291489343e-06f, 6.019367874e-07f, -2.064031850e-07f,
+  },
+  {
+    -7.872968423e-07f, 1.696391080e-06f, -3.159091589e-06f, 5.381273773e-06f, -8.614536093e-06f, 1.316062418e-05f, -1.937557616e-05f, 2.767363071e-05f,
+    -3.853103998e-05f, 5.249006679e-05f, -7.016363215e-05f, 9.224133353e-05f, -1.194979072e-04f, 1.528057095e-04f, -1.931535244e-04f, 2.416751155e-04f,
+    -2.996926739e-04f, 3.687831227e-04f, -4.508799569e-04f, 5.484315139e-04f, -6.646514784e-04f, 8.039257324e-04f, -9.724962249e-04f, 1.179662677e-03f,
+    -1.440017311e-03f, 1.777912955e-03f, -2.237280376e-03f, 2.906122828e-03f, -3.989787252e-03f, 6.102662501e-03f, -1.228840403e-02f, 9.997425996e-01f,
+    1.260220352e-02f, -6.182078560e-03f, 4.025771758e-03f, -2.926868584e-03f, 2.250932655e-03f, -1.787671565e-03f, 1.447388707e-03f, -1.185447103e-03f,
+    9.771576048e-04f, -8.077518143e-04f, 6.678309130e-04f, -5.510940651e-04f, 4.531188423e-04f, -3.706680540e-04f, 3.012777700e-04f, -2.430038470e-04f,
+    1.942618720e-04f, -1.537242107e-04f, 1.202529940e-04f, -9.285621109e-05f, 7.065885667e-05f, -5.288392692e-05f, 3.883981201e-05f, -2.791175501e-05f,
+    1.955578726e-05f, -1.329405663e-05f, 8.710820628e-06f, -5.448632973e-06f, 3.204440093e-06f, -1.725442616e-06f, 8.046781086e-07f, -2.763534282e-07f,
+  },
+  {
+    -9.812846473e-07f, 2.115674051e-06f, -3.941250728e-06f, 6.715152175e-06f, -1.075164365e-05f, 1.642764857e-05f, -2.418793050e-05f, 3.454997822e-05f,
+    -4.810877115e-05f, 6.554177360e-05f, -8.761473964e-05f, 1.151892276e-04f, -1.492331643e-04f, 1.908364247e-04f, -2.412343076e-04f, 3.018431737e-04f,
+    -3.743146762e-04f, 4.606185195e-04f, -5.631695683e-04f, 6.850253791e-04f, -8.301988273e-04f, 1.004165800e-03f, -1.214718471e-03f, 1.473464447e-03f,
+    -1.798614082e-03f, 2.220551976e-03f, -2.794074557e-03f, 3.628908995e-03f, -4.980942241e-03f, 7.614989081e-03f, -1.531061299e-02f, 9.995977445e-01f,
+    1.580089674e-02f, -7.739061422e-03f, 5.037160437e-03f, -3.661319722e-03f, 2.815403229e-03f, -2.235797633e-03f, 1.810130241e-03f, -1.482501317e-03f,
+    1.222000831e-03f, -1.010143193e-03f, 8.351659788e-04f, -6.891850162e-04f, 5.666673226e-04f, -4.635633003e-04f, 3.767910319e-04f, -3.039190175e-04f,
+    2.429658512e-04f, -1.922713759e-04f, 1.504128174e-04f, -1.161498354e-04f, 8.838841654e-05f, -6.615709148e-05f, 4.859115805e-05f, -3.492199395e-05f,
+    2.446946990e-05f, -1.663610686e-05f, 1.090206668e-05f, -6.820385874e-06f, 4.012097656e-06f, -2.161060622e-06f, 1.008439035e-06f, -3.468699649e-07f,
+  },
+  {
+    -1.174106751e-06f, 2.532959348e-06f, -4.720226235e-06f, 8.044214521e-06f, -1.288175115e-05f, 1.968481951e-05f, -2.898677794e-05f, 4.140822173e-05f,
+    -5.766270046e-05f, 7.856270834e-05f, -1.050266442e-04f, 1.380878190e-04f, -1.789071157e-04f, 2.287916580e-04f, -2.892229402e-04f, 3.618995289e-04f,
+    -4.488020425e-04f, 5.522923132e-04f, -6.752656831e-04f, 8.213876693e-04f, -9.954684975e-04f, 1.204071275e-03f, -1.456534014e-03f, 1.766764983e-03f,
+    -2.156580065e-03f, 2.662372041e-03f, -3.349754447e-03f, 4.350064413e-03f, -5.969404050e-03f, 9.121735984e-03f, -1.831264279e-02f, 9.994207014e-01f,
+    1.901860221e-02f, -9.300373310e-03f, 6.050344883e-03f, -4.396727910e-03f, 3.380462430e-03f, -2.684321967e-03f, 2.173160435e-03f, -1.779775795e-03f,
+    1.467018771e-03f, -1.212677208e-03f, 1.002619937e-03f, -8.273764923e-04f, 6.803015624e-04f, -5.565320506e-04f, 4.523673665e-04f, -3.648882172e-04f,
+    2.917159237e-04f, -2.308576238e-04f, 1.806055170e-04f, -1.394708507e-04f, 1.061405429e-04f, -7.944861021e-05f, 5.835721547e-05f, -4.194383027e-05f,
+    2.939212351e-05f, -1.998494680e-05f, 1.309832238e-05f, -8.195724556e-06f, 4.822228019e-06f, -2.598304651e-06f, 1.213202308e-06f, -4.179476529e-07f,
+  },
+  {
+    -1.365747950e-06f, 2.948211718e-06f, -5.495950030e-06f, 9.368342270e-06f, -1.500466601e-05f, 2.293183960e-05f, -3.377167707e-05f, 4.824772672e-05f,
+    -6.719193986e-05f, 9.155165606e-05f, -1.223977162e-04f, 1.609349588e-04f, -2.085169703e-04f, 2.666678329e-04f, -3.371148931e-04f, 4.218385056e-04f,
+    -5.231477265e-04f, 6.437958247e-04f, -7.871576838e-04f, 9.575054650e-04f, -1.160444832e-03f, 1.403623228e-03f, -1.697919981e-03f, 2.059536588e-03f,
+    -2.513881554e-03f, 3.103331749e-03f, -3.904268400e-03f, 5.069523081e-03f, -6.955085219e-03f, 1.062278266e-02f, -2.129438492e-02f, 9.992114806e-01f,
+    2.225519500e-02f, -1.086588473e-02f, 7.065233180e-03f, -5.133024496e-03f, 3.946056842e-03f, -3.133201891e-03f, 2.536444617e-03f, -2.077242081e-03f,
+    1.712187939e-03f, -1.415334426e-03f, 1.170176712e-03f, -9.656552225e-04f, 7.940106483e-04f, -6.495653770e-04f, 5.279995181e-04f, -4.259055955e-04f,
+    3.405074142e-04f, -2.694792565e-04f, 2.108282020e-04f, -1.628170269e-04f, 1.239135407e-04f, -9.275721622e-05f, 6.813705551e-05f, -4.897659805e-05f,
+    3.432328294e-05f, -2.334026152e-05f, 1.529938251e-05f, -9.574521652e-06f, 5.634757173e-06f, -3.037135663e-06f, 1.418950473e-06f, -4.895812406e-07f,
+  },
+  {
+    -1.556193250e-06f, 3.361396264e-06f, -6.268354608e-06f, 1.068741775e-05f, -1.712019689e-05f, 2.616841320e-05f, -3.854218886e-05f, 5.506786185e-05f,
+    -7.669560550e-05f, 1.045074072e-04f, -1.397263326e-04f, 1.837285066e-04f, -2.380599479e-04f, 3.044613858e-04f, -3.849056532e-04f, 4.816544477e-04f,
+    -5.973447048e-04f, 7.351204029e-04f, -8.988349851e-04f, 1.093365886e-03f, -1.325112221e-03f, 1.602802787e-03f, -1.938853565e-03f, 2.351751651e-03f,
+    -2.870484951e-03f, 3.543389835e-03f, -4.457564959e-03f, 5.787219273e-03f, -7.937898735e-03f, 1.211800944e-02f, -2.425573240e-02f, 9.989700943e-01f,
+    2.551054876e-02f, -1.243546543e-02f, 8.081733052e-03f, -5.870140626e-03f, 4.512132922e-03f, -3.582394638e-03f, 2.899948050e-03f, -2.374871665e-03f,
+    1.957484803e-03f, -1.618095377e-03f, 1.337820197e-03f, -1.104007911e-03f, 9.077836460e-04f, -7.426543342e-04f, 6.036802161e-04f, -4.869652887e-04f,
+    3.893356364e-04f, -3.081325671e-04f, 2.410779743e-04f, -1.861861277e-04f, 1.417057097e-04f, -1.060816386e-04f, 7.792974624e-05f, -5.601962893e-05f,
+    3.926248116e-05f, -2.670173464e-05f, 1.750504077e-05f, -1.095664905e-05f, 6.449610605e-06f, -3.477514291e-06f, 1.625665872e-06f, -5.617653676e-07f,
+  },
+  {
+    -1.745427869e-06f, 3.772478456e-06f, -7.037373038e-06f, 1.200132415e-05f, -1.922815370e-05f, 2.939424644e-05f, -4.329787671e-05f, 6.186799907e-05f,
+    -8.617281777e-05f, 1.174287578e-04f, -1.570108775e-04f, 2.064663308e-04f, -2.675332788e-04f, 3.421687665e-04f, -4.325907233e-04f, 5.413417188e-04f,
+    -6.713859779e-04f, 8.262574248e-04f, -1.010287036e-03f, 1.228956092e-03f, -1.489455102e-03f, 1.801591136e-03f, -2.179312032e-03f, 2.643382648e-03f,
+    -3.226356769e-03f, 3.982505179e-03f, -5.009592861e-03f, 6.503087547e-03f, -8.917758040e-03f, 1.360729748e-02f, -2.719657977e-02f, 9.986965565e-01f,
+    2.878453566e-02f, -1.400898440e-02f, 9.099751868e-03f, -6.608007245e-03f, 5.078636996e-03f, -4.031857352e-03f, 3.263635927e-03f, -2.672635987e-03f,
+    2.202885791e-03f, -1.820940561e-03f, 1.505534260e-03f, -1.242421240e-03f, 1.021609602e-03f, -8.357899599e-04f, 6.794021755e-04f, -5.480614212e-04f,
+    4.381958938e-04f, -3.468138400e-04f, 2.713519286e-04f, -2.095759109e-04f, 1.595153450e-04f, -1.194206026e-04f, 8.773435257e-05f, -6.307225207e-05f,
+    4.420924924e-05f, -3.006904838e-05f, 1.971508987e-05f, -1.234197793e-05f, 7.266713306e-06f, -3.919400843e-06f, 1.833330653e-06f, -6.344945643e-07f,
+  },
+  {
+    -1.933437235e-06f, 4.181424123e-06f, -7.802938972e-06f, 1.330994556e-05f, -2.132834767e-05f, 3.260904725e-05f, -4.803830650e-05f, 6.864751359e-05f,
+    -9.562270141e-05f, 1.303145094e-04f, -1.742497421e-04f, 2.291463087e-04f, -2.969342048e-04f, 3.797864386e-04f, -4.801656233e-04f, 6.008947025e-04f,
+    -7.452645704e-04f, 9.171982964e-04f, -1.121503321e-03f, 1.364263286e-03f, -1.653457964e-03f, 1.999969523e-03f, -2.419272719e-03f, 2.934402144e-03f,
+    -3.581463631e-03f, 4.420636806e-03f, -5.560301041e-03f, 7.217062747e-03f, -9.894577038e-03f, 1.509052887e-02f, -3.011682311e-02f, 9.983908831e-01f,
+    3.207702646e-02f, -1.558630987e-02f, 1.011919665e-02f, -7.346555107e-03f, 5.645515269e-03f, -4.481547093e-03f, 3.627473382e-03f, -2.970506440e-03f,
+    2.448367295e-03f, -2.023850445e-03f, 1.673302742e-03f, -1.380881869e-03f, 1.135477543e-03f, -9.289632760e-04f, 7.551580978e-04f, -6.091881057e-04f,
+    4.870834803e-04f, -3.855193517e-04f, 3.016471525e-04f, -2.329841284e-04f, 1.773407369e-04f, -1.327728294e-04f, 9.754993643e-05f, -7.013379428e-05f,
+    4.916311643e-05f, -3.344188361e-05f, 2.192932149e-05f, -1.373037872e-05f, 8.085989771e-06f, -4.362755305e-06f, 2.041926766e-06f, -7.077632525e-07f,
+  },
+  {
+    -2.120206989e-06f, 4.588199465e-06f, -8.564986649e-06f, 1.461316693e-05f, -2.342059127e-05f, 3.581252541e-05f, -5.276304660e-05f, 7.540578402e-05f,
+    -1.050443856e-04f, 1.431634693e-04f, -1.914413250e-04f, 2.517663268e-04f, -3.262599788e-04f, 4.173108796e-04f, -5.276258900e-04f, 6.603078033e-04f,
+    -8.189735321e-04f, 1.007934454e-03f, -1.232473359e-03f, 1.499274713e-03f, -1.817105347e-03f, 2.197919253e-03f, -2.658713038e-03f, 3.224782798e-03f,
+    -3.935772278e-03f, 4.857743891e-03f, -6.109638636e-03f, 7.929080008e-03f, -1.086827010e-02f, 1.656758653e-02f, -3.301636004e-02f, 9.980530920e-01f,
+    3.538789045e-02f, -1.716730935e-02f, 1.113997409e-02f, -8.085714775e-03f, 6.212713828e-03f, -4.931420838e-03f, 3.991425489e-03f, -3.268454369e-03f,
+    2.693905668e-03f, -2.226805466e-03f, 1.841109458e-03f, -1.519376435e-03f, 1.249376479e-03f, -1.022165289e-03f, 8.309406716e-04f, -6.703394441e-04f,
+    5.359936800e-04f, -4.242453703e-04f, 3.319607270e-04f, -2.564085269e-04f, 1.951801713e-04f, -1.461370370e-04f, 1.073755568e-04f, -7.720358005e-05f,
+    5.412361021e-05f, -3.681991981e-05f, 2.414752633e-05f, -1.512172117e-05f, 8.907364012e-06f, -4.807537344e-06f, 2.251435964e-06f, -7.815657450e-07f,
+  },
+  {
+    -2.305722986e-06f, 4.992771048e-06f, -9.323450900e-06f, 1.591087415e-05f, -2.550469834e-05f, 3.900439252e-05f, -5.747166795e-05f, 8.214219237e-05f,
+    -1.144370040e-04f, 1.559744507e-04f, -2.085840320e-04f, 2.743242809e-04f, -3.555078655e-04f, 4.547385813e-04f, -5.749670777e-04f, 7.195754470e-04f,
+    -8.925059382e-04f, 1.098457365e-03f, -1.343186706e-03f, 1.633977660e-03f, -1.980381843e-03f, 2.395421700e-03f, -2.897610481e-03f, 3.514497361e-03f,
+    -4.289249569e-03f, 5.293785764e-03f, -6.657554992e-03f, 8.639074766e-03f, -1.183875208e-02f, 1.803835430e-02f, -3.589508973e-02f, 9.976832026e-01f,
+    3.871699552e-02f, -1.875184961e-02f, 1.216199053e-02f, -8.825416636e-03f, 6.780178649e-03f, -5.381435492e-03f, 4.355457267e-03f, -3.566451081e-03f,
+    2.939477232e-03f, -2.429786035e-03f, 2.008938202e-03f, -1.657891559e-03f, 1.363295404e-03f, -1.115386992e-03f, 9.067425733e-04f, -7.315095276e-04f,
+    5.849217686e-04f, -4.629881567e-04f, 3.622897270e-04f, -2.798468475e-04f, 2.130319296e-04f, -1.595119393e-04f, 1.172102697e-04f, -8.428093163e-05f,
+    5.909025630e-05f, -4.020283519e-05f, 2.636949411e-05f, -1.651587432e-05f, 9.730759559e-06f, -5.253706314e-06f, 2.461839809e-06f, -8.558962465e-07f,
+  },
+  {
+    -2.489971292e-06f, 5.395105811e-06f, -1.007826715e-05f, 1.720295397e-05f, -2.758048401e-05f, 4.218436208e-05f, -6.216374406e-05f, 8.885612412e-05f,
+    -1.237996949e-04f, 1.687462725e-04f, -2.256762768e-04f, 2.968180766e-04f, -3.846751415e-04f, 4.920660504e-04f, -6.221847588e-04f, 7.786920811e-04f,
+    -9.658548904e-04f, 1.188758526e-03f, -1.453632958e-03f, 1.768359463e-03f, -2.143272099e-03f, 2.592458298e-03f, -3.135942615e-03f, 3.803518684e-03f,
+    -4.641862486e-03f, 5.728721911e-03f, -7.203999663e-03f, 9.346982758e-03f, -1.280593831e-02f, 1.950271691e-02f, -3.875291287e-02f, 9.972812367e-01f,
+    4.206420813e-02f, -2.033979669e-02f, 1.318515202e-02f, -9.565590900e-03f, 7.347855599e-03f, -5.831547883e-03f, 4.719533683e-03f, -3.864467838e-03f,
+    3.185058276e-03f, -2.632772536e-03f, 2.176772747e-03f, -1.796413842e-03f, 1.477223295e-03f, -1.208619364e-03f, 9.825564677e-04f, -7.926924376e-04f,
+    6.338630129e-04f, -5.017439644e-04f, 3.926312211e-04f, -3.032968263e-04f, 2.308942889e-04f, -1.728962470e-04f, 1.270531286e-04f, -9.136516908e-05f,
+    6.406257874e-05f, -4.359030663e-05f, 2.859501361e-05f, -1.791270653e-05f, 1.055609947e-05f, -5.701221255e-06f, 2.673119667e-06f, -9.307488532e-07f,
+  },
+  {
+    -2.672938191e-06f, 5.795171063e-06f, -1.082937143e-05f, 1.848929410e-05f, -2.964776477e-05f, 4.535214948e-05f, -6.683885105e-05f, 9.554696830e-05f,
+    -1.331316012e-04f, 1.814777600e-04f, -2.427164804e-04f, 3.192456289e-04f, -4.137590956e-04f, 5.292898083e-04f, -6.692745240e-04f, 8.376521752e-04f,
+    -1.039013517e-03f, 1.278829471e-03f, -1.563801746e-03f, 1.902407501e-03f, -2.305760818e-03f, 2.789010551e-03f, -3.373687093e-03f, 4.091819718e-03f,
+    -4.993578135e-03f, 6.162511978e-03f, -7.748922424e-03f, 1.005274003e-02f, -1.376974460e-02f, 2.096056000e-02f, -4.158973175e-02f, 9.968472174e-01f,
+    4.542939331e-02f, -2.193101595e-02f, 1.420936426e-02f, -1.030616761e-02f, 7.915690444e-03f, -6.281714775e-03f, 5.083619653e-03f, -4.162475869e-03f,
+    3.430625059e-03f, -2.835745331e-03f, 2.344596843e-03f, -1.934929867e-03f, 1.591149115e-03f, -1.301853372e-03f, 1.058375009e-03f, -8.538822462e-04f,
+    6.828126718e-04f, -5.405090400e-04f, 4.229822719e-04f, -3.267561946e-04f, 2.487655224e-04f, -1.862886677e-04f, 1.369031841e-04f, -9.845561031e-05f,
+    6.904009991e-05f, -4.698200977e-05f, 3.082387265e-05f, -1.931208548e-05f, 1.138330634e-05f, -6.150040898e-06f, 2.885256714e-06f, -1.006117553e-06f,
+  },
+  {
+    -2.854610178e-06f, 6.192934493e-06f, -1.157670038e-05f, 1.976978316e-05f, -3.170635846e-05f, 4.850747205e-05f, -7.149656770e-05f, 1.022141175e-04f,
+    -1.424318705e-04f, 1.941677443e-04f, -2.597030722e-04f, 3.416048629e-04f, -4.427570287e-04f, 5.664063920e-04f, -7.162319825e-04f, 8.964502219e-04f,
+    -1.111974974e-03f, 1.368661761e-03f, -1.673682745e-03f, 2.036109203e-03f, -2.467832758e-03f, 2.985060032e-03f, -3.610821647e-03f, 4.379373513e-03f,
+    -5.344363751e-03f, 6.595115778e-03f, -8.292273266e-03f, 1.075628295e-02f, -1.473008727e-02f, 2.241177010e-02f, -4.440545018e-02f, 9.963811701e-01f,
+    4.881241471e-02f, -2.352537200e-02f, 1.523453267e-02f, -1.104707664e-02f, 8.483628852e-03f, -6.731892864e-03f, 5.447680050e-03f, -4.460446368e-03f,
+    3.676153816e-03f, -3.038684757e-03f, 2.512394225e-03f, -2.073426203e-03f, 1.705061814e-03f, -1.395079971e-03f, 1.134190841e-03f, -9.150730167e-04f,
+    7.317659967e-04f, -5.792796238e-04f, 4.533399368e-04f, -3.502226789e-04f, 2.666438994e-04f, -1.996879054e-04f, 1.467594844e-04f, -1.055515712e-04f,
+    7.402234058e-05f, -5.037761904e-05f, 3.305585815e-05f, -2.071387820e-05f, 1.221230229e-05f, -6.600123669e-06f, 3.098231936e-06f, -1.081996226e-06f,
+  },
+  {
+    -3.034973967e-06f, 6.588364162e-06f, -1.232019123e-05f, 2.104431070e-05f, -3.375608428e-05f, 5.165004905e-05f, -7.613647550e-05f, 1.088569679e-04f,
+    -1.516996553e-04f, 2.068150629e-04f, -2.766344890e-04f, 3.638937138e-04f, -4.716662547e-04f, 6.034123539e-04f, -7.630527629e-04f, 9.550807370e-04f,
+    -1.184732446e-03f, 1.458246994e-03f, -1.783265666e-03f, 2.169452046e-03f, -2.629472737e-03f, 3.180588383e-03f, -3.847324097e-03f, 4.666153228e-03f,
+    -5.694186698e-03f, 7.026493289e-03f, -8.834002408e-03f, 1.145754820e-02f, -1.568688314e-02f, 2.385623468e-02f, -4.719997356e-02f, 9.958831219e-01f,
+    5.221313456e-02f, -2.512272881e-02f, 1.626056237e-02f, -1.178824772e-02f, 9.051616398e-03f, -7.182038787e-03f, 5.811679702e-03f, -4.758350495e-03f,
+    3.921620754e-03f, -3.241571133e-03f, 2.680148610e-03f, -2.211889405e-03f, 1.818950329e-03f, -1.488290104e-03f, 1.209996598e-03f, -9.762588041e-04f,
+    7.807182319e-04f, -6.180519498e-04f, 4.837012678e-04f, -3.736940014e-04f, 2.845276855e-04f, -2.130926614e-04f, 1.566210749e-04f, -1.126523657e-04f,
+    7.900881995e-05f, -5.377680762e-05f, 3.529075615e-05f, -2.211795107e-05f, 1.304300900e-05f, -7.051427693e-06f, 3.312026129e-06f, -1.158378646e-06f,
+  },
+  {
+    -3.214016485e-06f, 6.981428514e-06f, -1.305978185e-05f, 2.231276721e-05f, -3.579676286e-05f, 5.477960171e-05f, -8.075815864e-05f, 1.154749195e-04f,
+    -1.609341128e-04f, 2.194185597e-04f, -2.935091762e-04f, 3.861101271e-04f, -5.004841000e-04f, 6.403042623e-04f, -8.097325133e-04f, 1.013538260e-03f,
+    -1.257279145e-03f, 1.547576805e-03f, -1.892540266e-03f, 2.302423556e-03f, -2.790665634e-03f, 3.375577318e-03f, -4.083172350e-03f, 4.952132126e-03f,
+    -6.043014476e-03f, 7.456604665e-03f, -9.374060296e-03f, 1.215647278e-02f, -1.664004954e-02f, 2.529384213e-02f, -4.997320884e-02f, 9.953531016e-01f,
+    5.563141371e-02f, -2.672294961e-02f, 1.728735818e-02f, -1.252961043e-02f, 9.619598570e-03f, -7.632109126e-03f, 6.175583401e-03f, -5.056159384e-03f,
+    4.167002059e-03f, -3.444384761e-03f, 2.847843700e-03f, -2.350306014e-03f, 1.932803587e-03f, -1.581474707e-03f, 1.285784907e-03f, -1.037433656e-03f,
+    8.296646149e-04f, -6.568222462e-04f, 5.140633118e-04f, -3.971678799e-04f, 3.024151426e-04f, -2.265016336e-04f, 1.664869989e-04f, -1.197573056e-04f,
+    8.399905571e-05f, -5.717924758e-05f, 3.752835179e-05f, -2.352416982e-05f, 1.387534770e-05f, -7.503910792e-06f, 3.526619901e-06f, -1.235258476e-06f,
+  },
+  {
+    -3.391724877e-06f, 7.372096372e-06f, -1.379541072e-05f, 2.357504414e-05f, -3.782821617e-05f, 5.789585328e-05f, -8.536120408e-05f, 1.220673758e-04f,
+    -1.701344054e-04f, 2.319770849e-04f, -3.103255872e-04f, 4.082520587e-04f, -5.292079045e-04f, 6.770787020e-04f, -8.562669018e-04f, 1.071817355e-03f,
+    -1.329608314e-03f, 1.636642859e-03f, -2.001496341e-03f, 2.435011311e-03f, -2.951396387e-03f, 3.570008626e-03f, -4.318344402e-03f, 5.237283582e-03f,
+    -6.390814721e-03f, 7.885410232e-03f, -9.912397613e-03f, 1.285299404e-02f, -1.758950429e-02f, 2.672448178e-02f, -5.272506454e-02f, 9.947911402e-01f,
+    5.906711161e-02f, -2.832589700e-02f, 1.831482462e-02f, -1.327109419e-02f, 1.018752077e-02f, -8.082060408e-03f, 6.539355900e-03f, -5.353844141e-03f,
+    4.412273898e-03f, -3.647105924e-03f, 3.015463181e-03f, -2.488662560e-03f, 2.046610504e-03f, -1.674624705e-03f, 1.361548384e-03f, -1.098591613e-03f,
+    8.786003771e-04f, -6.955867358e-04f, 5.444231113e-04f, -4.206420283e-04f, 3.203045294e-04f, -2.399135176e-04f, 1.763562973e-04f, -1.268657011e-04f,
+    8.899256407e-05f, -6.058460980e-05f, 3.976842935e-05f, -2.493239956e-05f, 1.470923919e-05f, -7.957530497e-06f, 3.741993674e-06f, -1.312629275e-06f,
+  },
+  {
+    -3.568086505e-06f, 7.760336944e-06f, -1.452701694e-05f, 2.483103392e-05f, -3.985026765e-05f, 6.099852899e-05f, -8.994520159e-05f, 1.286337444e-04f,
+    -1.792997003e-04f, 2.444894955e-04f, -3.270821841e-04f, 4.303174752e-04f, -5.578350212e-04f, 7.137322740e-04f, -9.026516165e-04f, 1.129912611e-03f,
+    -1.401713226e-03f, 1.725436861e-03f, -2.110123733e-03f, 2.567202941e-03f, -3.111649999e-03f, 3.763864171e-03f, -4.552818340e-03f, 5.521581083e-03f,
+    -6.737555210e-03f, 8.312870496e-03f, -1.044896528e-02f, 1.354704964e-02f, -1.853516578e-02f, 2.814804387e-02f, -5.545545076e-02f, 9.941972703e-01f,
+    6.252008636e-02f, -2.993143288e-02f, 1.934286597e-02f, -1.401262830e-02f, 1.075532834e-02f, -8.531849115e-03f, 6.902961923e-03f, -5.651375850e-03f,
+    4.657412418e-03f, -3.849714892e-03f, 3.182990731e-03f, -2.626945561e-03f, 2.160359985e-03f, -1.767731015e-03f, 1.437279641e-03f, -1.159726708e-03f,
+    9.275207440e-04f, -7.343416365e-04f, 5.747777041e-04f, -4.441141566e-04f, 3.381941012e-04f, -2.533270059e-04f, 1.862280086e-04f, -1.339768604e-04f,
+    9.398885980e-05f, -6.399256407e-05f, 4.201077228e-05f, -2.634250479e-05f, 1.554460381e-05f, -8.412244045e-06f, 3.958127685e-06f, -1.390484494e-06f,
+  },
+  {
+    -3.743088948e-06f, 8.146119820e-06f, -1.525454024e-05f, 2.608062990e-05f, -4.186274213e-05f, 6.408735615e-05f, -9.450974374e-05f, 1.351734365e-04f,
+    -1.884291699e-04f, 2.569546548e-04f, -3.437774372e-04f, 4.523043542e-04f, -5.863628168e-04f, 7.502615965e-04f, -9.488823666e-04f, 1.187818642e-03f,
+    -1.473587182e-03f, 1.813950553e-03f, -2.218412327e-03f, 2.698986129e-03f, -3.271411533e-03f, 3.957125894e-03f, -4.786572346e-03f, 5.804998228e-03f,
+    -7.083203861e-03f, 8.738946145e-03f, -1.098371445e-02f, 1.423857761e-02f, -1.947695288e-02f, 2.956441962e-02f, -5.816427918e-02f, 9.935715265e-01f,
+    6.599019467e-02f, -3.153941852e-02f, 2.037138622e-02f, -1.475414192e-02f, 1.132296651e-02f, -8.981431683e-03f, 7.266366162e-03f, -5.948725574e-03f,
+    4.902393752e-03f, -4.052191923e-03f, 3.350410015e-03f, -2.765141527e-03f, 2.274040930e-03f, -1.860784547e-03f, 1.512971281e-03f, -1.220832970e-03f,
+    9.764209360e-04f, -7.730831612e-04f, 6.051241240e-04f, -4.675819714e-04f, 3.560821103e-04f, -2.667407885e-04f, 1.961011693e-04f, -1.410900900e-04f,
+    9.898745630e-05f, -6.740277911e-05f, 4.425516323e-05f, -2.775434940e-05f, 1.638136150e-05f, -8.868008383e-06f, 4.175001988e-06f, -1.468817477e-06f,
+  },
+  {
+    -3.916720002e-06f, 8.529414979e-06f, -1.597792099e-05f, 2.732372644e-05f, -4.386546592e-05f, 6.716206410e-05f, -9.905442600e-05f, 1.416858671e-04f,
+    -1.975219918e-04f, 2.693714332e-04f, -3.604098258e-04f, 4.742106841e-04f, -6.147886716e-04f, 7.866633047e-04f, -9.949548823e-04f, 1.245530086e-03f,
+    -1.545223519e-03f, 1.902175713e-03f, -2.326352054e-03f, 2.830348613e-03f, -3.430666123e-03f, 4.149775814e-03f, -5.019584696e-03f, 6.087508735e-03f,
+    -7.427728739e-03f, 9.163598055e-03f, -1.151659654e-02f, 1.492751630e-02f, -2.041478502e-02f, 3.097350118e-02f, -6.085146307e-02f, 9.929139450e-01f,
+    6.947729189e-02f, -3.314971452e-02f, 2.140028912e-02f, -1.549556410e-02f, 1.189038050e-02f, -9.430764508e-03f, 7.629533285e-03f, -6.245864357e-03f,
+    5.147194018e-03f, -4.254517262e-03f, 3.517704689e-03f, -2.903236961e-03f, 2.387642229e-03f, -1.953776204e-03f, 1.588615903e-03f, -1.281904422e-03f,
+    1.025296168e-03f, -8.118075188e-04f, 6.354594010e-04f, -4.910431758e-04f, 3.739668061e-04f, -2.801535532e-04f, 2.059748139e-04f, -1.482046949e-04f,
+    1.039878656e-04f, -7.081492258e-05f, 4.650138401e-05f, -2.916779671e-05f, 1.721943176e-05f, -9.324780174e-06f, 4.392596455e-06f, -1.547621462e-06f,
+  },
+  {
+    -4.088967683e-06f, 8.910192787e-06f, -1.669710018e-05f, 2.856021888e-05f, -4.585826675e-05f, 7.022238428e-05f, -1.035788467e-04f, 1.481704555e-04f,
+    -2.065773487e-04f, 2.817387078e-04f, -3.769778378e-04f, 4.960344646e-04f, -6.431099804e-04f, 8.229340512e-04f, -1.040864915e-03f, 1.303041611e-03f,
+    -1.616615600e-03f, 1.990104157e-03f, -2.433932892e-03f, 2.961278187e-03f, -3.589398966e-03f, 4.341796032e-03f, -5.251833765e-03f, 6.369086443e-03f,
+    -7.771098057e-03f, 9.586787289e-03f, -1.204756320e-02f, 1.561380444e-02f, -2.134858216e-02f, 3.237518165e-02f, -6.351691727e-02f, 9.922245641e-01f,
+    7.298123202e-02f, -3.476218086e-02f, 2.242947814e-02f, -1.623682375e-02f, 1.245751541e-02f, -9.879803952e-03f, 7.992427938e-03f, -6.542763230e-03f,
+    5.391789325e-03f, -4.456671148e-03f, 3.684858403e-03f, -3.041218359e-03f, 2.501152770e-03f, -2.046696884e-03f, 1.664206100e-03f, -1.342935081e-03f,
+    1.074141653e-03f, -8.505109139e-04f, 6.657805615e-04f, -5.144954697e-04f, 3.918464352e-04f, -2.935639850e-04f, 2.158479749e-04f, -1.553199782e-04f,
+    1.089895985e-04f, -7.422866112e-05f, 4.874921569e-05f, -3.058270942e-05f, 1.805873369e-05f, -9.782515800e-06f, 4.610890777e-06f, -1.626889582e-06f,
+  },
+  {
+    -4.259820225e-06f, 9.288424001e-06f, -1.741201945e-05f, 2.979000355e-05f, -4.784097384e-05f, 7.326805023e-05f, -1.080826072e-04f, 1.546266247e-04f,
+    -2.155944289e-04f, 2.940553625e-04f, -3.934799702e-04f, 5.177737069e-04f, -6.713241520e-04f, 8.590705065e-04f, -1.086608239e-03f, 1.360347910e-03f,
+    -1.687756827e-03f, 2.077727744e-03f, -2.541144864e-03f, 3.091762699e-03f, -3.747595327e-03f, 4.533168729e-03f, -5.483298026e-03f, 6.649705309e-03f,
+    -8.113280178e-03f, 1.000847510e-02f, -1.257656635e-02f, 1.629738109e-02f, -2.227826482e-02f, 3.376935513e-02f, -6.616055820e-02f, 9.915034239e-01f,
+    7.650186772e-02f, -3.637667687e-02f, 2.345885653e-02f, -1.697784969e-02f, 1.302431633e-02f, -1.032850634e-02f, 8.355014746e-03f, -6.839393211e-03f,
+    5.636155771e-03f, -4.658633813e-03f, 3.851854799e-03f, -3.179072209e-03f, 2.614561431e-03f, -2.139537481e-03f, 1.739734460e-03f, -1.403918960e-03f,
+    1.122952596e-03f, -8.891895476e-04f, 6.960846285e-04f, -5.379365502e-04f, 4.097192418e-04f, -3.069707671e-04f, 2.257196829e-04f, -1.624352417e-04f,
+    1.139921645e-04f, -7.764366039e-05f, 5.099843856e-05f, -3.199894972e-05f, 1.889918599e-05f, -1.024117137e-05f, 4.829864465e-06f, -1.706614863e-06f,
+  },
+  {
+    -4.429266079e-06f, 9.664079769e-06f, -1.812262109e-05f, 3.101297778e-05f, -4.981341789e-05f, 7.629879762e-05f, -1.125653116e-04f, 1.610538017e-04f,
+    -2.245724257e-04f, 3.063202886e-04f, -4.099147289e-04f, 5.394264334e-04f, -6.994286096e-04f, 8.950693592e-04f, -1.132180649e-03f, 1.417443701e-03f,
+    -1.758640628e-03f, 2.165038368e-03f, -2.647978043e-03f, 3.221790058e-03f, -3.905240542e-03f, 4.723876173e-03f, -5.713956054e-03f, 6.929339416e-03f,
+    -8.454243623e-03f, 1.042862295e-02f, -1.310355817e-02f, 1.697818568e-02f, -2.320375406e-02f, 3.515591665e-02f, -6.878230391e-02f, 9.907505663e-01f,
+    8.003905030e-02f, -3.799306129e-02f, 2.448832730e-02f, -1.771857063e-02f, 1.359072826e-02f, -1.077682799e-02f, 8.717258321e-03f, -7.135725307e-03f,
+    5.880269451e-03f, -4.860385481e-03f, 4.018677516e-03f, -3.316784999e-03f, 2.727857089e-03f, -2.232288885e-03f, 1.815193568e-03f, -1.464850071e-03f,
+    1.171724201e-03f, -9.278396179e-04f, 7.263686222e-04f, -5.613641116e-04f, 4.275834677e-04f, -3.203725805e-04f, 2.355889667e-04f, -1.695497855e-04f,
+    1.189950718e-04f, -8.105958510e-05f, 5.324883218e-05f, -3.341637920e-05f, 1.974070694e-05f, -1.070070270e-05f, 5.049496854e-06f, -1.786790226e-06f,
+  },
+  {
+    -4.597293918e-06f, 1.003713163e-05f, -1.882884802e-05f, 3.222903989e-05f, -5.177543110e-05f, 7.931436427e-05f, -1.170265673e-04f, 1.674514179e-04f,
+    -2.335105381e-04f, 3.185323841e-04f, -4.262806293e-04f, 5.609906787e-04f, -7.274207916e-04f, 9.309273160e-04f, -1.177577965e-03f, 1.474323733e-03f,
+    -1.829260472e-03f, 2.252027968e-03f, -2.754422550e-03f, 3.351348231e-03f, -4.062320017e-03f, 4.913900713e-03f, -5.943786527e-03f, 7.207962975e-03f,
+    -8.793957066e-03f, 1.084719249e-02f, -1.362849108e-02f, 1.765615802e-02f, -2.412497149e-02f, 3.653476225e-02f, -7.138207402e-02f, 9.899660351e-01f,
+    8.359262976e-02f, -3.961119223e-02f, 2.551779323e-02f, -1.845891516e-02f, 1.415669618e-02f, -1.122472516e-02f, 9.079123261e-03f, -7.431730521e-03f,
+    6.124106452e-03f, -5.061906377e-03f, 4.185310192e-03f, -3.454343213e-03f, 2.841028620e-03f, -2.324941980e-03f, 1.890576006e-03f, -1.525722420e-03f,
+    1.220451670e-03f, -9.664573198e-04f, 7.566295600e-04f, -5.847758458e-04f, 4.454373522e-04f, -3.337681041e-04f, 2.454548535e-04f, -1.766629085e-04f,
+    1.239978277e-04f, -8.447609901e-05f, 5.550017538e-05f, -3.483485894e-05f, 2.058321444e-05f, -1.116106536e-05f, 5.269767101e-06f, -1.867408486e-06f,
+  },
+  {
+    -4.763892633e-06f, 1.040755152e-05f, -1.953064384e-05f, 3.343808924e-05f, -5.372684717e-05f, 8.231449017e-05f, -1.214659845e-04f, 1.738189085e-04f,
+    -2.424079705e-04f, 3.306905546e-04f, -4.425761960e-04f, 5.824644891e-04f, -7.552981509e-04f, 9.666411026e-04f, -1.222796027e-03f, 1.530982781e-03f,
+    -1.899609855e-03f, 2.338688521e-03f, -2.860468557e-03f, 3.480425244e-03f, -4.218819231e-03f, 5.103224788e-03f, -6.172768229e-03f, 7.485550322e-03f,
+    -9.132389344e-03f, 1.126414557e-02f, -1.415131780e-02f, 1.833123828e-02f, -2.504183930e-02f, 3.790578892e-02f, -7.395978974e-02f, 9.891498758e-01f,
+    8.716245477e-02f, -4.123092719e-02f, 2.654715690e-02f, -1.919881182e-02f, 1.472216502e-02f, -1.167215411e-02f, 9.440574156e-03f, -7.727379849e-03f,
+    6.367642861e-03f, -5.263176722e-03f, 4.351736461e-03f, -3.591733333e-03f, 2.954064895e-03f, -2.417487654e-03f, 1.965874354e-03f, -1.586530012e-03f,
+    1.269130200e-03f, -1.005038846e-03f, 7.868644569e-04f, -6.081694425e-04f, 4.632791328e-04f, -3.471560152e-04f, 2.553163689e-04f, -1.837739082e-04f,
+    1.289999381e-04f, -8.789286501e-05f, 5.775224631e-05f, -3.625424947e-05f, 2.142662602e-05f, -1.162221464e-05f, 5.490654193e-06f, -1.948462357e-06f,
+  },
+  {
+    -4.929051335e-06f, 1.077531178e-05f, -2.022795277e-05f, 3.464002620e-05f, -5.566750134e-05f, 8.529891750e-05f, -1.258831766e-04f, 1.801557130e-04f,
+    -2.512639330e-04f, 3.427937130e-04f, -4.587999629e-04f, 6.038459227e-04f, -7.830581559e-04f, 1.002207463e-03f, -1.267830700e-03f, 1.587415651e-03f,
+    -1.969682314e-03f, 2.425012048e-03f, -2.966106286e-03f, 3.609009185e-03f, -4.374723735e-03f, 5.291830925e-03f, -6.400880051e-03f, 7.762075928e-03f,
+    -9.469509454e-03f, 1.167944426e-02f, -1.467199129e-02f, 1.900336700e-02f, -2.595428026e-02f, 3.926889467e-02f, -7.651537390e-02f, 9.883021359e-01f,
+    9.074837268e-02f, -4.285212312e-02f, 2.757632065e-02f, -1.993818902e-02f, 1.528707968e-02f, -1.211907110e-02f, 9.801575591e-03f, -8.022644289e-03f,
+    6.610854766e-03f, -5.464176739e-03f, 4.517939959e-03f, -3.728941841e-03f, 3.066954785e-03f, -2.509916788e-03f, 2.041081189e-03f, -1.647266849e-03f,
+    1.317754987e-03f, -1.043580386e-03f, 8.170703258e-04f, -6.315425891e-04f, 4.811070451e-04f, -3.605349893e-04f, 2.651725370e-04f, -1.908820807e-04f,
+    1.340009080e-04f, -9.130954513e-05f, 6.000482243e-05f, -3.767441083e-05f, 2.227085881e-05f, -1.208410557e-05f, 5.712136939e-06f, -2.029944445e-06f,
+  },
+  {
+    -5.092759356e-06f, 1.114038513e-05f, -2.092071973e-05f, 3.583475216e-05f, -5.759723037e-05f, 8.826739064e-05f, -1.302777599e-04f, 1.864612751e-04f,
+    -2.600776413e-04f, 3.548407793e-04f, -4.749504738e-04f, 6.251330504e-04f, -8.106982903e-04f, 1.037623162e-03f, -1.312677874e-03f, 1.643617174e-03f,
+    -2.039471418e-03f, 2.510990613e-03f, -3.071326010e-03f, 3.737088204e-03f, -4.530019156e-03f, 5.479701741e-03f, -6.628100992e-03f, 8.037514394e-03f,
+    -9.805286561e-03f, 1.209305083e-02f, -1.519046482e-02f, 1.967248513e-02f, -2.686221768e-02f, 4.062397848e-02f, -7.904875093e-02f, 9.874228645e-01f,
+    9.435022955e-02f, -4.447463634e-02f, 2.860518664e-02f, -2.067697512e-02f, 1.585138500e-02f, -1.256543235e-02f, 1.016209215e-02f, -8.317494838e-03f,
+    6.853718258e-03f, -5.664886655e-03f, 4.683904324e-03f, -3.865955221e-03f, 3.179687163e-03f, -2.602220265e-03f, 2.116189088e-03f, -1.707926933e-03f,
+    1.366321227e-03f, -1.082078130e-03f, 8.472441778e-04f, -6.548929716e-04f, 4.989193229e-04f, -3.739037001e-04f, 2.750223804e-04f, -1.979867211e-04f,
+    1.390002415e-04f, -9.472580056e-05f, 6.225768054e-05f, -3.909520253e-05f, 2.311582959e-05f, -1.254669292e-05f, 5.934193979e-06f, -2.111847255e-06f,
+  },
+  {
+    -5.255006247e-06f, 1.150274470e-05f, -2.160889025e-05f, 3.702216955e-05f, -5.951587256e-05f, 9.121965621e-05f, -1.346493541e-04f, 1.927350429e-04f,
+    -2.688483168e-04f, 3.668306815e-04f, -4.910262820e-04f, 6.463239550e-04f, -8.382160537e-04f, 1.072884982e-03f, -1.357333460e-03f, 1.699582216e-03f,
+    -2.108970773e-03f, 2.596616323e-03f, -3.176118056e-03f, 3.864650513e-03f, -4.684691196e-03f, 5.666819943e-03f, -6.854410164e-03f, 8.311840460e-03f,
+    -1.013969000e-02f, 1.250492776e-02f, -1.570669190e-02f, 2.033853396e-02f, -2.776557549e-02f, 4.197094034e-02f, -8.155984686e-02f, 9.865121129e-01f,
+    9.796787014e-02f, -4.609832265e-02f, 2.963365684e-02f, -2.141509841e-02f, 1.641502584e-02f, -1.301119409e-02f, 1.052208841e-02f, -8.611902499e-03f,
+    7.096209430e-03f, -5.865286698e-03f, 4.849613197e-03f, -4.002759959e-03f, 3.292250903e-03f, -2.694388971e-03f, 2.191190629e-03f, -1.768504264e-03f,
+    1.414824112e-03f, -1.120528264e-03f, 8.773830223e-04f, -6.782182740e-04f, 5.167141985e-04f, -3.872608203e-04f, 2.848649205e-04f, -2.050871231e-04f,
+    1.439974414e-04f, -9.814129169e-05f, 6.451059682e-05f, -4.051648362e-05f, 2.396145476e-05f, -1.300993120e-05f, 6.156803786e-06f, -2.194163186e-06f,
+  },
+  {
+    -5.415781779e-06f, 1.186236403e-05f, -2.229241058e-05f, 3.820218186e-05f, -6.142326779e-05f, 9.415546309e-05f, -1.389975819e-04f, 1.989764686e-04f,
+    -2.775751866e-04f, 3.787623547e-04f, -5.070259509e-04f, 6.674167322e-04f, -8.656089612e-04f, 1.107989726e-03f, -1.401793396e-03f, 1.755305669e-03f,
+    -2.178174020e-03f, 2.681881328e-03f, -3.280472804e-03f, 3.991684391e-03f, -4.838725635e-03f, 5.853168333e-03f, -7.079786790e-03f, 8.585029001e-03f,
+    -1.047268926e-02f, 1.291503776e-02f, -1.622062636e-02f, 2.100145523e-02f, -2.866427819e-02f, 4.330968125e-02f, -8.404858935e-02f, 9.855699338e-01f,
+    1.016011379e-01f, -4.772303724e-02f, 3.066163302e-02f, -2.215248709e-02f, 1.697794700e-02f, -1.345631255e-02f, 1.088152897e-02f, -8.905838281e-03f,
+    7.338304386e-03f, -6.065357106e-03f, 5.015050227e-03f, -4.139342546e-03f, 3.404634881e-03f, -2.786413790e-03f, 2.266078389e-03f, -1.828992844e-03f,
+    1.463258836e-03f, -1.158926974e-03f, 9.074838675e-04f, -7.015161792e-04f, 5.344899027e-04f, -4.006050210e-04f, 2.946991776e-04f, -2.121825796e-04f,
+    1.489920099e-04f, -1.015556781e-04f, 6.676334683e-05f, -4.193811265e-05f, 2.480765038e-05f, -1.347377468e-05f, 6.379944662e-06f, -2.276884536e-06f,
+  },
+  {
+    -5.575075946e-06f, 1.221921703e-05f, -2.297122761e-05f, 3.937469361e-05f, -6.331925750e-05f, 9.707456241e-05f, -1.433220691e-04f, 2.051850090e-04f,
+    -2.862574838e-04f, 3.906347421e-04f, -5.229480536e-04f, 6.884094904e-04f, -8.928745443e-04f, 1.142934218e-03f, -1.446053645e-03f, 1.810782456e-03f,
+    -2.247074840e-03f, 2.766777826e-03f, -3.384380687e-03f, 4.118178180e-03f, -4.992108333e-03f, 6.038729808e-03f, -7.304210209e-03f, 8.857055034e-03f,
+    -1.080425404e-02f, 1.332334375e-02f, -1.673222230e-02f, 2.166119102e-02f, -2.955825086e-02f, 4.464010321e-02f, -8.651490765e-02f, 9.845963821e-01f,
+    1.052498751e-01f, -4.934863480e-02f, 3.168901679e-02f, -2.288906932e-02f, 1.754009328e-02f, -1.390074394e-02f, 1.124037842e-02f, -9.199273206e-03f,
+    7.579979239e-03f, -6.265078124e-03f, 5.180199065e-03f, -4.275689476e-03f, 3.516827977e-03f, -2.878285610e-03f, 2.340844948e-03f, -1.889386673e-03f,
+    1.511620590e-03f, -1.197270446e-03f, 9.375437209e-04f, -7.247843689e-04f, 5.522446653e-04f, -4.139349721e-04f, 3.045241705e-04f, -2.192723823e-04f,
+    1.539834481e-04f, -1.049686188e-04f, 6.901570553e-05f, -4.335994771e-05f, 2.565433215e-05f, -1.393817738e-05f, 6.603594743e-06f, -2.360003501e-06f,
+  },
+  {
+    -5.732878959e-06f, 1.257327805e-05f, -2.364528890e-05f, 4.053961037e-05f, -6.520368471e-05f, 9.997670761e-05f, -1.476224448e-04f, 2.113601251e-04f,
+    -2.948944474e-04f, 4.024467946e-04f, -5.387911735e-04f, 7.093003508e-04f, -9.200103506e-04f, 1.177715301e-03f, -1.490110193e-03f, 1.866007532e-03f,
+    -2.315666950e-03f, 2.851298059e-03f, -3.487832196e-03f, 4.244120289e-03f, -5.144825227e-03f, 6.223487360e-03f, -7.527659875e-03f, 9.127893717e-03f,
+    -1.113435417e-02f, 1.372980888e-02f, -1.724143411e-02f, 2.231768386e-02f, -3.044741920e-02f, 4.596210926e-02f, -8.895873263e-02f, 9.835915142e-01f,
+    1.089139226e-01f, -5.097496943e-02f, 3.271570958e-02f, -2.362477321e-02f, 1.810140947e-02f, -1.434444451e-02f, 1.159860137e-02f, -9.492178304e-03f,
+    7.821210113e-03f, -6.464430007e-03f, 5.345043376e-03f, -4.411787252e-03f, 3.628819076e-03f, -2.969995322e-03f, 2.415482885e-03f, -1.949679753e-03f,
+    1.559904568e-03f, -1.235554865e-03f, 9.675595889e-04f, -7.480205238e-04f, 5.699767149e-04f, -4.272493424e-04f, 3.143389175e-04f, -2.263558219e-04f,
+    1.589712563e-04f, -1.083797719e-04f, 7.126744730e-05f, -4.478184645e-05f, 2.650141545e-05f, -1.440309306e-05f, 6.827732004e-06f, -2.443512174e-06f,
+  },
+  {
+    -5.889181254e-06f, 1.292452183e-05f, -2.431454270e-05f, 4.169683880e-05f, -6.707639404e-05f, 1.028616544e-04f, -1.518983415e-04f, 2.175012824e-04f,
+    -3.034853222e-04f, 4.141974707e-04f, -5.545539041e-04f, 7.300874478e-04f, -9.470139444e-04f, 1.212329838e-03f, -1.533959054e-03f, 1.920975883e-03f,
+    -2.383944106e-03f, 2.935434314e-03f, -3.590817874e-03f, 4.369499195e-03f, -5.296862337e-03f, 6.407424079e-03f, -7.750115364e-03f, 9.397520354e-03f,
+    -1.146295970e-02f, 1.413439651e-02f, -1.774821649e-02f, 2.297087664e-02f, -3.133170952e-02f, 4.727560342e-02f, -9.137999678e-02f, 9.825553884e-01f,
+    1.125931201e-01f, -5.260189475e-02f, 3.374161267e-02f, -2.435952680e-02f, 1.866184036e-02f, -1.478737049e-02f, 1.195616244e-02f, -9.784524625e-03f,
+    8.061973146e-03f, -6.663393024e-03f, 5.509566830e-03f, -4.547622384e-03f, 3.740597069e-03f, -3.061533821e-03f, 2.489984786e-03f, -2.009866089e-03f,
+    1.608105964e-03f, -1.273776417e-03f, 9.975284779e-04f, -7.712223241e-04f, 5.876842794e-04f, -4.405468001e-04f, 3.241424355e-04f, -2.334321886e-04f,
+    1.639549343e-04f, -1.117887950e-04f, 7.351834599e-05f, -4.620366609e-05f, 2.734881531e-05f, -1.486847526e-05f, 7.052334254e-06f, -2.527402546e-06f,
+  },
+  {
+    -6.043973484e-06f, 1.327292350e-05f, -2.497893793e-05f, 4.284628659e-05f, -6.893723171e-05f, 1.057291609e-04f, -1.561493948e-04f, 2.236079509e-04f,
+    -3.120293592e-04f, 4.258857373e-04f, -5.702348493e-04f, 7.507689290e-04f, -9.738829067e-04f, 1.246774717e-03f, -1.577596265e-03f, 1.975682527e-03f,
+    -2.451900101e-03f, 3.019178929e-03f, -3.693328325e-03f, 4.494303444e-03f, -5.448205765e-03f, 6.590523157e-03f, -7.971556368e-03f, 9.665910395e-03f,
+    -1.179004084e-02f, 1.453707025e-02f, -1.825252441e-02f, 2.362071270e-02f, -3.221104871e-02f, 4.858049078e-02f, -9.377863422e-02f, 9.814880651e-01f,
+    1.162873061e-01f, -5.422926382e-02f, 3.476662718e-02f, -2.509325812e-02f, 1.922133073e-02f, -1.522947813e-02f, 1.231302627e-02f, -1.007628324e-02f,
+    8.302244496e-03f, -6.861947457e-03f, 5.673753113e-03f, -4.683181391e-03f, 3.852150853e-03f, -3.152892008e-03f, 2.564343237e-03f, -2.069939685e-03f,
+    1.656219971e-03f, -1.311931288e-03f, 1.027447394e-03f, -7.943874493e-04f, 6.053655859e-04f, -4.538260122e-04f, 3.339337409e-04f, -2.405007713e-04f,
+    1.689339808e-04f, -1.151953449e-04f, 7.576817491e-05f, -4.762526340e-05f, 2.819644645e-05f, -1.533427728e-05f, 7.277379143e-06f, -2.611666509e-06f,
+  },
+  {
+    -6.197246526e-06f, 1.361845862e-05f, -2.563842419e-05f, 4.398786254e-05f, -7.078604557e-05f, 1.085789875e-04f, -1.603752435e-04f, 2.296796053e-04f,
+    -3.205258155e-04f, 4.375105691e-04f, -5.858326235e-04f, 7.713429553e-04f, -1.000614835e-03f, 1.281046841e-03f, -1.621017893e-03f, 2.030122514e-03f,
+    -2.519528769e-03f, 3.102524285e-03f, -3.795354209e-03f, 4.618521649e-03f, -5.598841697e-03f, 6.772767882e-03f, -8.191962704e-03f, 9.933039440e-03f,
+    -1.211556797e-02f, 1.493779393e-02f, -1.875431317e-02f, 2.426713577e-02f, -3.308536430e-02f, 4.987667744e-02f, -9.615458066e-02f, 9.803896060e-01f,
+    1.199963176e-01f, -5.585692922e-02f, 3.579065411e-02f, -2.582589516e-02f, 1.977982536e-02f, -1.567072372e-02f, 1.266915754e-02f, -1.036742522e-02f,
+    8.542000335e-03f, -7.060073605e-03f, 5.837585920e-03f, -4.818450802e-03f, 3.963469336e-03f, -3.244060788e-03f, 2.638550829e-03f, -2.129894552e-03f,
+    1.704241787e-03f, -1.350015663e-03f, 1.057313343e-03f, -8.175135790e-04f, 6.230188610e-04f, -4.670856453e-04f, 3.437118492e-04f, -2.475608586e-04f,
+    1.739078939e-04f, -1.185990780e-04f, 7.801670686e-05f, -4.904649477e-05f, 2.904422327e-05f, -1.580045219e-05f, 7.502844163e-06f, -2.696295854e-06f,
+  },
+  {
+    -6.348991477e-06f, 1.396110314e-05f, -2.629295177e-05f, 4.512147651e-05f, -7.262268508e-05f, 1.114108969e-04f, -1.645755300e-04f, 2.357157247e-04f,
+    -3.289739543e-04f, 4.490709489e-04f, -6.013458515e-04f, 7.918077013e-04f, -1.027207345e-03f, 1.315143140e-03f, -1.664220029e-03f, 2.084290928e-03f,
+    -2.586823985e-03f, 3.185462815e-03f, -3.896886242e-03f, 4.742142496e-03f, -5.748756404e-03f, 6.954141649e-03f, -8.411314312e-03f, 1.019888324e-02f,
+    -1.243951170e-02f, 1.533653163e-02f, -1.925353838e-02f, 2.491009001e-02f, -3.395458443e-02f, 5.116407055e-02f, -9.850777348e-02f, 9.792600750e-01f,
+    1.237199907e-01f, -5.748474300e-02f, 3.681359429e-02f, -2.655736587e-02f, 2.033726906e-02f, -1.611106354e-02f, 1.302452093e-02f, -1.065792170e-02f,
+    8.781216860e-03f, -7.257751783e-03f, 6.001048965e-03f, -4.953417159e-03f, 4.074541430e-03f, -3.335031076e-03f, 2.712600160e-03f, -2.189724700e-03f,
+    1.752166611e-03f, -1.388025730e-03f, 1.087123333e-03f, -8.405983924e-04f, 6.406423309e-04f, -4.803243652e-04f, 3.534757752e-04f, -2.546117381e-04f,
+    1.788761714e-04f, -1.219996499e-04f, 8.026371416e-05f, -5.046721617e-05f, 2.989205985e-05f, -1.626695283e-05f, 7.728706648e-06f, -2.781282270e-06f,
+  },
+  {
+    -6.499199652e-06f, 1.430083343e-05f, -2.694247165e-05f, 4.624703946e-05f, -7.444700135e-05f, 1.142246544e-04f, -1.687498999e-04f, 2.417157928e-04f,
+    -3.373730450e-04f, 4.605658678e-04f, -6.167731691e-04f, 8.121613553e-04f, -1.053658069e-03f, 1.349060563e-03f, -1.707198791e-03f, 2.138182883e-03f,
+    -2.653779661e-03f, 3.267986999e-03f, -3.997915204e-03f, 4.865154743e-03f, -5.897936242e-03f, 7.134627954e-03f, -8.629591257e-03f, 1.046341769e-02f,
+    -1.276184279e-02f, 1.573324765e-02f, -1.975015593e-02f, 2.554952001e-02f, -3.481863787e-02f, 5.244257828e-02f, -1.008381516e-01f, 9.780995377e-01f,
+    1.274581601e-01f, -5.911255677e-02f, 3.783534846e-02f, -2.728759819e-02f, 2.089360664e-02f, -1.655045392e-02f, 1.337908115e-02f, -1.094774381e-02f,
+    9.019870291e-03f, -7.454962328e-03f, 6.164125975e-03f, -5.088067017e-03f, 4.185356063e-03f, -3.425793793e-03f, 2.786483831e-03f, -2.249424146e-03f,
+    1.799989643e-03f, -1.425957680e-03f, 1.116874370e-03f, -8.636395692e-04f, 6.582342218e-04f, -4.935408376e-04f, 3.632245333e-04f, -2.616526971e-04f,
+    1.838383100e-04f, -1.253967158e-04f, 8.250896865e-05f, -5.188728319e-05f, 3.073986999e-05f, -1.673373181e-05f, 7.954943777e-06f, -2.866617350e-06f,
+  },
+  {
+    -6.647862592e-06f, 1.463762627e-05f, -2.758693550e-05f, 4.736446343e-05f, -7.625884714e-05f, 1.170200274e-04f, -1.728980022e-04f, 2.476792980e-04f,
+    -3.457223635e-04f, 4.719943253e-04f, -6.321132226e-04f, 8.324021193e-04f, -1.079964656e-03f, 1.382796082e-03f, -1.749950326e-03f, 2.191793529e-03f,
+    -2.720389754e-03f, 3.350089369e-03f, -4.098431933e-03f, 4.987547217e-03f, -6.046367656e-03f, 7.314210400e-03f, -8.846773733e-03f, 1.072661887e-02f,
+    -1.308253221e-02f, 1.612790653e-02f, -2.024412206e-02f, 2.618537077e-02f, -3.567745403e-02f, 5.371210988e-02f, -1.031456557e-01f, 9.769080613e-01f,
+    1.312106593e-01f, -6.074022160e-02f, 3.885581723e-02f, -2.801652006e-02f, 2.144878294e-02f, -1.698885122e-02f, 1.373280295e-02f, -1.123686271e-02f,
+    9.257936873e-03f, -7.651685599e-03f, 6.326800698e-03f, -5.222386943e-03f, 4.295902170e-03f, -3.516339867e-03f, 2.860194451e-03f, -2.308986912e-03f,
+    1.847706088e-03f, -1.463807704e-03f, 1.146563465e-03f, -8.866347894e-04f, 6.757927598e-04f, -5.067337277e-04f, 3.729571374e-04f, -2.686830221e-04f,
+    1.887938062e-04f, -1.287899304e-04f, 8.475224174e-05f, -5.330655107e-05f, 3.158756718e-05f, -1.720074154e-05f, 8.181532576e-06f, -2.952292586e-06f,
+  },
+  {
+    -6.794972055e-06f, 1.497145883e-05f, -2.822629567e-05f, 4.847366157e-05f, -7.805807687e-05f, 1.197967860e-04f, -1.770194893e-04f, 2.536057335e-04f,
+    -3.540211916e-04f, 4.833553292e-04f, -6.473646695e-04f, 8.525282095e-04f, -1.106124775e-03f, 1.416346690e-03f, -1.792470807e-03f, 2.245118050e-03f,
+    -2.786648260e-03f, 3.431762506e-03f, -4.198427326e-03f, 5.109308823e-03f, -6.194037179e-03f, 7.492872696e-03f, -9.062842063e-03f, 1.098846298e-02f,
+    -1.340155112e-02f, 1.652047309e-02f, -2.073539331e-02f, 2.681758773e-02f, -3.653096293e-02f, 5.497257563e-02f, -1.054302280e-01f, 9.756857150e-01f,
+    1.349773206e-01f, -6.236758815e-02f, 3.987490110e-02f, -2.874405938e-02f, 2.200274281e-02f, -1.742621182e-02f, 1.408565113e-02f, -1.152524962e-02f,
+    9.495392880e-03f, -7.847901978e-03f, 6.489056900e-03f, -5.356363524e-03f, 4.406168701e-03f, -3.606660238e-03f, 2.933724635e-03f, -2.368407022e-03f,
+    1.895311154e-03f, -1.501571994e-03f, 1.176187626e-03f, -9.095817339e-04f, 6.933161712e-04f, -5.199017005e-04f, 3.826726011e-04f, -2.757019994e-04f,
+    1.937421559e-04f, -1.321789480e-04f, 8.699330443e-05f, -5.472487469e-05f, 3.243506465e-05f, -1.766793420e-05f, 8.408449920e-06f, -3.038299372e-06f,
+  },
+  {
+    -6.940520022e-06f, 1.530230872e-05f, -2.886050522e-05f, 4.957454812e-05f, -7.984454662e-05f, 1.225547025e-04f, -1.811140171e-04f, 2.594945972e-04f,
+    -3.622688179e-04f, 4.946478956e-04f, -6.625261780e-04f, 8.725378563e-04f, -1.132136112e-03f, 1.449709403e-03f, -1.834756436e-03f, 2.298151665e-03f,
+    -2.852549217e-03f, 3.512999041e-03f, -4.297892346e-03f, 5.230428537e-03f, -6.340931433e-03f, 7.670598659e-03f, -9.277776698e-03f, 1.124892640e-02f,
+    -1.371887088e-02f, 1.691091235e-02f, -2.122392653e-02f, 2.744611679e-02f, -3.737909525e-02f, 5.622388687e-02f, -1.076918124e-01f, 9.744325698e-01f,
+    1.387579752e-01f, -6.399450660e-02f, 4.089250048e-02f, -2.947014410e-02f, 2.255543116e-02f, -1.786249215e-02f, 1.443759050e-02f, -1.181287576e-02f,
+    9.732214617e-03f, -8.043591873e-03f, 6.650878367e-03f, -5.489983361e-03f, 4.516144618e-03f, -3.696745856e-03f, 3.007067008e-03f, -2.427678509e-03f,
+    1.942800052e-03f, -1.539246748e-03f, 1.205743865e-03f, -9.324780842e-04f, 7.108026826e-04f, -5.330434212e-04f, 3.923699376e-04f, -2.827089147e-04f,
+    1.986828547e-04f, -1.355634223e-04f, 8.923192729e-05f, -5.614210855e-05f, 3.328227532e-05f, -1.813526177e-05f, 8.635672535e-06f, -3.124629006e-06f,
+  },
+  {
+    -7.084498693e-06f, 1.563015393e-05f, -2.948951790e-05f, 5.066703844e-05f, -8.161811415e-05f, 1.252935518e-04f, -1.851812449e-04f, 2.653453916e-04f,
+    -3.704645374e-04f, 5.058710495e-04f, -6.775964278e-04f, 8.924293042e-04f, -1.157996369e-03f, 1.482881261e-03f, -1.876803442e-03f, 2.350889625e-03f,
+    -2.918086708e-03f, 3.593791659e-03f, -4.396818015e-03f, 5.350895412e-03f, -6.487037131e-03f, 7.847372216e-03f, -9.491558227e-03f, 1.150798566e-02f,
+    -1.403446305e-02f, 1.729918962e-02f, -2.170967893e-02f, 2.807090426e-02f, -3.822178232e-02f, 5.746595601e-02f, -1.099303542e-01f, 9.731486983e-01f,
+    1.425524530e-01f, -6.562082666e-02f, 4.190851568e-02f, -3.019470212e-02f, 2.310679290e-02f, -1.829764869e-02f, 1.478858594e-02f, -1.209971241e-02f,
+    9.968378422e-03f, -8.238735720e-03f, 6.812248910e-03f, -5.623233075e-03f, 4.625818899e-03f, -3.786587681e-03f, 3.080214201e-03f, -2.486795410e-03f,
+    1.990168001e-03f, -1.576828165e-03f, 1.235229197e-03f, -9.553215232e-04f, 7.282505212e-04f, -5.461575551e-04f, 4.020481601e-04f, -2.897030535e-04f,
+    2.036153976e-04f, -1.389430066e-04f, 9.146788054e-05f, -5.755810688e-05f, 3.412911188e-05f, -1.860267602e-05f, 8.863176999e-06f, -3.211272688e-06f,
+  },
+  {
+    -7.226900488e-06f, 1.595497290e-05f, -3.011328817e-05f, 5.175104900e-05f, -8.337863893e-05f, 1.280131113e-04f, -1.892208356e-04f, 2.711576243e-04f,
+    -3.786076514e-04f, 5.170238243e-04f, -6.925741097e-04f, 9.122008123e-04f, -1.183703270e-03f, 1.515859326e-03f, -1.918608084e-03f, 2.403327218e-03f,
+    -2.983254856e-03f, 3.674133097e-03f, -4.495195421e-03f, 5.470698579e-03f, -6.632341080e-03f, 8.023177405e-03f, -9.704167368e-03f, 1.176561748e-02f,
+    -1.434829938e-02f, 1.768527044e-02f, -2.219260801e-02f, 2.869189691e-02f, -3.905895612e-02f, 5.869869651e-02f, -1.121458007e-01f, 9.718341749e-01f,
+    1.463605828e-01f, -6.724639765e-02f, 4.292284695e-02f, -3.091766141e-02f, 2.365677302e-02f, -1.873163795e-02f, 1.513860235e-02f, -1.238573089e-02f,
+    1.020386067e-02f, -8.433313984e-03f, 6.973152364e-03f, -5.756099305e-03f, 4.735180535e-03f, -3.876176687e-03f, 3.153158856e-03f, -2.545751771e-03f,
+    2.037410220e-03f, -1.614312448e-03f, 1.264640637e-03f, -9.781097351e-04f, 7.456579149e-04f, -5.592427674e-04f, 4.117062816e-04f, -2.966837010e-04f,
+    2.085392794e-04f, -1.423173540e-04f, 9.370093404e-05f, -5.897272356e-05f, 3.497548673e-05f, -1.907012852e-05f, 9.090939746e-06f, -3.298221522e-06f,
+  },
+  {
+    -7.367718051e-06f, 1.627674445e-05f, -3.073177118e-05f, 5.282649740e-05f, -8.512598211e-05f, 1.307131607e-04f, -1.932324555e-04f, 2.769308077e-04f,
+    -3.866974680e-04f, 5.281052622e-04f, -7.074579258e-04f, 9.318506544e-04f, -1.209254555e-03f, 1.548640683e-03f, -1.960166649e-03f, 2.455459770e-03f,
+    -3.048047829e-03f, 3.754016144e-03f, -4.593015714e-03f, 5.589827243e-03f, -6.776830178e-03f, 8.197998376e-03f, -9.915584980e-03f, 1.202179872e-02f,
+    -1.466035184e-02f, 1.806912062e-02f, -2.267267164e-02f, 2.930904196e-02f, -3.989054926e-02f, 5.992202293e-02f, -1.143381007e-01f, 9.704890759e-01f,
+    1.501821922e-01f, -6.887106843e-02f, 4.393539443e-02f, -3.163894992e-02f, 2.420531653e-02f, -1.916441651e-02f, 1.548760470e-02f, -1.267090256e-02f,
+    1.043863776e-02f, -8.627307164e-03f, 7.133572589e-03f, -5.888568713e-03f, 4.844218538e-03f, -3.965503860e-03f, 3.225893625e-03f, -2.604541644e-03f,
+    2.084521937e-03f, -1.651695803e-03f, 1.293975204e-03f, -1.000840406e-03f, 7.630230926e-04f, -5.722977241e-04f, 4.213433153e-04f, -3.036501423e-04f,
+    2.134539946e-04f, -1.456861172e-04f, 9.593085730e-05f, -6.038581218e-05f, 3.582131203e-05f, -1.953757064e-05f, 9.318937066e-06f, -3.385466515e-06f,
+  },
+  {
+    -7.506944242e-06f, 1.659544784e-05f, -3.134492280e-05f, 5.389330235e-05f, -8.686000655e-05f, 1.333934824e-04f, -1.972157745e-04f, 2.826644589e-04f,
+    -3.947333017e-04f, 5.391144141e-04f, -7.222465897e-04f, 9.513771190e-04f, -1.234647984e-03f, 1.581222441e-03f, -2.001475455e-03f, 2.507282639e-03f,
+    -3.112459840e-03f, 3.833433642e-03f, -4.690270110e-03f, 5.708270691e-03f, -6.920491419e-03f, 8.371819395e-03f, -1.012579206e-02f, 1.227650642e-02f,
+    -1.497059261e-02f, 1.845070623e-02f, -2.314982799e-02f, 2.992228708e-02f, -4.071649504e-02f, 6.113585088e-02f, -1.165072044e-01f, 9.691134793e-01f,
+    1.540171076e-01f, -7.049468747e-02f, 4.494605825e-02f, -3.235849565e-02f, 2.475236850e-02f, -1.959594099e-02f, 1.583555800e-02f, -1.295519882e-02f,
+    1.067268616e-02f, -8.820695788e-03f, 7.293493474e-03f, -6.020627982e-03f, 4.952921933e-03f, -4.054560201e-03f, 3.298411169e-03f, -2.663159089e-03f,
+    2.131498386e-03f, -1.688974443e-03f, 1.323229919e-03f, -1.023511222e-03f, 7.803442839e-04f, -5.853210916e-04f, 4.309582744e-04f, -3.106016623e-04f,
+    2.183590373e-04f, -1.490489485e-04f, 9.815741955e-05f, -6.179722604e-05f, 3.666649971e-05f, -2.000495356e-05f, 9.547145107e-06f, -3.472998581e-06f,
+  },
+  {
+    -7.644572144e-06f, 1.691106271e-05f, -3.195269960e-05f, 5.495138369e-05f, -8.858057683e-05f, 1.360538611e-04f, -2.011704660e-04f, 2.883581001e-04f,
+    -4.027144739e-04f, 5.500503399e-04f, -7.369388268e-04f, 9.707785094e-04f, -1.259881335e-03f, 1.613601733e-03f, -2.042530846e-03f, 2.558791221e-03f,
+    -3.176485146e-03f, 3.912378491e-03f, -4.786949891e-03f, 5.826018287e-03f, -7.063311891e-03f, 8.544624841e-03f, -1.033476973e-02f, 1.252971778e-02f,
+    -1.527899405e-02f, 1.882999359e-02f, -2.362403559e-02f, 3.053158042e-02f, -4.153672742e-02f, 6.234009706e-02f, -1.186530640e-01f, 9.677074648e-01f,
+    1.578651544e-01f, -7.211710282e-02f, 4.595473843e-02f, -3.307622664e-02f, 2.529787407e-02f, -2.002616808e-02f, 1.618242732e-02f, -1.323859112e-02f,
+    1.090598235e-02f, -9.013460424e-03f, 7.452898937e-03f, -6.152263820e-03f, 5.061279769e-03f, -4.143336724e-03f, 3.370704162e-03f, -2.721598175e-03f,
+    2.178334804e-03f, -1.726144581e-03f, 1.352401807e-03f, -1.046119875e-03f, 7.976197201e-04f, -5.983115366e-04f, 4.405501723e-04f, -3.175375460e-04f,
+    2.232539018e-04f, -1.524055000e-04f, 1.003803897e-04f, -6.320681818e-05f, 3.751096144e-05f, -2.047222828e-05f, 9.775539881e-06f, -3.560808538e-06f,
+  },
+  {
+    -7.780595056e-06f, 1.722356916e-05f, -3.255505885e-05f, 5.600066241e-05f, -9.028755927e-05f, 1.386940843e-04f, -2.050962072e-04f, 2.940112584e-04f,
+    -4.106403127e-04f, 5.609121083e-04f, -7.515333738e-04f, 9.900531441e-04f, -1.284952405e-03f, 1.645775717e-03f, -2.083329200e-03f, 2.609980951e-03f,
+    -3.240118049e-03f, 3.990843641e-03f, -4.883046406e-03f, 5.943059475e-03f, -7.205278782e-03f, 8.716399211e-03f, -1.054249928e-02f, 1.278141017e-02f,
+    -1.558552877e-02f, 1.920694930e-02f, -2.409525331e-02f, 3.113687056e-02f, -4.235118102e-02f, 6.353467924e-02f, -1.207756331e-01f, 9.662711139e-01f,
+    1.617261568e-01f, -7.373816216e-02f, 4.696133498e-02f, -3.379207093e-02f, 2.584177842e-02f, -2.045505454e-02f, 1.652817780e-02f, -1.352105099e-02f,
+    1.113850287e-02f, -9.205581674e-03f, 7.611772925e-03f, -6.283462959e-03f, 5.169281111e-03f, -4.231824461e-03f, 3.442765291e-03f, -2.779852982e-03f,
+    2.225026440e-03f, -1.763202440e-03f, 1.381487896e-03f, -1.068664055e-03f, 8.148476335e-04f, -6.112677272e-04f, 4.501180229e-04f, -3.244570782e-04f,
+    2.281380817e-04f, -1.557554236e-04f, 1.025995364e-04f, -6.461444137e-05f, 3.835460869e-05f, -2.093934561e-05f, 1.000409726e-05f, -3.648887113e-06f,
+  },
+  {
+    -7.915006502e-06f, 1.753294767e-05f, -3.315195855e-05f, 5.704106063e-05f, -9.198082191e-05f, 1.413139417e-04f, -2.089926786e-04f, 2.996234661e-04f,
+    -4.185101528e-04f, 5.716987972e-04f, -7.660289796e-04f, 1.009199357e-03f, -1.309859013e-03f, 1.677741572e-03f, -2.123866924e-03f, 2.660847298e-03f,
+    -3.303352897e-03f, 4.068822102e-03f, -4.978551069e-03f, 6.059383782e-03f, -7.346379374e-03f, 8.887127119e-03f, -1.074896212e-02f, 1.303156116e-02f,
+    -1.589016958e-02f, 1.958154022e-02f, -2.456344038e-02f, 3.173810657e-02f, -4.315979115e-02f, 6.471951629e-02f, -1.228748670e-01f, 9.648045099e-01f,
+    1.655999378e-01f, -7.535771275e-02f, 4.796574787e-02f, -3.450595667e-02f, 2.638402682e-02f, -2.088255720e-02f, 1.687277462e-02f, -1.380254997e-02f,
+    1.137022431e-02f, -9.397040181e-03f, 7.770099419e-03f, -6.414212158e-03f, 5.276915047e-03f, -4.320014459e-03f, 3.514587255e-03f, -2.837917598e-03f,
+    2.271568545e-03f, -1.800144244e-03f, 1.410485219e-03f, -1.091141457e-03f, 8.320262583e-04f, -6.241883318e-04f, 4.596608405e-04f, -3.313595442e-04f,
+    2.330110710e-04f, -1.590983709e-04f, 1.048146282e-04f, -6.601994814e-05f, 3.919735269e-05f, -2.140625618e-05f, 1.023279298e-05f, -3.737224937e-06f,
+  },
+  {
+    -8.047800219e-06f, 1.783917916e-05f, -3.374335740e-05f, 5.807250160e-05f, -9.366023454e-05f, 1.439132260e-04f, -2.128595646e-04f, 3.051942603e-04f,
+    -4.263233359e-04f, 5.824094934e-04f, -7.804244046e-04f, 1.028215496e-03f, -1.334598994e-03f, 1.709496504e-03f, -2.164140452e-03f, 2.711385771e-03f,
+    -3.366184082e-03f, 4.146306937e-03f, -5.073455365e-03f, 6.174980817e-03f, -7.486601050e-03f, 9.056793298e-03f, -1.095413982e-02f, 1.328014847e-02f,
+    -1.619288949e-02f, 1.995373348e-02f, -2.502855634e-02f, 3.233523797e-02f, -4.396249378e-02f, 6.589452818e-02f, -1.249507225e-01f, 9.633077377e-01f,
+    1.694863194e-01f, -7.697560152e-02f, 4.896787703e-02f, -3.521781201e-02f, 2.692456460e-02f, -2.130863294e-02f, 1.721618305e-02f, -1.408305970e-02f,
+    1.160112330e-02f, -9.587816630e-03f, 7.927862434e-03f, -6.544498203e-03f, 5.384170687e-03f, -4.407897784e-03f, 3.586162766e-03f, -2.895786121e-03f,
+    2.317956383e-03f, -1.836966226e-03f, 1.439390809e-03f, -1.113549779e-03f, 8.491538302e-04f, -6.370720202e-04f, 4.691776397e-04f, -3.382442290e-04f,
+    2.378723635e-04f, -1.624339935e-04f, 1.070254331e-04f, -6.742319080e-05f, 4.003910449e-05f, -2.187291046e-05f, 1.046160266e-05f, -3.825812551e-06f,
+  },
+  {
+    -8.178970168e-06f, 1.814224494e-05f, -3.432921482e-05f, 5.909490975e-05f, -9.532566869e-05f, 1.464917320e-04f, -2.166965532e-04f, 3.107231832e-04f,
+    -4.340792106e-04f, 5.930432930e-04f, -7.947184216e-04f, 1.047099927e-03f, -1.359170204e-03f, 1.741037745e-03f, -2.204146255e-03f, 2.761591915e-03f,
+    -3.428606046e-03f, 4.223291267e-03f, -5.167750846e-03f, 6.289840270e-03f, -7.625931293e-03f, 9.225382605e-03f, -1.115801408e-02f, 1.352715001e-02f,
+    -1.649366174e-02f, 2.032349650e-02f, -2.549056113e-02f, 3.292821478e-02f, -4.475922559e-02f, 6.705963596e-02f, -1.270031584e-01f, 9.617808840e-01f,
+    1.733851224e-01f, -7.859167502e-02f, 4.996762238e-02f, -3.592756519e-02f, 2.746333717e-02f, -2.173323873e-02f, 1.755836841e-02f, -1.436255184e-02f,
+    1.183117652e-02f, -9.777891746e-03f, 8.085046020e-03f, -6.674307910e-03f, 5.491037164e-03f, -4.495465520e-03f, 3.657484552e-03f, -2.953452661e-03f,
+    2.364185222e-03f, -1.873664622e-03f, 1.468201709e-03f, -1.135886720e-03f, 8.662285871e-04f, -6.499174633e-04f, 4.786674360e-04f, -3.451104182e-04f,
+    2.427214528e-04f, -1.657619427e-04f, 1.092317192e-04f, -6.882402144e-05f, 4.087977490e-05f, -2.233925872e-05f, 1.069050176e-05f, -3.914640403e-06f,
+  },
+  {
+    -8.308510526e-06f, 1.844212675e-05f, -3.490949095e-05f, 6.010821063e-05f, -9.697699767e-05f, 1.490492574e-04f, -2.205033360e-04f, 3.162097824e-04f,
+    -4.417771323e-04f, 6.035993012e-04f, -8.089098150e-04f, 1.065851029e-03f, -1.383570519e-03f, 1.772362549e-03f, -2.243880829e-03f, 2.811461316e-03f,
+    -3.490613277e-03f, 4.299768271e-03f, -5.261429133e-03f, 6.403951917e-03f, -7.764357688e-03f, 9.392880014e-03f, -1.136056675e-02f, 1.377254385e-02f,
+    -1.679245981e-02f, 2.069079697e-02f, -2.594941501e-02f, 3.351698749e-02f, -4.554992391e-02f, 6.821476178e-02f, -1.290321348e-01f, 9.602240373e-01f,
+    1.772961666e-01f, -8.020577946e-02f, 5.096488382e-02f, -3.663514452e-02f, 2.800029005e-02f, -2.215633165e-02f, 1.789929612e-02f, -1.464099816e-02f,
+    1.206036072e-02f, -9.967246303e-03f, 8.241634264e-03f, -6.803628123e-03f, 5.597503636e-03f, -4.582708769e-03f, 3.728545355e-03f, -3.010911341e-03f,
+    2.410250341e-03f, -1.910235678e-03f, 1.496914962e-03f, -1.158149984e-03f, 8.832487688e-04f, -6.627233332e-04f, 4.881292455e-04f, -3.519573977e-04f,
+    2.475578330e-04f, -1.690818699e-04f, 1.114332544e-04f, -7.022229194e-05f, 4.171927458e-05f, -2.280525110e-05f, 1.091946563e-05f, -4.003698852e-06f,
+  },
+  {
+    -8.436415688e-06f, 1.873880677e-05f, -3.548414665e-05f, 6.111233096e-05f, -9.861409656e-05f, 1.515856025e-04f, -2.242796085e-04f, 3.216536102e-04f,
+    -4.494164636e-04f, 6.140766327e-04f, -8.229973820e-04f, 1.084467198e-03f, -1.407797835e-03f, 1.803468196e-03f, -2.283340707e-03f, 2.860989597e-03f,
+    -3.552200308e-03f, 4.375731185e-03f, -5.354481919e-03f, 6.517305617e-03f, -7.901867919e-03f, 9.559270627e-03f, -1.156177985e-02f, 1.401630827e-02f,
+    -1.708925737e-02f, 2.105560283e-02f, -2.640507863e-02f, 3.410150705e-02f, -4.633452680e-02f, 6.935982890e-02f, -1.310376136e-01f, 9.586372877e-01f,
+    1.812192708e-01f, -8.181776071e-02f, 5.195956127e-02f, -3.734047838e-02f, 2.853536880e-02f, -2.257786882e-02f, 1.823893164e-02f, -1.491837045e-02f,
+    1.228865268e-02f, -1.015586112e-02f, 8.397611294e-03f, -6.932445721e-03f, 5.703559286e-03f, -4.669618655e-03f, 3.799337932e-03f, -3.068156294e-03f,
+    2.456147027e-03f, -1.946675644e-03f, 1.525527619e-03f, -1.180337278e-03f, 9.002126176e-04f, -6.754883035e-04f, 4.975620851e-04f, -3.587844536e-04f,
+    2.523809978e-04f, -1.723934262e-04f, 1.136298062e-04f, -7.161785402e-05f, 4.255751397e-05f, -2.327083756e-05f, 1.114846950e-05f, -4.092978166e-06f,
+  },
+  {
+    -8.562680267e-06f, 1.903226756e-05f, -3.605314349e-05f, 6.210719863e-05f, -1.002368422e-04f, 1.541005700e-04f, -2.280250696e-04f, 3.270542246e-04f,
+    -4.569965739e-04f, 6.244744115e-04f, -8.369799314e-04f, 1.102946845e-03f, -1.431850069e-03f, 1.834351994e-03f, -2.322522449e-03f, 2.910172420e-03f,
+    -3.613361724e-03f, 4.451173303e-03f, -5.446900967e-03f, 6.629891317e-03f, -8.038449778e-03f, 9.724539669e-03f, -1.176163554e-02f, 1.425842172e-02f,
+    -1.738402835e-02f, 2.141788235e-02f, -2.685751297e-02f, 3.468172494e-02f, -4.711297299e-02f, 7.049476169e-02f, -1.330195581e-01f, 9.570207270e-01f,
+    1.851542524e-01f, -8.342746432e-02f, 5.295155463e-02f, -3.804349522e-02f, 2.906851911e-02f, -2.299780747e-02f, 1.857724054e-02f, -1.519464060e-02f,
+    1.251602926e-02f, -1.034371706e-02f, 8.552961274e-03f, -7.060747613e-03f, 5.809193322e-03f, -4.756186323e-03f, 3.869855060e-03f, -3.125181667e-03f,
+    2.501870580e-03f, -1.982980778e-03f, 1.554036734e-03f, -1.202446312e-03f, 9.171183779e-04f, -6.882110496e-04f, 5.069649726e-04f, -3.655908726e-04f,
+    2.571904415e-04f, -1.756962629e-04f, 1.158211424e-04f, -7.301055920e-05f, 4.339440337e-05f, -2.373596791e-05f, 1.137748846e-05f, -4.182468525e-06f,
+  },
+  {
+    -8.687299095e-06f, 1.932249212e-05f, -3.661644377e-05f, 6.309274268e-05f, -1.018451132e-04f, 1.565939655e-04f, -2.317394222e-04f, 3.324111882e-04f,
+    -4.645168400e-04f, 6.347917709e-04f, -8.508562850e-04f, 1.121288399e-03f, -1.455725156e-03f, 1.865011272e-03f, -2.361422650e-03f, 2.959005488e-03f,
+    -3.674092157e-03f, 4.526087979e-03f, -5.538678111e-03f, 6.741699050e-03f, -8.174091157e-03f, 9.888672488e-03f, -1.196011611e-02f, 1.449886283e-02f,
+    -1.767674687e-02f, 2.177760405e-02f, -2.730667941e-02f, 3.525759308e-02f, -4.788520194e-02f, 7.161948562e-02f, -1.349779336e-01f, 9.553744490e-01f,
+    1.891009282e-01f, -8.503473551e-02f, 5.394076384e-02f, -3.874412359e-02f, 2.959968678e-02f, -2.341610493e-02f, 1.891418845e-02f, -1.546978056e-02f,
+    1.274246738e-02f, -1.053079505e-02f, 8.707668414e-03f, -7.188520744e-03f, 5.914394984e-03f, -4.842402939e-03f, 3.940089530e-03f, -3.181981620e-03f,
+    2.547416305e-03f, -2.019147347e-03f, 1.582439368e-03f, -1.224474801e-03f, 9.339642973e-04f, -7.008902481e-04f, 5.163369270e-04f, -3.723759419e-04f,
+    2.619856584e-04f, -1.789900311e-04f, 1.180070302e-04f, -7.440025888e-05f, 4.422985288e-05f, -2.420059182e-05f, 1.160649750e-05f, -4.272160018e-06f,
+  },
+  {
+    -8.810267219e-06f, 1.960946386e-05f, -3.717401051e-05f, 6.406889332e-05f, -1.034387900e-04f, 1.590655970e-04f, -2.354223730e-04f, 3.377240695e-04f,
+    -4.719766454e-04f, 6.450278540e-04f, -8.646252767e-04f, 1.139490302e-03f, -1.479421055e-03f, 1.895443390e-03f, -2.400037935e-03f, 3.007484542e-03f,
+    -3.734386286e-03f, 4.600468627e-03f, -5.629805258e-03f, 6.852718933e-03f, -8.308780058e-03f, 1.005165456e-02f, -1.215720403e-02f, 1.473761042e-02f,
+    -1.796738731e-02f, 2.213473676e-02f, -2.775253967e-02f, 3.582906392e-02f, -4.865115378e-02f, 7.273392728e-02f, -1.369127068e-01f, 9.536985487e-01f,
+    1.930591136e-01f, -8.663941923e-02f, 5.492708886e-02f, -3.944229214e-02f, 3.012881768e-02f, -2.383271863e-02f, 1.924974112e-02f, -1.574376236e-02f,
+    1.296794401e-02f, -1.071707605e-02f, 8.861716966e-03f, -7.315752095e-03f, 6.019153536e-03f, -4.928259693e-03f, 4.010034151e-03f, -3.238550326e-03f,
+    2.592779523e-03f, -2.055171624e-03f, 1.610732588e-03f, -1.246420463e-03f, 9.507486256e-04f, -7.135245779e-04f, 5.256769682e-04f, -3.791389494e-04f,
+    2.667661430e-04f, -1.822743822e-04f, 1.201872372e-04f, -7.578680428e-05f, 4.506377247e-05f, -2.466465881e-05f, 1.183547146e-05f, -4.362042650e-06f,
+  },
+  {
+    -8.931579902e-06f, 1.989316661e-05f, -3.772580746e-05f, 6.503558194e-05f, -1.050177549e-04f, 1.615152753e-04f, -2.390736324e-04f, 3.429924418e-04f,
+    -4.793753812e-04f, 6.551818131e-04f, -8.782857531e-04f, 1.157551015e-03f, -1.502935743e-03f, 1.925645731e-03f, -2.438364965e-03f, 3.055605366e-03f,
+    -3.794238842e-03f, 4.674308720e-03f, -5.720274390e-03f, 6.962941177e-03f, -8.442504584e-03f, 1.021347150e-02f, -1.235288192e-02f, 1.497464352e-02f,
+    -1.825592428e-02f, 2.248924958e-02f, -2.819505586e-02f, 3.639609040e-02f, -4.941076936e-02f, 7.383801437e-02f, -1.388238461e-01f, 9.519931232e-01f,
+    1.970286231e-01f, -8.824136010e-02f, 5.591042968e-02f, -4.013792962e-02f, 3.065585781e-02f, -2.424760609e-02f, 1.958386436e-02f, -1.601655810e-02f,
+    1.319243620e-02f, -1.090254110e-02f, 9.015091225e-03f, -7.442428680e-03f, 6.123458274e-03f, -5.013747798e-03f, 4.079681754e-03f, -3.294881976e-03f,
+    2.637955561e-03f, -2.091049891e-03f, 1.638913465e-03f, -1.268281021e-03f, 9.674696162e-04f, -7.261127198e-04f, 5.349841175e-04f, -3.858791835e-04f,
+    2.715313904e-04f, -1.855489674e-04f, 1.223615306e-04f, -7.717004653e-05f, 4.589607196e-05f, -2.512811824e-05f, 1.206438509e-05f, -4.452106337e-06f,
+  },
+  {
+    -9.051232627e-06f, 2.017358462e-05f, -3.827179909e-05f, 6.599274109e-05f, -1.065818918e-04f, 1.639428138e-04f, -2.426929147e-04f, 3.482158838e-04f,
+    -4.867124455e-04f, 6.652528106e-04f, -8.918365734e-04f, 1.175469014e-03f, -1.526267217e-03f, 1.955615704e-03f, -2.476400429e-03f, 3.103363782e-03f,
+    -3.853644604e-03f, 4.747601794e-03f, -5.810077558e-03f, 7.072356078e-03f, -8.575252950e-03f, 1.037410904e-02f, -1.254713255e-02f, 1.520994131e-02f,
+    -1.854233260e-02f, 2.284111193e-02f, -2.863419045e-02f, 3.695862595e-02f, -5.016399027e-02f, 7.493167571e-02f, -1.407113214e-01f, 9.502582712e-01f,
+    2.010092702e-01f, -8.984040248e-02f, 5.689068634e-02f, -4.083096489e-02f, 3.118075329e-02f, -2.466072494e-02f, 1.991652408e-02f, -1.628813997e-02f,
+    1.341592105e-02f, -1.108717127e-02f, 9.167775537e-03f, -7.568537556e-03f, 6.227298525e-03f, -5.098858492e-03f, 4.149025186e-03f, -3.350970771e-03f,
+    2.682939762e-03f, -2.126778440e-03f, 1.666979079e-03f, -1.290054202e-03f, 9.841255253e-04f, -7.386533564e-04f, 5.442573973e-04f, -3.925959335e-04f,
+    2.762808957e-04f, -1.888134382e-04f, 1.245296776e-04f, -7.854983662e-05f, 4.672666102e-05f, -2.559091937e-05f, 1.229321302e-05f, -4.542340910e-06f,
+  },
+  {
+    -9.169221087e-06f, 2.045070255e-05f, -3.881195061e-05f, 6.694030452e-05f, -1.081310866e-04f, 1.663480286e-04f, -2.462799378e-04f, 3.533939798e-04f,
+    -4.939872437e-04f, 6.752400183e-04f, -9.052766097e-04f, 1.193242792e-03f, -1.549413500e-03f, 1.985350746e-03f, -2.514141055e-03f, 3.150755653e-03f,
+    -3.912598403e-03f, 4.820341444e-03f, -5.899206893e-03f, 7.180954023e-03f, -8.707013479e-03f, 1.053355304e-02f, -1.273993885e-02f, 1.544348319e-02f,
+    -1.882658736e-02f, 2.319029348e-02f, -2.906990632e-02f, 3.751662451e-02f, -5.091075878e-02f, 7.601484125e-02f, -1.425751046e-01f, 9.484940930e-01f,
+    2.050008673e-01f, -9.143639046e-02f, 5.786775892e-02f, -4.152132692e-02f, 3.170345036e-02f, -2.507203293e-02f, 2.024768630e-02f, -1.655848023e-02f,
+    1.363837575e-02f, -1.127094770e-02f, 9.319754293e-03f, -7.694065817e-03f, 6.330663647e-03f, -5.183583039e-03f, 4.218057317e-03f, -3.406810934e-03f,
+    2.727727479e-03f, -2.162353570e-03f, 1.694926515e-03f, -1.311737738e-03f, 1.000714612e-03f, -7.511451729e-04f, 5.534958317e-04f, -3.992884894e-04f,
+    2.810141547e-04f, -1.920674462e-04f, 1.266914456e-04f, -7.992602546e-05f, 4.755544919e-05f, -2.605301130e-05f, 1.252192976e-05f, -4.632736116e-06f,
+  },
+  {
+    -9.285541193e-06f, 2.072450549e-05f, -3.934622794e-05f, 6.787820714e-05f, -1.096652269e-04f, 1.687307385e-04f, -2.498344236e-04f, 3.585263192e-04f,
+    -5.011991885e-04f, 6.851426178e-04f, -9.186047466e-04f, 1.210870858e-03f, -1.572372630e-03f, 2.014848320e-03f, -2.551583599e-03f, 3.197776886e-03f,
+    -3.971095120e-03f, 4.892521328e-03f, -5.987654596e-03f, 7.288725491e-03f, -8.837774601e-03f, 1.069178951e-02f, -1.293128393e-02f, 1.567524876e-02f,
+    -1.910866386e-02f, 2.353676425e-02f, -2.950216668e-02f, 3.807004053e-02f, -5.165101790e-02f, 7.708744207e-02f, -1.444151688e-01f, 9.467006906e-01f,
+    2.090032259e-01f, -9.302916787e-02f, 5.884154759e-02f, -4.220894480e-02f, 3.222389537e-02f, -2.548148791e-02f, 2.057731712e-02f, -1.682755123e-02f,
+    1.385977754e-02f, -1.145385160e-02f, 9.471011934e-03f, -7.819000598e-03f, 6.433543033e-03f, -5.267912728e-03f, 4.286771035e-03f, -3.462396698e-03f,
+    2.772314078e-03f, -2.197771591e-03f, 1.722752866e-03f, -1.333329368e-03f, 1.017235141e-03f, -7.635868567e-04f, 5.626984461e-04f, -4.059561424e-04f,
+    2.857306635e-04f, -1.953106432e-04f, 1.288466018e-04f, -8.129846388e-05f, 4.838234590e-05f, -2.651434302e-05f, 1.275050972e-05f, -4.723281616e-06f,
+  },
+  {
+    -9.400189071e-06f, 2.099497895e-05f, -3.987459775e-05f, 6.880638505e-05f, -1.111842023e-04f, 1.710907650e-04f, -2.533560981e-04f, 3.636124968e-04f,
+    -5.083477002e-04f, 6.949598006e-04f, -9.318198821e-04f, 1.228351739e-03f, -1.595142671e-03f, 2.044105918e-03f, -2.588724853e-03f, 3.244423427e-03f,
+    -4.029129687e-03f, 4.964135166e-03f, -6.075412948e-03f, 7.395661050e-03f, -8.967524858e-03f, 1.084880457e-02f, -1.312115102e-02f, 1.590521780e-02f,
+    -1.938853765e-02f, 2.388049453e-02f, -2.993093518e-02f, 3.861882897e-02f, -5.238471136e-02f, 7.814941037e-02f, -1.462314889e-01f, 9.448781676e-01f,
+    2.130161565e-01f, -9.461857830e-02f, 5.981195257e-02f, -4.289374776e-02f, 3.274203483e-02f, -2.588904787e-02f, 2.090538276e-02f, -1.709532543e-02f,
+    1.408010377e-02f, -1.163586423e-02f, 9.621532954e-03f, -7.943329077e-03f, 6.535926107e-03f, -5.351838878e-03f, 4.355159253e-03f, -3.517722318e-03f,
+    2.816694937e-03f, -2.233028822e-03f, 1.750455232e-03f, -1.354826834e-03f, 1.033685378e-03f, -7.759770978e-04f, 5.718642675e-04f, -4.125981843e-04f,
+    2.904299189e-04f, -1.985426812e-04f, 1.309949136e-04f, -8.266700263e-05f, 4.920726046e-05f, -2.697486339e-05f, 1.297892720e-05f, -4.813966989e-06f,
+  },
+  {
+    -9.513161060e-06f, 2.126210883e-05f, -4.039702742e-05f, 6.972477555e-05f, -1.126879041e-04f, 1.734279324e-04f, -2.568446908e-04f, 3.686521130e-04f,
+    -5.154322060e-04f, 7.046907681e-04f, -9.449209268e-04f, 1.245683977e-03f, -1.617721706e-03f, 2.073121055e-03f, -2.625561644e-03f, 3.290691266e-03f,
+    -4.086697087e-03f, 5.035176741e-03f, -6.162474303e-03f, 7.501751363e-03f, -9.096252905e-03f, 1.100458450e-02f, -1.330952356e-02f, 1.613337029e-02f,
+    -1.966618454e-02f, 2.422145492e-02f, -3.035617582e-02f, 3.916294531e-02f, -5.311178362e-02f, 7.920067948e-02f, -1.480240417e-01f, 9.430266295e-01f,
+    2.170394685e-01f, -9.620446510e-02f, 6.077887416e-02f, -4.357566517e-02f, 3.325781536e-02f, -2.629467091e-02f, 2.123184955e-02f, -1.736177534e-02f,
+    1.429933182e-02f, -1.181696691e-02f, 9.771301898e-03f, -8.067038473e-03f, 6.637802330e-03f, -5.435352833e-03f, 4.423214903e-03f, -3.572782063e-03f,
+    2.860865449e-03f, -2.268121593e-03f, 1.778030720e-03f, -1.376227883e-03f, 1.050063593e-03f, -7.883145886e-04f, 5.809923248e-04f, -4.192139080e-04f,
+    2.951114180e-04f, -2.017632125e-04f, 1.331361483e-04f, -8.403149242e-05f, 5.003010208e-05f, -2.743452116e-05f, 1.320715638e-05f, -4.904781732e-06f,
+  },
+  {
+    -9.624453711e-06f, 2.152588149e-05f, -4.091348507e-05f, 7.063331712e-05f, -1.141762253e-04f, 1.757420675e-04f, -2.602999354e-04f, 3.736447736e-04f,
+    -5.224521411e-04f, 7.143347317e-04f, -9.579068046e-04f, 1.262866132e-03f, -1.640107841e-03f, 2.101891277e-03f, -2.662090831e-03f, 3.336576433e-03f,
+    -4.143792357e-03f, 5.105639900e-03f, -6.248831095e-03f, 7.606987185e-03f, -9.223947507e-03f, 1.115911569e-02f, -1.349638511e-02f, 1.635968641e-02f,
+    -1.994158056e-02f, 2.455961631e-02f, -3.077785300e-02f, 3.970234553e-02f, -5.383217986e-02f, 8.024118387e-02f, -1.497928051e-01f, 9.411461832e-01f,
+    2.210729706e-01f, -9.778667140e-02f, 6.174221276e-02f, -4.425462653e-02f, 3.377118374e-02f, -2.669831525e-02f, 2.155668391e-02f, -1.762687360e-02f,
+    1.451743919e-02f, -1.199714105e-02f, 9.920303367e-03f, -8.190116052e-03f, 6.739161200e-03f, -5.518445969e-03f, 4.490930943e-03f, -3.627570222e-03f,
+    2.904821021e-03f, -2.303046244e-03f, 1.805476446e-03f, -1.397530269e-03f, 1.066368063e-03f, -8.005980246e-04f, 5.900816485e-04f, -4.258026078e-04f,
+    2.997746589e-04f, -2.049718896e-04f, 1.352700734e-04f, -8.539178393e-05f, 5.085077988e-05f, -2.789326498e-05f, 1.343517137e-05f, -4.995715261e-06f,
+  },
+  {
+    -9.734063790e-06f, 2.178628366e-05f, -4.142393955e-05f, 7.153194944e-05f, -1.156490611e-04f, 1.780330000e-04f, -2.637215693e-04f, 3.785900897e-04f,
+    -5.294069478e-04f, 7.238909127e-04f, -9.707764525e-04f, 1.279896781e-03f, -1.662299203e-03f, 2.130414156e-03f, -2.698309309e-03f, 3.382075003e-03f,
+    -4.200410584e-03f, 5.175518554e-03f, -6.334475834e-03f, 7.711359366e-03f, -9.350597543e-03f, 1.131238469e-02f, -1.368171942e-02f, 1.658414655e-02f,
+    -2.021470201e-02f, 2.489494994e-02f, -3.119593151e-02f, 4.023698615e-02f, -5.454584602e-02f, 8.127085915e-02f, -1.515377592e-01f, 9.392369373e-01f,
+    2.251164701e-01f, -9.936504012e-02f, 6.270186886e-02f, -4.493056151e-02f, 3.428208689e-02f, -2.709993926e-02f, 2.187985240e-02f, -1.789059294e-02f,
+    1.473440343e-02f, -1.217636809e-02f, 1.006852202e-02f, -8.312549124e-03f, 6.839992251e-03f, -5.601109690e-03f, 4.558300353e-03f, -3.682081103e-03f,
+    2.948557072e-03f, -2.337799126e-03f, 1.832789533e-03f, -1.418731754e-03f, 1.082597065e-03f, -8.128261041e-04f, 5.991312713e-04f, -4.323635789e-04f,
+    3.044191399e-04f, -2.081683655e-04f, 1.373964564e-04f, -8.674772781e-05f, 5.166920288e-05f, -2.835104337e-05f, 1.366294615e-05f, -5.086756910e-06f,
+  },
+  {
+    -9.841988273e-06f, 2.204330254e-05f, -4.192836046e-05f, 7.242061336e-05f, -1.171063082e-04f, 1.803005624e-04f, -2.671093340e-04f, 3.834876782e-04f,
+    -5.362960762e-04f, 7.333585426e-04f, -9.835288208e-04f, 1.296774519e-03f, -1.684293941e-03f, 2.158687292e-03f, -2.734214007e-03f, 3.427183092e-03f,
+    -4.256546910e-03f, 5.244806677e-03f, -6.419401109e-03f, 7.814858848e-03f, -9.476192008e-03f, 1.146437817e-02f, -1.386551041e-02f, 1.680673130e-02f,
+    -2.048552540e-02f, 2.522742730e-02f, -3.161037654e-02f, 4.076682421e-02f, -5.525272875e-02f, 8.228964205e-02f, -1.532588852e-01f, 9.372990021e-01f,
+    2.291697739e-01f, -1.009394140e-01f, 6.365774307e-02f, -4.560339990e-02f, 3.479047189e-02f, -2.749950144e-02f, 2.220132167e-02f, -1.815290617e-02f,
+    1.495020220e-02f, -1.235462957e-02f, 1.021594256e-02f, -8.434325049e-03f, 6.940285055e-03f, -5.683335432e-03f, 4.625316138e-03f, -3.736309032e-03f,
+    2.992069040e-03f, -2.372376603e-03f, 1.859967113e-03f, -1.439830101e-03f, 1.098748884e-03f, -8.249975284e-04f, 6.081402275e-04f, -4.388961179e-04f,
+    3.090443604e-04f, -2.113522933e-04f, 1.395150652e-04f, -8.809917470e-05f, 5.248528006e-05f, -2.880780478e-05f, 1.389045462e-05f, -5.177895935e-06f,
+  },
+  {
+    -9.948224349e-06f, 2.229692570e-05f, -4.242671811e-05f, 7.329925097e-05f, -1.185478654e-04f, 1.825445897e-04f, -2.704629749e-04f, 3.883371613e-04f,
+    -5.431189836e-04f, 7.427368630e-04f, -9.961628732e-04f, 1.313497956e-03f, -1.706090227e-03f, 2.186708314e-03f, -2.769801889e-03f, 3.471896861e-03f,
+    -4.312196528e-03f, 5.313498311e-03f, -6.503599587e-03f, 7.917476672e-03f, -9.600720010e-03f, 1.161508295e-02f, -1.404774216e-02f, 1.702742143e-02f,
+    -2.075402754e-02f, 2.555702025e-02f, -3.202115369e-02f, 4.129181728e-02f, -5.595277546e-02f, 8.329747047e-02f, -1.549561663e-01f, 9.353324896e-01f,
+    2.332326876e-01f, -1.025096355e-01f, 6.460973609e-02f, -4.627307170e-02f, 3.529628596e-02f, -2.789696042e-02f, 2.252105851e-02f, -1.841378621e-02f,
+    1.516481323e-02f, -1.253190710e-02f, 1.036254977e-02f, -8.555431233e-03f, 7.040029225e-03f, -5.765114661e-03f, 4.691971329e-03f, -3.790248355e-03f,
+    3.035352375e-03f, -2.406775047e-03f, 1.887006328e-03f, -1.460823085e-03f, 1.114821807e-03f, -8.371110018e-04f, 6.171075539e-04f, -4.453995225e-04f,
+    3.136498205e-04f, -2.145233268e-04f, 1.416256674e-04f, -8.944597526e-05f, 5.329892029e-05f, -2.926349754e-05f, 1.411767058e-05f, -5.269121513e-06f,
+  },
+  {
+    -1.005276942e-05f, 2.254714116e-05f, -4.291898356e-05f, 7.416780553e-05f, -1.199736332e-04f, 1.847649200e-04f, -2.737822414e-04f, 3.931381670e-04f,
+    -5.498751353e-04f, 7.520251256e-04f, -1.008677587e-03f, 1.330065723e-03f, -1.727686254e-03f, 2.214474877e-03f, -2.805069955e-03f, 3.516212514e-03f,
+    -4.367354687e-03f, 5.381587561e-03f, -6.587064015e-03f, 8.019203974e-03f, -9.724170776e-03f, 1.176448599e-02f, -1.422839891e-02f, 1.724619796e-02f,
+    -2.102018545e-02f, 2.588370092e-02f, -3.242822892e-02f, 4.181192344e-02f, -5.664593430e-02f, 8.429428344e-02f, -1.566295871e-01f, 9.333375132e-01f,
+    2.373050159e-01f, -1.040755470e-01f, 6.555774879e-02f, -4.693950706e-02f, 3.579947651e-02f, -2.829227499e-02f, 2.283902984e-02f, -1.867320611e-02f,
+    1.537821433e-02f, -1.270818234e-02f, 1.050832849e-02f, -8.675855133e-03f, 7.139214413e-03f, -5.846438879e-03f, 4.758258982e-03f, -3.843893439e-03f,
+    3.078402544e-03f, -2.440990845e-03f, 1.913904326e-03f, -1.481708483e-03f, 1.130814127e-03f, -8.491652324e-04f, 6.260322894e-04f, -4.518730923e-04f,
+    3.182350210e-04f, -2.176811199e-04f, 1.437280312e-04f, -9.078798017e-05f, 5.411003242e-05f, -2.971806991e-05f, 1.434456774e-05f, -5.360422744e-06f,
+  },
+  {
+    -1.015562108e-05f, 2.279393733e-05f, -4.340512859e-05f, 7.502622151e-05f, -1.213835140e-04f, 1.869613939e-04f, -2.770668869e-04f, 3.978903285e-04f,
+    -5.565640040e-04f, 7.612225923e-04f, -1.021071952e-03f, 1.346476464e-03f, -1.749080239e-03f, 2.241984666e-03f, -2.840015240e-03f, 3.560126299e-03f,
+    -4.422016689e-03f, 5.449068598e-03f, -6.669787221e-03f, 8.120031985e-03f, -9.846533646e-03f, 1.191257437e-02f, -1.440746509e-02f, 1.746304208e-02f,
+    -2.128397644e-02f, 2.620744178e-02f, -3.283156865e-02f, 4.232710133e-02f, -5.733215417e-02f, 8.528002113e-02f, -1.582791341e-01f, 9.313141882e-01f,
+    2.413865628e-01f, -1.056369908e-01f, 6.650168214e-02f, -4.760263629e-02f, 3.629999109e-02f, -2.868540408e-02f, 2.315520268e-02f, -1.893113900e-02f,
+    1.559038344e-02f, -1.288343705e-02f, 1.065326360e-02f, -8.795584256e-03f, 7.237830314e-03f, -5.927299617e-03f, 4.824172179e-03f, -3.897238672e-03f,
+    3.121215030e-03f, -2.475020397e-03f, 1.940658268e-03f, -1.502484083e-03f, 1.146724143e-03f, -8.611589311e-04f, 6.349134750e-04f, -4.583161278e-04f,
+    3.227994638e-04f, -2.208253274e-04f, 1.458219248e-04f, -9.212504015e-05f, 5.491852522e-05f, -3.017147005e-05f, 1.457111972e-05f, -5.451788650e-06f,
+  },
+  {
+    -1.025677717e-05f, 2.303730307e-05f, -4.388512573e-05f, 7.587444459e-05f, -1.227774121e-04f, 1.891338549e-04f, -2.803166687e-04f, 4.025932850e-04f,
+    -5.631850701e-04f, 7.703285356e-04f, -1.033344972e-03f, 1.362728844e-03f, -1.770270420e-03f, 2.269235394e-03f, -2.874634813e-03f, 3.603634508e-03f,
+    -4.476177889e-03f, 5.515935660e-03f, -6.751762113e-03f, 8.219952038e-03f, -9.967798083e-03f, 1.205933536e-02f, -1.458492529e-02f, 1.767793521e-02f,
+    -2.154537806e-02f, 2.652821562e-02f, -3.323113966e-02f, 4.283731011e-02f, -5.801138472e-02f, 8.625462488e-02f, -1.599047952e-01f, 9.292626311e-01f,
+    2.454771312e-01f, -1.071938088e-01f, 6.744143725e-02f, -4.826238991e-02f, 3.679777746e-02f, -2.907630677e-02f, 2.346954420e-02f, -1.918755813e-02f,
+    1.580129854e-02f, -1.305765305e-02f, 1.079734007e-02f, -8.914606161e-03f, 7.335866663e-03f, -6.007688443e-03f, 4.889704032e-03f, -3.950278463e-03f,
+    3.163785333e-03f, -2.508860114e-03f, 1.967265323e-03f, -1.523147677e-03f, 1.162550156e-03f, -8.730908130e-04f, 6.437501544e-04f, -4.647279314e-04f,
+    3.273426514e-04f, -2.239556041e-04f, 1.479071166e-04f, -9.345700599e-05f, 5.572430746e-05f, -3.062364605e-05f, 1.479730004e-05f, -5.543208180e-06f,
+  },
+  {
+    -1.035623569e-05f, 2.327722761e-05f, -4.435894824e-05f, 7.671242165e-05f, -1.241552338e-04f, 1.912821492e-04f, -2.835313482e-04f, 4.072466812e-04f,
+    -5.697378218e-04f, 7.793422381e-04f, -1.045495667e-03f, 1.378821545e-03f, -1.791255058e-03f, 2.296224802e-03f, -2.908925781e-03f, 3.646733476e-03f,
+    -4.529833699e-03f, 5.582183054e-03f, -6.832981680e-03f, 8.318955559e-03f, -1.008795366e-02f, 1.220475632e-02f, -1.476076428e-02f, 1.789085897e-02f,
+    -2.180436810e-02f, 2.684599554e-02f, -3.362690916e-02f, 4.334250950e-02f, -5.868357636e-02f, 8.721803715e-02f, -1.615065598e-01f, 9.271829605e-01f,
+    2.495765233e-01f, -1.087458430e-01f, 6.837691543e-02f, -4.891869863e-02f, 3.729278352e-02f, -2.946494231e-02f, 2.378202171e-02f, -1.944243685e-02f,
+    1.601093773e-02f, -1.323081225e-02f, 1.094054293e-02f, -9.032908464e-03f, 7.433313242e-03f, -6.087596962e-03f, 4.954847678e-03f, -4.003007243e-03f,
+    3.206108971e-03f, -2.542506421e-03f, 1.993722668e-03f, -1.543697065e-03f, 1.178290476e-03f, -8.849595965e-04f, 6.525413736e-04f, -4.711078071e-04f,
+    3.318640877e-04f, -2.270716059e-04f, 1.499833754e-04f, -9.478372852e-05f, 5.652728784e-05f, -3.107454592e-05f, 1.502308217e-05f, -5.634670208e-06f,
+  },
+  {
+    -1.045399490e-05f, 2.351370063e-05f, -4.482657011e-05f, 7.754010077e-05f, -1.255168870e-04f, 1.934061261e-04f, -2.867106909e-04f, 4.118501674e-04f,
+    -5.762217551e-04f, 7.882629927e-04f, -1.057523066e-03f, 1.394753267e-03f, -1.812032437e-03f, 2.322950661e-03f, -2.942885288e-03f, 3.689419587e-03f,
+    -4.582979586e-03f, 5.647805151e-03f, -6.913438995e-03f, 8.417034079e-03f, -1.020699009e-02f, 1.234882478e-02f, -1.493496700e-02f, 1.810179520e-02f,
+    -2.206092463e-02f, 2.716075497e-02f, -3.401884477e-02f, 4.384265973e-02f, -5.934868024e-02f, 8.817020158e-02f, -1.630844193e-01f, 9.250752961e-01f,
+    2.536845403e-01f, -1.102929351e-01f, 6.930801809e-02f, -4.957149334e-02f, 3.778495737e-02f, -2.985127008e-02f, 2.409260264e-02f, -1.969574865e-02f,
+    1.621927923e-02f, -1.340289665e-02f, 1.108285726e-02f, -9.150478831e-03f, 7.530159875e-03f, -6.167016810e-03f, 5.019596285e-03f, -4.055419468e-03f,
+    3.248181479e-03f, -2.575955756e-03f, 2.020027494e-03f, -1.564130057e-03f, 1.193943415e-03f, -8.967640040e-04f, 6.612861813e-04f, -4.774550604e-04f,
+    3.363632773e-04f, -2.301729887e-04f, 1.520504702e-04f, -9.610505868e-05f, 5.732737508e-05f, -3.152411761e-05f, 1.524843946e-05f, -5.726163532e-06f,
+  },
+  {
+    -1.055005323e-05f, 2.374671221e-05f, -4.528796607e-05f, 7.835743125e-05f, -1.268622816e-04f, 1.955056373e-04f, -2.898544663e-04f, 4.164033996e-04f,
+    -5.826363735e-04f, 7.970901031e-04f, -1.069426215e-03f, 1.410522726e-03f, -1.832600865e-03f, 2.349410772e-03f, -2.976510511e-03f, 3.731689267e-03f,
+    -4.635611070e-03f, 5.712796392e-03f, -6.993127211e-03f, 8.514179224e-03f, -1.032489718e-02f, 1.249152842e-02f, -1.510751856e-02f, 1.831072594e-02f,
+    -2.231502600e-02f, 2.747246766e-02f, -3.440691452e-02f, 4.433772161e-02f, -6.000664830e-02f, 8.911106295e-02f, -1.646383663e-01f, 9.229397596e-01f,
+    2.578009825e-01f, -1.118349267e-01f, 7.023464687e-02f, -5.022070515e-02f, 3.827424731e-02f, -3.023524967e-02f, 2.440125458e-02f, -1.994746713e-02f,
+    1.642630131e-02f, -1.357388830e-02f, 1.122426822e-02f, -9.267304988e-03f, 7.626396433e-03f, -6.245939664e-03f, 5.083943049e-03f, -4.107509613e-03f,
+    3.289998409e-03f, -2.609204572e-03f, 2.046177000e-03f, -1.584444466e-03f, 1.209507294e-03f, -9.085027618e-04f, 6.699836290e-04f, -4.837689988e-04f,
+    3.408397260e-04f, -2.332594095e-04f, 1.541081703e-04f, -9.742084752e-05f, 5.812447786e-05f, -3.197230899e-05f, 1.547334521e-05f, -5.817676882e-06f,
+  },
+  {
+    -1.064440932e-05f, 2.397625285e-05f, -4.574311159e-05f, 7.916436361e-05f, -1.281913296e-04f, 1.975805375e-04f, -2.929624479e-04f, 4.209060396e-04f,
+    -5.889811886e-04f, 8.058228832e-04f, -1.081204174e-03f, 1.426128658e-03f, -1.852958671e-03f, 2.375602962e-03f, -3.009798666e-03f, 3.773538987e-03f,
+    -4.687723731e-03f, 5.777151286e-03f, -7.072039565e-03f, 8.610382724e-03f, -1.044166487e-02f, 1.263285507e-02f, -1.527840427e-02f, 1.851763346e-02f,
+    -2.256665079e-02f, 2.778110769e-02f, -3.479108686e-02f, 4.482765647e-02f, -6.065743322e-02f, 9.004056721e-02f, -1.661683954e-01f, 9.207764740e-01f,
+    2.619256495e-01f, -1.133716595e-01f, 7.115670354e-02f, -5.086626538e-02f, 3.876060183e-02f, -3.061684081e-02f, 2.470794523e-02f, -2.019756600e-02f,
+    1.663198239e-02f, -1.374376937e-02f, 1.136476105e-02f, -9.383374716e-03f, 7.722012833e-03f, -6.324357238e-03f, 5.147881198e-03f, -4.159272181e-03f,
+    3.331555333e-03f, -2.642249335e-03f, 2.072168396e-03f, -1.604638118e-03f, 1.224980437e-03f, -9.201746003e-04f, 6.786327708e-04f, -4.900489314e-04f,
+    3.452929407e-04f, -2.363305256e-04f, 1.561562452e-04f, -9.873094619e-05f, 5.891850488e-05f, -3.241906790e-05f, 1.569777262e-05f, -5.909198912e-06f,
+  },
+  {
+    -1.073706203e-05f, 2.420231347e-05f, -4.619198287e-05f, 7.996084958e-05f, -1.295039445e-04f, 1.996306843e-04f, -2.960344133e-04f, 4.253577547e-04f,
+    -5.952557198e-04f, 8.144606575e-04f, -1.092856015e-03f, 1.441569816e-03f, -1.873104208e-03f, 2.401525089e-03f, -3.042747006e-03f, 3.814965265e-03f,
+    -4.739313201e-03f, 5.840864410e-03f, -7.150169378e-03f, 8.705636408e-03f, -1.055728324e-02f, 1.277279268e-02f, -1.544760959e-02f, 1.872250025e-02f,
+    -2.281577785e-02f, 2.808664948e-02f, -3.517133065e-02f, 4.531242621e-02f, -6.130098846e-02f, 9.095866144e-02f, -1.676745025e-01f, 9.185855640e-01f,
+    2.660583401e-01f, -1.149029749e-01f, 7.207409011e-02f, -5.150810556e-02f, 3.924396960e-02f, -3.099600340e-02f, 2.501264248e-02f, -2.044601910e-02f,
+    1.683630095e-02f, -1.391252210e-02f, 1.150432105e-02f, -9.498675856e-03f, 7.816999041e-03f, -6.402261283e-03f, 5.211403989e-03f, -4.210701697e-03f,
+    3.372847843e-03f, -2.675086527e-03f, 2.097998905e-03f, -1.624708845e-03f, 1.240361176e-03f, -9.317782544e-04f, 6.872326639e-04f, -4.962941696e-04f,
+    3.497224297e-04f, -2.393859952e-04f, 1.581944650e-04f, -1.000352060e-04f, 5.970936484e-05f, -3.286434211e-05f, 1.592169483e-05f, -6.000718210e-06f,
+  },
+  {
+    -1.082801041e-05f, 2.442488538e-05f, -4.663455686e-05f, 8.074684207e-05f, -1.308000420e-04f, 2.016559380e-04f, -2.990701443e-04f, 4.297582183e-04f,
+    -6.014594943e-04f, 8.230027612e-04f, -1.104380825e-03f, 1.456844973e-03f, -1.893035854e-03f, 2.427175042e-03f, -3.075352820e-03f, 3.855964665e-03f,
+    -4.790375172e-03f, 5.903930411e-03f, -7.227510055e-03f, 8.799932208e-03f, -1.067174245e-02f, 1.291132938e-02f, -1.561512017e-02f, 1.892530899e-02f,
+    -2.306238631e-02f, 2.838906776e-02f, -3.554761517e-02f, 4.579199328e-02f, -6.193726823e-02f, 9.186529391e-02f, -1.691566853e-01f, 9.163671557e-01f,
+    2.701988520e-01f, -1.164287142e-01f, 7.298670875e-02f, -5.214615745e-02f, 3.972429952e-02f, -3.137269752e-02f, 2.531531434e-02f, -2.069280040e-02f,
+    1.703923561e-02f, -1.408012881e-02f, 1.164293359e-02f, -9.613196309e-03f, 7.911345070e-03f, -6.479643591e-03f, 5.274504711e-03f, -4.261792712e-03f,
+    3.413871548e-03f, -2.707712644e-03f, 2.123665758e-03f, -1.644654487e-03f, 1.255647847e-03f, -9.433124629e-04f, 6.957823684e-04f, -5.025040263e-04f,
+    3.541277023e-04f, -2.424254772e-04f, 1.602225999e-04f, -1.013334783e-04f, 6.049696646e-05f, -3.330807934e-05f, 1.614508492e-05f, -6.092223293e-06f,
+  },
+  {
+    -1.091725373e-05f, 2.464396032e-05f, -4.707081121e-05f, 8.152229525e-05f, -1.320795396e-04f, 2.036561618e-04f, -3.020694267e-04f, 4.341071093e-04f,
+    -6.075920472e-04f, 8.314485401e-04f, -1.115777705e-03f, 1.471952918e-03f, -1.912752009e-03f, 2.452550738e-03f, -3.107613435e-03f, 3.896533797e-03f,
+    -4.840905391e-03f, 5.966344006e-03f, -7.304055085e-03f, 8.893262159e-03f, -1.078503284e-02f, 1.304845342e-02f, -1.578092185e-02f, 1.912604262e-02f,
+    -2.330645557e-02f, 2.868833760e-02f, -3.591991015e-02f, 4.626632067e-02f, -6.256622753e-02f, 9.276041403e-02f, -1.706149430e-01f, 9.141213771e-01f,
+    2.743469824e-01f, -1.179487188e-01f, 7.389446186e-02f, -5.278035305e-02f, 4.020154070e-02f, -3.174688346e-02f, 2.561592899e-02f, -2.093788400e-02f,
+    1.724076509e-02f, -1.424657192e-02f, 1.178058411e-02f, -9.726924035e-03f, 8.005040985e-03f, -6.556495995e-03f, 5.337176686e-03f, -4.312539802e-03f,
+    3.454622079e-03f, -2.740124198e-03f, 2.149166202e-03f, -1.664472893e-03f, 1.270838794e-03f, -9.547759696e-04f, 7.042809474e-04f, -5.086778167e-04f,
+    3.585082691e-04f, -2.454486312e-04f, 1.622404208e-04f, -1.026256148e-04f, 6.128121849e-05f, -3.375022727e-05f, 1.636791588e-05f, -6.183702610e-06f,
+  },
+  {
+    -1.100479145e-05f, 2.485953044e-05f, -4.750072435e-05f, 8.228716448e-05f, -1.333423566e-04f, 2.056312217e-04f, -3.050320503e-04f, 4.384041123e-04f,
+    -6.136529216e-04f, 8.397973506e-04f, -1.127045771e-03f, 1.486892459e-03f, -1.932251095e-03f, 2.477650125e-03f, -3.139526214e-03f, 3.936669318e-03f,
+    -4.890899663e-03f, 6.028099981e-03f, -7.379798044e-03f, 8.985618398e-03f, -1.089714482e-02f, 1.318415323e-02f, -1.594500064e-02f, 1.932468426e-02f,
+    -2.354796530e-02f, 2.898443443e-02f, -3.628818571e-02f, 4.673537194e-02f, -6.318782214e-02f, 9.364397239e-02f, -1.720492764e-01f, 9.118483572e-01f,
+    2.785025275e-01f, -1.194628299e-01f, 7.479725205e-02f, -5.341062458e-02f, 4.067564243e-02f, -3.211852165e-02f, 2.591445476e-02f, -2.118124413e-02f,
+    1.744086820e-02f, -1.441183394e-02f, 1.191725816e-02f, -9.839847059e-03f, 8.098076900e-03f, -6.632810366e-03f, 5.399413268e-03f, -4.362937570e-03f,
+    3.495095086e-03f, -2.772317717e-03f, 2.174497491e-03f, -1.684161922e-03f, 1.285932368e-03f, -9.661675226e-04f, 7.127274675e-04f, -5.148148582e-04f,
+    3.628636422e-04f, -2.484551176e-04f, 1.642476987e-04f, -1.039114673e-04f, 6.206202971e-05f, -3.419073355e-05f, 1.659016064e-05f, -6.275144543e-06f,
+  },
+  {
+    -1.109062323e-05f, 2.507158829e-05f, -4.792427542e-05f, 8.304140635e-05f, -1.345884144e-04f, 2.075809867e-04f, -3.079578093e-04f, 4.426489180e-04f,
+    -6.196416686e-04f, 8.480485599e-04f, -1.138184152e-03f, 1.501662423e-03f, -1.951531561e-03f, 2.502471179e-03f, -3.171088559e-03f, 3.976367931e-03f,
+    -4.940353851e-03f, 6.089193193e-03f, -7.454732592e-03f, 9.076993167e-03f, -1.100806896e-02f, 1.331841738e-02f, -1.610734274e-02f, 1.952121729e-02f,
+    -2.378689541e-02f, 2.927733399e-02f, -3.665241242e-02f, 4.719911122e-02f, -6.380200859e-02f, 9.451592073e-02f, -1.734596881e-01f, 9.095482271e-01f,
+    2.826652828e-01f, -1.209708887e-01f, 7.569498217e-02f, -5.403690452e-02f, 4.114655428e-02f, -3.248757275e-02f, 2.621086013e-02f, -2.142285515e-02f,
+    1.763952389e-02f, -1.457589748e-02f, 1.205294132e-02f, -9.951953468e-03f, 8.190442983e-03f, -6.708578620e-03f, 5.461207847e-03f, -4.412980645e-03f,
+    3.535286242e-03f, -2.804289745e-03f, 2.199656896e-03f, -1.703719441e-03f, 1.300926926e-03f, -9.774858749e-04f, 7.211209983e-04f, -5.209144702e-04f,
+    3.671933350e-04f, -2.514445976e-04f, 1.662442052e-04f, -1.051908877e-04f, 6.283930896e-05f, -3.462954580e-05f, 1.681179208e-05f, -6.366537410e-06f,
+  },
+  {
+    -1.117474894e-05f, 2.528012684e-05f, -4.834144429e-05f, 8.378497865e-05f, -1.358176362e-04f, 2.095053284e-04f, -3.108465018e-04f, 4.468412227e-04f,
+    -6.255578472e-04f, 8.562015460e-04f, -1.149191992e-03f, 1.516261657e-03f, -1.970591877e-03f, 2.527011908e-03f, -3.202297910e-03f, 4.015626385e-03f,
+    -4.989263874e-03f, 6.149618570e-03f, -7.528852476e-03f, 9.167378812e-03f, -1.111779595e-02f, 1.345123458e-02f, -1.626793454e-02f, 1.971562528e-02f,
+    -2.402322613e-02f, 2.956701235e-02f, -3.701256127e-02f, 4.765750320e-02f, -6.440874422e-02f, 9.537621195e-02f, -1.748461820e-01f, 9.072211189e-01f,
+    2.868350432e-01f, -1.224727364e-01f, 7.658755527e-02f, -5.465912561e-02f, 4.161422598e-02f, -3.285399758e-02f, 2.650511377e-02f, -2.166269156e-02f,
+    1.783671121e-02f, -1.473874525e-02f, 1.218761927e-02f, -1.006323141e-02f, 8.282129452e-03f, -6.783792715e-03f, 5.522553844e-03f, -4.462663683e-03f,
+    3.575191239e-03f, -2.836036841e-03f, 2.224641698e-03f, -1.723143327e-03f, 1.315820830e-03f, -9.887297844e-04f, 7.294606129e-04f, -5.269759746e-04f,
+    3.714968623e-04f, -2.544167333e-04f, 1.682297125e-04f, -1.064637282e-04f, 6.361296514e-05f, -3.506661161e-05f, 1.703278302e-05f, -6.457869463e-06f,
+  },
+  {
+    -1.125716864e-05f, 2.548513946e-05f, -4.875221159e-05f, 8.451784041e-05f, -1.370299470e-04f, 2.114041215e-04f, -3.136979302e-04f, 4.509807286e-04f,
+    -6.314010246e-04f, 8.642556976e-04f, -1.160068448e-03f, 1.530689022e-03f, -1.989430539e-03f, 2.551270351e-03f, -3.233151745e-03f, 4.054441479e-03f,
+    -5.037625712e-03f, 6.209371112e-03f, -7.602151529e-03f, 9.256767783e-03f, -1.122631661e-02f, 1.358259371e-02f, -1.642676260e-02f, 1.990789204e-02f,
+    -2.425693795e-02f, 2.985344596e-02f, -3.736860368e-02f, 4.811051313e-02f, -6.500798712e-02f, 9.622480013e-02f, -1.762087638e-01f, 9.048671666e-01f,
+    2.910116025e-01f, -1.239682142e-01f, 7.747487469e-02f, -5.527722082e-02f, 4.207860754e-02f, -3.321775717e-02f, 2.679718449e-02f, -2.190072801e-02f,
+    1.803240933e-02f, -1.490036002e-02f, 1.232127779e-02f, -1.017366912e-02f, 8.373126581e-03f, -6.858444653e-03f, 5.583444717e-03f, -4.511981368e-03f,
+    3.614805792e-03f, -2.867555583e-03f, 2.249449191e-03f, -1.742431466e-03f, 1.330612453e-03f, -9.998980140e-04f, 7.377453880e-04f, -5.329986955e-04f,
+    3.757737406e-04f, -2.573711878e-04f, 1.702039930e-04f, -1.077298412e-04f, 6.438290720e-05f, -3.550187855e-05f, 1.725310620e-05f, -6.549128891e-06f,
+  },
+  {
+    -1.133788260e-05f, 2.568661993e-05f, -4.915655865e-05f, 8.523995186e-05f, -1.382252739e-04f, 2.132772434e-04f, -3.165119010e-04f, 4.550671438e-04f,
+    -6.371707758e-04f, 8.722104144e-04f, -1.170812692e-03f, 1.544943403e-03f, -2.008046065e-03f, 2.575244575e-03f, -3.263647579e-03f, 4.092810057e-03f,
+    -5.085435402e-03f, 6.268445890e-03f, -7.674623673e-03f, 9.345152639e-03f, -1.133362186e-02f, 1.371248379e-02f, -1.658381366e-02f, 2.009800162e-02f,
+    -2.448801161e-02f, 3.013661159e-02f, -3.772051151e-02f, 4.855810681e-02f, -6.559969620e-02f, 9.706164051e-02f, -1.775474407e-01f, 9.024865056e-01f,
+    2.951947540e-01f, -1.254571631e-01f, 7.835684401e-02f, -5.589112341e-02f, 4.253964919e-02f, -3.357881277e-02f, 2.708704128e-02f, -2.213693927e-02f,
+    1.822659754e-02f, -1.506072471e-02f, 1.245390271e-02f, -1.028325486e-02f, 8.463424699e-03f, -6.932526479e-03f, 5.643873959e-03f, -4.560928413e-03f,
+    3.654125637e-03f, -2.898842565e-03f, 2.274076683e-03f, -1.761581754e-03f, 1.345300171e-03f, -1.010989332e-03f, 7.459744038e-04f, -5.389819594e-04f,
+    3.800234877e-04f, -2.603076249e-04f, 1.721668199e-04f, -1.089890795e-04f, 6.514904418e-05f, -3.593529418e-05f, 1.747273433e-05f, -6.640303821e-06f,
+  },
+  {
+    -1.141689127e-05f, 2.588456245e-05f, -4.955446756e-05f, 8.595127445e-05f, -1.394035458e-04f, 2.151245744e-04f, -3.192882247e-04f, 4.591001822e-04f,
+    -6.428666840e-04f, 8.800651068e-04f, -1.181423912e-03f, 1.559023701e-03f, -2.026436998e-03f, 2.598932679e-03f, -3.293782967e-03f, 4.130729013e-03f,
+    -5.132689040e-03f, 6.326838046e-03f, -7.746262916e-03f, 9.432526041e-03f, -1.143970279e-02f, 1.384089402e-02f, -1.673907469e-02f, 2.028593827e-02f,
+    -2.471642815e-02f, 3.041648634e-02f, -3.806825707e-02f, 4.900025066e-02f, -6.618383112e-02f, 9.788668949e-02f, -1.788622215e-01f, 9.000792727e-01f,
+    2.993842902e-01f, -1.269394244e-01f, 7.923336706e-02f, -5.650076691e-02f, 4.299730138e-02f, -3.393712581e-02f, 2.737465332e-02f, -2.237130028e-02f,
+    1.841925525e-02f, -1.521982230e-02f, 1.258547996e-02f, -1.039197700e-02f, 8.553014191e-03f, -7.006030284e-03f, 5.703835100e-03f, -4.609499560e-03f,
+    3.693146536e-03f, -2.929894400e-03f, 2.298521494e-03f, -1.780592098e-03f, 1.359882370e-03f, -1.022002511e-03f, 7.541467442e-04f, -5.449250954e-04f,
+    3.842456231e-04f, -2.632257097e-04f, 1.741179667e-04f, -1.102412958e-04f, 6.591128520e-05f, -3.636680605e-05f, 1.769164006e-05f, -6.731382318e-06f,
+  },
+  {
+    -1.149419532e-05f, 2.607896160e-05f, -4.994592114e-05f, 8.665177087e-05f, -1.405646936e-04f, 2.169459978e-04f, -3.220267163e-04f, 4.630795637e-04f,
+    -6.484883407e-04f, 8.878191963e-04f, -1.191901308e-03f, 1.572928835e-03f, -2.044601907e-03f, 2.622332793e-03f, -3.323555501e-03f, 4.168195287e-03f,
+    -5.179382781e-03f, 6.384542797e-03f, -7.817063355e-03f, 9.518880760e-03f, -1.154455060e-02f, 1.396781372e-02f, -1.689253279e-02f, 2.047168648e-02f,
+    -2.494216891e-02f, 3.069304768e-02f, -3.841181307e-02f, 4.943691162e-02f, -6.676035235e-02f, 9.869990466e-02f, -1.801531167e-01f, 8.976456062e-01f,
+    3.035800029e-01f, -1.284148391e-01f, 8.010434795e-02f, -5.710608512e-02f, 4.345151485e-02f, -3.429265793e-02f, 2.765998993e-02f, -2.260378610e-02f,
+    1.861036199e-02f, -1.537763590e-02f, 1.271599555e-02f, -1.049982396e-02f, 8.641885497e-03f, -7.078948208e-03f, 5.763321707e-03f, -4.657689579e-03f,
+    3.731864271e-03f, -2.960707716e-03f, 2.322780959e-03f, -1.799460414e-03f, 1.374357444e-03f, -1.032936331e-03f, 7.622614968e-04f, -5.508274349e-04f,
+    3.884396681e-04f, -2.661251080e-04f, 1.760572077e-04f, -1.114863435e-04f, 6.666953948e-05f, -3.679636171e-05f, 1.790979599e-05f, -6.822352389e-06f,
+  },
+  {
+    -1.156979560e-05f, 2.626981239e-05f, -5.033090292e-05f, 8.734140500e-05f, -1.417086500e-04f, 2.187413997e-04f, -3.247271948e-04f, 4.670050139e-04f,
+    -6.540353451e-04f, 8.954721153e-04f, -1.202244097e-03f, 1.586657745e-03f, -2.062539382e-03f, 2.645443078e-03f, -3.352962814e-03f, 4.205205869e-03f,
+    -5.225512841e-03f, 6.441555430e-03f, -7.887019175e-03f, 9.604209674e-03f, -1.164815660e-02f, 1.409323239e-02f, -1.704417530e-02f, 2.065523098e-02f,
+    -2.516521547e-02f, 3.096627342e-02f, -3.875115270e-02f, 4.986805724e-02f, -6.732922115e-02f, 9.950124475e-02f, -1.814201381e-01f, 8.951856459e-01f,
+    3.077816832e-01f, -1.298832486e-01f, 8.096969108e-02f, -5.770701212e-02f, 4.390224055e-02f, -3.464537101e-02f, 2.794302064e-02f, -2.283437198e-02f,
+    1.879989742e-02f, -1.553414870e-02f, 1.284543557e-02f, -1.060678424e-02f, 8.730029117e-03f, -7.151272433e-03f, 5.822327385e-03f, -4.705493270e-03f,
+    3.770274647e-03f, -2.991279163e-03f, 2.346852426e-03f, -1.818184629e-03f, 1.388723792e-03f, -1.043789575e-03f, 7.703177534e-04f, -5.566883124e-04f,
+    3.926051455e-04f, -2.690054868e-04f, 1.779843176e-04f, -1.127240760e-04f, 6.742371634e-05f, -3.722390870e-05f, 1.812717468e-05f, -6.913201982e-06f,
+  },
+  {
+    -1.164369316e-05f, 2.645711021e-05f, -5.070939718e-05f, 8.802014196e-05f, -1.428353496e-04f, 2.205106690e-04f, -3.273894833e-04f, 4.708762644e-04f,
+    -6.595073051e-04f, 9.030233071e-04f, -1.212451508e-03f, 1.600209390e-03f, -2.080248041e-03f, 2.668261725e-03f, -3.382002575e-03f, 4.241757795e-03f,
+    -5.271075494e-03f, 6.497871307e-03f, -7.956124652e-03f, 9.688505768e-03f, -1.175051226e-02f, 1.421713969e-02f, -1.719398971e-02f, 2.083655673e-02f,
+    -2.538554971e-02f, 3.123614172e-02f, -3.908624957e-02f, 5.029365563e-02f, -6.789039957e-02f, 1.002906697e-01f, -1.826632994e-01f, 8.926995332e-01f,
+    3.119891215e-01f, -1.313444940e-01f, 8.182930114e-02f, -5.830348230e-02f, 4.434942970e-02f, -3.499522711e-02f, 2.822371515e-02f, -2.306303328e-02f,
+    1.898784133e-02f, -1.568934403e-02f, 1.297378622e-02f, -1.071284640e-02f, 8.817435610e-03f, -7.222995193e-03f, 5.880845776e-03f, -4.752905467e-03f,
+    3.808373496e-03f, -3.021605406e-03f, 2.370733259e-03f, -1.836762681e-03f, 1.402979823e-03f, -1.054561034e-03f, 7.783146093e-04f, -5.625070646e-04f,
+    3.967415799e-04f, -2.718665141e-04f, 1.798990718e-04f, -1.139543471e-04f, 6.817372524e-05f, -3.764939460e-05f, 1.834374866e-05f, -7.003918986e-06f,
+  },
+  {
+    -1.171588924e-05f, 2.664085087e-05f, -5.108138894e-05f, 8.868794808e-05f, -1.439447292e-04f, 2.222536976e-04f, -3.300134093e-04f, 4.746930530e-04f,
+    -6.649038362e-04f, 9.104722263e-04f, -1.222522786e-03f, 1.613582746e-03f, -2.097726522e-03f, 2.690786957e-03f, -3.410672495e-03f, 4.277848153e-03f,
+    -5.316067075e-03f, 6.553485863e-03f, -8.024374150e-03f, 9.771762137e-03f, -1.185160918e-02f, 1.433952542e-02f, -1.734196374e-02f, 2.101564889e-02f,
+    -2.560315381e-02f, 3.150263108e-02f, -3.941707774e-02f, 5.071367548e-02f, -6.844385044e-02f, 1.010681405e-01f, -1.838826157e-01f, 8.901874107e-01f,
+    3.162021075e-01f, -1.327984165e-01f, 8.268308311e-02f, -5.889543034e-02f, 4.479303378e-02f, -3.534218854e-02f, 2.850204334e-02f, -2.328974555e-02f,
+    1.917417362e-02f, -1.584320528e-02f, 1.310103376e-02f, -1.081799908e-02f, 8.904095594e-03f, -7.294108768e-03f, 5.938870562e-03f, -4.799921030e-03f,
+    3.846156673e-03f, -3.051683132e-03f, 2.394420834e-03f, -1.855192519e-03f, 1.417123954e-03f, -1.065249504e-03f, 7.862511643e-04f, -5.682830313e-04f,
+    4.008484979e-04f, -2.747078592e-04f, 1.818012464e-04f, -1.151770109e-04f, 6.891947572e-05f, -3.807276696e-05f, 1.855949038e-05f, -7.094491237e-06f,
+  },
+  {
+    -1.178638528e-05f, 2.682103057e-05f, -5.144686392e-05f, 8.934479090e-05f, -1.450367271e-04f, 2.239703803e-04f, -3.325988044e-04f, 4.784551230e-04f,
+    -6.702245626e-04f, 9.178183382e-04f, -1.232457191e-03f, 1.626776810e-03f, -2.114973493e-03f, 2.713017028e-03f, -3.438970322e-03f, 4.313474077e-03f,
+    -5.360483979e-03f, 6.608394609e-03f, -8.091762122e-03f, 9.853971983e-03f, -1.195143907e-02f, 1.446037957e-02f, -1.748808527e-02f, 2.119249290e-02f,
+    -2.581801021e-02f, 3.176572038e-02f, -3.974361171e-02f, 5.112808608e-02f, -6.898953740e-02f, 1.018336196e-01f, -1.850781037e-01f, 8.876494227e-01f,
+    3.204204302e-01f, -1.342448577e-01f, 8.353094230e-02f, -5.948279123e-02f, 4.523300455e-02f, -3.568621783e-02f, 2.877797531e-02f, -2.351448447e-02f,
+    1.935887435e-02f, -1.599571600e-02f, 1.322716457e-02f, -1.092223099e-02f, 8.989999747e-03f, -7.364605489e-03f, 5.996395466e-03f, -4.846534855e-03f,
+    3.883620057e-03f, -3.081509045e-03f, 2.417912543e-03f, -1.873472102e-03f, 1.431154610e-03f, -1.075853786e-03f, 7.941265222e-04f, -5.740155550e-04f,
+    4.049254276e-04f, -2.775291923e-04f, 1.836906180e-04f, -1.163919219e-04f, 6.966087750e-05f, -3.849397338e-05f, 1.877437229e-05f, -7.184906514e-06f,
+  },
+  {
+    -1.185518290e-05f, 2.699764593e-05f, -5.180580858e-05f, 8.999063919e-05f, -1.461112839e-04f, 2.256606147e-04f, -3.351455044e-04f, 4.821622240e-04f,
+    -6.754691163e-04f, 9.250611195e-04f, -1.242253997e-03f, 1.639790598e-03f, -2.131987642e-03f, 2.734950224e-03f, -3.466893845e-03f, 4.348632752e-03f,
+    -5.404322661e-03f, 6.662593125e-03f, -8.158283114e-03f, 9.935128619e-03f, -1.204999379e-02f, 1.457969224e-02f, -1.763234239e-02f, 2.136707440e-02f,
+    -2.603010165e-02f, 3.202538883e-02f, -4.006582644e-02f, 5.153685727e-02f, -6.952742490e-02f, 1.025870702e-01f, -1.862497816e-01f, 8.850857146e-01f,
+    3.246438781e-01f, -1.356836588e-01f, 8.437278431e-02f, -6.006550025e-02f, 4.566929402e-02f, -3.602727771e-02f, 2.905148130e-02f, -2.373722589e-02f,
+    1.954192370e-02f, -1.614685981e-02f, 1.335216509e-02f, -1.102553094e-02f, 9.075138812e-03f, -7.434477736e-03f, 6.053414249e-03f, -4.892741867e-03f,
+    3.920759554e-03f, -3.111079872e-03f, 2.441205795e-03f, -1.891599401e-03f, 1.445070223e-03f, -1.086372688e-03f, 8.019397911e-04f, -5.797039812e-04f,
+    4.089718994e-04f, -2.803301850e-04f, 1.855669639e-04f, -1.175989349e-04f, 7.039784043e-05f, -3.891296148e-05f, 1.898836681e-05f, -7.275152543e-06f,
+  },
+  {
+    -1.192228392e-05f, 2.717069393e-05f, -5.215821013e-05f, 9.062546295e-05f, -1.471683419e-04f, 2.273243014e-04f, -3.376533494e-04f, 4.858141114e-04f,
+    -6.806371378e-04f, 9.322000579e-04f, -1.251912493e-03f, 1.652623144e-03f, -2.148767685e-03f, 2.756584861e-03f, -3.494440893e-03f, 4.383321411e-03f,
+    -5.447579639e-03f, 6.716077072e-03f, -8.223931761e-03f, 1.001522547e-02f, -1.214726532e-02f, 1.469745375e-02f, -1.777472339e-02f, 2.153937928e-02f,
+    -2.623941116e-02f, 3.228161600e-02f, -4.038369732e-02f, 5.193995950e-02f, -7.005747816e-02f, 1.033284570e-01f, -1.873976694e-01f, 8.824964337e-01f,
+    3.288722389e-01f, -1.371146614e-01f, 8.520851509e-02f, -6.064349304e-02f, 4.610185449e-02f, -3.636533119e-02f, 2.932253179e-02f, -2.395794584e-02f,
+    1.972330199e-02f, -1.629662048e-02f, 1.347602188e-02f, -1.112788778e-02f, 9.159503592e-03f, -7.503717941e-03f, 6.109920715e-03f, -4.938537026e-03f,
+    3.957571094e-03f, -3.140392355e-03f, 2.464298010e-03f, -1.909572400e-03f, 1.458869235e-03f, -1.096805025e-03f, 8.096900835e-04f, -5.853476583e-04f,
+    4.129874454e-04f, -2.831105100e-04f, 1.874300624e-04f, -1.187979050e-04f, 7.113027450e-05f, -3.932967891e-05f, 1.920144629e-05f, -7.365216999e-06f,
+  },
+  {
+    -1.198769034e-05f, 2.734017199e-05f, -5.250405647e-05f, 9.124923336e-05f, -1.482078453e-04f, 2.289613439e-04f, -3.401221836e-04f, 4.894105465e-04f,
+    -6.857282758e-04f, 9.392346523e-04f, -1.261431982e-03f, 1.665273502e-03f, -2.165312362e-03f, 2.777919288e-03f, -3.521609334e-03f, 4.417537338e-03f,
+    -5.490251489e-03f, 6.768842182e-03f, -8.288702791e-03f, 1.009425607e-02f, -1.224324580e-02f, 1.481365454e-02f, -1.791521672e-02f, 2.170939367e-02f,
+    -2.644592204e-02f, 3.253438183e-02f, -4.069720021e-02f, 5.233736381e-02f, -7.057966322e-02f, 1.040577458e-01f, -1.885217883e-01f, 8.798817283e-01f,
+    3.331052998e-01f, -1.385377071e-01f, 8.603804092e-02f, -6.121670552e-02f, 4.653063853e-02f, -3.670034149e-02f, 2.959109744e-02f, -2.417662048e-02f,
+    1.990298966e-02f, -1.644498185e-02f, 1.359872158e-02f, -1.122929045e-02f, 9.243084954e-03f, -7.572318588e-03f, 6.165908709e-03f, -4.983915325e-03f,
+    3.994050636e-03f, -3.169443262e-03f, 2.487186629e-03f, -1.927389092e-03f, 1.472550098e-03f, -1.107149616e-03f, 8.173765164e-04f, -5.909459379e-04f,
+    4.169715998e-04f, -2.858698414e-04f, 1.892796922e-04f, -1.199886879e-04f, 7.185808989e-05f, -3.974407335e-05f, 1.941358310e-05f, -7.455087503e-06f,
+  },
+  {
+    -1.205140436e-05f, 2.750607790e-05f, -5.284333624e-05f, 9.186192286e-05f, -1.492297404e-04f, 2.305716484e-04f, -3.425518556e-04f, 4.929512970e-04f,
+    -6.907421872e-04f, 9.461644127e-04f, -1.270811785e-03f, 1.677740747e-03f, -2.181620436e-03f, 2.798951885e-03f, -3.548397074e-03f, 4.451277864e-03f,
+    -5.532334852e-03f, 6.820884262e-03f, -8.352591020e-03f, 1.017221406e-02f, -1.233792747e-02f, 1.492828523e-02f, -1.805381108e-02f, 2.187710393e-02f,
+    -2.664961790e-02f, 3.278366660e-02f, -4.100631142e-02f, 5.272904180e-02f, -7.109394692e-02f, 1.047749035e-01f, -1.896221613e-01f, 8.772417483e-01f,
+    3.373428473e-01f, -1.399526377e-01f, 8.686126843e-02f, -6.178507397e-02f, 4.695559900e-02f, -3.703227206e-02f, 2.985714910e-02f, -2.439322618e-02f,
+    2.008096732e-02f, -1.659192791e-02f, 1.372025094e-02f, -1.132972800e-02f, 9.325873833e-03f, -7.640272212e-03f, 6.221372118e-03f, -5.028871788e-03f,
+    4.030194162e-03f, -3.198229377e-03f, 2.509869103e-03f, -1.945047484e-03f, 1.486111270e-03f, -1.117405289e-03f, 8.249982111e-04f, -5.964981745e-04f,
+    4.209238989e-04f, -2.886078543e-04f, 1.911156328e-04f, -1.211711395e-04f, 7.258119694e-05f, -4.015609254e-05f, 1.962474955e-05f, -7.544751631e-06f,
+  },
+  {
+    -1.211342837e-05f, 2.766840984e-05f, -5.317603880e-05f, 9.246350506e-05f, -1.502339753e-04f, 2.321551244e-04f, -3.449422180e-04f, 4.964361360e-04f,
+    -6.956785373e-04f, 9.529888603e-04f, -1.280051233e-03f, 1.690023971e-03f, -2.197690698e-03f, 2.819681065e-03f, -3.574802062e-03f, 4.484540374e-03f,
+    -5.573826426e-03f, 6.872199197e-03f, -8.415591361e-03f, 1.024909319e-02f, -1.243130273e-02f, 1.504133659e-02f, -1.819049532e-02f, 2.204249666e-02f,
+    -2.685048264e-02f, 3.302945096e-02f, -4.131100770e-02f, 5.311496569e-02f, -7.160029690e-02f, 1.054798981e-01f, -1.906988129e-01f, 8.745766449e-01f,
+    3.415846673e-01f, -1.413592950e-01f, 8.767810459e-02f, -6.234853500e-02f, 4.737668906e-02f, -3.736108662e-02f, 3.012065786e-02f, -2.460773945e-02f,
+    2.025721570e-02f, -1.673744277e-02f, 1.384059679e-02f, -1.142918951e-02f, 9.407861225e-03f, -7.707571404e-03f, 6.276304873e-03f, -5.073401478e-03f,
+    4.065997683e-03f, -3.226747507e-03f, 2.532342905e-03f, -1.962545596e-03f, 1.499551221e-03f, -1.127570877e-03f, 8.325542940e-04f, -6.020037259e-04f,
+    4.248438810e-04f, -2.913242255e-04f, 1.929376648e-04f, -1.223451161e-04f, 7.329950617e-05f, -4.056568425e-05f, 1.983491796e-05f, -7.634196906e-06f,
+  },
+  {
+    -1.217376491e-05f, 2.782716641e-05f, -5.350215425e-05f, 9.305395482e-05f, -1.512205000e-04f, 2.337116838e-04f, -3.472931280e-04f, 4.998648431e-04f,
+    -7.005369997e-04f, 9.597075278e-04f, -1.289149675e-03f, 1.702122287e-03f, -2.213521963e-03f, 2.840105272e-03f, -3.600822287e-03f, 4.517322299e-03f,
+    -5.614722977e-03f, 6.922782946e-03f, -8.477698816e-03f, 1.032488735e-02f, -1.252336411e-02f, 1.515279957e-02f, -1.832525851e-02f, 2.220555870e-02f,
+    -2.704850044e-02f, 3.327171594e-02f, -4.161126626e-02f, 5.349510827e-02f, -7.209868161e-02f, 1.061726991e-01f, -1.917517691e-01f, 8.718865707e-01f,
+    3.458305453e-01f, -1.427575210e-01f, 8.848845677e-02f, -6.290702557e-02f, 4.779386215e-02f, -3.768674912e-02f, 3.038159497e-02f, -2.482013699e-02f,
+    2.043171568e-02f, -1.688151064e-02f, 1.395974607e-02f, -1.152766419e-02f, 9.489038197e-03f, -7.774208808e-03f, 6.330700948e-03f, -5.117499489e-03f,
+    4.101457239e-03f, -3.254994482e-03f, 2.554605521e-03f, -1.979881458e-03f, 1.512868426e-03f, -1.137645220e-03f, 8.400438959e-04f, -6.074619534e-04f,
+    4.287310867e-04f, -2.940186330e-04f, 1.947455692e-04f, -1.235104747e-04f, 7.401292831e-05f, -4.097279632e-05f, 2.004406059e-05f, -7.723410808e-06f,
+  },
+  {
+    -1.223241676e-05f, 2.798234658e-05f, -5.382167338e-05f, 9.363324819e-05f, -1.521892665e-04f, 2.352412420e-04f, -3.496044467e-04f, 5.032372038e-04f,
+    -7.053172561e-04f, 9.663199588e-04f, -1.298106476e-03f, 1.714034827e-03f, -2.229113070e-03f, 2.860222982e-03f, -3.626455777e-03f, 4.549621124e-03f,
+    -5.655021327e-03f, 6.972631545e-03f, -8.538908481e-03f, 1.039959050e-02f, -1.261410426e-02f, 1.526266527e-02f, -1.845808991e-02f, 2.236627713e-02f,
+    -2.724365579e-02f, 3.351044289e-02f, -4.190706478e-02f, 5.386944294e-02f, -7.258907030e-02f, 1.068532768e-01f, -1.927810575e-01f, 8.691716799e-01f,
+    3.500802660e-01f, -1.441471578e-01f, 8.929223267e-02f, -6.346048298e-02f, 4.820707201e-02f, -3.800922377e-02f, 3.063993194e-02f, -2.503039565e-02f,
+    2.060444828e-02f, -1.702411585e-02f, 1.407768582e-02f, -1.162514129e-02f, 9.569395880e-03f, -7.840177121e-03f, 6.384554361e-03f, -5.161160952e-03f,
+    4.136568895e-03f, -3.282967152e-03f, 2.576654453e-03f, -1.997053114e-03f, 1.526061375e-03f, -1.147627165e-03f, 8.474661526e-04f, -6.128722213e-04f,
+    4.325850588e-04f, -2.966907561e-04f, 1.965391280e-04f, -1.246670724e-04f, 7.472137428e-05f, -4.137737663e-05f, 2.025214973e-05f, -7.812380769e-06f,
+  },
+  {
+    -1.228938684e-05f, 2.813394972e-05f, -5.413458772e-05f, 9.420136245e-05f, -1.531402287e-04f, 2.367437167e-04f, -3.518760395e-04f, 5.065530094e-04f,
+    -7.100189969e-04f, 9.728257084e-04f, -1.306921013e-03f, 1.725760743e-03f, -2.244462885e-03f, 2.880032704e-03f, -3.651700600e-03f, 4.581434381e-03f,
+    -5.694718364e-03f, 7.021741105e-03f, -8.599215545e-03f, 1.047319675e-02f, -1.270351600e-02f, 1.537092496e-02f, -1.858897900e-02f, 2.252463928e-02f,
+    -2.743593346e-02f, 3.374561357e-02f, -4.219838139e-02f, 5.423794369e-02f, -7.307143304e-02f, 1.075216028e-01f, -1.937867073e-01f, 8.664321276e-01f,
+    3.543336136e-01f, -1.455280478e-01f, 9.008934040e-02f, -6.400884489e-02f, 4.861627271e-02f, -3.832847503e-02f, 3.089564044e-02f, -2.523849250e-02f,
+    2.077539469e-02f, -1.716524288e-02f, 1.419440318e-02f, -1.172161016e-02f, 9.648925478e-03f, -7.905469099e-03f, 6.437859176e-03f, -5.204381034e-03f,
+    4.171328746e-03f, -3.310662389e-03f, 2.598487223e-03f, -2.014058621e-03f, 1.539128563e-03f, -1.157515566e-03f, 8.548202049e-04f, -6.182338975e-04f,
+    4.364053423e-04f, -2.993402757e-04f, 1.983181242e-04f, -1.258147671e-04f, 7.542475523e-05f, -4.177937314e-05f, 2.045915762e-05f, -7.901094178e-06f,
+  },
+  {
+    -1.234467826e-05f, 2.828197558e-05f, -5.444088951e-05f, 9.475827607e-05f, -1.540733424e-04f, 2.382190290e-04f, -3.541077764e-04f, 5.098120575e-04f,
+    -7.146419205e-04f, 9.792243431e-04f, -1.315592679e-03f, 1.737299206e-03f, -2.259570299e-03f, 2.899532978e-03f, -3.676554867e-03f, 4.612759655e-03f,
+    -5.733811038e-03f, 7.070107817e-03f, -8.658615290e-03f, 1.054570030e-02f, -1.279159224e-02f, 1.547757008e-02f, -1.871791543e-02f, 2.268063271e-02f,
+    -2.762531853e-02f, 3.397721007e-02f, -4.248519468e-02f, 5.460058510e-02f, -7.354574070e-02f, 1.081776499e-01f, -1.947687489e-01f, 8.636680707e-01f,
+    3.585903719e-01f, -1.469000334e-01f, 9.087968845e-02f, -6.455204935e-02f, 4.902141859e-02f, -3.864446762e-02f, 3.114869241e-02f, -2.544440474e-02f,
+    2.094453622e-02f, -1.730487631e-02f, 1.430988539e-02f, -1.181706026e-02f, 9.727618260e-03f, -7.970077553e-03f, 6.490609502e-03f, -5.247154937e-03f,
+    4.205732916e-03f, -3.338077087e-03f, 2.620101369e-03f, -2.030896049e-03f, 1.552068497e-03f, -1.167309285e-03f, 8.621051984e-04f, -6.235463534e-04f,
+    4.401914844e-04f, -3.019668741e-04f, 2.000823415e-04f, -1.269534168e-04f, 7.612298253e-05f, -4.217873389e-05f, 2.066505651e-05f, -7.989538381e-06f,
+  },
+  {
+    -1.239829432e-05f, 2.842642430e-05f, -5.474057171e-05f, 9.530396875e-05f, -1.549885653e-04f, 2.396671026e-04f, -3.562995312e-04f, 5.130141517e-04f,
+    -7.191857340e-04f, 9.855154405e-04f, -1.324120884e-03f, 1.748649407e-03f, -2.274434228e-03f, 2.918722377e-03f, -3.701016728e-03f, 4.643594581e-03f,
+    -5.772296361e-03f, 7.117727944e-03f, -8.717103094e-03f, 1.061709547e-02f, -1.287832608e-02f, 1.558259223e-02f, -1.884488906e-02f, 2.283424522e-02f,
+    -2.781179636e-02f, 3.420521487e-02f, -4.276748370e-02f, 5.495734235e-02f, -7.401196495e-02f, 1.088213922e-01f, -1.957272147e-01f, 8.608796673e-01f,
+    3.628503239e-01f, -1.482629574e-01f, 9.166318572e-02f, -6.509003473e-02f, 4.942246435e-02f, -3.895716654e-02f, 3.139905996e-02f, -2.564810980e-02f,
+    2.111185435e-02f, -1.744300085e-02f, 1.442411980e-02f, -1.191148109e-02f, 9.805465569e-03f, -8.033995351e-03f, 6.542799494e-03f, -5.289477902e-03f,
+    4.239777557e-03f, -3.365208165e-03f, 2.641494446e-03f, -2.047563481e-03f, 1.564879693e-03f, -1.177007189e-03f, 8.693202841e-04f, -6.288089637e-04f,
+    4.439430351e-04f, -3.045702351e-04f, 2.018315646e-04f, -1.280828804e-04f, 7.681596777e-05f, -4.257540698e-05f, 2.086981866e-05f, -8.077700683e-06f,
+  },
+  {
+    -1.245023851e-05f, 2.856729640e-05f, -5.503362797e-05f, 9.583842138e-05f, -1.558858570e-04f, 2.410878643e-04f, -3.584511822e-04f, 5.161591016e-04f,
+    -7.236501525e-04f, 9.916985896e-04f, -1.332505051e-03f, 1.759810557e-03f, -2.289053613e-03f, 2.937599507e-03f, -3.725084374e-03f, 4.673936845e-03f,
+    -5.810171408e-03f, 7.164597832e-03f, -8.774674425e-03f, 1.068737669e-02f, -1.296371071e-02f, 1.568598319e-02f, -1.896988997e-02f, 2.298546488e-02f,
+    -2.799535262e-02f, 3.442961081e-02f, -4.304522796e-02f, 5.530819122e-02f, -7.447007830e-02f, 1.094528046e-01f, -1.966621383e-01f, 8.580670766e-01f,
+    3.671132524e-01f, -1.496166625e-01f, 9.243974151e-02f, -6.562273982e-02f, 4.981936497e-02f, -3.926653702e-02f, 3.164671547e-02f, -2.584958526e-02f,
+    2.127733072e-02f, -1.757960134e-02f, 1.453709386e-02f, -1.200486228e-02f, 9.882458817e-03f, -8.097215421e-03f, 6.594423354e-03f, -5.331345206e-03f,
+    4.273458851e-03f, -3.392052564e-03f, 2.662664026e-03f, -2.064059014e-03f, 1.577560678e-03f, -1.186608154e-03f, 8.764646182e-04f, -6.340211070e-04f,
+    4.476595463e-04f, -3.071500441e-04f, 2.035655790e-04f, -1.292030171e-04f, 7.750362281e-05f, -4.296934060e-05f, 2.107341628e-05f, -8.165568348e-06f,
+  },
+  {
+    -1.250051446e-05f, 2.870459281e-05f, -5.532005269e-05f, 9.636161606e-05f, -1.567651792e-04f, 2.424812437e-04f, -3.605626119e-04f, 5.192467227e-04f,
+    -7.280348999e-04f, 9.977733909e-04f, -1.340744619e-03f, 1.770781887e-03f, -2.303427422e-03f, 2.956163007e-03f, -3.748756037e-03f, 4.703784183e-03f,
+    -5.847433318e-03f, 7.210713900e-03f, -8.831324850e-03f, 1.075653853e-02f, -1.304773951e-02f, 1.578773488e-02f, -1.909290843e-02f, 2.313427997e-02f,
+    -2.817597329e-02f, 3.465038109e-02f, -4.331840744e-02f, 5.565310810e-02f, -7.492005404e-02f, 1.100718635e-01f, -1.975735548e-01f, 8.552304595e-01f,
+    3.713789396e-01f, -1.509609920e-01f, 9.320926555e-02f, -6.615010378e-02f, 5.021207578e-02f, -3.957254460e-02f, 3.189163150e-02f, -2.604880891e-02f,
+    2.144094710e-02f, -1.771466276e-02f, 1.464879513e-02f, -1.209719353e-02f, 9.958589489e-03f, -8.159730747e-03f, 6.645475333e-03f, -5.372752165e-03f,
+    4.306773011e-03f, -3.418607246e-03f, 2.683607702e-03f, -2.080380757e-03f, 1.590109987e-03f, -1.196111063e-03f, 8.835373620e-04f, -6.391821655e-04f,
+    4.513405726e-04f, -3.097059881e-04f, 2.052841713e-04f, -1.303136866e-04f, 7.818585974e-05f, -4.336048303e-05f, 2.127582163e-05f, -8.253128601e-06f,
+  },
+  {
+    -1.254912602e-05f, 2.883831481e-05f, -5.559984095e-05f, 9.687353609e-05f, -1.576264953e-04f, 2.438471735e-04f, -3.626337072e-04f, 5.222768369e-04f,
+    -7.323397082e-04f, 1.003739456e-03f, -1.348839041e-03f, 1.781562647e-03f, -2.317554647e-03f, 2.974411546e-03f, -3.772029991e-03f, 4.733134385e-03f,
+    -5.884079293e-03f, 7.256072646e-03f, -8.887050028e-03f, 1.082457564e-02f, -1.313040594e-02f, 1.588783942e-02f, -1.921393490e-02f, 2.328067905e-02f,
+    -2.835364462e-02f, 3.486750930e-02f, -4.358700259e-02f, 5.599206996e-02f, -7.536186630e-02f, 1.106785464e-01f, -1.984615011e-01f, 8.523699779e-01f,
+    3.756471670e-01f, -1.522957890e-01f, 9.397166798e-02f, -6.667206616e-02f, 5.060055242e-02f, -3.987515507e-02f, 3.213378086e-02f, -2.624575871e-02f,
+    2.160268545e-02f, -1.784817021e-02f, 1.475921128e-02f, -1.218846461e-02f, 1.003384914e-02f, -8.221534375e-03f, 6.695949727e-03f, -5.413694133e-03f,
+    4.339716280e-03f, -3.444869202e-03f, 2.704323082e-03f, -2.096526837e-03f, 1.602526170e-03f, -1.205514806e-03f, 8.905376824e-04f, -6.442915252e-04f,
+    4.549856712e-04f, -3.122377556e-04f, 2.069871290e-04f, -1.314147492e-04f, 7.886259093e-05f, -4.374878264e-05f, 2.147700694e-05f, -8.340368632e-06f,
+  },
+  {
+    -1.259607719e-05f, 2.896846408e-05f, -5.587298856e-05f, 9.737416598e-05f, -1.584697707e-04f, 2.451855889e-04f, -3.646643590e-04f, 5.252492719e-04f,
+    -7.365643178e-04f, 1.009596409e-03f, -1.356787787e-03f, 1.792152109e-03f, -2.331434307e-03f, 2.992343828e-03f, -3.794904551e-03f, 4.761985290e-03f,
+    -5.920106597e-03f, 7.300670647e-03f, -8.941845714e-03f, 1.089148281e-02f, -1.321170365e-02f, 1.598628908e-02f, -1.933296006e-02f, 2.342465091e-02f,
+    -2.852835319e-02f, 3.508097938e-02f, -4.385099432e-02f, 5.632505440e-02f, -7.579549000e-02f, 1.112728318e-01f, -1.993260152e-01f, 8.494857951e-01f,
+    3.799177159e-01f, -1.536208972e-01f, 9.472685939e-02f, -6.718856689e-02f, 5.098475088e-02f, -4.017433451e-02f, 3.237313661e-02f, -2.644041284e-02f,
+    2.176252786e-02f, -1.798010892e-02f, 1.486833010e-02f, -1.227866541e-02f, 1.010822942e-02f, -8.282619410e-03f, 6.745840883e-03f, -5.454166501e-03f,
+    4.372284930e-03f, -3.470835441e-03f, 2.724807796e-03f, -2.112495389e-03f, 1.614807781e-03f, -1.214818283e-03f, 8.974647518e-04f, -6.493485757e-04f,
+    4.585944019e-04f, -3.147450369e-04f, 2.086742406e-04f, -1.325060658e-04f, 7.953372901e-05f, -4.413418793e-05f, 2.167694447e-05f, -8.427275594e-06f,
+  },
+  {
+    -1.264137215e-05f, 2.909504267e-05f, -5.613949200e-05f, 9.786349144e-05f, -1.592949727e-04f, 2.464964285e-04f, -3.666544628e-04f, 5.281638616e-04f,
+    -7.407084778e-04f, 1.015343883e-03f, -1.364590341e-03f, 1.802549561e-03f, -2.345065446e-03f, 3.009958589e-03f, -3.817378072e-03f, 4.790334789e-03f,
+    -5.955512561e-03f, 7.344504558e-03f, -8.995707759e-03f, 1.095725492e-02f, -1.329162641e-02f, 1.608307629e-02f, -1.944997479e-02f, 2.356618458e-02f,
+    -2.870008586e-02f, 3.529077567e-02f, -4.411036400e-02f, 5.665203960e-02f, -7.622090090e-02f, 1.118546996e-01f, -2.001671369e-01f, 8.465780758e-01f,
+    3.841903669e-01f, -1.549361604e-01f, 9.547475081e-02f, -6.769954633e-02f, 5.136462748e-02f, -4.047004927e-02f, 3.260967200e-02f, -2.663274964e-02f,
+    2.192045661e-02f, -1.811046426e-02f, 1.497613946e-02f, -1.236778591e-02f, 1.018172201e-02f, -8.342979018e-03f, 6.795143198e-03f, -5.494164704e-03f,
+    4.404475268e-03f, -3.496503002e-03f, 2.745059489e-03f, -2.128284569e-03f, 1.626953391e-03f, -1.224020399e-03f, 9.043177481e-04f, -6.543527108e-04f,
+    4.621663267e-04f, -3.172275238e-04f, 2.103452957e-04f, -1.335874978e-04f, 8.019918692e-05f, -4.451664745e-05f, 2.187560646e-05f, -8.513836605e-06f,
+  },
+  {
+    -1.268501525e-05f, 2.921805301e-05f, -5.639934850e-05f, 9.834149937e-05f, -1.601020706e-04f, 2.477796334e-04f, -3.686039181e-04f, 5.310204459e-04f,
+    -7.447719454e-04f, 1.020981525e-03f, -1.372246203e-03f, 1.812754315e-03f, -2.358447134e-03f, 3.027254600e-03f, -3.839448951e-03f, 4.818180825e-03f,
+    -5.990294578e-03f, 7.387571111e-03f, -9.048632109e-03f, 1.102188700e-02f, -1.337016812e-02f, 1.617819368e-02f, -1.956497018e-02f, 2.370526936e-02f,
+    -2.886882981e-02f, 3.549688284e-02f, -4.436509348e-02f, 5.697300436e-02f, -7.663807554e-02f, 1.124241307e-01f, -2.009849074e-01f, 8.436469858e-01f,
+    3.884649006e-01f, -1.562414225e-01f, 9.621525374e-02f, -6.820494523e-02f, 5.174013889e-02f, -4.076226600e-02f, 3.284336056e-02f, -2.682274767e-02f,
+    2.207645411e-02f, -1.823922173e-02f, 1.508262738e-02f, -1.245581616e-02f, 1.025431871e-02f, -8.402606429e-03f, 6.843851116e-03f, -5.533684212e-03f,
+    4.436283629e-03f, -3.521868946e-03f, 2.765075828e-03f, -2.143892542e-03f, 1.638961578e-03f, -1.233120069e-03f, 9.110958551e-04f, -6.593033280e-04f,
+    4.657010108e-04f, -3.196849100e-04f, 2.120000849e-04f, -1.346589073e-04f, 8.085887788e-05f, -4.489610992e-05f, 2.207296520e-05f, -8.600038752e-06f,
+  },
+  {
+    -1.272701101e-05f, 2.933749790e-05f, -5.665255595e-05f, 9.880817785e-05f, -1.608910354e-04f, 2.490351479e-04f, -3.705126287e-04f, 5.338188707e-04f,
+    -7.487544864e-04f, 1.026508993e-03f, -1.379754888e-03f, 1.822765700e-03f, -2.371578466e-03f, 3.044230660e-03f, -3.861115627e-03f, 4.845521394e-03f,
+    -6.024450104e-03f, 7.429867118e-03f, -9.100614806e-03f, 1.108537418e-02f, -1.344732284e-02f, 1.627163403e-02f, -1.967793751e-02f, 2.384189477e-02f,
+    -2.903457252e-02f, 3.569928598e-02f, -4.461516508e-02f, 5.728792807e-02f, -7.704699132e-02f, 1.129811072e-01f, -2.017793694e-01f, 8.406926923e-01f,
+    3.927410966e-01f, -1.575365281e-01f, 9.694828011e-02f, -6.870470476e-02f, 5.211124211e-02f, -4.105095162e-02f, 3.307417602e-02f, -2.701038568e-02f,
+    2.223050298e-02f, -1.836636699e-02f, 1.518778196e-02f, -1.254274633e-02f, 1.032601139e-02f, -8.461494933e-03f, 6.891959134e-03f, -5.572720539e-03f,
+    4.467706381e-03f, -3.546930358e-03f, 2.784854498e-03f, -2.159317491e-03f, 1.650830932e-03f, -1.242116214e-03f, 9.177982621e-04f, -6.641998291e-04f,
+    4.691980219e-04f, -3.221168908e-04f, 2.136383999e-04f, -1.357201569e-04f, 8.151271540e-05f, -4.527252415e-05f, 2.226899297e-05f, -8.685869088e-06f,
+  },
+  {
+    -1.276736414e-05f, 2.945338053e-05f, -5.689911297e-05f, 9.926351618e-05f, -1.616618401e-04f, 2.502629192e-04f, -3.723805028e-04f, 5.365589883e-04f,
+    -7.526558750e-04f, 1.031925955e-03f, -1.387115924e-03f, 1.832583068e-03f, -2.384458564e-03f, 3.060885606e-03f, -3.882376581e-03f, 4.872354541e-03f,
+    -6.057976661e-03f, 7.471389471e-03f, -9.151651989e-03f, 1.114771170e-02f, -1.352308476e-02f, 1.636339028e-02f, -1.978886829e-02f, 2.397605061e-02f,
+    -2.919730176e-02f, 3.589797054e-02f, -4.486056158e-02f, 5.759679075e-02f, -7.744762641e-02f, 1.135256123e-01f, -2.025505671e-01f, 8.377153637e-01f,
+    3.970187344e-01f, -1.588213216e-01f, 9.767374236e-02f, -6.919876651e-02f, 5.247789451e-02f, -4.133607335e-02f, 3.330209239e-02f, -2.719564263e-02f,
+    2.238258596e-02f, -1.849188580e-02f, 1.529159145e-02f, -1.262856666e-02f, 1.039679196e-02f, -8.519637884e-03f, 6.939461801e-03f, -5.611269238e-03f,
+    4.498739927e-03f, -3.571684351e-03f, 2.804393205e-03f, -2.174557612e-03f, 1.662560055e-03f, -1.251007766e-03f, 9.244241644e-04f, -6.690416198e-04f,
+    4.726569303e-04f, -3.245231635e-04f, 2.152600334e-04f, -1.367711098e-04f, 8.216061332e-05f, -4.564583908e-05f, 2.246366207e-05f, -8.771314639e-06f,
+  },
+  {
+    -1.280607949e-05f, 2.956570443e-05f, -5.713901886e-05f, 9.970750483e-05f, -1.624144598e-04f, 2.514628971e-04f, -3.742074527e-04f, 5.392406567e-04f,
+    -7.564758939e-04f, 1.037232093e-03f, -1.394328859e-03f, 1.842205788e-03f, -2.397086577e-03f, 3.077218305e-03f, -3.903230335e-03f, 4.898678365e-03f,
+    -6.090871835e-03f, 7.512135138e-03f, -9.201739892e-03f, 1.120889492e-02f, -1.359744822e-02f, 1.645345557e-02f, -1.989775421e-02f, 2.410772691e-02f,
+    -2.935700563e-02f, 3.609292233e-02f, -4.510126624e-02f, 5.789957301e-02f, -7.783995984e-02f, 1.140576306e-01f, -2.032985461e-01f, 8.347151695e-01f,
+    4.012975931e-01f, -1.600956480e-01f, 9.839155338e-02f, -6.968707249e-02f, 5.284005382e-02f, -4.161759871e-02f, 3.352708390e-02f, -2.737849768e-02f,
+    2.253268599e-02f, -1.861576409e-02f, 1.539404418e-02f, -1.271326751e-02f, 1.046665247e-02f, -8.577028701e-03f, 6.986353714e-03f, -5.649325906e-03f,
+    4.529380699e-03f, -3.596128063e-03f, 2.823689674e-03f, -2.189611119e-03f, 1.674147558e-03f, -1.259793662e-03f, 9.309727635e-04f, -6.738281100e-04f,
+    4.760773093e-04f, -3.269034269e-04f, 2.168647794e-04f, -1.378116300e-04f, 8.280248581e-05f, -4.601600377e-05f, 2.265694484e-05f, -8.856362402e-06f,
+  },
+  {
+    -1.284316209e-05f, 2.967447353e-05f, -5.737227362e-05f, 1.001401355e-04f, -1.631488712e-04f, 2.526350345e-04f, -3.759933951e-04f, 5.418637401e-04f,
+    -7.602143342e-04f, 1.042427097e-03f, -1.401393253e-03f, 1.851633251e-03f, -2.409461676e-03f, 3.093227660e-03f, -3.923675453e-03f, 4.924491018e-03f,
+    -6.123133276e-03f, 7.552101169e-03f, -9.250874846e-03f, 1.126891933e-02f, -1.367040769e-02f, 1.654182320e-02f, -2.000458719e-02f, 2.423691397e-02f,
+    -2.951367252e-02f, 3.628412754e-02f, -4.533726280e-02f, 5.819625607e-02f, -7.822397143e-02f, 1.145771475e-01f, -2.040233535e-01f, 8.316922807e-01f,
+    4.055774514e-01f, -1.613593525e-01f, 9.910162657e-02f, -7.016956516e-02f, 5.319767812e-02f, -4.189549553e-02f, 3.374912504e-02f, -2.755893020e-02f,
+    2.268078618e-02f, -1.873798792e-02f, 1.549512862e-02f, -1.279683932e-02f, 1.053558499e-02f, -8.633660867e-03f, 7.032629526e-03f, -5.686886178e-03f,
+    4.559625165e-03f, -3.620258656e-03f, 2.842741650e-03f, -2.204476238e-03f, 1.685592067e-03f, -1.268472850e-03f, 9.374432665e-04f, -6.785587139e-04f,
+    4.794587352e-04f, -3.292573821e-04f, 2.184524328e-04f, -1.388415820e-04f, 8.343824736e-05f, -4.638296744e-05f, 2.284881362e-05f, -8.940999345e-06f,
+  },
+  {
+    -1.287861714e-05f, 2.977969212e-05f, -5.759887793e-05f, 1.005614009e-04f, -1.638650532e-04f, 2.537792874e-04f, -3.777382510e-04f, 5.444281089e-04f,
+    -7.638709953e-04f, 1.047510671e-03f, -1.408308681e-03f, 1.860864867e-03f, -2.421583063e-03f, 3.108912603e-03f, -3.943710540e-03f, 4.949790702e-03f,
+    -6.154758700e-03f, 7.591284692e-03f, -9.299053282e-03f, 1.132778053e-02f, -1.374195780e-02f, 1.662848662e-02f, -2.010935935e-02f, 2.436360231e-02f,
+    -2.966729112e-02f, 3.647157277e-02f, -4.556853546e-02f, 5.848682177e-02f, -7.859964181e-02f, 1.150841499e-01f, -2.047250379e-01f, 8.286468693e-01f,
+    4.098580875e-01f, -1.626122808e-01f, 9.980387581e-02f, -7.064618741e-02f, 5.355072585e-02f, -4.216973191e-02f, 3.396819054e-02f, -2.773691974e-02f,
+    2.282686980e-02f, -1.885854350e-02f, 1.559483336e-02f, -1.287927263e-02f, 1.060358171e-02f, -8.689527931e-03f, 7.078283941e-03f, -5.723945734e-03f,
+    4.589469825e-03f, -3.644073321e-03f, 2.861546898e-03f, -2.219151212e-03f, 1.696892217e-03f, -1.277044286e-03f, 9.438348870e-04f, -6.832328498e-04f,
+    4.828007868e-04f, -3.315847317e-04f, 2.200227900e-04f, -1.398608311e-04f, 8.406781281e-05f, -4.674667943e-05f, 2.303924081e-05f, -9.025212413e-06f,
+  },
+  {
+    -1.291245000e-05f, 2.988136485e-05f, -5.781883318e-05f, 1.009712953e-04f, -1.645629862e-04f, 2.548956143e-04f, -3.794419455e-04f, 5.469336395e-04f,
+    -7.674456854e-04f, 1.052482530e-03f, -1.415074735e-03f, 1.869900068e-03f, -2.433449962e-03f, 3.124272103e-03f, -3.963334244e-03f, 4.974575674e-03f,
+    -6.185745885e-03f, 7.629682915e-03f, -9.346271723e-03f, 1.138547422e-02f, -1.381209330e-02f, 1.671343948e-02f, -2.021206301e-02f, 2.448778273e-02f,
+    -2.981785045e-02f, 3.665524497e-02f, -4.579506889e-02f, 5.877125255e-02f, -7.896695245e-02f, 1.155786257e-01f, -2.054036494e-01f, 8.255791087e-01f,
+    4.141392794e-01f, -1.638542786e-01f, 1.004982155e-01f, -7.111688257e-02f, 5.389915583e-02f, -4.244027629e-02f, 3.418425540e-02f, -2.791244611e-02f,
+    2.297092029e-02f, -1.897741719e-02f, 1.569314710e-02f, -1.296055808e-02f, 1.067063488e-02f, -8.744623507e-03f, 7.123311718e-03f, -5.760500298e-03f,
+    4.618911214e-03f, -3.667569275e-03f, 2.880103205e-03f, -2.233634301e-03f, 1.708046655e-03f, -1.285506934e-03f, 9.501468446e-04f, -6.878499406e-04f,
+    4.861030462e-04f, -3.338851804e-04f, 2.215756482e-04f, -1.408692431e-04f, 8.469109737e-05f, -4.710708925e-05f, 2.322819881e-05f, -9.108988526e-06f,
+  },
+  {
+    -1.294466620e-05f, 2.997949673e-05f, -5.803214143e-05f, 1.013698137e-04f, -1.652426528e-04f, 2.559839769e-04f, -3.811044080e-04f, 5.493802144e-04f,
+    -7.709382209e-04f, 1.057342402e-03f, -1.421691022e-03f, 1.878738304e-03f, -2.445061624e-03f, 3.139305161e-03f, -3.982545255e-03f, 4.998844240e-03f,
+    -6.216092678e-03f, 7.667293126e-03f, -9.392526795e-03f, 1.144199625e-02f, -1.388080911e-02f, 1.679667560e-02f, -2.031269071e-02f, 2.460944628e-02f,
+    -2.996533981e-02f, 3.683513146e-02f, -4.601684825e-02f, 5.904953146e-02f, -7.932588563e-02f, 1.160605638e-01f, -2.060592394e-01f, 8.224891731e-01f,
+    4.184208048e-01f, -1.650851924e-01f, 1.011845606e-01f, -7.158159443e-02f, 5.424292726e-02f, -4.270709740e-02f, 3.439729485e-02f, -2.808548928e-02f,
+    2.311292129e-02f, -1.909459548e-02f, 1.579005867e-02f, -1.304068642e-02f, 1.073673685e-02f, -8.798941278e-03f, 7.167707668e-03f, -5.796545634e-03f,
+    4.647945902e-03f, -3.690743761e-03f, 2.898408377e-03f, -2.247923778e-03f, 1.719054042e-03f, -1.293859768e-03f, 9.563783656e-04f, -6.924094136e-04f,
+    4.893650984e-04f, -3.361584349e-04f, 2.231108062e-04f, -1.418666847e-04f, 8.530801659e-05f, -4.746414654e-05f, 2.341566009e-05f, -9.192314582e-06f,
+  },
+  {
+    -1.297527141e-05f, 3.007409313e-05f, -5.823880543e-05f, 1.017569525e-04f, -1.659040375e-04f, 2.570443397e-04f, -3.827255723e-04f, 5.517677221e-04f,
+    -7.743484267e-04f, 1.062090022e-03f, -1.428157163e-03f, 1.887379045e-03f, -2.456417329e-03f, 3.154010810e-03f, -4.001342304e-03f, 5.022594763e-03f,
+    -6.245796988e-03f, 7.704112693e-03f, -9.437815217e-03f, 1.149734258e-02f, -1.394810026e-02f, 1.687818896e-02f, -2.041123519e-02f, 2.472858425e-02f,
+    -3.010974884e-02f, 3.701121997e-02f, -4.623385917e-02f, 5.932164217e-02f, -7.967642444e-02f, 1.165299545e-01f, -2.066918608e-01f, 8.193772385e-01f,
+    4.227024407e-01f, -1.663048685e-01f, 1.018628265e-01f, -7.204026723e-02f, 5.458199970e-02f, -4.297016428e-02f, 3.460728441e-02f, -2.825602948e-02f,
+    2.325285660e-02f, -1.921006502e-02f, 1.588555701e-02f, -1.311964850e-02f, 1.080188004e-02f, -8.852474992e-03f, 7.211466658e-03f, -5.832077552e-03f,
+    4.676570492e-03f, -3.713594050e-03f, 2.916460243e-03f, -2.262017935e-03f, 1.729913048e-03f, -1.302101769e-03f, 9.625286822e-04f, -6.969107005e-04f,
+    4.925865314e-04f, -3.384042038e-04f, 2.246280637e-04f, -1.428530233e-04f, 8.591848640e-05f, -4.781780112e-05f, 2.360159712e-05f, -9.275177459e-06f,
+  },
+  {
+    -1.300427148e-05f, 3.016515980e-05f, -5.843882862e-05f, 1.021327093e-04f, -1.665471265e-04f, 2.580766699e-04f, -3.843053762e-04f, 5.540960572e-04f,
+    -7.776761361e-04f, 1.066725142e-03f, -1.434472797e-03f, 1.895821785e-03f, -2.467516379e-03f, 3.168388119e-03f, -4.019724166e-03f, 5.045825654e-03f,
+    -6.274856790e-03f, 7.740139064e-03f, -9.482133808e-03f, 1.155150926e-02f, -1.401396197e-02f, 1.695797373e-02f, -2.050768942e-02f, 2.484518821e-02f,
+    -3.025106746e-02f, 3.718349860e-02f, -4.644608777e-02f, 5.958756896e-02f, -8.001855280e-02f, 1.169867891e-01f, -2.073015681e-01f, 8.162434815e-01f,
+    4.269839643e-01f, -1.675131542e-01f, 1.025329291e-01f, -7.249284568e-02f, 5.491633313e-02f, -4.322944631e-02f, 3.481419984e-02f, -2.842404713e-02f,
+    2.339071021e-02f, -1.932381260e-02f, 1.597963119e-02f, -1.319743525e-02f, 1.086605696e-02f, -8.905218466e-03f, 7.254583611e-03f, -5.867091906e-03f,
+    4.704781623e-03f, -3.736117441e-03f, 2.934256653e-03f, -2.275915078e-03f, 1.740622357e-03f, -1.310231928e-03f, 9.685970335e-04f, -7.013532376e-04f,
+    4.957669365e-04f, -3.406221977e-04f, 2.261272220e-04f, -1.438281269e-04f, 8.652242313e-05f, -4.816800297e-05f, 2.378598245e-05f, -9.357564015e-06f,
+  },
+  {
+    -1.303167241e-05f, 3.025270283e-05f, -5.863221510e-05f, 1.024970829e-04f, -1.671719080e-04f, 2.590809379e-04f, -3.858437620e-04f, 5.563651204e-04f,
+    -7.809211910e-04f, 1.071247522e-03f, -1.440637576e-03f, 1.904066032e-03f, -2.478358105e-03f, 3.182436188e-03f, -4.037689656e-03f, 5.068535380e-03f,
+    -6.303270125e-03f, 7.775369767e-03f, -9.525479486e-03f, 1.160449250e-02f, -1.407838955e-02f, 1.703602424e-02f, -2.060204655e-02f, 2.495924994e-02f,
+    -3.038928592e-02f, 3.735195581e-02f, -4.665352061e-02f, 5.984729671e-02f, -8.035225543e-02f, 1.174310601e-01f, -2.078884170e-01f, 8.130880801e-01f,
+    4.312651522e-01f, -1.687098966e-01f, 1.031947851e-01f, -7.293927496e-02f, 5.524588788e-02f, -4.348491316e-02f, 3.501801717e-02f, -2.858952288e-02f,
+    2.352646628e-02f, -1.943582517e-02f, 1.607227042e-02f, -1.327403772e-02f, 1.092926019e-02f, -8.957165589e-03f, 7.297053505e-03f, -5.901584596e-03f,
+    4.732575971e-03f, -3.758311260e-03f, 2.951795478e-03f, -2.289613532e-03f, 1.751180667e-03f, -1.318249247e-03f, 9.745826651e-04f, -7.057364659e-04f,
+    4.989059080e-04f, -3.428121294e-04f, 2.276080834e-04f, -1.447918643e-04f, 8.711974349e-05f, -4.851470224e-05f, 2.396878864e-05f, -9.439461090e-06f,
+  },
+  {
+    -1.305748037e-05f, 3.033672866e-05f, -5.881896966e-05f, 1.028500730e-04f, -1.677783720e-04f, 2.600571167e-04f, -3.873406762e-04f, 5.585748186e-04f,
+    -7.840834417e-04f, 1.075656934e-03f, -1.446651169e-03f, 1.912111321e-03f, -2.488941863e-03f, 3.196154153e-03f, -4.055237633e-03f, 5.090722460e-03f,
+    -6.331035098e-03f, 7.809802411e-03f, -9.567849265e-03f, 1.165628861e-02f, -1.414137850e-02f, 1.711233499e-02f, -2.069429996e-02f, 2.507076153e-02f,
+    -3.052439478e-02f, 3.751658047e-02f, -4.685614476e-02f, 6.010081093e-02f, -8.067751789e-02f, 1.178627612e-01f, -2.084524648e-01f, 8.099112134e-01f,
+    4.355457806e-01f, -1.698949436e-01f, 1.038483114e-01f, -7.337950072e-02f, 5.557062469e-02f, -4.373653484e-02f, 3.521871270e-02f, -2.875243759e-02f,
+    2.366010917e-02f, -1.954608983e-02f, 1.616346401e-02f, -1.334944708e-02f, 1.099148242e-02f, -9.008310316e-03f, 7.338871373e-03f, -5.935551564e-03f,
+    4.759950245e-03f, -3.780172862e-03f, 2.969074611e-03f, -2.303111637e-03f, 1.761586685e-03f, -1.326152734e-03f, 9.804848290e-04f, -7.100598309e-04f,
+    5.020030433e-04f, -3.449737138e-04f, 2.290704517e-04f, -1.457441051e-04f, 8.771036460e-05f, -4.885784926e-05f, 2.414998833e-05f, -9.520855509e-06f,
+  },
+  {
+    -1.308170166e-05f, 3.041724410e-05f, -5.899909776e-05f, 1.031916808e-04f, -1.683665105e-04f, 2.610051824e-04f, -3.887960693e-04f, 5.607250645e-04f,
+    -7.871627469e-04f, 1.079953163e-03f, -1.452513258e-03f, 1.919957202e-03f, -2.499267035e-03f, 3.209541180e-03f, -4.072366998e-03f, 5.112385465e-03f,
+    -6.358149881e-03f, 7.843434686e-03f, -9.609240258e-03f, 1.170689402e-02f, -1.420292444e-02f, 1.718690068e-02f, -2.078444324e-02f, 2.517971529e-02f,
+    -3.065638490e-02f, 3.767736183e-02f, -4.705394777e-02f, 6.034809774e-02f, -8.099432652e-02f, 1.182818871e-01f, -2.089937701e-01f, 8.067130618e-01f,
+    4.398256258e-01f, -1.710681434e-01f, 1.044934257e-01f, -7.381346910e-02f, 5.589050469e-02f, -4.398428170e-02f, 3.541626300e-02f, -2.891277236e-02f,
+    2.379162340e-02f, -1.965459384e-02f, 1.625320141e-02f, -1.342365457e-02f, 1.105271640e-02f, -9.058646673e-03f, 7.380032308e-03f, -5.968988802e-03f,
+    4.786901193e-03f, -3.801699630e-03f, 2.986091967e-03f, -2.316407749e-03f, 1.771839133e-03f, -1.333941408e-03f, 9.863027845e-04f, -7.143227830e-04f,
+    5.050579432e-04f, -3.471066677e-04f, 2.305141319e-04f, -1.466847197e-04f, 8.829420398e-05f, -4.919739455e-05f, 2.432955419e-05f, -9.601734081e-06f,
+  },
+  {
+    -1.310434276e-05f, 3.049425630e-05f, -5.917260553e-05f, 1.035219084e-04f, -1.689363172e-04f, 2.619251138e-04f, -3.902098963e-04f, 5.628157771e-04f,
+    -7.901589738e-04f, 1.084136004e-03f, -1.458223544e-03f, 1.927603247e-03f, -2.509333029e-03f, 3.222596471e-03f, -4.089076693e-03f, 5.133523021e-03f,
+    -6.384612711e-03f, 7.876264360e-03f, -9.649649677e-03f, 1.175630527e-02f, -1.426302314e-02f, 1.725971616e-02f, -2.087247019e-02f, 2.528610378e-02f,
+    -3.078524746e-02f, 3.783428950e-02f, -4.724691764e-02f, 6.058914386e-02f, -8.130266853e-02f, 1.186884337e-01f, -2.095123929e-01f, 8.034938066e-01f,
+    4.441044636e-01f, -1.722293445e-01f, 1.051300462e-01f, -7.424112672e-02f, 5.620548942e-02f, -4.422812438e-02f, 3.561064491e-02f, -2.907050850e-02f,
+    2.392099372e-02f, -1.976132461e-02f, 1.634147221e-02f, -1.349665155e-02f, 1.111295500e-02f, -9.108168758e-03f, 7.420531457e-03f, -6.001892343e-03f,
+    4.813425597e-03f, -3.822888975e-03f, 3.002845484e-03f, -2.329500244e-03f, 1.781936746e-03f, -1.341614298e-03f, 9.920357972e-04f, -7.185247775e-04f,
+    5.080702119e-04f, -3.492107104e-04f, 2.319389304e-04f, -1.476135793e-04f, 8.887117959e-05f, -4.953328880e-05f, 2.450745895e-05f, -9.682083604e-06f,
+  },
+  {
+    -1.312541028e-05f, 3.056777276e-05f, -5.933949975e-05f, 1.038407592e-04f, -1.694877877e-04f, 2.628168926e-04f, -3.915821163e-04f, 5.648468812e-04f,
+    -7.930719981e-04f, 1.088205264e-03f, -1.463781740e-03f, 1.935049049e-03f, -2.519139282e-03f, 3.235319262e-03f, -4.105365704e-03f, 5.154133803e-03f,
+    -6.410421891e-03f, 7.908289285e-03f, -9.689074834e-03f, 1.180451904e-02f, -1.432167052e-02f, 1.733077647e-02f, -2.095837482e-02f, 2.538991984e-02f,
+    -3.091097394e-02f, 3.798735349e-02f, -4.743504288e-02f, 6.082393664e-02f, -8.160253189e-02f, 1.190823982e-01f, -2.100083948e-01f, 8.002536303e-01f,
+    4.483820695e-01f, -1.733783961e-01f, 1.057580917e-01f, -7.466242070e-02f, 5.651554082e-02f, -4.446803389e-02f, 3.580183554e-02f, -2.922562756e-02f,
+    2.404820502e-02f, -1.986626969e-02f, 1.642826610e-02f, -1.356842951e-02f, 1.117219113e-02f, -9.156870740e-03f, 7.460364028e-03f, -6.034258272e-03f,
+    4.839520280e-03f, -3.843738341e-03f, 3.019333121e-03f, -2.342387513e-03f, 1.791878270e-03f, -1.349170441e-03f, 9.976831400e-04f, -7.226652745e-04f,
+    5.110394565e-04f, -3.512855632e-04f, 2.333446551e-04f, -1.485305559e-04f, 8.944120984e-05f, -4.986548293e-05f, 2.468367541e-05f, -9.761890864e-06f,
+  },
+  {
+    -1.314491101e-05f, 3.063780132e-05f, -5.949978790e-05f, 1.041482377e-04f, -1.700209197e-04f, 2.636805035e-04f, -3.929126928e-04f, 5.668183080e-04f,
+    -7.959017037e-04f, 1.092160762e-03f, -1.469187576e-03f, 1.942294221e-03f, -2.528685253e-03f, 3.247708821e-03f, -4.121233058e-03f, 5.174216544e-03f,
+    -6.435575790e-03f, 7.939507392e-03f, -9.727513136e-03f, 1.185153212e-02f, -1.437886263e-02f, 1.740007682e-02f, -2.104215136e-02f, 2.549115657e-02f,
+    -3.103355615e-02f, 3.813654421e-02f, -4.761831247e-02f, 6.105246403e-02f, -8.189390542e-02f, 1.194637787e-01f, -2.104818386e-01f, 7.969927164e-01f,
+    4.526582190e-01f, -1.745151475e-01f, 1.063774814e-01f, -7.507729863e-02f, 5.682062124e-02f, -4.470398155e-02f, 3.598981229e-02f, -2.937811131e-02f,
+    2.417324241e-02f, -1.996941681e-02f, 1.651357294e-02f, -1.363898002e-02f, 1.123041784e-02f, -9.204746861e-03f, 7.499525287e-03f, -6.066082716e-03f,
+    4.865182098e-03f, -3.864245195e-03f, 3.035552863e-03f, -2.355067965e-03f, 1.801662467e-03f, -1.356608886e-03f, 1.003244093e-03f, -7.267437389e-04f,
+    5.139652881e-04f, -3.533309495e-04f, 2.347311150e-04f, -1.494355221e-04f, 9.000421353e-05f, -5.019392803e-05f, 2.485817642e-05f, -9.841142637e-06f,
+  },
+  {
+    -1.316285185e-05f, 3.070435018e-05f, -5.965347809e-05f, 1.044443496e-04f, -1.705357124e-04f, 2.645159337e-04f, -3.942015932e-04f, 5.687299944e-04f,
+    -7.986479832e-04f, 1.096002327e-03f, -1.474440798e-03f, 1.949338396e-03f, -2.537970431e-03f, 3.259764449e-03f, -4.136677826e-03f, 5.193770027e-03f,
+    -6.460072840e-03f, 7.969916694e-03f, -9.764962093e-03f, 1.189734141e-02f, -1.443459570e-02f, 1.746761259e-02f, -2.112379422e-02f, 2.558980729e-02f,
+    -3.115298621e-02f, 3.828185243e-02f, -4.779671586e-02f, 6.127471461e-02f, -8.217677876e-02f, 1.198325745e-01f, -2.109327885e-01f, 7.937112496e-01f,
+    4.569326872e-01f, -1.756394488e-01f, 1.069881355e-01f, -7.548570866e-02f, 5.712069344e-02f, -4.493593905e-02f, 3.617455282e-02f, -2.952794175e-02f,
+    2.429609118e-02f, -2.007075385e-02f, 1.659738268e-02f, -1.370829476e-02f, 1.128762824e-02f, -9.251791435e-03f, 7.538010556e-03f, -6.097361854e-03f,
+    4.890407948e-03f, -3.884407040e-03f, 3.051502715e-03f, -2.367540026e-03f, 1.811288111e-03f, -1.363928690e-03f, 1.008717942e-03f, -7.307596409e-04f,
+    5.168473207e-04f, -3.553465953e-04f, 2.360981210e-04f, -1.503283518e-04f, 9.056010998e-05f, -5.051857542e-05f, 2.503093490e-05f, -9.919825691e-06f,
+  },
+  {
+    -1.317923988e-05f, 3.076742787e-05f, -5.980057910e-05f, 1.047291015e-04f, -1.710321670e-04f, 2.653231737e-04f, -3.954487895e-04f, 5.705818836e-04f,
+    -8.013107376e-04f, 1.099729802e-03f, -1.479541167e-03f, 1.956181227e-03f, -2.546994328e-03f, 3.271485484e-03f, -4.151699120e-03f, 5.212793089e-03f,
+    -6.483911543e-03f, 7.999515285e-03f, -9.801419311e-03f, 1.194194396e-02f, -1.448886607e-02f, 1.753337935e-02f, -2.120329808e-02f, 2.568586562e-02f,
+    -3.126925653e-02f, 3.842326930e-02f, -4.797024299e-02f, 6.149067756e-02f, -8.245114233e-02f, 1.201887860e-01f, -2.113613102e-01f, 7.904094157e-01f,
+    4.612052491e-01f, -1.767511503e-01f, 1.075899743e-01f, -7.588759940e-02f, 5.741572061e-02f, -4.516387839e-02f, 3.635603509e-02f, -2.967510113e-02f,
+    2.441673683e-02f, -2.017026886e-02f, 1.667968544e-02f, -1.377636553e-02f, 1.134381553e-02f, -9.297998851e-03f, 7.575815222e-03f, -6.128091910e-03f,
+    4.915194764e-03f, -3.904221404e-03f, 3.067180707e-03f, -2.379802142e-03f, 1.820753987e-03f, -1.371128921e-03f, 1.014103982e-03f, -7.347124556e-04f,
+    5.196851721e-04f, -3.573322287e-04f, 2.374454850e-04f, -1.512089194e-04f, 9.110881892e-05f, -5.083937662e-05f, 2.520192384e-05f, -9.997926787e-06f,
+  },
+  {
+    -1.319408232e-05f, 3.082704325e-05f, -5.994110036e-05f, 1.050025016e-04f, -1.715102867e-04f, 2.661022165e-04f, -3.966542575e-04f, 5.723739246e-04f,
+    -8.038898762e-04f, 1.103343039e-03f, -1.484488458e-03f, 1.962822386e-03f, -2.555756486e-03f, 3.282871294e-03f, -4.166296097e-03f, 5.231284620e-03f,
+    -6.507090466e-03f, 8.028301338e-03f, -9.836882498e-03f, 1.198533690e-02f, -1.454167023e-02f, 1.759737284e-02f, -2.128065778e-02f, 2.577932541e-02f,
+    -3.138235987e-02f, 3.856078638e-02f, -4.813888427e-02f, 6.170034267e-02f, -8.271698740e-02f, 1.205324149e-01f, -2.117674707e-01f, 7.870874014e-01f,
+    4.654756794e-01f, -1.778501030e-01f, 1.081829190e-01f, -7.628292000e-02f, 5.770566635e-02f, -4.538777194e-02f, 3.653423734e-02f, -2.981957192e-02f,
+    2.453516504e-02f, -2.026795005e-02f, 1.676047146e-02f, -1.384318425e-02f, 1.139897301e-02f, -9.343363570e-03f, 7.612934727e-03f, -6.158269158e-03f,
+    4.939539517e-03f, -3.923685849e-03f, 3.082584890e-03f, -2.391852774e-03f, 1.830058899e-03f, -1.378208655e-03f, 1.019401515e-03f, -7.386016633e-04f,
+    5.224784635e-04f, -3.592875802e-04f, 2.387730205e-04f, -1.520771003e-04f, 9.165026058e-05f, -5.115628338e-05f, 2.537111629e-05f, -1.007543268e-05f,
+  },
+  {
+    -1.320738651e-05f, 3.088320554e-05f, -6.007505195e-05f, 1.052645587e-04f, -1.719700762e-04f, 2.668530580e-04f, -3.978179775e-04f, 5.741060725e-04f,
+    -8.063853167e-04f, 1.106841903e-03f, -1.489282462e-03f, 1.969261569e-03f, -2.564256469e-03f, 3.293921282e-03f, -4.180467952e-03f, 5.249243564e-03f,
+    -6.529608239e-03f, 8.056273111e-03f, -9.871349458e-03f, 1.202751752e-02f, -1.459300484e-02f, 1.765958897e-02f, -2.135586839e-02f, 2.587018078e-02f,
+    -3.149228927e-02f, 3.869439561e-02f, -4.830263062e-02f, 6.190370037e-02f, -8.297430604e-02f, 1.208634639e-01f, -2.121513383e-01f, 7.837453946e-01f,
+    4.697437528e-01f, -1.789361582e-01f, 1.087668916e-01f, -7.667162013e-02f, 5.799049468e-02f, -4.560759240e-02f, 3.670913809e-02f, -2.996133683e-02f,
+    2.465136168e-02f, -2.036378578e-02f, 1.683973110e-02f, -1.390874292e-02f, 1.145309408e-02f, -9.387880131e-03f, 7.649364578e-03f, -6.187889918e-03f,
+    4.963439218e-03f, -3.942797966e-03f, 3.097713342e-03f, -2.403690405e-03f, 1.839201659e-03f, -1.385166981e-03f, 1.024609848e-03f, -7.424267494e-04f,
+    5.252268196e-04f, -3.612123824e-04f, 2.400805427e-04f, -1.529327708e-04f, 9.218435568e-05f, -5.146924768e-05f, 2.553848539e-05f, -1.015233013e-05f,
+  },
+  {
+    -1.321915997e-05f, 3.093592429e-05f, -6.020244460e-05f, 1.055152831e-04f, -1.724115423e-04f, 2.675756971e-04f, -3.989399338e-04f, 5.757782887e-04f,
+    -8.087969854e-04f, 1.110226271e-03f, -1.493922987e-03f, 1.975498489e-03f, -2.572493871e-03f, 3.304634886e-03f, -4.194213928e-03f, 5.266668916e-03f,
+    -6.551463561e-03f, 8.083428939e-03f, -9.904818098e-03f, 1.206848321e-02f, -1.464286669e-02f, 1.772002383e-02f, -2.142892522e-02f, 2.595842611e-02f,
+    -3.159903812e-02f, 3.882408929e-02f, -4.846147339e-02f, 6.210074168e-02f, -8.322309111e-02f, 1.211819368e-01f, -2.125129828e-01f, 7.803835842e-01f,
+    4.740092438e-01f, -1.800091679e-01f, 1.093418142e-01f, -7.705364998e-02f, 5.827017008e-02f, -4.582331284e-02f, 3.688071616e-02f, -3.010037881e-02f,
+    2.476531284e-02f, -2.045776458e-02f, 1.691745488e-02f, -1.397303369e-02f, 1.150617220e-02f, -9.431543146e-03f, 7.685100339e-03f, -6.216950563e-03f,
+    4.986890919e-03f, -3.961555376e-03f, 3.112564164e-03f, -2.415313532e-03f, 1.848181096e-03f, -1.392002996e-03f, 1.029728299e-03f, -7.461872047e-04f,
+    5.279298689e-04f, -3.631063708e-04f, 2.413678681e-04f, -1.537758080e-04f, 9.271102541e-05f, -5.177822171e-05f, 2.570400435e-05f, -1.022860589e-05f,
+  },
+  {
+    -1.322941034e-05f, 3.098520935e-05f, -6.032328969e-05f, 1.057546862e-04f, -1.728346935e-04f, 2.682701353e-04f, -4.000201151e-04f, 5.773905401e-04f,
+    -8.111248168e-04f, 1.113496028e-03f, -1.498409855e-03f, 1.981532880e-03f, -2.580468310e-03f, 3.315011575e-03f, -4.207533306e-03f, 5.283559728e-03f,
+    -6.572655198e-03f, 8.109767243e-03f, -9.937286421e-03f, 1.210823147e-02f, -1.469125271e-02f, 1.777867369e-02f, -2.149982375e-02f, 2.604405603e-02f,
+    -3.170260008e-02f, 3.894986014e-02f, -4.861540447e-02f, 6.229145824e-02f, -8.346333632e-02f, 1.214878384e-01f, -2.128524754e-01f, 7.770021599e-01f,
+    4.782719266e-01f, -1.810689844e-01f, 1.099076101e-01f, -7.742896028e-02f, 5.854465742e-02f, -4.603490667e-02f, 3.704895066e-02f, -3.023668106e-02f,
+    2.487700481e-02f, -2.054987516e-02f, 1.699363344e-02f, -1.403604880e-02f, 1.155820096e-02f, -9.474347303e-03f, 7.720137640e-03f, -6.245447512e-03f,
+    5.009891709e-03f, -3.979955731e-03f, 3.127135480e-03f, -2.426720673e-03f, 1.856996053e-03f, -1.398715809e-03f, 1.034756190e-03f, -7.498825252e-04f,
+    5.305872435e-04f, -3.649692829e-04f, 2.426348147e-04f, -1.546060900e-04f, 9.323019147e-05f, -5.208315792e-05f, 2.586764646e-05f, -1.030424670e-05f,
+  },
+  {
+    -1.323814539e-05f, 3.103107094e-05f, -6.043759923e-05f, 1.059827802e-04f, -1.732395402e-04f, 2.689363770e-04f, -4.010585140e-04f, 5.789428000e-04f,
+    -8.133687539e-04f, 1.116651076e-03f, -1.502742904e-03f, 1.987364497e-03f, -2.588179432e-03f, 3.325050853e-03f, -4.220425413e-03f, 5.299915101e-03f,
+    -6.593181978e-03f, 8.135286521e-03f, -9.968752533e-03f, 1.214675995e-02f, -1.473815999e-02f, 1.783553501e-02f, -2.156855971e-02f, 2.612706543e-02f,
+    -3.180296916e-02f, 3.907170125e-02f, -4.876441618e-02f, 6.247584231e-02f, -8.369503617e-02f, 1.217811749e-01f, -2.131698883e-01f, 7.736013128e-01f,
+    4.825315754e-01f, -1.821154609e-01f, 1.104642029e-01f, -7.779750230e-02f, 5.881392205e-02f, -4.624234765e-02f, 3.721382099e-02f, -3.037022701e-02f,
+    2.498642405e-02f, -2.064010637e-02f, 1.706825757e-02f, -1.409778061e-02f, 1.160917403e-02f, -9.516287369e-03f, 7.754472170e-03f, -6.273377238e-03f,
+    5.032438718e-03f, -3.997996718e-03f, 3.141425438e-03f, -2.437910365e-03f, 1.865645386e-03f, -1.405304538e-03f, 1.039692854e-03f, -7.535122124e-04f,
+    5.331985790e-04f, -3.668008587e-04f, 2.438812023e-04f, -1.554234959e-04f, 9.374177608e-05f, -5.238400899e-05f, 2.602938512e-05f, -1.037923933e-05f,
+  },
+  {
+    -1.324537305e-05f, 3.107351959e-05f, -6.054538586e-05f, 1.061995788e-04f, -1.736260946e-04f, 2.695744294e-04f, -4.020551274e-04f, 5.804350474e-04f,
+    -8.155287480e-04f, 1.119691323e-03f, -1.506921985e-03f, 1.992993115e-03f, -2.595626907e-03f, 3.334752258e-03f, -4.232889615e-03f, 5.315734194e-03f,
+    -6.613042799e-03f, 8.159985356e-03f, -9.999214635e-03f, 1.218406640e-02f, -1.478358576e-02f, 1.789060439e-02f, -2.163512901e-02f, 2.620744947e-02f,
+    -3.190013968e-02f, 3.918960609e-02f, -4.890850136e-02f, 6.265388675e-02f, -8.391818596e-02f, 1.220619535e-01f, -2.134652955e-01f, 7.701812346e-01f,
+    4.867879644e-01f, -1.831484507e-01f, 1.110115168e-01f, -7.815922784e-02f, 5.907792975e-02f, -4.644560994e-02f, 3.737530684e-02f, -3.050100035e-02f,
+    2.509355726e-02f, -2.072844727e-02f, 1.714131820e-02f, -1.415822159e-02f, 1.165908516e-02f, -9.557358186e-03f, 7.788099681e-03f, -6.300736260e-03f,
+    5.054529115e-03f, -4.015676050e-03f, 3.155432214e-03f, -2.448881163e-03f, 1.874127966e-03f, -1.411768313e-03f, 1.044537629e-03f, -7.570757732e-04f,
+    5.357635151e-04f, -3.686008411e-04f, 2.451068521e-04f, -1.562279056e-04f, 9.424570199e-05f, -5.268072788e-05f, 2.618919378e-05f, -1.045357053e-05f,
+  },
+  {
+    -1.325110138e-05f, 3.111256615e-05f, -6.064666289e-05f, 1.064050967e-04f, -1.739943707e-04f, 2.701843025e-04f, -4.030099565e-04f, 5.818672675e-04f,
+    -8.176047588e-04f, 1.122616692e-03f, -1.510946969e-03f, 1.998418528e-03f, -2.602810434e-03f, 3.344115361e-03f, -4.244925325e-03f, 5.331016215e-03f,
+    -6.632236623e-03f, 8.183862409e-03f, -1.002867103e-02f, 1.222014870e-02f, -1.482752740e-02f, 1.794387865e-02f, -2.169952781e-02f, 2.628520356e-02f,
+    -3.199410626e-02f, 3.930356854e-02f, -4.904765330e-02f, 6.282558505e-02f, -8.413278182e-02f, 1.223301823e-01f, -2.137387720e-01f, 7.667421183e-01f,
+    4.910408676e-01f, -1.841678079e-01f, 1.115494770e-01f, -7.851408926e-02f, 5.933664672e-02f, -4.664466802e-02f, 3.753338822e-02f, -3.062898500e-02f,
+    2.519839132e-02f, -2.081488705e-02f, 1.721280638e-02f, -1.421736433e-02f, 1.170792822e-02f, -9.597554675e-03f, 7.821015992e-03f, -6.327521152e-03f,
+    5.076160110e-03f, -4.032991477e-03f, 3.169154006e-03f, -2.459631641e-03f, 1.882442677e-03f, -1.418106274e-03f, 1.049289861e-03f, -7.605727199e-04f,
+    5.382816950e-04f, -3.703689749e-04f, 2.463115869e-04f, -1.570192001e-04f, 9.474189246e-05f, -5.297326775e-05f, 2.634704600e-05f, -1.052722706e-05f,
+  },
+  {
+    -1.325533857e-05f, 3.114822180e-05f, -6.074144421e-05f, 1.065993495e-04f, -1.743443841e-04f, 2.707660091e-04f, -4.039230064e-04f, 5.832394513e-04f,
+    -8.195967543e-04f, 1.125427116e-03f, -1.514817737e-03f, 2.003640551e-03f, -2.609729736e-03f, 3.353139767e-03f, -4.256531994e-03f, 5.345760428e-03f,
+    -6.650762481e-03f, 8.206916426e-03f, -1.005712013e-02f, 1.225500484e-02f, -1.486998244e-02f, 1.799535476e-02f, -2.176175247e-02f, 2.636032336e-02f,
+    -3.208486385e-02f, 3.941358283e-02f, -4.918186579e-02f, 6.299093130e-02f, -8.433882067e-02f, 1.225858709e-01f, -2.139903941e-01f, 7.632841577e-01f,
+    4.952900589e-01f, -1.851733872e-01f, 1.120780091e-01f, -7.886203949e-02f, 5.959003964e-02f, -4.683949677e-02f, 3.768804543e-02f, -3.075416515e-02f,
+    2.530091334e-02f, -2.089941508e-02f, 1.728271334e-02f, -1.427520155e-02f, 1.175569717e-02f, -9.636871837e-03f, 7.853216980e-03f, -6.353728536e-03f,
+    5.097328956e-03f, -4.049940778e-03f, 3.182589036e-03f, -2.470160393e-03f, 1.890588421e-03f, -1.424317571e-03f, 1.053948906e-03f, -7.640025706e-04f,
+    5.407527659e-04f, -3.721050080e-04f, 2.474952313e-04f, -1.577972613e-04f, 9.523027131e-05f, -5.326158208e-05f, 2.650291545e-05f, -1.060019570e-05f,
+  },
+  {
+    -1.325809294e-05f, 3.118049804e-05f, -6.082974437e-05f, 1.067823542e-04f, -1.746761526e-04f, 2.713195647e-04f, -4.047942863e-04f, 5.845515959e-04f,
+    -8.215047110e-04f, 1.128122540e-03f, -1.518534190e-03f, 2.008659021e-03f, -2.616384563e-03f, 3.361825115e-03f, -4.267709119e-03f, 5.359966150e-03f,
+    -6.668619465e-03f, 8.229146232e-03f, -1.008456042e-02f, 1.228863295e-02f, -1.491094853e-02f, 1.804502987e-02f, -2.182179954e-02f, 2.643280481e-02f,
+    -3.217240770e-02f, 3.951964361e-02f, -4.931113311e-02f, 6.314992021e-02f, -8.453630023e-02f, 1.228290296e-01f, -2.142202398e-01f, 7.598075476e-01f,
+    4.995353120e-01f, -1.861650438e-01f, 1.125970393e-01f, -7.920303200e-02f, 5.983807564e-02f, -4.703007141e-02f, 3.783925907e-02f, -3.087652522e-02f,
+    2.540111061e-02f, -2.098202093e-02f, 1.735103042e-02f, -1.433172608e-02f, 1.180238604e-02f, -9.675304749e-03f, 7.884698590e-03f, -6.379355087e-03f,
+    5.118032944e-03f, -4.066521766e-03f, 3.195735555e-03f, -2.480466032e-03f, 1.898564111e-03f, -1.430401367e-03f, 1.058514126e-03f, -7.673648488e-04f,
+    5.431763788e-04f, -3.738086905e-04f, 2.486576113e-04f, -1.585619721e-04f, 9.571076290e-05f, -5.354562459e-05f, 2.665677587e-05f, -1.067246322e-05f,
+  },
+  {
+    -1.325937294e-05f, 3.120940668e-05f, -6.091157853e-05f, 1.069541286e-04f, -1.749896954e-04f, 2.718449877e-04f, -4.056238098e-04f, 5.858037042e-04f,
+    -8.233286134e-04f, 1.130702921e-03f, -1.522096241e-03f, 2.013473793e-03f, -2.622774692e-03f, 3.370171076e-03f, -4.278456238e-03f, 5.373632749e-03f,
+    -6.685806739e-03f, 8.250550735e-03f, -1.011099052e-02f, 1.232103126e-02f, -1.495042351e-02f, 1.809290132e-02f, -2.187966583e-02f, 2.650264409e-02f,
+    -3.225673339e-02f, 3.962174590e-02f, -4.943544999e-02f, 6.330254709e-02f, -8.472521906e-02f, 1.230596700e-01f, -2.144283880e-01f, 7.563124836e-01f,
+    5.037764010e-01f, -1.871426335e-01f, 1.131064949e-01f, -7.953702082e-02f, 6.008072230e-02f, -4.721636756e-02f, 3.798701004e-02f, -3.099604989e-02f,
+    2.549897066e-02f, -2.106269430e-02f, 1.741774912e-02f, -1.438693084e-02f, 1.184798900e-02f, -9.712848569e-03f, 7.915456831e-03f, -6.404397533e-03f,
+    5.138269408e-03f, -4.082732285e-03f, 3.208591836e-03f, -2.490547190e-03f, 1.906368676e-03f, -1.436356833e-03f, 1.062984891e-03f, -7.706590839e-04f,
+    5.455521887e-04f, -3.754797754e-04f, 2.497985547e-04f, -1.593132165e-04f, 9.618329215e-05f, -5.382534927e-05f, 2.680860113e-05f, -1.074401641e-05f,
+  },
+  {
+    -1.325918717e-05f, 3.123495984e-05f, -6.098696248e-05f, 1.071146918e-04f, -1.752850337e-04f, 2.723422992e-04f, -4.064115945e-04f, 5.869957851e-04f,
+    -8.250684546e-04f, 1.133168224e-03f, -1.525503820e-03f, 2.018084742e-03f, -2.628899925e-03f, 3.378177357e-03f, -4.288772932e-03f, 5.386759650e-03f,
+    -6.702323530e-03f, 8.271128924e-03f, -1.013640912e-02f, 1.235219815e-02f, -1.498840534e-02f, 1.813896662e-02f, -2.193534833e-02f, 2.656983766e-02f,
+    -3.233783681e-02f, 3.971988511e-02f, -4.955481167e-02f, 6.344880788e-02f, -8.490557648e-02f, 1.232778048e-01f, -2.146149190e-01f, 7.527991625e-01f,
+    5.080130994e-01f, -1.881060127e-01f, 1.136063034e-01f, -7.986396056e-02f, 6.031794766e-02f, -4.739836120e-02f, 3.813127957e-02f, -3.111272410e-02f,
+    2.559448119e-02f, -2.114142510e-02f, 1.748286107e-02f, -1.444080892e-02f, 1.189250029e-02f, -9.749498537e-03f, 7.945487776e-03f, -6.428852653e-03f,
+    5.158035723e-03f, -4.098570215e-03f, 3.221156180e-03f, -2.500402520e-03f, 1.914001060e-03f, -1.442183155e-03f, 1.067360580e-03f, -7.738848107e-04f,
+    5.478798545e-04f, -3.771180182e-04f, 2.509178912e-04f, -1.600508793e-04f, 9.664778458e-05f, -5.410071039e-05f, 2.695836518e-05f, -1.081484207e-05f,
+  },
+  {
+    -1.325754433e-05f, 3.125716998e-05f, -6.105591260e-05f, 1.072640639e-04f, -1.755621905e-04f, 2.728115229e-04f, -4.071576619e-04f, 5.881278533e-04f,
+    -8.267242359e-04f, 1.135518430e-03f, -1.528756871e-03f, 2.022491763e-03f, -2.634760090e-03f, 3.385843696e-03f, -4.298658825e-03f, 5.399346329e-03f,
+    -6.718169132e-03f, 8.290879869e-03f, -1.016081503e-02f, 1.238213208e-02f, -1.502489213e-02f, 1.818322346e-02f, -2.198884425e-02f, 2.663438222e-02f,
+    -3.241571416e-02f, 3.981405704e-02f, -4.966921386e-02f, 6.358869912e-02f, -8.507737264e-02f, 1.234834478e-01f, -2.147799145e-01f, 7.492677817e-01f,
+    5.122451811e-01f, -1.890550385e-01f, 1.140963932e-01f, -8.018380643e-02f, 6.054972023e-02f, -4.757602868e-02f, 3.827204918e-02f, -3.122653305e-02f,
+    2.568763016e-02f, -2.121820340e-02f, 1.754635805e-02f, -1.449335349e-02f, 1.193591425e-02f, -9.785249972e-03f, 7.974787566e-03f, -6.452717279e-03f,
+    5.177329308e-03f, -4.114033466e-03f, 3.233426913e-03f, -2.510030693e-03f, 1.921460223e-03f, -1.447879526e-03f, 1.071640579e-03f, -7.770415701e-04f,
+    5.501590391e-04f, -3.787231772e-04f, 2.520154518e-04f, -1.607748467e-04f, 9.710416624e-05f, -5.437166253e-05f, 2.710604210e-05f, -1.088492703e-05f,
+  },
+  {
+    -1.325445327e-05f, 3.127604982e-05f, -6.111844591e-05f, 1.074022661e-04f, -1.758211903e-04f, 2.732526856e-04f, -4.078620378e-04f, 5.891999296e-04f,
+    -8.282959669e-04f, 1.137753529e-03f, -1.531855355e-03f, 2.026694775e-03f, -2.640355042e-03f, 3.393169867e-03f, -4.308113581e-03f, 5.411392315e-03f,
+    -6.733342903e-03f, 8.309802721e-03f, -1.018420714e-02f, 1.241083167e-02f, -1.505988214e-02f, 1.822566970e-02f, -2.204015103e-02f, 2.669627475e-02f,
+    -3.249036197e-02f, 3.990425788e-02f, -4.977865274e-02f, 6.372221796e-02f, -8.524060846e-02f, 1.236766138e-01f, -2.149234575e-01f, 7.457185399e-01f,
+    5.164724199e-01f, -1.899895685e-01f, 1.145766936e-01f, -8.049651418e-02f, 6.077600899e-02f, -4.774934676e-02f, 3.840930071e-02f, -3.133746218e-02f,
+    2.577840571e-02f, -2.129301946e-02f, 1.760823201e-02f, -1.454455786e-02f, 1.197822534e-02f, -9.820098274e-03f, 8.003352404e-03f, -6.475988297e-03f,
+    5.196147622e-03f, -4.129119984e-03f, 3.245402386e-03f, -2.519430403e-03f, 1.928745138e-03f, -1.453445153e-03f, 1.075824285e-03f, -7.801289089e-04f,
+    5.523894095e-04f, -3.802950131e-04f, 2.530910695e-04f, -1.614850055e-04f, 9.755236381e-05f, -5.463816054e-05f, 2.725160608e-05f, -1.095425810e-05f,
+  },
+  {
+    -1.324992295e-05f, 3.129161243e-05f, -6.117458002e-05f, 1.075293208e-04f, -1.760620597e-04f, 2.736658165e-04f, -4.085247521e-04f, 5.902120405e-04f,
+    -8.297836652e-04f, 1.139873521e-03f, -1.534799246e-03f, 2.030693711e-03f, -2.645684663e-03f, 3.400155675e-03f, -4.317136909e-03f, 5.422897192e-03f,
+    -6.747844271e-03f, 8.327896715e-03f, -1.020658447e-02f, 1.243829565e-02f, -1.509337377e-02f, 1.826630339e-02f, -2.208926630e-02f, 2.675551245e-02f,
+    -3.256177706e-02f, 3.999048419e-02f, -4.988312498e-02f, 6.384936215e-02f, -8.539528571e-02f, 1.238573187e-01f, -2.150456320e-01f, 7.421516362e-01f,
+    5.206945895e-01f, -1.909094611e-01f, 1.150471344e-01f, -8.080204017e-02f, 6.099678339e-02f, -4.791829256e-02f, 3.854301632e-02f, -3.144549721e-02f,
+    2.586679620e-02f, -2.136586369e-02f, 1.766847502e-02f, -1.459441547e-02f, 1.201942809e-02f, -9.854038927e-03f, 8.031178565e-03f, -6.498662645e-03f,
+    5.214488169e-03f, -4.143827746e-03f, 3.257080978e-03f, -2.528600361e-03f, 1.935854797e-03f, -1.458879253e-03f, 1.079911099e-03f, -7.831463795e-04f,
+    5.545706368e-04f, -3.818332897e-04f, 2.541445790e-04f, -1.621812440e-04f, 9.799230456e-05f, -5.490015956e-05f, 2.739503140e-05f, -1.102282213e-05f,
+  },
+  {
+    -1.324396246e-05f, 3.130387117e-05f, -6.122433313e-05f, 1.076452511e-04f, -1.762848268e-04f, 2.740509476e-04f, -4.091458386e-04f, 5.911642184e-04f,
+    -8.311873571e-04f, 1.141878421e-03f, -1.537588536e-03f, 2.034488528e-03f, -2.650748859e-03f, 3.406800960e-03f, -4.325728561e-03f, 5.433860595e-03f,
+    -6.761672728e-03f, 8.345161166e-03f, -1.022794610e-02f, 1.246452285e-02f, -1.512536559e-02f, 1.830512275e-02f, -2.213618793e-02f, 2.681209283e-02f,
+    -3.262995660e-02f, 4.007273293e-02f, -4.998262774e-02f, 6.397013007e-02f, -8.554140689e-02f, 1.240255796e-01f, -2.151465235e-01f, 7.385672709e-01f,
+    5.249114636e-01f, -1.918145752e-01f, 1.155076460e-01f, -8.110034136e-02f, 6.121201335e-02f, -4.808284360e-02f, 3.867317849e-02f, -3.155062410e-02f,
+    2.595279023e-02f, -2.143672671e-02f, 1.772707931e-02f, -1.464291984e-02f, 1.205951716e-02f, -9.887067494e-03f, 8.058262385e-03f, -6.520737318e-03f,
+    5.232348495e-03f, -4.158154766e-03f, 3.268461094e-03f, -2.537539300e-03f, 1.942788203e-03f, -1.464181056e-03f, 1.083900434e-03f, -7.860935406e-04f,
+    5.567023962e-04f, -3.833377735e-04f, 2.551758169e-04f, -1.628634513e-04f, 9.842391635e-05f, -5.515761505e-05f, 2.753629250e-05f, -1.109060600e-05f,
+  },
+  {
+    -1.323658100e-05f, 3.131283968e-05f, -6.126772407e-05f, 1.077500815e-04f, -1.764895216e-04f, 2.744081138e-04f, -4.097253353e-04f, 5.920565016e-04f,
+    -8.325070768e-04f, 1.143768251e-03f, -1.540223229e-03f, 2.038079203e-03f, -2.655547564e-03f, 3.413105596e-03f, -4.333888329e-03f, 5.444282215e-03f,
+    -6.774827831e-03f, 8.361595468e-03f, -1.024829124e-02f, 1.248951225e-02f, -1.515585629e-02f, 1.834212617e-02f, -2.218091400e-02f, 2.686601363e-02f,
+    -3.269489804e-02f, 4.015100144e-02f, -5.007715865e-02f, 6.408452069e-02f, -8.567897535e-02f, 1.241814145e-01f, -2.152262188e-01f, 7.349656451e-01f,
+    5.291228161e-01f, -1.927047704e-01f, 1.159581599e-01f, -8.139137527e-02f, 6.142166929e-02f, -4.824297776e-02f, 3.879976999e-02f, -3.165282910e-02f,
+    2.603637658e-02f, -2.150559930e-02f, 1.778403725e-02f, -1.469006468e-02f, 1.209848730e-02f, -9.919179626e-03f, 8.084600273e-03f, -6.542209361e-03f,
+    5.249726188e-03f, -4.172099090e-03f, 3.279541165e-03f, -2.546245975e-03f, 1.949544377e-03f, -1.469349803e-03f, 1.087791709e-03f, -7.889699567e-04f,
+    5.587843672e-04f, -3.848082337e-04f, 2.561846214e-04f, -1.635315176e-04f, 9.884712769e-05f, -5.541048278e-05f, 2.767536391e-05f, -1.115759659e-05f,
+  },
+  {
+    -1.322778790e-05f, 3.131853194e-05f, -6.130477224e-05f, 1.078438375e-04f, -1.766761756e-04f, 2.747373523e-04f, -4.102632841e-04f, 5.928889342e-04f,
+    -8.337428666e-04f, 1.145543047e-03f, -1.542703347e-03f, 2.041465732e-03f, -2.660080736e-03f, 3.419069489e-03f, -4.341616048e-03f, 5.454161792e-03f,
+    -6.787309206e-03f, 8.377199101e-03f, -1.026761920e-02f, 1.251326294e-02f, -1.518484471e-02f, 1.837731224e-02f, -2.222344278e-02f, 2.691727285e-02f,
+    -3.275659917e-02f, 4.022528744e-02f, -5.016671580e-02f, 6.419253360e-02f, -8.580799520e-02f, 1.243248425e-01f, -2.152848058e-01f, 7.313469607e-01f,
+    5.333284210e-01f, -1.935799070e-01f, 1.163986081e-01f, -8.167510007e-02f, 6.162572208e-02f, -4.839867336e-02f, 3.892277395e-02f, -3.175209869e-02f,
+    2.611754428e-02f, -2.157247244e-02f, 1.783934137e-02f, -1.473584376e-02f, 1.213633334e-02f, -9.950371053e-03f, 8.110188702e-03f, -6.563075878e-03f,
+    5.266618881e-03f, -4.185658800e-03f, 3.290319651e-03f, -2.554719158e-03f, 1.956122356e-03f, -1.474384745e-03f, 1.091584354e-03f, -7.917751984e-04f,
+    5.608162332e-04f, -3.862444423e-04f, 2.571708326e-04f, -1.641853345e-04f, 9.926186770e-05f, -5.565871882e-05f, 2.781222030e-05f, -1.122378080e-05f,
+  },
+  {
+    -1.321759260e-05f, 3.132096218e-05f, -6.133549763e-05f, 1.079265455e-04f, -1.768448224e-04f, 2.750387035e-04f, -4.107597311e-04f, 5.936615661e-04f,
+    -8.348947773e-04f, 1.147202856e-03f, -1.545028924e-03f, 2.044648130e-03f, -2.664348360e-03f, 3.424692579e-03f, -4.348911597e-03f, 5.463499124e-03f,
+    -6.799116541e-03f, 8.391971623e-03f, -1.028592936e-02f, 1.253577413e-02f, -1.521232986e-02f, 1.841067970e-02f, -2.226377277e-02f, 2.696586876e-02f,
+    -3.281505809e-02f, 4.029558906e-02f, -5.025129778e-02f, 6.429416898e-02f, -8.592847137e-02f, 1.244558840e-01f, -2.153223736e-01f, 7.277114205e-01f,
+    5.375280521e-01f, -1.944398461e-01f, 1.168289233e-01f, -8.195147451e-02f, 6.182414312e-02f, -4.854990908e-02f, 3.904217379e-02f, -3.184841965e-02f,
+    2.619628256e-02f, -2.163733728e-02f, 1.789298435e-02f, -1.478025101e-02f, 1.217305026e-02f, -9.980637591e-03f, 8.135024214e-03f, -6.583334024e-03f,
+    5.283024252e-03f, -4.198832012e-03f, 3.300795036e-03f, -2.562957645e-03f, 1.962521192e-03f, -1.479285148e-03f, 1.095277806e-03f, -7.945088426e-04f,
+    5.627976823e-04f, -3.876461742e-04f, 2.581342926e-04f, -1.648247944e-04f, 9.966806613e-05f, -5.590227958e-05f, 2.794683647e-05f, -1.128914558e-05f,
+  },
+  {
+    -1.320600468e-05f, 3.132014495e-05f, -6.135992084e-05f, 1.079982330e-04f, -1.769954970e-04f, 2.753122102e-04f, -4.112147261e-04f, 5.943744531e-04f,
+    -8.359628677e-04f, 1.148747736e-03f, -1.547200012e-03f, 2.047626434e-03f, -2.668350448e-03f, 3.429974839e-03f, -4.355774895e-03f, 5.472294058e-03f,
+    -6.810249594e-03f, 8.405912675e-03f, -1.030322123e-02f, 1.255704515e-02f, -1.523831087e-02f, 1.844222749e-02f, -2.230190271e-02f, 2.701179988e-02f,
+    -3.287027319e-02f, 4.036190479e-02f, -5.033090366e-02f, 6.438942762e-02f, -8.604040954e-02f, 1.245745600e-01f, -2.153390127e-01f, 7.240592280e-01f,
+    5.417214835e-01f, -1.952844493e-01f, 1.172490391e-01f, -8.222045794e-02f, 6.201690425e-02f, -4.869666401e-02f, 3.915795328e-02f, -3.194177901e-02f,
+    2.627258089e-02f, -2.170018515e-02f, 1.794495902e-02f, -1.482328049e-02f, 1.220863309e-02f, -1.000997514e-02f, 8.159103422e-03f, -6.602981013e-03f,
+    5.298940022e-03f, -4.211616875e-03f, 3.310965833e-03f, -2.570960251e-03f, 1.968739952e-03f, -1.484050287e-03f, 1.098871509e-03f, -7.971704723e-04f,
+    5.647284066e-04f, -3.890132073e-04f, 2.590748450e-04f, -1.654497909e-04f, 1.000656534e-04f, -5.614112179e-05f, 2.807918734e-05f, -1.135367788e-05f,
+  },
+  {
+    -1.319303379e-05f, 3.131609508e-05f, -6.137806303e-05f, 1.080589288e-04f, -1.771282363e-04f, 2.755579177e-04f, -4.116283234e-04f, 5.950276567e-04f,
+    -8.369472046e-04f, 1.150177755e-03f, -1.549216677e-03f, 2.050400699e-03f, -2.672087036e-03f, 3.434916276e-03f, -4.362205905e-03f, 5.480546496e-03f,
+    -6.820708186e-03f, 8.419021977e-03f, -1.031949441e-02f, 1.257707546e-02f, -1.526278703e-02f, 1.847195471e-02f, -2.233783151e-02f, 2.705506499e-02f,
+    -3.292224321e-02f, 4.042423352e-02f, -5.040553298e-02f, 6.447831093e-02f, -8.614381621e-02f, 1.246808931e-01f, -2.153348147e-01f, 7.203905876e-01f,
+    5.459084893e-01f, -1.961135791e-01f, 1.176588898e-01f, -8.248201036e-02f, 6.220397786e-02f, -4.883891763e-02f, 3.927009651e-02f, -3.203216408e-02f,
+    2.634642895e-02f, -2.176100758e-02f, 1.799525837e-02f, -1.486492636e-02f, 1.224307702e-02f, -1.003837969e-02f, 8.182423005e-03f, -6.622014112e-03f,
+    5.314363955e-03f, -4.224011577e-03f, 3.320830583e-03f, -2.578725815e-03f, 1.974777722e-03f, -1.488679450e-03f, 1.102364920e-03f, -7.997596767e-04f,
+    5.666081025e-04f, -3.903453224e-04f, 2.599923357e-04f, -1.660602190e-04f, 1.004545605e-04f, -5.637520249e-05f, 2.820924799e-05f, -1.141736469e-05f,
+  },
+  {
+    -1.317868974e-05f, 3.130882770e-05f, -6.138994594e-05f, 1.081086623e-04f, -1.772430787e-04f, 2.757758744e-04f, -4.120005807e-04f, 5.956212440e-04f,
+    -8.378478630e-04f, 1.151492993e-03f, -1.551078999e-03f, 2.052971001e-03f, -2.675558188e-03f, 3.439516929e-03f, -4.368204630e-03f, 5.488256392e-03f,
+    -6.830492205e-03f, 8.431299332e-03f, -1.033474859e-02f, 1.259586462e-02f, -1.528575777e-02f, 1.849986066e-02f, -2.237155832e-02f, 2.709566314e-02f,
+    -3.297096718e-02f, 4.048257450e-02f, -5.047518575e-02f, 6.456082090e-02f, -8.623869866e-02f, 1.247749065e-01f, -2.153098725e-01f, 7.167057045e-01f,
+    5.500888438e-01f, -1.969270986e-01f, 1.180584105e-01f, -8.273609237e-02f, 6.238533678e-02f, -4.897664983e-02f, 3.937858789e-02f, -3.211956242e-02f,
+    2.641781664e-02f, -2.181979627e-02f, 1.804387554e-02f, -1.490518294e-02f, 1.227637729e-02f, -1.006584730e-02f, 8.204979713e-03f, -6.640430646e-03f,
+    5.329293863e-03f, -4.236014340e-03f, 3.330387853e-03f, -2.586253193e-03f, 1.980633601e-03f, -1.493171937e-03f, 1.105757501e-03f, -8.022760514e-04f,
+    5.684364711e-04f, -3.916423031e-04f, 2.608866121e-04f, -1.666559745e-04f, 1.008347193e-04f, -5.660447910e-05f, 2.833699361e-05f, -1.148019303e-05f,
+  },
+  {
+    -1.316298241e-05f, 3.129835820e-05f, -6.139559189e-05f, 1.081474641e-04f, -1.773400644e-04f, 2.759661309e-04f, -4.123315601e-04f, 5.961552882e-04f,
+    -8.386649262e-04f, 1.152693542e-03f, -1.552787075e-03f, 2.055337437e-03f, -2.678763991e-03f, 3.443776871e-03f, -4.373771119e-03f, 5.495423754e-03f,
+    -6.839601604e-03f, 8.442744623e-03f, -1.034898358e-02f, 1.261341234e-02f, -1.530722268e-02f, 1.852594479e-02f, -2.240308249e-02f, 2.713359362e-02f,
+    -3.301644446e-02f, 4.053692739e-02f, -5.053986246e-02f, 6.463696014e-02f, -8.632506493e-02f, 1.248566248e-01f, -2.152642802e-01f, 7.130047846e-01f,
+    5.542623215e-01f, -1.977248717e-01f, 1.184475369e-01f, -8.298266519e-02f, 6.256095438e-02f, -4.910984090e-02f, 3.948341216e-02f, -3.220396189e-02f,
+    2.648673411e-02f, -2.187654312e-02f, 1.809080381e-02f, -1.494404464e-02f, 1.230852928e-02f, -1.009237415e-02f, 8.226770367e-03f, -6.658227996e-03f,
+    5.343727601e-03f, -4.247623418e-03f, 3.339636239e-03f, -2.593541267e-03f, 1.986306706e-03f, -1.497527061e-03f, 1.109048726e-03f, -8.047191982e-04f,
+    5.702132176e-04f, -3.929039360e-04f, 2.617575240e-04f, -1.672369547e-04f, 1.012060621e-04f, -5.682890935e-05f, 2.846239955e-05f, -1.154214994e-05f,
+  },
+  {
+    -1.314592182e-05f, 3.128470226e-05f, -6.139502375e-05f, 1.081753660e-04f, -1.774192355e-04f, 2.761287408e-04f, -4.126213274e-04f, 5.966298679e-04f,
+    -8.393984852e-04f, 1.153779504e-03f, -1.554341015e-03f, 2.057500121e-03f, -2.681704560e-03f, 3.447696209e-03f, -4.378905458e-03f, 5.502048641e-03f,
+    -6.848036403e-03f, 8.453357816e-03f, -1.036219926e-02f, 1.262971843e-02f, -1.532718148e-02f, 1.855020674e-02f, -2.243240360e-02f, 2.716885598e-02f,
+    -3.305867471e-02f, 4.058729222e-02f, -5.059956409e-02f, 6.470673185e-02f, -8.640292387e-02f, 1.249260733e-01f, -2.151981328e-01f, 7.092880347e-01f,
+    5.584286967e-01f, -1.985067629e-01f, 1.188262059e-01f, -8.322169069e-02f, 6.273080453e-02f, -4.923847154e-02f, 3.958455441e-02f, -3.228535060e-02f,
+    2.655317172e-02f, -2.193124021e-02f, 1.813603663e-02f, -1.498150603e-02f, 1.233952847e-02f, -1.011795646e-02f, 8.247791856e-03f, -6.675403597e-03f,
+    5.357663069e-03f, -4.258837107e-03f, 3.348574365e-03f, -2.600588936e-03f, 1.991796170e-03f, -1.501744146e-03f, 1.112238074e-03f, -8.070887254e-04f,
+    5.719380518e-04f, -3.941300109e-04f, 2.626049227e-04f, -1.678030579e-04f, 1.015685219e-04f, -5.704845133e-05f, 2.858544131e-05f, -1.160322251e-05f,
+  },
+  {
+    -1.312751808e-05f, 3.126787586e-05f, -6.138826498e-05f, 1.081924006e-04f, -1.774806354e-04f, 2.762637600e-04f, -4.128699525e-04f, 5.970450675e-04f,
+    -8.400486393e-04f, 1.154750992e-03f, -1.555740945e-03f, 2.059459188e-03f, -2.684380035e-03f, 3.451275081e-03f, -4.383607778e-03f, 5.508131167e-03f,
+    -6.855796685e-03f, 8.463138955e-03f, -1.037439564e-02f, 1.264478282e-02f, -1.534563404e-02f, 1.857264633e-02f, -2.245952144e-02f, 2.720145005e-02f,
+    -3.309765791e-02f, 4.063366942e-02f, -5.065429207e-02f, 6.477013983e-02f, -8.647228510e-02f, 1.249832786e-01f, -2.151115270e-01f, 7.055556621e-01f,
+    5.625877443e-01f, -1.992726378e-01f, 1.191943547e-01f, -8.345313137e-02f, 6.289486158e-02f, -4.936252287e-02f, 3.968200006e-02f, -3.236371696e-02f,
+    2.661712004e-02f, -2.198387981e-02f, 1.817956762e-02f, -1.501756180e-02f, 1.236937044e-02f, -1.014259057e-02f, 8.268041142e-03f, -6.691954946e-03f,
+    5.371098214e-03f, -4.269653735e-03f, 3.357200883e-03f, -2.607395126e-03f, 1.997101142e-03f, -1.505822528e-03f, 1.115325037e-03f, -8.093842478e-04f,
+    5.736106880e-04f, -3.953203204e-04f, 2.634286617e-04f, -1.683541836e-04f, 1.019220327e-04f, -5.726306350e-05f, 2.870609453e-05f, -1.166339785e-05f,
+  },
+  {
+    -1.310778140e-05f, 3.124789521e-05f, -6.137533959e-05f, 1.081986015e-04f, -1.775243093e-04f, 2.763712472e-04f, -4.130775092e-04f, 5.974009772e-04f,
+    -8.406154956e-04f, 1.155608130e-03f, -1.556987006e-03f, 2.061214793e-03f, -2.686790582e-03f, 3.454513659e-03f, -4.387878252e-03f, 5.513671496e-03f,
+    -6.862882601e-03f, 8.472088166e-03f, -1.038557280e-02f, 1.265860557e-02f, -1.536258039e-02f, 1.859326356e-02f, -2.248443599e-02f, 2.723137590e-02f,
+    -3.313339435e-02f, 4.067605977e-02f, -5.070404832e-02f, 6.482718848e-02f, -8.653315899e-02f, 1.250282683e-01f, -2.150045602e-01f, 7.018078751e-01f,
+    5.667392391e-01f, -2.000223623e-01f, 1.195519217e-01f, -8.367695036e-02f, 6.305310042e-02f, -4.948197640e-02f, 3.977573484e-02f, -3.243904963e-02f,
+    2.667856990e-02f, -2.203445438e-02f, 1.822139052e-02f, -1.505220676e-02f, 1.239805088e-02f, -1.016627289e-02f, 8.287515257e-03f, -6.707879594e-03f,
+    5.384031029e-03f, -4.280071666e-03f, 3.365514473e-03f, -2.613958780e-03f, 2.002220789e-03f, -1.509761558e-03f, 1.118309114e-03f, -8.116053867e-04f,
+    5.752308450e-04f, -3.964746604e-04f, 2.642285964e-04f, -1.688902327e-04f, 1.022665288e-04f, -5.747270466e-05f, 2.882433500e-05f, -1.172266312e-05f,
+  },
+  {
+    -1.308672212e-05f, 3.122477684e-05f, -6.135627214e-05f, 1.081940034e-04f, -1.775503042e-04f, 2.764512638e-04f, -4.132440750e-04f, 5.976976928e-04f,
+    -8.410991695e-04f, 1.156351054e-03f, -1.558079352e-03f, 2.062767110e-03f, -2.688936392e-03f, 3.457412149e-03f, -4.391717093e-03f, 5.518669847e-03f,
+    -6.869294366e-03f, 8.480205656e-03f, -1.039573094e-02f, 1.267118686e-02f, -1.537802068e-02f, 1.861205858e-02f, -2.250714747e-02f, 2.725863385e-02f,
+    -3.316588464e-02f, 4.071446447e-02f, -5.074883523e-02f, 6.487788279e-02f, -8.658555672e-02f, 1.250610708e-01f, -2.148773312e-01f, 6.980448825e-01f,
+    5.708829562e-01f, -2.007558035e-01f, 1.198988458e-01f, -8.389311144e-02f, 6.320549645e-02f, -4.959681407e-02f, 3.986574486e-02f, -3.251133757e-02f,
+    2.673751235e-02f, -2.208295657e-02f, 1.826149927e-02f, -1.508543587e-02f, 1.242556559e-02f, -1.018899995e-02f, 8.306211303e-03f, -6.723175149e-03f,
+    5.396459550e-03f, -4.290089304e-03f, 3.373513843e-03f, -2.620278866e-03f, 2.007154293e-03f, -1.513560596e-03f, 1.121189813e-03f, -8.137517698e-04f,
+    5.767982461e-04f, -3.975928296e-04f, 2.650045844e-04f, -1.694111072e-04f, 1.026019454e-04f, -5.767733399e-05f, 2.894013869e-05f, -1.178100550e-05f,
+  },
+  {
+    -1.306435065e-05f, 3.119853752e-05f, -6.133108774e-05f, 1.081786420e-04f, -1.775586687e-04f, 2.765038735e-04f, -4.133697315e-04f, 5.979353156e-04f,
+    -8.414997839e-04f, 1.156979911e-03f, -1.559018154e-03f, 2.064116334e-03f, -2.690817682e-03f, 3.459970787e-03f, -4.395124558e-03f, 5.523126489e-03f,
+    -6.875032260e-03f, 8.487491712e-03f, -1.040487036e-02f, 1.268252698e-02f, -1.539195524e-02f, 1.862903174e-02f, -2.252765631e-02f, 2.728322449e-02f,
+    -3.319512968e-02f, 4.074888507e-02f, -5.078865565e-02f, 6.492222836e-02f, -8.662949023e-02f, 1.250817159e-01f, -2.147299400e-01f, 6.942668940e-01f,
+    5.750186708e-01f, -2.014728292e-01f, 1.202350669e-01f, -8.410157905e-02f, 6.335202556e-02f, -4.970701824e-02f, 3.995201654e-02f, -3.258057001e-02f,
+    2.679393866e-02f, -2.212937922e-02f, 1.829988794e-02f, -1.511724419e-02f, 1.245191046e-02f, -1.021076832e-02f, 8.324126458e-03f, -6.737839280e-03f,
+    5.408381863e-03f, -4.299705085e-03f, 3.381197732e-03f, -2.626354372e-03f, 2.011900854e-03f, -1.517219018e-03f, 1.123966653e-03f, -8.158230316e-04f,
+    5.783126194e-04f, -3.986746301e-04f, 2.657564849e-04f, -1.699167103e-04f, 1.029282185e-04f, -5.787691105e-05f, 2.905348170e-05f, -1.183841222e-05f,
+  },
+  {
+    -1.304067752e-05f, 3.116919428e-05f, -6.129981204e-05f, 1.081525539e-04f, -1.775494528e-04f, 2.765291428e-04f, -4.134545641e-04f, 5.981139526e-04f,
+    -8.418174700e-04f, 1.157494857e-03f, -1.559803597e-03f, 2.065262678e-03f, -2.692434694e-03f, 3.462189845e-03f, -4.398100944e-03f, 5.527041745e-03f,
+    -6.880096630e-03f, 8.493946701e-03f, -1.041299143e-02f, 1.269262635e-02f, -1.540438450e-02f, 1.864418358e-02f, -2.254596313e-02f, 2.730514867e-02f,
+    -3.322113071e-02f, 4.077932352e-02f, -5.082351291e-02f, 6.496023137e-02f, -8.666497221e-02f, 1.250902342e-01f, -2.145624876e-01f, 6.904741199e-01f,
+    5.791461585e-01f, -2.021733077e-01f, 1.205605256e-01f, -8.430231828e-02f, 6.349266419e-02f, -4.981257166e-02f, 4.003453664e-02f, -3.264673646e-02f,
+    2.684784035e-02f, -2.217371538e-02f, 1.833655077e-02f, -1.514762695e-02f, 1.247708152e-02f, -1.023157469e-02f, 8.341257968e-03f, -6.751869712e-03f,
+    5.419796100e-03f, -4.308917486e-03f, 3.388564906e-03f, -2.632184311e-03f, 2.016459689e-03f, -1.520736209e-03f, 1.126639160e-03f, -8.178188132e-04f,
+    5.797736976e-04f, -3.997198669e-04f, 2.664841596e-04f, -1.704069467e-04f, 1.032452847e-04f, -5.807139575e-05f, 2.916434030e-05f, -1.189487057e-05f,
+  },
+  {
+    -1.301571336e-05f, 3.113676445e-05f, -6.126247126e-05f, 1.081157766e-04f, -1.775227084e-04f, 2.765271406e-04f, -4.134986620e-04f, 5.982337165e-04f,
+    -8.420523668e-04f, 1.157896060e-03f, -1.560435881e-03f, 2.066206375e-03f, -2.693787696e-03f, 3.464069625e-03f, -4.400646589e-03f, 5.530415989e-03f,
+    -6.884487886e-03f, 8.499571070e-03f, -1.042009465e-02f, 1.270148551e-02f, -1.541530908e-02f, 1.865751477e-02f, -2.256206879e-02f, 2.732440749e-02f,
+    -3.324388925e-02f, 4.080578214e-02f, -5.085341082e-02f, 6.499189859e-02f, -8.669201614e-02f, 1.250866572e-01f, -2.143750762e-01f, 6.866667711e-01f,
+    5.832651949e-01f, -2.028571086e-01f, 1.208751636e-01f, -8.449529486e-02f, 6.362738929e-02f, -4.991345755e-02f, 4.011329230e-02f, -3.270982673e-02f,
+    2.689920917e-02f, -2.221595827e-02f, 1.837148215e-02f, -1.517657949e-02f, 1.250107489e-02f, -1.025141584e-02f, 8.357603154e-03f, -6.765264229e-03f,
+    5.430700438e-03f, -4.317725019e-03f, 3.395614159e-03f, -2.637767716e-03f, 2.020830031e-03f, -1.524111570e-03f, 1.129206872e-03f, -8.197387624e-04f,
+    5.811812179e-04f, -4.007283484e-04f, 2.671874720e-04f, -1.708817221e-04f, 1.035530813e-04f, -5.826074841e-05f, 2.927269095e-05f, -1.195036786e-05f,
+  },
+  {
+    -1.298946888e-05f, 3.110126557e-05f, -6.121909212e-05f, 1.080683489e-04f, -1.774784890e-04f, 2.764979385e-04f, -4.135021184e-04f, 5.982947255e-04f,
+    -8.422046211e-04f, 1.158183699e-03f, -1.560915219e-03f, 2.066947677e-03f, -2.694876981e-03f, 3.465610464e-03f, -4.402761875e-03f, 5.533249649e-03f,
+    -6.888206502e-03f, 8.504365348e-03f, -1.042618061e-02f, 1.270910512e-02f, -1.542472973e-02f, 1.866902619e-02f, -2.257597435e-02f, 2.734100230e-02f,
+    -3.326340717e-02f, 4.082826362e-02f, -5.087835364e-02f, 6.501723740e-02f, -8.671063624e-02f, 1.250710176e-01f, -2.141678091e-01f, 6.828450594e-01f,
+    5.873755560e-01f, -2.035241019e-01f, 1.211789231e-01f, -8.468047522e-02f, 6.375617834e-02f, -5.000965950e-02f, 4.018827096e-02f, -3.276983088e-02f,
+    2.694803709e-02f, -2.225610132e-02f, 1.840467665e-02f, -1.520409728e-02f, 1.252388680e-02f, -1.027028862e-02f, 8.373159410e-03f, -6.778020675e-03f,
+    5.441093103e-03f, -4.326126233e-03f, 3.402344317e-03f, -2.643103643e-03f, 2.025011131e-03f, -1.527344513e-03f, 1.131669332e-03f, -8.215825337e-04f,
+    5.825349225e-04f, -4.016998860e-04f, 2.678662878e-04f, -1.713409436e-04f, 1.038515465e-04f, -5.844492973e-05f, 2.937851024e-05f, -1.200489144e-05f,
+  },
+  {
+    -1.296195489e-05f, 3.106271549e-05f, -6.116970189e-05f, 1.080103101e-04f, -1.774168494e-04f, 2.764416106e-04f, -4.134650300e-04f, 5.982971032e-04f,
+    -8.422743875e-04f, 1.158357964e-03f, -1.561241840e-03f, 2.067486856e-03f, -2.695702867e-03f, 3.466812729e-03f, -4.404447223e-03f, 5.535543204e-03f,
+    -6.891253020e-03f, 8.508330142e-03f, -1.043124999e-02f, 1.271548594e-02f, -1.543264732e-02f, 1.867871890e-02f, -2.258768107e-02f, 2.735493472e-02f,
+    -3.327968662e-02f, 4.084677106e-02f, -5.089834612e-02f, 6.503625574e-02f, -8.672084752e-02f, 1.250433491e-01f, -2.139407908e-01f, 6.790091969e-01f,
+    5.914770181e-01f, -2.041741587e-01f, 1.214717472e-01f, -8.485782641e-02f, 6.387900934e-02f, -5.010116156e-02f, 4.025946043e-02f, -3.282673929e-02f,
+    2.699431632e-02f, -2.229413814e-02f, 1.843612900e-02f, -1.523017593e-02f, 1.254551359e-02f, -1.028818999e-02f, 8.387924201e-03f, -6.790136953e-03f,
+    5.450972368e-03f, -4.334119716e-03f, 3.408754234e-03f, -2.648191172e-03f, 2.029002257e-03f, -1.530434464e-03f, 1.134026098e-03f, -8.233497885e-04f,
+    5.838345581e-04f, -4.026342945e-04f, 2.685204747e-04f, -1.717845197e-04f, 1.041406192e-04f, -5.862390082e-05f, 2.948177497e-05f, -1.205842874e-05f,
+  },
+  {
+    -1.293318231e-05f, 3.102113226e-05f, -6.111432837e-05f, 1.079417009e-04f, -1.773378465e-04f, 2.763582333e-04f, -4.133874976e-04f, 5.982409789e-04f,
+    -8.422618286e-04f, 1.158419056e-03f, -1.561415988e-03f, 2.067824203e-03f, -2.696265697e-03f, 3.467676823e-03f, -4.405703096e-03f, 5.537297183e-03f,
+    -6.893628044e-03f, 8.511466139e-03f, -1.043530356e-02f, 1.272062887e-02f, -1.543906290e-02f, 1.868659410e-02f, -2.259719043e-02f, 2.736620660e-02f,
+    -3.329273006e-02f, 4.086130791e-02f, -5.091339344e-02f, 6.504896216e-02f, -8.672266573e-02f, 1.250036863e-01f, -2.136941267e-01f, 6.751593966e-01f,
+    5.955693577e-01f, -2.048071510e-01f, 1.217535801e-01f, -8.502731620e-02f, 6.399586082e-02f, -5.018794821e-02f, 4.032684886e-02f, -3.288054261e-02f,
+    2.703803933e-02f, -2.233006255e-02f, 1.846583406e-02f, -1.525481120e-02f, 1.256595171e-02f, -1.030511700e-02f, 8.401895069e-03f, -6.801611023e-03f,
+    5.460336552e-03f, -4.341704093e-03f, 3.414842793e-03f, -2.653029405e-03f, 2.032802695e-03f, -1.533380861e-03f, 1.136276734e-03f, -8.250401950e-04f,
+    5.850798764e-04f, -4.035313917e-04f, 2.691499027e-04f, -1.722123601e-04f, 1.044202390e-04f, -5.879762316e-05f, 2.958246210e-05f, -1.211096720e-05f,
+  },
+  {
+    -1.290316214e-05f, 3.097653423e-05f, -6.105299987e-05f, 1.078625627e-04f, -1.772415383e-04f, 2.762478858e-04f, -4.132696257e-04f, 5.981264874e-04f,
+    -8.421671146e-04f, 1.158367186e-03f, -1.561437921e-03f, 2.067960028e-03f, -2.696565841e-03f, 3.468203177e-03f, -4.406529998e-03f, 5.538512169e-03f,
+    -6.895332243e-03f, 8.513774106e-03f, -1.043834222e-02f, 1.272453493e-02f, -1.544397764e-02f, 1.869265320e-02f, -2.260450413e-02f, 2.737482007e-02f,
+    -3.330254026e-02f, 4.087187799e-02f, -5.092350129e-02f, 6.505536579e-02f, -8.671610736e-02f, 1.249520649e-01f, -2.134279236e-01f, 6.712958721e-01f,
+    5.996523517e-01f, -2.054229513e-01f, 1.220243666e-01f, -8.518891299e-02f, 6.410671187e-02f, -5.027000433e-02f, 4.039042477e-02f, -3.293123177e-02f,
+    2.707919881e-02f, -2.236386856e-02f, 1.849378689e-02f, -1.527799895e-02f, 1.258519773e-02f, -1.032106677e-02f, 8.415069628e-03f, -6.812440908e-03f,
+    5.469184024e-03f, -4.348878027e-03f, 3.420608907e-03f, -2.657617466e-03f, 2.036411747e-03f, -1.536183156e-03f, 1.138420814e-03f, -8.266534284e-04f,
+    5.862706337e-04f, -4.043909990e-04f, 2.697544436e-04f, -1.726243758e-04f, 1.046903463e-04f, -5.896605868e-05f, 2.968054877e-05f, -1.216249434e-05f,
+  },
+  {
+    -1.287190545e-05f, 3.092893996e-05f, -6.098574523e-05f, 1.077729378e-04f, -1.771279847e-04f, 2.761106495e-04f, -4.131115224e-04f, 5.979537688e-04f,
+    -8.419904234e-04f, 1.158202575e-03f, -1.561307911e-03f, 2.067894661e-03f, -2.696603693e-03f, 3.468392256e-03f, -4.406928474e-03f, 5.539188797e-03f,
+    -6.896366351e-03f, 8.515254890e-03f, -1.044036693e-02f, 1.272720525e-02f, -1.544739287e-02f, 1.869689776e-02f, -2.260962407e-02f, 2.738077751e-02f,
+    -3.330912032e-02f, 4.087848554e-02f, -5.092867579e-02f, 6.505547635e-02f, -8.670118967e-02f, 1.248885214e-01f, -2.131422892e-01f, 6.674188375e-01f,
+    6.037257771e-01f, -2.060214334e-01f, 1.222840525e-01f, -8.534258590e-02f, 6.421154208e-02f, -5.034731527e-02f, 4.045017700e-02f, -3.297879801e-02f,
+    2.711778768e-02f, -2.239555039e-02f, 1.851998271e-02f, -1.529973521e-02f, 1.260324832e-02f, -1.033603654e-02f, 8.427445566e-03f, -6.822624690e-03f,
+    5.477513200e-03f, -4.355640218e-03f, 3.426051519e-03f, -2.661954504e-03f, 2.039828734e-03f, -1.538840813e-03f, 1.140457923e-03f, -8.281891706e-04f,
+    5.874065915e-04f, -4.052129409e-04f, 2.703339718e-04f, -1.730204793e-04f, 1.049508823e-04f, -5.912916967e-05f, 2.977601230e-05f, -1.221299773e-05f,
+  },
+  {
+    -1.283942343e-05f, 3.087836827e-05f, -6.091259379e-05f, 1.076728696e-04f, -1.769972470e-04f, 2.759466087e-04f, -4.129132996e-04f, 5.977229689e-04f,
+    -8.417319408e-04f, 1.157925457e-03f, -1.561026244e-03f, 2.067628450e-03f, -2.696379669e-03f, 3.468244560e-03f, -4.406899110e-03f, 5.539327752e-03f,
+    -6.896731165e-03f, 8.515909415e-03f, -1.044137877e-02f, 1.272864107e-02f, -1.544931006e-02f, 1.869932953e-02f, -2.261255236e-02f, 2.738408153e-02f,
+    -3.331247362e-02f, 4.088113511e-02f, -5.092892353e-02f, 6.504930411e-02f, -8.667793068e-02f, 1.248130935e-01f, -2.128373322e-01f, 6.635285075e-01f,
+    6.077894114e-01f, -2.066024717e-01f, 1.225325843e-01f, -8.548830472e-02f, 6.431033161e-02f, -5.041986677e-02f, 4.050609478e-02f, -3.302323284e-02f,
+    2.715379911e-02f, -2.242510244e-02f, 1.854441688e-02f, -1.532001612e-02f, 1.262010027e-02f, -1.035002361e-02f, 8.439020646e-03f, -6.832160510e-03f,
+    5.485322544e-03f, -4.361989406e-03f, 3.431169602e-03f, -2.666039689e-03f, 2.043052994e-03f, -1.541353311e-03f, 1.142387655e-03f, -8.296471108e-04f,
+    5.884875158e-04f, -4.059970452e-04f, 2.708883635e-04f, -1.734005842e-04f, 1.052017890e-04f, -5.928691889e-05f, 2.986883021e-05f, -1.226246498e-05f,
+  },
+  {
+    -1.280572732e-05f, 3.082483823e-05f, -6.083357541e-05f, 1.075624024e-04f, -1.768493882e-04f, 2.757558497e-04f, -4.126750731e-04f, 5.974342387e-04f,
+    -8.413918601e-04f, 1.157536074e-03f, -1.560593222e-03f, 2.067161763e-03f, -2.695894215e-03f, 3.467760617e-03f, -4.406442534e-03f, 5.538929770e-03f,
+    -6.896427548e-03f, 8.515738686e-03f, -1.044137891e-02f, 1.272884377e-02f, -1.544973081e-02f, 1.869995042e-02f, -2.261329133e-02f, 2.738473503e-02f,
+    -3.331260385e-02f, 4.087983169e-02f, -5.092425159e-02f, 6.503685996e-02f, -8.664634913e-02f, 1.247258198e-01f, -2.125131626e-01f, 6.596250975e-01f,
+    6.118430325e-01f, -2.071659416e-01f, 1.227699096e-01f, -8.562603991e-02f, 6.440306115e-02f, -5.048764504e-02f, 4.055816765e-02f, -3.306452807e-02f,
+    2.718722651e-02f, -2.245251931e-02f, 1.856708495e-02f, -1.533883798e-02f, 1.263575048e-02f, -1.036302540e-02f, 8.449792708e-03f, -6.841046571e-03f,
+    5.492610569e-03f, -4.367924368e-03f, 3.435962159e-03f, -2.669872216e-03f, 2.046083884e-03f, -1.543720140e-03f, 1.144209612e-03f, -8.310269450e-04f,
+    5.895131779e-04f, -4.067431432e-04f, 2.714174974e-04f, -1.737646058e-04f, 1.054430092e-04f, -5.943926949e-05f, 2.995898019e-05f, -1.231088376e-05f,
+  },
+  {
+    -1.277082849e-05f, 3.076836914e-05f, -6.074872043e-05f, 1.074415812e-04f, -1.766844726e-04f, 2.755384615e-04f, -4.123969622e-04f, 5.970877346e-04f,
+    -8.409703824e-04f, 1.157034680e-03f, -1.560009160e-03f, 2.066494987e-03f, -2.695147799e-03f, 3.466940989e-03f, -4.405559413e-03f, 5.537995640e-03f,
+    -6.895456423e-03f, 8.514743787e-03f, -1.044036862e-02f, 1.272781484e-02f, -1.544865688e-02f, 1.869876253e-02f, -2.261184349e-02f, 2.738274113e-02f,
+    -3.330951502e-02f, 4.087458060e-02f, -5.091466747e-02f, 6.501815534e-02f, -8.660646451e-02f, 1.246267397e-01f, -2.121698912e-01f, 6.557088233e-01f,
+    6.158864184e-01f, -2.077117195e-01f, 1.229959768e-01f, -8.575576264e-02f, 6.448971193e-02f, -5.055063672e-02f, 4.060638555e-02f, -3.310267582e-02f,
+    2.721806354e-02f, -2.247779583e-02f, 1.858798262e-02f, -1.535619720e-02f, 1.265019596e-02f, -1.037503941e-02f, 8.459759664e-03f, -6.849281136e-03f,
+    5.499375837e-03f, -4.373443921e-03f, 3.440428223e-03f, -2.673451302e-03f, 2.048920775e-03f, -1.545940805e-03f, 1.145923410e-03f, -8.323283764e-04f,
+    5.904833539e-04f, -4.074510694e-04f, 2.719212540e-04f, -1.741124605e-04f, 1.056744864e-04f, -5.958618505e-05f, 3.004644014e-05f, -1.235824181e-05f,
+  },
+  {
+    -1.273473835e-05f, 3.070898053e-05f, -6.065805972e-05f, 1.073104523e-04f, -1.765025663e-04f, 2.752945354e-04f, -4.120790900e-04f, 5.966836185e-04f,
+    -8.404677163e-04f, 1.156421539e-03f, -1.559274388e-03f, 2.065628527e-03f, -2.694140913e-03f, 3.465786269e-03f, -4.404250455e-03f, 5.536526200e-03f,
+    -6.893818781e-03f, 8.512925879e-03f, -1.043834927e-02f, 1.272555587e-02f, -1.544609016e-02f, 1.869576810e-02f, -2.260821159e-02f, 2.737810322e-02f,
+    -3.330321144e-02f, 4.086538754e-02f, -5.090017914e-02f, 6.499320229e-02f, -8.655829707e-02f, 1.245158939e-01f, -2.118076301e-01f, 6.517799014e-01f,
+    6.199193478e-01f, -2.082396825e-01f, 1.232107351e-01f, -8.587744479e-02f, 6.457026574e-02f, -5.060882889e-02f, 4.065073875e-02f, -3.313766846e-02f,
+    2.724630409e-02f, -2.250092699e-02f, 1.860710576e-02f, -1.537209035e-02f, 1.266343384e-02f, -1.038606323e-02f, 8.468919504e-03f, -6.856862530e-03f,
+    5.505616958e-03f, -4.378546918e-03f, 3.444566858e-03f, -2.676776189e-03f, 2.051563061e-03f, -1.548014824e-03f, 1.147528670e-03f, -8.335511152e-04f,
+    5.913978248e-04f, -4.081206619e-04f, 2.723995166e-04f, -1.744440663e-04f, 1.058961651e-04f, -5.972762960e-05f, 3.013118815e-05f, -1.240452692e-05f,
+  },
+  {
+    -1.269746841e-05f, 3.064669216e-05f, -6.056162461e-05f, 1.071690626e-04f, -1.763037369e-04f, 2.750241652e-04f, -4.117215830e-04f, 5.962220576e-04f,
+    -8.398840778e-04f, 1.155696926e-03f, -1.558389248e-03f, 2.064562807e-03f, -2.692874076e-03f, 3.464297083e-03f, -4.402516409e-03f, 5.534522341e-03f,
+    -6.891515673e-03f, 8.510286203e-03f, -1.043532230e-02f, 1.272206858e-02f, -1.544203270e-02f, 1.869096959e-02f, -2.260239857e-02f, 2.737082493e-02f,
+    -3.329369771e-02f, 4.085225858e-02f, -5.088079505e-02f, 6.496201341e-02f, -8.650186775e-02f, 1.243933238e-01f, -2.114264922e-01f, 6.478385487e-01f,
+    6.239415994e-01f, -2.087497088e-01f, 1.234141348e-01f, -8.599105890e-02f, 6.464470492e-02f, -5.066220905e-02f, 4.069121788e-02f, -3.316949870e-02f,
+    2.727194229e-02f, -2.252190802e-02f, 1.862445042e-02f, -1.538651412e-02f, 1.267546135e-02f, -1.039609455e-02f, 8.477270292e-03f, -6.863789138e-03f,
+    5.511332592e-03f, -4.383232255e-03f, 3.448377158e-03f, -2.679846142e-03f, 2.054010151e-03f, -1.549941729e-03f, 1.149025026e-03f, -8.346948791e-04f,
+    5.922563768e-04f, -4.087517622e-04f, 2.728521702e-04f, -1.747593423e-04f, 1.061079905e-04f, -5.986356760e-05f, 3.021320250e-05f, -1.244972694e-05f,
+  },
+  {
+    -1.265903026e-05f, 3.058152404e-05f, -6.045944693e-05f, 1.070174599e-04f, -1.760880532e-04f, 2.747274472e-04f, -4.113245717e-04f, 5.957032243e-04f,
+    -8.392196908e-04f, 1.154861127e-03f, -1.557354100e-03f, 2.063298270e-03f, -2.691347829e-03f, 3.462474087e-03f, -4.400358063e-03f, 5.531985004e-03f,
+    -6.888548216e-03f, 8.506826077e-03f, -1.043128928e-02f, 1.271735482e-02f, -1.543648666e-02f, 1.868436959e-02f, -2.259440759e-02f, 2.736091015e-02f,
+    -3.328097876e-02f, 4.083520019e-02f, -5.085652409e-02f, 6.492460185e-02f, -8.643719828e-02f, 1.242590718e-01f, -2.110265915e-01f, 6.438849827e-01f,
+    6.279529526e-01f, -2.092416776e-01f, 1.236061267e-01f, -8.609657826e-02f, 6.471301235e-02f, -5.071076517e-02f, 4.072781395e-02f, -3.319815952e-02f,
+    2.729497254e-02f, -2.254073431e-02f, 1.864001281e-02f, -1.539946537e-02f, 1.268627585e-02f, -1.040513115e-02f, 8.484810169e-03f, -6.870059408e-03f,
+    5.516521448e-03f, -4.387498865e-03f, 3.451858248e-03f, -2.682660449e-03f, 2.056261473e-03f, -1.551721065e-03f, 1.150412123e-03f, -8.357593925e-04f,
+    5.930588011e-04f, -4.093442150e-04f, 2.732791024e-04f, -1.750582095e-04f, 1.063099087e-04f, -5.999396395e-05f, 3.029246170e-05f, -1.249382980e-05f,
+  },
+  {
+    -1.261943555e-05f, 3.051349637e-05f, -6.035155901e-05f, 1.068556931e-04f, -1.758555859e-04f, 2.744044798e-04f, -4.108881899e-04f, 5.951272964e-04f,
+    -8.384747864e-04f, 1.153914436e-03f, -1.556169315e-03f, 2.061835379e-03f, -2.689562740e-03f, 3.460317970e-03f, -4.397776246e-03f, 5.528915179e-03f,
+    -6.884917588e-03f, 8.502546898e-03f, -1.042625187e-02f, 1.271141654e-02f, -1.542945438e-02f, 1.867597088e-02f, -2.258424201e-02f, 2.734836301e-02f,
+    -3.326505979e-02f, 4.081421916e-02f, -5.082737560e-02f, 6.488098138e-02f, -8.636431108e-02f, 1.241131813e-01f, -2.106080432e-01f, 6.399194214e-01f,
+    6.319531872e-01f, -2.097154687e-01f, 1.237866631e-01f, -8.619397683e-02f, 6.477517147e-02f, -5.075448566e-02f, 4.076051831e-02f, -3.322364420e-02f,
+    2.731538945e-02f, -2.255740150e-02f, 1.865378929e-02f, -1.541094106e-02f, 1.269587481e-02f, -1.041317091e-02f, 8.491537354e-03f, -6.875671848e-03f,
+    5.521182284e-03f, -4.391345718e-03f, 3.455009284e-03f, -2.685218422e-03f, 2.058316472e-03f, -1.553352391e-03f, 1.151689612e-03f, -8.367443875e-04f,
+    5.938048940e-04f, -4.098978687e-04f, 2.736802029e-04f, -1.753405898e-04f, 1.065018666e-04f, -6.011878402e-05f, 3.036894443e-05f, -1.253682347e-05f,
+  },
+  {
+    -1.257869602e-05f, 3.044262962e-05f, -6.023799361e-05f, 1.066838118e-04f, -1.756064069e-04f, 2.740553639e-04f, -4.104125752e-04f, 5.944944569e-04f,
+    -8.376496033e-04f, 1.152857159e-03f, -1.554835278e-03f, 2.060174613e-03f, -2.687519399e-03f, 3.457829452e-03f, -4.394771829e-03f, 5.525313908e-03f,
+    -6.880625031e-03f, 8.497450140e-03f, -1.042021179e-02f, 1.270425581e-02f, -1.542093831e-02f, 1.866577641e-02f, -2.257190539e-02f, 2.733318790e-02f,
+    -3.324594633e-02f, 4.078932269e-02f, -5.079335937e-02f, 6.483116630e-02f, -8.628322930e-02f, 1.239556967e-01f, -2.101709632e-01f, 6.359420833e-01f,
+    6.359420833e-01f, -2.101709632e-01f, 1.239556967e-01f, -8.628322930e-02f, 6.483116630e-02f, -5.079335937e-02f, 4.078932269e-02f, -3.324594633e-02f,
+    2.733318790e-02f, -2.257190539e-02f, 1.866577641e-02f, -1.542093831e-02f, 1.270425581e-02f, -1.042021179e-02f, 8.497450140e-03f, -6.880625031e-03f,
+    5.525313908e-03f, -4.394771829e-03f, 3.457829452e-03f, -2.687519399e-03f, 2.060174613e-03f, -1.554835278e-03f, 1.152857159e-03f, -8.376496033e-04f,
+    5.944944569e-04f, -4.104125752e-04f, 2.740553639e-04f, -1.756064069e-04f, 1.066838118e-04f, -6.023799361e-05f, 3.044262962e-05f, -1.257869602e-05f,
+  },
+  {
+    -1.253682347e-05f, 3.036894443e-05f, -6.011878402e-05f, 1.065018666e-04f, -1.753405898e-04f, 2.736802029e-04f, -4.098978687e-04f, 5.938048940e-04f,
+    -8.367443875e-04f, 1.151689612e-03f, -1.553352391e-03f, 2.058316472e-03f, -2.685218422e-03f, 3.455009284e-03f, -4.391345718e-03f, 5.521182284e-03f,
+    -6.875671848e-03f, 8.491537354e-03f, -1.041317091e-02f, 1.269587481e-02f, -1.541094106e-02f, 1.865378929e-02f, -2.255740150e-02f, 2.731538945e-02f,
+    -3.322364420e-02f, 4.076051831e-02f, -5.075448566e-02f, 6.477517147e-02f, -8.619397683e-02f, 1.237866631e-01f, -2.097154687e-01f, 6.319531872e-01f,
+    6.399194214e-01f, -2.106080432e-01f, 1.241131813e-01f, -8.636431108e-02f, 6.488098138e-02f, -5.082737560e-02f, 4.081421916e-02f, -3.326505979e-02f,
+    2.734836301e-02f, -2.258424201e-02f, 1.867597088e-02f, -1.542945438e-02f, 1.271141654e-02f, -1.042625187e-02f, 8.502546898e-03f, -6.884917588e-03f,
+    5.528915179e-03f, -4.397776246e-03f, 3.460317970e-03f, -2.689562740e-03f, 2.061835379e-03f, -1.556169315e-03f, 1.153914436e-03f, -8.384747864e-04f,
+    5.951272964e-04f, -4.108881899e-04f, 2.744044798e-04f, -1.758555859e-04f, 1.068556931e-04f, -6.035155901e-05f, 3.051349637e-05f, -1.261943555e-05f,
+  },
+  {
+    -1.249382980e-05f, 3.029246170e-05f, -5.999396395e-05f, 1.063099087e-04f, -1.750582095e-04f, 2.732791024e-04f, -4.093442150e-04f, 5.930588011e-04f,
+    -8.357593925e-04f, 1.150412123e-03f, -1.551721065e-03f, 2.056261473e-03f, -2.682660449e-03f, 3.451858248e-03f, -4.387498865e-03f, 5.516521448e-03f,
+    -6.870059408e-03f, 8.484810169e-03f, -1.040513115e-02f, 1.268627585e-02f, -1.539946537e-02f, 1.864001281e-02f, -2.254073431e-02f, 2.729497254e-02f,
+    -3.319815952e-02f, 4.072781395e-02f, -5.071076517e-02f, 6.471301235e-02f, -8.609657826e-02f, 1.236061267e-01f, -2.092416776e-01f, 6.279529526e-01f,
+    6.438849827e-01f, -2.110265915e-01f, 1.242590718e-01f, -8.643719828e-02f, 6.492460185e-02f, -5.085652409e-02f, 4.083520019e-02f, -3.328097876e-02f,
+    2.736091015e-02f, -2.259440759e-02f, 1.868436959e-02f, -1.543648666e-02f, 1.271735482e-02f, -1.043128928e-02f, 8.506826077e-03f, -6.888548216e-03f,
+    5.531985004e-03f, -4.400358063e-03f, 3.462474087e-03f, -2.691347829e-03f, 2.063298270e-03f, -1.557354100e-03f, 1.154861127e-03f, -8.392196908e-04f,
+    5.957032243e-04f, -4.113245717e-04f, 2.747274472e-04f, -1.760880532e-04f, 1.070174599e-04f, -6.045944693e-05f, 3.058152404e-05f, -1.265903026e-05f,
+  },
+  {
+    -1.244972694e-05f, 3.021320250e-05f, -5.986356760e-05f, 1.061079905e-04f, -1.747593423e-04f, 2.728521702e-04f, -4.087517622e-04f, 5.922563768e-04f,
+    -8.346948791e-04f, 1.149025026e-03f, -1.549941729e-03f, 2.054010151e-03f, -2.679846142e-03f, 3.448377158e-03f, -4.383232255e-03f, 5.511332592e-03f,
+    -6.863789138e-03f, 8.477270292e-03f, -1.039609455e-02f, 1.267546135e-02f, -1.538651412e-02f, 1.862445042e-02f, -2.252190802e-02f, 2.727194229e-02f,
+    -3.316949870e-02f, 4.069121788e-02f, -5.066220905e-02f, 6.464470492e-02f, -8.599105890e-02f, 1.234141348e-01f, -2.087497088e-01f, 6.239415994e-01f,
+    6.478385487e-01f, -2.114264922e-01f, 1.243933238e-01f, -8.650186775e-02f, 6.496201341e-02f, -5.088079505e-02f, 4.085225858e-02f, -3.329369771e-02f,
+    2.737082493e-02f, -2.260239857e-02f, 1.869096959e-02f, -1.544203270e-02f, 1.272206858e-02f, -1.043532230e-02f, 8.510286203e-03f, -6.891515673e-03f,
+    5.534522341e-03f, -4.402516409e-03f, 3.464297083e-03f, -2.692874076e-03f, 2.064562807e-03f, -1.558389248e-03f, 1.155696926e-03f, -8.398840778e-04f,
+    5.962220576e-04f, -4.117215830e-04f, 2.750241652e-04f, -1.763037369e-04f, 1.071690626e-04f, -6.056162461e-05f, 3.064669216e-05f, -1.269746841e-05f,
+  },
+  {
+    -1.240452692e-05f, 3.013118815e-05f, -5.972762960e-05f, 1.058961651e-04f, -1.744440663e-04f, 2.723995166e-04f, -4.081206619e-04f, 5.913978248e-04f,
+    -8.335511152e-04f, 1.147528670e-03f, -1.548014824e-03f, 2.051563061e-03f, -2.676776189e-03f, 3.444566858e-03f, -4.378546918e-03f, 5.505616958e-03f,
+    -6.856862530e-03f, 8.468919504e-03f, -1.038606323e-02f, 1.266343384e-02f, -1.537209035e-02f, 1.860710576e-02f, -2.250092699e-02f, 2.724630409e-02f,
+    -3.313766846e-02f, 4.065073875e-02f, -5.060882889e-02f, 6.457026574e-02f, -8.587744479e-02f, 1.232107351e-01f, -2.082396825e-01f, 6.199193478e-01f,
+    6.517799014e-01f, -2.118076301e-01f, 1.245158939e-01f, -8.655829707e-02f, 6.499320229e-02f, -5.090017914e-02f, 4.086538754e-02f, -3.330321144e-02f,
+    2.737810322e-02f, -2.260821159e-02f, 1.869576810e-02f, -1.544609016e-02f, 1.272555587e-02f, -1.043834927e-02f, 8.512925879e-03f, -6.893818781e-03f,
+    5.536526200e-03f, -4.404250455e-03f, 3.465786269e-03f, -2.694140913e-03f, 2.065628527e-03f, -1.559274388e-03f, 1.156421539e-03f, -8.404677163e-04f,
+    5.966836185e-04f, -4.120790900e-04f, 2.752945354e-04f, -1.765025663e-04f, 1.073104523e-04f, -6.065805972e-05f, 3.070898053e-05f, -1.273473835e-05f,
+  },
+  {
+    -1.235824181e-05f, 3.004644014e-05f, -5.958618505e-05f, 1.056744864e-04f, -1.741124605e-04f, 2.719212540e-04f, -4.074510694e-04f, 5.904833539e-04f,
+    -8.323283764e-04f, 1.145923410e-03f, -1.545940805e-03f, 2.048920775e-03f, -2.673451302e-03f, 3.440428223e-03f, -4.373443921e-03f, 5.499375837e-03f,
+    -6.849281136e-03f, 8.459759664e-03f, -1.037503941e-02f, 1.265019596e-02f, -1.535619720e-02f, 1.858798262e-02f, -2.247779583e-02f, 2.721806354e-02f,
+    -3.310267582e-02f, 4.060638555e-02f, -5.055063672e-02f, 6.448971193e-02f, -8.575576264e-02f, 1.229959768e-01f, -2.077117195e-01f, 6.158864184e-01f,
+    6.557088233e-01f, -2.121698912e-01f, 1.246267397e-01f, -8.660646451e-02f, 6.501815534e-02f, -5.091466747e-02f, 4.087458060e-02f, -3.330951502e-02f,
+    2.738274113e-02f, -2.261184349e-02f, 1.869876253e-02f, -1.544865688e-02f, 1.272781484e-02f, -1.044036862e-02f, 8.514743787e-03f, -6.895456423e-03f,
+    5.537995640e-03f, -4.405559413e-03f, 3.466940989e-03f, -2.695147799e-03f, 2.066494987e-03f, -1.560009160e-03f, 1.157034680e-03f, -8.409703824e-04f,
+    5.970877346e-04f, -4.123969622e-04f, 2.755384615e-04f, -1.766844726e-04f, 1.074415812e-04f, -6.074872043e-05f, 3.076836914e-05f, -1.277082849e-05f,
+  },
+  {
+    -1.231088376e-05f, 2.995898019e-05f, -5.943926949e-05f, 1.054430092e-04f, -1.737646058e-04f, 2.714174974e-04f, -4.067431432e-04f, 5.895131779e-04f,
+    -8.310269450e-04f, 1.144209612e-03f, -1.543720140e-03f, 2.046083884e-03f, -2.669872216e-03f, 3.435962159e-03f, -4.367924368e-03f, 5.492610569e-03f,
+    -6.841046571e-03f, 8.449792708e-03f, -1.036302540e-02f, 1.263575048e-02f, -1.533883798e-02f, 1.856708495e-02f, -2.245251931e-02f, 2.718722651e-02f,
+    -3.306452807e-02f, 4.055816765e-02f, -5.048764504e-02f, 6.440306115e-02f, -8.562603991e-02f, 1.227699096e-01f, -2.071659416e-01f, 6.118430325e-01f,
+    6.596250975e-01f, -2.125131626e-01f, 1.247258198e-01f, -8.664634913e-02f, 6.503685996e-02f, -5.092425159e-02f, 4.087983169e-02f, -3.331260385e-02f,
+    2.738473503e-02f, -2.261329133e-02f, 1.869995042e-02f, -1.544973081e-02f, 1.272884377e-02f, -1.044137891e-02f, 8.515738686e-03f, -6.896427548e-03f,
+    5.538929770e-03f, -4.406442534e-03f, 3.467760617e-03f, -2.695894215e-03f, 2.067161763e-03f, -1.560593222e-03f, 1.157536074e-03f, -8.413918601e-04f,
+    5.974342387e-04f, -4.126750731e-04f, 2.757558497e-04f, -1.768493882e-04f, 1.075624024e-04f, -6.083357541e-05f, 3.082483823e-05f, -1.280572732e-05f,
+  },
+  {
+    -1.226246498e-05f, 2.986883021e-05f, -5.928691889e-05f, 1.052017890e-04f, -1.734005842e-04f, 2.708883635e-04f, -4.059970452e-04f, 5.884875158e-04f,
+    -8.296471108e-04f, 1.142387655e-03f, -1.541353311e-03f, 2.043052994e-03f, -2.666039689e-03f, 3.431169602e-03f, -4.361989406e-03f, 5.485322544e-03f,
+    -6.832160510e-03f, 8.439020646e-03f, -1.035002361e-02f, 1.262010027e-02f, -1.532001612e-02f, 1.854441688e-02f, -2.242510244e-02f, 2.715379911e-02f,
+    -3.302323284e-02f, 4.050609478e-02f, -5.041986677e-02f, 6.431033161e-02f, -8.548830472e-02f, 1.225325843e-01f, -2.066024717e-01f, 6.077894114e-01f,
+    6.635285075e-01f, -2.128373322e-01f, 1.248130935e-01f, -8.667793068e-02f, 6.504930411e-02f, -5.092892353e-02f, 4.088113511e-02f, -3.331247362e-02f,
+    2.738408153e-02f, -2.261255236e-02f, 1.869932953e-02f, -1.544931006e-02f, 1.272864107e-02f, -1.044137877e-02f, 8.515909415e-03f, -6.896731165e-03f,
+    5.539327752e-03f, -4.406899110e-03f, 3.468244560e-03f, -2.696379669e-03f, 2.067628450e-03f, -1.561026244e-03f, 1.157925457e-03f, -8.417319408e-04f,
+    5.977229689e-04f, -4.129132996e-04f, 2.759466087e-04f, -1.769972470e-04f, 1.076728696e-04f, -6.091259379e-05f, 3.087836827e-05f, -1.283942343e-05f,
+  },
+  {
+    -1.221299773e-05f, 2.977601230e-05f, -5.912916967e-05f, 1.049508823e-04f, -1.730204793e-04f, 2.703339718e-04f, -4.052129409e-04f, 5.874065915e-04f,
+    -8.281891706e-04f, 1.140457923e-03f, -1.538840813e-03f, 2.039828734e-03f, -2.661954504e-03f, 3.426051519e-03f, -4.355640218e-03f, 5.477513200e-03f,
+    -6.822624690e-03f, 8.427445566e-03f, -1.033603654e-02f, 1.260324832e-02f, -1.529973521e-02f, 1.851998271e-02f, -2.239555039e-02f, 2.711778768e-02f,
+    -3.297879801e-02f, 4.045017700e-02f, -5.034731527e-02f, 6.421154208e-02f, -8.534258590e-02f, 1.222840525e-01f, -2.060214334e-01f, 6.037257771e-01f,
+    6.674188375e-01f, -2.131422892e-01f, 1.248885214e-01f, -8.670118967e-02f, 6.505547635e-02f, -5.092867579e-02f, 4.087848554e-02f, -3.330912032e-02f,
+    2.738077751e-02f, -2.260962407e-02f, 1.869689776e-02f, -1.544739287e-02f, 1.272720525e-02f, -1.044036693e-02f, 8.515254890e-03f, -6.896366351e-03f,
+    5.539188797e-03f, -4.406928474e-03f, 3.468392256e-03f, -2.696603693e-03f, 2.067894661e-03f, -1.561307911e-03f, 1.158202575e-03f, -8.419904234e-04f,
+    5.979537688e-04f, -4.131115224e-04f, 2.761106495e-04f, -1.771279847e-04f, 1.077729378e-04f, -6.098574523e-05f, 3.092893996e-05f, -1.287190545e-05f,
+  },
+  {
+    -1.216249434e-05f, 2.968054877e-05f, -5.896605868e-05f, 1.046903463e-04f, -1.726243758e-04f, 2.697544436e-04f, -4.043909990e-04f, 5.862706337e-04f,
+    -8.266534284e-04f, 1.138420814e-03f, -1.536183156e-03f, 2.036411747e-03f, -2.657617466e-03f, 3.420608907e-03f, -4.348878027e-03f, 5.469184024e-03f,
+    -6.812440908e-03f, 8.415069628e-03f, -1.032106677e-02f, 1.258519773e-02f, -1.527799895e-02f, 1.849378689e-02f, -2.236386856e-02f, 2.707919881e-02f,
+    -3.293123177e-02f, 4.039042477e-02f, -5.027000433e-02f, 6.410671187e-02f, -8.518891299e-02f, 1.220243666e-01f, -2.054229513e-01f, 5.996523517e-01f,
+    6.712958721e-01f, -2.134279236e-01f, 1.249520649e-01f, -8.671610736e-02f, 6.505536579e-02f, -5.092350129e-02f, 4.087187799e-02f, -3.330254026e-02f,
+    2.737482007e-02f, -2.260450413e-02f, 1.869265320e-02f, -1.544397764e-02f, 1.272453493e-02f, -1.043834222e-02f, 8.513774106e-03f, -6.895332243e-03f,
+    5.538512169e-03f, -4.406529998e-03f, 3.468203177e-03f, -2.696565841e-03f, 2.067960028e-03f, -1.561437921e-03f, 1.158367186e-03f, -8.421671146e-04f,
+    5.981264874e-04f, -4.132696257e-04f, 2.762478858e-04f, -1.772415383e-04f, 1.078625627e-04f, -6.105299987e-05f, 3.097653423e-05f, -1.290316214e-05f,
+  },
+  {
+    -1.211096720e-05f, 2.958246210e-05f, -5.879762316e-05f, 1.044202390e-04f, -1.722123601e-04f, 2.691499027e-04f, -4.035313917e-04f, 5.850798764e-04f,
+    -8.250401950e-04f, 1.136276734e-03f, -1.533380861e-03f, 2.032802695e-03f, -2.653029405e-03f, 3.414842793e-03f, -4.341704093e-03f, 5.460336552e-03f,
+    -6.801611023e-03f, 8.401895069e-03f, -1.030511700e-02f, 1.256595171e-02f, -1.525481120e-02f, 1.846583406e-02f, -2.233006255e-02f, 2.703803933e-02f,
+    -3.288054261e-02f, 4.032684886e-02f, -5.018794821e-02f, 6.399586082e-02f, -8.502731620e-02f, 1.217535801e-01f, -2.048071510e-01f, 5.955693577e-01f,
+    6.751593966e-01f, -2.136941267e-01f, 1.250036863e-01f, -8.672266573e-02f, 6.504896216e-02f, -5.091339344e-02f, 4.086130791e-02f, -3.329273006e-02f,
+    2.736620660e-02f, -2.259719043e-02f, 1.868659410e-02f, -1.543906290e-02f, 1.272062887e-02f, -1.043530356e-02f, 8.511466139e-03f, -6.893628044e-03f,
+    5.537297183e-03f, -4.405703096e-03f, 3.467676823e-03f, -2.696265697e-03f, 2.067824203e-03f, -1.561415988e-03f, 1.158419056e-03f, -8.422618286e-04f,
+    5.982409789e-04f, -4.133874976e-04f, 2.763582333e-04f, -1.773378465e-04f, 1.079417009e-04f, -6.111432837e-05f, 3.102113226e-05f, -1.293318231e-05f,
+  },
+  {
+    -1.205842874e-05f, 2.948177497e-05f, -5.862390082e-05f, 1.041406192e-04f, -1.717845197e-04f, 2.685204747e-04f, -4.026342945e-04f, 5.838345581e-04f,
+    -8.233497885e-04f, 1.134026098e-03f, -1.530434464e-03f, 2.029002257e-03f, -2.648191172e-03f, 3.408754234e-03f, -4.334119716e-03f, 5.450972368e-03f,
+    -6.790136953e-03f, 8.387924201e-03f, -1.028818999e-02f, 1.254551359e-02f, -1.523017593e-02f, 1.843612900e-02f, -2.229413814e-02f, 2.699431632e-02f,
+    -3.282673929e-02f, 4.025946043e-02f, -5.010116156e-02f, 6.387900934e-02f, -8.485782641e-02f, 1.214717472e-01f, -2.041741587e-01f, 5.914770181e-01f,
+    6.790091969e-01f, -2.139407908e-01f, 1.250433491e-01f, -8.672084752e-02f, 6.503625574e-02f, -5.089834612e-02f, 4.084677106e-02f, -3.327968662e-02f,
+    2.735493472e-02f, -2.258768107e-02f, 1.867871890e-02f, -1.543264732e-02f, 1.271548594e-02f, -1.043124999e-02f, 8.508330142e-03f, -6.891253020e-03f,
+    5.535543204e-03f, -4.404447223e-03f, 3.466812729e-03f, -2.695702867e-03f, 2.067486856e-03f, -1.561241840e-03f, 1.158357964e-03f, -8.422743875e-04f,
+    5.982971032e-04f, -4.134650300e-04f, 2.764416106e-04f, -1.774168494e-04f, 1.080103101e-04f, -6.116970189e-05f, 3.106271549e-05f, -1.296195489e-05f,
+  },
+  {
+    -1.200489144e-05f, 2.937851024e-05f, -5.844492973e-05f, 1.038515465e-04f, -1.713409436e-04f, 2.678662878e-04f, -4.016998860e-04f, 5.825349225e-04f,
+    -8.215825337e-04f, 1.131669332e-03f, -1.527344513e-03f, 2.025011131e-03f, -2.643103643e-03f, 3.402344317e-03f, -4.326126233e-03f, 5.441093103e-03f,
+    -6.778020675e-03f, 8.373159410e-03f, -1.027028862e-02f, 1.252388680e-02f, -1.520409728e-02f, 1.840467665e-02f, -2.225610132e-02f, 2.694803709e-02f,
+    -3.276983088e-02f, 4.018827096e-02f, -5.000965950e-02f, 6.375617834e-02f, -8.468047522e-02f, 1.211789231e-01f, -2.035241019e-01f, 5.873755560e-01f,
+    6.828450594e-01f, -2.141678091e-01f, 1.250710176e-01f, -8.671063624e-02f, 6.501723740e-02f, -5.087835364e-02f, 4.082826362e-02f, -3.326340717e-02f,
+    2.734100230e-02f, -2.257597435e-02f, 1.866902619e-02f, -1.542472973e-02f, 1.270910512e-02f, -1.042618061e-02f, 8.504365348e-03f, -6.888206502e-03f,
+    5.533249649e-03f, -4.402761875e-03f, 3.465610464e-03f, -2.694876981e-03f, 2.066947677e-03f, -1.560915219e-03f, 1.158183699e-03f, -8.422046211e-04f,
+    5.982947255e-04f, -4.135021184e-04f, 2.764979385e-04f, -1.774784890e-04f, 1.080683489e-04f, -6.121909212e-05f, 3.110126557e-05f, -1.298946888e-05f,
+  },
+  {
+    -1.195036786e-05f, 2.927269095e-05f, -5.826074841e-05f, 1.035530813e-04f, -1.708817221e-04f, 2.671874720e-04f, -4.007283484e-04f, 5.811812179e-04f,
+    -8.197387624e-04f, 1.129206872e-03f, -1.524111570e-03f, 2.020830031e-03f, -2.637767716e-03f, 3.395614159e-03f, -4.317725019e-03f, 5.430700438e-03f,
+    -6.765264229e-03f, 8.357603154e-03f, -1.025141584e-02f, 1.250107489e-02f, -1.517657949e-02f, 1.837148215e-02f, -2.221595827e-02f, 2.689920917e-02f,
+    -3.270982673e-02f, 4.011329230e-02f, -4.991345755e-02f, 6.362738929e-02f, -8.449529486e-02f, 1.208751636e-01f, -2.028571086e-01f, 5.832651949e-01f,
+    6.866667711e-01f, -2.143750762e-01f, 1.250866572e-01f, -8.669201614e-02f, 6.499189859e-02f, -5.085341082e-02f, 4.080578214e-02f, -3.324388925e-02f,
+    2.732440749e-02f, -2.256206879e-02f, 1.865751477e-02f, -1.541530908e-02f, 1.270148551e-02f, -1.042009465e-02f, 8.499571070e-03f, -6.884487886e-03f,
+    5.530415989e-03f, -4.400646589e-03f, 3.464069625e-03f, -2.693787696e-03f, 2.066206375e-03f, -1.560435881e-03f, 1.157896060e-03f, -8.420523668e-04f,
+    5.982337165e-04f, -4.134986620e-04f, 2.765271406e-04f, -1.775227084e-04f, 1.081157766e-04f, -6.126247126e-05f, 3.113676445e-05f, -1.301571336e-05f,
+  },
+  {
+    -1.189487057e-05f, 2.916434030e-05f, -5.807139575e-05f, 1.032452847e-04f, -1.704069467e-04f, 2.664841596e-04f, -3.997198669e-04f, 5.797736976e-04f,
+    -8.178188132e-04f, 1.126639160e-03f, -1.520736209e-03f, 2.016459689e-03f, -2.632184311e-03f, 3.388564906e-03f, -4.308917486e-03f, 5.419796100e-03f,
+    -6.751869712e-03f, 8.341257968e-03f, -1.023157469e-02f, 1.247708152e-02f, -1.514762695e-02f, 1.833655077e-02f, -2.217371538e-02f, 2.684784035e-02f,
+    -3.264673646e-02f, 4.003453664e-02f, -4.981257166e-02f, 6.349266419e-02f, -8.430231828e-02f, 1.205605256e-01f, -2.021733077e-01f, 5.791461585e-01f,
+    6.904741199e-01f, -2.145624876e-01f, 1.250902342e-01f, -8.666497221e-02f, 6.496023137e-02f, -5.082351291e-02f, 4.077932352e-02f, -3.322113071e-02f,
+    2.730514867e-02f, -2.254596313e-02f, 1.864418358e-02f, -1.540438450e-02f, 1.269262635e-02f, -1.041299143e-02f, 8.493946701e-03f, -6.880096630e-03f,
+    5.527041745e-03f, -4.398100944e-03f, 3.462189845e-03f, -2.692434694e-03f, 2.065262678e-03f, -1.559803597e-03f, 1.157494857e-03f, -8.418174700e-04f,
+    5.981139526e-04f, -4.134545641e-04f, 2.765291428e-04f, -1.775494528e-04f, 1.081525539e-04f, -6.129981204e-05f, 3.116919428e-05f, -1.304067752e-05f,
+  },
+  {
+    -1.183841222e-05f, 2.905348170e-05f, -5.787691105e-05f, 1.029282185e-04f, -1.699167103e-04f, 2.657564849e-04f, -3.986746301e-04f, 5.783126194e-04f,
+    -8.158230316e-04f, 1.123966653e-03f, -1.517219018e-03f, 2.011900854e-03f, -2.626354372e-03f, 3.381197732e-03f, -4.299705085e-03f, 5.408381863e-03f,
+    -6.737839280e-03f, 8.324126458e-03f, -1.021076832e-02f, 1.245191046e-02f, -1.511724419e-02f, 1.829988794e-02f, -2.212937922e-02f, 2.679393866e-02f,
+    -3.258057001e-02f, 3.995201654e-02f, -4.970701824e-02f, 6.335202556e-02f, -8.410157905e-02f, 1.202350669e-01f, -2.014728292e-01f, 5.750186708e-01f,
+    6.942668940e-01f, -2.147299400e-01f, 1.250817159e-01f, -8.662949023e-02f, 6.492222836e-02f, -5.078865565e-02f, 4.074888507e-02f, -3.319512968e-02f,
+    2.728322449e-02f, -2.252765631e-02f, 1.862903174e-02f, -1.539195524e-02f, 1.268252698e-02f, -1.040487036e-02f, 8.487491712e-03f, -6.875032260e-03f,
+    5.523126489e-03f, -4.395124558e-03f, 3.459970787e-03f, -2.690817682e-03f, 2.064116334e-03f, -1.559018154e-03f, 1.156979911e-03f, -8.414997839e-04f,
+    5.979353156e-04f, -4.133697315e-04f, 2.765038735e-04f, -1.775586687e-04f, 1.081786420e-04f, -6.133108774e-05f, 3.119853752e-05f, -1.306435065e-05f,
+  },
+  {
+    -1.178100550e-05f, 2.894013869e-05f, -5.767733399e-05f, 1.026019454e-04f, -1.694111072e-04f, 2.650045844e-04f, -3.975928296e-04f, 5.767982461e-04f,
+    -8.137517698e-04f, 1.121189813e-03f, -1.513560596e-03f, 2.007154293e-03f, -2.620278866e-03f, 3.373513843e-03f, -4.290089304e-03f, 5.396459550e-03f,
+    -6.723175149e-03f, 8.306211303e-03f, -1.018899995e-02f, 1.242556559e-02f, -1.508543587e-02f, 1.826149927e-02f, -2.208295657e-02f, 2.673751235e-02f,
+    -3.251133757e-02f, 3.986574486e-02f, -4.959681407e-02f, 6.320549645e-02f, -8.389311144e-02f, 1.198988458e-01f, -2.007558035e-01f, 5.708829562e-01f,
+    6.980448825e-01f, -2.148773312e-01f, 1.250610708e-01f, -8.658555672e-02f, 6.487788279e-02f, -5.074883523e-02f, 4.071446447e-02f, -3.316588464e-02f,
+    2.725863385e-02f, -2.250714747e-02f, 1.861205858e-02f, -1.537802068e-02f, 1.267118686e-02f, -1.039573094e-02f, 8.480205656e-03f, -6.869294366e-03f,
+    5.518669847e-03f, -4.391717093e-03f, 3.457412149e-03f, -2.688936392e-03f, 2.062767110e-03f, -1.558079352e-03f, 1.156351054e-03f, -8.410991695e-04f,
+    5.976976928e-04f, -4.132440750e-04f, 2.764512638e-04f, -1.775503042e-04f, 1.081940034e-04f, -6.135627214e-05f, 3.122477684e-05f, -1.308672212e-05f,
+  },
+  {
+    -1.172266312e-05f, 2.882433500e-05f, -5.747270466e-05f, 1.022665288e-04f, -1.688902327e-04f, 2.642285964e-04f, -3.964746604e-04f, 5.752308450e-04f,
+    -8.116053867e-04f, 1.118309114e-03f, -1.509761558e-03f, 2.002220789e-03f, -2.613958780e-03f, 3.365514473e-03f, -4.280071666e-03f, 5.384031029e-03f,
+    -6.707879594e-03f, 8.287515257e-03f, -1.016627289e-02f, 1.239805088e-02f, -1.505220676e-02f, 1.822139052e-02f, -2.203445438e-02f, 2.667856990e-02f,
+    -3.243904963e-02f, 3.977573484e-02f, -4.948197640e-02f, 6.305310042e-02f, -8.367695036e-02f, 1.195519217e-01f, -2.000223623e-01f, 5.667392391e-01f,
+    7.018078751e-01f, -2.150045602e-01f, 1.250282683e-01f, -8.653315899e-02f, 6.482718848e-02f, -5.070404832e-02f, 4.067605977e-02f, -3.313339435e-02f,
+    2.723137590e-02f, -2.248443599e-02f, 1.859326356e-02f, -1.536258039e-02f, 1.265860557e-02f, -1.038557280e-02f, 8.472088166e-03f, -6.862882601e-03f,
+    5.513671496e-03f, -4.387878252e-03f, 3.454513659e-03f, -2.686790582e-03f, 2.061214793e-03f, -1.556987006e-03f, 1.155608130e-03f, -8.406154956e-04f,
+    5.974009772e-04f, -4.130775092e-04f, 2.763712472e-04f, -1.775243093e-04f, 1.081986015e-04f, -6.137533959e-05f, 3.124789521e-05f, -1.310778140e-05f,
+  },
+  {
+    -1.166339785e-05f, 2.870609453e-05f, -5.726306350e-05f, 1.019220327e-04f, -1.683541836e-04f, 2.634286617e-04f, -3.953203204e-04f, 5.736106880e-04f,
+    -8.093842478e-04f, 1.115325037e-03f, -1.505822528e-03f, 1.997101142e-03f, -2.607395126e-03f, 3.357200883e-03f, -4.269653735e-03f, 5.371098214e-03f,
+    -6.691954946e-03f, 8.268041142e-03f, -1.014259057e-02f, 1.236937044e-02f, -1.501756180e-02f, 1.817956762e-02f, -2.198387981e-02f, 2.661712004e-02f,
+    -3.236371696e-02f, 3.968200006e-02f, -4.936252287e-02f, 6.289486158e-02f, -8.345313137e-02f, 1.191943547e-01f, -1.992726378e-01f, 5.625877443e-01f,
+    7.055556621e-01f, -2.151115270e-01f, 1.249832786e-01f, -8.647228510e-02f, 6.477013983e-02f, -5.065429207e-02f, 4.063366942e-02f, -3.309765791e-02f,
+    2.720145005e-02f, -2.245952144e-02f, 1.857264633e-02f, -1.534563404e-02f, 1.264478282e-02f, -1.037439564e-02f, 8.463138955e-03f, -6.855796685e-03f,
+    5.508131167e-03f, -4.383607778e-03f, 3.451275081e-03f, -2.684380035e-03f, 2.059459188e-03f, -1.555740945e-03f, 1.154750992e-03f, -8.400486393e-04f,
+    5.970450675e-04f, -4.128699525e-04f, 2.762637600e-04f, -1.774806354e-04f, 1.081924006e-04f, -6.138826498e-05f, 3.126787586e-05f, -1.312751808e-05f,
+  },
+  {
+    -1.160322251e-05f, 2.858544131e-05f, -5.704845133e-05f, 1.015685219e-04f, -1.678030579e-04f, 2.626049227e-04f, -3.941300109e-04f, 5.719380518e-04f,
+    -8.070887254e-04f, 1.112238074e-03f, -1.501744146e-03f, 1.991796170e-03f, -2.600588936e-03f, 3.348574365e-03f, -4.258837107e-03f, 5.357663069e-03f,
+    -6.675403597e-03f, 8.247791856e-03f, -1.011795646e-02f, 1.233952847e-02f, -1.498150603e-02f, 1.813603663e-02f, -2.193124021e-02f, 2.655317172e-02f,
+    -3.228535060e-02f, 3.958455441e-02f, -4.923847154e-02f, 6.273080453e-02f, -8.322169069e-02f, 1.188262059e-01f, -1.985067629e-01f, 5.584286967e-01f,
+    7.092880347e-01f, -2.151981328e-01f, 1.249260733e-01f, -8.640292387e-02f, 6.470673185e-02f, -5.059956409e-02f, 4.058729222e-02f, -3.305867471e-02f,
+    2.716885598e-02f, -2.243240360e-02f, 1.855020674e-02f, -1.532718148e-02f, 1.262971843e-02f, -1.036219926e-02f, 8.453357816e-03f, -6.848036403e-03f,
+    5.502048641e-03f, -4.378905458e-03f, 3.447696209e-03f, -2.681704560e-03f, 2.057500121e-03f, -1.554341015e-03f, 1.153779504e-03f, -8.393984852e-04f,
+    5.966298679e-04f, -4.126213274e-04f, 2.761287408e-04f, -1.774192355e-04f, 1.081753660e-04f, -6.139502375e-05f, 3.128470226e-05f, -1.314592182e-05f,
+  },
+  {
+    -1.154214994e-05f, 2.846239955e-05f, -5.682890935e-05f, 1.012060621e-04f, -1.672369547e-04f, 2.617575240e-04f, -3.929039360e-04f, 5.702132176e-04f,
+    -8.047191982e-04f, 1.109048726e-03f, -1.497527061e-03f, 1.986306706e-03f, -2.593541267e-03f, 3.339636239e-03f, -4.247623418e-03f, 5.343727601e-03f,
+    -6.658227996e-03f, 8.226770367e-03f, -1.009237415e-02f, 1.230852928e-02f, -1.494404464e-02f, 1.809080381e-02f, -2.187654312e-02f, 2.648673411e-02f,
+    -3.220396189e-02f, 3.948341216e-02f, -4.910984090e-02f, 6.256095438e-02f, -8.298266519e-02f, 1.184475369e-01f, -1.977248717e-01f, 5.542623215e-01f,
+    7.130047846e-01f, -2.152642802e-01f, 1.248566248e-01f, -8.632506493e-02f, 6.463696014e-02f, -5.053986246e-02f, 4.053692739e-02f, -3.301644446e-02f,
+    2.713359362e-02f, -2.240308249e-02f, 1.852594479e-02f, -1.530722268e-02f, 1.261341234e-02f, -1.034898358e-02f, 8.442744623e-03f, -6.839601604e-03f,
+    5.495423754e-03f, -4.373771119e-03f, 3.443776871e-03f, -2.678763991e-03f, 2.055337437e-03f, -1.552787075e-03f, 1.152693542e-03f, -8.386649262e-04f,
+    5.961552882e-04f, -4.123315601e-04f, 2.759661309e-04f, -1.773400644e-04f, 1.081474641e-04f, -6.139559189e-05f, 3.129835820e-05f, -1.316298241e-05f,
+  },
+  {
+    -1.148019303e-05f, 2.833699361e-05f, -5.660447910e-05f, 1.008347193e-04f, -1.666559745e-04f, 2.608866121e-04f, -3.916423031e-04f, 5.684364711e-04f,
+    -8.022760514e-04f, 1.105757501e-03f, -1.493171937e-03f, 1.980633601e-03f, -2.586253193e-03f, 3.330387853e-03f, -4.236014340e-03f, 5.329293863e-03f,
+    -6.640430646e-03f, 8.204979713e-03f, -1.006584730e-02f, 1.227637729e-02f, -1.490518294e-02f, 1.804387554e-02f, -2.181979627e-02f, 2.641781664e-02f,
+    -3.211956242e-02f, 3.937858789e-02f, -4.897664983e-02f, 6.238533678e-02f, -8.273609237e-02f, 1.180584105e-01f, -1.969270986e-01f, 5.500888438e-01f,
+    7.167057045e-01f, -2.153098725e-01f, 1.247749065e-01f, -8.623869866e-02f, 6.456082090e-02f, -5.047518575e-02f, 4.048257450e-02f, -3.297096718e-02f,
+    2.709566314e-02f, -2.237155832e-02f, 1.849986066e-02f, -1.528575777e-02f, 1.259586462e-02f, -1.033474859e-02f, 8.431299332e-03f, -6.830492205e-03f,
+    5.488256392e-03f, -4.368204630e-03f, 3.439516929e-03f, -2.675558188e-03f, 2.052971001e-03f, -1.551078999e-03f, 1.151492993e-03f, -8.378478630e-04f,
+    5.956212440e-04f, -4.120005807e-04f, 2.757758744e-04f, -1.772430787e-04f, 1.081086623e-04f, -6.138994594e-05f, 3.130882770e-05f, -1.317868974e-05f,
+  },
+  {
+    -1.141736469e-05f, 2.820924799e-05f, -5.637520249e-05f, 1.004545605e-04f, -1.660602190e-04f, 2.599923357e-04f, -3.903453224e-04f, 5.666081025e-04f,
+    -7.997596767e-04f, 1.102364920e-03f, -1.488679450e-03f, 1.974777722e-03f, -2.578725815e-03f, 3.320830583e-03f, -4.224011577e-03f, 5.314363955e-03f,
+    -6.622014112e-03f, 8.182423005e-03f, -1.003837969e-02f, 1.224307702e-02f, -1.486492636e-02f, 1.799525837e-02f, -2.176100758e-02f, 2.634642895e-02f,
+    -3.203216408e-02f, 3.927009651e-02f, -4.883891763e-02f, 6.220397786e-02f, -8.248201036e-02f, 1.176588898e-01f, -1.961135791e-01f, 5.459084893e-01f,
+    7.203905876e-01f, -2.153348147e-01f, 1.246808931e-01f, -8.614381621e-02f, 6.447831093e-02f, -5.040553298e-02f, 4.042423352e-02f, -3.292224321e-02f,
+    2.705506499e-02f, -2.233783151e-02f, 1.847195471e-02f, -1.526278703e-02f, 1.257707546e-02f, -1.031949441e-02f, 8.419021977e-03f, -6.820708186e-03f,
+    5.480546496e-03f, -4.362205905e-03f, 3.434916276e-03f, -2.672087036e-03f, 2.050400699e-03f, -1.549216677e-03f, 1.150177755e-03f, -8.369472046e-04f,
+    5.950276567e-04f, -4.116283234e-04f, 2.755579177e-04f, -1.771282363e-04f, 1.080589288e-04f, -6.137806303e-05f, 3.131609508e-05f, -1.319303379e-05f,
+  },
+  {
+    -1.135367788e-05f, 2.807918734e-05f, -5.614112179e-05f, 1.000656534e-04f, -1.654497909e-04f, 2.590748450e-04f, -3.890132073e-04f, 5.647284066e-04f,
+    -7.971704723e-04f, 1.098871509e-03f, -1.484050287e-03f, 1.968739952e-03f, -2.570960251e-03f, 3.310965833e-03f, -4.211616875e-03f, 5.298940022e-03f,
+    -6.602981013e-03f, 8.159103422e-03f, -1.000997514e-02f, 1.220863309e-02f, -1.482328049e-02f, 1.794495902e-02f, -2.170018515e-02f, 2.627258089e-02f,
+    -3.194177901e-02f, 3.915795328e-02f, -4.869666401e-02f, 6.201690425e-02f, -8.222045794e-02f, 1.172490391e-01f, -1.952844493e-01f, 5.417214835e-01f,
+    7.240592280e-01f, -2.153390127e-01f, 1.245745600e-01f, -8.604040954e-02f, 6.438942762e-02f, -5.033090366e-02f, 4.036190479e-02f, -3.287027319e-02f,
+    2.701179988e-02f, -2.230190271e-02f, 1.844222749e-02f, -1.523831087e-02f, 1.255704515e-02f, -1.030322123e-02f, 8.405912675e-03f, -6.810249594e-03f,
+    5.472294058e-03f, -4.355774895e-03f, 3.429974839e-03f, -2.668350448e-03f, 2.047626434e-03f, -1.547200012e-03f, 1.148747736e-03f, -8.359628677e-04f,
+    5.943744531e-04f, -4.112147261e-04f, 2.753122102e-04f, -1.769954970e-04f, 1.079982330e-04f, -6.135992084e-05f, 3.132014495e-05f, -1.320600468e-05f,
+  },
+  {
+    -1.128914558e-05f, 2.794683647e-05f, -5.590227958e-05f, 9.966806613e-05f, -1.648247944e-04f, 2.581342926e-04f, -3.876461742e-04f, 5.627976823e-04f,
+    -7.945088426e-04f, 1.095277806e-03f, -1.479285148e-03f, 1.962521192e-03f, -2.562957645e-03f, 3.300795036e-03f, -4.198832012e-03f, 5.283024252e-03f,
+    -6.583334024e-03f, 8.135024214e-03f, -9.980637591e-03f, 1.217305026e-02f, -1.478025101e-02f, 1.789298435e-02f, -2.163733728e-02f, 2.619628256e-02f,
+    -3.184841965e-02f, 3.904217379e-02f, -4.854990908e-02f, 6.182414312e-02f, -8.195147451e-02f, 1.168289233e-01f, -1.944398461e-01f, 5.375280521e-01f,
+    7.277114205e-01f, -2.153223736e-01f, 1.244558840e-01f, -8.592847137e-02f, 6.429416898e-02f, -5.025129778e-02f, 4.029558906e-02f, -3.281505809e-02f,
+    2.696586876e-02f, -2.226377277e-02f, 1.841067970e-02f, -1.521232986e-02f, 1.253577413e-02f, -1.028592936e-02f, 8.391971623e-03f, -6.799116541e-03f,
+    5.463499124e-03f, -4.348911597e-03f, 3.424692579e-03f, -2.664348360e-03f, 2.044648130e-03f, -1.545028924e-03f, 1.147202856e-03f, -8.348947773e-04f,
+    5.936615661e-04f, -4.107597311e-04f, 2.750387035e-04f, -1.768448224e-04f, 1.079265455e-04f, -6.133549763e-05f, 3.132096218e-05f, -1.321759260e-05f,
+  },
+  {
+    -1.122378080e-05f, 2.781222030e-05f, -5.565871882e-05f, 9.926186770e-05f, -1.641853345e-04f, 2.571708326e-04f, -3.862444423e-04f, 5.608162332e-04f,
+    -7.917751984e-04f, 1.091584354e-03f, -1.474384745e-03f, 1.956122356e-03f, -2.554719158e-03f, 3.290319651e-03f, -4.185658800e-03f, 5.266618881e-03f,
+    -6.563075878e-03f, 8.110188702e-03f, -9.950371053e-03f, 1.213633334e-02f, -1.473584376e-02f, 1.783934137e-02f, -2.157247244e-02f, 2.611754428e-02f,
+    -3.175209869e-02f, 3.892277395e-02f, -4.839867336e-02f, 6.162572208e-02f, -8.167510007e-02f, 1.163986081e-01f, -1.935799070e-01f, 5.333284210e-01f,
+    7.313469607e-01f, -2.152848058e-01f, 1.243248425e-01f, -8.580799520e-02f, 6.419253360e-02f, -5.016671580e-02f, 4.022528744e-02f, -3.275659917e-02f,
+    2.691727285e-02f, -2.222344278e-02f, 1.837731224e-02f, -1.518484471e-02f, 1.251326294e-02f, -1.026761920e-02f, 8.377199101e-03f, -6.787309206e-03f,
+    5.454161792e-03f, -4.341616048e-03f, 3.419069489e-03f, -2.660080736e-03f, 2.041465732e-03f, -1.542703347e-03f, 1.145543047e-03f, -8.337428666e-04f,
+    5.928889342e-04f, -4.102632841e-04f, 2.747373523e-04f, -1.766761756e-04f, 1.078438375e-04f, -6.130477224e-05f, 3.131853194e-05f, -1.322778790e-05f,
+  },
+  {
+    -1.115759659e-05f, 2.767536391e-05f, -5.541048278e-05f, 9.884712769e-05f, -1.635315176e-04f, 2.561846214e-04f, -3.848082337e-04f, 5.587843672e-04f,
+    -7.889699567e-04f, 1.087791709e-03f, -1.469349803e-03f, 1.949544377e-03f, -2.546245975e-03f, 3.279541165e-03f, -4.172099090e-03f, 5.249726188e-03f,
+    -6.542209361e-03f, 8.084600273e-03f, -9.919179626e-03f, 1.209848730e-02f, -1.469006468e-02f, 1.778403725e-02f, -2.150559930e-02f, 2.603637658e-02f,
+    -3.165282910e-02f, 3.879976999e-02f, -4.824297776e-02f, 6.142166929e-02f, -8.139137527e-02f, 1.159581599e-01f, -1.927047704e-01f, 5.291228161e-01f,
+    7.349656451e-01f, -2.152262188e-01f, 1.241814145e-01f, -8.567897535e-02f, 6.408452069e-02f, -5.007715865e-02f, 4.015100144e-02f, -3.269489804e-02f,
+    2.686601363e-02f, -2.218091400e-02f, 1.834212617e-02f, -1.515585629e-02f, 1.248951225e-02f, -1.024829124e-02f, 8.361595468e-03f, -6.774827831e-03f,
+    5.444282215e-03f, -4.333888329e-03f, 3.413105596e-03f, -2.655547564e-03f, 2.038079203e-03f, -1.540223229e-03f, 1.143768251e-03f, -8.325070768e-04f,
+    5.920565016e-04f, -4.097253353e-04f, 2.744081138e-04f, -1.764895216e-04f, 1.077500815e-04f, -6.126772407e-05f, 3.131283968e-05f, -1.323658100e-05f,
+  },
+  {
+    -1.109060600e-05f, 2.753629250e-05f, -5.515761505e-05f, 9.842391635e-05f, -1.628634513e-04f, 2.551758169e-04f, -3.833377735e-04f, 5.567023962e-04f,
+    -7.860935406e-04f, 1.083900434e-03f, -1.464181056e-03f, 1.942788203e-03f, -2.537539300e-03f, 3.268461094e-03f, -4.158154766e-03f, 5.232348495e-03f,
+    -6.520737318e-03f, 8.058262385e-03f, -9.887067494e-03f, 1.205951716e-02f, -1.464291984e-02f, 1.772707931e-02f, -2.143672671e-02f, 2.595279023e-02f,
+    -3.155062410e-02f, 3.867317849e-02f, -4.808284360e-02f, 6.121201335e-02f, -8.110034136e-02f, 1.155076460e-01f, -1.918145752e-01f, 5.249114636e-01f,
+    7.385672709e-01f, -2.151465235e-01f, 1.240255796e-01f, -8.554140689e-02f, 6.397013007e-02f, -4.998262774e-02f, 4.007273293e-02f, -3.262995660e-02f,
+    2.681209283e-02f, -2.213618793e-02f, 1.830512275e-02f, -1.512536559e-02f, 1.246452285e-02f, -1.022794610e-02f, 8.345161166e-03f, -6.761672728e-03f,
+    5.433860595e-03f, -4.325728561e-03f, 3.406800960e-03f, -2.650748859e-03f, 2.034488528e-03f, -1.537588536e-03f, 1.141878421e-03f, -8.311873571e-04f,
+    5.911642184e-04f, -4.091458386e-04f, 2.740509476e-04f, -1.762848268e-04f, 1.076452511e-04f, -6.122433313e-05f, 3.130387117e-05f, -1.324396246e-05f,
+  },
+  {
+    -1.102282213e-05f, 2.739503140e-05f, -5.490015956e-05f, 9.799230456e-05f, -1.621812440e-04f, 2.541445790e-04f, -3.818332897e-04f, 5.545706368e-04f,
+    -7.831463795e-04f, 1.079911099e-03f, -1.458879253e-03f, 1.935854797e-03f, -2.528600361e-03f, 3.257080978e-03f, -4.143827746e-03f, 5.214488169e-03f,
+    -6.498662645e-03f, 8.031178565e-03f, -9.854038927e-03f, 1.201942809e-02f, -1.459441547e-02f, 1.766847502e-02f, -2.136586369e-02f, 2.586679620e-02f,
+    -3.144549721e-02f, 3.854301632e-02f, -4.791829256e-02f, 6.099678339e-02f, -8.080204017e-02f, 1.150471344e-01f, -1.909094611e-01f, 5.206945895e-01f,
+    7.421516362e-01f, -2.150456320e-01f, 1.238573187e-01f, -8.539528571e-02f, 6.384936215e-02f, -4.988312498e-02f, 3.999048419e-02f, -3.256177706e-02f,
+    2.675551245e-02f, -2.208926630e-02f, 1.826630339e-02f, -1.509337377e-02f, 1.243829565e-02f, -1.020658447e-02f, 8.327896715e-03f, -6.747844271e-03f,
+    5.422897192e-03f, -4.317136909e-03f, 3.400155675e-03f, -2.645684663e-03f, 2.030693711e-03f, -1.534799246e-03f, 1.139873521e-03f, -8.297836652e-04f,
+    5.902120405e-04f, -4.085247521e-04f, 2.736658165e-04f, -1.760620597e-04f, 1.075293208e-04f, -6.117458002e-05f, 3.129161243e-05f, -1.324992295e-05f,
+  },
+  {
+    -1.095425810e-05f, 2.725160608e-05f, -5.463816054e-05f, 9.755236381e-05f, -1.614850055e-04f, 2.530910695e-04f, -3.802950131e-04f, 5.523894095e-04f,
+    -7.801289089e-04f, 1.075824285e-03f, -1.453445153e-03f, 1.928745138e-03f, -2.519430403e-03f, 3.245402386e-03f, -4.129119984e-03f, 5.196147622e-03f,
+    -6.475988297e-03f, 8.003352404e-03f, -9.820098274e-03f, 1.197822534e-02f, -1.454455786e-02f, 1.760823201e-02f, -2.129301946e-02f, 2.577840571e-02f,
+    -3.133746218e-02f, 3.840930071e-02f, -4.774934676e-02f, 6.077600899e-02f, -8.049651418e-02f, 1.145766936e-01f, -1.899895685e-01f, 5.164724199e-01f,
+    7.457185399e-01f, -2.149234575e-01f, 1.236766138e-01f, -8.524060846e-02f, 6.372221796e-02f, -4.977865274e-02f, 3.990425788e-02f, -3.249036197e-02f,
+    2.669627475e-02f, -2.204015103e-02f, 1.822566970e-02f, -1.505988214e-02f, 1.241083167e-02f, -1.018420714e-02f, 8.309802721e-03f, -6.733342903e-03f,
+    5.411392315e-03f, -4.308113581e-03f, 3.393169867e-03f, -2.640355042e-03f, 2.026694775e-03f, -1.531855355e-03f, 1.137753529e-03f, -8.282959669e-04f,
+    5.891999296e-04f, -4.078620378e-04f, 2.732526856e-04f, -1.758211903e-04f, 1.074022661e-04f, -6.111844591e-05f, 3.127604982e-05f, -1.325445327e-05f,
+  },
+  {
+    -1.088492703e-05f, 2.710604210e-05f, -5.437166253e-05f, 9.710416624e-05f, -1.607748467e-04f, 2.520154518e-04f, -3.787231772e-04f, 5.501590391e-04f,
+    -7.770415701e-04f, 1.071640579e-03f, -1.447879526e-03f, 1.921460223e-03f, -2.510030693e-03f, 3.233426913e-03f, -4.114033466e-03f, 5.177329308e-03f,
+    -6.452717279e-03f, 7.974787566e-03f, -9.785249972e-03f, 1.193591425e-02f, -1.449335349e-02f, 1.754635805e-02f, -2.121820340e-02f, 2.568763016e-02f,
+    -3.122653305e-02f, 3.827204918e-02f, -4.757602868e-02f, 6.054972023e-02f, -8.018380643e-02f, 1.140963932e-01f, -1.890550385e-01f, 5.122451811e-01f,
+    7.492677817e-01f, -2.147799145e-01f, 1.234834478e-01f, -8.507737264e-02f, 6.358869912e-02f, -4.966921386e-02f, 3.981405704e-02f, -3.241571416e-02f,
+    2.663438222e-02f, -2.198884425e-02f, 1.818322346e-02f, -1.502489213e-02f, 1.238213208e-02f, -1.016081503e-02f, 8.290879869e-03f, -6.718169132e-03f,
+    5.399346329e-03f, -4.298658825e-03f, 3.385843696e-03f, -2.634760090e-03f, 2.022491763e-03f, -1.528756871e-03f, 1.135518430e-03f, -8.267242359e-04f,
+    5.881278533e-04f, -4.071576619e-04f, 2.728115229e-04f, -1.755621905e-04f, 1.072640639e-04f, -6.105591260e-05f, 3.125716998e-05f, -1.325754433e-05f,
+  },
+  {
+    -1.081484207e-05f, 2.695836518e-05f, -5.410071039e-05f, 9.664778458e-05f, -1.600508793e-04f, 2.509178912e-04f, -3.771180182e-04f, 5.478798545e-04f,
+    -7.738848107e-04f, 1.067360580e-03f, -1.442183155e-03f, 1.914001060e-03f, -2.500402520e-03f, 3.221156180e-03f, -4.098570215e-03f, 5.158035723e-03f,
+    -6.428852653e-03f, 7.945487776e-03f, -9.749498537e-03f, 1.189250029e-02f, -1.444080892e-02f, 1.748286107e-02f, -2.114142510e-02f, 2.559448119e-02f,
+    -3.111272410e-02f, 3.813127957e-02f, -4.739836120e-02f, 6.031794766e-02f, -7.986396056e-02f, 1.136063034e-01f, -1.881060127e-01f, 5.080130994e-01f,
+    7.527991625e-01f, -2.146149190e-01f, 1.232778048e-01f, -8.490557648e-02f, 6.344880788e-02f, -4.955481167e-02f, 3.971988511e-02f, -3.233783681e-02f,
+    2.656983766e-02f, -2.193534833e-02f, 1.813896662e-02f, -1.498840534e-02f, 1.235219815e-02f, -1.013640912e-02f, 8.271128924e-03f, -6.702323530e-03f,
+    5.386759650e-03f, -4.288772932e-03f, 3.378177357e-03f, -2.628899925e-03f, 2.018084742e-03f, -1.525503820e-03f, 1.133168224e-03f, -8.250684546e-04f,
+    5.869957851e-04f, -4.064115945e-04f, 2.723422992e-04f, -1.752850337e-04f, 1.071146918e-04f, -6.098696248e-05f, 3.123495984e-05f, -1.325918717e-05f,
+  },
+  {
+    -1.074401641e-05f, 2.680860113e-05f, -5.382534927e-05f, 9.618329215e-05f, -1.593132165e-04f, 2.497985547e-04f, -3.754797754e-04f, 5.455521887e-04f,
+    -7.706590839e-04f, 1.062984891e-03f, -1.436356833e-03f, 1.906368676e-03f, -2.490547190e-03f, 3.208591836e-03f, -4.082732285e-03f, 5.138269408e-03f,
+    -6.404397533e-03f, 7.915456831e-03f, -9.712848569e-03f, 1.184798900e-02f, -1.438693084e-02f, 1.741774912e-02f, -2.106269430e-02f, 2.549897066e-02f,
+    -3.099604989e-02f, 3.798701004e-02f, -4.721636756e-02f, 6.008072230e-02f, -7.953702082e-02f, 1.131064949e-01f, -1.871426335e-01f, 5.037764010e-01f,
+    7.563124836e-01f, -2.144283880e-01f, 1.230596700e-01f, -8.472521906e-02f, 6.330254709e-02f, -4.943544999e-02f, 3.962174590e-02f, -3.225673339e-02f,
+    2.650264409e-02f, -2.187966583e-02f, 1.809290132e-02f, -1.495042351e-02f, 1.232103126e-02f, -1.011099052e-02f, 8.250550735e-03f, -6.685806739e-03f,
+    5.373632749e-03f, -4.278456238e-03f, 3.370171076e-03f, -2.622774692e-03f, 2.013473793e-03f, -1.522096241e-03f, 1.130702921e-03f, -8.233286134e-04f,
+    5.858037042e-04f, -4.056238098e-04f, 2.718449877e-04f, -1.749896954e-04f, 1.069541286e-04f, -6.091157853e-05f, 3.120940668e-05f, -1.325937294e-05f,
+  },
+  {
+    -1.067246322e-05f, 2.665677587e-05f, -5.354562459e-05f, 9.571076290e-05f, -1.585619721e-04f, 2.486576113e-04f, -3.738086905e-04f, 5.431763788e-04f,
+    -7.673648488e-04f, 1.058514126e-03f, -1.430401367e-03f, 1.898564111e-03f, -2.480466032e-03f, 3.195735555e-03f, -4.066521766e-03f, 5.118032944e-03f,
+    -6.379355087e-03f, 7.884698590e-03f, -9.675304749e-03f, 1.180238604e-02f, -1.433172608e-02f, 1.735103042e-02f, -2.098202093e-02f, 2.540111061e-02f,
+    -3.087652522e-02f, 3.783925907e-02f, -4.703007141e-02f, 5.983807564e-02f, -7.920303200e-02f, 1.125970393e-01f, -1.861650438e-01f, 4.995353120e-01f,
+    7.598075476e-01f, -2.142202398e-01f, 1.228290296e-01f, -8.453630023e-02f, 6.314992021e-02f, -4.931113311e-02f, 3.951964361e-02f, -3.217240770e-02f,
+    2.643280481e-02f, -2.182179954e-02f, 1.804502987e-02f, -1.491094853e-02f, 1.228863295e-02f, -1.008456042e-02f, 8.229146232e-03f, -6.668619465e-03f,
+    5.359966150e-03f, -4.267709119e-03f, 3.361825115e-03f, -2.616384563e-03f, 2.008659021e-03f, -1.518534190e-03f, 1.128122540e-03f, -8.215047110e-04f,
+    5.845515959e-04f, -4.047942863e-04f, 2.713195647e-04f, -1.746761526e-04f, 1.067823542e-04f, -6.082974437e-05f, 3.118049804e-05f, -1.325809294e-05f,
+  },
+  {
+    -1.060019570e-05f, 2.650291545e-05f, -5.326158208e-05f, 9.523027131e-05f, -1.577972613e-04f, 2.474952313e-04f, -3.721050080e-04f, 5.407527659e-04f,
+    -7.640025706e-04f, 1.053948906e-03f, -1.424317571e-03f, 1.890588421e-03f, -2.470160393e-03f, 3.182589036e-03f, -4.049940778e-03f, 5.097328956e-03f,
+    -6.353728536e-03f, 7.853216980e-03f, -9.636871837e-03f, 1.175569717e-02f, -1.427520155e-02f, 1.728271334e-02f, -2.089941508e-02f, 2.530091334e-02f,
+    -3.075416515e-02f, 3.768804543e-02f, -4.683949677e-02f, 5.959003964e-02f, -7.886203949e-02f, 1.120780091e-01f, -1.851733872e-01f, 4.952900589e-01f,
+    7.632841577e-01f, -2.139903941e-01f, 1.225858709e-01f, -8.433882067e-02f, 6.299093130e-02f, -4.918186579e-02f, 3.941358283e-02f, -3.208486385e-02f,
+    2.636032336e-02f, -2.176175247e-02f, 1.799535476e-02f, -1.486998244e-02f, 1.225500484e-02f, -1.005712013e-02f, 8.206916426e-03f, -6.650762481e-03f,
+    5.345760428e-03f, -4.256531994e-03f, 3.353139767e-03f, -2.609729736e-03f, 2.003640551e-03f, -1.514817737e-03f, 1.125427116e-03f, -8.195967543e-04f,
+    5.832394513e-04f, -4.039230064e-04f, 2.707660091e-04f, -1.743443841e-04f, 1.065993495e-04f, -6.074144421e-05f, 3.114822180e-05f, -1.325533857e-05f,
+  },
+  {
+    -1.052722706e-05f, 2.634704600e-05f, -5.297326775e-05f, 9.474189246e-05f, -1.570192001e-04f, 2.463115869e-04f, -3.703689749e-04f, 5.382816950e-04f,
+    -7.605727199e-04f, 1.049289861e-03f, -1.418106274e-03f, 1.882442677e-03f, -2.459631641e-03f, 3.169154006e-03f, -4.032991477e-03f, 5.076160110e-03f,
+    -6.327521152e-03f, 7.821015992e-03f, -9.597554675e-03f, 1.170792822e-02f, -1.421736433e-02f, 1.721280638e-02f, -2.081488705e-02f, 2.519839132e-02f,
+    -3.062898500e-02f, 3.753338822e-02f, -4.664466802e-02f, 5.933664672e-02f, -7.851408926e-02f, 1.115494770e-01f, -1.841678079e-01f, 4.910408676e-01f,
+    7.667421183e-01f, -2.137387720e-01f, 1.223301823e-01f, -8.413278182e-02f, 6.282558505e-02f, -4.904765330e-02f, 3.930356854e-02f, -3.199410626e-02f,
+    2.628520356e-02f, -2.169952781e-02f, 1.794387865e-02f, -1.482752740e-02f, 1.222014870e-02f, -1.002867103e-02f, 8.183862409e-03f, -6.632236623e-03f,
+    5.331016215e-03f, -4.244925325e-03f, 3.344115361e-03f, -2.602810434e-03f, 1.998418528e-03f, -1.510946969e-03f, 1.122616692e-03f, -8.176047588e-04f,
+    5.818672675e-04f, -4.030099565e-04f, 2.701843025e-04f, -1.739943707e-04f, 1.064050967e-04f, -6.064666289e-05f, 3.111256615e-05f, -1.325110138e-05f,
+  },
+  {
+    -1.045357053e-05f, 2.618919378e-05f, -5.268072788e-05f, 9.424570199e-05f, -1.562279056e-04f, 2.451068521e-04f, -3.686008411e-04f, 5.357635151e-04f,
+    -7.570757732e-04f, 1.044537629e-03f, -1.411768313e-03f, 1.874127966e-03f, -2.448881163e-03f, 3.155432214e-03f, -4.015676050e-03f, 5.054529115e-03f,
+    -6.300736260e-03f, 7.788099681e-03f, -9.557358186e-03f, 1.165908516e-02f, -1.415822159e-02f, 1.714131820e-02f, -2.072844727e-02f, 2.509355726e-02f,
+    -3.050100035e-02f, 3.737530684e-02f, -4.644560994e-02f, 5.907792975e-02f, -7.815922784e-02f, 1.110115168e-01f, -1.831484507e-01f, 4.867879644e-01f,
+    7.701812346e-01f, -2.134652955e-01f, 1.220619535e-01f, -8.391818596e-02f, 6.265388675e-02f, -4.890850136e-02f, 3.918960609e-02f, -3.190013968e-02f,
+    2.620744947e-02f, -2.163512901e-02f, 1.789060439e-02f, -1.478358576e-02f, 1.218406640e-02f, -9.999214635e-03f, 8.159985356e-03f, -6.613042799e-03f,
+    5.315734194e-03f, -4.232889615e-03f, 3.334752258e-03f, -2.595626907e-03f, 1.992993115e-03f, -1.506921985e-03f, 1.119691323e-03f, -8.155287480e-04f,
+    5.804350474e-04f, -4.020551274e-04f, 2.695744294e-04f, -1.736260946e-04f, 1.061995788e-04f, -6.054538586e-05f, 3.107351959e-05f, -1.324537305e-05f,
+  },
+  {
+    -1.037923933e-05f, 2.602938512e-05f, -5.238400899e-05f, 9.374177608e-05f, -1.554234959e-04f, 2.438812023e-04f, -3.668008587e-04f, 5.331985790e-04f,
+    -7.535122124e-04f, 1.039692854e-03f, -1.405304538e-03f, 1.865645386e-03f, -2.437910365e-03f, 3.141425438e-03f, -3.997996718e-03f, 5.032438718e-03f,
+    -6.273377238e-03f, 7.754472170e-03f, -9.516287369e-03f, 1.160917403e-02f, -1.409778061e-02f, 1.706825757e-02f, -2.064010637e-02f, 2.498642405e-02f,
+    -3.037022701e-02f, 3.721382099e-02f, -4.624234765e-02f, 5.881392205e-02f, -7.779750230e-02f, 1.104642029e-01f, -1.821154609e-01f, 4.825315754e-01f,
+    7.736013128e-01f, -2.131698883e-01f, 1.217811749e-01f, -8.369503617e-02f, 6.247584231e-02f, -4.876441618e-02f, 3.907170125e-02f, -3.180296916e-02f,
+    2.612706543e-02f, -2.156855971e-02f, 1.783553501e-02f, -1.473815999e-02f, 1.214675995e-02f, -9.968752533e-03f, 8.135286521e-03f, -6.593181978e-03f,
+    5.299915101e-03f, -4.220425413e-03f, 3.325050853e-03f, -2.588179432e-03f, 1.987364497e-03f, -1.502742904e-03f, 1.116651076e-03f, -8.133687539e-04f,
+    5.789428000e-04f, -4.010585140e-04f, 2.689363770e-04f, -1.732395402e-04f, 1.059827802e-04f, -6.043759923e-05f, 3.103107094e-05f, -1.323814539e-05f,
+  },
+  {
+    -1.030424670e-05f, 2.586764646e-05f, -5.208315792e-05f, 9.323019147e-05f, -1.546060900e-04f, 2.426348147e-04f, -3.649692829e-04f, 5.305872435e-04f,
+    -7.498825252e-04f, 1.034756190e-03f, -1.398715809e-03f, 1.856996053e-03f, -2.426720673e-03f, 3.127135480e-03f, -3.979955731e-03f, 5.009891709e-03f,
+    -6.245447512e-03f, 7.720137640e-03f, -9.474347303e-03f, 1.155820096e-02f, -1.403604880e-02f, 1.699363344e-02f, -2.054987516e-02f, 2.487700481e-02f,
+    -3.023668106e-02f, 3.704895066e-02f, -4.603490667e-02f, 5.854465742e-02f, -7.742896028e-02f, 1.099076101e-01f, -1.810689844e-01f, 4.782719266e-01f,
+    7.770021599e-01f, -2.128524754e-01f, 1.214878384e-01f, -8.346333632e-02f, 6.229145824e-02f, -4.861540447e-02f, 3.894986014e-02f, -3.170260008e-02f,
+    2.604405603e-02f, -2.149982375e-02f, 1.777867369e-02f, -1.469125271e-02f, 1.210823147e-02f, -9.937286421e-03f, 8.109767243e-03f, -6.572655198e-03f,
+    5.283559728e-03f, -4.207533306e-03f, 3.315011575e-03f, -2.580468310e-03f, 1.981532880e-03f, -1.498409855e-03f, 1.113496028e-03f, -8.111248168e-04f,
+    5.773905401e-04f, -4.000201151e-04f, 2.682701353e-04f, -1.728346935e-04f, 1.057546862e-04f, -6.032328969e-05f, 3.098520935e-05f, -1.322941034e-05f,
+  },
+  {
+    -1.022860589e-05f, 2.570400435e-05f, -5.177822171e-05f, 9.271102541e-05f, -1.537758080e-04f, 2.413678681e-04f, -3.631063708e-04f, 5.279298689e-04f,
+    -7.461872047e-04f, 1.029728299e-03f, -1.392002996e-03f, 1.848181096e-03f, -2.415313532e-03f, 3.112564164e-03f, -3.961555376e-03f, 4.986890919e-03f,
+    -6.216950563e-03f, 7.685100339e-03f, -9.431543146e-03f, 1.150617220e-02f, -1.397303369e-02f, 1.691745488e-02f, -2.045776458e-02f, 2.476531284e-02f,
+    -3.010037881e-02f, 3.688071616e-02f, -4.582331284e-02f, 5.827017008e-02f, -7.705364998e-02f, 1.093418142e-01f, -1.800091679e-01f, 4.740092438e-01f,
+    7.803835842e-01f, -2.125129828e-01f, 1.211819368e-01f, -8.322309111e-02f, 6.210074168e-02f, -4.846147339e-02f, 3.882408929e-02f, -3.159903812e-02f,
+    2.595842611e-02f, -2.142892522e-02f, 1.772002383e-02f, -1.464286669e-02f, 1.206848321e-02f, -9.904818098e-03f, 8.083428939e-03f, -6.551463561e-03f,
+    5.266668916e-03f, -4.194213928e-03f, 3.304634886e-03f, -2.572493871e-03f, 1.975498489e-03f, -1.493922987e-03f, 1.110226271e-03f, -8.087969854e-04f,
+    5.757782887e-04f, -3.989399338e-04f, 2.675756971e-04f, -1.724115423e-04f, 1.055152831e-04f, -6.020244460e-05f, 3.093592429e-05f, -1.321915997e-05f,
+  },
+  {
+    -1.015233013e-05f, 2.553848539e-05f, -5.146924768e-05f, 9.218435568e-05f, -1.529327708e-04f, 2.400805427e-04f, -3.612123824e-04f, 5.252268196e-04f,
+    -7.424267494e-04f, 1.024609848e-03f, -1.385166981e-03f, 1.839201659e-03f, -2.403690405e-03f, 3.097713342e-03f, -3.942797966e-03f, 4.963439218e-03f,
+    -6.187889918e-03f, 7.649364578e-03f, -9.387880131e-03f, 1.145309408e-02f, -1.390874292e-02f, 1.683973110e-02f, -2.036378578e-02f, 2.465136168e-02f,
+    -2.996133683e-02f, 3.670913809e-02f, -4.560759240e-02f, 5.799049468e-02f, -7.667162013e-02f, 1.087668916e-01f, -1.789361582e-01f, 4.697437528e-01f,
+    7.837453946e-01f, -2.121513383e-01f, 1.208634639e-01f, -8.297430604e-02f, 6.190370037e-02f, -4.830263062e-02f, 3.869439561e-02f, -3.149228927e-02f,
+    2.587018078e-02f, -2.135586839e-02f, 1.765958897e-02f, -1.459300484e-02f, 1.202751752e-02f, -9.871349458e-03f, 8.056273111e-03f, -6.529608239e-03f,
+    5.249243564e-03f, -4.180467952e-03f, 3.293921282e-03f, -2.564256469e-03f, 1.969261569e-03f, -1.489282462e-03f, 1.106841903e-03f, -8.063853167e-04f,
+    5.741060725e-04f, -3.978179775e-04f, 2.668530580e-04f, -1.719700762e-04f, 1.052645587e-04f, -6.007505195e-05f, 3.088320554e-05f, -1.320738651e-05f,
+  },
+  {
+    -1.007543268e-05f, 2.537111629e-05f, -5.115628338e-05f, 9.165026058e-05f, -1.520771003e-04f, 2.387730205e-04f, -3.592875802e-04f, 5.224784635e-04f,
+    -7.386016633e-04f, 1.019401515e-03f, -1.378208655e-03f, 1.830058899e-03f, -2.391852774e-03f, 3.082584890e-03f, -3.923685849e-03f, 4.939539517e-03f,
+    -6.158269158e-03f, 7.612934727e-03f, -9.343363570e-03f, 1.139897301e-02f, -1.384318425e-02f, 1.676047146e-02f, -2.026795005e-02f, 2.453516504e-02f,
+    -2.981957192e-02f, 3.653423734e-02f, -4.538777194e-02f, 5.770566635e-02f, -7.628292000e-02f, 1.081829190e-01f, -1.778501030e-01f, 4.654756794e-01f,
+    7.870874014e-01f, -2.117674707e-01f, 1.205324149e-01f, -8.271698740e-02f, 6.170034267e-02f, -4.813888427e-02f, 3.856078638e-02f, -3.138235987e-02f,
+    2.577932541e-02f, -2.128065778e-02f, 1.759737284e-02f, -1.454167023e-02f, 1.198533690e-02f, -9.836882498e-03f, 8.028301338e-03f, -6.507090466e-03f,
+    5.231284620e-03f, -4.166296097e-03f, 3.282871294e-03f, -2.555756486e-03f, 1.962822386e-03f, -1.484488458e-03f, 1.103343039e-03f, -8.038898762e-04f,
+    5.723739246e-04f, -3.966542575e-04f, 2.661022165e-04f, -1.715102867e-04f, 1.050025016e-04f, -5.994110036e-05f, 3.082704325e-05f, -1.319408232e-05f,
+  },
+  {
+    -9.997926787e-06f, 2.520192384e-05f, -5.083937662e-05f, 9.110881892e-05f, -1.512089194e-04f, 2.374454850e-04f, -3.573322287e-04f, 5.196851721e-04f,
+    -7.347124556e-04f, 1.014103982e-03f, -1.371128921e-03f, 1.820753987e-03f, -2.379802142e-03f, 3.067180707e-03f, -3.904221404e-03f, 4.915194764e-03f,
+    -6.128091910e-03f, 7.575815222e-03f, -9.297998851e-03f, 1.134381553e-02f, -1.377636553e-02f, 1.667968544e-02f, -2.017026886e-02f, 2.441673683e-02f,
+    -2.967510113e-02f, 3.635603509e-02f, -4.516387839e-02f, 5.741572061e-02f, -7.588759940e-02f, 1.075899743e-01f, -1.767511503e-01f, 4.612052491e-01f,
+    7.904094157e-01f, -2.113613102e-01f, 1.201887860e-01f, -8.245114233e-02f, 6.149067756e-02f, -4.797024299e-02f, 3.842326930e-02f, -3.126925653e-02f,
+    2.568586562e-02f, -2.120329808e-02f, 1.753337935e-02f, -1.448886607e-02f, 1.194194396e-02f, -9.801419311e-03f, 7.999515285e-03f, -6.483911543e-03f,
+    5.212793089e-03f, -4.151699120e-03f, 3.271485484e-03f, -2.546994328e-03f, 1.956181227e-03f, -1.479541167e-03f, 1.099729802e-03f, -8.013107376e-04f,
+    5.705818836e-04f, -3.954487895e-04f, 2.653231737e-04f, -1.710321670e-04f, 1.047291015e-04f, -5.980057910e-05f, 3.076742787e-05f, -1.317923988e-05f,
+  },
+  {
+    -9.919825691e-06f, 2.503093490e-05f, -5.051857542e-05f, 9.056010998e-05f, -1.503283518e-04f, 2.360981210e-04f, -3.553465953e-04f, 5.168473207e-04f,
+    -7.307596409e-04f, 1.008717942e-03f, -1.363928690e-03f, 1.811288111e-03f, -2.367540026e-03f, 3.051502715e-03f, -3.884407040e-03f, 4.890407948e-03f,
+    -6.097361854e-03f, 7.538010556e-03f, -9.251791435e-03f, 1.128762824e-02f, -1.370829476e-02f, 1.659738268e-02f, -2.007075385e-02f, 2.429609118e-02f,
+    -2.952794175e-02f, 3.617455282e-02f, -4.493593905e-02f, 5.712069344e-02f, -7.548570866e-02f, 1.069881355e-01f, -1.756394488e-01f, 4.569326872e-01f,
+    7.937112496e-01f, -2.109327885e-01f, 1.198325745e-01f, -8.217677876e-02f, 6.127471461e-02f, -4.779671586e-02f, 3.828185243e-02f, -3.115298621e-02f,
+    2.558980729e-02f, -2.112379422e-02f, 1.746761259e-02f, -1.443459570e-02f, 1.189734141e-02f, -9.764962093e-03f, 7.969916694e-03f, -6.460072840e-03f,
+    5.193770027e-03f, -4.136677826e-03f, 3.259764449e-03f, -2.537970431e-03f, 1.949338396e-03f, -1.474440798e-03f, 1.096002327e-03f, -7.986479832e-04f,
+    5.687299944e-04f, -3.942015932e-04f, 2.645159337e-04f, -1.705357124e-04f, 1.044443496e-04f, -5.965347809e-05f, 3.070435018e-05f, -1.316285185e-05f,
+  },
+  {
+    -9.841142637e-06f, 2.485817642e-05f, -5.019392803e-05f, 9.000421353e-05f, -1.494355221e-04f, 2.347311150e-04f, -3.533309495e-04f, 5.139652881e-04f,
+    -7.267437389e-04f, 1.003244093e-03f, -1.356608886e-03f, 1.801662467e-03f, -2.355067965e-03f, 3.035552863e-03f, -3.864245195e-03f, 4.865182098e-03f,
+    -6.066082716e-03f, 7.499525287e-03f, -9.204746861e-03f, 1.123041784e-02f, -1.363898002e-02f, 1.651357294e-02f, -1.996941681e-02f, 2.417324241e-02f,
+    -2.937811131e-02f, 3.598981229e-02f, -4.470398155e-02f, 5.682062124e-02f, -7.507729863e-02f, 1.063774814e-01f, -1.745151475e-01f, 4.526582190e-01f,
+    7.969927164e-01f, -2.104818386e-01f, 1.194637787e-01f, -8.189390542e-02f, 6.105246403e-02f, -4.761831247e-02f, 3.813654421e-02f, -3.103355615e-02f,
+    2.549115657e-02f, -2.104215136e-02f, 1.740007682e-02f, -1.437886263e-02f, 1.185153212e-02f, -9.727513136e-03f, 7.939507392e-03f, -6.435575790e-03f,
+    5.174216544e-03f, -4.121233058e-03f, 3.247708821e-03f, -2.528685253e-03f, 1.942294221e-03f, -1.469187576e-03f, 1.092160762e-03f, -7.959017037e-04f,
+    5.668183080e-04f, -3.929126928e-04f, 2.636805035e-04f, -1.700209197e-04f, 1.041482377e-04f, -5.949978790e-05f, 3.063780132e-05f, -1.314491101e-05f,
+  },
+  {
+    -9.761890864e-06f, 2.468367541e-05f, -4.986548293e-05f, 8.944120984e-05f, -1.485305559e-04f, 2.333446551e-04f, -3.512855632e-04f, 5.110394565e-04f,
+    -7.226652745e-04f, 9.976831400e-04f, -1.349170441e-03f, 1.791878270e-03f, -2.342387513e-03f, 3.019333121e-03f, -3.843738341e-03f, 4.839520280e-03f,
+    -6.034258272e-03f, 7.460364028e-03f, -9.156870740e-03f, 1.117219113e-02f, -1.356842951e-02f, 1.642826610e-02f, -1.986626969e-02f, 2.404820502e-02f,
+    -2.922562756e-02f, 3.580183554e-02f, -4.446803389e-02f, 5.651554082e-02f, -7.466242070e-02f, 1.057580917e-01f, -1.733783961e-01f, 4.483820695e-01f,
+    8.002536303e-01f, -2.100083948e-01f, 1.190823982e-01f, -8.160253189e-02f, 6.082393664e-02f, -4.743504288e-02f, 3.798735349e-02f, -3.091097394e-02f,
+    2.538991984e-02f, -2.095837482e-02f, 1.733077647e-02f, -1.432167052e-02f, 1.180451904e-02f, -9.689074834e-03f, 7.908289285e-03f, -6.410421891e-03f,
+    5.154133803e-03f, -4.105365704e-03f, 3.235319262e-03f, -2.519139282e-03f, 1.935049049e-03f, -1.463781740e-03f, 1.088205264e-03f, -7.930719981e-04f,
+    5.648468812e-04f, -3.915821163e-04f, 2.628168926e-04f, -1.694877877e-04f, 1.038407592e-04f, -5.933949975e-05f, 3.056777276e-05f, -1.312541028e-05f,
+  },
+  {
+    -9.682083604e-06f, 2.450745895e-05f, -4.953328880e-05f, 8.887117959e-05f, -1.476135793e-04f, 2.319389304e-04f, -3.492107104e-04f, 5.080702119e-04f,
+    -7.185247775e-04f, 9.920357972e-04f, -1.341614298e-03f, 1.781936746e-03f, -2.329500244e-03f, 3.002845484e-03f, -3.822888975e-03f, 4.813425597e-03f,
+    -6.001892343e-03f, 7.420531457e-03f, -9.108168758e-03f, 1.111295500e-02f, -1.349665155e-02f, 1.634147221e-02f, -1.976132461e-02f, 2.392099372e-02f,
+    -2.907050850e-02f, 3.561064491e-02f, -4.422812438e-02f, 5.620548942e-02f, -7.424112672e-02f, 1.051300462e-01f, -1.722293445e-01f, 4.441044636e-01f,
+    8.034938066e-01f, -2.095123929e-01f, 1.186884337e-01f, -8.130266853e-02f, 6.058914386e-02f, -4.724691764e-02f, 3.783428950e-02f, -3.078524746e-02f,
+    2.528610378e-02f, -2.087247019e-02f, 1.725971616e-02f, -1.426302314e-02f, 1.175630527e-02f, -9.649649677e-03f, 7.876264360e-03f, -6.384612711e-03f,
+    5.133523021e-03f, -4.089076693e-03f, 3.222596471e-03f, -2.509333029e-03f, 1.927603247e-03f, -1.458223544e-03f, 1.084136004e-03f, -7.901589738e-04f,
+    5.628157771e-04f, -3.902098963e-04f, 2.619251138e-04f, -1.689363172e-04f, 1.035219084e-04f, -5.917260553e-05f, 3.049425630e-05f, -1.310434276e-05f,
+  },
+  {
+    -9.601734081e-06f, 2.432955419e-05f, -4.919739455e-05f, 8.829420398e-05f, -1.466847197e-04f, 2.305141319e-04f, -3.471066677e-04f, 5.050579432e-04f,
+    -7.143227830e-04f, 9.863027845e-04f, -1.333941408e-03f, 1.771839133e-03f, -2.316407749e-03f, 2.986091967e-03f, -3.801699630e-03f, 4.786901193e-03f,
+    -5.968988802e-03f, 7.380032308e-03f, -9.058646673e-03f, 1.105271640e-02f, -1.342365457e-02f, 1.625320141e-02f, -1.965459384e-02f, 2.379162340e-02f,
+    -2.891277236e-02f, 3.541626300e-02f, -4.398428170e-02f, 5.589050469e-02f, -7.381346910e-02f, 1.044934257e-01f, -1.710681434e-01f, 4.398256258e-01f,
+    8.067130618e-01f, -2.089937701e-01f, 1.182818871e-01f, -8.099432652e-02f, 6.034809774e-02f, -4.705394777e-02f, 3.767736183e-02f, -3.065638490e-02f,
+    2.517971529e-02f, -2.078444324e-02f, 1.718690068e-02f, -1.420292444e-02f, 1.170689402e-02f, -9.609240258e-03f, 7.843434686e-03f, -6.358149881e-03f,
+    5.112385465e-03f, -4.072366998e-03f, 3.209541180e-03f, -2.499267035e-03f, 1.919957202e-03f, -1.452513258e-03f, 1.079953163e-03f, -7.871627469e-04f,
+    5.607250645e-04f, -3.887960693e-04f, 2.610051824e-04f, -1.683665105e-04f, 1.031916808e-04f, -5.899909776e-05f, 3.041724410e-05f, -1.308170166e-05f,
+  },
+  {
+    -9.520855509e-06f, 2.414998833e-05f, -4.885784926e-05f, 8.771036460e-05f, -1.457441051e-04f, 2.290704517e-04f, -3.449737138e-04f, 5.020030433e-04f,
+    -7.100598309e-04f, 9.804848290e-04f, -1.326152734e-03f, 1.761586685e-03f, -2.303111637e-03f, 2.969074611e-03f, -3.780172862e-03f, 4.759950245e-03f,
+    -5.935551564e-03f, 7.338871373e-03f, -9.008310316e-03f, 1.099148242e-02f, -1.334944708e-02f, 1.616346401e-02f, -1.954608983e-02f, 2.366010917e-02f,
+    -2.875243759e-02f, 3.521871270e-02f, -4.373653484e-02f, 5.557062469e-02f, -7.337950072e-02f, 1.038483114e-01f, -1.698949436e-01f, 4.355457806e-01f,
+    8.099112134e-01f, -2.084524648e-01f, 1.178627612e-01f, -8.067751789e-02f, 6.010081093e-02f, -4.685614476e-02f, 3.751658047e-02f, -3.052439478e-02f,
+    2.507076153e-02f, -2.069429996e-02f, 1.711233499e-02f, -1.414137850e-02f, 1.165628861e-02f, -9.567849265e-03f, 7.809802411e-03f, -6.331035098e-03f,
+    5.090722460e-03f, -4.055237633e-03f, 3.196154153e-03f, -2.488941863e-03f, 1.912111321e-03f, -1.446651169e-03f, 1.075656934e-03f, -7.840834417e-04f,
+    5.585748186e-04f, -3.873406762e-04f, 2.600571167e-04f, -1.677783720e-04f, 1.028500730e-04f, -5.881896966e-05f, 3.033672866e-05f, -1.305748037e-05f,
+  },
+  {
+    -9.439461090e-06f, 2.396878864e-05f, -4.851470224e-05f, 8.711974349e-05f, -1.447918643e-04f, 2.276080834e-04f, -3.428121294e-04f, 4.989059080e-04f,
+    -7.057364659e-04f, 9.745826651e-04f, -1.318249247e-03f, 1.751180667e-03f, -2.289613532e-03f, 2.951795478e-03f, -3.758311260e-03f, 4.732575971e-03f,
+    -5.901584596e-03f, 7.297053505e-03f, -8.957165589e-03f, 1.092926019e-02f, -1.327403772e-02f, 1.607227042e-02f, -1.943582517e-02f, 2.352646628e-02f,
+    -2.858952288e-02f, 3.501801717e-02f, -4.348491316e-02f, 5.524588788e-02f, -7.293927496e-02f, 1.031947851e-01f, -1.687098966e-01f, 4.312651522e-01f,
+    8.130880801e-01f, -2.078884170e-01f, 1.174310601e-01f, -8.035225543e-02f, 5.984729671e-02f, -4.665352061e-02f, 3.735195581e-02f, -3.038928592e-02f,
+    2.495924994e-02f, -2.060204655e-02f, 1.703602424e-02f, -1.407838955e-02f, 1.160449250e-02f, -9.525479486e-03f, 7.775369767e-03f, -6.303270125e-03f,
+    5.068535380e-03f, -4.037689656e-03f, 3.182436188e-03f, -2.478358105e-03f, 1.904066032e-03f, -1.440637576e-03f, 1.071247522e-03f, -7.809211910e-04f,
+    5.563651204e-04f, -3.858437620e-04f, 2.590809379e-04f, -1.671719080e-04f, 1.024970829e-04f, -5.863221510e-05f, 3.025270283e-05f, -1.303167241e-05f,
+  },
+  {
+    -9.357564015e-06f, 2.378598245e-05f, -4.816800297e-05f, 8.652242313e-05f, -1.438281269e-04f, 2.261272220e-04f, -3.406221977e-04f, 4.957669365e-04f,
+    -7.013532376e-04f, 9.685970335e-04f, -1.310231928e-03f, 1.740622357e-03f, -2.275915078e-03f, 2.934256653e-03f, -3.736117441e-03f, 4.704781623e-03f,
+    -5.867091906e-03f, 7.254583611e-03f, -8.905218466e-03f, 1.086605696e-02f, -1.319743525e-02f, 1.597963119e-02f, -1.932381260e-02f, 2.339071021e-02f,
+    -2.842404713e-02f, 3.481419984e-02f, -4.322944631e-02f, 5.491633313e-02f, -7.249284568e-02f, 1.025329291e-01f, -1.675131542e-01f, 4.269839643e-01f,
+    8.162434815e-01f, -2.073015681e-01f, 1.169867891e-01f, -8.001855280e-02f, 5.958756896e-02f, -4.644608777e-02f, 3.718349860e-02f, -3.025106746e-02f,
+    2.484518821e-02f, -2.050768942e-02f, 1.695797373e-02f, -1.401396197e-02f, 1.155150926e-02f, -9.482133808e-03f, 7.740139064e-03f, -6.274856790e-03f,
+    5.045825654e-03f, -4.019724166e-03f, 3.168388119e-03f, -2.467516379e-03f, 1.895821785e-03f, -1.434472797e-03f, 1.066725142e-03f, -7.776761361e-04f,
+    5.540960572e-04f, -3.843053762e-04f, 2.580766699e-04f, -1.665471265e-04f, 1.021327093e-04f, -5.843882862e-05f, 3.016515980e-05f, -1.300427148e-05f,
+  },
+  {
+    -9.275177459e-06f, 2.360159712e-05f, -4.781780112e-05f, 8.591848640e-05f, -1.428530233e-04f, 2.246280637e-04f, -3.384042038e-04f, 4.925865314e-04f,
+    -6.969107005e-04f, 9.625286822e-04f, -1.302101769e-03f, 1.729913048e-03f, -2.262017935e-03f, 2.916460243e-03f, -3.713594050e-03f, 4.676570492e-03f,
+    -5.832077552e-03f, 7.211466658e-03f, -8.852474992e-03f, 1.080188004e-02f, -1.311964850e-02f, 1.588555701e-02f, -1.921006502e-02f, 2.325285660e-02f,
+    -2.825602948e-02f, 3.460728441e-02f, -4.297016428e-02f, 5.458199970e-02f, -7.204026723e-02f, 1.018628265e-01f, -1.663048685e-01f, 4.227024407e-01f,
+    8.193772385e-01f, -2.066918608e-01f, 1.165299545e-01f, -7.967642444e-02f, 5.932164217e-02f, -4.623385917e-02f, 3.701121997e-02f, -3.010974884e-02f,
+    2.472858425e-02f, -2.041123519e-02f, 1.687818896e-02f, -1.394810026e-02f, 1.149734258e-02f, -9.437815217e-03f, 7.704112693e-03f, -6.245796988e-03f,
+    5.022594763e-03f, -4.001342304e-03f, 3.154010810e-03f, -2.456417329e-03f, 1.887379045e-03f, -1.428157163e-03f, 1.062090022e-03f, -7.743484267e-04f,
+    5.517677221e-04f, -3.827255723e-04f, 2.570443397e-04f, -1.659040375e-04f, 1.017569525e-04f, -5.823880543e-05f, 3.007409313e-05f, -1.297527141e-05f,
+  },
+  {
+    -9.192314582e-06f, 2.341566009e-05f, -4.746414654e-05f, 8.530801659e-05f, -1.418666847e-04f, 2.231108062e-04f, -3.361584349e-04f, 4.893650984e-04f,
+    -6.924094136e-04f, 9.563783656e-04f, -1.293859768e-03f, 1.719054042e-03f, -2.247923778e-03f, 2.898408377e-03f, -3.690743761e-03f, 4.647945902e-03f,
+    -5.796545634e-03f, 7.167707668e-03f, -8.798941278e-03f, 1.073673685e-02f, -1.304068642e-02f, 1.579005867e-02f, -1.909459548e-02f, 2.311292129e-02f,
+    -2.808548928e-02f, 3.439729485e-02f, -4.270709740e-02f, 5.424292726e-02f, -7.158159443e-02f, 1.011845606e-01f, -1.650851924e-01f, 4.184208048e-01f,
+    8.224891731e-01f, -2.060592394e-01f, 1.160605638e-01f, -7.932588563e-02f, 5.904953146e-02f, -4.601684825e-02f, 3.683513146e-02f, -2.996533981e-02f,
+    2.460944628e-02f, -2.031269071e-02f, 1.679667560e-02f, -1.388080911e-02f, 1.144199625e-02f, -9.392526795e-03f, 7.667293126e-03f, -6.216092678e-03f,
+    4.998844240e-03f, -3.982545255e-03f, 3.139305161e-03f, -2.445061624e-03f, 1.878738304e-03f, -1.421691022e-03f, 1.057342402e-03f, -7.709382209e-04f,
+    5.493802144e-04f, -3.811044080e-04f, 2.559839769e-04f, -1.652426528e-04f, 1.013698137e-04f, -5.803214143e-05f, 2.997949673e-05f, -1.294466620e-05f,
+  },
+  {
+    -9.108988526e-06f, 2.322819881e-05f, -4.710708925e-05f, 8.469109737e-05f, -1.408692431e-04f, 2.215756482e-04f, -3.338851804e-04f, 4.861030462e-04f,
+    -6.878499406e-04f, 9.501468446e-04f, -1.285506934e-03f, 1.708046655e-03f, -2.233634301e-03f, 2.880103205e-03f, -3.667569275e-03f, 4.618911214e-03f,
+    -5.760500298e-03f, 7.123311718e-03f, -8.744623507e-03f, 1.067063488e-02f, -1.296055808e-02f, 1.569314710e-02f, -1.897741719e-02f, 2.297092029e-02f,
+    -2.791244611e-02f, 3.418425540e-02f, -4.244027629e-02f, 5.389915583e-02f, -7.111688257e-02f, 1.004982155e-01f, -1.638542786e-01f, 4.141392794e-01f,
+    8.255791087e-01f, -2.054036494e-01f, 1.155786257e-01f, -7.896695245e-02f, 5.877125255e-02f, -4.579506889e-02f, 3.665524497e-02f, -2.981785045e-02f,
+    2.448778273e-02f, -2.021206301e-02f, 1.671343948e-02f, -1.381209330e-02f, 1.138547422e-02f, -9.346271723e-03f, 7.629682915e-03f, -6.185745885e-03f,
+    4.974575674e-03f, -3.963334244e-03f, 3.124272103e-03f, -2.433449962e-03f, 1.869900068e-03f, -1.415074735e-03f, 1.052482530e-03f, -7.674456854e-04f,
+    5.469336395e-04f, -3.794419455e-04f, 2.548956143e-04f, -1.645629862e-04f, 1.009712953e-04f, -5.781883318e-05f, 2.988136485e-05f, -1.291245000e-05f,
+  },
+  {
+    -9.025212413e-06f, 2.303924081e-05f, -4.674667943e-05f, 8.406781281e-05f, -1.398608311e-04f, 2.200227900e-04f, -3.315847317e-04f, 4.828007868e-04f,
+    -6.832328498e-04f, 9.438348870e-04f, -1.277044286e-03f, 1.696892217e-03f, -2.219151212e-03f, 2.861546898e-03f, -3.644073321e-03f, 4.589469825e-03f,
+    -5.723945734e-03f, 7.078283941e-03f, -8.689527931e-03f, 1.060358171e-02f, -1.287927263e-02f, 1.559483336e-02f, -1.885854350e-02f, 2.282686980e-02f,
+    -2.773691974e-02f, 3.396819054e-02f, -4.216973191e-02f, 5.355072585e-02f, -7.064618741e-02f, 9.980387581e-02f, -1.626122808e-01f, 4.098580875e-01f,
+    8.286468693e-01f, -2.047250379e-01f, 1.150841499e-01f, -7.859964181e-02f, 5.848682177e-02f, -4.556853546e-02f, 3.647157277e-02f, -2.966729112e-02f,
+    2.436360231e-02f, -2.010935935e-02f, 1.662848662e-02f, -1.374195780e-02f, 1.132778053e-02f, -9.299053282e-03f, 7.591284692e-03f, -6.154758700e-03f,
+    4.949790702e-03f, -3.943710540e-03f, 3.108912603e-03f, -2.421583063e-03f, 1.860864867e-03f, -1.408308681e-03f, 1.047510671e-03f, -7.638709953e-04f,
+    5.444281089e-04f, -3.777382510e-04f, 2.537792874e-04f, -1.638650532e-04f, 1.005614009e-04f, -5.759887793e-05f, 2.977969212e-05f, -1.287861714e-05f,
+  },
+  {
+    -8.940999345e-06f, 2.284881362e-05f, -4.638296744e-05f, 8.343824736e-05f, -1.388415820e-04f, 2.184524328e-04f, -3.292573821e-04f, 4.794587352e-04f,
+    -6.785587139e-04f, 9.374432665e-04f, -1.268472850e-03f, 1.685592067e-03f, -2.204476238e-03f, 2.842741650e-03f, -3.620258656e-03f, 4.559625165e-03f,
+    -5.686886178e-03f, 7.032629526e-03f, -8.633660867e-03f, 1.053558499e-02f, -1.279683932e-02f, 1.549512862e-02f, -1.873798792e-02f, 2.268078618e-02f,
+    -2.755893020e-02f, 3.374912504e-02f, -4.189549553e-02f, 5.319767812e-02f, -7.016956516e-02f, 9.910162657e-02f, -1.613593525e-01f, 4.055774514e-01f,
+    8.316922807e-01f, -2.040233535e-01f, 1.145771475e-01f, -7.822397143e-02f, 5.819625607e-02f, -4.533726280e-02f, 3.628412754e-02f, -2.951367252e-02f,
+    2.423691397e-02f, -2.000458719e-02f, 1.654182320e-02f, -1.367040769e-02f, 1.126891933e-02f, -9.250874846e-03f, 7.552101169e-03f, -6.123133276e-03f,
+    4.924491018e-03f, -3.923675453e-03f, 3.093227660e-03f, -2.409461676e-03f, 1.851633251e-03f, -1.401393253e-03f, 1.042427097e-03f, -7.602143342e-04f,
+    5.418637401e-04f, -3.759933951e-04f, 2.526350345e-04f, -1.631488712e-04f, 1.001401355e-04f, -5.737227362e-05f, 2.967447353e-05f, -1.284316209e-05f,
+  },
+  {
+    -8.856362402e-06f, 2.265694484e-05f, -4.601600377e-05f, 8.280248581e-05f, -1.378116300e-04f, 2.168647794e-04f, -3.269034269e-04f, 4.760773093e-04f,
+    -6.738281100e-04f, 9.309727635e-04f, -1.259793662e-03f, 1.674147558e-03f, -2.189611119e-03f, 2.823689674e-03f, -3.596128063e-03f, 4.529380699e-03f,
+    -5.649325906e-03f, 6.986353714e-03f, -8.577028701e-03f, 1.046665247e-02f, -1.271326751e-02f, 1.539404418e-02f, -1.861576409e-02f, 2.253268599e-02f,
+    -2.737849768e-02f, 3.352708390e-02f, -4.161759871e-02f, 5.284005382e-02f, -6.968707249e-02f, 9.839155338e-02f, -1.600956480e-01f, 4.012975931e-01f,
+    8.347151695e-01f, -2.032985461e-01f, 1.140576306e-01f, -7.783995984e-02f, 5.789957301e-02f, -4.510126624e-02f, 3.609292233e-02f, -2.935700563e-02f,
+    2.410772691e-02f, -1.989775421e-02f, 1.645345557e-02f, -1.359744822e-02f, 1.120889492e-02f, -9.201739892e-03f, 7.512135138e-03f, -6.090871835e-03f,
+    4.898678365e-03f, -3.903230335e-03f, 3.077218305e-03f, -2.397086577e-03f, 1.842205788e-03f, -1.394328859e-03f, 1.037232093e-03f, -7.564758939e-04f,
+    5.392406567e-04f, -3.742074527e-04f, 2.514628971e-04f, -1.624144598e-04f, 9.970750483e-05f, -5.713901886e-05f, 2.956570443e-05f, -1.280607949e-05f,
+  },
+  {
+    -8.771314639e-06f, 2.246366207e-05f, -4.564583908e-05f, 8.216061332e-05f, -1.367711098e-04f, 2.152600334e-04f, -3.245231635e-04f, 4.726569303e-04f,
+    -6.690416198e-04f, 9.244241644e-04f, -1.251007766e-03f, 1.662560055e-03f, -2.174557612e-03f, 2.804393205e-03f, -3.571684351e-03f, 4.498739927e-03f,
+    -5.611269238e-03f, 6.939461801e-03f, -8.519637884e-03f, 1.039679196e-02f, -1.262856666e-02f, 1.529159145e-02f, -1.849188580e-02f, 2.238258596e-02f,
+    -2.719564263e-02f, 3.330209239e-02f, -4.133607335e-02f, 5.247789451e-02f, -6.919876651e-02f, 9.767374236e-02f, -1.588213216e-01f, 3.970187344e-01f,
+    8.377153637e-01f, -2.025505671e-01f, 1.135256123e-01f, -7.744762641e-02f, 5.759679075e-02f, -4.486056158e-02f, 3.589797054e-02f, -2.919730176e-02f,
+    2.397605061e-02f, -1.978886829e-02f, 1.636339028e-02f, -1.352308476e-02f, 1.114771170e-02f, -9.151651989e-03f, 7.471389471e-03f, -6.057976661e-03f,
+    4.872354541e-03f, -3.882376581e-03f, 3.060885606e-03f, -2.384458564e-03f, 1.832583068e-03f, -1.387115924e-03f, 1.031925955e-03f, -7.526558750e-04f,
+    5.365589883e-04f, -3.723805028e-04f, 2.502629192e-04f, -1.616618401e-04f, 9.926351618e-05f, -5.689911297e-05f, 2.945338053e-05f, -1.276736414e-05f,
+  },
+  {
+    -8.685869088e-06f, 2.226899297e-05f, -4.527252415e-05f, 8.151271540e-05f, -1.357201569e-04f, 2.136383999e-04f, -3.221168908e-04f, 4.691980219e-04f,
+    -6.641998291e-04f, 9.177982621e-04f, -1.242116214e-03f, 1.650830932e-03f, -2.159317491e-03f, 2.784854498e-03f, -3.546930358e-03f, 4.467706381e-03f,
+    -5.572720539e-03f, 6.891959134e-03f, -8.461494933e-03f, 1.032601139e-02f, -1.254274633e-02f, 1.518778196e-02f, -1.836636699e-02f, 2.223050298e-02f,
+    -2.701038568e-02f, 3.307417602e-02f, -4.105095162e-02f, 5.211124211e-02f, -6.870470476e-02f, 9.694828011e-02f, -1.575365281e-01f, 3.927410966e-01f,
+    8.406926923e-01f, -2.017793694e-01f, 1.129811072e-01f, -7.704699132e-02f, 5.728792807e-02f, -4.461516508e-02f, 3.569928598e-02f, -2.903457252e-02f,
+    2.384189477e-02f, -1.967793751e-02f, 1.627163403e-02f, -1.344732284e-02f, 1.108537418e-02f, -9.100614806e-03f, 7.429867118e-03f, -6.024450104e-03f,
+    4.845521394e-03f, -3.861115627e-03f, 3.044230660e-03f, -2.371578466e-03f, 1.822765700e-03f, -1.379754888e-03f, 1.026508993e-03f, -7.487544864e-04f,
+    5.338188707e-04f, -3.705126287e-04f, 2.490351479e-04f, -1.608910354e-04f, 9.880817785e-05f, -5.665255595e-05f, 2.933749790e-05f, -1.272701101e-05f,
+  },
+  {
+    -8.600038752e-06f, 2.207296520e-05f, -4.489610992e-05f, 8.085887788e-05f, -1.346589073e-04f, 2.120000849e-04f, -3.196849100e-04f, 4.657010108e-04f,
+    -6.593033280e-04f, 9.110958551e-04f, -1.233120069e-03f, 1.638961578e-03f, -2.143892542e-03f, 2.765075828e-03f, -3.521868946e-03f, 4.436283629e-03f,
+    -5.533684212e-03f, 6.843851116e-03f, -8.402606429e-03f, 1.025431871e-02f, -1.245581616e-02f, 1.508262738e-02f, -1.823922173e-02f, 2.207645411e-02f,
+    -2.682274767e-02f, 3.284336056e-02f, -4.076226600e-02f, 5.174013889e-02f, -6.820494523e-02f, 9.621525374e-02f, -1.562414225e-01f, 3.884649006e-01f,
+    8.436469858e-01f, -2.009849074e-01f, 1.124241307e-01f, -7.663807554e-02f, 5.697300436e-02f, -4.436509348e-02f, 3.549688284e-02f, -2.886882981e-02f,
+    2.370526936e-02f, -1.956497018e-02f, 1.617819368e-02f, -1.337016812e-02f, 1.102188700e-02f, -9.048632109e-03f, 7.387571111e-03f, -5.990294578e-03f,
+    4.818180825e-03f, -3.839448951e-03f, 3.027254600e-03f, -2.358447134e-03f, 1.812754315e-03f, -1.372246203e-03f, 1.020981525e-03f, -7.447719454e-04f,
+    5.310204459e-04f, -3.686039181e-04f, 2.477796334e-04f, -1.601020706e-04f, 9.834149937e-05f, -5.639934850e-05f, 2.921805301e-05f, -1.268501525e-05f,
+  },
+  {
+    -8.513836605e-06f, 2.187560646e-05f, -4.451664745e-05f, 8.019918692e-05f, -1.335874978e-04f, 2.103452957e-04f, -3.172275238e-04f, 4.621663267e-04f,
+    -6.543527108e-04f, 9.043177481e-04f, -1.224020399e-03f, 1.626953391e-03f, -2.128284569e-03f, 2.745059489e-03f, -3.496503002e-03f, 4.404475268e-03f,
+    -5.494164704e-03f, 6.795143198e-03f, -8.342979018e-03f, 1.018172201e-02f, -1.236778591e-02f, 1.497613946e-02f, -1.811046426e-02f, 2.192045661e-02f,
+    -2.663274964e-02f, 3.260967200e-02f, -4.047004927e-02f, 5.136462748e-02f, -6.769954633e-02f, 9.547475081e-02f, -1.549361604e-01f, 3.841903669e-01f,
+    8.465780758e-01f, -2.001671369e-01f, 1.118546996e-01f, -7.622090090e-02f, 5.665203960e-02f, -4.411036400e-02f, 3.529077567e-02f, -2.870008586e-02f,
+    2.356618458e-02f, -1.944997479e-02f, 1.608307629e-02f, -1.329162641e-02f, 1.095725492e-02f, -8.995707759e-03f, 7.344504558e-03f, -5.955512561e-03f,
+    4.790334789e-03f, -3.817378072e-03f, 3.009958589e-03f, -2.345065446e-03f, 1.802549561e-03f, -1.364590341e-03f, 1.015343883e-03f, -7.407084778e-04f,
+    5.281638616e-04f, -3.666544628e-04f, 2.464964285e-04f, -1.592949727e-04f, 9.786349144e-05f, -5.613949200e-05f, 2.909504267e-05f, -1.264137215e-05f,
+  },
+  {
+    -8.427275594e-06f, 2.167694447e-05f, -4.413418793e-05f, 7.953372901e-05f, -1.325060658e-04f, 2.086742406e-04f, -3.147450369e-04f, 4.585944019e-04f,
+    -6.493485757e-04f, 8.974647518e-04f, -1.214818283e-03f, 1.614807781e-03f, -2.112495389e-03f, 2.724807796e-03f, -3.470835441e-03f, 4.372284930e-03f,
+    -5.454166501e-03f, 6.745840883e-03f, -8.282619410e-03f, 1.010822942e-02f, -1.227866541e-02f, 1.486833010e-02f, -1.798010892e-02f, 2.176252786e-02f,
+    -2.644041284e-02f, 3.237313661e-02f, -4.017433451e-02f, 5.098475088e-02f, -6.718856689e-02f, 9.472685939e-02f, -1.536208972e-01f, 3.799177159e-01f,
+    8.494857951e-01f, -1.993260152e-01f, 1.112728318e-01f, -7.579549000e-02f, 5.632505440e-02f, -4.385099432e-02f, 3.508097938e-02f, -2.852835319e-02f,
+    2.342465091e-02f, -1.933296006e-02f, 1.598628908e-02f, -1.321170365e-02f, 1.089148281e-02f, -8.941845714e-03f, 7.300670647e-03f, -5.920106597e-03f,
+    4.761985290e-03f, -3.794904551e-03f, 2.992343828e-03f, -2.331434307e-03f, 1.792152109e-03f, -1.356787787e-03f, 1.009596409e-03f, -7.365643178e-04f,
+    5.252492719e-04f, -3.646643590e-04f, 2.451855889e-04f, -1.584697707e-04f, 9.737416598e-05f, -5.587298856e-05f, 2.896846408e-05f, -1.259607719e-05f,
+  },
+  {
+    -8.340368632e-06f, 2.147700694e-05f, -4.374878264e-05f, 7.886259093e-05f, -1.314147492e-04f, 2.069871290e-04f, -3.122377556e-04f, 4.549856712e-04f,
+    -6.442915252e-04f, 8.905376824e-04f, -1.205514806e-03f, 1.602526170e-03f, -2.096526837e-03f, 2.704323082e-03f, -3.444869202e-03f, 4.339716280e-03f,
+    -5.413694133e-03f, 6.695949727e-03f, -8.221534375e-03f, 1.003384914e-02f, -1.218846461e-02f, 1.475921128e-02f, -1.784817021e-02f, 2.160268545e-02f,
+    -2.624575871e-02f, 3.213378086e-02f, -3.987515507e-02f, 5.060055242e-02f, -6.667206616e-02f, 9.397166798e-02f, -1.522957890e-01f, 3.756471670e-01f,
+    8.523699779e-01f, -1.984615011e-01f, 1.106785464e-01f, -7.536186630e-02f, 5.599206996e-02f, -4.358700259e-02f, 3.486750930e-02f, -2.835364462e-02f,
+    2.328067905e-02f, -1.921393490e-02f, 1.588783942e-02f, -1.313040594e-02f, 1.082457564e-02f, -8.887050028e-03f, 7.256072646e-03f, -5.884079293e-03f,
+    4.733134385e-03f, -3.772029991e-03f, 2.974411546e-03f, -2.317554647e-03f, 1.781562647e-03f, -1.348839041e-03f, 1.003739456e-03f, -7.323397082e-04f,
+    5.222768369e-04f, -3.626337072e-04f, 2.438471735e-04f, -1.576264953e-04f, 9.687353609e-05f, -5.559984095e-05f, 2.883831481e-05f, -1.254912602e-05f,
+  },
+  {
+    -8.253128601e-06f, 2.127582163e-05f, -4.336048303e-05f, 7.818585974e-05f, -1.303136866e-04f, 2.052841713e-04f, -3.097059881e-04f, 4.513405726e-04f,
+    -6.391821655e-04f, 8.835373620e-04f, -1.196111063e-03f, 1.590109987e-03f, -2.080380757e-03f, 2.683607702e-03f, -3.418607246e-03f, 4.306773011e-03f,
+    -5.372752165e-03f, 6.645475333e-03f, -8.159730747e-03f, 9.958589489e-03f, -1.209719353e-02f, 1.464879513e-02f, -1.771466276e-02f, 2.144094710e-02f,
+    -2.604880891e-02f, 3.189163150e-02f, -3.957254460e-02f, 5.021207578e-02f, -6.615010378e-02f, 9.320926555e-02f, -1.509609920e-01f, 3.713789396e-01f,
+    8.552304595e-01f, -1.975735548e-01f, 1.100718635e-01f, -7.492005404e-02f, 5.565310810e-02f, -4.331840744e-02f, 3.465038109e-02f, -2.817597329e-02f,
+    2.313427997e-02f, -1.909290843e-02f, 1.578773488e-02f, -1.304773951e-02f, 1.075653853e-02f, -8.831324850e-03f, 7.210713900e-03f, -5.847433318e-03f,
+    4.703784183e-03f, -3.748756037e-03f, 2.956163007e-03f, -2.303427422e-03f, 1.770781887e-03f, -1.340744619e-03f, 9.977733909e-04f, -7.280348999e-04f,
+    5.192467227e-04f, -3.605626119e-04f, 2.424812437e-04f, -1.567651792e-04f, 9.636161606e-05f, -5.532005269e-05f, 2.870459281e-05f, -1.250051446e-05f,
+  },
+  {
+    -8.165568348e-06f, 2.107341628e-05f, -4.296934060e-05f, 7.750362281e-05f, -1.292030171e-04f, 2.035655790e-04f, -3.071500441e-04f, 4.476595463e-04f,
+    -6.340211070e-04f, 8.764646182e-04f, -1.186608154e-03f, 1.577560678e-03f, -2.064059014e-03f, 2.662664026e-03f, -3.392052564e-03f, 4.273458851e-03f,
+    -5.331345206e-03f, 6.594423354e-03f, -8.097215421e-03f, 9.882458817e-03f, -1.200486228e-02f, 1.453709386e-02f, -1.757960134e-02f, 2.127733072e-02f,
+    -2.584958526e-02f, 3.164671547e-02f, -3.926653702e-02f, 4.981936497e-02f, -6.562273982e-02f, 9.243974151e-02f, -1.496166625e-01f, 3.671132524e-01f,
+    8.580670766e-01f, -1.966621383e-01f, 1.094528046e-01f, -7.447007830e-02f, 5.530819122e-02f, -4.304522796e-02f, 3.442961081e-02f, -2.799535262e-02f,
+    2.298546488e-02f, -1.896988997e-02f, 1.568598319e-02f, -1.296371071e-02f, 1.068737669e-02f, -8.774674425e-03f, 7.164597832e-03f, -5.810171408e-03f,
+    4.673936845e-03f, -3.725084374e-03f, 2.937599507e-03f, -2.289053613e-03f, 1.759810557e-03f, -1.332505051e-03f, 9.916985896e-04f, -7.236501525e-04f,
+    5.161591016e-04f, -3.584511822e-04f, 2.410878643e-04f, -1.558858570e-04f, 9.583842138e-05f, -5.503362797e-05f, 2.856729640e-05f, -1.245023851e-05f,
+  },
+  {
+    -8.077700683e-06f, 2.086981866e-05f, -4.257540698e-05f, 7.681596777e-05f, -1.280828804e-04f, 2.018315646e-04f, -3.045702351e-04f, 4.439430351e-04f,
+    -6.288089637e-04f, 8.693202841e-04f, -1.177007189e-03f, 1.564879693e-03f, -2.047563481e-03f, 2.641494446e-03f, -3.365208165e-03f, 4.239777557e-03f,
+    -5.289477902e-03f, 6.542799494e-03f, -8.033995351e-03f, 9.805465569e-03f, -1.191148109e-02f, 1.442411980e-02f, -1.744300085e-02f, 2.111185435e-02f,
+    -2.564810980e-02f, 3.139905996e-02f, -3.895716654e-02f, 4.942246435e-02f, -6.509003473e-02f, 9.166318572e-02f, -1.482629574e-01f, 3.628503239e-01f,
+    8.608796673e-01f, -1.957272147e-01f, 1.088213922e-01f, -7.401196495e-02f, 5.495734235e-02f, -4.276748370e-02f, 3.420521487e-02f, -2.781179636e-02f,
+    2.283424522e-02f, -1.884488906e-02f, 1.558259223e-02f, -1.287832608e-02f, 1.061709547e-02f, -8.717103094e-03f, 7.117727944e-03f, -5.772296361e-03f,
+    4.643594581e-03f, -3.701016728e-03f, 2.918722377e-03f, -2.274434228e-03f, 1.748649407e-03f, -1.324120884e-03f, 9.855154405e-04f, -7.191857340e-04f,
+    5.130141517e-04f, -3.562995312e-04f, 2.396671026e-04f, -1.549885653e-04f, 9.530396875e-05f, -5.474057171e-05f, 2.842642430e-05f, -1.239829432e-05f,
+  },
+  {
+    -7.989538381e-06f, 2.066505651e-05f, -4.217873389e-05f, 7.612298253e-05f, -1.269534168e-04f, 2.000823415e-04f, -3.019668741e-04f, 4.401914844e-04f,
+    -6.235463534e-04f, 8.621051984e-04f, -1.167309285e-03f, 1.552068497e-03f, -2.030896049e-03f, 2.620101369e-03f, -3.338077087e-03f, 4.205732916e-03f,
+    -5.247154937e-03f, 6.490609502e-03f, -7.970077553e-03f, 9.727618260e-03f, -1.181706026e-02f, 1.430988539e-02f, -1.730487631e-02f, 2.094453622e-02f,
+    -2.544440474e-02f, 3.114869241e-02f, -3.864446762e-02f, 4.902141859e-02f, -6.455204935e-02f, 9.087968845e-02f, -1.469000334e-01f, 3.585903719e-01f,
+    8.636680707e-01f, -1.947687489e-01f, 1.081776499e-01f, -7.354574070e-02f, 5.460058510e-02f, -4.248519468e-02f, 3.397721007e-02f, -2.762531853e-02f,
+    2.268063271e-02f, -1.871791543e-02f, 1.547757008e-02f, -1.279159224e-02f, 1.054570030e-02f, -8.658615290e-03f, 7.070107817e-03f, -5.733811038e-03f,
+    4.612759655e-03f, -3.676554867e-03f, 2.899532978e-03f, -2.259570299e-03f, 1.737299206e-03f, -1.315592679e-03f, 9.792243431e-04f, -7.146419205e-04f,
+    5.098120575e-04f, -3.541077764e-04f, 2.382190290e-04f, -1.540733424e-04f, 9.475827607e-05f, -5.444088951e-05f, 2.828197558e-05f, -1.234467826e-05f,
+  },
+  {
+    -7.901094178e-06f, 2.045915762e-05f, -4.177937314e-05f, 7.542475523e-05f, -1.258147671e-04f, 1.983181242e-04f, -2.993402757e-04f, 4.364053423e-04f,
+    -6.182338975e-04f, 8.548202049e-04f, -1.157515566e-03f, 1.539128563e-03f, -2.014058621e-03f, 2.598487223e-03f, -3.310662389e-03f, 4.171328746e-03f,
+    -5.204381034e-03f, 6.437859176e-03f, -7.905469099e-03f, 9.648925478e-03f, -1.172161016e-02f, 1.419440318e-02f, -1.716524288e-02f, 2.077539469e-02f,
+    -2.523849250e-02f, 3.089564044e-02f, -3.832847503e-02f, 4.861627271e-02f, -6.400884489e-02f, 9.008934040e-02f, -1.455280478e-01f, 3.543336136e-01f,
+    8.664321276e-01f, -1.937867073e-01f, 1.075216028e-01f, -7.307143304e-02f, 5.423794369e-02f, -4.219838139e-02f, 3.374561357e-02f, -2.743593346e-02f,
+    2.252463928e-02f, -1.858897900e-02f, 1.537092496e-02f, -1.270351600e-02f, 1.047319675e-02f, -8.599215545e-03f, 7.021741105e-03f, -5.694718364e-03f,
+    4.581434381e-03f, -3.651700600e-03f, 2.880032704e-03f, -2.244462885e-03f, 1.725760743e-03f, -1.306921013e-03f, 9.728257084e-04f, -7.100189969e-04f,
+    5.065530094e-04f, -3.518760395e-04f, 2.367437167e-04f, -1.531402287e-04f, 9.420136245e-05f, -5.413458772e-05f, 2.813394972e-05f, -1.228938684e-05f,
+  },
+  {
+    -7.812380769e-06f, 2.025214973e-05f, -4.137737663e-05f, 7.472137428e-05f, -1.246670724e-04f, 1.965391280e-04f, -2.966907561e-04f, 4.325850588e-04f,
+    -6.128722213e-04f, 8.474661526e-04f, -1.147627165e-03f, 1.526061375e-03f, -1.997053114e-03f, 2.576654453e-03f, -3.282967152e-03f, 4.136568895e-03f,
+    -5.161160952e-03f, 6.384554361e-03f, -7.840177121e-03f, 9.569395880e-03f, -1.162514129e-02f, 1.407768582e-02f, -1.702411585e-02f, 2.060444828e-02f,
+    -2.503039565e-02f, 3.063993194e-02f, -3.800922377e-02f, 4.820707201e-02f, -6.346048298e-02f, 8.929223267e-02f, -1.441471578e-01f, 3.500802660e-01f,
+    8.691716799e-01f, -1.927810575e-01f, 1.068532768e-01f, -7.258907030e-02f, 5.386944294e-02f, -4.190706478e-02f, 3.351044289e-02f, -2.724365579e-02f,
+    2.236627713e-02f, -1.845808991e-02f, 1.526266527e-02f, -1.261410426e-02f, 1.039959050e-02f, -8.538908481e-03f, 6.972631545e-03f, -5.655021327e-03f,
+    4.549621124e-03f, -3.626455777e-03f, 2.860222982e-03f, -2.229113070e-03f, 1.714034827e-03f, -1.298106476e-03f, 9.663199588e-04f, -7.053172561e-04f,
+    5.032372038e-04f, -3.496044467e-04f, 2.352412420e-04f, -1.521892665e-04f, 9.363324819e-05f, -5.382167338e-05f, 2.798234658e-05f, -1.223241676e-05f,
+  },
+  {
+    -7.723410808e-06f, 2.004406059e-05f, -4.097279632e-05f, 7.401292831e-05f, -1.235104747e-04f, 1.947455692e-04f, -2.940186330e-04f, 4.287310867e-04f,
+    -6.074619534e-04f, 8.400438959e-04f, -1.137645220e-03f, 1.512868426e-03f, -1.979881458e-03f, 2.554605521e-03f, -3.254994482e-03f, 4.101457239e-03f,
+    -5.117499489e-03f, 6.330700948e-03f, -7.774208808e-03f, 9.489038197e-03f, -1.152766419e-02f, 1.395974607e-02f, -1.688151064e-02f, 2.043171568e-02f,
+    -2.482013699e-02f, 3.038159497e-02f, -3.768674912e-02f, 4.779386215e-02f, -6.290702557e-02f, 8.848845677e-02f, -1.427575210e-01f, 3.458305453e-01f,
+    8.718865707e-01f, -1.917517691e-01f, 1.061726991e-01f, -7.209868161e-02f, 5.349510827e-02f, -4.161126626e-02f, 3.327171594e-02f, -2.704850044e-02f,
+    2.220555870e-02f, -1.832525851e-02f, 1.515279957e-02f, -1.252336411e-02f, 1.032488735e-02f, -8.477698816e-03f, 6.922782946e-03f, -5.614722977e-03f,
+    4.517322299e-03f, -3.600822287e-03f, 2.840105272e-03f, -2.213521963e-03f, 1.702122287e-03f, -1.289149675e-03f, 9.597075278e-04f, -7.005369997e-04f,
+    4.998648431e-04f, -3.472931280e-04f, 2.337116838e-04f, -1.512205000e-04f, 9.305395482e-05f, -5.350215425e-05f, 2.782716641e-05f, -1.217376491e-05f,
+  },
+  {
+    -7.634196906e-06f, 1.983491796e-05f, -4.056568425e-05f, 7.329950617e-05f, -1.223451161e-04f, 1.929376648e-04f, -2.913242255e-04f, 4.248438810e-04f,
+    -6.020037259e-04f, 8.325542940e-04f, -1.127570877e-03f, 1.499551221e-03f, -1.962545596e-03f, 2.532342905e-03f, -3.226747507e-03f, 4.065997683e-03f,
+    -5.073401478e-03f, 6.276304873e-03f, -7.707571404e-03f, 9.407861225e-03f, -1.142918951e-02f, 1.384059679e-02f, -1.673744277e-02f, 2.025721570e-02f,
+    -2.460773945e-02f, 3.012065786e-02f, -3.736108662e-02f, 4.737668906e-02f, -6.234853500e-02f, 8.767810459e-02f, -1.413592950e-01f, 3.415846673e-01f,
+    8.745766449e-01f, -1.906988129e-01f, 1.054798981e-01f, -7.160029690e-02f, 5.311496569e-02f, -4.131100770e-02f, 3.302945096e-02f, -2.685048264e-02f,
+    2.204249666e-02f, -1.819049532e-02f, 1.504133659e-02f, -1.243130273e-02f, 1.024909319e-02f, -8.415591361e-03f, 6.872199197e-03f, -5.573826426e-03f,
+    4.484540374e-03f, -3.574802062e-03f, 2.819681065e-03f, -2.197690698e-03f, 1.690023971e-03f, -1.280051233e-03f, 9.529888603e-04f, -6.956785373e-04f,
+    4.964361360e-04f, -3.449422180e-04f, 2.321551244e-04f, -1.502339753e-04f, 9.246350506e-05f, -5.317603880e-05f, 2.766840984e-05f, -1.211342837e-05f,
+  },
+  {
+    -7.544751631e-06f, 1.962474955e-05f, -4.015609254e-05f, 7.258119694e-05f, -1.211711395e-04f, 1.911156328e-04f, -2.886078543e-04f, 4.209238989e-04f,
+    -5.964981745e-04f, 8.249982111e-04f, -1.117405289e-03f, 1.486111270e-03f, -1.945047484e-03f, 2.509869103e-03f, -3.198229377e-03f, 4.030194162e-03f,
+    -5.028871788e-03f, 6.221372118e-03f, -7.640272212e-03f, 9.325873833e-03f, -1.132972800e-02f, 1.372025094e-02f, -1.659192791e-02f, 2.008096732e-02f,
+    -2.439322618e-02f, 2.985714910e-02f, -3.703227206e-02f, 4.695559900e-02f, -6.178507397e-02f, 8.686126843e-02f, -1.399526377e-01f, 3.373428473e-01f,
+    8.772417483e-01f, -1.896221613e-01f, 1.047749035e-01f, -7.109394692e-02f, 5.272904180e-02f, -4.100631142e-02f, 3.278366660e-02f, -2.664961790e-02f,
+    2.187710393e-02f, -1.805381108e-02f, 1.492828523e-02f, -1.233792747e-02f, 1.017221406e-02f, -8.352591020e-03f, 6.820884262e-03f, -5.532334852e-03f,
+    4.451277864e-03f, -3.548397074e-03f, 2.798951885e-03f, -2.181620436e-03f, 1.677740747e-03f, -1.270811785e-03f, 9.461644127e-04f, -6.907421872e-04f,
+    4.929512970e-04f, -3.425518556e-04f, 2.305716484e-04f, -1.492297404e-04f, 9.186192286e-05f, -5.284333624e-05f, 2.750607790e-05f, -1.205140436e-05f,
+  },
+  {
+    -7.455087503e-06f, 1.941358310e-05f, -3.974407335e-05f, 7.185808989e-05f, -1.199886879e-04f, 1.892796922e-04f, -2.858698414e-04f, 4.169715998e-04f,
+    -5.909459379e-04f, 8.173765164e-04f, -1.107149616e-03f, 1.472550098e-03f, -1.927389092e-03f, 2.487186629e-03f, -3.169443262e-03f, 3.994050636e-03f,
+    -4.983915325e-03f, 6.165908709e-03f, -7.572318588e-03f, 9.243084954e-03f, -1.122929045e-02f, 1.359872158e-02f, -1.644498185e-02f, 1.990298966e-02f,
+    -2.417662048e-02f, 2.959109744e-02f, -3.670034149e-02f, 4.653063853e-02f, -6.121670552e-02f, 8.603804092e-02f, -1.385377071e-01f, 3.331052998e-01f,
+    8.798817283e-01f, -1.885217883e-01f, 1.040577458e-01f, -7.057966322e-02f, 5.233736381e-02f, -4.069720021e-02f, 3.253438183e-02f, -2.644592204e-02f,
+    2.170939367e-02f, -1.791521672e-02f, 1.481365454e-02f, -1.224324580e-02f, 1.009425607e-02f, -8.288702791e-03f, 6.768842182e-03f, -5.490251489e-03f,
+    4.417537338e-03f, -3.521609334e-03f, 2.777919288e-03f, -2.165312362e-03f, 1.665273502e-03f, -1.261431982e-03f, 9.392346523e-04f, -6.857282758e-04f,
+    4.894105465e-04f, -3.401221836e-04f, 2.289613439e-04f, -1.482078453e-04f, 9.124923336e-05f, -5.250405647e-05f, 2.734017199e-05f, -1.198769034e-05f,
+  },
+  {
+    -7.365216999e-06f, 1.920144629e-05f, -3.932967891e-05f, 7.113027450e-05f, -1.187979050e-04f, 1.874300624e-04f, -2.831105100e-04f, 4.129874454e-04f,
+    -5.853476583e-04f, 8.096900835e-04f, -1.096805025e-03f, 1.458869235e-03f, -1.909572400e-03f, 2.464298010e-03f, -3.140392355e-03f, 3.957571094e-03f,
+    -4.938537026e-03f, 6.109920715e-03f, -7.503717941e-03f, 9.159503592e-03f, -1.112788778e-02f, 1.347602188e-02f, -1.629662048e-02f, 1.972330199e-02f,
+    -2.395794584e-02f, 2.932253179e-02f, -3.636533119e-02f, 4.610185449e-02f, -6.064349304e-02f, 8.520851509e-02f, -1.371146614e-01f, 3.288722389e-01f,
+    8.824964337e-01f, -1.873976694e-01f, 1.033284570e-01f, -7.005747816e-02f, 5.193995950e-02f, -4.038369732e-02f, 3.228161600e-02f, -2.623941116e-02f,
+    2.153937928e-02f, -1.777472339e-02f, 1.469745375e-02f, -1.214726532e-02f, 1.001522547e-02f, -8.223931761e-03f, 6.716077072e-03f, -5.447579639e-03f,
+    4.383321411e-03f, -3.494440893e-03f, 2.756584861e-03f, -2.148767685e-03f, 1.652623144e-03f, -1.251912493e-03f, 9.322000579e-04f, -6.806371378e-04f,
+    4.858141114e-04f, -3.376533494e-04f, 2.273243014e-04f, -1.471683419e-04f, 9.062546295e-05f, -5.215821013e-05f, 2.717069393e-05f, -1.192228392e-05f,
+  },
+  {
+    -7.275152543e-06f, 1.898836681e-05f, -3.891296148e-05f, 7.039784043e-05f, -1.175989349e-04f, 1.855669639e-04f, -2.803301850e-04f, 4.089718994e-04f,
+    -5.797039812e-04f, 8.019397911e-04f, -1.086372688e-03f, 1.445070223e-03f, -1.891599401e-03f, 2.441205795e-03f, -3.111079872e-03f, 3.920759554e-03f,
+    -4.892741867e-03f, 6.053414249e-03f, -7.434477736e-03f, 9.075138812e-03f, -1.102553094e-02f, 1.335216509e-02f, -1.614685981e-02f, 1.954192370e-02f,
+    -2.373722589e-02f, 2.905148130e-02f, -3.602727771e-02f, 4.566929402e-02f, -6.006550025e-02f, 8.437278431e-02f, -1.356836588e-01f, 3.246438781e-01f,
+    8.850857146e-01f, -1.862497816e-01f, 1.025870702e-01f, -6.952742490e-02f, 5.153685727e-02f, -4.006582644e-02f, 3.202538883e-02f, -2.603010165e-02f,
+    2.136707440e-02f, -1.763234239e-02f, 1.457969224e-02f, -1.204999379e-02f, 9.935128619e-03f, -8.158283114e-03f, 6.662593125e-03f, -5.404322661e-03f,
+    4.348632752e-03f, -3.466893845e-03f, 2.734950224e-03f, -2.131987642e-03f, 1.639790598e-03f, -1.242253997e-03f, 9.250611195e-04f, -6.754691163e-04f,
+    4.821622240e-04f, -3.351455044e-04f, 2.256606147e-04f, -1.461112839e-04f, 8.999063919e-05f, -5.180580858e-05f, 2.699764593e-05f, -1.185518290e-05f,
+  },
+  {
+    -7.184906514e-06f, 1.877437229e-05f, -3.849397338e-05f, 6.966087750e-05f, -1.163919219e-04f, 1.836906180e-04f, -2.775291923e-04f, 4.049254276e-04f,
+    -5.740155550e-04f, 7.941265222e-04f, -1.075853786e-03f, 1.431154610e-03f, -1.873472102e-03f, 2.417912543e-03f, -3.081509045e-03f, 3.883620057e-03f,
+    -4.846534855e-03f, 5.996395466e-03f, -7.364605489e-03f, 8.989999747e-03f, -1.092223099e-02f, 1.322716457e-02f, -1.599571600e-02f, 1.935887435e-02f,
+    -2.351448447e-02f, 2.877797531e-02f, -3.568621783e-02f, 4.523300455e-02f, -5.948279123e-02f, 8.353094230e-02f, -1.342448577e-01f, 3.204204302e-01f,
+    8.876494227e-01f, -1.850781037e-01f, 1.018336196e-01f, -6.898953740e-02f, 5.112808608e-02f, -3.974361171e-02f, 3.176572038e-02f, -2.581801021e-02f,
+    2.119249290e-02f, -1.748808527e-02f, 1.446037957e-02f, -1.195143907e-02f, 9.853971983e-03f, -8.091762122e-03f, 6.608394609e-03f, -5.360483979e-03f,
+    4.313474077e-03f, -3.438970322e-03f, 2.713017028e-03f, -2.114973493e-03f, 1.626776810e-03f, -1.232457191e-03f, 9.178183382e-04f, -6.702245626e-04f,
+    4.784551230e-04f, -3.325988044e-04f, 2.239703803e-04f, -1.450367271e-04f, 8.934479090e-05f, -5.144686392e-05f, 2.682103057e-05f, -1.178638528e-05f,
+  },
+  {
+    -7.094491237e-06f, 1.855949038e-05f, -3.807276696e-05f, 6.891947572e-05f, -1.151770109e-04f, 1.818012464e-04f, -2.747078592e-04f, 4.008484979e-04f,
+    -5.682830313e-04f, 7.862511643e-04f, -1.065249504e-03f, 1.417123954e-03f, -1.855192519e-03f, 2.394420834e-03f, -3.051683132e-03f, 3.846156673e-03f,
+    -4.799921030e-03f, 5.938870562e-03f, -7.294108768e-03f, 8.904095594e-03f, -1.081799908e-02f, 1.310103376e-02f, -1.584320528e-02f, 1.917417362e-02f,
+    -2.328974555e-02f, 2.850204334e-02f, -3.534218854e-02f, 4.479303378e-02f, -5.889543034e-02f, 8.268308311e-02f, -1.327984165e-01f, 3.162021075e-01f,
+    8.901874107e-01f, -1.838826157e-01f, 1.010681405e-01f, -6.844385044e-02f, 5.071367548e-02f, -3.941707774e-02f, 3.150263108e-02f, -2.560315381e-02f,
+    2.101564889e-02f, -1.734196374e-02f, 1.433952542e-02f, -1.185160918e-02f, 9.771762137e-03f, -8.024374150e-03f, 6.553485863e-03f, -5.316067075e-03f,
+    4.277848153e-03f, -3.410672495e-03f, 2.690786957e-03f, -2.097726522e-03f, 1.613582746e-03f, -1.222522786e-03f, 9.104722263e-04f, -6.649038362e-04f,
+    4.746930530e-04f, -3.300134093e-04f, 2.222536976e-04f, -1.439447292e-04f, 8.868794808e-05f, -5.108138894e-05f, 2.664085087e-05f, -1.171588924e-05f,
+  },
+  {
+    -7.003918986e-06f, 1.834374866e-05f, -3.764939460e-05f, 6.817372524e-05f, -1.139543471e-04f, 1.798990718e-04f, -2.718665141e-04f, 3.967415799e-04f,
+    -5.625070646e-04f, 7.783146093e-04f, -1.054561034e-03f, 1.402979823e-03f, -1.836762681e-03f, 2.370733259e-03f, -3.021605406e-03f, 3.808373496e-03f,
+    -4.752905467e-03f, 5.880845776e-03f, -7.222995193e-03f, 8.817435610e-03f, -1.071284640e-02f, 1.297378622e-02f, -1.568934403e-02f, 1.898784133e-02f,
+    -2.306303328e-02f, 2.822371515e-02f, -3.499522711e-02f, 4.434942970e-02f, -5.830348230e-02f, 8.182930114e-02f, -1.313444940e-01f, 3.119891215e-01f,
+    8.926995332e-01f, -1.826632994e-01f, 1.002906697e-01f, -6.789039957e-02f, 5.029365563e-02f, -3.908624957e-02f, 3.123614172e-02f, -2.538554971e-02f,
+    2.083655673e-02f, -1.719398971e-02f, 1.421713969e-02f, -1.175051226e-02f, 9.688505768e-03f, -7.956124652e-03f, 6.497871307e-03f, -5.271075494e-03f,
+    4.241757795e-03f, -3.382002575e-03f, 2.668261725e-03f, -2.080248041e-03f, 1.600209390e-03f, -1.212451508e-03f, 9.030233071e-04f, -6.595073051e-04f,
+    4.708762644e-04f, -3.273894833e-04f, 2.205106690e-04f, -1.428353496e-04f, 8.802014196e-05f, -5.070939718e-05f, 2.645711021e-05f, -1.164369316e-05f,
+  },
+  {
+    -6.913201982e-06f, 1.812717468e-05f, -3.722390870e-05f, 6.742371634e-05f, -1.127240760e-04f, 1.779843176e-04f, -2.690054868e-04f, 3.926051455e-04f,
+    -5.566883124e-04f, 7.703177534e-04f, -1.043789575e-03f, 1.388723792e-03f, -1.818184629e-03f, 2.346852426e-03f, -2.991279163e-03f, 3.770274647e-03f,
+    -4.705493270e-03f, 5.822327385e-03f, -7.151272433e-03f, 8.730029117e-03f, -1.060678424e-02f, 1.284543557e-02f, -1.553414870e-02f, 1.879989742e-02f,
+    -2.283437198e-02f, 2.794302064e-02f, -3.464537101e-02f, 4.390224055e-02f, -5.770701212e-02f, 8.096969108e-02f, -1.298832486e-01f, 3.077816832e-01f,
+    8.951856459e-01f, -1.814201381e-01f, 9.950124475e-02f, -6.732922115e-02f, 4.986805724e-02f, -3.875115270e-02f, 3.096627342e-02f, -2.516521547e-02f,
+    2.065523098e-02f, -1.704417530e-02f, 1.409323239e-02f, -1.164815660e-02f, 9.604209674e-03f, -7.887019175e-03f, 6.441555430e-03f, -5.225512841e-03f,
+    4.205205869e-03f, -3.352962814e-03f, 2.645443078e-03f, -2.062539382e-03f, 1.586657745e-03f, -1.202244097e-03f, 8.954721153e-04f, -6.540353451e-04f,
+    4.670050139e-04f, -3.247271948e-04f, 2.187413997e-04f, -1.417086500e-04f, 8.734140500e-05f, -5.033090292e-05f, 2.626981239e-05f, -1.156979560e-05f,
+  },
+  {
+    -6.822352389e-06f, 1.790979599e-05f, -3.679636171e-05f, 6.666953948e-05f, -1.114863435e-04f, 1.760572077e-04f, -2.661251080e-04f, 3.884396681e-04f,
+    -5.508274349e-04f, 7.622614968e-04f, -1.032936331e-03f, 1.374357444e-03f, -1.799460414e-03f, 2.322780959e-03f, -2.960707716e-03f, 3.731864271e-03f,
+    -4.657689579e-03f, 5.763321707e-03f, -7.078948208e-03f, 8.641885497e-03f, -1.049982396e-02f, 1.271599555e-02f, -1.537763590e-02f, 1.861036199e-02f,
+    -2.260378610e-02f, 2.765998993e-02f, -3.429265793e-02f, 4.345151485e-02f, -5.710608512e-02f, 8.010434795e-02f, -1.284148391e-01f, 3.035800029e-01f,
+    8.976456062e-01f, -1.801531167e-01f, 9.869990466e-02f, -6.676035235e-02f, 4.943691162e-02f, -3.841181307e-02f, 3.069304768e-02f, -2.494216891e-02f,
+    2.047168648e-02f, -1.689253279e-02f, 1.396781372e-02f, -1.154455060e-02f, 9.518880760e-03f, -7.817063355e-03f, 6.384542797e-03f, -5.179382781e-03f,
+    4.168195287e-03f, -3.323555501e-03f, 2.622332793e-03f, -2.044601907e-03f, 1.572928835e-03f, -1.191901308e-03f, 8.878191963e-04f, -6.484883407e-04f,
+    4.630795637e-04f, -3.220267163e-04f, 2.169459978e-04f, -1.405646936e-04f, 8.665177087e-05f, -4.994592114e-05f, 2.607896160e-05f, -1.149419532e-05f,
+  },
+  {
+    -6.731382318e-06f, 1.769164006e-05f, -3.636680605e-05f, 6.591128520e-05f, -1.102412958e-04f, 1.741179667e-04f, -2.632257097e-04f, 3.842456231e-04f,
+    -5.449250954e-04f, 7.541467442e-04f, -1.022002511e-03f, 1.359882370e-03f, -1.780592098e-03f, 2.298521494e-03f, -2.929894400e-03f, 3.693146536e-03f,
+    -4.609499560e-03f, 5.703835100e-03f, -7.006030284e-03f, 8.553014191e-03f, -1.039197700e-02f, 1.258547996e-02f, -1.521982230e-02f, 1.841925525e-02f,
+    -2.237130028e-02f, 2.737465332e-02f, -3.393712581e-02f, 4.299730138e-02f, -5.650076691e-02f, 7.923336706e-02f, -1.269394244e-01f, 2.993842902e-01f,
+    9.000792727e-01f, -1.788622215e-01f, 9.788668949e-02f, -6.618383112e-02f, 4.900025066e-02f, -3.806825707e-02f, 3.041648634e-02f, -2.471642815e-02f,
+    2.028593827e-02f, -1.673907469e-02f, 1.384089402e-02f, -1.143970279e-02f, 9.432526041e-03f, -7.746262916e-03f, 6.326838046e-03f, -5.132689040e-03f,
+    4.130729013e-03f, -3.293782967e-03f, 2.598932679e-03f, -2.026436998e-03f, 1.559023701e-03f, -1.181423912e-03f, 8.800651068e-04f, -6.428666840e-04f,
+    4.591001822e-04f, -3.192882247e-04f, 2.151245744e-04f, -1.394035458e-04f, 8.595127445e-05f, -4.955446756e-05f, 2.588456245e-05f, -1.141689127e-05f,
+  },
+  {
+    -6.640303821e-06f, 1.747273433e-05f, -3.593529418e-05f, 6.514904418e-05f, -1.089890795e-04f, 1.721668199e-04f, -2.603076249e-04f, 3.800234877e-04f,
+    -5.389819594e-04f, 7.459744038e-04f, -1.010989332e-03f, 1.345300171e-03f, -1.761581754e-03f, 2.274076683e-03f, -2.898842565e-03f, 3.654125637e-03f,
+    -4.560928413e-03f, 5.643873959e-03f, -6.932526479e-03f, 8.463424699e-03f, -1.028325486e-02f, 1.245390271e-02f, -1.506072471e-02f, 1.822659754e-02f,
+    -2.213693927e-02f, 2.708704128e-02f, -3.357881277e-02f, 4.253964919e-02f, -5.589112341e-02f, 7.835684401e-02f, -1.254571631e-01f, 2.951947540e-01f,
+    9.024865056e-01f, -1.775474407e-01f, 9.706164051e-02f, -6.559969620e-02f, 4.855810681e-02f, -3.772051151e-02f, 3.013661159e-02f, -2.448801161e-02f,
+    2.009800162e-02f, -1.658381366e-02f, 1.371248379e-02f, -1.133362186e-02f, 9.345152639e-03f, -7.674623673e-03f, 6.268445890e-03f, -5.085435402e-03f,
+    4.092810057e-03f, -3.263647579e-03f, 2.575244575e-03f, -2.008046065e-03f, 1.544943403e-03f, -1.170812692e-03f, 8.722104144e-04f, -6.371707758e-04f,
+    4.550671438e-04f, -3.165119010e-04f, 2.132772434e-04f, -1.382252739e-04f, 8.523995186e-05f, -4.915655865e-05f, 2.568661993e-05f, -1.133788260e-05f,
+  },
+  {
+    -6.549128891e-06f, 1.725310620e-05f, -3.550187855e-05f, 6.438290720e-05f, -1.077298412e-04f, 1.702039930e-04f, -2.573711878e-04f, 3.757737406e-04f,
+    -5.329986955e-04f, 7.377453880e-04f, -9.998980140e-04f, 1.330612453e-03f, -1.742431466e-03f, 2.249449191e-03f, -2.867555583e-03f, 3.614805792e-03f,
+    -4.511981368e-03f, 5.583444717e-03f, -6.858444653e-03f, 8.373126581e-03f, -1.017366912e-02f, 1.232127779e-02f, -1.490036002e-02f, 1.803240933e-02f,
+    -2.190072801e-02f, 2.679718449e-02f, -3.321775717e-02f, 4.207860754e-02f, -5.527722082e-02f, 7.747487469e-02f, -1.239682142e-01f, 2.910116025e-01f,
+    9.048671666e-01f, -1.762087638e-01f, 9.622480013e-02f, -6.500798712e-02f, 4.811051313e-02f, -3.736860368e-02f, 2.985344596e-02f, -2.425693795e-02f,
+    1.990789204e-02f, -1.642676260e-02f, 1.358259371e-02f, -1.122631661e-02f, 9.256767783e-03f, -7.602151529e-03f, 6.209371112e-03f, -5.037625712e-03f,
+    4.054441479e-03f, -3.233151745e-03f, 2.551270351e-03f, -1.989430539e-03f, 1.530689022e-03f, -1.160068448e-03f, 8.642556976e-04f, -6.314010246e-04f,
+    4.509807286e-04f, -3.136979302e-04f, 2.114041215e-04f, -1.370299470e-04f, 8.451784041e-05f, -4.875221159e-05f, 2.548513946e-05f, -1.125716864e-05f,
+  },
+  {
+    -6.457869463e-06f, 1.703278302e-05f, -3.506661161e-05f, 6.361296514e-05f, -1.064637282e-04f, 1.682297125e-04f, -2.544167333e-04f, 3.714968623e-04f,
+    -5.269759746e-04f, 7.294606129e-04f, -9.887297844e-04f, 1.315820830e-03f, -1.723143327e-03f, 2.224641698e-03f, -2.836036841e-03f, 3.575191239e-03f,
+    -4.462663683e-03f, 5.522553844e-03f, -6.783792715e-03f, 8.282129452e-03f, -1.006323141e-02f, 1.218761927e-02f, -1.473874525e-02f, 1.783671121e-02f,
+    -2.166269156e-02f, 2.650511377e-02f, -3.285399758e-02f, 4.161422598e-02f, -5.465912561e-02f, 7.658755527e-02f, -1.224727364e-01f, 2.868350432e-01f,
+    9.072211189e-01f, -1.748461820e-01f, 9.537621195e-02f, -6.440874422e-02f, 4.765750320e-02f, -3.701256127e-02f, 2.956701235e-02f, -2.402322613e-02f,
+    1.971562528e-02f, -1.626793454e-02f, 1.345123458e-02f, -1.111779595e-02f, 9.167378812e-03f, -7.528852476e-03f, 6.149618570e-03f, -4.989263874e-03f,
+    4.015626385e-03f, -3.202297910e-03f, 2.527011908e-03f, -1.970591877e-03f, 1.516261657e-03f, -1.149191992e-03f, 8.562015460e-04f, -6.255578472e-04f,
+    4.468412227e-04f, -3.108465018e-04f, 2.095053284e-04f, -1.358176362e-04f, 8.378497865e-05f, -4.834144429e-05f, 2.528012684e-05f, -1.117474894e-05f,
+  },
+  {
+    -6.366537410e-06f, 1.681179208e-05f, -3.462954580e-05f, 6.283930896e-05f, -1.051908877e-04f, 1.662442052e-04f, -2.514445976e-04f, 3.671933350e-04f,
+    -5.209144702e-04f, 7.211209983e-04f, -9.774858749e-04f, 1.300926926e-03f, -1.703719441e-03f, 2.199656896e-03f, -2.804289745e-03f, 3.535286242e-03f,
+    -4.412980645e-03f, 5.461207847e-03f, -6.708578620e-03f, 8.190442983e-03f, -9.951953468e-03f, 1.205294132e-02f, -1.457589748e-02f, 1.763952389e-02f,
+    -2.142285515e-02f, 2.621086013e-02f, -3.248757275e-02f, 4.114655428e-02f, -5.403690452e-02f, 7.569498217e-02f, -1.209708887e-01f, 2.826652828e-01f,
+    9.095482271e-01f, -1.734596881e-01f, 9.451592073e-02f, -6.380200859e-02f, 4.719911122e-02f, -3.665241242e-02f, 2.927733399e-02f, -2.378689541e-02f,
+    1.952121729e-02f, -1.610734274e-02f, 1.331841738e-02f, -1.100806896e-02f, 9.076993167e-03f, -7.454732592e-03f, 6.089193193e-03f, -4.940353851e-03f,
+    3.976367931e-03f, -3.171088559e-03f, 2.502471179e-03f, -1.951531561e-03f, 1.501662423e-03f, -1.138184152e-03f, 8.480485599e-04f, -6.196416686e-04f,
+    4.426489180e-04f, -3.079578093e-04f, 2.075809867e-04f, -1.345884144e-04f, 8.304140635e-05f, -4.792427542e-05f, 2.507158829e-05f, -1.109062323e-05f,
+  },
+  {
+    -6.275144543e-06f, 1.659016064e-05f, -3.419073355e-05f, 6.206202971e-05f, -1.039114673e-04f, 1.642476987e-04f, -2.484551176e-04f, 3.628636422e-04f,
+    -5.148148582e-04f, 7.127274675e-04f, -9.661675226e-04f, 1.285932368e-03f, -1.684161922e-03f, 2.174497491e-03f, -2.772317717e-03f, 3.495095086e-03f,
+    -4.362937570e-03f, 5.399413268e-03f, -6.632810366e-03f, 8.098076900e-03f, -9.839847059e-03f, 1.191725816e-02f, -1.441183394e-02f, 1.744086820e-02f,
+    -2.118124413e-02f, 2.591445476e-02f, -3.211852165e-02f, 4.067564243e-02f, -5.341062458e-02f, 7.479725205e-02f, -1.194628299e-01f, 2.785025275e-01f,
+    9.118483572e-01f, -1.720492764e-01f, 9.364397239e-02f, -6.318782214e-02f, 4.673537194e-02f, -3.628818571e-02f, 2.898443443e-02f, -2.354796530e-02f,
+    1.932468426e-02f, -1.594500064e-02f, 1.318415323e-02f, -1.089714482e-02f, 8.985618398e-03f, -7.379798044e-03f, 6.028099981e-03f, -4.890899663e-03f,
+    3.936669318e-03f, -3.139526214e-03f, 2.477650125e-03f, -1.932251095e-03f, 1.486892459e-03f, -1.127045771e-03f, 8.397973506e-04f, -6.136529216e-04f,
+    4.384041123e-04f, -3.050320503e-04f, 2.056312217e-04f, -1.333423566e-04f, 8.228716448e-05f, -4.750072435e-05f, 2.485953044e-05f, -1.100479145e-05f,
+  },
+  {
+    -6.183702610e-06f, 1.636791588e-05f, -3.375022727e-05f, 6.128121849e-05f, -1.026256148e-04f, 1.622404208e-04f, -2.454486312e-04f, 3.585082691e-04f,
+    -5.086778167e-04f, 7.042809474e-04f, -9.547759696e-04f, 1.270838794e-03f, -1.664472893e-03f, 2.149166202e-03f, -2.740124198e-03f, 3.454622079e-03f,
+    -4.312539802e-03f, 5.337176686e-03f, -6.556495995e-03f, 8.005040985e-03f, -9.726924035e-03f, 1.178058411e-02f, -1.424657192e-02f, 1.724076509e-02f,
+    -2.093788400e-02f, 2.561592899e-02f, -3.174688346e-02f, 4.020154070e-02f, -5.278035305e-02f, 7.389446186e-02f, -1.179487188e-01f, 2.743469824e-01f,
+    9.141213771e-01f, -1.706149430e-01f, 9.276041403e-02f, -6.256622753e-02f, 4.626632067e-02f, -3.591991015e-02f, 2.868833760e-02f, -2.330645557e-02f,
+    1.912604262e-02f, -1.578092185e-02f, 1.304845342e-02f, -1.078503284e-02f, 8.893262159e-03f, -7.304055085e-03f, 5.966344006e-03f, -4.840905391e-03f,
+    3.896533797e-03f, -3.107613435e-03f, 2.452550738e-03f, -1.912752009e-03f, 1.471952918e-03f, -1.115777705e-03f, 8.314485401e-04f, -6.075920472e-04f,
+    4.341071093e-04f, -3.020694267e-04f, 2.036561618e-04f, -1.320795396e-04f, 8.152229525e-05f, -4.707081121e-05f, 2.464396032e-05f, -1.091725373e-05f,
+  },
+  {
+    -6.092223293e-06f, 1.614508492e-05f, -3.330807934e-05f, 6.049696646e-05f, -1.013334783e-04f, 1.602225999e-04f, -2.424254772e-04f, 3.541277023e-04f,
+    -5.025040263e-04f, 6.957823684e-04f, -9.433124629e-04f, 1.255647847e-03f, -1.644654487e-03f, 2.123665758e-03f, -2.707712644e-03f, 3.413871548e-03f,
+    -4.261792712e-03f, 5.274504711e-03f, -6.479643591e-03f, 7.911345070e-03f, -9.613196309e-03f, 1.164293359e-02f, -1.408012881e-02f, 1.703923561e-02f,
+    -2.069280040e-02f, 2.531531434e-02f, -3.137269752e-02f, 3.972429952e-02f, -5.214615745e-02f, 7.298670875e-02f, -1.164287142e-01f, 2.701988520e-01f,
+    9.163671557e-01f, -1.691566853e-01f, 9.186529391e-02f, -6.193726823e-02f, 4.579199328e-02f, -3.554761517e-02f, 2.838906776e-02f, -2.306238631e-02f,
+    1.892530899e-02f, -1.561512017e-02f, 1.291132938e-02f, -1.067174245e-02f, 8.799932208e-03f, -7.227510055e-03f, 5.903930411e-03f, -4.790375172e-03f,
+    3.855964665e-03f, -3.075352820e-03f, 2.427175042e-03f, -1.893035854e-03f, 1.456844973e-03f, -1.104380825e-03f, 8.230027612e-04f, -6.014594943e-04f,
+    4.297582183e-04f, -2.990701443e-04f, 2.016559380e-04f, -1.308000420e-04f, 8.074684207e-05f, -4.663455686e-05f, 2.442488538e-05f, -1.082801041e-05f,
+  },
+  {
+    -6.000718210e-06f, 1.592169483e-05f, -3.286434211e-05f, 5.970936484e-05f, -1.000352060e-04f, 1.581944650e-04f, -2.393859952e-04f, 3.497224297e-04f,
+    -4.962941696e-04f, 6.872326639e-04f, -9.317782544e-04f, 1.240361176e-03f, -1.624708845e-03f, 2.097998905e-03f, -2.675086527e-03f, 3.372847843e-03f,
+    -4.210701697e-03f, 5.211403989e-03f, -6.402261283e-03f, 7.816999041e-03f, -9.498675856e-03f, 1.150432105e-02f, -1.391252210e-02f, 1.683630095e-02f,
+    -2.044601910e-02f, 2.501264248e-02f, -3.099600340e-02f, 3.924396960e-02f, -5.150810556e-02f, 7.207409011e-02f, -1.149029749e-01f, 2.660583401e-01f,
+    9.185855640e-01f, -1.676745025e-01f, 9.095866144e-02f, -6.130098846e-02f, 4.531242621e-02f, -3.517133065e-02f, 2.808664948e-02f, -2.281577785e-02f,
+    1.872250025e-02f, -1.544760959e-02f, 1.277279268e-02f, -1.055728324e-02f, 8.705636408e-03f, -7.150169378e-03f, 5.840864410e-03f, -4.739313201e-03f,
+    3.814965265e-03f, -3.042747006e-03f, 2.401525089e-03f, -1.873104208e-03f, 1.441569816e-03f, -1.092856015e-03f, 8.144606575e-04f, -5.952557198e-04f,
+    4.253577547e-04f, -2.960344133e-04f, 1.996306843e-04f, -1.295039445e-04f, 7.996084958e-05f, -4.619198287e-05f, 2.420231347e-05f, -1.073706203e-05f,
+  },
+  {
+    -5.909198912e-06f, 1.569777262e-05f, -3.241906790e-05f, 5.891850488e-05f, -9.873094619e-05f, 1.561562452e-04f, -2.363305256e-04f, 3.452929407e-04f,
+    -4.900489314e-04f, 6.786327708e-04f, -9.201746003e-04f, 1.224980437e-03f, -1.604638118e-03f, 2.072168396e-03f, -2.642249335e-03f, 3.331555333e-03f,
+    -4.159272181e-03f, 5.147881198e-03f, -6.324357238e-03f, 7.722012833e-03f, -9.383374716e-03f, 1.136476105e-02f, -1.374376937e-02f, 1.663198239e-02f,
+    -2.019756600e-02f, 2.470794523e-02f, -3.061684081e-02f, 3.876060183e-02f, -5.086626538e-02f, 7.115670354e-02f, -1.133716595e-01f, 2.619256495e-01f,
+    9.207764740e-01f, -1.661683954e-01f, 9.004056721e-02f, -6.065743322e-02f, 4.482765647e-02f, -3.479108686e-02f, 2.778110769e-02f, -2.256665079e-02f,
+    1.851763346e-02f, -1.527840427e-02f, 1.263285507e-02f, -1.044166487e-02f, 8.610382724e-03f, -7.072039565e-03f, 5.777151286e-03f, -4.687723731e-03f,
+    3.773538987e-03f, -3.009798666e-03f, 2.375602962e-03f, -1.852958671e-03f, 1.426128658e-03f, -1.081204174e-03f, 8.058228832e-04f, -5.889811886e-04f,
+    4.209060396e-04f, -2.929624479e-04f, 1.975805375e-04f, -1.281913296e-04f, 7.916436361e-05f, -4.574311159e-05f, 2.397625285e-05f, -1.064440932e-05f,
+  },
+  {
+    -5.817676882e-06f, 1.547334521e-05f, -3.197230899e-05f, 5.812447786e-05f, -9.742084752e-05f, 1.541081703e-04f, -2.332594095e-04f, 3.408397260e-04f,
+    -4.837689988e-04f, 6.699836290e-04f, -9.085027618e-04f, 1.209507294e-03f, -1.584444466e-03f, 2.046177000e-03f, -2.609204572e-03f, 3.289998409e-03f,
+    -4.107509613e-03f, 5.083943049e-03f, -6.245939664e-03f, 7.626396433e-03f, -9.267304988e-03f, 1.122426822e-02f, -1.357388830e-02f, 1.642630131e-02f,
+    -1.994746713e-02f, 2.440125458e-02f, -3.023524967e-02f, 3.827424731e-02f, -5.022070515e-02f, 7.023464687e-02f, -1.118349267e-01f, 2.578009825e-01f,
+    9.229397596e-01f, -1.646383663e-01f, 8.911106295e-02f, -6.000664830e-02f, 4.433772161e-02f, -3.440691452e-02f, 2.747246766e-02f, -2.231502600e-02f,
+    1.831072594e-02f, -1.510751856e-02f, 1.249152842e-02f, -1.032489718e-02f, 8.514179224e-03f, -6.993127211e-03f, 5.712796392e-03f, -4.635611070e-03f,
+    3.731689267e-03f, -2.976510511e-03f, 2.349410772e-03f, -1.832600865e-03f, 1.410522726e-03f, -1.069426215e-03f, 7.970901031e-04f, -5.826363735e-04f,
+    4.164033996e-04f, -2.898544663e-04f, 1.955056373e-04f, -1.268622816e-04f, 7.835743125e-05f, -4.528796607e-05f, 2.374671221e-05f, -1.055005323e-05f,
+  },
+  {
+    -5.726163532e-06f, 1.524843946e-05f, -3.152411761e-05f, 5.732737508e-05f, -9.610505868e-05f, 1.520504702e-04f, -2.301729887e-04f, 3.363632773e-04f,
+    -4.774550604e-04f, 6.612861813e-04f, -8.967640040e-04f, 1.193943415e-03f, -1.564130057e-03f, 2.020027494e-03f, -2.575955756e-03f, 3.248181479e-03f,
+    -4.055419468e-03f, 5.019596285e-03f, -6.167016810e-03f, 7.530159875e-03f, -9.150478831e-03f, 1.108285726e-02f, -1.340289665e-02f, 1.621927923e-02f,
+    -1.969574865e-02f, 2.409260264e-02f, -2.985127008e-02f, 3.778495737e-02f, -4.957149334e-02f, 6.930801809e-02f, -1.102929351e-01f, 2.536845403e-01f,
+    9.250752961e-01f, -1.630844193e-01f, 8.817020158e-02f, -5.934868024e-02f, 4.384265973e-02f, -3.401884477e-02f, 2.716075497e-02f, -2.206092463e-02f,
+    1.810179520e-02f, -1.493496700e-02f, 1.234882478e-02f, -1.020699009e-02f, 8.417034079e-03f, -6.913438995e-03f, 5.647805151e-03f, -4.582979586e-03f,
+    3.689419587e-03f, -2.942885288e-03f, 2.322950661e-03f, -1.812032437e-03f, 1.394753267e-03f, -1.057523066e-03f, 7.882629927e-04f, -5.762217551e-04f,
+    4.118501674e-04f, -2.867106909e-04f, 1.934061261e-04f, -1.255168870e-04f, 7.754010077e-05f, -4.482657011e-05f, 2.351370063e-05f, -1.045399490e-05f,
+  },
+  {
+    -5.634670208e-06f, 1.502308217e-05f, -3.107454592e-05f, 5.652728784e-05f, -9.478372852e-05f, 1.499833754e-04f, -2.270716059e-04f, 3.318640877e-04f,
+    -4.711078071e-04f, 6.525413736e-04f, -8.849595965e-04f, 1.178290476e-03f, -1.543697065e-03f, 1.993722668e-03f, -2.542506421e-03f, 3.206108971e-03f,
+    -4.003007243e-03f, 4.954847678e-03f, -6.087596962e-03f, 7.433313242e-03f, -9.032908464e-03f, 1.094054293e-02f, -1.323081225e-02f, 1.601093773e-02f,
+    -1.944243685e-02f, 2.378202171e-02f, -2.946494231e-02f, 3.729278352e-02f, -4.891869863e-02f, 6.837691543e-02f, -1.087458430e-01f, 2.495765233e-01f,
+    9.271829605e-01f, -1.615065598e-01f, 8.721803715e-02f, -5.868357636e-02f, 4.334250950e-02f, -3.362690916e-02f, 2.684599554e-02f, -2.180436810e-02f,
+    1.789085897e-02f, -1.476076428e-02f, 1.220475632e-02f, -1.008795366e-02f, 8.318955559e-03f, -6.832981680e-03f, 5.582183054e-03f, -4.529833699e-03f,
+    3.646733476e-03f, -2.908925781e-03f, 2.296224802e-03f, -1.791255058e-03f, 1.378821545e-03f, -1.045495667e-03f, 7.793422381e-04f, -5.697378218e-04f,
+    4.072466812e-04f, -2.835313482e-04f, 1.912821492e-04f, -1.241552338e-04f, 7.671242165e-05f, -4.435894824e-05f, 2.327722761e-05f, -1.035623569e-05f,
+  },
+  {
+    -5.543208180e-06f, 1.479730004e-05f, -3.062364605e-05f, 5.572430746e-05f, -9.345700599e-05f, 1.479071166e-04f, -2.239556041e-04f, 3.273426514e-04f,
+    -4.647279314e-04f, 6.437501544e-04f, -8.730908130e-04f, 1.162550156e-03f, -1.523147677e-03f, 1.967265323e-03f, -2.508860114e-03f, 3.163785333e-03f,
+    -3.950278463e-03f, 4.889704032e-03f, -6.007688443e-03f, 7.335866663e-03f, -8.914606161e-03f, 1.079734007e-02f, -1.305765305e-02f, 1.580129854e-02f,
+    -1.918755813e-02f, 2.346954420e-02f, -2.907630677e-02f, 3.679777746e-02f, -4.826238991e-02f, 6.744143725e-02f, -1.071938088e-01f, 2.454771312e-01f,
+    9.292626311e-01f, -1.599047952e-01f, 8.625462488e-02f, -5.801138472e-02f, 4.283731011e-02f, -3.323113966e-02f, 2.652821562e-02f, -2.154537806e-02f,
+    1.767793521e-02f, -1.458492529e-02f, 1.205933536e-02f, -9.967798083e-03f, 8.219952038e-03f, -6.751762113e-03f, 5.515935660e-03f, -4.476177889e-03f,
+    3.603634508e-03f, -2.874634813e-03f, 2.269235394e-03f, -1.770270420e-03f, 1.362728844e-03f, -1.033344972e-03f, 7.703285356e-04f, -5.631850701e-04f,
+    4.025932850e-04f, -2.803166687e-04f, 1.891338549e-04f, -1.227774121e-04f, 7.587444459e-05f, -4.388512573e-05f, 2.303730307e-05f, -1.025677717e-05f,
+  },
+  {
+    -5.451788650e-06f, 1.457111972e-05f, -3.017147005e-05f, 5.491852522e-05f, -9.212504015e-05f, 1.458219248e-04f, -2.208253274e-04f, 3.227994638e-04f,
+    -4.583161278e-04f, 6.349134750e-04f, -8.611589311e-04f, 1.146724143e-03f, -1.502484083e-03f, 1.940658268e-03f, -2.475020397e-03f, 3.121215030e-03f,
+    -3.897238672e-03f, 4.824172179e-03f, -5.927299617e-03f, 7.237830314e-03f, -8.795584256e-03f, 1.065326360e-02f, -1.288343705e-02f, 1.559038344e-02f,
+    -1.893113900e-02f, 2.315520268e-02f, -2.868540408e-02f, 3.629999109e-02f, -4.760263629e-02f, 6.650168214e-02f, -1.056369908e-01f, 2.413865628e-01f,
+    9.313141882e-01f, -1.582791341e-01f, 8.528002113e-02f, -5.733215417e-02f, 4.232710133e-02f, -3.283156865e-02f, 2.620744178e-02f, -2.128397644e-02f,
+    1.746304208e-02f, -1.440746509e-02f, 1.191257437e-02f, -9.846533646e-03f, 8.120031985e-03f, -6.669787221e-03f, 5.449068598e-03f, -4.422016689e-03f,
+    3.560126299e-03f, -2.840015240e-03f, 2.241984666e-03f, -1.749080239e-03f, 1.346476464e-03f, -1.021071952e-03f, 7.612225923e-04f, -5.565640040e-04f,
+    3.978903285e-04f, -2.770668869e-04f, 1.869613939e-04f, -1.213835140e-04f, 7.502622151e-05f, -4.340512859e-05f, 2.279393733e-05f, -1.015562108e-05f,
+  },
+  {
+    -5.360422744e-06f, 1.434456774e-05f, -2.971806991e-05f, 5.411003242e-05f, -9.078798017e-05f, 1.437280312e-04f, -2.176811199e-04f, 3.182350210e-04f,
+    -4.518730923e-04f, 6.260322894e-04f, -8.491652324e-04f, 1.130814127e-03f, -1.481708483e-03f, 1.913904326e-03f, -2.440990845e-03f, 3.078402544e-03f,
+    -3.843893439e-03f, 4.758258982e-03f, -5.846438879e-03f, 7.139214413e-03f, -8.675855133e-03f, 1.050832849e-02f, -1.270818234e-02f, 1.537821433e-02f,
+    -1.867320611e-02f, 2.283902984e-02f, -2.829227499e-02f, 3.579947651e-02f, -4.693950706e-02f, 6.555774879e-02f, -1.040755470e-01f, 2.373050159e-01f,
+    9.333375132e-01f, -1.566295871e-01f, 8.429428344e-02f, -5.664593430e-02f, 4.181192344e-02f, -3.242822892e-02f, 2.588370092e-02f, -2.102018545e-02f,
+    1.724619796e-02f, -1.422839891e-02f, 1.176448599e-02f, -9.724170776e-03f, 8.019203974e-03f, -6.587064015e-03f, 5.381587561e-03f, -4.367354687e-03f,
+    3.516212514e-03f, -2.805069955e-03f, 2.214474877e-03f, -1.727686254e-03f, 1.330065723e-03f, -1.008677587e-03f, 7.520251256e-04f, -5.498751353e-04f,
+    3.931381670e-04f, -2.737822414e-04f, 1.847649200e-04f, -1.199736332e-04f, 7.416780553e-05f, -4.291898356e-05f, 2.254714116e-05f, -1.005276942e-05f,
+  },
+  {
+    -5.269121513e-06f, 1.411767058e-05f, -2.926349754e-05f, 5.329892029e-05f, -8.944597526e-05f, 1.416256674e-04f, -2.145233268e-04f, 3.136498205e-04f,
+    -4.453995225e-04f, 6.171075539e-04f, -8.371110018e-04f, 1.114821807e-03f, -1.460823085e-03f, 1.887006328e-03f, -2.406775047e-03f, 3.035352375e-03f,
+    -3.790248355e-03f, 4.691971329e-03f, -5.765114661e-03f, 7.040029225e-03f, -8.555431233e-03f, 1.036254977e-02f, -1.253190710e-02f, 1.516481323e-02f,
+    -1.841378621e-02f, 2.252105851e-02f, -2.789696042e-02f, 3.529628596e-02f, -4.627307170e-02f, 6.460973609e-02f, -1.025096355e-01f, 2.332326876e-01f,
+    9.353324896e-01f, -1.549561663e-01f, 8.329747047e-02f, -5.595277546e-02f, 4.129181728e-02f, -3.202115369e-02f, 2.555702025e-02f, -2.075402754e-02f,
+    1.702742143e-02f, -1.404774216e-02f, 1.161508295e-02f, -9.600720010e-03f, 7.917476672e-03f, -6.503599587e-03f, 5.313498311e-03f, -4.312196528e-03f,
+    3.471896861e-03f, -2.769801889e-03f, 2.186708314e-03f, -1.706090227e-03f, 1.313497956e-03f, -9.961628732e-04f, 7.427368630e-04f, -5.431189836e-04f,
+    3.883371613e-04f, -2.704629749e-04f, 1.825445897e-04f, -1.185478654e-04f, 7.329925097e-05f, -4.242671811e-05f, 2.229692570e-05f, -9.948224349e-06f,
+  },
+  {
+    -5.177895935e-06f, 1.389045462e-05f, -2.880780478e-05f, 5.248528006e-05f, -8.809917470e-05f, 1.395150652e-04f, -2.113522933e-04f, 3.090443604e-04f,
+    -4.388961179e-04f, 6.081402275e-04f, -8.249975284e-04f, 1.098748884e-03f, -1.439830101e-03f, 1.859967113e-03f, -2.372376603e-03f, 2.992069040e-03f,
+    -3.736309032e-03f, 4.625316138e-03f, -5.683335432e-03f, 6.940285055e-03f, -8.434325049e-03f, 1.021594256e-02f, -1.235462957e-02f, 1.495020220e-02f,
+    -1.815290617e-02f, 2.220132167e-02f, -2.749950144e-02f, 3.479047189e-02f, -4.560339990e-02f, 6.365774307e-02f, -1.009394140e-01f, 2.291697739e-01f,
+    9.372990021e-01f, -1.532588852e-01f, 8.228964205e-02f, -5.525272875e-02f, 4.076682421e-02f, -3.161037654e-02f, 2.522742730e-02f, -2.048552540e-02f,
+    1.680673130e-02f, -1.386551041e-02f, 1.146437817e-02f, -9.476192008e-03f, 7.814858848e-03f, -6.419401109e-03f, 5.244806677e-03f, -4.256546910e-03f,
+    3.427183092e-03f, -2.734214007e-03f, 2.158687292e-03f, -1.684293941e-03f, 1.296774519e-03f, -9.835288208e-04f, 7.333585426e-04f, -5.362960762e-04f,
+    3.834876782e-04f, -2.671093340e-04f, 1.803005624e-04f, -1.171063082e-04f, 7.242061336e-05f, -4.192836046e-05f, 2.204330254e-05f, -9.841988273e-06f,
+  },
+  {
+    -5.086756910e-06f, 1.366294615e-05f, -2.835104337e-05f, 5.166920288e-05f, -8.674772781e-05f, 1.373964564e-04f, -2.081683655e-04f, 3.044191399e-04f,
+    -4.323635789e-04f, 5.991312713e-04f, -8.128261041e-04f, 1.082597065e-03f, -1.418731754e-03f, 1.832789533e-03f, -2.337799126e-03f, 2.948557072e-03f,
+    -3.682081103e-03f, 4.558300353e-03f, -5.601109690e-03f, 6.839992251e-03f, -8.312549124e-03f, 1.006852202e-02f, -1.217636809e-02f, 1.473440343e-02f,
+    -1.789059294e-02f, 2.187985240e-02f, -2.709993926e-02f, 3.428208689e-02f, -4.493056151e-02f, 6.270186886e-02f, -9.936504012e-02f, 2.251164701e-01f,
+    9.392369373e-01f, -1.515377592e-01f, 8.127085915e-02f, -5.454584602e-02f, 4.023698615e-02f, -3.119593151e-02f, 2.489494994e-02f, -2.021470201e-02f,
+    1.658414655e-02f, -1.368171942e-02f, 1.131238469e-02f, -9.350597543e-03f, 7.711359366e-03f, -6.334475834e-03f, 5.175518554e-03f, -4.200410584e-03f,
+    3.382075003e-03f, -2.698309309e-03f, 2.130414156e-03f, -1.662299203e-03f, 1.279896781e-03f, -9.707764525e-04f, 7.238909127e-04f, -5.294069478e-04f,
+    3.785900897e-04f, -2.637215693e-04f, 1.780330000e-04f, -1.156490611e-04f, 7.153194944e-05f, -4.142393955e-05f, 2.178628366e-05f, -9.734063790e-06f,
+  },
+  {
+    -4.995715261e-06f, 1.343517137e-05f, -2.789326498e-05f, 5.085077988e-05f, -8.539178393e-05f, 1.352700734e-04f, -2.049718896e-04f, 2.997746589e-04f,
+    -4.258026078e-04f, 5.900816485e-04f, -8.005980246e-04f, 1.066368063e-03f, -1.397530269e-03f, 1.805476446e-03f, -2.303046244e-03f, 2.904821021e-03f,
+    -3.627570222e-03f, 4.490930943e-03f, -5.518445969e-03f, 6.739161200e-03f, -8.190116052e-03f, 9.920303367e-03f, -1.199714105e-02f, 1.451743919e-02f,
+    -1.762687360e-02f, 2.155668391e-02f, -2.669831525e-02f, 3.377118374e-02f, -4.425462653e-02f, 6.174221276e-02f, -9.778667140e-02f, 2.210729706e-01f,
+    9.411461832e-01f, -1.497928051e-01f, 8.024118387e-02f, -5.383217986e-02f, 3.970234553e-02f, -3.077785300e-02f, 2.455961631e-02f, -1.994158056e-02f,
+    1.635968641e-02f, -1.349638511e-02f, 1.115911569e-02f, -9.223947507e-03f, 7.606987185e-03f, -6.248831095e-03f, 5.105639900e-03f, -4.143792357e-03f,
+    3.336576433e-03f, -2.662090831e-03f, 2.101891277e-03f, -1.640107841e-03f, 1.262866132e-03f, -9.579068046e-04f, 7.143347317e-04f, -5.224521411e-04f,
+    3.736447736e-04f, -2.602999354e-04f, 1.757420675e-04f, -1.141762253e-04f, 7.063331712e-05f, -4.091348507e-05f, 2.152588149e-05f, -9.624453711e-06f,
+  },
+  {
+    -4.904781732e-06f, 1.320715638e-05f, -2.743452116e-05f, 5.003010208e-05f, -8.403149242e-05f, 1.331361483e-04f, -2.017632125e-04f, 2.951114180e-04f,
+    -4.192139080e-04f, 5.809923248e-04f, -7.883145886e-04f, 1.050063593e-03f, -1.376227883e-03f, 1.778030720e-03f, -2.268121593e-03f, 2.860865449e-03f,
+    -3.572782063e-03f, 4.423214903e-03f, -5.435352833e-03f, 6.637802330e-03f, -8.067038473e-03f, 9.771301898e-03f, -1.181696691e-02f, 1.429933182e-02f,
+    -1.736177534e-02f, 2.123184955e-02f, -2.629467091e-02f, 3.325781536e-02f, -4.357566517e-02f, 6.077887416e-02f, -9.620446510e-02f, 2.170394685e-01f,
+    9.430266295e-01f, -1.480240417e-01f, 7.920067948e-02f, -5.311178362e-02f, 3.916294531e-02f, -3.035617582e-02f, 2.422145492e-02f, -1.966618454e-02f,
+    1.613337029e-02f, -1.330952356e-02f, 1.100458450e-02f, -9.096252905e-03f, 7.501751363e-03f, -6.162474303e-03f, 5.035176741e-03f, -4.086697087e-03f,
+    3.290691266e-03f, -2.625561644e-03f, 2.073121055e-03f, -1.617721706e-03f, 1.245683977e-03f, -9.449209268e-04f, 7.046907681e-04f, -5.154322060e-04f,
+    3.686521130e-04f, -2.568446908e-04f, 1.734279324e-04f, -1.126879041e-04f, 6.972477555e-05f, -4.039702742e-05f, 2.126210883e-05f, -9.513161060e-06f,
+  },
+  {
+    -4.813966989e-06f, 1.297892720e-05f, -2.697486339e-05f, 4.920726046e-05f, -8.266700263e-05f, 1.309949136e-04f, -1.985426812e-04f, 2.904299189e-04f,
+    -4.125981843e-04f, 5.718642675e-04f, -7.759770978e-04f, 1.033685378e-03f, -1.354826834e-03f, 1.750455232e-03f, -2.233028822e-03f, 2.816694937e-03f,
+    -3.517722318e-03f, 4.355159253e-03f, -5.351838878e-03f, 6.535926107e-03f, -7.943329077e-03f, 9.621532954e-03f, -1.163586423e-02f, 1.408010377e-02f,
+    -1.709532543e-02f, 2.090538276e-02f, -2.588904787e-02f, 3.274203483e-02f, -4.289374776e-02f, 5.981195257e-02f, -9.461857830e-02f, 2.130161565e-01f,
+    9.448781676e-01f, -1.462314889e-01f, 7.814941037e-02f, -5.238471136e-02f, 3.861882897e-02f, -2.993093518e-02f, 2.388049453e-02f, -1.938853765e-02f,
+    1.590521780e-02f, -1.312115102e-02f, 1.084880457e-02f, -8.967524858e-03f, 7.395661050e-03f, -6.075412948e-03f, 4.964135166e-03f, -4.029129687e-03f,
+    3.244423427e-03f, -2.588724853e-03f, 2.044105918e-03f, -1.595142671e-03f, 1.228351739e-03f, -9.318198821e-04f, 6.949598006e-04f, -5.083477002e-04f,
+    3.636124968e-04f, -2.533560981e-04f, 1.710907650e-04f, -1.111842023e-04f, 6.880638505e-05f, -3.987459775e-05f, 2.099497895e-05f, -9.400189071e-06f,
+  },
+  {
+    -4.723281616e-06f, 1.275050972e-05f, -2.651434302e-05f, 4.838234590e-05f, -8.129846388e-05f, 1.288466018e-04f, -1.953106432e-04f, 2.857306635e-04f,
+    -4.059561424e-04f, 5.626984461e-04f, -7.635868567e-04f, 1.017235141e-03f, -1.333329368e-03f, 1.722752866e-03f, -2.197771591e-03f, 2.772314078e-03f,
+    -3.462396698e-03f, 4.286771035e-03f, -5.267912728e-03f, 6.433543033e-03f, -7.819000598e-03f, 9.471011934e-03f, -1.145385160e-02f, 1.385977754e-02f,
+    -1.682755123e-02f, 2.057731712e-02f, -2.548148791e-02f, 3.222389537e-02f, -4.220894480e-02f, 5.884154759e-02f, -9.302916787e-02f, 2.090032259e-01f,
+    9.467006906e-01f, -1.444151688e-01f, 7.708744207e-02f, -5.165101790e-02f, 3.807004053e-02f, -2.950216668e-02f, 2.353676425e-02f, -1.910866386e-02f,
+    1.567524876e-02f, -1.293128393e-02f, 1.069178951e-02f, -8.837774601e-03f, 7.288725491e-03f, -5.987654596e-03f, 4.892521328e-03f, -3.971095120e-03f,
+    3.197776886e-03f, -2.551583599e-03f, 2.014848320e-03f, -1.572372630e-03f, 1.210870858e-03f, -9.186047466e-04f, 6.851426178e-04f, -5.011991885e-04f,
+    3.585263192e-04f, -2.498344236e-04f, 1.687307385e-04f, -1.096652269e-04f, 6.787820714e-05f, -3.934622794e-05f, 2.072450549e-05f, -9.285541193e-06f,
+  },
+  {
+    -4.632736116e-06f, 1.252192976e-05f, -2.605301130e-05f, 4.755544919e-05f, -7.992602546e-05f, 1.266914456e-04f, -1.920674462e-04f, 2.810141547e-04f,
+    -3.992884894e-04f, 5.534958317e-04f, -7.511451729e-04f, 1.000714612e-03f, -1.311737738e-03f, 1.694926515e-03f, -2.162353570e-03f, 2.727727479e-03f,
+    -3.406810934e-03f, 4.218057317e-03f, -5.183583039e-03f, 6.330663647e-03f, -7.694065817e-03f, 9.319754293e-03f, -1.127094770e-02f, 1.363837575e-02f,
+    -1.655848023e-02f, 2.024768630e-02f, -2.507203293e-02f, 3.170345036e-02f, -4.152132692e-02f, 5.786775892e-02f, -9.143639046e-02f, 2.050008673e-01f,
+    9.484940930e-01f, -1.425751046e-01f, 7.601484125e-02f, -5.091075878e-02f, 3.751662451e-02f, -2.906990632e-02f, 2.319029348e-02f, -1.882658736e-02f,
+    1.544348319e-02f, -1.273993885e-02f, 1.053355304e-02f, -8.707013479e-03f, 7.180954023e-03f, -5.899206893e-03f, 4.820341444e-03f, -3.912598403e-03f,
+    3.150755653e-03f, -2.514141055e-03f, 1.985350746e-03f, -1.549413500e-03f, 1.193242792e-03f, -9.052766097e-04f, 6.752400183e-04f, -4.939872437e-04f,
+    3.533939798e-04f, -2.462799378e-04f, 1.663480286e-04f, -1.081310866e-04f, 6.694030452e-05f, -3.881195061e-05f, 2.045070255e-05f, -9.169221087e-06f,
+  },
+  {
+    -4.542340910e-06f, 1.229321302e-05f, -2.559091937e-05f, 4.672666102e-05f, -7.854983662e-05f, 1.245296776e-04f, -1.888134382e-04f, 2.762808957e-04f,
+    -3.925959335e-04f, 5.442573973e-04f, -7.386533564e-04f, 9.841255253e-04f, -1.290054202e-03f, 1.666979079e-03f, -2.126778440e-03f, 2.682939762e-03f,
+    -3.350970771e-03f, 4.149025186e-03f, -5.098858492e-03f, 6.227298525e-03f, -7.568537556e-03f, 9.167775537e-03f, -1.108717127e-02f, 1.341592105e-02f,
+    -1.628813997e-02f, 1.991652408e-02f, -2.466072494e-02f, 3.118075329e-02f, -4.083096489e-02f, 5.689068634e-02f, -8.984040248e-02f, 2.010092702e-01f,
+    9.502582712e-01f, -1.407113214e-01f, 7.493167571e-02f, -5.016399027e-02f, 3.695862595e-02f, -2.863419045e-02f, 2.284111193e-02f, -1.854233260e-02f,
+    1.520994131e-02f, -1.254713255e-02f, 1.037410904e-02f, -8.575252950e-03f, 7.072356078e-03f, -5.810077558e-03f, 4.747601794e-03f, -3.853644604e-03f,
+    3.103363782e-03f, -2.476400429e-03f, 1.955615704e-03f, -1.526267217e-03f, 1.175469014e-03f, -8.918365734e-04f, 6.652528106e-04f, -4.867124455e-04f,
+    3.482158838e-04f, -2.426929147e-04f, 1.639428138e-04f, -1.065818918e-04f, 6.599274109e-05f, -3.827179909e-05f, 2.017358462e-05f, -9.051232627e-06f,
+  },
+  {
+    -4.452106337e-06f, 1.206438509e-05f, -2.512811824e-05f, 4.589607196e-05f, -7.717004653e-05f, 1.223615306e-04f, -1.855489674e-04f, 2.715313904e-04f,
+    -3.858791835e-04f, 5.349841175e-04f, -7.261127198e-04f, 9.674696162e-04f, -1.268281021e-03f, 1.638913465e-03f, -2.091049891e-03f, 2.637955561e-03f,
+    -3.294881976e-03f, 4.079681754e-03f, -5.013747798e-03f, 6.123458274e-03f, -7.442428680e-03f, 9.015091225e-03f, -1.090254110e-02f, 1.319243620e-02f,
+    -1.601655810e-02f, 1.958386436e-02f, -2.424760609e-02f, 3.065585781e-02f, -4.013792962e-02f, 5.591042968e-02f, -8.824136010e-02f, 1.970286231e-01f,
+    9.519931232e-01f, -1.388238461e-01f, 7.383801437e-02f, -4.941076936e-02f, 3.639609040e-02f, -2.819505586e-02f, 2.248924958e-02f, -1.825592428e-02f,
+    1.497464352e-02f, -1.235288192e-02f, 1.021347150e-02f, -8.442504584e-03f, 6.962941177e-03f, -5.720274390e-03f, 4.674308720e-03f, -3.794238842e-03f,
+    3.055605366e-03f, -2.438364965e-03f, 1.925645731e-03f, -1.502935743e-03f, 1.157551015e-03f, -8.782857531e-04f, 6.551818131e-04f, -4.793753812e-04f,
+    3.429924418e-04f, -2.390736324e-04f, 1.615152753e-04f, -1.050177549e-04f, 6.503558194e-05f, -3.772580746e-05f, 1.989316661e-05f, -8.931579902e-06f,
+  },
+  {
+    -4.362042650e-06f, 1.183547146e-05f, -2.466465881e-05f, 4.506377247e-05f, -7.578680428e-05f, 1.201872372e-04f, -1.822743822e-04f, 2.667661430e-04f,
+    -3.791389494e-04f, 5.256769682e-04f, -7.135245779e-04f, 9.507486256e-04f, -1.246420463e-03f, 1.610732588e-03f, -2.055171624e-03f, 2.592779523e-03f,
+    -3.238550326e-03f, 4.010034151e-03f, -4.928259693e-03f, 6.019153536e-03f, -7.315752095e-03f, 8.861716966e-03f, -1.071707605e-02f, 1.296794401e-02f,
+    -1.574376236e-02f, 1.924974112e-02f, -2.383271863e-02f, 3.012881768e-02f, -3.944229214e-02f, 5.492708886e-02f, -8.663941923e-02f, 1.930591136e-01f,
+    9.536985487e-01f, -1.369127068e-01f, 7.273392728e-02f, -4.865115378e-02f, 3.582906392e-02f, -2.775253967e-02f, 2.213473676e-02f, -1.796738731e-02f,
+    1.473761042e-02f, -1.215720403e-02f, 1.005165456e-02f, -8.308780058e-03f, 6.852718933e-03f, -5.629805258e-03f, 4.600468627e-03f, -3.734386286e-03f,
+    3.007484542e-03f, -2.400037935e-03f, 1.895443390e-03f, -1.479421055e-03f, 1.139490302e-03f, -8.646252767e-04f, 6.450278540e-04f, -4.719766454e-04f,
+    3.377240695e-04f, -2.354223730e-04f, 1.590655970e-04f, -1.034387900e-04f, 6.406889332e-05f, -3.717401051e-05f, 1.960946386e-05f, -8.810267219e-06f,
+  },
+  {
+    -4.272160018e-06f, 1.160649750e-05f, -2.420059182e-05f, 4.422985288e-05f, -7.440025888e-05f, 1.180070302e-04f, -1.789900311e-04f, 2.619856584e-04f,
+    -3.723759419e-04f, 5.163369270e-04f, -7.008902481e-04f, 9.339642973e-04f, -1.224474801e-03f, 1.582439368e-03f, -2.019147347e-03f, 2.547416305e-03f,
+    -3.181981620e-03f, 3.940089530e-03f, -4.842402939e-03f, 5.914394984e-03f, -7.188520744e-03f, 8.707668414e-03f, -1.053079505e-02f, 1.274246738e-02f,
+    -1.546978056e-02f, 1.891418845e-02f, -2.341610493e-02f, 2.959968678e-02f, -3.874412359e-02f, 5.394076384e-02f, -8.503473551e-02f, 1.891009282e-01f,
+    9.553744490e-01f, -1.349779336e-01f, 7.161948562e-02f, -4.788520194e-02f, 3.525759308e-02f, -2.730667941e-02f, 2.177760405e-02f, -1.767674687e-02f,
+    1.449886283e-02f, -1.196011611e-02f, 9.888672488e-03f, -8.174091157e-03f, 6.741699050e-03f, -5.538678111e-03f, 4.526087979e-03f, -3.674092157e-03f,
+    2.959005488e-03f, -2.361422650e-03f, 1.865011272e-03f, -1.455725156e-03f, 1.121288399e-03f, -8.508562850e-04f, 6.347917709e-04f, -4.645168400e-04f,
+    3.324111882e-04f, -2.317394222e-04f, 1.565939655e-04f, -1.018451132e-04f, 6.309274268e-05f, -3.661644377e-05f, 1.932249212e-05f, -8.687299095e-06f,
+  },
+  {
+    -4.182468525e-06f, 1.137748846e-05f, -2.373596791e-05f, 4.339440337e-05f, -7.301055920e-05f, 1.158211424e-04f, -1.756962629e-04f, 2.571904415e-04f,
+    -3.655908726e-04f, 5.069649726e-04f, -6.882110496e-04f, 9.171183779e-04f, -1.202446312e-03f, 1.554036734e-03f, -1.982980778e-03f, 2.501870580e-03f,
+    -3.125181667e-03f, 3.869855060e-03f, -4.756186323e-03f, 5.809193322e-03f, -7.060747613e-03f, 8.552961274e-03f, -1.034371706e-02f, 1.251602926e-02f,
+    -1.519464060e-02f, 1.857724054e-02f, -2.299780747e-02f, 2.906851911e-02f, -3.804349522e-02f, 5.295155463e-02f, -8.342746432e-02f, 1.851542524e-01f,
+    9.570207270e-01f, -1.330195581e-01f, 7.049476169e-02f, -4.711297299e-02f, 3.468172494e-02f, -2.685751297e-02f, 2.141788235e-02f, -1.738402835e-02f,
+    1.425842172e-02f, -1.176163554e-02f, 9.724539669e-03f, -8.038449778e-03f, 6.629891317e-03f, -5.446900967e-03f, 4.451173303e-03f, -3.613361724e-03f,
+    2.910172420e-03f, -2.322522449e-03f, 1.834351994e-03f, -1.431850069e-03f, 1.102946845e-03f, -8.369799314e-04f, 6.244744115e-04f, -4.569965739e-04f,
+    3.270542246e-04f, -2.280250696e-04f, 1.541005700e-04f, -1.002368422e-04f, 6.210719863e-05f, -3.605314349e-05f, 1.903226756e-05f, -8.562680267e-06f,
+  },
+  {
+    -4.092978166e-06f, 1.114846950e-05f, -2.327083756e-05f, 4.255751397e-05f, -7.161785402e-05f, 1.136298062e-04f, -1.723934262e-04f, 2.523809978e-04f,
+    -3.587844536e-04f, 4.975620851e-04f, -6.754883035e-04f, 9.002126176e-04f, -1.180337278e-03f, 1.525527619e-03f, -1.946675644e-03f, 2.456147027e-03f,
+    -3.068156294e-03f, 3.799337932e-03f, -4.669618655e-03f, 5.703559286e-03f, -6.932445721e-03f, 8.397611294e-03f, -1.015586112e-02f, 1.228865268e-02f,
+    -1.491837045e-02f, 1.823893164e-02f, -2.257786882e-02f, 2.853536880e-02f, -3.734047838e-02f, 5.195956127e-02f, -8.181776071e-02f, 1.812192708e-01f,
+    9.586372877e-01f, -1.310376136e-01f, 6.935982890e-02f, -4.633452680e-02f, 3.410150705e-02f, -2.640507863e-02f, 2.105560283e-02f, -1.708925737e-02f,
+    1.401630827e-02f, -1.156177985e-02f, 9.559270627e-03f, -7.901867919e-03f, 6.517305617e-03f, -5.354481919e-03f, 4.375731185e-03f, -3.552200308e-03f,
+    2.860989597e-03f, -2.283340707e-03f, 1.803468196e-03f, -1.407797835e-03f, 1.084467198e-03f, -8.229973820e-04f, 6.140766327e-04f, -4.494164636e-04f,
+    3.216536102e-04f, -2.242796085e-04f, 1.515856025e-04f, -9.861409656e-05f, 6.111233096e-05f, -3.548414665e-05f, 1.873880677e-05f, -8.436415688e-06f,
+  },
+  {
+    -4.003698852e-06f, 1.091946563e-05f, -2.280525110e-05f, 4.171927458e-05f, -7.022229194e-05f, 1.114332544e-04f, -1.690818699e-04f, 2.475578330e-04f,
+    -3.519573977e-04f, 4.881292455e-04f, -6.627233332e-04f, 8.832487688e-04f, -1.158149984e-03f, 1.496914962e-03f, -1.910235678e-03f, 2.410250341e-03f,
+    -3.010911341e-03f, 3.728545355e-03f, -4.582708769e-03f, 5.597503636e-03f, -6.803628123e-03f, 8.241634264e-03f, -9.967246303e-03f, 1.206036072e-02f,
+    -1.464099816e-02f, 1.789929612e-02f, -2.215633165e-02f, 2.800029005e-02f, -3.663514452e-02f, 5.096488382e-02f, -8.020577946e-02f, 1.772961666e-01f,
+    9.602240373e-01f, -1.290321348e-01f, 6.821476178e-02f, -4.554992391e-02f, 3.351698749e-02f, -2.594941501e-02f, 2.069079697e-02f, -1.679245981e-02f,
+    1.377254385e-02f, -1.136056675e-02f, 9.392880014e-03f, -7.764357688e-03f, 6.403951917e-03f, -5.261429133e-03f, 4.299768271e-03f, -3.490613277e-03f,
+    2.811461316e-03f, -2.243880829e-03f, 1.772362549e-03f, -1.383570519e-03f, 1.065851029e-03f, -8.089098150e-04f, 6.035993012e-04f, -4.417771323e-04f,
+    3.162097824e-04f, -2.205033360e-04f, 1.490492574e-04f, -9.697699767e-05f, 6.010821063e-05f, -3.490949095e-05f, 1.844212675e-05f, -8.308510526e-06f,
+  },
+  {
+    -3.914640403e-06f, 1.069050176e-05f, -2.233925872e-05f, 4.087977490e-05f, -6.882402144e-05f, 1.092317192e-04f, -1.657619427e-04f, 2.427214528e-04f,
+    -3.451104182e-04f, 4.786674360e-04f, -6.499174633e-04f, 8.662285871e-04f, -1.135886720e-03f, 1.468201709e-03f, -1.873664622e-03f, 2.364185222e-03f,
+    -2.953452661e-03f, 3.657484552e-03f, -4.495465520e-03f, 5.491037164e-03f, -6.674307910e-03f, 8.085046020e-03f, -9.777891746e-03f, 1.183117652e-02f,
+    -1.436255184e-02f, 1.755836841e-02f, -2.173323873e-02f, 2.746333717e-02f, -3.592756519e-02f, 4.996762238e-02f, -7.859167502e-02f, 1.733851224e-01f,
+    9.617808840e-01f, -1.270031584e-01f, 6.705963596e-02f, -4.475922559e-02f, 3.292821478e-02f, -2.549056113e-02f, 2.032349650e-02f, -1.649366174e-02f,
+    1.352715001e-02f, -1.115801408e-02f, 9.225382605e-03f, -7.625931293e-03f, 6.289840270e-03f, -5.167750846e-03f, 4.223291267e-03f, -3.428606046e-03f,
+    2.761591915e-03f, -2.204146255e-03f, 1.741037745e-03f, -1.359170204e-03f, 1.047099927e-03f, -7.947184216e-04f, 5.930432930e-04f, -4.340792106e-04f,
+    3.107231832e-04f, -2.166965532e-04f, 1.464917320e-04f, -9.532566869e-05f, 5.909490975e-05f, -3.432921482e-05f, 1.814224494e-05f, -8.178970168e-06f,
+  },
+  {
+    -3.825812551e-06f, 1.046160266e-05f, -2.187291046e-05f, 4.003910449e-05f, -6.742319080e-05f, 1.070254331e-04f, -1.624339935e-04f, 2.378723635e-04f,
+    -3.382442290e-04f, 4.691776397e-04f, -6.370720202e-04f, 8.491538302e-04f, -1.113549779e-03f, 1.439390809e-03f, -1.836966226e-03f, 2.317956383e-03f,
+    -2.895786121e-03f, 3.586162766e-03f, -4.407897784e-03f, 5.384170687e-03f, -6.544498203e-03f, 7.927862434e-03f, -9.587816630e-03f, 1.160112330e-02f,
+    -1.408305970e-02f, 1.721618305e-02f, -2.130863294e-02f, 2.692456460e-02f, -3.521781201e-02f, 4.896787703e-02f, -7.697560152e-02f, 1.694863194e-01f,
+    9.633077377e-01f, -1.249507225e-01f, 6.589452818e-02f, -4.396249378e-02f, 3.233523797e-02f, -2.502855634e-02f, 1.995373348e-02f, -1.619288949e-02f,
+    1.328014847e-02f, -1.095413982e-02f, 9.056793298e-03f, -7.486601050e-03f, 6.174980817e-03f, -5.073455365e-03f, 4.146306937e-03f, -3.366184082e-03f,
+    2.711385771e-03f, -2.164140452e-03f, 1.709496504e-03f, -1.334598994e-03f, 1.028215496e-03f, -7.804244046e-04f, 5.824094934e-04f, -4.263233359e-04f,
+    3.051942603e-04f, -2.128595646e-04f, 1.439132260e-04f, -9.366023454e-05f, 5.807250160e-05f, -3.374335740e-05f, 1.783917916e-05f, -8.047800219e-06f,
+  },
+  {
+    -3.737224937e-06f, 1.023279298e-05f, -2.140625618e-05f, 3.919735269e-05f, -6.601994814e-05f, 1.048146282e-04f, -1.590983709e-04f, 2.330110710e-04f,
+    -3.313595442e-04f, 4.596608405e-04f, -6.241883318e-04f, 8.320262583e-04f, -1.091141457e-03f, 1.410485219e-03f, -1.800144244e-03f, 2.271568545e-03f,
+    -2.837917598e-03f, 3.514587255e-03f, -4.320014459e-03f, 5.276915047e-03f, -6.414212158e-03f, 7.770099419e-03f, -9.397040181e-03f, 1.137022431e-02f,
+    -1.380254997e-02f, 1.687277462e-02f, -2.088255720e-02f, 2.638402682e-02f, -3.450595667e-02f, 4.796574787e-02f, -7.535771275e-02f, 1.655999378e-01f,
+    9.648045099e-01f, -1.228748670e-01f, 6.471951629e-02f, -4.315979115e-02f, 3.173810657e-02f, -2.456344038e-02f, 1.958154022e-02f, -1.589016958e-02f,
+    1.303156116e-02f, -1.074896212e-02f, 8.887127119e-03f, -7.346379374e-03f, 6.059383782e-03f, -4.978551069e-03f, 4.068822102e-03f, -3.303352897e-03f,
+    2.660847298e-03f, -2.123866924e-03f, 1.677741572e-03f, -1.309859013e-03f, 1.009199357e-03f, -7.660289796e-04f, 5.716987972e-04f, -4.185101528e-04f,
+    2.996234661e-04f, -2.089926786e-04f, 1.413139417e-04f, -9.198082191e-05f, 5.704106063e-05f, -3.315195855e-05f, 1.753294767e-05f, -7.915006502e-06f,
+  },
+  {
+    -3.648887113e-06f, 1.000409726e-05f, -2.093934561e-05f, 3.835460869e-05f, -6.461444137e-05f, 1.025995364e-04f, -1.557554236e-04f, 2.281380817e-04f,
+    -3.244570782e-04f, 4.501180229e-04f, -6.112677272e-04f, 8.148476335e-04f, -1.068664055e-03f, 1.381487896e-03f, -1.763202440e-03f, 2.225026440e-03f,
+    -2.779852982e-03f, 3.442765291e-03f, -4.231824461e-03f, 5.169281111e-03f, -6.283462959e-03f, 7.611772925e-03f, -9.205581674e-03f, 1.113850287e-02f,
+    -1.352105099e-02f, 1.652817780e-02f, -2.045505454e-02f, 2.584177842e-02f, -3.379207093e-02f, 4.696133498e-02f, -7.373816216e-02f, 1.617261568e-01f,
+    9.662711139e-01f, -1.207756331e-01f, 6.353467924e-02f, -4.235118102e-02f, 3.113687056e-02f, -2.409525331e-02f, 1.920694930e-02f, -1.558552877e-02f,
+    1.278141017e-02f, -1.054249928e-02f, 8.716399211e-03f, -7.205278782e-03f, 5.943059475e-03f, -4.883046406e-03f, 3.990843641e-03f, -3.240118049e-03f,
+    2.609980951e-03f, -2.083329200e-03f, 1.645775717e-03f, -1.284952405e-03f, 9.900531441e-04f, -7.515333738e-04f, 5.609121083e-04f, -4.106403127e-04f,
+    2.940112584e-04f, -2.050962072e-04f, 1.386940843e-04f, -9.028755927e-05f, 5.600066241e-05f, -3.255505885e-05f, 1.722356916e-05f, -7.780595056e-06f,
+  },
+  {
+    -3.560808538e-06f, 9.775539881e-06f, -2.047222828e-05f, 3.751096144e-05f, -6.320681818e-05f, 1.003803897e-04f, -1.524055000e-04f, 2.232539018e-04f,
+    -3.175375460e-04f, 4.405501723e-04f, -5.983115366e-04f, 7.976197201e-04f, -1.046119875e-03f, 1.352401807e-03f, -1.726144581e-03f, 2.178334804e-03f,
+    -2.721598175e-03f, 3.370704162e-03f, -4.143336724e-03f, 5.061279769e-03f, -6.152263820e-03f, 7.452898937e-03f, -9.013460424e-03f, 1.090598235e-02f,
+    -1.323859112e-02f, 1.618242732e-02f, -2.002616808e-02f, 2.529787407e-02f, -3.307622664e-02f, 4.595473843e-02f, -7.211710282e-02f, 1.578651544e-01f,
+    9.677074648e-01f, -1.186530640e-01f, 6.234009706e-02f, -4.153672742e-02f, 3.053158042e-02f, -2.362403559e-02f, 1.882999359e-02f, -1.527899405e-02f,
+    1.252971778e-02f, -1.033476973e-02f, 8.544624841e-03f, -7.063311891e-03f, 5.826018287e-03f, -4.786949891e-03f, 3.912378491e-03f, -3.176485146e-03f,
+    2.558791221e-03f, -2.042530846e-03f, 1.613601733e-03f, -1.259881335e-03f, 9.707785094e-04f, -7.369388268e-04f, 5.500503399e-04f, -4.027144739e-04f,
+    2.883581001e-04f, -2.011704660e-04f, 1.360538611e-04f, -8.858057683e-05f, 5.495138369e-05f, -3.195269960e-05f, 1.691106271e-05f, -7.644572144e-06f,
+  },
+  {
+    -3.472998581e-06f, 9.547145107e-06f, -2.000495356e-05f, 3.666649971e-05f, -6.179722604e-05f, 9.815741955e-05f, -1.490489485e-04f, 2.183590373e-04f,
+    -3.106016623e-04f, 4.309582744e-04f, -5.853210916e-04f, 7.803442839e-04f, -1.023511222e-03f, 1.323229919e-03f, -1.688974443e-03f, 2.131498386e-03f,
+    -2.663159089e-03f, 3.298411169e-03f, -4.054560201e-03f, 4.952921933e-03f, -6.020627982e-03f, 7.293493474e-03f, -8.820695788e-03f, 1.067268616e-02f,
+    -1.295519882e-02f, 1.583555800e-02f, -1.959594099e-02f, 2.475236850e-02f, -3.235849565e-02f, 4.494605825e-02f, -7.049468747e-02f, 1.540171076e-01f,
+    9.691134793e-01f, -1.165072044e-01f, 6.113585088e-02f, -4.071649504e-02f, 2.992228708e-02f, -2.314982799e-02f, 1.845070623e-02f, -1.497059261e-02f,
+    1.227650642e-02f, -1.012579206e-02f, 8.371819395e-03f, -6.920491419e-03f, 5.708270691e-03f, -4.690270110e-03f, 3.833433642e-03f, -3.112459840e-03f,
+    2.507282639e-03f, -2.001475455e-03f, 1.581222441e-03f, -1.234647984e-03f, 9.513771190e-04f, -7.222465897e-04f, 5.391144141e-04f, -3.947333017e-04f,
+    2.826644589e-04f, -1.972157745e-04f, 1.333934824e-04f, -8.686000655e-05f, 5.389330235e-05f, -3.134492280e-05f, 1.659544784e-05f, -7.506944242e-06f,
+  },
+  {
+    -3.385466515e-06f, 9.318937066e-06f, -1.953757064e-05f, 3.582131203e-05f, -6.038581218e-05f, 9.593085730e-05f, -1.456861172e-04f, 2.134539946e-04f,
+    -3.036501423e-04f, 4.213433153e-04f, -5.722977241e-04f, 7.630230926e-04f, -1.000840406e-03f, 1.293975204e-03f, -1.651695803e-03f, 2.084521937e-03f,
+    -2.604541644e-03f, 3.225893625e-03f, -3.965503860e-03f, 4.844218538e-03f, -5.888568713e-03f, 7.133572589e-03f, -8.627307164e-03f, 1.043863776e-02f,
+    -1.267090256e-02f, 1.548760470e-02f, -1.916441651e-02f, 2.420531653e-02f, -3.163894992e-02f, 4.393539443e-02f, -6.887106843e-02f, 1.501821922e-01f,
+    9.704890759e-01f, -1.143381007e-01f, 5.992202293e-02f, -3.989054926e-02f, 2.930904196e-02f, -2.267267164e-02f, 1.806912062e-02f, -1.466035184e-02f,
+    1.202179872e-02f, -9.915584980e-03f, 8.197998376e-03f, -6.776830178e-03f, 5.589827243e-03f, -4.593015714e-03f, 3.754016144e-03f, -3.048047829e-03f,
+    2.455459770e-03f, -1.960166649e-03f, 1.548640683e-03f, -1.209254555e-03f, 9.318506544e-04f, -7.074579258e-04f, 5.281052622e-04f, -3.866974680e-04f,
+    2.769308077e-04f, -1.932324555e-04f, 1.307131607e-04f, -8.512598211e-05f, 5.282649740e-05f, -3.073177118e-05f, 1.627674445e-05f, -7.367718051e-06f,
+  },
+  {
+    -3.298221522e-06f, 9.090939746e-06f, -1.907012852e-05f, 3.497548673e-05f, -5.897272356e-05f, 9.370093404e-05f, -1.423173540e-04f, 2.085392794e-04f,
+    -2.966837010e-04f, 4.117062816e-04f, -5.592427674e-04f, 7.456579149e-04f, -9.781097351e-04f, 1.264640637e-03f, -1.614312448e-03f, 2.037410220e-03f,
+    -2.545751771e-03f, 3.153158856e-03f, -3.876176687e-03f, 4.735180535e-03f, -5.756099305e-03f, 6.973152364e-03f, -8.433313984e-03f, 1.020386067e-02f,
+    -1.238573089e-02f, 1.513860235e-02f, -1.873163795e-02f, 2.365677302e-02f, -3.091766141e-02f, 4.292284695e-02f, -6.724639765e-02f, 1.463605828e-01f,
+    9.718341749e-01f, -1.121458007e-01f, 5.869869651e-02f, -3.905895612e-02f, 2.869189691e-02f, -2.219260801e-02f, 1.768527044e-02f, -1.434829938e-02f,
+    1.176561748e-02f, -9.704167368e-03f, 8.023177405e-03f, -6.632341080e-03f, 5.470698579e-03f, -4.495195421e-03f, 3.674133097e-03f, -2.983254856e-03f,
+    2.403327218e-03f, -1.918608084e-03f, 1.515859326e-03f, -1.183703270e-03f, 9.122008123e-04f, -6.925741097e-04f, 5.170238243e-04f, -3.786076514e-04f,
+    2.711576243e-04f, -1.892208356e-04f, 1.280131113e-04f, -8.337863893e-05f, 5.175104900e-05f, -3.011328817e-05f, 1.595497290e-05f, -7.226900488e-06f,
+  },
+  {
+    -3.211272688e-06f, 8.863176999e-06f, -1.860267602e-05f, 3.412911188e-05f, -5.755810688e-05f, 9.146788054e-05f, -1.389430066e-04f, 2.036153976e-04f,
+    -2.897030535e-04f, 4.020481601e-04f, -5.461575551e-04f, 7.282505212e-04f, -9.553215232e-04f, 1.235229197e-03f, -1.576828165e-03f, 1.990168001e-03f,
+    -2.486795410e-03f, 3.080214201e-03f, -3.786587681e-03f, 4.625818899e-03f, -5.623233075e-03f, 6.812248910e-03f, -8.238735720e-03f, 9.968378422e-03f,
+    -1.209971241e-02f, 1.478858594e-02f, -1.829764869e-02f, 2.310679290e-02f, -3.019470212e-02f, 4.190851568e-02f, -6.562082666e-02f, 1.425524530e-01f,
+    9.731486983e-01f, -1.099303542e-01f, 5.746595601e-02f, -3.822178232e-02f, 2.807090426e-02f, -2.170967893e-02f, 1.729918962e-02f, -1.403446305e-02f,
+    1.150798566e-02f, -9.491558227e-03f, 7.847372216e-03f, -6.487037131e-03f, 5.350895412e-03f, -4.396818015e-03f, 3.593791659e-03f, -2.918086708e-03f,
+    2.350889625e-03f, -1.876803442e-03f, 1.482881261e-03f, -1.157996369e-03f, 8.924293042e-04f, -6.775964278e-04f, 5.058710495e-04f, -3.704645374e-04f,
+    2.653453916e-04f, -1.851812449e-04f, 1.252935518e-04f, -8.161811415e-05f, 5.066703844e-05f, -2.948951790e-05f, 1.563015393e-05f, -7.084498693e-06f,
+  },
+  {
+    -3.124629006e-06f, 8.635672535e-06f, -1.813526177e-05f, 3.328227532e-05f, -5.614210855e-05f, 8.923192729e-05f, -1.355634223e-04f, 1.986828547e-04f,
+    -2.827089147e-04f, 3.923699376e-04f, -5.330434212e-04f, 7.108026826e-04f, -9.324780842e-04f, 1.205743865e-03f, -1.539246748e-03f, 1.942800052e-03f,
+    -2.427678509e-03f, 3.007067008e-03f, -3.696745856e-03f, 4.516144618e-03f, -5.489983361e-03f, 6.650878367e-03f, -8.043591873e-03f, 9.732214617e-03f,
+    -1.181287576e-02f, 1.443759050e-02f, -1.786249215e-02f, 2.255543116e-02f, -2.947014410e-02f, 4.089250048e-02f, -6.399450660e-02f, 1.387579752e-01f,
+    9.744325698e-01f, -1.076918124e-01f, 5.622388687e-02f, -3.737909525e-02f, 2.744611679e-02f, -2.122392653e-02f, 1.691091235e-02f, -1.371887088e-02f,
+    1.124892640e-02f, -9.277776698e-03f, 7.670598659e-03f, -6.340931433e-03f, 5.230428537e-03f, -4.297892346e-03f, 3.512999041e-03f, -2.852549217e-03f,
+    2.298151665e-03f, -1.834756436e-03f, 1.449709403e-03f, -1.132136112e-03f, 8.725378563e-04f, -6.625261780e-04f, 4.946478956e-04f, -3.622688179e-04f,
+    2.594945972e-04f, -1.811140171e-04f, 1.225547025e-04f, -7.984454662e-05f, 4.957454812e-05f, -2.886050522e-05f, 1.530230872e-05f, -6.940520022e-06f,
+  },
+  {
+    -3.038299372e-06f, 8.408449920e-06f, -1.766793420e-05f, 3.243506465e-05f, -5.472487469e-05f, 8.699330443e-05f, -1.321789480e-04f, 1.937421559e-04f,
+    -2.757019994e-04f, 3.826726011e-04f, -5.199017005e-04f, 6.933161712e-04f, -9.095817339e-04f, 1.176187626e-03f, -1.501571994e-03f, 1.895311154e-03f,
+    -2.368407022e-03f, 2.933724635e-03f, -3.606660238e-03f, 4.406168701e-03f, -5.356363524e-03f, 6.489056900e-03f, -7.847901978e-03f, 9.495392880e-03f,
+    -1.152524962e-02f, 1.408565113e-02f, -1.742621182e-02f, 2.200274281e-02f, -2.874405938e-02f, 3.987490110e-02f, -6.236758815e-02f, 1.349773206e-01f,
+    9.756857150e-01f, -1.054302280e-01f, 5.497257563e-02f, -3.653096293e-02f, 2.681758773e-02f, -2.073539331e-02f, 1.652047309e-02f, -1.340155112e-02f,
+    1.098846298e-02f, -9.062842063e-03f, 7.492872696e-03f, -6.194037179e-03f, 5.109308823e-03f, -4.198427326e-03f, 3.431762506e-03f, -2.786648260e-03f,
+    2.245118050e-03f, -1.792470807e-03f, 1.416346690e-03f, -1.106124775e-03f, 8.525282095e-04f, -6.473646695e-04f, 4.833553292e-04f, -3.540211916e-04f,
+    2.536057335e-04f, -1.770194893e-04f, 1.197967860e-04f, -7.805807687e-05f, 4.847366157e-05f, -2.822629567e-05f, 1.497145883e-05f, -6.794972055e-06f,
+  },
+  {
+    -2.952292586e-06f, 8.181532576e-06f, -1.720074154e-05f, 3.158756718e-05f, -5.330655107e-05f, 8.475224174e-05f, -1.287899304e-04f, 1.887938062e-04f,
+    -2.686830221e-04f, 3.729571374e-04f, -5.067337277e-04f, 6.757927598e-04f, -8.866347894e-04f, 1.146563465e-03f, -1.463807704e-03f, 1.847706088e-03f,
+    -2.308986912e-03f, 2.860194451e-03f, -3.516339867e-03f, 4.295902170e-03f, -5.222386943e-03f, 6.326800698e-03f, -7.651685599e-03f, 9.257936873e-03f,
+    -1.123686271e-02f, 1.373280295e-02f, -1.698885122e-02f, 2.144878294e-02f, -2.801652006e-02f, 3.885581723e-02f, -6.074022160e-02f, 1.312106593e-01f,
+    9.769080613e-01f, -1.031456557e-01f, 5.371210988e-02f, -3.567745403e-02f, 2.618537077e-02f, -2.024412206e-02f, 1.612790653e-02f, -1.308253221e-02f,
+    1.072661887e-02f, -8.846773733e-03f, 7.314210400e-03f, -6.046367656e-03f, 4.987547217e-03f, -4.098431933e-03f, 3.350089369e-03f, -2.720389754e-03f,
+    2.191793529e-03f, -1.749950326e-03f, 1.382796082e-03f, -1.079964656e-03f, 8.324021193e-04f, -6.321132226e-04f, 4.719943253e-04f, -3.457223635e-04f,
+    2.476792980e-04f, -1.728980022e-04f, 1.170200274e-04f, -7.625884714e-05f, 4.736446343e-05f, -2.758693550e-05f, 1.463762627e-05f, -6.647862592e-06f,
+  },
+  {
+    -2.866617350e-06f, 7.954943777e-06f, -1.673373181e-05f, 3.073986999e-05f, -5.188728319e-05f, 8.250896865e-05f, -1.253967158e-04f, 1.838383100e-04f,
+    -2.616526971e-04f, 3.632245333e-04f, -4.935408376e-04f, 6.582342218e-04f, -8.636395692e-04f, 1.116874370e-03f, -1.425957680e-03f, 1.799989643e-03f,
+    -2.249424146e-03f, 2.786483831e-03f, -3.425793793e-03f, 4.185356063e-03f, -5.088067017e-03f, 6.164125975e-03f, -7.454962328e-03f, 9.019870291e-03f,
+    -1.094774381e-02f, 1.337908115e-02f, -1.655045392e-02f, 2.089360664e-02f, -2.728759819e-02f, 3.783534846e-02f, -5.911255677e-02f, 1.274581601e-01f,
+    9.780995377e-01f, -1.008381516e-01f, 5.244257828e-02f, -3.481863787e-02f, 2.554952001e-02f, -1.975015593e-02f, 1.573324765e-02f, -1.276184279e-02f,
+    1.046341769e-02f, -8.629591257e-03f, 7.134627954e-03f, -5.897936242e-03f, 4.865154743e-03f, -3.997915204e-03f, 3.267986999e-03f, -2.653779661e-03f,
+    2.138182883e-03f, -1.707198791e-03f, 1.349060563e-03f, -1.053658069e-03f, 8.121613553e-04f, -6.167731691e-04f, 4.605658678e-04f, -3.373730450e-04f,
+    2.417157928e-04f, -1.687498999e-04f, 1.142246544e-04f, -7.444700135e-05f, 4.624703946e-05f, -2.694247165e-05f, 1.430083343e-05f, -6.499199652e-06f,
+  },
+  {
+    -2.781282270e-06f, 7.728706648e-06f, -1.626695283e-05f, 2.989205985e-05f, -5.046721617e-05f, 8.026371416e-05f, -1.219996499e-04f, 1.788761714e-04f,
+    -2.546117381e-04f, 3.534757752e-04f, -4.803243652e-04f, 6.406423309e-04f, -8.405983924e-04f, 1.087123333e-03f, -1.388025730e-03f, 1.752166611e-03f,
+    -2.189724700e-03f, 2.712600160e-03f, -3.335031076e-03f, 4.074541430e-03f, -4.953417159e-03f, 6.001048965e-03f, -7.257751783e-03f, 8.781216860e-03f,
+    -1.065792170e-02f, 1.302452093e-02f, -1.611106354e-02f, 2.033726906e-02f, -2.655736587e-02f, 3.681359429e-02f, -5.748474300e-02f, 1.237199907e-01f,
+    9.792600750e-01f, -9.850777348e-02f, 5.116407055e-02f, -3.395458443e-02f, 2.491009001e-02f, -1.925353838e-02f, 1.533653163e-02f, -1.243951170e-02f,
+    1.019888324e-02f, -8.411314312e-03f, 6.954141649e-03f, -5.748756404e-03f, 4.742142496e-03f, -3.896886242e-03f, 3.185462815e-03f, -2.586823985e-03f,
+    2.084290928e-03f, -1.664220029e-03f, 1.315143140e-03f, -1.027207345e-03f, 7.918077013e-04f, -6.013458515e-04f, 4.490709489e-04f, -3.289739543e-04f,
+    2.357157247e-04f, -1.645755300e-04f, 1.114108969e-04f, -7.262268508e-05f, 4.512147651e-05f, -2.629295177e-05f, 1.396110314e-05f, -6.348991477e-06f,
+  },
+  {
+    -2.696295854e-06f, 7.502844163e-06f, -1.580045219e-05f, 2.904422327e-05f, -4.904649477e-05f, 7.801670686e-05f, -1.185990780e-04f, 1.739078939e-04f,
+    -2.475608586e-04f, 3.437118492e-04f, -4.670856453e-04f, 6.230188610e-04f, -8.175135790e-04f, 1.057313343e-03f, -1.350015663e-03f, 1.704241787e-03f,
+    -2.129894552e-03f, 2.638550829e-03f, -3.244060788e-03f, 3.963469336e-03f, -4.818450802e-03f, 5.837585920e-03f, -7.060073605e-03f, 8.542000335e-03f,
+    -1.036742522e-02f, 1.266915754e-02f, -1.567072372e-02f, 1.977982536e-02f, -2.582589516e-02f, 3.579065411e-02f, -5.585692922e-02f, 1.199963176e-01f,
+    9.803896060e-01f, -9.615458066e-02f, 4.987667744e-02f, -3.308536430e-02f, 2.426713577e-02f, -1.875431317e-02f, 1.493779393e-02f, -1.211556797e-02f,
+    9.933039440e-03f, -8.191962704e-03f, 6.772767882e-03f, -5.598841697e-03f, 4.618521649e-03f, -3.795354209e-03f, 3.102524285e-03f, -2.519528769e-03f,
+    2.030122514e-03f, -1.621017893e-03f, 1.281046841e-03f, -1.000614835e-03f, 7.713429553e-04f, -5.858326235e-04f, 4.375105691e-04f, -3.205258155e-04f,
+    2.296796053e-04f, -1.603752435e-04f, 1.085789875e-04f, -7.078604557e-05f, 4.398786254e-05f, -2.563842419e-05f, 1.361845862e-05f, -6.197246526e-06f,
+  },
+  {
+    -2.611666509e-06f, 7.277379143e-06f, -1.533427728e-05f, 2.819644645e-05f, -4.762526340e-05f, 7.576817491e-05f, -1.151953449e-04f, 1.689339808e-04f,
+    -2.405007713e-04f, 3.339337409e-04f, -4.538260122e-04f, 6.053655859e-04f, -7.943874493e-04f, 1.027447394e-03f, -1.311931288e-03f, 1.656219971e-03f,
+    -2.069939685e-03f, 2.564343237e-03f, -3.152892008e-03f, 3.852150853e-03f, -4.683181391e-03f, 5.673753113e-03f, -6.861947457e-03f, 8.302244496e-03f,
+    -1.007628324e-02f, 1.231302627e-02f, -1.522947813e-02f, 1.922133073e-02f, -2.509325812e-02f, 3.476662718e-02f, -5.422926382e-02f, 1.162873061e-01f,
+    9.814880651e-01f, -9.377863422e-02f, 4.858049078e-02f, -3.221104871e-02f, 2.362071270e-02f, -1.825252441e-02f, 1.453707025e-02f, -1.179004084e-02f,
+    9.665910395e-03f, -7.971556368e-03f, 6.590523157e-03f, -5.448205765e-03f, 4.494303444e-03f, -3.693328325e-03f, 3.019178929e-03f, -2.451900101e-03f,
+    1.975682527e-03f, -1.577596265e-03f, 1.246774717e-03f, -9.738829067e-04f, 7.507689290e-04f, -5.702348493e-04f, 4.258857373e-04f, -3.120293592e-04f,
+    2.236079509e-04f, -1.561493948e-04f, 1.057291609e-04f, -6.893723171e-05f, 4.284628659e-05f, -2.497893793e-05f, 1.327292350e-05f, -6.043973484e-06f,
+  },
+  {
+    -2.527402546e-06f, 7.052334254e-06f, -1.486847526e-05f, 2.734881531e-05f, -4.620366609e-05f, 7.351834599e-05f, -1.117887950e-04f, 1.639549343e-04f,
+    -2.334321886e-04f, 3.241424355e-04f, -4.405468001e-04f, 5.876842794e-04f, -7.712223241e-04f, 9.975284779e-04f, -1.273776417e-03f, 1.608105964e-03f,
+    -2.009866089e-03f, 2.489984786e-03f, -3.061533821e-03f, 3.740597069e-03f, -4.547622384e-03f, 5.509566830e-03f, -6.663393024e-03f, 8.061973146e-03f,
+    -9.784524625e-03f, 1.195616244e-02f, -1.478737049e-02f, 1.866184036e-02f, -2.435952680e-02f, 3.374161267e-02f, -5.260189475e-02f, 1.125931201e-01f,
+    9.825553884e-01f, -9.137999678e-02f, 4.727560342e-02f, -3.133170952e-02f, 2.297087664e-02f, -1.774821649e-02f, 1.413439651e-02f, -1.146295970e-02f,
+    9.397520354e-03f, -7.750115364e-03f, 6.407424079e-03f, -5.296862337e-03f, 4.369499195e-03f, -3.590817874e-03f, 2.935434314e-03f, -2.383944106e-03f,
+    1.920975883e-03f, -1.533959054e-03f, 1.212329838e-03f, -9.470139444e-04f, 7.300874478e-04f, -5.545539041e-04f, 4.141974707e-04f, -3.034853222e-04f,
+    2.175012824e-04f, -1.518983415e-04f, 1.028616544e-04f, -6.707639404e-05f, 4.169683880e-05f, -2.431454270e-05f, 1.292452183e-05f, -5.889181254e-06f,
+  },
+  {
+    -2.443512174e-06f, 6.827732004e-06f, -1.440309306e-05f, 2.650141545e-05f, -4.478184645e-05f, 7.126744730e-05f, -1.083797719e-04f, 1.589712563e-04f,
+    -2.263558219e-04f, 3.143389175e-04f, -4.272493424e-04f, 5.699767149e-04f, -7.480205238e-04f, 9.675595889e-04f, -1.235554865e-03f, 1.559904568e-03f,
+    -1.949679753e-03f, 2.415482885e-03f, -2.969995322e-03f, 3.628819076e-03f, -4.411787252e-03f, 5.345043376e-03f, -6.464430007e-03f, 7.821210113e-03f,
+    -9.492178304e-03f, 1.159860137e-02f, -1.434444451e-02f, 1.810140947e-02f, -2.362477321e-02f, 3.271570958e-02f, -5.097496943e-02f, 1.089139226e-01f,
+    9.835915142e-01f, -8.895873263e-02f, 4.596210926e-02f, -3.044741920e-02f, 2.231768386e-02f, -1.724143411e-02f, 1.372980888e-02f, -1.113435417e-02f,
+    9.127893717e-03f, -7.527659875e-03f, 6.223487360e-03f, -5.144825227e-03f, 4.244120289e-03f, -3.487832196e-03f, 2.851298059e-03f, -2.315666950e-03f,
+    1.866007532e-03f, -1.490110193e-03f, 1.177715301e-03f, -9.200103506e-04f, 7.093003508e-04f, -5.387911735e-04f, 4.024467946e-04f, -2.948944474e-04f,
+    2.113601251e-04f, -1.476224448e-04f, 9.997670761e-05f, -6.520368471e-05f, 4.053961037e-05f, -2.364528890e-05f, 1.257327805e-05f, -5.732878959e-06f,
+  },
+  {
+    -2.360003501e-06f, 6.603594743e-06f, -1.393817738e-05f, 2.565433215e-05f, -4.335994771e-05f, 6.901570553e-05f, -1.049686188e-04f, 1.539834481e-04f,
+    -2.192723823e-04f, 3.045241705e-04f, -4.139349721e-04f, 5.522446653e-04f, -7.247843689e-04f, 9.375437209e-04f, -1.197270446e-03f, 1.511620590e-03f,
+    -1.889386673e-03f, 2.340844948e-03f, -2.878285610e-03f, 3.516827977e-03f, -4.275689476e-03f, 5.180199065e-03f, -6.265078124e-03f, 7.579979239e-03f,
+    -9.199273206e-03f, 1.124037842e-02f, -1.390074394e-02f, 1.754009328e-02f, -2.288906932e-02f, 3.168901679e-02f, -4.934863480e-02f, 1.052498751e-01f,
+    9.845963821e-01f, -8.651490765e-02f, 4.464010321e-02f, -2.955825086e-02f, 2.166119102e-02f, -1.673222230e-02f, 1.332334375e-02f, -1.080425404e-02f,
+    8.857055034e-03f, -7.304210209e-03f, 6.038729808e-03f, -4.992108333e-03f, 4.118178180e-03f, -3.384380687e-03f, 2.766777826e-03f, -2.247074840e-03f,
+    1.810782456e-03f, -1.446053645e-03f, 1.142934218e-03f, -8.928745443e-04f, 6.884094904e-04f, -5.229480536e-04f, 3.906347421e-04f, -2.862574838e-04f,
+    2.051850090e-04f, -1.433220691e-04f, 9.707456241e-05f, -6.331925750e-05f, 3.937469361e-05f, -2.297122761e-05f, 1.221921703e-05f, -5.575075946e-06f,
+  },
+  {
+    -2.276884536e-06f, 6.379944662e-06f, -1.347377468e-05f, 2.480765038e-05f, -4.193811265e-05f, 6.676334683e-05f, -1.015556781e-04f, 1.489920099e-04f,
+    -2.121825796e-04f, 2.946991776e-04f, -4.006050210e-04f, 5.344899027e-04f, -7.015161792e-04f, 9.074838675e-04f, -1.158926974e-03f, 1.463258836e-03f,
+    -1.828992844e-03f, 2.266078389e-03f, -2.786413790e-03f, 3.404634881e-03f, -4.139342546e-03f, 5.015050227e-03f, -6.065357106e-03f, 7.338304386e-03f,
+    -8.905838281e-03f, 1.088152897e-02f, -1.345631255e-02f, 1.697794700e-02f, -2.215248709e-02f, 3.066163302e-02f, -4.772303724e-02f, 1.016011379e-01f,
+    9.855699338e-01f, -8.404858935e-02f, 4.330968125e-02f, -2.866427819e-02f, 2.100145523e-02f, -1.622062636e-02f, 1.291503776e-02f, -1.047268926e-02f,
+    8.585029001e-03f, -7.079786790e-03f, 5.853168333e-03f, -4.838725635e-03f, 3.991684391e-03f, -3.280472804e-03f, 2.681881328e-03f, -2.178174020e-03f,
+    1.755305669e-03f, -1.401793396e-03f, 1.107989726e-03f, -8.656089612e-04f, 6.674167322e-04f, -5.070259509e-04f, 3.787623547e-04f, -2.775751866e-04f,
+    1.989764686e-04f, -1.389975819e-04f, 9.415546309e-05f, -6.142326779e-05f, 3.820218186e-05f, -2.229241058e-05f, 1.186236403e-05f, -5.415781779e-06f,
+  },
+  {
+    -2.194163186e-06f, 6.156803786e-06f, -1.300993120e-05f, 2.396145476e-05f, -4.051648362e-05f, 6.451059682e-05f, -9.814129169e-05f, 1.439974414e-04f,
+    -2.050871231e-04f, 2.848649205e-04f, -3.872608203e-04f, 5.167141985e-04f, -6.782182740e-04f, 8.773830223e-04f, -1.120528264e-03f, 1.414824112e-03f,
+    -1.768504264e-03f, 2.191190629e-03f, -2.694388971e-03f, 3.292250903e-03f, -4.002759959e-03f, 4.849613197e-03f, -5.865286698e-03f, 7.096209430e-03f,
+    -8.611902499e-03f, 1.052208841e-02f, -1.301119409e-02f, 1.641502584e-02f, -2.141509841e-02f, 2.963365684e-02f, -4.609832265e-02f, 9.796787014e-02f,
+    9.865121129e-01f, -8.155984686e-02f, 4.197094034e-02f, -2.776557549e-02f, 2.033853396e-02f, -1.570669190e-02f, 1.250492776e-02f, -1.013969000e-02f,
+    8.311840460e-03f, -6.854410164e-03f, 5.666819943e-03f, -4.684691196e-03f, 3.864650513e-03f, -3.176118056e-03f, 2.596616323e-03f, -2.108970773e-03f,
+    1.699582216e-03f, -1.357333460e-03f, 1.072884982e-03f, -8.382160537e-04f, 6.463239550e-04f, -4.910262820e-04f, 3.668306815e-04f, -2.688483168e-04f,
+    1.927350429e-04f, -1.346493541e-04f, 9.121965621e-05f, -5.951587256e-05f, 3.702216955e-05f, -2.160889025e-05f, 1.150274470e-05f, -5.255006247e-06f,
+  },
+  {
+    -2.111847255e-06f, 5.934193979e-06f, -1.254669292e-05f, 2.311582959e-05f, -3.909520253e-05f, 6.225768054e-05f, -9.472580056e-05f, 1.390002415e-04f,
+    -1.979867211e-04f, 2.750223804e-04f, -3.739037001e-04f, 4.989193229e-04f, -6.548929716e-04f, 8.472441778e-04f, -1.082078130e-03f, 1.366321227e-03f,
+    -1.707926933e-03f, 2.116189088e-03f, -2.602220265e-03f, 3.179687163e-03f, -3.865955221e-03f, 4.683904324e-03f, -5.664886655e-03f, 6.853718258e-03f,
+    -8.317494838e-03f, 1.016209215e-02f, -1.256543235e-02f, 1.585138500e-02f, -2.067697512e-02f, 2.860518664e-02f, -4.447463634e-02f, 9.435022955e-02f,
+    9.874228645e-01f, -7.904875093e-02f, 4.062397848e-02f, -2.686221768e-02f, 1.967248513e-02f, -1.519046482e-02f, 1.209305083e-02f, -9.805286561e-03f,
+    8.037514394e-03f, -6.628100992e-03f, 5.479701741e-03f, -4.530019156e-03f, 3.737088204e-03f, -3.071326010e-03f, 2.510990613e-03f, -2.039471418e-03f,
+    1.643617174e-03f, -1.312677874e-03f, 1.037623162e-03f, -8.106982903e-04f, 6.251330504e-04f, -4.749504738e-04f, 3.548407793e-04f, -2.600776413e-04f,
+    1.864612751e-04f, -1.302777599e-04f, 8.826739064e-05f, -5.759723037e-05f, 3.583475216e-05f, -2.092071973e-05f, 1.114038513e-05f, -5.092759356e-06f,
+  },
+  {
+    -2.029944445e-06f, 5.712136939e-06f, -1.208410557e-05f, 2.227085881e-05f, -3.767441083e-05f, 6.000482243e-05f, -9.130954513e-05f, 1.340009080e-04f,
+    -1.908820807e-04f, 2.651725370e-04f, -3.605349893e-04f, 4.811070451e-04f, -6.315425891e-04f, 8.170703258e-04f, -1.043580386e-03f, 1.317754987e-03f,
+    -1.647266849e-03f, 2.041081189e-03f, -2.509916788e-03f, 3.066954785e-03f, -3.728941841e-03f, 4.517939959e-03f, -5.464176739e-03f, 6.610854766e-03f,
+    -8.022644289e-03f, 9.801575591e-03f, -1.211907110e-02f, 1.528707968e-02f, -1.993818902e-02f, 2.757632065e-02f, -4.285212312e-02f, 9.074837268e-02f,
+    9.883021359e-01f, -7.651537390e-02f, 3.926889467e-02f, -2.595428026e-02f, 1.900336700e-02f, -1.467199129e-02f, 1.167944426e-02f, -9.469509454e-03f,
+    7.762075928e-03f, -6.400880051e-03f, 5.291830925e-03f, -4.374723735e-03f, 3.609009185e-03f, -2.966106286e-03f, 2.425012048e-03f, -1.969682314e-03f,
+    1.587415651e-03f, -1.267830700e-03f, 1.002207463e-03f, -7.830581559e-04f, 6.038459227e-04f, -4.587999629e-04f, 3.427937130e-04f, -2.512639330e-04f,
+    1.801557130e-04f, -1.258831766e-04f, 8.529891750e-05f, -5.566750134e-05f, 3.464002620e-05f, -2.022795277e-05f, 1.077531178e-05f, -4.929051335e-06f,
+  },
+  {
+    -1.948462357e-06f, 5.490654193e-06f, -1.162221464e-05f, 2.142662602e-05f, -3.625424947e-05f, 5.775224631e-05f, -8.789286501e-05f, 1.289999381e-04f,
+    -1.837739082e-04f, 2.553163689e-04f, -3.471560152e-04f, 4.632791328e-04f, -6.081694425e-04f, 7.868644569e-04f, -1.005038846e-03f, 1.269130200e-03f,
+    -1.586530012e-03f, 1.965874354e-03f, -2.417487654e-03f, 2.954064895e-03f, -3.591733333e-03f, 4.351736461e-03f, -5.263176722e-03f, 6.367642861e-03f,
+    -7.727379849e-03f, 9.440574156e-03f, -1.167215411e-02f, 1.472216502e-02f, -1.919881182e-02f, 2.654715690e-02f, -4.123092719e-02f, 8.716245477e-02f,
+    9.891498758e-01f, -7.395978974e-02f, 3.790578892e-02f, -2.504183930e-02f, 1.833123828e-02f, -1.415131780e-02f, 1.126414557e-02f, -9.132389344e-03f,
+    7.485550322e-03f, -6.172768229e-03f, 5.103224788e-03f, -4.218819231e-03f, 3.480425244e-03f, -2.860468557e-03f, 2.338688521e-03f, -1.899609855e-03f,
+    1.530982781e-03f, -1.222796027e-03f, 9.666411026e-04f, -7.552981509e-04f, 5.824644891e-04f, -4.425761960e-04f, 3.306905546e-04f, -2.424079705e-04f,
+    1.738189085e-04f, -1.214659845e-04f, 8.231449017e-05f, -5.372684717e-05f, 3.343808924e-05f, -1.953064384e-05f, 1.040755152e-05f, -4.763892633e-06f,
+  },
+  {
+    -1.867408486e-06f, 5.269767101e-06f, -1.116106536e-05f, 2.058321444e-05f, -3.483485894e-05f, 5.550017538e-05f, -8.447609901e-05f, 1.239978277e-04f,
+    -1.766629085e-04f, 2.454548535e-04f, -3.337681041e-04f, 4.454373522e-04f, -5.847758458e-04f, 7.566295600e-04f, -9.664573198e-04f, 1.220451670e-03f,
+    -1.525722420e-03f, 1.890576006e-03f, -2.324941980e-03f, 2.841028620e-03f, -3.454343213e-03f, 4.185310192e-03f, -5.061906377e-03f, 6.124106452e-03f,
+    -7.431730521e-03f, 9.079123261e-03f, -1.122472516e-02f, 1.415669618e-02f, -1.845891516e-02f, 2.551779323e-02f, -3.961119223e-02f, 8.359262976e-02f,
+    9.899660351e-01f, -7.138207402e-02f, 3.653476225e-02f, -2.412497149e-02f, 1.765615802e-02f, -1.362849108e-02f, 1.084719249e-02f, -8.793957066e-03f,
+    7.207962975e-03f, -5.943786527e-03f, 4.913900713e-03f, -4.062320017e-03f, 3.351348231e-03f, -2.754422550e-03f, 2.252027968e-03f, -1.829260472e-03f,
+    1.474323733e-03f, -1.177577965e-03f, 9.309273160e-04f, -7.274207916e-04f, 5.609906787e-04f, -4.262806293e-04f, 3.185323841e-04f, -2.335105381e-04f,
+    1.674514179e-04f, -1.170265673e-04f, 7.931436427e-05f, -5.177543110e-05f, 3.222903989e-05f, -1.882884802e-05f, 1.003713163e-05f, -4.597293918e-06f,
+  },
+  {
+    -1.786790226e-06f, 5.049496854e-06f, -1.070070270e-05f, 1.974070694e-05f, -3.341637920e-05f, 5.324883218e-05f, -8.105958510e-05f, 1.189950718e-04f,
+    -1.695497855e-04f, 2.355889667e-04f, -3.203725805e-04f, 4.275834677e-04f, -5.613641116e-04f, 7.263686222e-04f, -9.278396179e-04f, 1.171724201e-03f,
+    -1.464850071e-03f, 1.815193568e-03f, -2.232288885e-03f, 2.727857089e-03f, -3.316784999e-03f, 4.018677516e-03f, -4.860385481e-03f, 5.880269451e-03f,
+    -7.135725307e-03f, 8.717258321e-03f, -1.077682799e-02f, 1.359072826e-02f, -1.771857063e-02f, 2.448832730e-02f, -3.799306129e-02f, 8.003905030e-02f,
+    9.907505663e-01f, -6.878230391e-02f, 3.515591665e-02f, -2.320375406e-02f, 1.697818568e-02f, -1.310355817e-02f, 1.042862295e-02f, -8.454243623e-03f,
+    6.929339416e-03f, -5.713956054e-03f, 4.723876173e-03f, -3.905240542e-03f, 3.221790058e-03f, -2.647978043e-03f, 2.165038368e-03f, -1.758640628e-03f,
+    1.417443701e-03f, -1.132180649e-03f, 8.950693592e-04f, -6.994286096e-04f, 5.394264334e-04f, -4.099147289e-04f, 3.063202886e-04f, -2.245724257e-04f,
+    1.610538017e-04f, -1.125653116e-04f, 7.629879762e-05f, -4.981341789e-05f, 3.101297778e-05f, -1.812262109e-05f, 9.664079769e-06f, -4.429266079e-06f,
+  },
+  {
+    -1.706614863e-06f, 4.829864465e-06f, -1.024117137e-05f, 1.889918599e-05f, -3.199894972e-05f, 5.099843856e-05f, -7.764366039e-05f, 1.139921645e-04f,
+    -1.624352417e-04f, 2.257196829e-04f, -3.069707671e-04f, 4.097192418e-04f, -5.379365502e-04f, 6.960846285e-04f, -8.891895476e-04f, 1.122952596e-03f,
+    -1.403918960e-03f, 1.739734460e-03f, -2.139537481e-03f, 2.614561431e-03f, -3.179072209e-03f, 3.851854799e-03f, -4.658633813e-03f, 5.636155771e-03f,
+    -6.839393211e-03f, 8.355014746e-03f, -1.032850634e-02f, 1.302431633e-02f, -1.697784969e-02f, 2.345885653e-02f, -3.637667687e-02f, 7.650186772e-02f,
+    9.915034239e-01f, -6.616055820e-02f, 3.376935513e-02f, -2.227826482e-02f, 1.629738109e-02f, -1.257656635e-02f, 1.000847510e-02f, -8.113280178e-03f,
+    6.649705309e-03f, -5.483298026e-03f, 4.533168729e-03f, -3.747595327e-03f, 3.091762699e-03f, -2.541144864e-03f, 2.077727744e-03f, -1.687756827e-03f,
+    1.360347910e-03f, -1.086608239e-03f, 8.590705065e-04f, -6.713241520e-04f, 5.177737069e-04f, -3.934799702e-04f, 2.940553625e-04f, -2.155944289e-04f,
+    1.546266247e-04f, -1.080826072e-04f, 7.326805023e-05f, -4.784097384e-05f, 2.979000355e-05f, -1.741201945e-05f, 9.288424001e-06f, -4.259820225e-06f,
+  },
+  {
+    -1.626889582e-06f, 4.610890777e-06f, -9.782515800e-06f, 1.805873369e-05f, -3.058270942e-05f, 4.874921569e-05f, -7.422866112e-05f, 1.089895985e-04f,
+    -1.553199782e-04f, 2.158479749e-04f, -2.935639850e-04f, 3.918464352e-04f, -5.144954697e-04f, 6.657805615e-04f, -8.505109139e-04f, 1.074141653e-03f,
+    -1.342935081e-03f, 1.664206100e-03f, -2.046696884e-03f, 2.501152770e-03f, -3.041218359e-03f, 3.684858403e-03f, -4.456671148e-03f, 5.391789325e-03f,
+    -6.542763230e-03f, 7.992427938e-03f, -9.879803952e-03f, 1.245751541e-02f, -1.623682375e-02f, 2.242947814e-02f, -3.476218086e-02f, 7.298123202e-02f,
+    9.922245641e-01f, -6.351691727e-02f, 3.237518165e-02f, -2.134858216e-02f, 1.561380444e-02f, -1.204756320e-02f, 9.586787289e-03f, -7.771098057e-03f,
+    6.369086443e-03f, -5.251833765e-03f, 4.341796032e-03f, -3.589398966e-03f, 2.961278187e-03f, -2.433932892e-03f, 1.990104157e-03f, -1.616615600e-03f,
+    1.303041611e-03f, -1.040864915e-03f, 8.229340512e-04f, -6.431099804e-04f, 4.960344646e-04f, -3.769778378e-04f, 2.817387078e-04f, -2.065773487e-04f,
+    1.481704555e-04f, -1.035788467e-04f, 7.022238428e-05f, -4.585826675e-05f, 2.856021888e-05f, -1.669710018e-05f, 8.910192787e-06f, -4.088967683e-06f,
+  },
+  {
+    -1.547621462e-06f, 4.392596455e-06f, -9.324780174e-06f, 1.721943176e-05f, -2.916779671e-05f, 4.650138401e-05f, -7.081492258e-05f, 1.039878656e-04f,
+    -1.482046949e-04f, 2.059748139e-04f, -2.801535532e-04f, 3.739668061e-04f, -4.910431758e-04f, 6.354594010e-04f, -8.118075188e-04f, 1.025296168e-03f,
+    -1.281904422e-03f, 1.588615903e-03f, -1.953776204e-03f, 2.387642229e-03f, -2.903236961e-03f, 3.517704689e-03f, -4.254517262e-03f, 5.147194018e-03f,
+    -6.245864357e-03f, 7.629533285e-03f, -9.430764508e-03f, 1.189038050e-02f, -1.549556410e-02f, 2.140028912e-02f, -3.314971452e-02f, 6.947729189e-02f,
+    9.929139450e-01f, -6.085146307e-02f, 3.097350118e-02f, -2.041478502e-02f, 1.492751630e-02f, -1.151659654e-02f, 9.163598055e-03f, -7.427728739e-03f,
+    6.087508735e-03f, -5.019584696e-03f, 4.149775814e-03f, -3.430666123e-03f, 2.830348613e-03f, -2.326352054e-03f, 1.902175713e-03f, -1.545223519e-03f,
+    1.245530086e-03f, -9.949548823e-04f, 7.866633047e-04f, -6.147886716e-04f, 4.742106841e-04f, -3.604098258e-04f, 2.693714332e-04f, -1.975219918e-04f,
+    1.416858671e-04f, -9.905442600e-05f, 6.716206410e-05f, -4.386546592e-05f, 2.732372644e-05f, -1.597792099e-05f, 8.529414979e-06f, -3.916720002e-06f,
+  },
+  {
+    -1.468817477e-06f, 4.175001988e-06f, -8.868008383e-06f, 1.638136150e-05f, -2.775434940e-05f, 4.425516323e-05f, -6.740277911e-05f, 9.898745630e-05f,
+    -1.410900900e-04f, 1.961011693e-04f, -2.667407885e-04f, 3.560821103e-04f, -4.675819714e-04f, 6.051241240e-04f, -7.730831612e-04f, 9.764209360e-04f,
+    -1.220832970e-03f, 1.512971281e-03f, -1.860784547e-03f, 2.274040930e-03f, -2.765141527e-03f, 3.350410015e-03f, -4.052191923e-03f, 4.902393752e-03f,
+    -5.948725574e-03f, 7.266366162e-03f, -8.981431683e-03f, 1.132296651e-02f, -1.475414192e-02f, 2.037138622e-02f, -3.153941852e-02f, 6.599019467e-02f,
+    9.935715265e-01f, -5.816427918e-02f, 2.956441962e-02f, -1.947695288e-02f, 1.423857761e-02f, -1.098371445e-02f, 8.738946145e-03f, -7.083203861e-03f,
+    5.804998228e-03f, -4.786572346e-03f, 3.957125894e-03f, -3.271411533e-03f, 2.698986129e-03f, -2.218412327e-03f, 1.813950553e-03f, -1.473587182e-03f,
+    1.187818642e-03f, -9.488823666e-04f, 7.502615965e-04f, -5.863628168e-04f, 4.523043542e-04f, -3.437774372e-04f, 2.569546548e-04f, -1.884291699e-04f,
+    1.351734365e-04f, -9.450974374e-05f, 6.408735615e-05f, -4.186274213e-05f, 2.608062990e-05f, -1.525454024e-05f, 8.146119820e-06f, -3.743088948e-06f,
+  },
+  {
+    -1.390484494e-06f, 3.958127685e-06f, -8.412244045e-06f, 1.554460381e-05f, -2.634250479e-05f, 4.201077228e-05f, -6.399256407e-05f, 9.398885980e-05f,
+    -1.339768604e-04f, 1.862280086e-04f, -2.533270059e-04f, 3.381941012e-04f, -4.441141566e-04f, 5.747777041e-04f, -7.343416365e-04f, 9.275207440e-04f,
+    -1.159726708e-03f, 1.437279641e-03f, -1.767731015e-03f, 2.160359985e-03f, -2.626945561e-03f, 3.182990731e-03f, -3.849714892e-03f, 4.657412418e-03f,
+    -5.651375850e-03f, 6.902961923e-03f, -8.531849115e-03f, 1.075532834e-02f, -1.401262830e-02f, 1.934286597e-02f, -2.993143288e-02f, 6.252008636e-02f,
+    9.941972703e-01f, -5.545545076e-02f, 2.814804387e-02f, -1.853516578e-02f, 1.354704964e-02f, -1.044896528e-02f, 8.312870496e-03f, -6.737555210e-03f,
+    5.521581083e-03f, -4.552818340e-03f, 3.763864171e-03f, -3.111649999e-03f, 2.567202941e-03f, -2.110123733e-03f, 1.725436861e-03f, -1.401713226e-03f,
+    1.129912611e-03f, -9.026516165e-04f, 7.137322740e-04f, -5.578350212e-04f, 4.303174752e-04f, -3.270821841e-04f, 2.444894955e-04f, -1.792997003e-04f,
+    1.286337444e-04f, -8.994520159e-05f, 6.099852899e-05f, -3.985026765e-05f, 2.483103392e-05f, -1.452701694e-05f, 7.760336944e-06f, -3.568086505e-06f,
+  },
+  {
+    -1.312629275e-06f, 3.741993674e-06f, -7.957530497e-06f, 1.470923919e-05f, -2.493239956e-05f, 3.976842935e-05f, -6.058460980e-05f, 8.899256407e-05f,
+    -1.268657011e-04f, 1.763562973e-04f, -2.399135176e-04f, 3.203045294e-04f, -4.206420283e-04f, 5.444231113e-04f, -6.955867358e-04f, 8.786003771e-04f,
+    -1.098591613e-03f, 1.361548384e-03f, -1.674624705e-03f, 2.046610504e-03f, -2.488662560e-03f, 3.015463181e-03f, -3.647105924e-03f, 4.412273898e-03f,
+    -5.353844141e-03f, 6.539355900e-03f, -8.082060408e-03f, 1.018752077e-02f, -1.327109419e-02f, 1.831482462e-02f, -2.832589700e-02f, 5.906711161e-02f,
+    9.947911402e-01f, -5.272506454e-02f, 2.672448178e-02f, -1.758950429e-02f, 1.285299404e-02f, -9.912397613e-03f, 7.885410232e-03f, -6.390814721e-03f,
+    5.237283582e-03f, -4.318344402e-03f, 3.570008626e-03f, -2.951396387e-03f, 2.435011311e-03f, -2.001496341e-03f, 1.636642859e-03f, -1.329608314e-03f,
+    1.071817355e-03f, -8.562669018e-04f, 6.770787020e-04f, -5.292079045e-04f, 4.082520587e-04f, -3.103255872e-04f, 2.319770849e-04f, -1.701344054e-04f,
+    1.220673758e-04f, -8.536120408e-05f, 5.789585328e-05f, -3.782821617e-05f, 2.357504414e-05f, -1.379541072e-05f, 7.372096372e-06f, -3.391724877e-06f,
+  },
+  {
+    -1.235258476e-06f, 3.526619901e-06f, -7.503910792e-06f, 1.387534770e-05f, -2.352416982e-05f, 3.752835179e-05f, -5.717924758e-05f, 8.399905571e-05f,
+    -1.197573056e-04f, 1.664869989e-04f, -2.265016336e-04f, 3.024151426e-04f, -3.971678799e-04f, 5.140633118e-04f, -6.568222462e-04f, 8.296646149e-04f,
+    -1.037433656e-03f, 1.285784907e-03f, -1.581474707e-03f, 1.932803587e-03f, -2.350306014e-03f, 2.847843700e-03f, -3.444384761e-03f, 4.167002059e-03f,
+    -5.056159384e-03f, 6.175583401e-03f, -7.632109126e-03f, 9.619598570e-03f, -1.252961043e-02f, 1.728735818e-02f, -2.672294961e-02f, 5.563141371e-02f,
+    9.953531016e-01f, -4.997320884e-02f, 2.529384213e-02f, -1.664004954e-02f, 1.215647278e-02f, -9.374060296e-03f, 7.456604665e-03f, -6.043014476e-03f,
+    4.952132126e-03f, -4.083172350e-03f, 3.375577318e-03f, -2.790665634e-03f, 2.302423556e-03f, -1.892540266e-03f, 1.547576805e-03f, -1.257279145e-03f,
+    1.013538260e-03f, -8.097325133e-04f, 6.403042623e-04f, -5.004841000e-04f, 3.861101271e-04f, -2.935091762e-04f, 2.194185597e-04f, -1.609341128e-04f,
+    1.154749195e-04f, -8.075815864e-05f, 5.477960171e-05f, -3.579676286e-05f, 2.231276721e-05f, -1.305978185e-05f, 6.981428514e-06f, -3.214016485e-06f,
+  },
+  {
+    -1.158378646e-06f, 3.312026129e-06f, -7.051427693e-06f, 1.304300900e-05f, -2.211795107e-05f, 3.529075615e-05f, -5.377680762e-05f, 7.900881995e-05f,
+    -1.126523657e-04f, 1.566210749e-04f, -2.130926614e-04f, 2.845276855e-04f, -3.736940014e-04f, 4.837012678e-04f, -6.180519498e-04f, 7.807182319e-04f,
+    -9.762588041e-04f, 1.209996598e-03f, -1.488290104e-03f, 1.818950329e-03f, -2.211889405e-03f, 2.680148610e-03f, -3.241571133e-03f, 3.921620754e-03f,
+    -4.758350495e-03f, 5.811679702e-03f, -7.182038787e-03f, 9.051616398e-03f, -1.178824772e-02f, 1.626056237e-02f, -2.512272881e-02f, 5.221313456e-02f,
+    9.958831219e-01f, -4.719997356e-02f, 2.385623468e-02f, -1.568688314e-02f, 1.145754820e-02f, -8.834002408e-03f, 7.026493289e-03f, -5.694186698e-03f,
+    4.666153228e-03f, -3.847324097e-03f, 3.180588383e-03f, -2.629472737e-03f, 2.169452046e-03f, -1.783265666e-03f, 1.458246994e-03f, -1.184732446e-03f,
+    9.550807370e-04f, -7.630527629e-04f, 6.034123539e-04f, -4.716662547e-04f, 3.638937138e-04f, -2.766344890e-04f, 2.068150629e-04f, -1.516996553e-04f,
+    1.088569679e-04f, -7.613647550e-05f, 5.165004905e-05f, -3.375608428e-05f, 2.104431070e-05f, -1.232019123e-05f, 6.588364162e-06f, -3.034973967e-06f,
+  },
+  {
+    -1.081996226e-06f, 3.098231936e-06f, -6.600123669e-06f, 1.221230229e-05f, -2.071387820e-05f, 3.305585815e-05f, -5.037761904e-05f, 7.402234058e-05f,
+    -1.055515712e-04f, 1.467594844e-04f, -1.996879054e-04f, 2.666438994e-04f, -3.502226789e-04f, 4.533399368e-04f, -5.792796238e-04f, 7.317659967e-04f,
+    -9.150730167e-04f, 1.134190841e-03f, -1.395079971e-03f, 1.705061814e-03f, -2.073426203e-03f, 2.512394225e-03f, -3.038684757e-03f, 3.676153816e-03f,
+    -4.460446368e-03f, 5.447680050e-03f, -6.731892864e-03f, 8.483628852e-03f, -1.104707664e-02f, 1.523453267e-02f, -2.352537200e-02f, 4.881241471e-02f,
+    9.963811701e-01f, -4.440545018e-02f, 2.241177010e-02f, -1.473008727e-02f, 1.075628295e-02f, -8.292273266e-03f, 6.595115778e-03f, -5.344363751e-03f,
+    4.379373513e-03f, -3.610821647e-03f, 2.985060032e-03f, -2.467832758e-03f, 2.036109203e-03f, -1.673682745e-03f, 1.368661761e-03f, -1.111974974e-03f,
+    8.964502219e-04f, -7.162319825e-04f, 5.664063920e-04f, -4.427570287e-04f, 3.416048629e-04f, -2.597030722e-04f, 1.941677443e-04f, -1.424318705e-04f,
+    1.022141175e-04f, -7.149656770e-05f, 4.850747205e-05f, -3.170635846e-05f, 1.976978316e-05f, -1.157670038e-05f, 6.192934493e-06f, -2.854610178e-06f,
+  },
+  {
+    -1.006117553e-06f, 2.885256714e-06f, -6.150040898e-06f, 1.138330634e-05f, -1.931208548e-05f, 3.082387265e-05f, -4.698200977e-05f, 6.904009991e-05f,
+    -9.845561031e-05f, 1.369031841e-04f, -1.862886677e-04f, 2.487655224e-04f, -3.267561946e-04f, 4.229822719e-04f, -5.405090400e-04f, 6.828126718e-04f,
+    -8.538822462e-04f, 1.058375009e-03f, -1.301853372e-03f, 1.591149115e-03f, -1.934929867e-03f, 2.344596843e-03f, -2.835745331e-03f, 3.430625059e-03f,
+    -4.162475869e-03f, 5.083619653e-03f, -6.281714775e-03f, 7.915690444e-03f, -1.030616761e-02f, 1.420936426e-02f, -2.193101595e-02f, 4.542939331e-02f,
+    9.968472174e-01f, -4.158973175e-02f, 2.096056000e-02f, -1.376974460e-02f, 1.005274003e-02f, -7.748922424e-03f, 6.162511978e-03f, -4.993578135e-03f,
+    4.091819718e-03f, -3.373687093e-03f, 2.789010551e-03f, -2.305760818e-03f, 1.902407501e-03f, -1.563801746e-03f, 1.278829471e-03f, -1.039013517e-03f,
+    8.376521752e-04f, -6.692745240e-04f, 5.292898083e-04f, -4.137590956e-04f, 3.192456289e-04f, -2.427164804e-04f, 1.814777600e-04f, -1.331316012e-04f,
+    9.554696830e-05f, -6.683885105e-05f, 4.535214948e-05f, -2.964776477e-05f, 1.848929410e-05f, -1.082937143e-05f, 5.795171063e-06f, -2.672938191e-06f,
+  },
+  {
+    -9.307488532e-07f, 2.673119667e-06f, -5.701221255e-06f, 1.055609947e-05f, -1.791270653e-05f, 2.859501361e-05f, -4.359030663e-05f, 6.406257874e-05f,
+    -9.136516908e-05f, 1.270531286e-04f, -1.728962470e-04f, 2.308942889e-04f, -3.032968263e-04f, 3.926312211e-04f, -5.017439644e-04f, 6.338630129e-04f,
+    -7.926924376e-04f, 9.825564677e-04f, -1.208619364e-03f, 1.477223295e-03f, -1.796413842e-03f, 2.176772747e-03f, -2.632772536e-03f, 3.185058276e-03f,
+    -3.864467838e-03f, 4.719533683e-03f, -5.831547883e-03f, 7.347855599e-03f, -9.565590900e-03f, 1.318515202e-02f, -2.033979669e-02f, 4.206420813e-02f,
+    9.972812367e-01f, -3.875291287e-02f, 1.950271691e-02f, -1.280593831e-02f, 9.346982758e-03f, -7.203999663e-03f, 5.728721911e-03f, -4.641862486e-03f,
+    3.803518684e-03f, -3.135942615e-03f, 2.592458298e-03f, -2.143272099e-03f, 1.768359463e-03f, -1.453632958e-03f, 1.188758526e-03f, -9.658548904e-04f,
+    7.786920811e-04f, -6.221847588e-04f, 4.920660504e-04f, -3.846751415e-04f, 2.968180766e-04f, -2.256762768e-04f, 1.687462725e-04f, -1.237996949e-04f,
+    8.885612412e-05f, -6.216374406e-05f, 4.218436208e-05f, -2.758048401e-05f, 1.720295397e-05f, -1.007826715e-05f, 5.395105811e-06f, -2.489971292e-06f,
+  },
+  {
+    -8.558962465e-07f, 2.461839809e-06f, -5.253706314e-06f, 9.730759559e-06f, -1.651587432e-05f, 2.636949411e-05f, -4.020283519e-05f, 5.909025630e-05f,
+    -8.428093163e-05f, 1.172102697e-04f, -1.595119393e-04f, 2.130319296e-04f, -2.798468475e-04f, 3.622897270e-04f, -4.629881567e-04f, 5.849217686e-04f,
+    -7.315095276e-04f, 9.067425733e-04f, -1.115386992e-03f, 1.363295404e-03f, -1.657891559e-03f, 2.008938202e-03f, -2.429786035e-03f, 2.939477232e-03f,
+    -3.566451081e-03f, 4.355457267e-03f, -5.381435492e-03f, 6.780178649e-03f, -8.825416636e-03f, 1.216199053e-02f, -1.875184961e-02f, 3.871699552e-02f,
+    9.976832026e-01f, -3.589508973e-02f, 1.803835430e-02f, -1.183875208e-02f, 8.639074766e-03f, -6.657554992e-03f, 5.293785764e-03f, -4.289249569e-03f,
+    3.514497361e-03f, -2.897610481e-03f, 2.395421700e-03f, -1.980381843e-03f, 1.633977660e-03f, -1.343186706e-03f, 1.098457365e-03f, -8.925059382e-04f,
+    7.195754470e-04f, -5.749670777e-04f, 4.547385813e-04f, -3.555078655e-04f, 2.743242809e-04f, -2.085840320e-04f, 1.559744507e-04f, -1.144370040e-04f,
+    8.214219237e-05f, -5.747166795e-05f, 3.900439252e-05f, -2.550469834e-05f, 1.591087415e-05f, -9.323450900e-06f, 4.992771048e-06f, -2.305722986e-06f,
+  },
+  {
+    -7.815657450e-07f, 2.251435964e-06f, -4.807537344e-06f, 8.907364012e-06f, -1.512172117e-05f, 2.414752633e-05f, -3.681991981e-05f, 5.412361021e-05f,
+    -7.720358005e-05f, 1.073755568e-04f, -1.461370370e-04f, 1.951801713e-04f, -2.564085269e-04f, 3.319607270e-04f, -4.242453703e-04f, 5.359936800e-04f,
+    -6.703394441e-04f, 8.309406716e-04f, -1.022165289e-03f, 1.249376479e-03f, -1.519376435e-03f, 1.841109458e-03f, -2.226805466e-03f, 2.693905668e-03f,
+    -3.268454369e-03f, 3.991425489e-03f, -4.931420838e-03f, 6.212713828e-03f, -8.085714775e-03f, 1.113997409e-02f, -1.716730935e-02f, 3.538789045e-02f,
+    9.980530920e-01f, -3.301636004e-02f, 1.656758653e-02f, -1.086827010e-02f, 7.929080008e-03f, -6.109638636e-03f, 4.857743891e-03f, -3.935772278e-03f,
+    3.224782798e-03f, -2.658713038e-03f, 2.197919253e-03f, -1.817105347e-03f, 1.499274713e-03f, -1.232473359e-03f, 1.007934454e-03f, -8.189735321e-04f,
+    6.603078033e-04f, -5.276258900e-04f, 4.173108796e-04f, -3.262599788e-04f, 2.517663268e-04f, -1.914413250e-04f, 1.431634693e-04f, -1.050443856e-04f,
+    7.540578402e-05f, -5.276304660e-05f, 3.581252541e-05f, -2.342059127e-05f, 1.461316693e-05f, -8.564986649e-06f, 4.588199465e-06f, -2.120206989e-06f,
+  },
+  {
+    -7.077632525e-07f, 2.041926766e-06f, -4.362755305e-06f, 8.085989771e-06f, -1.373037872e-05f, 2.192932149e-05f, -3.344188361e-05f, 4.916311643e-05f,
+    -7.013379428e-05f, 9.754993643e-05f, -1.327728294e-04f, 1.773407369e-04f, -2.329841284e-04f, 3.016471525e-04f, -3.855193517e-04f, 4.870834803e-04f,
+    -6.091881057e-04f, 7.551580978e-04f, -9.289632760e-04f, 1.135477543e-03f, -1.380881869e-03f, 1.673302742e-03f, -2.023850445e-03f, 2.448367295e-03f,
+    -2.970506440e-03f, 3.627473382e-03f, -4.481547093e-03f, 5.645515269e-03f, -7.346555107e-03f, 1.011919665e-02f, -1.558630987e-02f, 3.207702646e-02f,
+    9.983908831e-01f, -3.011682311e-02f, 1.509052887e-02f, -9.894577038e-03f, 7.217062747e-03f, -5.560301041e-03f, 4.420636806e-03f, -3.581463631e-03f,
+    2.934402144e-03f, -2.419272719e-03f, 1.999969523e-03f, -1.653457964e-03f, 1.364263286e-03f, -1.121503321e-03f, 9.171982964e-04f, -7.452645704e-04f,
+    6.008947025e-04f, -4.801656233e-04f, 3.797864386e-04f, -2.969342048e-04f, 2.291463087e-04f, -1.742497421e-04f, 1.303145094e-04f, -9.562270141e-05f,
+    6.864751359e-05f, -4.803830650e-05f, 3.260904725e-05f, -2.132834767e-05f, 1.330994556e-05f, -7.802938972e-06f, 4.181424123e-06f, -1.933437235e-06f,
+  },
+  {
+    -6.344945643e-07f, 1.833330653e-06f, -3.919400843e-06f, 7.266713306e-06f, -1.234197793e-05f, 1.971508987e-05f, -3.006904838e-05f, 4.420924924e-05f,
+    -6.307225207e-05f, 8.773435257e-05f, -1.194206026e-04f, 1.595153450e-04f, -2.095759109e-04f, 2.713519286e-04f, -3.468138400e-04f, 4.381958938e-04f,
+    -5.480614212e-04f, 6.794021755e-04f, -8.357899599e-04f, 1.021609602e-03f, -1.242421240e-03f, 1.505534260e-03f, -1.820940561e-03f, 2.202885791e-03f,
+    -2.672635987e-03f, 3.263635927e-03f, -4.031857352e-03f, 5.078636996e-03f, -6.608007245e-03f, 9.099751868e-03f, -1.400898440e-02f, 2.878453566e-02f,
+    9.986965565e-01f, -2.719657977e-02f, 1.360729748e-02f, -8.917758040e-03f, 6.503087547e-03f, -5.009592861e-03f, 3.982505179e-03f, -3.226356769e-03f,
+    2.643382648e-03f, -2.179312032e-03f, 1.801591136e-03f, -1.489455102e-03f, 1.228956092e-03f, -1.010287036e-03f, 8.262574248e-04f, -6.713859779e-04f,
+    5.413417188e-04f, -4.325907233e-04f, 3.421687665e-04f, -2.675332788e-04f, 2.064663308e-04f, -1.570108775e-04f, 1.174287578e-04f, -8.617281777e-05f,
+    6.186799907e-05f, -4.329787671e-05f, 2.939424644e-05f, -1.922815370e-05f, 1.200132415e-05f, -7.037373038e-06f, 3.772478456e-06f, -1.745427869e-06f,
+  },
+  {
+    -5.617653676e-07f, 1.625665872e-06f, -3.477514291e-06f, 6.449610605e-06f, -1.095664905e-05f, 1.750504077e-05f, -2.670173464e-05f, 3.926248116e-05f,
+    -5.601962893e-05f, 7.792974624e-05f, -1.060816386e-04f, 1.417057097e-04f, -1.861861277e-04f, 2.410779743e-04f, -3.081325671e-04f, 3.893356364e-04f,
+    -4.869652887e-04f, 6.036802161e-04f, -7.426543342e-04f, 9.077836460e-04f, -1.104007911e-03f, 1.337820197e-03f, -1.618095377e-03f, 1.957484803e-03f,
+    -2.374871665e-03f, 2.899948050e-03f, -3.582394638e-03f, 4.512132922e-03f, -5.870140626e-03f, 8.081733052e-03f, -1.243546543e-02f, 2.551054876e-02f,
+    9.989700943e-01f, -2.425573240e-02f, 1.211800944e-02f, -7.937898735e-03f, 5.787219273e-03f, -4.457564959e-03f, 3.543389835e-03f, -2.870484951e-03f,
+    2.351751651e-03f, -1.938853565e-03f, 1.602802787e-03f, -1.325112221e-03f, 1.093365886e-03f, -8.988349851e-04f, 7.351204029e-04f, -5.973447048e-04f,
+    4.816544477e-04f, -3.849056532e-04f, 3.044613858e-04f, -2.380599479e-04f, 1.837285066e-04f, -1.397263326e-04f, 1.045074072e-04f, -7.669560550e-05f,
+    5.506786185e-05f, -3.854218886e-05f, 2.616841320e-05f, -1.712019689e-05f, 1.068741775e-05f, -6.268354608e-06f, 3.361396264e-06f, -1.556193250e-06f,
+  },
+  {
+    -4.895812406e-07f, 1.418950473e-06f, -3.037135663e-06f, 5.634757173e-06f, -9.574521652e-06f, 1.529938251e-05f, -2.334026152e-05f, 3.432328294e-05f,
+    -4.897659805e-05f, 6.813705551e-05f, -9.275721622e-05f, 1.239135407e-04f, -1.628170269e-04f, 2.108282020e-04f, -2.694792565e-04f, 3.405074142e-04f,
+    -4.259055955e-04f, 5.279995181e-04f, -6.495653770e-04f, 7.940106483e-04f, -9.656552225e-04f, 1.170176712e-03f, -1.415334426e-03f, 1.712187939e-03f,
+    -2.077242081e-03f, 2.536444617e-03f, -3.133201891e-03f, 3.946056842e-03f, -5.133024496e-03f, 7.065233180e-03f, -1.086588473e-02f, 2.225519500e-02f,
+    9.992114806e-01f, -2.129438492e-02f, 1.062278266e-02f, -6.955085219e-03f, 5.069523081e-03f, -3.904268400e-03f, 3.103331749e-03f, -2.513881554e-03f,
+    2.059536588e-03f, -1.697919981e-03f, 1.403623228e-03f, -1.160444832e-03f, 9.575054650e-04f, -7.871576838e-04f, 6.437958247e-04f, -5.231477265e-04f,
+    4.218385056e-04f, -3.371148931e-04f, 2.666678329e-04f, -2.085169703e-04f, 1.609349588e-04f, -1.223977162e-04f, 9.155165606e-05f, -6.719193986e-05f,
+    4.824772672e-05f, -3.377167707e-05f, 2.293183960e-05f, -1.500466601e-05f, 9.368342270e-06f, -5.495950030e-06f, 2.948211718e-06f, -1.365747950e-06f,
+  },
+  {
+    -4.179476529e-07f, 1.213202308e-06f, -2.598304651e-06f, 4.822228019e-06f, -8.195724556e-06f, 1.309832238e-05f, -1.998494680e-05f, 2.939212351e-05f,
+    -4.194383027e-05f, 5.835721547e-05f, -7.944861021e-05f, 1.061405429e-04f, -1.394708507e-04f, 1.806055170e-04f, -2.308576238e-04f, 2.917159237e-04f,
+    -3.648882172e-04f, 4.523673665e-04f, -5.565320506e-04f, 6.803015624e-04f, -8.273764923e-04f, 1.002619937e-03f, -1.212677208e-03f, 1.467018771e-03f,
+    -1.779775795e-03f, 2.173160435e-03f, -2.684321967e-03f, 3.380462430e-03f, -4.396727910e-03f, 6.050344883e-03f, -9.300373310e-03f, 1.901860221e-02f,
+    9.994207014e-01f, -1.831264279e-02f, 9.121735984e-03f, -5.969404050e-03f, 4.350064413e-03f, -3.349754447e-03f, 2.662372041e-03f, -2.156580065e-03f,
+    1.766764983e-03f, -1.456534014e-03f, 1.204071275e-03f, -9.954684975e-04f, 8.213876693e-04f, -6.752656831e-04f, 5.522923132e-04f, -4.488020425e-04f,
+    3.618995289e-04f, -2.892229402e-04f, 2.287916580e-04f, -1.789071157e-04f, 1.380878190e-04f, -1.050266442e-04f, 7.856270834e-05f, -5.766270046e-05f,
+    4.140822173e-05f, -2.898677794e-05f, 1.968481951e-05f, -1.288175115e-05f, 8.044214521e-06f, -4.720226235e-06f, 2.532959348e-06f, -1.174106751e-06f,
+  },
+  {
+    -3.468699649e-07f, 1.008439035e-06f, -2.161060622e-06f, 4.012097656e-06f, -6.820385874e-06f, 1.090206668e-05f, -1.663610686e-05f, 2.446946990e-05f,
+    -3.492199395e-05f, 4.859115805e-05f, -6.615709148e-05f, 8.838841654e-05f, -1.161498354e-04f, 1.504128174e-04f, -1.922713759e-04f, 2.429658512e-04f,
+    -3.039190175e-04f, 3.767910319e-04f, -4.635633003e-04f, 5.666673226e-04f, -6.891850162e-04f, 8.351659788e-04f, -1.010143193e-03f, 1.222000831e-03f,
+    -1.482501317e-03f, 1.810130241e-03f, -2.235797633e-03f, 2.815403229e-03f, -3.661319722e-03f, 5.037160437e-03f, -7.739061422e-03f, 1.580089674e-02f,
+    9.995977445e-01f, -1.531061299e-02f, 7.614989081e-03f, -4.980942241e-03f, 3.628908995e-03f, -2.794074557e-03f, 2.220551976e-03f, -1.798614082e-03f,
+    1.473464447e-03f, -1.214718471e-03f, 1.004165800e-03f, -8.301988273e-04f, 6.850253791e-04f, -5.631695683e-04f, 4.606185195e-04f, -3.743146762e-04f,
+    3.018431737e-04f, -2.412343076e-04f, 1.908364247e-04f, -1.492331643e-04f, 1.151892276e-04f, -8.761473964e-05f, 6.554177360e-05f, -4.810877115e-05f,
+    3.454997822e-05f, -2.418793050e-05f, 1.642764857e-05f, -1.075164365e-05f, 6.715152175e-06f, -3.941250728e-06f, 2.115674051e-06f, -9.812846473e-07f,
+  },
+  {
+    -2.763534282e-07f, 8.046781086e-07f, -1.725442616e-06f, 3.204440093e-06f, -5.448632973e-06f, 8.710820628e-06f, -1.329405663e-05f, 1.955578726e-05f,
+    -2.791175501e-05f, 3.883981201e-05f, -5.288392692e-05f, 7.065885667e-05f, -9.285621109e-05f, 1.202529940e-04f, -1.537242107e-04f, 1.942618720e-04f,
+    -2.430038470e-04f, 3.012777700e-04f, -3.706680540e-04f, 4.531188423e-04f, -5.510940651e-04f, 6.678309130e-04f, -8.077518143e-04f, 9.771576048e-04f,
+    -1.185447103e-03f, 1.447388707e-03f, -1.787671565e-03f, 2.250932655e-03f, -2.926868584e-03f, 4.025771758e-03f, -6.182078560e-03f, 1.260220352e-02f,
+    9.997425996e-01f, -1.228840403e-02f, 6.102662501e-03f, -3.989787252e-03f, 2.906122828e-03f, -2.237280376e-03f, 1.777912955e-03f, -1.440017311e-03f,
+    1.179662677e-03f, -9.724962249e-04f, 8.039257324e-04f, -6.646514784e-04f, 5.484315139e-04f, -4.508799569e-04f, 3.687831227e-04f, -2.996926739e-04f,
+    2.416751155e-04f, -1.931535244e-04f, 1.528057095e-04f, -1.194979072e-04f, 9.224133353e-05f, -7.016363215e-05f, 5.249006679e-05f, -3.853103998e-05f,
+    2.767363071e-05f, -1.937557616e-05f, 1.316062418e-05f, -8.614536093e-06f, 5.381273773e-06f, -3.159091589e-06f, 1.696391080e-06f, -7.872968423e-07f,
+  },
+  {
+    -2.064031850e-07f, 6.019367874e-07f, -1.291489343e-06f, 2.399328827e-06f, -4.080592469e-06f, 6.524788397e-06f, -9.959109596e-06f, 1.465153878e-05f,
+    -2.091377677e-05f, 2.910410282e-05f, -3.963037923e-05f, 5.295355323e-05f, -6.959220159e-05f, 9.012892975e-05f, -1.152198166e-04f, 1.456086506e-04f,
+    -1.821485435e-04f, 2.258348207e-04f, -2.778552210e-04f, 3.396670130e-04f, -4.131168840e-04f, 5.006307855e-04f, -6.055224678e-04f, 7.325125374e-04f,
+    -8.886415539e-04f, 1.084970431e-03f, -1.339986342e-03f, 1.687103984e-03f, -2.193442933e-03f, 3.016270396e-03f, -4.629553444e-03f, 9.422645991e-03f,
+    9.998552583e-01f, -9.246125958e-03f, 4.584877641e-03f, -2.996026984e-03f, 2.181772181e-03f, -1.679423733e-03f, 1.334496516e-03f, -1.080823560e-03f,
+    8.853874513e-04f, -7.298902183e-04f, 6.033700560e-04f, -4.988421534e-04f, 4.116190312e-04f, -3.384074989e-04f, 2.767948283e-04f, -2.249431043e-04f,
+    1.814010482e-04f, -1.449851352e-04f, 1.147031018e-04f, -8.970414587e-05f, 6.924629422e-05f, -5.267495825e-05f, 3.940880811e-05f, -2.893039913e-05f,
+    2.077981688e-05f, -1.455015872e-05f, 9.884045472e-06f, -6.470622311e-06f, 4.042698704e-06f, -2.373817463e-06f, 1.275146047e-06f, -5.921587496e-07f,
+  },
+  {
+    -1.370242684e-07f, 4.002321268e-07f, -8.592391793e-07f, 1.596836838e-06f, -2.716390214e-06f, 4.344173074e-06f, -6.631577751e-06f, 9.757185653e-06f,
+    -1.392871995e-05f, 1.938495258e-05f, -2.639770688e-05f, 3.527419083e-05f, -4.636002411e-05f, 6.004349963e-05f, -7.676187259e-05f, 9.701083973e-05f,
+    -1.213589306e-04f, 1.504694079e-04f, -1.851336912e-04f, 2.263227037e-04f, -2.752666911e-04f, 3.335816101e-04f, -4.034745119e-04f, 4.880890248e-04f,
+    -5.921130105e-04f, 7.229099385e-04f, -8.927844413e-04f, 1.123970350e-03f, -1.461110992e-03f, 2.008747522e-03f, -3.081614013e-03f, 6.262346136e-03f,
+    9.999357141e-01f, -6.183890307e-03f, 3.061756745e-03f, -1.999749775e-03f, 1.455923589e-03f, -1.120556637e-03f, 8.903443259e-04f, -7.210667384e-04f,
+    5.906666276e-04f, -4.869234566e-04f, 4.025178080e-04f, -3.327865989e-04f, 2.746009255e-04f, -2.257628749e-04f, 1.846623679e-04f, -1.500730577e-04f,
+    1.210266839e-04f, -9.673369959e-05f, 7.653220319e-05f, -5.985469169e-05f, 4.620627520e-05f, -3.515036093e-05f, 2.629922296e-05f, -1.930774478e-05f,
+    1.386917747e-05f, -9.712124254e-06f, 6.598213260e-06f, -4.320097343e-06f, 2.699547203e-06f, -1.585497556e-06f, 8.519749185e-07f, -3.958859908e-07f,
+  },
+  {
+    -6.822160196e-08f, 1.995809807e-07f, -4.287301646e-07f, 7.970365856e-07f, -1.356151292e-06f, 2.169176650e-06f, -3.311771574e-06f, 4.873187033e-06f,
+    -6.957242591e-06f, 9.683279941e-06f, -1.318716395e-05f, 1.762244859e-05f, -2.316188909e-05f, 2.999957033e-05f, -3.835404755e-05f, 4.847308009e-05f,
+    -6.064081795e-05f, 7.518873796e-05f, -9.251233460e-05f, 1.130967593e-04f, -1.375566764e-04f, 1.666993666e-04f, -2.016272642e-04f, 2.439104138e-04f,
+    -2.958897537e-04f, 3.612416733e-04f, -4.461082387e-04f, 5.615847433e-04f, -7.299407579e-04f, 1.003293924e-03f, -1.538387415e-03f, 3.121424463e-03f,
+    9.999839623e-01f, -3.101810134e-03f, 1.533422895e-03f, -1.001044386e-03f, 7.286438470e-04f, -5.607312750e-04f, 4.454981809e-04f, -3.607808514e-04f,
+    2.955281407e-04f, -2.436190078e-04f, 2.013880768e-04f, -1.665006043e-04f, 1.373902270e-04f, -1.129567954e-04f, 9.239449811e-05f, -7.508964567e-05f,
+    6.055775229e-05f, -4.840379173e-05f, 3.829662745e-05f, -2.995236608e-05f, 2.312345002e-05f, -1.759148963e-05f, 1.316254179e-05f, -9.663977064e-06f,
+    6.942356258e-06f, -4.861921144e-06f, 3.303430053e-06f, -2.163157430e-06f, 1.351940338e-06f, -7.942016303e-07f, 4.269140135e-07f, -1.984943955e-07f,
+  },
+};
+
+#endif
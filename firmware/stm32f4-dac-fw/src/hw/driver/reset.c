@@ -5,6 +5,7 @@
 #ifdef _USE_HW_RESET
 #include "rtc.h"
 #include "cli.h"
+#include "uart.h"
 
 #if CLI_USE(HW_RESET)
 static void cliReset(cli_args_t *args);
@@ -113,6 +114,12 @@ void resetToBoot(void)
 
 void resetToReset(void)
 {
+  // 송신 버퍼에 남은 메세지를 먼저 출력한다.
+  //
+  if (__get_IPSR() == 0)
+  {
+    uartFlushTx(HW_UART_CH_SWD, 50);
+  }
   HAL_NVIC_SystemReset();
 }
 
@@ -0,0 +1,91 @@
+#include "rtos.h"
+
+
+#ifdef _USE_HW_RTOS
+#include "cli.h"
+
+
+#define RTOS_TASK_MAX       HW_RTOS_TASK_MAX
+
+
+#if CLI_USE(HW_RTOS)
+static void cliRtos(cli_args_t *args);
+#endif
+
+static StaticTask_t idle_tcb;
+static StackType_t  idle_stack[configMINIMAL_STACK_SIZE];
+
+
+
+
+bool rtosInit(void)
+{
+  logPrintf("[OK] rtosInit()\n");
+
+#if CLI_USE(HW_RTOS)
+  cliAdd("rtos", cliRtos);
+#endif
+  return true;
+}
+
+void vApplicationGetIdleTaskMemory(StaticTask_t **ppxIdleTaskTCBBuffer,
+                                   StackType_t **ppxIdleTaskStackBuffer,
+                                   uint32_t *pulIdleTaskStackSize)
+{
+  *ppxIdleTaskTCBBuffer   = &idle_tcb;
+  *ppxIdleTaskStackBuffer = idle_stack;
+  *pulIdleTaskStackSize   = configMINIMAL_STACK_SIZE;
+}
+
+void vApplicationIdleHook(void)
+{
+  // 실행할 태스크가 없으면 다음 인터럽트까지 잠든다.
+  //
+  __DSB();
+  __WFI();
+}
+
+void vApplicationStackOverflowHook(TaskHandle_t xTask, char *pcTaskName)
+{
+  UNUSED(xTask);
+
+  logPrintf("[NG] stack overflow : %s\n", pcTaskName);
+  Error_Handler();
+}
+
+
+#if CLI_USE(HW_RTOS)
+void cliRtos(cli_args_t *args)
+{
+  bool ret = false;
+
+
+  if (args->argc == 1 && args->isStr(0, "info"))
+  {
+    static TaskStatus_t status[RTOS_TASK_MAX];
+    const char *state_str[] = {"run", "ready", "block", "susp", "del", "inv"};
+    UBaseType_t cnt;
+
+    cnt = uxTaskGetSystemState(status, RTOS_TASK_MAX, NULL);
+
+    cliPrintf("name         prio state  stack free\n");
+    for (UBaseType_t i=0; i<cnt; i++)
+    {
+      cliPrintf("%-12s %4d %-6s %5d bytes\n",
+        status[i].pcTaskName,
+        (int)status[i].uxCurrentPriority,
+        state_str[status[i].eCurrentState < 5 ? status[i].eCurrentState:5],
+        (int)(status[i].usStackHighWaterMark * sizeof(StackType_t)));
+    }
+    cliPrintf("tick         : %d\n", (int)xTaskGetTickCount());
+    ret = true;
+  }
+
+  if (ret == false)
+  {
+    cliPrintf("rtos info\n");
+  }
+}
+#endif
+
+#endif
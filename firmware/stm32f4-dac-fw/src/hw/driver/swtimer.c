@@ -1,27 +1,75 @@
 #include "swtimer.h"
+#include "event.h"
 
 
 #ifdef _USE_HW_SWTIMER
+#include "cli.h"
+
+
+// 타이밍 휠 : 만료 tick의 하위 비트로 슬롯을 정하고, 슬롯마다 타이머를 연결한다.
+// 비어있지 않은 슬롯은 비트맵으로 관리하여 다음 만료 시점을 O(1)로 찾는다.
+//
+#define SWTIMER_WHEEL_BITS          6
+#define SWTIMER_WHEEL_SIZE          (1U << SWTIMER_WHEEL_BITS)
+#define SWTIMER_WHEEL_MASK          (SWTIMER_WHEEL_SIZE - 1U)
+#define SWTIMER_NODE_NONE           (-1)
+
+// TIM11 : 1MHz 카운트, 16비트 ARR 이므로 한 주기는 최대 65ms
+//
+#define SWTIMER_TIM_CNT_PER_TICK    1000U
+#define SWTIMER_TICKLESS_MAX        SWTIMER_WHEEL_SIZE
+
 
 typedef struct
 {
 
   bool          timer_en;             // 타이머 인에이블 신호
+  bool          is_deferred;          // 메인 루프에서 콜백 실행
   SwtimerMode_t timer_mode;           // 타이머 모드
-  uint32_t      timer_cnt;            // 현재의 타이머 값
+  uint32_t      timer_expire;         // 만료될 tick
   uint32_t      timer_init;           // 타이머 초기화될때의 카운트 값
+  volatile uint16_t pending_cnt;      // 메인 루프에서 실행할 콜백 횟수
+  int16_t       next;                 // 같은 슬롯의 다음 타이머
+  int16_t       prev;                 // 같은 슬롯의 이전 타이머
   void (*tmr_func)(void *);       // 만료될때 실행될 함수
   void  *tmr_func_arg;              // 함수로 전달할 인수들
 } swtimer_t;
 
+typedef struct
+{
+  uint32_t isr_cnt;
+  uint32_t fire_cnt;
+  uint32_t defer_cnt;
+  uint32_t idle_cnt;
+  uint32_t late_cnt;
+} swtimer_stat_t;
+
+
+#if CLI_USE(HW_SWTIMER)
+static void cliSwtimer(cli_args_t *args);
+#endif
+
 static bool is_init = false;
+static volatile bool     is_running = false;
 static volatile uint32_t sw_timer_counter      = 0;
+static volatile uint32_t sw_timer_period       = 1;   // 현재 TIM11 주기의 tick 수
+static volatile uint32_t sw_timer_carry        = 0;   // 늦게 만료시켜서 다음 주기로 넘긴 TIM11 카운트
+static volatile uint32_t sw_timer_stop_ms      = 0;
 static volatile uint16_t sw_timer_handle_index = 0;
 static swtimer_t  swtimer_tbl[_HW_DEF_SW_TIMER_MAX];           // 타이머 배열 선언
+static int16_t    swtimer_wheel[SWTIMER_WHEEL_SIZE];
+static uint64_t   swtimer_wheel_bitmap = 0;
+static swtimer_stat_t swtimer_stat;
 static TIM_HandleTypeDef htim11;
 
 static void swtimerInitTimer(void);
 static void swtimerTimerCallback(TIM_HandleTypeDef *htim);
+static void swtimerLink(swtimer_handle_t handle);
+static void swtimerUnlink(swtimer_handle_t handle);
+static void swtimerProcessTick(uint32_t tick);
+static void swtimerSchedule(void);
+static void swtimerSetPeriod(uint32_t ticks);
+static uint32_t swtimerGetNow(void);
 
 
 
@@ -40,16 +88,29 @@ bool swtimerInit(void)
   // 구조체 초기화
   for(i=0; i<_HW_DEF_SW_TIMER_MAX; i++)
   {
-    swtimer_tbl[i].timer_en   = false;
-    swtimer_tbl[i].timer_cnt  = 0;
-    swtimer_tbl[i].timer_init = 0;
-    swtimer_tbl[i].tmr_func   = NULL;
+    swtimer_tbl[i].timer_en     = false;
+    swtimer_tbl[i].is_deferred  = false;
+    swtimer_tbl[i].timer_expire = 0;
+    swtimer_tbl[i].timer_init   = 0;
+    swtimer_tbl[i].pending_cnt  = 0;
+    swtimer_tbl[i].next         = SWTIMER_NODE_NONE;
+    swtimer_tbl[i].prev         = SWTIMER_NODE_NONE;
+    swtimer_tbl[i].tmr_func     = NULL;
+  }
+  for (i=0; i<SWTIMER_WHEEL_SIZE; i++)
+  {
+    swtimer_wheel[i] = SWTIMER_NODE_NONE;
   }
+  swtimer_wheel_bitmap = 0;
+  memset(&swtimer_stat, 0, sizeof(swtimer_stat));
 
   is_init = true;
 
   swtimerInitTimer();
 
+#if CLI_USE(HW_SWTIMER)
+  cliAdd("swtimer", cliSwtimer);
+#endif
   return true;
 }
 
@@ -58,13 +119,15 @@ void swtimerInitTimer(void)
    __HAL_RCC_TIM11_CLK_ENABLE();
 
 
+  // ARR을 주기 중간에 바로 바꿀 수 있도록 preload는 사용하지 않는다.
+  //
   htim11.Instance = TIM11;
   htim11.Init.Prescaler = 95;
   htim11.Init.CounterMode = TIM_COUNTERMODE_UP;
-  htim11.Init.Period = 999;
+  htim11.Init.Period = SWTIMER_TIM_CNT_PER_TICK - 1;
   htim11.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1;
   htim11.Init.RepetitionCounter = 0;
-  htim11.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_ENABLE;
+  htim11.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
   if (HAL_TIM_Base_Init(&htim11) != HAL_OK)
   {
     Error_Handler();
@@ -73,72 +136,357 @@ void swtimerInitTimer(void)
   HAL_TIM_RegisterCallback(&htim11, HAL_TIM_PERIOD_ELAPSED_CB_ID, swtimerTimerCallback);
 
   HAL_NVIC_SetPriority(TIM1_TRG_COM_TIM11_IRQn, 15, 0);
-  HAL_NVIC_EnableIRQ(TIM1_TRG_COM_TIM11_IRQn);  
+  HAL_NVIC_EnableIRQ(TIM1_TRG_COM_TIM11_IRQn);
 
-  HAL_TIM_Base_Start_IT(&htim11);
+  // 실행 중인 타이머가 없으면 TIM11은 멈춰 있다.
+  //
+  is_running = false;
+  sw_timer_stop_ms = millis();
 }
 
 void swtimerISR(void)
 {
-  uint8_t i;
+  uint32_t elapsed;
+
+
+  swtimer_stat.isr_cnt++;
+
+  // tickless 주기 동안 지나간 tick을 차례로 처리한다.
+  // 비어있는 슬롯은 비트맵 검사만 하므로 tick당 O(1)이다.
+  //
+  elapsed = sw_timer_period;
+  for (uint32_t i=0; i<elapsed; i++)
+  {
+    sw_timer_counter++;
+    swtimerProcessTick(sw_timer_counter);
+  }
 
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  swtimerSchedule();
+  __set_PRIMASK(primask);
+}
 
-  sw_timer_counter++;
+void swtimerProcessTick(uint32_t tick)
+{
+  uint32_t slot = tick & SWTIMER_WHEEL_MASK;
+  swtimer_handle_t due[_HW_DEF_SW_TIMER_MAX];
+  uint32_t due_cnt = 0;
+  bool is_deferred = false;
+  uint32_t primask;
 
 
-  for (i=0; i<_HW_DEF_SW_TIMER_MAX && i<sw_timer_handle_index; i++)   
+  if ((swtimer_wheel_bitmap & (1ULL << slot)) == 0)
   {
-    if ( swtimer_tbl[i].timer_en == true)                       
+    return;
+  }
+
+  // 콜백에서 타이머를 변경할 수 있으므로 만료된 타이머를 먼저 모은 후 실행한다.
+  //
+  primask = __get_PRIMASK();
+  __disable_irq();
+  int16_t node = swtimer_wheel[slot];
+  while (node != SWTIMER_NODE_NONE)
+  {
+    int16_t next = swtimer_tbl[node].next;
+
+    if ((int32_t)(swtimer_tbl[node].timer_expire - tick) <= 0)
     {
-      swtimer_tbl[i].timer_cnt--;                               
+      swtimerUnlink(node);
 
-      if (swtimer_tbl[i].timer_cnt == 0)                        
+      if(swtimer_tbl[node].timer_mode == ONE_TIME)
+      {
+        swtimer_tbl[node].timer_en = false;
+      }
+      else
       {
-        if(swtimer_tbl[i].timer_mode == ONE_TIME)               
+        // 예정된 만료 tick 기준으로 다시 걸어서 주기 오차가 누적되지 않게 한다.
+        // 한 주기 이상 밀렸으면 현재 tick 기준으로 다시 시작한다.
+        //
+        swtimer_tbl[node].timer_expire += swtimer_tbl[node].timer_init;
+        if ((int32_t)(swtimer_tbl[node].timer_expire - tick) <= 0)
         {
-          swtimer_tbl[i].timer_en = false;                       
+          swtimer_tbl[node].timer_expire = tick + swtimer_tbl[node].timer_init;
         }
+        swtimerLink(node);
+      }
 
-        swtimer_tbl[i].timer_cnt = swtimer_tbl[i].timer_init;   
-
-        (*swtimer_tbl[i].tmr_func)(swtimer_tbl[i].tmr_func_arg);  
+      if (swtimer_tbl[node].is_deferred == true)
+      {
+        swtimer_tbl[node].pending_cnt++;
+        swtimer_stat.defer_cnt++;
+        is_deferred = true;
+      }
+      else
+      {
+        due[due_cnt++] = node;
       }
     }
+    node = next;
+  }
+  __set_PRIMASK(primask);
+
+
+  for (uint32_t i=0; i<due_cnt; i++)
+  {
+    swtimer_stat.fire_cnt++;
+    (*swtimer_tbl[due[i]].tmr_func)(swtimer_tbl[due[i]].tmr_func_arg);
+  }
+
+  if (is_deferred)
+  {
+    #ifdef _USE_HW_EVENT
+    eventPost(EVENT_SWTIMER);
+    #endif
+  }
+}
+
+void swtimerSchedule(void)
+{
+  uint32_t s;
+  uint64_t bitmap;
+
+
+  if (swtimer_wheel_bitmap == 0)
+  {
+    // 만료될 타이머가 없으면 TIM11을 멈춘다.
+    //
+    if (is_running)
+    {
+      HAL_TIM_Base_Stop_IT(&htim11);
+      is_running = false;
+      sw_timer_stop_ms = millis();
+      swtimer_stat.idle_cnt++;
+    }
+    return;
+  }
+
+  // 다음 tick의 슬롯부터 가장 가까운 비어있지 않은 슬롯까지 잠든다.
+  // 현재 슬롯에 남은 타이머는 한 바퀴 뒤(64 tick)로 계산된다.
+  //
+  s = (sw_timer_counter + 1) & SWTIMER_WHEEL_MASK;
+  bitmap = swtimer_wheel_bitmap;
+  bitmap = (bitmap >> s) | (bitmap << ((SWTIMER_WHEEL_SIZE - s) & SWTIMER_WHEEL_MASK));
+
+  swtimerSetPeriod(__builtin_ctzll(bitmap) + 1);
+}
+
+// ticks 는 sw_timer_counter 기준으로 다음 만료까지의 tick 수이다.
+//
+void swtimerSetPeriod(uint32_t ticks)
+{
+  uint32_t arr;
+  uint32_t cnt;
+  uint32_t elapsed;
+
+
+  if (ticks > SWTIMER_TICKLESS_MAX)
+  {
+    ticks = SWTIMER_TICKLESS_MAX;
+  }
+
+  if (is_running == false)
+  {
+    arr = ticks * SWTIMER_TIM_CNT_PER_TICK - 1;
+
+    sw_timer_counter += millis() - sw_timer_stop_ms;
+    sw_timer_period   = ticks;
+    sw_timer_carry    = 0;
+
+    __HAL_TIM_SET_AUTORELOAD(&htim11, arr);
+    __HAL_TIM_SET_COUNTER(&htim11, 0);
+    __HAL_TIM_CLEAR_FLAG(&htim11, TIM_FLAG_UPDATE);
+    HAL_TIM_Base_Start_IT(&htim11);
+    is_running = true;
+    return;
+  }
+
+  // 현재 주기에서 이미 지나간 tick은 ARR을 바꾸기 전에 카운터로 옮긴다.
+  // 다음 만료 전의 슬롯은 비어 있으므로 처리하지 않고 건너뛰어도 된다.
+  //
+  cnt = __HAL_TIM_GET_COUNTER(&htim11) + sw_timer_carry;
+  sw_timer_carry = 0;
+
+  elapsed = cnt / SWTIMER_TIM_CNT_PER_TICK;
+  if (elapsed >= ticks)
+  {
+    elapsed = ticks - 1;
+  }
+  sw_timer_counter += elapsed;
+  ticks -= elapsed;
+  cnt   -= elapsed * SWTIMER_TIM_CNT_PER_TICK;
+  arr    = ticks * SWTIMER_TIM_CNT_PER_TICK - 1;
+
+  // 인터럽트가 늦게 처리되어 이미 만료 시점을 넘었으면 바로 만료시키고
+  // 넘은 카운트는 다음 주기에 더한다.
+  //
+  if (cnt > arr)
+  {
+    sw_timer_carry = cnt - arr;
+    cnt = arr;
+    swtimer_stat.late_cnt++;
+  }
+
+  sw_timer_period = ticks;
+  __HAL_TIM_SET_AUTORELOAD(&htim11, arr);
+  __HAL_TIM_SET_COUNTER(&htim11, cnt);
+}
+
+uint32_t swtimerGetNow(void)
+{
+  if (is_running == false)
+  {
+    return sw_timer_counter + (millis() - sw_timer_stop_ms);
+  }
+
+  // 업데이트 인터럽트가 대기 중이면 현재 주기는 이미 지나간 것이다.
+  //
+  uint32_t now = sw_timer_counter + (__HAL_TIM_GET_COUNTER(&htim11) + sw_timer_carry) / SWTIMER_TIM_CNT_PER_TICK;
+
+  if (__HAL_TIM_GET_FLAG(&htim11, TIM_FLAG_UPDATE) != RESET)
+  {
+    now += sw_timer_period;
+  }
+  return now;
+}
+
+void swtimerLink(swtimer_handle_t handle)
+{
+  uint32_t slot = swtimer_tbl[handle].timer_expire & SWTIMER_WHEEL_MASK;
+
+
+  swtimer_tbl[handle].prev = SWTIMER_NODE_NONE;
+  swtimer_tbl[handle].next = swtimer_wheel[slot];
+  if (swtimer_wheel[slot] != SWTIMER_NODE_NONE)
+  {
+    swtimer_tbl[swtimer_wheel[slot]].prev = handle;
+  }
+  swtimer_wheel[slot] = handle;
+  swtimer_wheel_bitmap |= (1ULL << slot);
+}
+
+void swtimerUnlink(swtimer_handle_t handle)
+{
+  uint32_t slot = swtimer_tbl[handle].timer_expire & SWTIMER_WHEEL_MASK;
+  int16_t  prev = swtimer_tbl[handle].prev;
+  int16_t  next = swtimer_tbl[handle].next;
+
+
+  if (prev != SWTIMER_NODE_NONE)
+    swtimer_tbl[prev].next = next;
+  else
+    swtimer_wheel[slot] = next;
+
+  if (next != SWTIMER_NODE_NONE)
+    swtimer_tbl[next].prev = prev;
+
+  if (swtimer_wheel[slot] == SWTIMER_NODE_NONE)
+  {
+    swtimer_wheel_bitmap &= ~(1ULL << slot);
   }
+  swtimer_tbl[handle].prev = SWTIMER_NODE_NONE;
+  swtimer_tbl[handle].next = SWTIMER_NODE_NONE;
 }
 
 void swtimerSet(swtimer_handle_t handle, uint32_t period_ms, SwtimerMode_t mode, void (*Fnct)(void *), void *arg)
 {
-  if(handle < 0) return;
+  if(handle < 0 || handle >= _HW_DEF_SW_TIMER_MAX) return;
 
-  swtimer_tbl[handle].timer_mode = mode;    
-  swtimer_tbl[handle].tmr_func   = Fnct;       
-  swtimer_tbl[handle].tmr_func_arg = arg;        
-  swtimer_tbl[handle].timer_cnt  = period_ms;
-  swtimer_tbl[handle].timer_init = period_ms;
+  swtimer_tbl[handle].timer_mode = mode;
+  swtimer_tbl[handle].tmr_func   = Fnct;
+  swtimer_tbl[handle].tmr_func_arg = arg;
+  swtimer_tbl[handle].timer_init = period_ms > 0 ? period_ms:1;
+}
+
+void swtimerSetDeferred(swtimer_handle_t handle, bool enable)
+{
+  if(handle < 0 || handle >= _HW_DEF_SW_TIMER_MAX) return;
+
+  swtimer_tbl[handle].is_deferred = enable;
 }
 
 void swtimerStart(swtimer_handle_t handle)
 {
-  if(handle < 0) return;
+  uint32_t primask;
+  uint32_t ticks;
+
+
+  if(handle < 0 || handle >= _HW_DEF_SW_TIMER_MAX) return;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if (swtimer_tbl[handle].timer_en == true)
+  {
+    swtimerUnlink(handle);
+  }
+  swtimer_tbl[handle].timer_expire = swtimerGetNow() + swtimer_tbl[handle].timer_init;
+  swtimer_tbl[handle].timer_en     = true;
+  swtimerLink(handle);
+
+  // 현재 주기보다 먼저 만료되면 TIM11 주기를 줄인다.
+  // 업데이트 인터럽트가 대기 중이면 ISR에서 다시 계산한다.
+  //
+  ticks = swtimer_tbl[handle].timer_expire - sw_timer_counter;
+  if (is_running == false)
+  {
+    swtimerSetPeriod(swtimer_tbl[handle].timer_init);
+  }
+  else if (ticks < sw_timer_period && __HAL_TIM_GET_FLAG(&htim11, TIM_FLAG_UPDATE) == RESET)
+  {
+    swtimerSetPeriod(ticks);
+  }
 
-  swtimer_tbl[handle].timer_cnt = swtimer_tbl[handle].timer_init;
-  swtimer_tbl[handle].timer_en  = true;
+  __set_PRIMASK(primask);
 }
 
 void swtimerStop (swtimer_handle_t handle)
 {
-  if(handle < 0) return;
+  uint32_t primask;
 
-  swtimer_tbl[handle].timer_en = false;
+
+  if(handle < 0 || handle >= _HW_DEF_SW_TIMER_MAX) return;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (swtimer_tbl[handle].timer_en == true)
+  {
+    swtimerUnlink(handle);
+  }
+  swtimer_tbl[handle].timer_en    = false;
+  swtimer_tbl[handle].pending_cnt = 0;
+  __set_PRIMASK(primask);
 }
 
 void swtimerReset(swtimer_handle_t handle)
 {
-  if(handle < 0) return;
+  swtimerStop(handle);
+}
+
+void swtimerUpdate(void)
+{
+  uint16_t pending_cnt;
+
+
+  for (int i=0; i<sw_timer_handle_index; i++)
+  {
+    if (swtimer_tbl[i].pending_cnt == 0)
+    {
+      continue;
+    }
 
-  swtimer_tbl[handle].timer_en   = false;
-  swtimer_tbl[handle].timer_cnt  = swtimer_tbl[handle].timer_init;
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    pending_cnt = swtimer_tbl[i].pending_cnt;
+    swtimer_tbl[i].pending_cnt = 0;
+    __set_PRIMASK(primask);
+
+    while(pending_cnt--)
+    {
+      swtimer_stat.fire_cnt++;
+      (*swtimer_tbl[i].tmr_func)(swtimer_tbl[i].tmr_func_arg);
+    }
+  }
 }
 
 swtimer_handle_t swtimerGetHandle(void)
@@ -155,7 +503,7 @@ swtimer_handle_t swtimerGetHandle(void)
 
 uint32_t swtimerGetCounter(void)
 {
-  return sw_timer_counter;
+  return swtimerGetNow();
 }
 
 void TIM1_TRG_COM_TIM11_IRQHandler(void)
@@ -168,4 +516,50 @@ void swtimerTimerCallback(TIM_HandleTypeDef *htim)
   swtimerISR();
 }
 
+
+#if CLI_USE(HW_SWTIMER)
+void cliSwtimer(cli_args_t *args)
+{
+  bool ret = false;
+
+
+  if (args->argc == 1 && args->isStr(0, "info"))
+  {
+    uint32_t now = swtimerGetCounter();
+
+    cliPrintf("tick       : %d\n", now);
+    cliPrintf("running    : %s, period %d ms\n", is_running ? "on":"off", sw_timer_period);
+    cliPrintf("isr        : %d\n", swtimer_stat.isr_cnt);
+    cliPrintf("fire       : %d\n", swtimer_stat.fire_cnt);
+    cliPrintf("deferred   : %d\n", swtimer_stat.defer_cnt);
+    cliPrintf("idle       : %d\n", swtimer_stat.idle_cnt);
+    cliPrintf("late       : %d\n", swtimer_stat.late_cnt);
+
+    for (int i=0; i<sw_timer_handle_index; i++)
+    {
+      cliPrintf("  %d : %-3s %-4s %-5s %5d ms, remain %d ms\n",
+        i,
+        swtimer_tbl[i].timer_en ? "on":"off",
+        swtimer_tbl[i].timer_mode == ONE_TIME ? "one":"loop",
+        swtimer_tbl[i].is_deferred ? "defer":"isr",
+        swtimer_tbl[i].timer_init,
+        swtimer_tbl[i].timer_en ? (int32_t)(swtimer_tbl[i].timer_expire - now) : 0);
+    }
+    ret = true;
+  }
+
+  if (args->argc == 1 && args->isStr(0, "clear"))
+  {
+    memset(&swtimer_stat, 0, sizeof(swtimer_stat));
+    ret = true;
+  }
+
+  if (ret == false)
+  {
+    cliPrintf("swtimer info\n");
+    cliPrintf("swtimer clear\n");
+  }
+}
+#endif
+
 #endif
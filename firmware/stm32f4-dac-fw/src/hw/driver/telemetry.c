@@ -0,0 +1,289 @@
+#include "telemetry.h"
+
+
+#ifdef _USE_HW_TELEMETRY
+#include "uart.h"
+#include "cli.h"
+#include "util.h"
+#include "usbd_audio.h"
+
+
+// 프레임 구조 (COBS 인코딩 후 앞뒤를 0x00 으로 구분)
+//
+//   type(1) version(1) seq(2) mask(4) field(4) x N crc16(2)
+//
+// CLI 텍스트가 같은 UART 로 나가므로 앞에도 0x00 을 넣어서 텍스트 끝과 프레임을 분리한다.
+//
+#define TELEMETRY_HEADER_LEN    8
+#define TELEMETRY_PAYLOAD_MAX   (TELEMETRY_HEADER_LEN + TELEMETRY_FIELD_MAX * 4 + 2)
+#define TELEMETRY_FRAME_MAX     (1 + TELEMETRY_PAYLOAD_MAX + 2 + 1)
+
+
+typedef struct
+{
+  bool     is_started;
+  uint32_t period_ms;
+  uint32_t mask;
+  uint32_t pre_time;
+  uint16_t seq;
+
+  uint32_t frame_cnt;
+  uint32_t busy_cnt;
+  uint32_t error_cnt;
+} telemetry_t;
+
+
+#if CLI_USE(HW_TELEMETRY)
+static void cliTelemetry(cli_args_t *args);
+#endif
+static uint32_t telemetryCobsEncode(const uint8_t *p_src, uint32_t length, uint8_t *p_dst);
+static uint32_t telemetryBuildFrame(uint8_t *p_frame);
+
+static bool is_init = false;
+static telemetry_t telemetry;
+
+static uint8_t payload_buf[TELEMETRY_PAYLOAD_MAX];
+static uint8_t frame_buf[TELEMETRY_FRAME_MAX];
+
+
+
+
+bool telemetryInit(void)
+{
+  telemetry.is_started = false;
+  telemetry.period_ms  = 100;
+  telemetry.mask       = TELEMETRY_MASK_ALL;
+  telemetry.pre_time   = millis();
+  telemetry.seq        = 0;
+  telemetry.frame_cnt  = 0;
+  telemetry.busy_cnt   = 0;
+  telemetry.error_cnt  = 0;
+
+  is_init = true;
+
+  logPrintf("[OK] telemetryInit()\n");
+
+#if CLI_USE(HW_TELEMETRY)
+  cliAdd("telemetry", cliTelemetry);
+#endif
+  return true;
+}
+
+bool telemetryStart(void)
+{
+  telemetry.pre_time   = millis();
+  telemetry.is_started = true;
+  return true;
+}
+
+bool telemetryStop(void)
+{
+  telemetry.is_started = false;
+  return true;
+}
+
+bool telemetryIsStarted(void)
+{
+  return telemetry.is_started;
+}
+
+void telemetrySetPeriod(uint32_t period_ms)
+{
+  telemetry.period_ms = constrain(period_ms, 1, 60000);
+}
+
+void telemetrySetMask(uint32_t mask)
+{
+  telemetry.mask = mask & TELEMETRY_MASK_ALL;
+}
+
+void telemetryUpdate(void)
+{
+  uint32_t frame_len;
+
+
+  if (is_init != true || telemetry.is_started != true)
+  {
+    return;
+  }
+  if (millis()-telemetry.pre_time < telemetry.period_ms)
+  {
+    return;
+  }
+
+  // 송신 버퍼가 부족하면 다음 루프에서 다시 시도한다.
+  //
+  if (uartAvailableForWrite(TELEMETRY_CH) < TELEMETRY_FRAME_MAX)
+  {
+    telemetry.busy_cnt++;
+    return;
+  }
+  telemetry.pre_time = millis();
+
+  frame_len = telemetryBuildFrame(frame_buf);
+  if (frame_len == 0)
+  {
+    telemetry.error_cnt++;
+    return;
+  }
+
+  if (uartWrite(TELEMETRY_CH, frame_buf, frame_len) == frame_len)
+  {
+    telemetry.frame_cnt++;
+  }
+  else
+  {
+    telemetry.error_cnt++;
+  }
+}
+
+uint32_t telemetryBuildFrame(uint8_t *p_frame)
+{
+  USBD_AUDIO_StatTypeDef stat;
+  uint32_t field[TELEMETRY_FIELD_MAX];
+  uint32_t index;
+  uint32_t frame_len;
+  uint16_t crc = 0;
+
+
+  if (USBD_AUDIO_GetStat(&stat) != USBD_OK)
+  {
+    return 0;
+  }
+
+  field[TELEMETRY_FIELD_TIME]           = stat.time_ms;
+  field[TELEMETRY_FIELD_ALT]            = stat.alt_setting;
+  field[TELEMETRY_FIELD_BUF_LEVEL]      = stat.buf_level;
+  field[TELEMETRY_FIELD_FREQ]           = stat.freq;
+  field[TELEMETRY_FIELD_FREQ_REAL]      = stat.freq_real;
+  field[TELEMETRY_FIELD_HOST_RATE]      = stat.host_rate_mhz;
+  field[TELEMETRY_FIELD_DRIFT]          = (uint32_t)stat.drift_ppm;
+  field[TELEMETRY_FIELD_FEEDBACK]       = stat.fb_value;
+  field[TELEMETRY_FIELD_FILL]           = stat.fill_samples;
+  field[TELEMETRY_FIELD_UNDERRUN]       = stat.underrun_cnt;
+  field[TELEMETRY_FIELD_EMPTY_SOF]      = stat.empty_sof_cnt;
+  field[TELEMETRY_FIELD_ISR_CYCLES]     = stat.isr_cycles;
+  field[TELEMETRY_FIELD_ISR_CYCLES_MAX] = stat.isr_cycles_max;
+  field[TELEMETRY_FIELD_ISO_OUT_INC]    = stat.iso_out_incomplete;
+
+  payload_buf[0] = TELEMETRY_TYPE_AUDIO;
+  payload_buf[1] = TELEMETRY_VERSION;
+  payload_buf[2] = (telemetry.seq >> 0) & 0xFF;
+  payload_buf[3] = (telemetry.seq >> 8) & 0xFF;
+  memcpy(&payload_buf[4], &telemetry.mask, 4);
+  index = TELEMETRY_HEADER_LEN;
+
+  for (int i=0; i<TELEMETRY_FIELD_MAX; i++)
+  {
+    if (telemetry.mask & (1UL << i))
+    {
+      memcpy(&payload_buf[index], &field[i], 4);
+      index += 4;
+    }
+  }
+
+  for (int i=0; i<index; i++)
+  {
+    utilUpdateCrc(&crc, payload_buf[i]);
+  }
+  payload_buf[index++] = (crc >> 0) & 0xFF;
+  payload_buf[index++] = (crc >> 8) & 0xFF;
+
+  p_frame[0] = 0x00;
+  frame_len  = 1 + telemetryCobsEncode(payload_buf, index, &p_frame[1]);
+  p_frame[frame_len++] = 0x00;
+
+  telemetry.seq++;
+
+  return frame_len;
+}
+
+uint32_t telemetryCobsEncode(const uint8_t *p_src, uint32_t length, uint8_t *p_dst)
+{
+  uint32_t rd_i = 0;
+  uint32_t wr_i = 1;
+  uint32_t code_i = 0;
+  uint8_t  code = 1;
+
+
+  while(rd_i < length)
+  {
+    if (p_src[rd_i] == 0)
+    {
+      p_dst[code_i] = code;
+      code   = 1;
+      code_i = wr_i++;
+    }
+    else
+    {
+      p_dst[wr_i++] = p_src[rd_i];
+      code++;
+      if (code == 0xFF)
+      {
+        p_dst[code_i] = code;
+        code   = 1;
+        code_i = wr_i++;
+      }
+    }
+    rd_i++;
+  }
+  p_dst[code_i] = code;
+
+  return wr_i;
+}
+
+
+#if CLI_USE(HW_TELEMETRY)
+void cliTelemetry(cli_args_t *args)
+{
+  bool ret = false;
+
+
+  if (args->argc == 1 && args->isStr(0, "info"))
+  {
+    cliPrintf("started   : %s\n", telemetry.is_started ? "True":"False");
+    cliPrintf("ch        : _DEF_UART%d\n", TELEMETRY_CH + 1);
+    cliPrintf("period    : %d ms\n", telemetry.period_ms);
+    cliPrintf("mask      : 0x%04X\n", telemetry.mask);
+    cliPrintf("frame cnt : %d\n", telemetry.frame_cnt);
+    cliPrintf("busy cnt  : %d\n", telemetry.busy_cnt);
+    cliPrintf("error cnt : %d\n", telemetry.error_cnt);
+    ret = true;
+  }
+
+  if (args->argc == 1 && args->isStr(0, "start"))
+  {
+    telemetryStart();
+    ret = true;
+  }
+
+  if (args->argc == 1 && args->isStr(0, "stop"))
+  {
+    telemetryStop();
+    ret = true;
+  }
+
+  if (args->argc == 2 && args->isStr(0, "period"))
+  {
+    telemetrySetPeriod(args->getData(1));
+    ret = true;
+  }
+
+  if (args->argc == 2 && args->isStr(0, "mask"))
+  {
+    telemetrySetMask(args->getData(1));
+    ret = true;
+  }
+
+  if (ret == false)
+  {
+    cliPrintf("telemetry info\n");
+    cliPrintf("telemetry start\n");
+    cliPrintf("telemetry stop\n");
+    cliPrintf("telemetry period ms\n");
+    cliPrintf("telemetry mask 0x0~0x%X\n", TELEMETRY_MASK_ALL);
+  }
+}
+#endif
+
+#endif
@@ -1,6 +1,7 @@
 #include "uart.h"
 #include "qbuffer.h"
 #include "cli.h"
+#include "event.h"
 #ifdef _USE_HW_USB
 #include "cdc.h"
 #endif
@@ -9,6 +10,8 @@
 
 
 #define UART_RX_BUF_LENGTH        1024
+#define UART_TX_BUF_LENGTH        2048
+#define UART_TX_DMA_MAX           512       // DMA 1회 전송 최대 길이
 
 
 
@@ -21,9 +24,25 @@ typedef struct
   qbuffer_t qbuffer;
   UART_HandleTypeDef *p_huart;
   DMA_HandleTypeDef  *p_hdma_rx;
+  DMA_HandleTypeDef  *p_hdma_tx;
+
+  uint8_t  *tx_buf;
+  qbuffer_t tx_q;
+  volatile bool     tx_dma_busy;
+  volatile uint32_t tx_dma_len;           // 현재 DMA 전송 길이
+  volatile uint32_t tx_dma_done;          // 현재 전송중 해제된 길이
 
   uint32_t rx_cnt;
   uint32_t tx_cnt;
+  uint32_t tx_dma_cnt;
+  uint32_t tx_dma_chunk;
+  uint32_t tx_drop_cnt;
+  uint32_t tx_wait_cnt;
+  uint32_t tx_bps;
+  uint32_t tx_bps_cnt;
+  uint32_t tx_bps_time;
+
+  void (*tx_done_func)(void);
 } uart_tbl_t;
 
 typedef struct
@@ -42,6 +61,9 @@ typedef struct
 #if CLI_USE(HW_UART)
 static void cliUart(cli_args_t *args);
 #endif
+static uint32_t uartWriteRing(uint8_t ch, uint8_t *p_data, uint32_t length);
+static void     uartStartTxDMA(uint8_t ch);
+static void     uartTxRelease(uint8_t ch, uint32_t length);
 
 
 static bool is_init = false;
@@ -50,11 +72,14 @@ static uart_tbl_t uart_tbl[UART_MAX_CH];
 
 static UART_HandleTypeDef huart1;
 static DMA_HandleTypeDef hdma_usart1_rx;
+static DMA_HandleTypeDef hdma_usart1_tx;
+
+static uint8_t uart1_tx_buf[UART_TX_BUF_LENGTH];
 
 
 const static uart_hw_t uart_hw_tbl[UART_MAX_CH] = 
   {
-    {"USART1 SWD   ", USART1, &huart1, &hdma_usart1_rx, NULL, false},
+    {"USART1 SWD   ", USART1, &huart1, &hdma_usart1_rx, &hdma_usart1_tx, false},
     {"USB    CDC   ", NULL,   NULL,    NULL,            NULL, false},
   };
 
@@ -70,7 +95,18 @@ bool uartInit(void)
     uart_tbl[i].baud = 57600;
     uart_tbl[i].rx_cnt = 0;
     uart_tbl[i].tx_cnt = 0;    
+    uart_tbl[i].tx_dma_cnt = 0;
+    uart_tbl[i].tx_dma_chunk = 0;
+    uart_tbl[i].tx_drop_cnt = 0;
+    uart_tbl[i].tx_wait_cnt = 0;
+    uart_tbl[i].tx_bps = 0;
+    uart_tbl[i].tx_bps_cnt = 0;
+    uart_tbl[i].tx_bps_time = 0;
+    uart_tbl[i].tx_dma_busy = false;
+    uart_tbl[i].tx_done_func = NULL;
   }
+  uart_tbl[_DEF_UART1].tx_buf = uart1_tx_buf;
+  qbufferCreate(&uart_tbl[_DEF_UART1].tx_q, uart1_tx_buf, UART_TX_BUF_LENGTH);
 
   is_init = true;
 
@@ -111,6 +147,7 @@ bool uartOpen(uint8_t ch, uint32_t baud)
 
       uart_tbl[ch].p_huart   = uart_hw_tbl[ch].p_huart;
       uart_tbl[ch].p_hdma_rx = uart_hw_tbl[ch].p_hdma_rx;
+      uart_tbl[ch].p_hdma_tx = uart_hw_tbl[ch].p_hdma_tx;
       uart_tbl[ch].p_huart->Instance = uart_hw_tbl[ch].p_uart;    
 
       uart_tbl[ch].p_huart->Init.BaudRate       = baud;
@@ -124,6 +161,14 @@ bool uartOpen(uint8_t ch, uint32_t baud)
 
       qbufferCreate(&uart_tbl[ch].qbuffer, &uart_tbl[ch].rx_buf[0], UART_RX_BUF_LENGTH);
 
+      // 보레이트 변경시 남은 데이터를 먼저 전송한다.
+      //
+      if (uart_tbl[ch].is_open == true)
+      {
+        uartFlushTx(ch, 100);
+      }
+      uart_tbl[ch].is_open = false;
+
 
       __HAL_RCC_DMA2_CLK_ENABLE();
 
@@ -139,6 +184,9 @@ bool uartOpen(uint8_t ch, uint32_t baud)
         {
           ret = false;
         }
+        // 수신 후 라인이 IDLE 되면 이벤트를 발생시킨다.
+        //
+        __HAL_UART_ENABLE_IT(uart_tbl[ch].p_huart, UART_IT_IDLE);
 
         uart_tbl[ch].qbuffer.in  = uart_tbl[ch].qbuffer.len - ((DMA_Stream_TypeDef *)uart_tbl[ch].p_huart->hdmarx->Instance)->NDTR;
         uart_tbl[ch].qbuffer.out = uart_tbl[ch].qbuffer.in;
@@ -234,10 +282,7 @@ uint32_t uartWrite(uint8_t ch, uint8_t *p_data, uint32_t length)
   switch(ch)
   {
     case _DEF_UART1:
-      if (HAL_UART_Transmit(uart_tbl[ch].p_huart, p_data, length, 100) == HAL_OK)
-      {
-        ret = length;
-      }
+      ret = uartWriteRing(ch, p_data, length);
       break;
 
     case _DEF_UART2:
@@ -251,6 +296,168 @@ uint32_t uartWrite(uint8_t ch, uint8_t *p_data, uint32_t length)
   return ret;
 }
 
+uint32_t uartWriteRing(uint8_t ch, uint8_t *p_data, uint32_t length)
+{
+  uart_tbl_t *p_uart = &uart_tbl[ch];
+  uint32_t written = 0;
+  uint32_t wr_len;
+  uint32_t primask;
+  uint32_t pre_time;
+  bool is_isr;
+
+
+  if (p_uart->is_open != true)
+  {
+    return 0;
+  }
+  // 인터럽트가 막혀 있으면 millis()/DMA 완료가 진행되지 않으므로 ISR 과 같이 처리한다.
+  //
+  is_isr   = (__get_IPSR() != 0) || (__get_PRIMASK() != 0);
+  pre_time = millis();
+
+  while(written < length)
+  {
+    // 여러 컨텍스트에서 호출되므로 링버퍼 쓰기는 인터럽트를 막고 처리한다.
+    //
+    primask = __get_PRIMASK();
+    __disable_irq();
+    wr_len = constrain(length - written, 0, qbufferAvailableForWrite(&p_uart->tx_q));
+    qbufferWrite(&p_uart->tx_q, &p_data[written], wr_len);
+    __set_PRIMASK(primask);
+
+    written += wr_len;
+    uartStartTxDMA(ch);
+
+    if (written == length)
+    {
+      break;
+    }
+
+    // 인터럽트에서는 기다리지 않고 남은 부분을 버린다.
+    //
+    if (is_isr == true || millis()-pre_time >= 100)
+    {
+      p_uart->tx_drop_cnt += length - written;
+      break;
+    }
+    p_uart->tx_wait_cnt++;
+  }
+
+  return written;
+}
+
+void uartStartTxDMA(uint8_t ch)
+{
+  uart_tbl_t *p_uart = &uart_tbl[ch];
+  uint32_t primask;
+  uint32_t out;
+  uint32_t tx_len;
+
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if (p_uart->tx_dma_busy != true && qbufferAvailable(&p_uart->tx_q) > 0)
+  {
+    // 링버퍼의 연속된 영역만 한번에 전송한다.
+    //
+    out = p_uart->tx_q.out;
+    if (p_uart->tx_q.in > out)
+      tx_len = p_uart->tx_q.in - out;
+    else
+      tx_len = p_uart->tx_q.len - out;
+    tx_len = constrain(tx_len, 0, UART_TX_DMA_MAX);
+
+    if (HAL_UART_Transmit_DMA(p_uart->p_huart, &p_uart->tx_buf[out], tx_len) == HAL_OK)
+    {
+      p_uart->tx_dma_busy = true;
+      p_uart->tx_dma_len  = tx_len;
+      p_uart->tx_dma_done = 0;
+      p_uart->tx_dma_chunk++;
+    }
+  }
+
+  __set_PRIMASK(primask);
+}
+
+void uartTxRelease(uint8_t ch, uint32_t length)
+{
+  uart_tbl_t *p_uart = &uart_tbl[ch];
+
+  p_uart->tx_q.out    = (p_uart->tx_q.out + length) % p_uart->tx_q.len;
+  p_uart->tx_dma_done += length;
+  p_uart->tx_dma_cnt  += length;
+  p_uart->tx_bps_cnt  += length;
+}
+
+uint32_t uartAvailableForWrite(uint8_t ch)
+{
+  uint32_t ret = 0;
+
+
+  switch(ch)
+  {
+    case _DEF_UART1:
+      ret = qbufferAvailableForWrite(&uart_tbl[ch].tx_q);
+      break;
+
+    case _DEF_UART2:
+      #ifdef _USE_HW_USB
+      ret = cdcAvailableForWrite();
+      #endif
+      break;
+  }
+
+  return ret;
+}
+
+bool uartIsTxBusy(uint8_t ch)
+{
+  bool ret = false;
+
+
+  switch(ch)
+  {
+    case _DEF_UART1:
+      ret = uart_tbl[ch].tx_dma_busy || qbufferAvailable(&uart_tbl[ch].tx_q) > 0;
+      break;
+  }
+
+  return ret;
+}
+
+bool uartFlushTx(uint8_t ch, uint32_t timeout)
+{
+  uint32_t pre_time;
+
+
+  pre_time = millis();
+  while(uartIsTxBusy(ch))
+  {
+    if (millis()-pre_time >= timeout)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+uint32_t uartGetTxBps(uint8_t ch)
+{
+  if (ch >= UART_MAX_CH) return 0;
+
+  return uart_tbl[ch].tx_bps;
+}
+
+bool uartSetTxDoneCallback(uint8_t ch, void (*p_func)(void))
+{
+  if (ch >= UART_MAX_CH) return false;
+
+  uart_tbl[ch].tx_done_func = p_func;
+  return true;
+}
+
 uint32_t uartPrintf(uint8_t ch, const char *fmt, ...)
 {
   char buf[256];
@@ -342,6 +549,30 @@ void HAL_UART_MspInit(UART_HandleTypeDef* uartHandle)
     }
 
     __HAL_LINKDMA(uartHandle,hdmarx,hdma_usart1_rx);
+
+    /* USART1_TX Init */
+    hdma_usart1_tx.Instance = DMA2_Stream7;
+    hdma_usart1_tx.Init.Channel = DMA_CHANNEL_4;
+    hdma_usart1_tx.Init.Direction = DMA_MEMORY_TO_PERIPH;
+    hdma_usart1_tx.Init.PeriphInc = DMA_PINC_DISABLE;
+    hdma_usart1_tx.Init.MemInc = DMA_MINC_ENABLE;
+    hdma_usart1_tx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    hdma_usart1_tx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+    hdma_usart1_tx.Init.Mode = DMA_NORMAL;
+    hdma_usart1_tx.Init.Priority = DMA_PRIORITY_LOW;
+    hdma_usart1_tx.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+    if (HAL_DMA_Init(&hdma_usart1_tx) != HAL_OK)
+    {
+      Error_Handler();
+    }
+
+    __HAL_LINKDMA(uartHandle,hdmatx,hdma_usart1_tx);
+
+    /* USART1 interrupt Init */
+    HAL_NVIC_SetPriority(DMA2_Stream7_IRQn, 14, 0);
+    HAL_NVIC_EnableIRQ(DMA2_Stream7_IRQn);
+    HAL_NVIC_SetPriority(USART1_IRQn, 14, 0);
+    HAL_NVIC_EnableIRQ(USART1_IRQn);
   }
 }
 
@@ -360,9 +591,77 @@ void HAL_UART_MspDeInit(UART_HandleTypeDef* uartHandle)
 
     /* USART1 DMA DeInit */
     HAL_DMA_DeInit(uartHandle->hdmarx);
+    HAL_DMA_DeInit(uartHandle->hdmatx);
+
+    HAL_NVIC_DisableIRQ(DMA2_Stream7_IRQn);
+    HAL_NVIC_DisableIRQ(USART1_IRQn);
+  }
+}
+
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+  // 에러 발생시 HAL이 RX DMA를 중지하므로 다시 시작한다.
+  //
+  if (huart->Instance == USART1 && huart->RxState == HAL_UART_STATE_READY)
+  {
+    uart_tbl[_DEF_UART1].qbuffer.in  = 0;
+    uart_tbl[_DEF_UART1].qbuffer.out = 0;
+    HAL_UART_Receive_DMA(huart, (uint8_t *)&uart_tbl[_DEF_UART1].rx_buf[0], UART_RX_BUF_LENGTH);
+  }
+}
+
+void HAL_UART_TxHalfCpltCallback(UART_HandleTypeDef *huart)
+{
+  // DMA가 읽어간 앞쪽 절반은 미리 해제한다.
+  //
+  if (huart->Instance == USART1)
+  {
+    uartTxRelease(_DEF_UART1, uart_tbl[_DEF_UART1].tx_dma_len / 2);
+  }
+}
+
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+  if (huart->Instance == USART1)
+  {
+    uart_tbl_t *p_uart = &uart_tbl[_DEF_UART1];
+
+    uartTxRelease(_DEF_UART1, p_uart->tx_dma_len - p_uart->tx_dma_done);
+    p_uart->tx_dma_busy = false;
+
+    if (millis()-p_uart->tx_bps_time >= 1000)
+    {
+      p_uart->tx_bps      = p_uart->tx_bps_cnt * 1000 / (millis()-p_uart->tx_bps_time);
+      p_uart->tx_bps_cnt  = 0;
+      p_uart->tx_bps_time = millis();
+    }
+
+    uartStartTxDMA(_DEF_UART1);
+
+    if (p_uart->tx_done_func != NULL)
+    {
+      p_uart->tx_done_func();
+    }
   }
 }
 
+void USART1_IRQHandler(void)
+{
+  if (__HAL_UART_GET_FLAG(&huart1, UART_FLAG_IDLE) && __HAL_UART_GET_IT_SOURCE(&huart1, UART_IT_IDLE))
+  {
+    __HAL_UART_CLEAR_IDLEFLAG(&huart1);
+    #ifdef _USE_HW_EVENT
+    eventPost(EVENT_UART_RX);
+    #endif
+  }
+  HAL_UART_IRQHandler(&huart1);
+}
+
+void DMA2_Stream7_IRQHandler(void)
+{
+  HAL_DMA_IRQHandler(&hdma_usart1_tx);
+}
+
 #if CLI_USE(HW_UART)
 void cliUart(cli_args_t *args)
 {
@@ -375,6 +674,16 @@ void cliUart(cli_args_t *args)
     {
       cliPrintf("_DEF_UART%d : %s, %d bps\n", i+1, uart_hw_tbl[i].p_msg, uartGetBaud(i));
     }
+    for (int i=0; i<UART_MAX_CH; i++)
+    {
+      cliPrintf("_DEF_UART%d : rx_cnt %d, tx_cnt %d\n", i+1, uart_tbl[i].rx_cnt, uart_tbl[i].tx_cnt);
+    }
+    cliPrintf("_DEF_UART1 : tx_dma %d, chunk %d, drop %d, wait %d, %d B/s\n", 
+      uart_tbl[_DEF_UART1].tx_dma_cnt,
+      uart_tbl[_DEF_UART1].tx_dma_chunk,
+      uart_tbl[_DEF_UART1].tx_drop_cnt,
+      uart_tbl[_DEF_UART1].tx_wait_cnt,
+      uart_tbl[_DEF_UART1].tx_bps);
     ret = true;
   }
 
@@ -418,9 +727,24 @@ void cliUart(cli_args_t *args)
     ret = true;
   }
 
+  if (args->argc == 3 && args->isStr(0, "baud"))
+  {
+    uint8_t  uart_ch;
+    uint32_t baud;
+
+    uart_ch = constrain(args->getData(1), 1, UART_MAX_CH) - 1;
+    baud    = args->getData(2);
+
+    cliPrintf("_DEF_UART%d : %d bps\n", uart_ch + 1, baud);
+    uartFlushTx(uart_ch, 100);
+    uartOpen(uart_ch, baud);
+    ret = true;
+  }
+
   if (ret == false)
   {
     cliPrintf("uart info\n");
+    cliPrintf("uart baud ch[1~%d] baud\n", HW_UART_MAX_CH);
     cliPrintf("uart test ch[1~%d]\n", HW_UART_MAX_CH);
   }
 }
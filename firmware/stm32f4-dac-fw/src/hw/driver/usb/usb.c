@@ -13,10 +13,25 @@
 #ifdef _USE_HW_USB
 #include "cdc.h"
 #include "cli.h"
+#include "i2s.h"
+#include "event.h"
 
 static bool is_init = false;
 static UsbMode_t is_usb_mode = USB_NON_MODE;
 
+// suspend/resume 상태와 측정값
+//
+static volatile bool     usb_suspend_req = false;
+static volatile uint32_t usb_suspend_time = 0;
+static bool     usb_suspended = false;
+static uint32_t usb_suspend_cnt = 0;
+static uint32_t usb_stop_cnt = 0;
+static uint32_t usb_enter_us = 0;                     // suspend 인터럽트 -> STOP 진입
+static uint32_t usb_enter_us_max = 0;
+static uint32_t usb_exit_us = 0;                      // STOP 해제 -> 클럭 복원
+static uint32_t usb_exit_us_max = 0;
+static uint32_t usb_resume_us = 0;                    // resume 인터럽트 -> 오디오 재시작
+
 USBD_HandleTypeDef USBD_Device;
 extern PCD_HandleTypeDef hpcd_USB_OTG_FS;
 
@@ -171,11 +186,98 @@ UsbType_t usbGetType(void)
   return (UsbType_t)cdcGetType();
 }
 
-void OTG_FS_IRQHandler(void)
+// USB 인터럽트에서 호출된다. 실제 처리는 usbUpdate()에서 한다.
+//
+void usbSuspendCallback(void)
+{
+  // enumeration 전의 suspend(호스트 없음)는 무시한다.
+  //
+  if (USBD_Device.dev_old_state != USBD_STATE_CONFIGURED)
+  {
+    return;
+  }
+  usb_suspend_time = micros();
+  usb_suspend_req  = true;
+  eventPost(EVENT_USB_CTRL);
+}
+
+void usbResumeCallback(void)
+{
+  __HAL_PCD_UNGATE_PHYCLOCK(&hpcd_USB_OTG_FS);
+  usb_suspend_req = false;
+  eventPost(EVENT_USB_CTRL);
+}
+
+bool usbIsSuspended(void)
+{
+  return usb_suspended;
+}
+
+void usbUpdate(void)
+{
+  uint32_t exit_us;
+
+
+  if (usb_suspend_req == true && usb_suspended == false)
+  {
+    usb_suspended = true;
+    usb_suspend_cnt++;
+
+    // 오디오 경로를 먼저 멈춘다. (코덱 저전력, I2S DMA 정지)
+    //
+    i2sSetSuspend(true);
+    logPrintf("[  ] usb suspend\n");
+
+    #if HW_USB_SUSPEND_STOP == 1
+    #ifdef _USE_HW_RTOS
+    vTaskSuspendAll();
+    #endif
+    usb_enter_us = micros() - usb_suspend_time;
+    if (usb_enter_us > usb_enter_us_max)
+    {
+      usb_enter_us_max = usb_enter_us;
+    }
+
+    // resume 외의 요인으로 깨어나면 다시 STOP 으로 들어간다.
+    // 검사와 진입 사이에 resume 이 오면 bspEnterStop() 이 들어가지 않고 돌아온다.
+    //
+    while(bspEnterStop(&usb_suspend_req, &exit_us) == true)
+    {
+      if (exit_us > usb_exit_us_max)
+      {
+        usb_exit_us_max = exit_us;
+      }
+      usb_exit_us = exit_us;
+      usb_stop_cnt++;
+    }
+    #ifdef _USE_HW_RTOS
+    xTaskResumeAll();
+    #endif
+    #endif
+  }
+
+  if (usb_suspend_req == false && usb_suspended == true)
+  {
+    uint32_t pre_time = micros();
+
+    usb_suspended = false;
+    i2sSetSuspend(false);
+    usb_resume_us = micros() - pre_time;
+    logPrintf("[  ] usb resume %d us\n", usb_resume_us);
+  }
+}
+
+__RAMFUNC void OTG_FS_IRQHandler(void)
 {
   HAL_PCD_IRQHandler(&hpcd_USB_OTG_FS);
 }
 
+void OTG_FS_WKUP_IRQHandler(void)
+{
+  __HAL_PCD_UNGATE_PHYCLOCK(&hpcd_USB_OTG_FS);
+  __HAL_USB_OTG_FS_WAKEUP_EXTI_CLEAR_FLAG();
+}
+
 
 #if CLI_USE(HW_USB)
 void cliCmd(cli_args_t *args)
@@ -251,9 +353,22 @@ void cliCmd(cli_args_t *args)
     ret = true;
   }
 
+  if (args->argc == 1 && args->isStr(0, "power") == true)
+  {
+    cliPrintf("suspended    : %s\n", usb_suspended ? "yes":"no");
+    cliPrintf("suspend cnt  : %d\n", usb_suspend_cnt);
+    cliPrintf("stop cnt     : %d\n", usb_stop_cnt);
+    cliPrintf("enter time   : %d us (max %d)\n", usb_enter_us, usb_enter_us_max);
+    cliPrintf("exit time    : %d us (max %d)\n", usb_exit_us, usb_exit_us_max);
+    cliPrintf("audio resume : %d us\n", usb_resume_us);
+    cliPrintf("first sample : %d us\n", i2sGetFirstSampleUs());
+    ret = true;
+  }
+
   if (ret == false)
   {
     cliPrintf("usb info\n");
+    cliPrintf("usb power\n");
     cliPrintf("usb tx\n");
     cliPrintf("usb rx\n");
   }
@@ -64,6 +64,11 @@ bool usbIsConnect(void);
 UsbMode_t usbGetMode(void);
 UsbType_t usbGetType(void);
 
+void usbSuspendCallback(void);
+void usbResumeCallback(void);
+void usbUpdate(void);
+bool usbIsSuspended(void);
+
 
 #endif
 
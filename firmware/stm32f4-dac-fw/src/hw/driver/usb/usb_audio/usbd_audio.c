@@ -64,6 +64,7 @@ EndBSPDependencies */
 #include "usbd_ctlreq.h"
 #include "cli.h"
 #include "i2s.h"
+#include "conv.h"
 
 /** @addtogroup STM32_USB_DEVICE_LIBRARY
   * @{
@@ -107,6 +108,17 @@ EndBSPDependencies */
 #define USB_SOF_NUMBER() ((((USB_OTG_DeviceTypeDef *)((uint32_t )USB_OTG_HS + USB_OTG_DEVICE_BASE))->DSTS&USB_OTG_DSTS_FNSOF)>>USB_OTG_DSTS_FNSOF_Pos)
 
 
+// 패킷 바이트를 프레임(L+R 샘플) 수로 변환, ISR에서 나눗셈을 피하기 위해 역수를 곱한다.
+// 역수는 alt 설정이 바뀔 때 AUDIO_FrameRecip() 로 구하며 프레임 크기 8바이트 이하,
+// 패킷 4096 바이트 미만에서 나눗셈과 같다. (24비트 스테레오 : 10923)
+//
+#define AUDIO_BYTES_TO_FRAMES(bytes, recip)  (((uint32_t)(bytes) * (recip)) >> 16)
+#define AUDIO_FrameRecip(subframe)           ((65536U + (subframe) * USBD_AUDIO_CHANNELS - 1U) / ((subframe) * USBD_AUDIO_CHANNELS))
+
+#define AUDIO_STAT_HIST_MAX           ((USBD_AUDIO_FREQ_MAX / 1000U) + 2U)
+#define AUDIO_STAT_SOF_PER_SEC        1000U
+
+
 #define USBD_AUDIO_LOG     1
 
 #if (USBD_AUDIO_LOG > 0)
@@ -116,6 +128,29 @@ EndBSPDependencies */
 #endif 
 
 
+typedef struct
+{
+  uint32_t pkt_frames;                      // SOF 이후 수신된 프레임 수
+  uint32_t pkt_cnt;                         // SOF 이후 수신된 패킷 수
+
+  uint32_t sec_sof;
+  uint32_t sec_frames;
+  uint32_t rate_hz;                         // 직전 1000 SOF 동안 수신된 프레임 수
+
+  uint64_t total_frames;                    // 스트림 시작 이후 누적
+  uint32_t total_sof;
+
+  uint32_t empty_cnt;                       // 패킷 없이 지나간 SOF
+  uint32_t multi_cnt;                       // 한 SOF에 2개 이상 수신된 경우
+
+  uint32_t pkt_cycles;                      // 마지막 패킷 수신 시간 (cycles)
+  uint32_t pkt_gap;                         // 패킷 수신 간격 (cycles), CLI 에서 us 로 변환
+  uint32_t pkt_gap_min;
+  uint32_t pkt_gap_max;
+  uint32_t hist[AUDIO_STAT_HIST_MAX];       // 패킷당 프레임 수 히스토그램
+} audio_rate_stat_t;
+
+
 /**
   * @}
   */
@@ -154,6 +189,12 @@ static int32_t  AUDIO_Get_Vol3dB_Shift(int16_t volume);
 static int32_t  AUDIO_Volume_Ctrl(int32_t sample, int32_t shift_3dB);
 static uint8_t  AUDIO_UpdateFeedbackFreq(USBD_HandleTypeDef *pdev);
 
+static void AUDIO_RateStatClear(void);
+static void AUDIO_RateStatGet(audio_rate_stat_t *p_stat);
+static void AUDIO_RateStatPacket(uint32_t now_cycles);
+static void AUDIO_RateStatSof(void);
+static uint8_t AUDIO_VendorRequest(USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef *req);
+
 static void cliCmd(cli_args_t *args);
 
 
@@ -309,7 +350,7 @@ __ALIGN_BEGIN static uint8_t USBD_AUDIO_CfgDesc[USB_AUDIO_CONFIG_DESC_SIZ_ADD] _
   AUDIO_INTERFACE_DESCRIPTOR_TYPE,      /* bDescriptorType */
   AUDIO_STREAMING_FORMAT_TYPE,          /* bDescriptorSubtype */
   AUDIO_FORMAT_TYPE_I,                  /* bFormatType */
-  2,                                    /* bNrChannels */
+  USBD_AUDIO_CHANNELS,                  /* bNrChannels */
   USBD_AUDIO_BIT_BYTES,                 /* bSubFrameSize :  3 Bytes per frame (24bits) */
   USBD_AUDIO_BIT_LEN,                   /* bBitResolution (24-bits per sample) */
   1,                                    /* bSamFreqType only one frequency supported */
@@ -368,10 +409,11 @@ __ALIGN_BEGIN static uint8_t USBD_AUDIO_DeviceQualifierDesc[USB_LEN_DEV_QUALIFIE
 };
 
 volatile static bool is_init  = false;
-volatile static uint32_t rx_count = 0;
-volatile static uint32_t rx_rate = 0;
 volatile USBD_HandleTypeDef *p_usb_dev = NULL;
 
+static audio_rate_stat_t rate_stat;
+static USBD_AUDIO_StatTypeDef vendor_stat;
+
 enum
 {
   DATA_RATE_ISO_IN_INCOMPLETE,
@@ -443,6 +485,7 @@ static uint8_t USBD_AUDIO_Init(USBD_HandleTypeDef *pdev, uint8_t cfgidx)
   haudio->volume_percent = AUDIO_Volume_Ctrl(100, haudio->vol_3dB_shift/2);  
   haudio->freq = USBD_AUDIO_FREQ;
   haudio->bit_depth = USBD_AUDIO_BIT_BYTES;
+  haudio->frame_recip = AUDIO_FrameRecip(haudio->bit_depth);
   haudio->fb_normal = AUDIO_GetFeedbackValue(USBD_AUDIO_FREQ);
   haudio->fb_target = haudio->fb_normal;
 
@@ -621,6 +664,7 @@ static uint8_t USBD_AUDIO_Setup(USBD_HandleTypeDef *pdev,
                 else 
                 {
                 	haudio->bit_depth = USBD_AUDIO_BIT_BYTES;
+                	haudio->frame_recip = AUDIO_FrameRecip(haudio->bit_depth);
                  	AUDIO_OUT_Restart(pdev);                  
                 }
               }
@@ -649,6 +693,11 @@ static uint8_t USBD_AUDIO_Setup(USBD_HandleTypeDef *pdev,
           break;
       }
       break;
+
+    case USB_REQ_TYPE_VENDOR:
+      ret = (USBD_StatusTypeDef)AUDIO_VendorRequest(pdev, req);
+      break;
+
     default:
       USBD_CtlError(pdev, req);
       ret = USBD_FAIL;
@@ -750,6 +799,24 @@ static uint8_t USBD_AUDIO_EP0_RxReady(USBD_HandleTypeDef *pdev)
     haudio->control.cmd      = 0U;
     haudio->control.len      = 0U;
   }
+#ifdef _USE_HW_CONV
+  else if (haudio->control.cmd == AUDIO_VENDOR_REQ_CONV_TAPS && haudio->control.req_type == USB_REQ_TYPE_VENDOR)
+  {
+    int16_t  taps[USB_MAX_EP0_SIZE / 2];
+    uint32_t index = ((uint32_t)haudio->control.cs << 8) | haudio->control.cn;
+
+    // data[] 는 정렬이 보장되지 않으므로 복사해서 넘긴다.
+    //
+    memcpy(taps, haudio->control.data, haudio->control.len);
+    convLoadTaps(haudio->control.unit, index, taps, haudio->control.len / 2);
+
+    haudio->control.req_type = 0U;
+    haudio->control.cs       = 0U;
+    haudio->control.cn       = 0U;
+    haudio->control.cmd      = 0U;
+    haudio->control.len      = 0U;
+  }
+#endif
 
   return (uint8_t)USBD_OK;
 }
@@ -778,6 +845,8 @@ static uint8_t USBD_AUDIO_SOF(USBD_HandleTypeDef *pdev)
 { 
   if (is_init)
   {
+    AUDIO_RateStatSof();
+
     static uint32_t sof_log_cnt = 0;
     sof_log_cnt++;
     if (sof_log_cnt >= 1000)
@@ -801,7 +870,7 @@ void USBD_AUDIO_INFO(void)
   {
     pre_time = millis();
     AUDIO_Log("%d, ISO_IN %3d ISO_OUT %3d IN %3d OUT %-4d FD %d\n", 
-      rx_rate/4, 
+      rate_stat.rate_hz, 
       data_in_rate[DATA_RATE_ISO_IN_INCOMPLETE],
       data_in_rate[DATA_RATE_ISO_OUT_INCOMPLETE],
       data_in_rate[DATA_RATE_DATA_IN],
@@ -887,7 +956,7 @@ static uint8_t USBD_AUDIO_DataIn(USBD_HandleTypeDef *pdev, uint8_t epnum)
   * @param  epnum: endpoint index
   * @retval status
   */
-static uint8_t USBD_AUDIO_DataOut(USBD_HandleTypeDef *pdev, uint8_t epnum)
+__RAMFUNC static uint8_t USBD_AUDIO_DataOut(USBD_HandleTypeDef *pdev, uint8_t epnum)
 {
   USBD_AUDIO_HandleTypeDef *haudio;
   uint16_t packet_length;
@@ -915,15 +984,9 @@ static uint8_t USBD_AUDIO_DataOut(USBD_HandleTypeDef *pdev, uint8_t epnum)
                             haudio->buffer,
                             packet_length);    
 
-    rx_count += packet_length;
-
-    static uint32_t pre_time;
-    if (millis()-pre_time >= 1000)
-    {
-      pre_time = millis();
-      rx_rate = rx_count;
-      rx_count = 0;
-    }
+    rate_stat.pkt_frames += AUDIO_BYTES_TO_FRAMES(packet_length, haudio->frame_recip);
+    rate_stat.pkt_cnt++;
+    AUDIO_RateStatPacket(cycles());
   }
 
   data_in_count[DATA_RATE_DATA_OUT]++;
@@ -1233,6 +1296,8 @@ static void AUDIO_OUT_Restart(USBD_HandleTypeDef* pdev)
   USBD_LL_FlushEP(pdev, AUDIO_IN_EP);
   USBD_LL_FlushEP(pdev, AUDIO_OUT_EP);
 
+  AUDIO_RateStatClear();
+
   
   ((USBD_AUDIO_ItfTypeDef *)pdev->pUserData[pdev->classId])->Init(haudio->freq, haudio->volume_percent, 1);
   ((USBD_AUDIO_ItfTypeDef *)pdev->pUserData[pdev->classId])->AudioCmd(NULL, 0, AUDIO_CMD_START);
@@ -1269,6 +1334,269 @@ static void AUDIO_OUT_Restart(USBD_HandleTypeDef* pdev)
 }
 
 
+/**
+ * @brief  Clear the SOF synchronous rate statistics
+ */
+static void AUDIO_RateStatClear(void)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  memset(&rate_stat, 0, sizeof(rate_stat));
+  __set_PRIMASK(primask);
+}
+
+/**
+ * @brief  Take a consistent copy of the rate statistics
+ * @param  p_stat: destination
+ */
+static void AUDIO_RateStatGet(audio_rate_stat_t *p_stat)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  memcpy(p_stat, &rate_stat, sizeof(rate_stat));
+  __set_PRIMASK(primask);
+}
+
+/**
+ * @brief  Track the arrival interval of OUT packets
+ * @param  now_cycles: packet arrival time (DWT cycles, no division in ISR)
+ */
+static void AUDIO_RateStatPacket(uint32_t now_cycles)
+{
+  audio_rate_stat_t *p_stat = &rate_stat;
+
+
+  if (p_stat->pkt_cycles != 0)
+  {
+    p_stat->pkt_gap = now_cycles - p_stat->pkt_cycles;
+    if (p_stat->pkt_gap_min == 0 || p_stat->pkt_gap < p_stat->pkt_gap_min)
+    {
+      p_stat->pkt_gap_min = p_stat->pkt_gap;
+    }
+    if (p_stat->pkt_gap > p_stat->pkt_gap_max)
+    {
+      p_stat->pkt_gap_max = p_stat->pkt_gap;
+    }
+  }
+  p_stat->pkt_cycles = now_cycles;
+}
+
+/**
+ * @brief  Account the frames received during the last USB frame.
+ *         Called from SOF, same IRQ as DataOut. No division here.
+ */
+static void AUDIO_RateStatSof(void)
+{
+  audio_rate_stat_t *p_stat = &rate_stat;
+  uint32_t frames = p_stat->pkt_frames;
+
+
+  if (p_stat->pkt_cnt == 0)
+  {
+    p_stat->empty_cnt++;
+  }
+  else if (p_stat->pkt_cnt > 1)
+  {
+    p_stat->multi_cnt++;
+  }
+
+  if (frames >= AUDIO_STAT_HIST_MAX)
+  {
+    frames = AUDIO_STAT_HIST_MAX - 1;
+  }
+  p_stat->hist[frames]++;
+
+  p_stat->sec_frames += p_stat->pkt_frames;
+  p_stat->pkt_frames  = 0;
+  p_stat->pkt_cnt     = 0;
+
+  p_stat->sec_sof++;
+  if (p_stat->sec_sof >= AUDIO_STAT_SOF_PER_SEC)
+  {
+    p_stat->rate_hz       = p_stat->sec_frames;
+    p_stat->total_frames += p_stat->sec_frames;
+    p_stat->total_sof    += p_stat->sec_sof;
+    p_stat->sec_frames    = 0;
+    p_stat->sec_sof       = 0;
+  }
+}
+
+/**
+ * @brief  Long-term host sample rate in mHz
+ * @param  p_stat: rate statistics snapshot
+ * @retval rate in mHz, 0 if less than one second has been measured
+ */
+static uint32_t AUDIO_RateStatGetMilliHz(audio_rate_stat_t *p_stat)
+{
+  if (p_stat->total_sof == 0)
+  {
+    return 0;
+  }
+  return (uint32_t)((p_stat->total_frames * 1000U * AUDIO_STAT_SOF_PER_SEC) / p_stat->total_sof);
+}
+
+/**
+ * @brief  Host rate drift against the DAC output rate
+ * @param  host_mhz: measured host rate in mHz
+ * @retval drift in ppm (positive : host is faster than DAC)
+ */
+static int32_t AUDIO_RateStatGetPpm(uint32_t host_mhz)
+{
+  int64_t dac_mhz;
+
+  dac_mhz = i2sGetSampleRateMilliHz();
+  if (host_mhz == 0 || dac_mhz == 0)
+  {
+    return 0;
+  }
+  return (int32_t)((((int64_t)host_mhz - dac_mhz) * 1000000) / dac_mhz);
+}
+
+/**
+ * @brief  Fill a statistics snapshot
+ * @param  p_stat: destination
+ * @retval status
+ */
+uint8_t USBD_AUDIO_GetStat(USBD_AUDIO_StatTypeDef *p_stat)
+{
+  USBD_AUDIO_HandleTypeDef *haudio;
+  audio_rate_stat_t stat;
+  static uint32_t seq = 0;
+
+  if (p_usb_dev == NULL)
+  {
+    return (uint8_t)USBD_FAIL;
+  }
+  haudio = (USBD_AUDIO_HandleTypeDef *)p_usb_dev->pClassDataCmsit[p_usb_dev->classId];
+  if (haudio == NULL)
+  {
+    return (uint8_t)USBD_FAIL;
+  }
+
+  AUDIO_RateStatGet(&stat);
+
+  p_stat->version            = AUDIO_VENDOR_STAT_VERSION;
+  p_stat->length             = sizeof(USBD_AUDIO_StatTypeDef);
+  p_stat->alt_setting        = (uint8_t)haudio->alt_setting;
+  p_stat->buf_level          = haudio->cur_buf_level;
+  p_stat->seq                = seq++;
+  p_stat->time_ms            = millis();
+  p_stat->freq               = haudio->freq;
+  p_stat->freq_real          = haudio->freq_real;
+  p_stat->host_rate_mhz      = AUDIO_RateStatGetMilliHz(&stat);
+  p_stat->drift_ppm          = AUDIO_RateStatGetPpm(p_stat->host_rate_mhz);
+  p_stat->fb_value           = haudio->fb_target;
+  p_stat->fill_samples       = i2sAvailableForRead(0);
+  p_stat->fill_size          = i2sAvailableForRead(0) + i2sAvailableForWrite(0);
+  p_stat->underrun_cnt       = i2sZeroTotalGet();
+  p_stat->empty_sof_cnt      = stat.empty_cnt;
+  p_stat->isr_cycles         = i2sGetIsrCycles();
+  p_stat->isr_cycles_max     = i2sGetIsrCyclesMax();
+  p_stat->iso_out_incomplete = data_in_rate[DATA_RATE_ISO_OUT_INCOMPLETE];
+
+  return (uint8_t)USBD_OK;
+}
+
+/**
+ * @brief  Vendor requests for statistics readout and IR upload on EP0
+ *         CONV_BEGIN/CONV_TAPS only stage the taps, CONV_TAPS data is
+ *         passed to convLoadTaps() from USBD_AUDIO_EP0_RxReady()
+ *         CONV_END hands the transform to the audio thread
+ * @param  pdev: instance
+ * @param  req: setup request
+ * @retval status
+ */
+static uint8_t AUDIO_VendorRequest(USBD_HandleTypeDef *pdev, USBD_SetupReqTypedef *req)
+{
+  USBD_AUDIO_HandleTypeDef *haudio;
+  uint16_t len;
+
+  switch (req->bRequest)
+  {
+    case AUDIO_VENDOR_REQ_GET_STAT:
+      if ((req->bmRequest & 0x80U) == 0 || req->wLength == 0)
+      {
+        break;
+      }
+
+      // 전송이 끝날때까지 버퍼가 유지되어야 하므로 static 변수에 스냅샷을 만든다.
+      //
+      if (USBD_AUDIO_GetStat(&vendor_stat) != USBD_OK)
+      {
+        break;
+      }
+      len = MIN(sizeof(USBD_AUDIO_StatTypeDef), req->wLength);
+      (void)USBD_CtlSendData(pdev, (uint8_t *)&vendor_stat, len);
+      return (uint8_t)USBD_OK;
+
+    case AUDIO_VENDOR_REQ_CLR_STAT:
+      if ((req->bmRequest & 0x80U) != 0 || req->wLength != 0)
+      {
+        break;
+      }
+      AUDIO_RateStatClear();
+      i2sClearStat();
+      (void)USBD_CtlSendStatus(pdev);
+      return (uint8_t)USBD_OK;
+
+#ifdef _USE_HW_CONV
+    case AUDIO_VENDOR_REQ_CONV_BEGIN:
+      if ((req->bmRequest & 0x80U) != 0 || req->wLength != 0)
+      {
+        break;
+      }
+      if (convLoadBegin(req->wValue, req->wIndex == 1) != true)
+      {
+        break;
+      }
+      (void)USBD_CtlSendStatus(pdev);
+      return (uint8_t)USBD_OK;
+
+    case AUDIO_VENDOR_REQ_CONV_TAPS:
+      if ((req->bmRequest & 0x80U) != 0 || req->wLength == 0 || req->wLength > USB_MAX_EP0_SIZE || (req->wLength & 1U) != 0)
+      {
+        break;
+      }
+
+      // 데이터 단계가 끝나면 USBD_AUDIO_EP0_RxReady() 에서 convLoadTaps() 를 호출한다.
+      //
+      haudio = (USBD_AUDIO_HandleTypeDef *)pdev->pClassDataCmsit[pdev->classId];
+      if (haudio == NULL)
+      {
+        break;
+      }
+      haudio->control.cmd      = AUDIO_VENDOR_REQ_CONV_TAPS;
+      haudio->control.req_type = USB_REQ_TYPE_VENDOR;
+      haudio->control.cs       = HIBYTE(req->wValue);
+      haudio->control.cn       = LOBYTE(req->wValue);
+      haudio->control.unit     = LOBYTE(req->wIndex);
+      haudio->control.len      = (uint8_t)req->wLength;
+      (void)USBD_CtlPrepareRx(pdev, haudio->control.data, req->wLength);
+      return (uint8_t)USBD_OK;
+
+    case AUDIO_VENDOR_REQ_CONV_END:
+      if ((req->bmRequest & 0x80U) != 0 || req->wLength != 0)
+      {
+        break;
+      }
+      if (convLoadEndAsync() != true)
+      {
+        break;
+      }
+      (void)USBD_CtlSendStatus(pdev);
+      return (uint8_t)USBD_OK;
+#endif
+
+    default:
+      break;
+  }
+
+  USBD_CtlError(pdev, req);
+  return (uint8_t)USBD_FAIL;
+}
+
 void cliCmd(cli_args_t *args)
 {
   bool ret = false;
@@ -1295,7 +1623,15 @@ void cliCmd(cli_args_t *args)
         cliPrintf("i2s zero cnt : %d\n", i2sZeroCntGet());
         cliPrintf("vol db       : %d db, 0x%04X\n", vol_db, haudio->volume & 0xFFFF);
         cliPrintf("vol          : %d %%\n", haudio->volume_percent);
-        cliPrintf("real rate    : %d Hz\n", rx_rate/(USBD_AUDIO_BIT_BYTES * 2));
+        audio_rate_stat_t stat;
+        uint32_t host_mhz;
+
+        AUDIO_RateStatGet(&stat);
+        host_mhz = AUDIO_RateStatGetMilliHz(&stat);
+        cliPrintf("real rate    : %d Hz, %d.%03d Hz, %d ppm      \n", 
+          stat.rate_hz, 
+          host_mhz/1000, host_mhz%1000,
+          AUDIO_RateStatGetPpm(host_mhz));
         cliPrintf("EP Info\n");
         cliPrintf("   ISO_IN %3d ISO_OUT %3d IN %3d OUT %-4d FD %d\n", 
           data_in_rate[DATA_RATE_ISO_IN_INCOMPLETE],
@@ -1314,8 +1650,47 @@ void cliCmd(cli_args_t *args)
     ret = true;
   }
 
+  if (args->argc == 1 && args->isStr(0, "rate") == true)
+  {
+    audio_rate_stat_t stat;
+    uint32_t host_mhz;
+    uint32_t dac_mhz;
+    uint32_t cycles_per_us = SystemCoreClock / 1000000;
+
+    AUDIO_RateStatGet(&stat);
+    host_mhz = AUDIO_RateStatGetMilliHz(&stat);
+    dac_mhz  = i2sGetSampleRateMilliHz();
+
+    cliPrintf("host rate    : %d Hz (last 1s)\n", stat.rate_hz);
+    cliPrintf("host rate    : %d.%03d Hz (%d s)\n", host_mhz/1000, host_mhz%1000, stat.total_sof/AUDIO_STAT_SOF_PER_SEC);
+    cliPrintf("dac  rate    : %d.%03d Hz\n", dac_mhz/1000, dac_mhz%1000);
+    cliPrintf("drift        : %d ppm\n", AUDIO_RateStatGetPpm(host_mhz));
+    cliPrintf("empty sof    : %d\n", stat.empty_cnt);
+    cliPrintf("multi pkt    : %d\n", stat.multi_cnt);
+    cliPrintf("pkt interval : %d us (min %d, max %d)\n",
+      stat.pkt_gap / cycles_per_us, stat.pkt_gap_min / cycles_per_us, stat.pkt_gap_max / cycles_per_us);
+    cliPrintf("frames/pkt   :\n");
+    for (int i=0; i<AUDIO_STAT_HIST_MAX; i++)
+    {
+      if (stat.hist[i] > 0)
+      {
+        cliPrintf("   %3d : %d\n", i, stat.hist[i]);
+      }
+    }
+    ret = true;
+  }
+
+  if (args->argc == 1 && args->isStr(0, "clear") == true)
+  {
+    AUDIO_RateStatClear();
+    i2sClearStat();
+    ret = true;
+  }
+
   if (ret == false)
   {
     cliPrintf("usb-audio info\n");
+    cliPrintf("usb-audio rate\n");
+    cliPrintf("usb-audio clear\n");
   }
 }
@@ -46,6 +46,7 @@ extern "C" {
 #define USBD_AUDIO_FREQ                                48000U
 #define USBD_AUDIO_BIT_BYTES                           3
 #define USBD_AUDIO_BIT_LEN                             24
+#define USBD_AUDIO_CHANNELS                            2
 
 
 // See USB Device Class Definition for Audio Devices v1.0 p.77
@@ -166,6 +167,18 @@ extern "C" {
 /* Total size of the audio transfer buffer */
 #define AUDIO_TOTAL_BUF_SIZE                          ((uint16_t)(AUDIO_OUT_PACKET * AUDIO_OUT_PACKET_NUM))
 
+/* Vendor requests (EP0) for pipeline statistics */
+#define AUDIO_VENDOR_REQ_GET_STAT                     0x01U
+#define AUDIO_VENDOR_REQ_CLR_STAT                     0x02U
+/* Vendor requests (EP0) for convolution IR upload, OUT only
+   CONV_BEGIN : wValue = taps per channel, wIndex = 1 stereo / 0 mono, no data
+   CONV_TAPS  : wValue = first tap index, wIndex = channel, data = Q15 taps (LE, max 32 per request)
+   CONV_END   : no data, the IR is transformed in the audio thread */
+#define AUDIO_VENDOR_REQ_CONV_BEGIN                   0x03U
+#define AUDIO_VENDOR_REQ_CONV_TAPS                    0x04U
+#define AUDIO_VENDOR_REQ_CONV_END                     0x05U
+#define AUDIO_VENDOR_STAT_VERSION                     0x01U
+
 /* Audio Commands enumeration */
 typedef enum
 {
@@ -202,6 +215,30 @@ typedef struct
 } USBD_AUDIO_ControlTypeDef;
 
 
+/* Vendor statistics snapshot, little endian, fits in one EP0 packet */
+typedef struct __PACKED
+{
+  uint8_t  version;               /* AUDIO_VENDOR_STAT_VERSION */
+  uint8_t  length;                /* sizeof(USBD_AUDIO_StatTypeDef) */
+  uint8_t  alt_setting;
+  uint8_t  buf_level;             /* feedback buffer level, % */
+  uint32_t seq;                   /* incremented on every snapshot */
+  uint32_t time_ms;
+  uint32_t freq;                  /* requested sample rate, Hz */
+  uint32_t freq_real;             /* DAC sample rate, Hz */
+  uint32_t host_rate_mhz;         /* measured host rate, mHz */
+  int32_t  drift_ppm;             /* host vs DAC */
+  uint32_t fb_value;              /* last feedback value, 10.14 */
+  uint32_t fill_samples;          /* samples queued for I2S */
+  uint32_t fill_size;             /* I2S queue size in samples */
+  uint32_t underrun_cnt;          /* I2S half buffers filled with zero */
+  uint32_t empty_sof_cnt;         /* USB frames without OUT packet */
+  uint32_t isr_cycles;            /* last I2S DMA ISR cycles */
+  uint32_t isr_cycles_max;
+  uint32_t iso_out_incomplete;    /* per second */
+} USBD_AUDIO_StatTypeDef;
+
+
 typedef struct
 {
   uint32_t                  alt_setting;
@@ -214,6 +251,7 @@ typedef struct
   uint32_t                  freq;  
   uint32_t                  freq_real;  
   uint32_t                  bit_depth;
+  uint32_t                  frame_recip;    // 65536 / (bit_depth x channels), 올림
   int16_t                   volume;
   uint8_t                   volume_percent;
   int32_t                   vol_3dB_shift;
@@ -379,6 +417,7 @@ uint8_t USBD_AUDIO_RegisterInterface(USBD_HandleTypeDef *pdev,
                                      USBD_AUDIO_ItfTypeDef *fops);
 
 void USBD_AUDIO_Sync(USBD_HandleTypeDef *pdev, AUDIO_OffsetTypeDef offset);
+uint8_t USBD_AUDIO_GetStat(USBD_AUDIO_StatTypeDef *p_stat);
 
 #ifdef USE_USBD_COMPOSITE
 uint32_t USBD_AUDIO_GetEpPcktSze(USBD_HandleTypeDef *pdev, uint8_t If, uint8_t Ep);
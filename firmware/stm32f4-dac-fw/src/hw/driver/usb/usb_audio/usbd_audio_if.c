@@ -19,10 +19,17 @@
 /* Includes ------------------------------------------------------------------ */
 #include "usbd_audio_if.h"
 #include "i2s.h"
+#include "event.h"
+#include "bootlog.h"
 
 
 /* Private typedef ----------------------------------------------------------- */
 /* Private define ------------------------------------------------------------ */
+#ifdef _USE_HW_RTOS
+#define AUDIO_CTRL_FREQ     (1U << 0)
+#define AUDIO_CTRL_VOLUME   (1U << 1)
+#define AUDIO_CTRL_MUTE     (1U << 2)
+#endif
 /* Private macro ------------------------------------------------------------- */
 /* Private function prototypes ----------------------------------------------- */
 static int8_t Audio_Init(uint32_t AudioFreq, uint32_t Volume, uint32_t options);
@@ -34,6 +41,9 @@ static int8_t Audio_PeriodicTC(uint8_t *pbuf, uint32_t size, uint8_t cmd);
 static int8_t Audio_GetState(void);
 static int8_t Audio_Receive(uint8_t *pbuf, uint32_t size);
 static int8_t Audio_GetBufferLevel(uint8_t *percent);
+#ifdef _USE_HW_RTOS
+static void Audio_CtrlPost(uint32_t req);
+#endif
 
 
 /* Private variables --------------------------------------------------------- */
@@ -55,7 +65,14 @@ volatile static bool is_rx_full = false;
 static uint8_t sai_ch = 0;
 static bool is_init = false;
 static bool is_mute = false;
+static bool is_first_packet = true;
 static void     (*receive_func)(int16_t *p_data, uint32_t samples) = NULL;
+#ifdef _USE_HW_RTOS
+static volatile uint32_t ctrl_req    = 0;   // USB 인터럽트에서 요청된 제어
+static volatile uint32_t ctrl_freq   = 0;
+static volatile uint8_t  ctrl_volume = 0;
+static volatile bool     ctrl_mute   = false;
+#endif
 
 /* Private functions --------------------------------------------------------- */
 
@@ -73,12 +90,23 @@ static int8_t Audio_Init(uint32_t AudioFreq, uint32_t Volume, uint32_t options)
   logPrintf("  Volume    : %d\n", Volume);
   logPrintf("  options   : %d\n", options);
 
+#ifdef _USE_HW_RTOS
+  ctrl_freq = AudioFreq;
+  Audio_CtrlPost(AUDIO_CTRL_FREQ);
+#else
   i2sSetSampleRate(AudioFreq);
+#endif
 
   if (options > 0)
   {
     is_init = true; 
   }
+  #ifdef _USE_HW_BOOTLOG
+  if (bootlogGetCount() < HW_BOOTLOG_MAX && is_first_packet)
+  {
+    bootlogMark("usb audio init");
+  }
+  #endif
   return 0;
 }
 
@@ -122,12 +150,26 @@ static int8_t Audio_PlaybackCmd(uint8_t * pbuf, uint32_t size, uint8_t cmd)
   switch (cmd)
   {
     case AUDIO_CMD_START:
+      i2sSetStream(true);
       if (is_mute == false)
+      {
+#ifdef _USE_HW_RTOS
+        ctrl_mute = false;
+        Audio_CtrlPost(AUDIO_CTRL_MUTE);
+#else
         i2sMute(false);
+#endif
+      }
       break;
 
     case AUDIO_CMD_STOP:
+      i2sSetStream(false);
+#ifdef _USE_HW_RTOS
+      ctrl_mute = true;
+      Audio_CtrlPost(AUDIO_CTRL_MUTE);
+#else
       i2sMute(true);
+#endif
       break;
 
     default:
@@ -147,8 +189,13 @@ static int8_t Audio_VolumeCtl(uint8_t vol)
   // logPrintf("Audio_VolumeCtl()\n");
   // logPrintf("  vol : %d\n", vol);
 
+#ifdef _USE_HW_RTOS
+  ctrl_volume = vol;
+  Audio_CtrlPost(AUDIO_CTRL_VOLUME);
+#else
   i2sSetVolume(vol);
-  
+#endif
+
   return 0;
 }
 
@@ -162,12 +209,54 @@ static int8_t Audio_MuteCtl(uint8_t cmd)
   // logPrintf("Audio_MuteCtl()\n");
   // logPrintf("  cmd : %d\n", cmd);
 
+#ifdef _USE_HW_RTOS
+  ctrl_mute = cmd;
+  Audio_CtrlPost(AUDIO_CTRL_MUTE);
+#else
   i2sMute(cmd);
+#endif
   is_mute = cmd;
 
   return 0;
 }
 
+#ifdef _USE_HW_RTOS
+/**
+  * @brief  Hand a control request over to the audio control task.
+  *         I2C access to the codec is not allowed in the USB interrupt.
+  * @param  req: AUDIO_CTRL_xxx bits
+  */
+static void Audio_CtrlPost(uint32_t req)
+{
+  __atomic_fetch_or(&ctrl_req, req, __ATOMIC_RELEASE);
+  eventPost(EVENT_AUDIO_CTRL);
+}
+
+/**
+  * @brief  Apply the pending control requests. Called from the audio control task.
+  *         Only the latest value of each request is applied.
+  */
+void Audio_CtrlUpdate(void)
+{
+  uint32_t req;
+
+  req = __atomic_exchange_n(&ctrl_req, 0, __ATOMIC_ACQUIRE);
+
+  if (req & AUDIO_CTRL_FREQ)
+  {
+    i2sSetSampleRate(ctrl_freq);
+  }
+  if (req & AUDIO_CTRL_VOLUME)
+  {
+    i2sSetVolume(ctrl_volume);
+  }
+  if (req & AUDIO_CTRL_MUTE)
+  {
+    i2sMute(ctrl_mute);
+  }
+}
+#endif
+
 /**
   * @brief  Audio_PeriodicTC
   * @param  cmd: Command opcode
@@ -196,6 +285,13 @@ int8_t Audio_Receive(uint8_t *pbuf, uint32_t size)
 {
   i2sWriteBytes(sai_ch, pbuf, size);
 
+  #ifdef _USE_HW_BOOTLOG
+  if (is_first_packet)
+  {
+    is_first_packet = false;
+    bootlogMark("usb audio first packet");
+  }
+  #endif
 
   if (receive_func != NULL)
   {
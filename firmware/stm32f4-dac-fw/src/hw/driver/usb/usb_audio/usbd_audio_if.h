@@ -32,6 +32,9 @@ extern USBD_AUDIO_ItfTypeDef  USBD_AUDIO_fops;
 
 bool Audio_IsInit(void);
 void Audio_SetReceiveFunc(void (*func)(int16_t *p_data, uint32_t samples));
+#ifdef _USE_HW_RTOS
+void Audio_CtrlUpdate(void);
+#endif
 
 #endif /* __USBD_AUDIO_IF_H */
 
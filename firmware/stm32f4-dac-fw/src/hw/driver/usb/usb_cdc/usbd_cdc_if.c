@@ -151,6 +151,13 @@ uint32_t cdcIfWrite(uint8_t *p_data, uint32_t length)
   return sent_len;
 }
 
+uint32_t cdcIfAvailableForWrite(void)
+{
+  if (cdcIfIsConnected() != true) return 0;
+
+  return (q_tx.len - qbufferAvailable(&q_tx)) - 1;
+}
+
 uint32_t cdcIfGetBaud(void)
 {
   return LineCoding.bitrate;
@@ -113,6 +113,7 @@ uint32_t cdcIfAvailable(void);
 uint8_t  cdcIfRead(void);
 uint32_t cdcIfGetBaud(void);
 uint32_t cdcIfWrite(uint8_t *p_data, uint32_t length);
+uint32_t cdcIfAvailableForWrite(void);
 bool     cdcIfIsConnected(void);
 uint8_t  cdcIfGetType(void);
 
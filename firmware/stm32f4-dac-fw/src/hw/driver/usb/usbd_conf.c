@@ -93,6 +93,14 @@ void HAL_PCD_MspInit(PCD_HandleTypeDef* pcdHandle)
     /* Peripheral interrupt init */
     HAL_NVIC_SetPriority(OTG_FS_IRQn, 6, 0);
     HAL_NVIC_EnableIRQ(OTG_FS_IRQn);
+
+    // STOP 모드에서 resume 신호로 깨어나기 위한 EXTI 18
+    //
+    __HAL_USB_OTG_FS_WAKEUP_EXTI_CLEAR_FLAG();
+    __HAL_USB_OTG_FS_WAKEUP_EXTI_ENABLE_RISING_EDGE();
+    __HAL_USB_OTG_FS_WAKEUP_EXTI_ENABLE_IT();
+    HAL_NVIC_SetPriority(OTG_FS_WKUP_IRQn, 6, 0);
+    HAL_NVIC_EnableIRQ(OTG_FS_WKUP_IRQn);
   }
 }
 
@@ -111,6 +119,8 @@ void HAL_PCD_MspDeInit(PCD_HandleTypeDef* pcdHandle)
 
     /* Peripheral interrupt Deinit*/
     HAL_NVIC_DisableIRQ(OTG_FS_IRQn);
+    HAL_NVIC_DisableIRQ(OTG_FS_WKUP_IRQn);
+    __HAL_USB_OTG_FS_WAKEUP_EXTI_DISABLE_IT();
   }
 }
 
@@ -126,6 +136,9 @@ void HAL_PCD_SetupStageCallback(PCD_HandleTypeDef *hpcd)
 #endif /* USE_HAL_PCD_REGISTER_CALLBACKS */
 {
   USBD_LL_SetupStage((USBD_HandleTypeDef*)hpcd->pData, (uint8_t *)hpcd->Setup);
+#ifdef _USE_HW_EVENT
+  eventPost(EVENT_USB_CTRL);
+#endif
 }
 
 /**
@@ -202,6 +215,10 @@ void HAL_PCD_ResetCallback(PCD_HandleTypeDef *hpcd)
 
   /* Reset Device. */
   USBD_LL_Reset((USBD_HandleTypeDef*)hpcd->pData);
+
+  // suspend 중 resume 없이 버스 리셋이 올 수도 있다.
+  //
+  usbResumeCallback();
 }
 
 /**
@@ -228,6 +245,7 @@ void HAL_PCD_SuspendCallback(PCD_HandleTypeDef *hpcd)
   }
 
   is_connected = false;
+  usbSuspendCallback();
 
   /* USER CODE END 2 */
 }
@@ -245,7 +263,7 @@ void HAL_PCD_ResumeCallback(PCD_HandleTypeDef *hpcd)
 #endif /* USE_HAL_PCD_REGISTER_CALLBACKS */
 {
   /* USER CODE BEGIN 3 */
-
+  usbResumeCallback();
   /* USER CODE END 3 */
   USBD_LL_Resume((USBD_HandleTypeDef*)hpcd->pData);
 }
@@ -8,37 +8,66 @@
 bool hwInit(void)
 {  
   bspInit();
+  bootlogMark("bspInit");
 
   cliInit();
   logInit();
   uartInit();
   for (int i=0; i<HW_UART_MAX_CH; i++)
   {
-    uartOpen(i, 115200);
+    uartOpen(i, HW_UART_BAUD);
   }  
 
-  logOpen(HW_LOG_CH, 115200);
+  logOpen(HW_LOG_CH, HW_UART_BAUD);
   logPrintf("\r\n[ Firmware Begin... ]\r\n");
   logPrintf("Booting..Name \t\t: %s\r\n", _DEF_BOARD_NAME);
   logPrintf("Booting..Ver  \t\t: %s\r\n", _DEF_FIRMWATRE_VERSION);  
   logPrintf("Booting..Clock\t\t: %d Mhz\r\n", (int)HAL_RCC_GetSysClockFreq()/1000000);
   logPrintf("\n");
+  bootlogInit();
+  bootlogMark("logInit");
   
   rtcInit();
   resetInit();
   faultInit();
   assertInit();
+  eventInit();
+  perfInit();
+#ifdef _USE_HW_RTOS
+  rtosInit();
+#endif
+  bootlogMark("core");
 
   swtimerInit();    
   ledInit();
-  i2cInit();
-  eepromInit();
-  buttonInit();
-  es8156Init();
   i2sInit();
-  
+  ditherInit();
+  genInit();
+  bootlogMark("i2sInit");
+
+  // USB를 먼저 시작하여 나머지 초기화 중에도 enumeration이 진행되도록 한다.
+  //
   usbInit();
   usbBegin(USB_AUDIO_MODE);
+  bootlogMark("usbBegin");
+
+  i2cInit();
+  eepromInit();
+  bootlogMark("eepromInit");
+  buttonInit();
+  es8156Init();                 // 코덱 파워업은 es8156Update()에서 진행
+  bootlogMark("es8156Init");
+
+  meterInit();                  // 처리 전 입력을 보도록 첫 스테이지로 등록한다. (기본 꺼짐)
+  crossfeedInit();              // EEPROM 설정을 읽으므로 eepromInit() 이후
+  convInit();
+  loudnessInit();               // 볼륨 단계를 읽으므로 i2sInit() 이후, limiter 앞
+  limiterInit();                // 스테이지 중 마지막에 등록한다.
+  governorInit();
+  bootlogMark("dsp");
+
+  telemetryInit();
+  bootlogMark("hwInit done");
 
   return true;
-}
\ No newline at end of file
+}
@@ -22,8 +22,23 @@ extern "C" {
 #include "button.h"
 #include "es8156.h"
 #include "i2s.h"
+#include "mixer.h"
 #include "usb.h"
 #include "cdc.h"
+#include "telemetry.h"
+#include "event.h"
+#include "rtos.h"
+#include "bootlog.h"
+#include "perf.h"
+#include "dither.h"
+#include "limiter.h"
+#include "crossfeed.h"
+#include "conv.h"
+#include "meter.h"
+#include "gen.h"
+#include "governor.h"
+#include "loudness.h"
+#include "resample.h"
 
 bool hwInit(void);
 
@@ -11,8 +11,51 @@
 
 
 #define _USE_HW_FAULT
+#define _USE_HW_BOOTLOG
+#define      HW_BOOTLOG_MAX         24
+#define _USE_HW_PERF
+#ifdef _USE_HW_RTOS                   // cmake -DUSE_RTOS=ON
+#define      HW_RTOS_TASK_MAX       8
+#endif
+#define _USE_HW_EVENT
 #define _USE_HW_I2S
+#define      HW_I2S_STAGE_MAX       8
+#define      HW_I2S_PROC_IRQn       SPI4_IRQn         // 사용하지 않는 인터럽트를 처리용 소프트웨어 인터럽트로 사용
+#define      HW_I2S_PROC_IRQHandler SPI4_IRQHandler
+#define      HW_I2S_PROC_PRIORITY   7                 // USB(6) 보다 낮게
+#define      HW_I2S_IDLE_MS         1000              // 무음 + alt 0 유지시 저전력 진입
+#define      HW_I2S_RAMP_MS         10                // 복귀시 unmute 램프
+#define      HW_I2S_FIXED_OUT       0                 // 1 : 44.1k/48k 스트림도 96kHz 로 업샘플링해서 출력
+#define _USE_HW_MIXER
+#define      HW_MIXER_MAX_CH        2                 // USB 스트림 외의 채널 (i2s ch 1 ~ 2)
+#define      HW_MIXER_MAX_BUF_LEN   1024              // 16비트 스테레오 샘플, 채널당 2KB
+#define      HW_MIXER_MAX_SRC       1                 // 처리 인터럽트에서 샘플을 만드는 채널 (신호 발생기)
+#define _USE_HW_METER
+#define      HW_METER_WINDOW_MS     300               // peak/RMS 측정 구간 기본값
+#define      HW_METER_FFT_LEN       256
+#define      HW_METER_FFT_MS        100               // 스펙트럼 갱신 주기
+#define      HW_METER_BAND_MAX      16
+#define _USE_HW_GEN
+#define      HW_GEN_TONE_MAX        4                 // multi-tone 최대 톤 수
+#define      HW_GEN_MELODY_MAX      16                // genMelody() 최대 음표 수
+#define _USE_HW_GOVERNOR
+#define      HW_GOVERNOR_LOAD_HIGH  800               // 블록 처리 부하 1/1000, 넘으면 단계 적용 (여유 20%)
+#define      HW_GOVERNOR_LOAD_LOW   600               // 복귀 후 예상 부하가 이 값 아래일 때만 복귀
+#define      HW_GOVERNOR_SETTLE_MS  20                // 전환 후 부하 측정까지 대기
+#define      HW_GOVERNOR_RESTORE_MS 3000              // LOW 아래로 유지되어야 하는 시간
+#define _USE_HW_RESAMPLE
+#define      HW_RESAMPLE_OUT_RATE   96000
 #define _USE_HW_ES8156
+#define _USE_HW_DITHER
+#define      HW_DITHER_BITS         24                // ES8156 입력 비트
+#define _USE_HW_LIMITER
+#define      HW_LIMITER_LOOKAHEAD_MS  2
+#define _USE_HW_CROSSFEED
+#define _USE_HW_CONV
+#define      HW_CONV_PART_LEN       128               // 파티션 길이 (FFT 256)
+#define      HW_CONV_PART_MAX       4                 // 채널당 최대 탭 = 128 x 4, RAM 제한
+#define      HW_CONV_LOAD_PCT       50                // 최대 탭 계산시 사용 가능한 CPU 비율
+#define _USE_HW_LOUDNESS
 
 
 #define _USE_HW_LED                 
@@ -22,11 +65,13 @@
 #define      HW_UART_MAX_CH         2
 #define      HW_UART_CH_SWD         _DEF_UART1
 #define      HW_UART_CH_USB         _DEF_UART2
+#define      HW_UART_BAUD           115200    // 921600 까지 사용 가능
 
 #define _USE_HW_LOG
 #define      HW_LOG_CH              _DEF_UART1
 #define      HW_LOG_BOOT_BUF_MAX    2048
 #define      HW_LOG_LIST_BUF_MAX    4096
+#define      HW_LOG_RING_BUF_MAX    2048
 
 #define _USE_HW_CLI
 #define      HW_CLI_CMD_LIST_MAX    32
@@ -53,12 +98,20 @@
 
 #define _USE_HW_EEPROM
 #define      HW_EEPROM_MAX_SIZE     (512)
+#define      HW_EEPROM_REQ_MAX      8         // eepromWriteAsync() 요청 큐
+#define      HW_EEPROM_ADDR_CROSSFEED   0x0010    // magic, preset
+#define      HW_EEPROM_ADDR_LOUDNESS    0x0012    // magic, enable
+#define      HW_EEPROM_ADDR_CONV        0x0040    // magic, flag, len, Q15 taps (~0x01FF)
+
+#define _USE_HW_TELEMETRY
+#define      HW_TELEMETRY_CH        _DEF_UART1
 
 #define _USE_HW_USB
 #define _USE_HW_CDC
 #define      HW_USE_CDC             0
 #define      HW_USE_MSC             0
 #define      HW_USE_AUDIO           1
+#define      HW_USB_SUSPEND_STOP    1                 // suspend 중 STOP 모드 (디버거 연결 끊김)
 
 
 //-- CLI
@@ -71,5 +124,19 @@
 #define _USE_CLI_HW_USB             1
 #define _USE_CLI_HW_I2C             1
 #define _USE_CLI_HW_EEPROM          1
+#define _USE_CLI_HW_TELEMETRY       1
+#define _USE_CLI_HW_EVENT           1
+#define _USE_CLI_HW_SWTIMER         1
+#define _USE_CLI_HW_RTOS            1
+#define _USE_CLI_HW_BOOTLOG         1
+#define _USE_CLI_HW_PERF            1
+#define _USE_CLI_HW_DITHER          1
+#define _USE_CLI_HW_LIMITER         1
+#define _USE_CLI_HW_CROSSFEED       1
+#define _USE_CLI_HW_CONV            1
+#define _USE_CLI_HW_METER           1
+#define _USE_CLI_HW_GEN             1
+#define _USE_CLI_HW_GOVERNOR        1
+#define _USE_CLI_HW_LOUDNESS        1
 
 #endif
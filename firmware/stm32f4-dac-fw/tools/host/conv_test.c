@@ -0,0 +1,233 @@
+// conv.c 호스트 테스트
+//
+//   파티션 overlap-save 결과를 직접 컨볼루션(double)과 비교한다.
+//   출력은 파티션 하나(HW_CONV_PART_LEN 프레임) 늦게 나오므로 그만큼 밀어서 비교한다.
+//   DMA 블록은 2의 거듭제곱이 아닌 176/192 프레임으로 넣는다.
+//   탭 업로드는 USB vendor 요청과 같은 순서(32 탭씩, convLoadEndAsync)로 한다.
+//
+#include <stdio.h>
+
+#include "conv.c"
+#include "host_stub.h"
+#include "host_dsp.h"
+
+
+#define TEST_RATE       48000
+#define TEST_LEN        (CONV_TAP_MAX * 6)
+#define TEST_AMP        0.25
+#define TEST_CHUNK      32              // USB EP0 64 바이트 = Q15 32 탭
+
+
+static uint32_t event_cnt = 0;
+
+void     eventPost(EventId_t id) { event_cnt++; }
+
+bool     i2sStageAdd(const char *name, I2sStageFunc_t func, void *arg) { return true; }
+bool     i2sStageEnable(const char *name, bool enable)                 { return true; }
+uint32_t i2sGetSampleRate(void)                                        { return TEST_RATE; }
+
+
+arm_status arm_rfft_fast_init_f32(arm_rfft_fast_instance_f32 *S, uint16_t fftLen)
+{
+  S->fftLenRFFT = fftLen;
+  return ARM_MATH_SUCCESS;
+}
+
+void arm_rfft_fast_f32(arm_rfft_fast_instance_f32 *S, float32_t *p, float32_t *pOut, uint8_t ifftFlag)
+{
+  uint32_t n = S->fftLenRFFT;
+  double complex x[n];
+
+
+  if (ifftFlag == 0)
+  {
+    for (uint32_t i=0; i<n; i++)
+    {
+      x[i] = p[i];
+    }
+    hostFft(x, n);
+    pOut[0] = creal(x[0]);
+    pOut[1] = creal(x[n/2]);
+    for (uint32_t k=1; k<n/2; k++)
+    {
+      pOut[k*2 + 0] = creal(x[k]);
+      pOut[k*2 + 1] = cimag(x[k]);
+    }
+  }
+  else
+  {
+    // conj(FFT(conj(X))) / N
+    //
+    x[0]   = p[0];
+    x[n/2] = p[1];
+    for (uint32_t k=1; k<n/2; k++)
+    {
+      x[k]     = p[k*2 + 0] - I * p[k*2 + 1];
+      x[n - k] = p[k*2 + 0] + I * p[k*2 + 1];
+    }
+    hostFft(x, n);
+    for (uint32_t i=0; i<n; i++)
+    {
+      pOut[i] = creal(x[i]) / n;
+    }
+  }
+}
+
+
+static int16_t ir[2][CONV_TAP_MAX];
+static double  in[2][TEST_LEN];
+static int32_t buf[TEST_LEN * 2];
+
+
+static void load(uint32_t taps, bool stereo)
+{
+  convLoadBegin(taps, stereo);
+  for (int ch=0; ch<(stereo ? 2:1); ch++)
+  {
+    for (uint32_t i=0; i<taps; i+=TEST_CHUNK)
+    {
+      convLoadTaps(ch, i, &ir[ch][i], cmin(TEST_CHUNK, taps - i));
+    }
+  }
+  convLoadEndAsync();
+  convUpdate();
+}
+
+// 직접 컨볼루션과의 최대 오차 (dB, 입력 최대값 기준)
+//
+static double run(uint32_t taps, bool stereo, uint32_t taps_use)
+{
+  uint32_t pos = 0;
+  double   err_max = 0.0;
+
+
+  for (uint32_t i=0; i<TEST_LEN; i++)
+  {
+    buf[i*2 + 0] = (int32_t)(in[0][i] * 2147483647.0);
+    buf[i*2 + 1] = (int32_t)(in[1][i] * 2147483647.0);
+  }
+
+  convSetEnable(true);
+  while (pos < TEST_LEN)
+  {
+    uint32_t frames = cmin((pos / 176) % 2 ? 192 : 176, TEST_LEN - pos);
+
+    convProcess(&buf[pos*2], frames, NULL);
+    pos += frames;
+  }
+  convSetEnable(false);
+
+  for (int ch=0; ch<2; ch++)
+  {
+    const int16_t *p_h = ir[stereo ? ch : 0];
+
+    for (uint32_t i=CONV_PART_LEN; i<TEST_LEN; i++)
+    {
+      double ref = 0.0;
+      double out = buf[i*2 + ch] / 2147483648.0;
+      uint32_t n = i - CONV_PART_LEN;
+
+      for (uint32_t k=0; k<taps_use && k<=n; k++)
+      {
+        ref += in[ch][n - k] * (p_h[k] / 32768.0);
+      }
+      err_max = cmax(err_max, fabs(out - ref));
+    }
+  }
+  return hostDb(err_max / TEST_AMP);
+}
+
+static bool check(const char *name, bool pass)
+{
+  printf("  %-54s %s\n", name, pass ? "OK":"FAIL");
+  return pass;
+}
+
+int main(void)
+{
+  const uint32_t taps_tbl[] = {1, 100, CONV_PART_LEN, CONV_PART_LEN + 1, 300, CONV_TAP_MAX};
+  bool ret = true;
+  char name[80];
+  double err;
+
+
+  srand(1);
+  for (uint32_t i=0; i<TEST_LEN; i++)
+  {
+    in[0][i] = TEST_AMP * (2.0 * rand() / RAND_MAX - 1.0);
+    in[1][i] = TEST_AMP * (2.0 * rand() / RAND_MAX - 1.0);
+  }
+
+  convInit();
+  printf("taps  mode     max error (dB re input peak)\n");
+  for (uint32_t t=0; t<sizeof(taps_tbl)/sizeof(taps_tbl[0]); t++)
+  {
+    uint32_t taps = taps_tbl[t];
+
+    for (int s=0; s<2; s++)
+    {
+      // 출력이 넘치지 않게 탭 수에 맞춰 줄인 난수 IR
+      //
+      for (int ch=0; ch<2; ch++)
+      {
+        for (uint32_t i=0; i<taps; i++)
+        {
+          ir[ch][i] = (int16_t)((2.0 * rand() / RAND_MAX - 1.0) * 32767.0 / sqrt(taps));
+        }
+      }
+      load(taps, s == 1);
+      err = run(taps, s == 1, taps);
+      printf("%4d  %-6s  %7.1f\n", taps, s ? "stereo":"mono", err);
+
+      snprintf(name, sizeof(name), "%d taps %s : partitioned = direct, < -100 dB", taps, s ? "stereo":"mono");
+      ret &= check(name, err < -100.0);
+    }
+  }
+  ret &= check("no clip", conv_stat.clip_cnt == 0);
+  ret &= check("convLoadEndAsync posts EVENT_AUDIO_CTRL", event_cnt > 0);
+
+  // 부하가 높을 때는 IR 뒷부분 파티션을 생략한다.
+  //
+  convSetPartLimit(2);
+  load(CONV_TAP_MAX, true);
+  err = run(CONV_TAP_MAX, true, CONV_PART_LEN * 2);
+  convSetPartLimit(0);
+  printf("limit 2 part : %.1f dB\n", err);
+  ret &= check("part limit 2 = direct with first 256 taps", err < -100.0);
+
+  // 단위 임펄스는 파티션 하나 늦은 바이패스
+  //
+  ir[0][0] = 32767;
+  ret &= check("convLoadDelta", convLoadDelta() == true && convGetTaps() == 1);
+  err = run(1, false, 1);
+  printf("delta        : %.1f dB\n", err);
+  ret &= check("delta = input delayed by one partition", err < -80.0);
+
+  // USB 인터럽트의 begin/taps 는 적용 중인 IR 을 건드리지 않고, end 요청 후 taps 는 거부한다.
+  //
+  {
+    int16_t taps[TEST_CHUNK];
+    bool    pass;
+
+    for (int i=0; i<TEST_CHUNK; i++)
+    {
+      taps[i] = 16384;
+    }
+    pass  = convLoadBegin(CONV_TAP_MAX, true) == true;
+    pass &= convLoadTaps(0, 0, taps, TEST_CHUNK) == true;
+    pass &= convLoadTaps(1, 0, taps, TEST_CHUNK) == true;
+    err = run(1, false, 1);
+    printf("while loading: %.1f dB\n", err);
+    pass &= err < -80.0;
+
+    pass &= convLoadEndAsync() == true;
+    pass &= convLoadTaps(0, TEST_CHUNK, taps, TEST_CHUNK) != true;
+    pass &= convLoadBegin(1, false) != true;
+    convUpdate();
+    pass &= convGetTaps() == CONV_TAP_MAX && conv_ir[1][0][0] != 0.0f;
+    ret &= check("begin/taps keep the active IR, taps after end rejected", pass);
+  }
+
+  printf("%s\n", ret ? "PASS":"FAIL");
+  return ret ? 0:1;
+}
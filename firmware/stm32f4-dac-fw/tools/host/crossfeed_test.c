@@ -0,0 +1,119 @@
+// crossfeed.c 호스트 테스트
+//
+//   왼쪽에만 임펄스를 넣고 같은 채널(L->L)과 반대 채널(L->R) 응답을 FFT 로 구한다.
+//   ILD : 저역에서 프리셋 레벨 차이(4.5/6.0/9.5 dB), 고역으로 갈수록 커진다.
+//   ITD : 저역 군지연 차이, bs2b 는 약 0.2 ~ 0.4 ms
+//   모노(L=R) 저역 이득은 gain 정규화로 0 dB 이어야 한다.
+//
+#include <stdio.h>
+
+#include "crossfeed.c"
+#include "host_stub.h"
+#include "host_dsp.h"
+
+
+#define TEST_RATE       48000
+#define TEST_LEN        8192
+#define TEST_BLOCK      192
+#define TEST_AMP        0.25
+
+
+bool     i2sStageAdd(const char *name, I2sStageFunc_t func, void *arg) { return true; }
+bool     i2sStageEnable(const char *name, bool enable)                 { return true; }
+uint32_t i2sGetSampleRate(void)                                        { return TEST_RATE; }
+
+
+static void response(double in_l, double in_r, double complex *p_l, double complex *p_r)
+{
+  static int32_t buf[TEST_LEN * 2];
+
+  memset(buf, 0, sizeof(buf));
+  buf[0] = (int32_t)(in_l * TEST_AMP * 2147483647.0);
+  buf[1] = (int32_t)(in_r * TEST_AMP * 2147483647.0);
+
+  // 프리셋을 다시 골라서 상태를 초기화한다.
+  //
+  crossfeed_coef = NULL;
+  for (uint32_t i=0; i<TEST_LEN; i+=TEST_BLOCK)
+  {
+    crossfeedProcess(&buf[i*2], TEST_BLOCK, NULL);
+  }
+  for (uint32_t i=0; i<TEST_LEN; i++)
+  {
+    p_l[i] = buf[i*2 + 0] / (TEST_AMP * 2147483647.0);
+    p_r[i] = buf[i*2 + 1] / (TEST_AMP * 2147483647.0);
+  }
+  hostFft(p_l, TEST_LEN);
+  hostFft(p_r, TEST_LEN);
+}
+
+static double levelDb(const double complex *p_h, double f)
+{
+  return hostDb(cabs(p_h[(uint32_t)(f * TEST_LEN / TEST_RATE + 0.5)]));
+}
+
+// 위상 기울기로 구한 군지연 (us)
+//
+static double delayUs(const double complex *p_h, double f)
+{
+  uint32_t k = (uint32_t)(f * TEST_LEN / TEST_RATE + 0.5);
+  double   d = carg(p_h[k + 1] / p_h[k - 1]);
+
+  return -d / (2.0 * 2.0 * M_PI / TEST_LEN) / TEST_RATE * 1e6;
+}
+
+static bool check(const char *name, bool pass)
+{
+  printf("  %-54s %s\n", name, pass ? "OK":"FAIL");
+  return pass;
+}
+
+int main(void)
+{
+  static double complex h_ll[TEST_LEN];
+  static double complex h_lr[TEST_LEN];
+  static double complex h_ml[TEST_LEN];
+  static double complex h_mr[TEST_LEN];
+  bool ret = true;
+  char name[80];
+
+
+  crossfeedInit();
+
+  printf("preset  ILD 100Hz  ILD 1kHz  ILD 5kHz  ILD 10kHz  ITD 100Hz  mono 100Hz  mono 10kHz\n");
+  for (int p=CROSSFEED_LOW; p<CROSSFEED_MAX; p++)
+  {
+    const crossfeed_preset_t *p_preset = &crossfeed_preset_tbl[p];
+    double ild[4];
+    double itd;
+    double mono_lo;
+    double mono_hi;
+
+    crossfeedSetPreset(p, false);
+    response(1.0, 0.0, h_ll, h_lr);
+    response(1.0, 1.0, h_ml, h_mr);
+
+    ild[0]  = levelDb(h_ll, 100)   - levelDb(h_lr, 100);
+    ild[1]  = levelDb(h_ll, 1000)  - levelDb(h_lr, 1000);
+    ild[2]  = levelDb(h_ll, 5000)  - levelDb(h_lr, 5000);
+    ild[3]  = levelDb(h_ll, 10000) - levelDb(h_lr, 10000);
+    itd     = delayUs(h_lr, 100) - delayUs(h_ll, 100);
+    mono_lo = levelDb(h_ml, 100);
+    mono_hi = levelDb(h_ml, 10000);
+
+    printf("%-6s  %9.2f  %8.2f  %8.2f  %9.2f  %6.0f us  %7.2f dB  %7.2f dB\n",
+      p_preset->name, ild[0], ild[1], ild[2], ild[3], itd, mono_lo, mono_hi);
+
+    snprintf(name, sizeof(name), "%s : ILD 100Hz = %.1f dB +-0.3", p_preset->name, p_preset->level_db);
+    ret &= check(name, fabs(ild[0] - p_preset->level_db) < 0.3);
+    snprintf(name, sizeof(name), "%s : ILD rises with frequency, 10kHz > 100Hz + 10 dB", p_preset->name);
+    ret &= check(name, ild[1] > ild[0] && ild[2] > ild[1] && ild[3] > ild[0] + 10.0);
+    snprintf(name, sizeof(name), "%s : ITD 100Hz 150 ~ 450 us", p_preset->name);
+    ret &= check(name, itd > 150.0 && itd < 450.0);
+    snprintf(name, sizeof(name), "%s : mono 100Hz 0 dB +-0.2", p_preset->name);
+    ret &= check(name, fabs(mono_lo) < 0.2);
+  }
+
+  printf("crossfeed  : %s\n", ret ? "OK":"FAIL");
+  return ret ? 0:1;
+}
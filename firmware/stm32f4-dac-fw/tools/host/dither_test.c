@@ -0,0 +1,123 @@
+// dither.c 호스트 테스트
+//
+//   -70 dBFS 사인을 16비트로 양자화하고 오차(출력 - 입력)의 스펙트럼을 모드별로 비교한다.
+//   off    : 오차가 신호와 상관되어 고조파 스퍼가 생긴다.
+//   tpdf   : 평탄한 잡음, RMS 약 0.5 LSB (반올림 1/sqrt(12) LSB + TPDF)
+//   shape1 : (1 - z^-1) 로 저역 잡음이 줄고 고역이 늘어난다.
+//   shape2 : (1 - z^-1)^2 로 저역이 더 줄어든다.
+//
+#include <stdio.h>
+
+#include "dither.c"
+#include "host_stub.h"
+#include "host_dsp.h"
+
+
+#define TEST_RATE       48000.0
+#define TEST_LEN        (1 << 17)
+#define TEST_SEG        4096
+#define TEST_BLOCK      192
+#define TEST_BITS       16
+
+
+typedef struct
+{
+  double rms_lsb;
+  double low_db;                      // 20 ~ 2000 Hz
+  double high_db;                     // 16k ~ 20k Hz
+  double spur_db;                     // 20 ~ 20k Hz 에서 최대 bin / 중간값
+} result_t;
+
+
+bool i2sStageSetQuantizer(const char *name, I2sStageFunc_t func, void *arg) { return true; }
+
+
+static int cmpDouble(const void *a, const void *b)
+{
+  double d = *(const double *)a - *(const double *)b;
+  return d < 0 ? -1 : (d > 0 ? 1 : 0);
+}
+
+static result_t runMode(DitherMode_t mode)
+{
+  static int32_t buf[TEST_LEN * 2];
+  static int32_t in[TEST_LEN];
+  static double  err[TEST_LEN];
+  static double  psd[TEST_SEG / 2 + 1];
+  static double  sorted[TEST_SEG / 2 + 1];
+  double lsb = (double)(1UL << (32 - TEST_BITS));
+  double amp = 2147483647.0 * pow(10.0, -70.0 / 20.0);
+  double sum = 0.0;
+  uint32_t k_lo;
+  uint32_t k_hi;
+  result_t ret;
+
+
+  ditherSetBits(TEST_BITS);
+  ditherSetMode(mode);
+
+  for (uint32_t i=0; i<TEST_LEN; i++)
+  {
+    in[i] = (int32_t)(amp * sin(2.0 * M_PI * 997.0 * i / TEST_RATE));
+    buf[i*2 + 0] = in[i];
+    buf[i*2 + 1] = in[i];
+  }
+  for (uint32_t i=0; i<TEST_LEN; i+=TEST_BLOCK)
+  {
+    ditherProcess(&buf[i*2], TEST_BLOCK, NULL);
+  }
+  for (uint32_t i=0; i<TEST_LEN; i++)
+  {
+    err[i] = ((double)buf[i*2] - (double)in[i]) / lsb;
+    sum   += err[i] * err[i];
+  }
+
+  hostPsd(err, TEST_LEN, TEST_SEG, psd);
+
+  k_lo = (uint32_t)(20.0 * TEST_SEG / TEST_RATE);
+  k_hi = (uint32_t)(20000.0 * TEST_SEG / TEST_RATE);
+  for (uint32_t k=k_lo; k<=k_hi; k++)
+  {
+    sorted[k - k_lo] = psd[k];
+  }
+  qsort(sorted, k_hi - k_lo + 1, sizeof(double), cmpDouble);
+
+  ret.rms_lsb = sqrt(sum / TEST_LEN);
+  ret.low_db  = hostBandDb(psd, TEST_SEG, TEST_RATE, 20.0, 2000.0);
+  ret.high_db = hostBandDb(psd, TEST_SEG, TEST_RATE, 16000.0, 20000.0);
+  ret.spur_db = 10.0 * log10(sorted[k_hi - k_lo] / sorted[(k_hi - k_lo) / 2]);
+  return ret;
+}
+
+static bool check(const char *name, bool pass)
+{
+  printf("  %-44s %s\n", name, pass ? "OK":"FAIL");
+  return pass;
+}
+
+int main(void)
+{
+  result_t r[DITHER_MODE_MAX];
+  bool ret = true;
+
+
+  printf("mode    rms(LSB)  20-2k(dB)  16k-20k(dB)  spur(dB)\n");
+  for (int m=0; m<DITHER_MODE_MAX; m++)
+  {
+    r[m] = runMode(m);
+    printf("%-7s %8.3f  %9.1f  %11.1f  %8.1f\n", dither_mode_str[m], r[m].rms_lsb, r[m].low_db, r[m].high_db, r[m].spur_db);
+  }
+
+  ret &= check("off : harmonic spurs > 15 dB above median", r[DITHER_MODE_OFF].spur_db > 15.0);
+  ret &= check("tpdf : rms 0.45 ~ 0.55 LSB", r[DITHER_MODE_TPDF].rms_lsb > 0.45 && r[DITHER_MODE_TPDF].rms_lsb < 0.55);
+  ret &= check("tpdf : flat, low/high within 1.5 dB", fabs(r[DITHER_MODE_TPDF].low_db - r[DITHER_MODE_TPDF].high_db) < 1.5);
+  ret &= check("tpdf : no spurs (< 10 dB above median)", r[DITHER_MODE_TPDF].spur_db < 10.0);
+  ret &= check("shape1 : 20-2k at least 15 dB below tpdf", r[DITHER_MODE_SHAPE1].low_db < r[DITHER_MODE_TPDF].low_db - 15.0);
+  ret &= check("shape1 : 16k-20k above tpdf", r[DITHER_MODE_SHAPE1].high_db > r[DITHER_MODE_TPDF].high_db + 3.0);
+  ret &= check("shape2 : 20-2k at least 10 dB below shape1", r[DITHER_MODE_SHAPE2].low_db < r[DITHER_MODE_SHAPE1].low_db - 10.0);
+  ret &= check("shape2 : 16k-20k above shape1", r[DITHER_MODE_SHAPE2].high_db > r[DITHER_MODE_SHAPE1].high_db);
+  ret &= check("no clipping", dither_clip == 0);
+
+  printf("dither     : %s\n", ret ? "OK":"FAIL");
+  return ret ? 0:1;
+}
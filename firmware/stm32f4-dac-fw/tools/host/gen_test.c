@@ -0,0 +1,184 @@
+// gen.c 호스트 테스트
+//
+//   genMelody() 가 바로 반환하고, 처리 인터럽트(믹서 소스 32 프레임 단위)만으로
+//   음/쉼표가 큐 순서대로 바뀌는지 출력의 음/무음 경계로 확인한다.
+//   끝나면 EVENT_AUDIO_CTRL 로 스레드(genUpdate)가 정리하고 뮤트 상태가 돌아와야 한다.
+//
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "gen.c"
+#include "host_stub.h"
+
+
+#define TEST_RATE       48000
+#define TEST_CHUNK      32                    // MIXER_SRC_FRAMES
+#define TEST_SEC        3
+#define TEST_EDGE_MAX   32
+
+
+static bool     src_on = false;
+static bool     mute = true;
+static bool     event_req = false;
+static int32_t  buf[TEST_CHUNK * 2];
+
+
+bool i2sSetSource(const char *name, I2sStageFunc_t func, void *arg)
+{
+  return true;
+}
+
+bool i2sSourceEnable(bool enable, bool solo)
+{
+  src_on = enable;
+  return true;
+}
+
+uint32_t i2sGetSampleRate(void)
+{
+  return TEST_RATE;
+}
+
+bool i2sMute(bool enable)
+{
+  mute = enable;
+  return true;
+}
+
+bool i2sIsMute(void)
+{
+  return mute;
+}
+
+void eventPost(EventId_t id)
+{
+  event_req = true;
+}
+
+static bool check(const char *name, bool pass)
+{
+  printf("  %-54s %s\n", name, pass ? "OK":"FAIL");
+  return pass;
+}
+
+// 소스가 켜져 있는 동안 32 프레임씩 돌리고, 이벤트가 오면 스레드를 돌린다.
+// 음/무음이 바뀐 프레임 위치를 edge[] 에 모으고 소스가 꺼진 프레임을 돌려준다.
+//
+static uint32_t run(uint32_t *edge, int *p_edge_cnt, bool *p_unmuted)
+{
+  uint32_t frame = 0;
+  bool     tone = false;
+
+
+  *p_edge_cnt = 0;
+  *p_unmuted  = false;
+  while (src_on == true && frame < TEST_RATE * TEST_SEC)
+  {
+    genProcess(buf, TEST_CHUNK, NULL);
+    for (int i=0; i<TEST_CHUNK; i++)
+    {
+      // 사인은 위상 0 에서 시작하므로 음 시작은 한 프레임 늦게 잡힌다.
+      //
+      bool on = buf[i*2 + 0] != 0 || buf[i*2 + 1] != 0;
+
+      if (on != tone && *p_edge_cnt < TEST_EDGE_MAX)
+      {
+        edge[(*p_edge_cnt)++] = frame + i;
+      }
+      tone = on;
+    }
+    frame += TEST_CHUNK;
+    *p_unmuted |= (mute != true);
+
+    if (event_req == true)
+    {
+      event_req = false;
+      genUpdate();
+    }
+  }
+  return frame;
+}
+
+int main(void)
+{
+  // gen melody 와 같은 음 : 4, 8, 8, 4, 4, 4(쉼표), 4, 4 분음표
+  //
+  uint16_t freq[8]    = {262, 196, 196, 220, 196, 0, 247, 262};
+  uint16_t time_ms[8] = {250, 125, 125, 250, 250, 250, 250, 250};
+  uint32_t expect[TEST_EDGE_MAX];
+  uint32_t edge[TEST_EDGE_MAX];
+  int      expect_cnt = 0;
+  int      edge_cnt;
+  uint32_t end;
+  uint32_t end_expect;
+  uint32_t t_ms = 0;
+  bool     unmuted;
+  bool     ret = true;
+  bool     pass;
+
+
+  genInit();
+
+  // 예상 경계 : 음 시작/끝, 쉼표(0Hz) 음은 앞 쉼표와 이어진다.
+  //
+  for (int i=0; i<8; i++)
+  {
+    if (freq[i] > 0)
+    {
+      expect[expect_cnt++] = t_ms;
+      expect[expect_cnt++] = t_ms + time_ms[i];
+    }
+    t_ms += time_ms[i] + time_ms[i] * 3 / 10;
+  }
+  end_expect = t_ms;
+
+  ret &= check("melody queued, returns at once", genMelody(freq, time_ms, 8, 100) == true);
+  ret &= check("busy, source on, unmuted", genIsBusy() == true && src_on == true && mute == false);
+
+  end = run(edge, &edge_cnt, &unmuted);
+
+  // 음 하나마다 마지막 32 프레임 블록은 남은 만큼만 채우고 다음 음은 다음 블록에서 시작하므로
+  // 경계는 앞선 큐 항목 수 x 32 프레임 안에서 늦어질 수 있다.
+  //
+  pass = edge_cnt == expect_cnt;
+  printf("  edges (ms) :");
+  for (int i=0; i<edge_cnt; i++)
+  {
+    printf(" %.1f", edge[i] * 1000.0 / TEST_RATE);
+  }
+  printf("\n  expect     :");
+  for (int i=0; i<expect_cnt; i++)
+  {
+    printf(" %d", expect[i]);
+  }
+  printf("\n");
+  for (int i=0; i<edge_cnt && i<expect_cnt; i++)
+  {
+    int32_t late = (int32_t)edge[i] - (int32_t)(expect[i] * TEST_RATE / 1000);
+
+    pass &= late >= 0 && late < (int32_t)((i + 1) * TEST_CHUNK);
+  }
+  ret &= check("tone/rest edges follow the queue", pass);
+
+  printf("  end : %.1f ms, expect %d ms\n", end * 1000.0 / TEST_RATE, end_expect);
+  ret &= check("ends after the last rest", end >= end_expect * TEST_RATE / 1000 &&
+                                            end < end_expect * TEST_RATE / 1000 + 16 * TEST_CHUNK);
+  ret &= check("stopped by the thread, mute restored", genIsBusy() == false && src_on == false && mute == true);
+  ret &= check("unmuted while playing", unmuted == true);
+
+  // 다른 명령이 재생 중인 멜로디를 끊는다.
+  //
+  genMelody(freq, time_ms, 8, 100);
+  for (int i=0; i<10; i++)
+  {
+    genProcess(buf, TEST_CHUNK, NULL);
+  }
+  genBeep(1100, 100, 10);                     // 1kHz 는 반 주기마다 정확히 0 이 된다.
+  end = run(edge, &edge_cnt, &unmuted);
+  printf("  beep : %.1f ms\n", end * 1000.0 / TEST_RATE);
+  ret &= check("beep cancels melody", gen_melody_cnt == 0 && edge_cnt == 1 && end == TEST_RATE * 10 / 1000);
+  ret &= check("mute restored after beep", mute == true);
+
+  printf("%s\n", ret ? "PASS":"FAIL");
+  return ret ? 0:1;
+}
@@ -0,0 +1,107 @@
+#ifndef HOST_DSP_H_
+#define HOST_DSP_H_
+
+// 호스트 테스트 공용 : 복소 FFT 와 스펙트럼 계산 (double)
+//
+#include <complex.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+
+static inline void hostFft(double complex *p_x, uint32_t n)
+{
+  for (uint32_t i=1, j=0; i<n; i++)
+  {
+    uint32_t bit = n >> 1;
+
+    for (; j & bit; bit >>= 1)
+    {
+      j ^= bit;
+    }
+    j ^= bit;
+    if (i < j)
+    {
+      double complex t = p_x[i];
+      p_x[i] = p_x[j];
+      p_x[j] = t;
+    }
+  }
+
+  for (uint32_t len=2; len<=n; len<<=1)
+  {
+    double complex w_len = cexp(-2.0 * M_PI * I / len);
+
+    for (uint32_t i=0; i<n; i+=len)
+    {
+      double complex w = 1.0;
+
+      for (uint32_t k=0; k<len/2; k++)
+      {
+        double complex u = p_x[i + k];
+        double complex v = p_x[i + k + len/2] * w;
+
+        p_x[i + k]         = u + v;
+        p_x[i + k + len/2] = u - v;
+        w *= w_len;
+      }
+    }
+  }
+}
+
+// Hann 창, seg 길이 구간을 반씩 겹쳐서 평균한 파워 스펙트럼 (bin 0 ~ seg/2)
+//
+static inline void hostPsd(const double *p_in, uint32_t n, uint32_t seg, double *p_psd)
+{
+  double complex *p_x = malloc(sizeof(double complex) * seg);
+  uint32_t cnt = 0;
+
+
+  for (uint32_t k=0; k<=seg/2; k++)
+  {
+    p_psd[k] = 0.0;
+  }
+  for (uint32_t start=0; start + seg <= n; start += seg/2)
+  {
+    for (uint32_t i=0; i<seg; i++)
+    {
+      double w = 0.5 - 0.5 * cos(2.0 * M_PI * i / seg);
+
+      p_x[i] = p_in[start + i] * w;
+    }
+    hostFft(p_x, seg);
+    for (uint32_t k=0; k<=seg/2; k++)
+    {
+      p_psd[k] += creal(p_x[k] * conj(p_x[k]));
+    }
+    cnt++;
+  }
+  for (uint32_t k=0; k<=seg/2; k++)
+  {
+    p_psd[k] /= cnt;
+  }
+  free(p_x);
+}
+
+// f_lo ~ f_hi 구간 평균 파워 (dB)
+//
+static inline double hostBandDb(const double *p_psd, uint32_t seg, double rate, double f_lo, double f_hi)
+{
+  uint32_t k_lo = (uint32_t)(f_lo * seg / rate);
+  uint32_t k_hi = (uint32_t)(f_hi * seg / rate);
+  double sum = 0.0;
+
+
+  for (uint32_t k=k_lo; k<=k_hi; k++)
+  {
+    sum += p_psd[k];
+  }
+  return 10.0 * log10(sum / (k_hi - k_lo + 1) + 1e-30);
+}
+
+static inline double hostDb(double v)
+{
+  return 20.0 * log10(fabs(v) + 1e-30);
+}
+
+#endif
@@ -0,0 +1,27 @@
+#ifndef HOST_STUB_H_
+#define HOST_STUB_H_
+
+// 호스트 테스트 공용 : 드라이버가 부르는 PRIMASK 모델과 시간 함수
+//   시간을 흉내 내는 테스트는 HOST_STUB_NO_TIME 을 정의하고 millis/micros/cycles/delay 를 직접 구현한다.
+//
+#include "hw_def.h"
+
+
+uint32_t host_primask = 0;
+
+#ifndef HOST_STUB_NO_TIME
+uint32_t millis(void)         { return 0; }
+uint32_t micros(void)         { return 0; }
+uint32_t cycles(void)         { return 0; }
+void     delay(uint32_t ms)   { (void)ms; }
+#endif
+
+#if defined(HOST_USE_CONV) || defined(HOST_USE_METER)
+DWT_Type host_dwt        = {0};
+uint32_t SystemCoreClock = 96000000;
+#endif
+#ifdef HOST_USE_METER
+uint32_t host_ge = 0;
+#endif
+
+#endif
@@ -0,0 +1,299 @@
+// loudness.c 호스트 테스트
+//
+//   1) 1kHz 레벨 : 디지털 출력 x 코덱 보정을 블록마다 재서, on/off/볼륨 변경 중에도
+//      이전/새 단계의 정상 레벨 사이 +-0.55dB 를 벗어나지 않는지 본다.
+//      코덱 보정은 스레드(loudnessUpdate)가 블록마다 한 번 옮긴다고 보고,
+//      출력 지연을 모르므로 스레드가 옮기기 전/후 보정 둘 다로 잰다.
+//   2) 페이드 : 보정을 이전 단계의 makeup 에 멈춘 채로 단계를 바꿔서 출력이 이전/새 필터 출력 사이를 벗어나는 크기를 잰다.
+//
+#include <stdio.h>
+
+#include "loudness.c"
+#include "loudness_coef.c"
+#include "host_stub.h"
+
+
+#define TEST_RATE       48000
+#define TEST_BLOCK      48                    // 1ms, 1kHz 한 주기
+#define TEST_AMP        0.1
+#define TEST_TOL_DB     0.55
+
+
+static uint8_t  codec_volume = 0;
+static uint8_t  codec_trim = 0;
+static bool     stage_on = false;
+static double   tone_phase = 0;
+static int32_t  buf[TEST_RATE * 2];
+static double   in[TEST_RATE];
+
+
+bool es8156SetVolume(uint8_t volume)
+{
+  codec_volume = volume;
+  return true;
+}
+
+bool es8156SetVolumeTrim(uint8_t trim)
+{
+  codec_trim = trim;
+  return true;
+}
+
+uint8_t es8156GetVolume(void)
+{
+  return codec_volume;
+}
+
+uint8_t es8156GetVolumeTrim(void)
+{
+  uint8_t d = cmap(codec_volume, 0, 100, 0, 0xBF);
+
+  if (codec_volume == 0)
+  {
+    return 0;
+  }
+  return cmin(codec_trim, 0xBF - d);
+}
+
+bool i2sStageAdd(const char *name, I2sStageFunc_t func, void *arg)
+{
+  return true;
+}
+
+bool i2sStageEnable(const char *name, bool enable)
+{
+  stage_on = enable;
+  return true;
+}
+
+uint32_t i2sGetSampleRate(void)
+{
+  return TEST_RATE;
+}
+
+int16_t i2sGetVolume(void)
+{
+  return 30;
+}
+
+void eventPost(EventId_t id)
+{
+}
+
+static bool check(const char *name, bool pass)
+{
+  printf("  %-54s %s\n", name, pass ? "OK":"FAIL");
+  return pass;
+}
+
+static int rateIndex(void)
+{
+  for (int r=0; r<LOUDNESS_RATE_MAX; r++)
+  {
+    if (loudness_rate[r] == TEST_RATE)
+    {
+      return r;
+    }
+  }
+  return -1;
+}
+
+// 정상 상태 1kHz 레벨 = 필터(미리 줄인 만큼 포함) + makeup, 스테이지가 꺼져 있으면 0dB
+//
+static double stepDb(int step, bool on)
+{
+  const float (*c)[5] = loudness_coef[rateIndex()][step];
+  double w = 2.0 * M_PI * 1000.0 / TEST_RATE;
+  double db = loudness_makeup[step] * 0.5;
+
+
+  if (on != true)
+  {
+    return 0.0;
+  }
+  for (int b=0; b<LOUDNESS_BIQUAD_MAX; b++)
+  {
+    double nr = c[b][0] + c[b][1] * cos(w) + c[b][2] * cos(2*w);
+    double ni = -c[b][1] * sin(w) - c[b][2] * sin(2*w);
+    double dr = 1.0 + c[b][3] * cos(w) + c[b][4] * cos(2*w);
+    double di = -c[b][3] * sin(w) - c[b][4] * sin(2*w);
+
+    db += 10.0 * log10((nr*nr + ni*ni) / (dr*dr + di*di));
+  }
+  return db;
+}
+
+// 블록 단위로 처리하고 스레드를 한 번 돌린다. 레벨이 [lo, hi] 를 벗어난 최대 크기를 돌려준다.
+//
+static double runLevel(int blocks, double lo, double hi, double *p_last)
+{
+  double err = 0;
+
+
+  for (int k=0; k<blocks; k++)
+  {
+    double pi = 0, po = 0;
+    double trim_pre;
+    double trim_post;
+
+    for (int i=0; i<TEST_BLOCK; i++)
+    {
+      int32_t x = (int32_t)(TEST_AMP * sin(tone_phase) * 2147483647.0);
+
+      buf[i*2 + 0] = x;
+      buf[i*2 + 1] = x;
+      tone_phase += 2.0 * M_PI * 1000.0 / TEST_RATE;
+    }
+    for (int i=0; i<TEST_BLOCK; i++)
+    {
+      pi += (double)buf[i*2] * buf[i*2];
+    }
+    if (stage_on == true)
+    {
+      loudnessProcess(buf, TEST_BLOCK, NULL);
+    }
+    for (int i=0; i<TEST_BLOCK; i++)
+    {
+      po += (double)buf[i*2] * buf[i*2];
+    }
+
+    trim_pre = es8156GetVolumeTrim() * 0.5;
+    loudnessUpdate();
+    trim_post = es8156GetVolumeTrim() * 0.5;
+
+    for (int t=0; t<2; t++)
+    {
+      double db = 10.0 * log10(po / pi) + (t == 0 ? trim_pre:trim_post);
+
+      err = fmax(err, fmax(lo - db, db - hi));
+      *p_last = db;
+    }
+  }
+  return err;
+}
+
+static bool testLevel(const char *name, int volume, bool enable, double db_old)
+{
+  char str[80];
+  double db_new;
+  double last = 0;
+  double err;
+  bool ret = true;
+
+
+  es8156SetVolume(volume);
+  loudnessSetVolume(volume);
+  loudnessSetEnable(enable, false);
+
+  db_new = stepDb(enable ? volume:0, enable);
+  err    = runLevel(200, fmin(db_old, db_new) - TEST_TOL_DB, fmax(db_old, db_new) + TEST_TOL_DB, &last);
+
+  printf("  %-22s : %+6.2f -> %+6.2f dB, outside +-%.2f dB : %.3f dB\n",
+         name, db_old, db_new, TEST_TOL_DB, fmax(err, 0));
+  snprintf(str, sizeof(str), "%s : level tracks", name);
+  ret &= check(str, err <= 0.0);
+  snprintf(str, sizeof(str), "%s : settled, trim = makeup", name);
+  ret &= check(str, fabs(last - db_new) < 0.05 &&
+                    loudness_trim_set == (enable ? loudness_makeup[volume]:0));
+  return ret;
+}
+
+// 보정은 그대로 두고 s0 -> s1 로 바꾼 후, 출력이 이전/새 필터 출력 사이를 벗어난 최대 크기(입력 피크 대비)
+//
+static double testFade(int s0, int s1, double f)
+{
+  const float (*ca)[5] = loudness_coef[rateIndex()][s0];
+  const float (*cb)[5] = loudness_coef[rateIndex()][s1];
+  float  sa[LOUDNESS_BIQUAD_MAX][4] = {0};
+  float  sb[LOUDNESS_BIQUAD_MAX][4] = {0};
+  double ga;
+  double gb;
+  int    sw = TEST_RATE / 2;
+  double err = 0;
+
+
+  loudness_enable   = true;
+  loudness_step_req = s0;
+  loudness_rate_cur = 0;
+  loudness_trim     = loudness_makeup[s0];
+  ga = loudnessTrimGain(loudness_makeup[s0] - loudness_trim);
+  gb = loudnessTrimGain(loudness_makeup[s1] - loudness_trim);
+
+  for (int i=0; i<TEST_RATE; i++)
+  {
+    in[i] = TEST_AMP * sin(2.0 * M_PI * f * i / TEST_RATE);
+    buf[i*2 + 0] = (int32_t)(in[i] * 2147483647.0);
+    buf[i*2 + 1] = buf[i*2 + 0];
+  }
+  for (int p=0; p<TEST_RATE; p+=TEST_BLOCK)
+  {
+    if (p == sw)
+    {
+      loudness_step_req = s1;
+    }
+    loudnessProcess(&buf[p*2], TEST_BLOCK, NULL);
+  }
+
+  for (int i=0; i<TEST_RATE; i++)
+  {
+    float  x  = (float)(int32_t)(in[i] * 2147483647.0) * LOUDNESS_Q31_TO_F;
+    double ya = loudnessBiquad(sa, ca, x) * ga;
+    double yb = loudnessBiquad(sb, cb, x) * gb;
+    double y  = buf[i*2] / 2147483648.0;
+
+    if (i >= sw && i < sw + TEST_RATE / 4)
+    {
+      double lo = fmin(ya, yb);
+      double hi = fmax(ya, yb);
+
+      err = fmax(err, y < lo ? lo - y : (y > hi ? y - hi : 0));
+    }
+  }
+  return 20.0 * log10(err / TEST_AMP + 1e-12);
+}
+
+int main(void)
+{
+  bool ret = true;
+  double db;
+
+
+  loudnessInit();
+  es8156SetVolume(30);
+
+  ret &= check("48kHz in rate table", rateIndex() >= 0);
+  ret &= check("init : stage off", stage_on == false);
+
+  ret &= testLevel("on at volume 30",  30,  true,  stepDb(0, false));
+  ret &= testLevel("volume 30 -> 80",  80,  true,  stepDb(30, true));
+  ret &= testLevel("volume 80 -> 100", 100, true,  stepDb(80, true));
+  ret &= testLevel("volume 100 -> 95", 95,  true,  stepDb(100, true));
+  ret &= testLevel("off at volume 95", 95,  false, stepDb(95, true));
+  ret &= check("off : stage disabled, codec trim 0", stage_on == false && codec_trim == 0);
+  ret &= testLevel("on at volume 1",   1,   true,  stepDb(0, false));
+  ret &= testLevel("volume 1 -> 0",    0,   true,  stepDb(1, true));
+  ret &= testLevel("volume 0 -> 1",    1,   true,  stepDb(0, true));
+  ret &= testLevel("off at volume 1",  1,   false, stepDb(1, true));
+  ret &= check("off : stage disabled, codec trim 0", stage_on == false && codec_trim == 0);
+
+  // 페이드 : 섞는 동안 이전/새 필터 출력 사이에 있어야 한다.
+  //
+  printf("  fade, outside old/new filter output (re input peak) :\n");
+  for (int t=0; t<3; t++)
+  {
+    static const int    step[3][2] = {{49, 50}, {20, 100}, {100, 0}};
+    static const double freq[3]    = {100.0, 1000.0, 10000.0};
+
+    for (int f=0; f<3; f++)
+    {
+      char str[80];
+
+      db = testFade(step[t][0], step[t][1], freq[f]);
+      snprintf(str, sizeof(str), "fade %3d -> %3d at %5.0f Hz : %7.1f dB", step[t][0], step[t][1], freq[f], db);
+      ret &= check(str, db < -80.0);
+    }
+  }
+
+  printf("%s\n", ret ? "PASS":"FAIL");
+  return ret ? 0:1;
+}
@@ -0,0 +1,206 @@
+// mixer.c 호스트 테스트
+//
+//   mixerMix() 의 포화 덧셈(__QADD)과 게인, 솔로 소스, 링 버퍼 경계를 확인한다.
+//   풀 스케일 스트림 + 풀 스케일 채널 두 개를 섞어도 부호가 뒤집히지 않아야 한다.
+//   비용은 호스트 ns/frame 만 참고로 출력한다. M4 사이클은 보드에서 i2s stage 의 mixer 줄로 본다.
+//
+#include <stdio.h>
+#include <time.h>
+
+#include "mixer.c"
+#include "host_stub.h"
+
+
+#define TEST_FRAMES     192
+#define TEST_LOOP       20000
+
+
+static mixer_t mixer;
+static int32_t buf[TEST_FRAMES * 2];
+static int16_t wr[TEST_FRAMES * 2];
+static int32_t src_level = 0;
+
+
+static void src(int32_t *p_buf, uint32_t frames, void *arg)
+{
+  for (uint32_t i=0; i<frames*2; i++)
+  {
+    p_buf[i] = src_level;
+  }
+}
+
+static void fill(int32_t *p_buf, int32_t v)
+{
+  for (uint32_t i=0; i<TEST_FRAMES*2; i++)
+  {
+    p_buf[i] = v;
+  }
+}
+
+static void chWrite(uint8_t ch, int16_t v, uint32_t frames)
+{
+  for (uint32_t i=0; i<frames*2; i++)
+  {
+    wr[i] = v;
+  }
+  mixerWrite(&mixer, ch, wr, frames * 2);
+}
+
+static bool all(const int32_t *p_buf, uint32_t frames, int32_t v)
+{
+  for (uint32_t i=0; i<frames*2; i++)
+  {
+    if (p_buf[i] != v)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+static double ns(struct timespec *a, struct timespec *b)
+{
+  return (b->tv_sec - a->tv_sec) * 1e9 + (b->tv_nsec - a->tv_nsec);
+}
+
+static bool check(const char *name, bool pass)
+{
+  printf("  %-54s %s\n", name, pass ? "OK":"FAIL");
+  return pass;
+}
+
+int main(void)
+{
+  bool ret = true;
+  int8_t s;
+
+
+  mixerInit(&mixer);
+
+  // 포화 : 평범한 덧셈이면 부호가 뒤집힌다.
+  //
+  fill(buf, INT32_MAX);
+  chWrite(0, INT16_MAX, TEST_FRAMES);
+  chWrite(1, INT16_MAX, TEST_FRAMES);
+  ret &= check("2 channels mixed", mixerMix(&mixer, buf, TEST_FRAMES) == 2);
+  ret &= check("+full scale x 3 = INT32_MAX", all(buf, TEST_FRAMES, INT32_MAX));
+  ret &= check("plain add would wrap", (int32_t)((uint32_t)INT32_MAX + (uint32_t)(INT16_MAX << 16)) < 0);
+
+  fill(buf, INT32_MIN);
+  chWrite(0, INT16_MIN, TEST_FRAMES);
+  chWrite(1, INT16_MIN, TEST_FRAMES);
+  mixerMix(&mixer, buf, TEST_FRAMES);
+  ret &= check("-full scale x 3 = INT32_MIN", all(buf, TEST_FRAMES, INT32_MIN));
+
+  // 게인 32768 에서 -32768 은 정확히 INT32_MIN
+  //
+  fill(buf, 0);
+  chWrite(0, INT16_MIN, TEST_FRAMES);
+  mixerMix(&mixer, buf, TEST_FRAMES);
+  ret &= check("-32768 at volume 100 = INT32_MIN", all(buf, TEST_FRAMES, INT32_MIN));
+
+  // 채널 볼륨
+  //
+  mixerSetChVolume(&mixer, 0, 50);
+  fill(buf, 0);
+  chWrite(0, 1000, TEST_FRAMES);
+  mixerMix(&mixer, buf, TEST_FRAMES);
+  ret &= check("volume 50 = half", all(buf, TEST_FRAMES, (1000 * 16384) << 1));
+  mixerSetChVolume(&mixer, 0, 100);
+
+  // 링 버퍼 끝을 넘어 쓰고, 모자란 채널은 있는 만큼만 섞는다.
+  //
+  for (int i=0; i<(MIXER_MAX_BUF_LEN / 2) / TEST_FRAMES + 1; i++)
+  {
+    chWrite(0, 100, TEST_FRAMES);
+    fill(buf, 0);
+    mixerMix(&mixer, buf, TEST_FRAMES);
+  }
+  ret &= check("ring wrap", all(buf, TEST_FRAMES, 100 << 16) && mixerIsEmpty(&mixer, 0));
+  chWrite(0, 100, TEST_FRAMES / 2);
+  fill(buf, 0);
+  mixerMix(&mixer, buf, TEST_FRAMES);
+  ret &= check("underrun : only available frames mixed",
+               all(buf, TEST_FRAMES / 2, 100 << 16) && all(&buf[TEST_FRAMES], TEST_FRAMES / 2, 0));
+
+  // 소스 채널
+  //
+  s = mixerAddSource(&mixer, "src", src, NULL);
+  ret &= check("add source", s == 0 && mixerAddSource(&mixer, "full", src, NULL) < 0);
+  ret &= check("idle mixer is not active", mixerIsActive(&mixer) == false);
+
+  src_level = 0x12345678;
+  mixerSetSource(&mixer, s, true, false);
+  fill(buf, 1000);
+  mixerMix(&mixer, buf, TEST_FRAMES);
+  ret &= check("source at volume 100 is exact, mixed on stream", all(buf, TEST_FRAMES, 0x12345678 + 1000));
+  ret &= check("enabled source is active", mixerIsActive(&mixer) == true);
+
+  src_level = INT32_MAX;
+  fill(buf, INT32_MAX);
+  mixerMix(&mixer, buf, TEST_FRAMES);
+  ret &= check("source saturates", all(buf, TEST_FRAMES, INT32_MAX));
+
+  src_level = 0x12345678;
+  mixerSetSource(&mixer, s, true, true);
+  fill(buf, 1000);
+  mixerMix(&mixer, buf, TEST_FRAMES);
+  ret &= check("solo source replaces stream", all(buf, TEST_FRAMES, 0x12345678));
+  mixerSetSource(&mixer, s, false, false);
+
+  // 참고용 비용 : 채널 2개, 192 프레임
+  //
+  {
+    struct timespec t0, t1;
+    volatile int32_t sink = 0;
+    double t_mix;
+    double t_add;
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int l=0; l<TEST_LOOP; l++)
+    {
+      chWrite(0, (int16_t)l, TEST_FRAMES);
+      chWrite(1, (int16_t)-l, TEST_FRAMES);
+      mixerMix(&mixer, buf, TEST_FRAMES);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    t_mix = ns(&t0, &t1);
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int l=0; l<TEST_LOOP; l++)
+    {
+      chWrite(0, (int16_t)l, TEST_FRAMES);
+      chWrite(1, (int16_t)-l, TEST_FRAMES);
+      for (int ch=0; ch<MIXER_MAX_CH; ch++)
+      {
+        // mixerMix() 와 같은 루프에서 __QADD 만 뺀 것 (넘치면 부호가 뒤집힌다)
+        //
+        mixer_buf_t *p_ch = &mixer.buf[ch];
+        uint32_t out = p_ch->out;
+
+        for (uint32_t i=0; i<TEST_FRAMES*2; i+=2)
+        {
+          buf[i + 0] = (int32_t)((uint32_t)buf[i + 0] + (uint32_t)(((int32_t)p_ch->buf[out + 0] * p_ch->gain) << 1));
+          buf[i + 1] = (int32_t)((uint32_t)buf[i + 1] + (uint32_t)(((int32_t)p_ch->buf[out + 1] * p_ch->gain) << 1));
+          out += 2;
+          if (out >= p_ch->length)
+          {
+            out = 0;
+          }
+        }
+        p_ch->out = out;
+      }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    t_add = ns(&t0, &t1);
+    sink = buf[0];
+    (void)sink;
+
+    printf("  host cost, 2 ch : QADD %.2f ns/frame, plain add %.2f ns/frame (write included)\n",
+           t_mix / TEST_LOOP / TEST_FRAMES,
+           t_add / TEST_LOOP / TEST_FRAMES);
+  }
+
+  printf("%s\n", ret ? "PASS":"FAIL");
+  return ret ? 0:1;
+}
@@ -0,0 +1,159 @@
+// resample.c 호스트 테스트
+//
+//   44.1k/48k 사인을 96k 로 올리고 Hann 창 DFT 로 톤과 이미지 레벨을 잰다.
+//   통과 대역 : 20Hz ~ 20kHz 이득 편차
+//   이미지    : in_rate - f, in_rate + f 에 남는 성분 (저지 대역 24.1kHz ~)
+//   입력은 링 버퍼와 같은 DMA 형식(상/하위 16비트 교환)으로 넣고
+//   출력 192 프레임마다 resampleGetInFrames() 만큼만 넘긴다.
+//
+#include <stdio.h>
+
+#include "resample.c"
+#include "resample_coef.c"
+#include "host_stub.h"
+#include "host_dsp.h"
+
+
+#define TEST_OUT_RATE   HW_RESAMPLE_OUT_RATE
+#define TEST_OUT_LEN    (TEST_OUT_RATE / 2)
+#define TEST_SKIP       1024
+#define TEST_WIN        32768
+#define TEST_BLOCK      192
+#define TEST_AMP        0.5
+#define TEST_SWEEP_STEP 250.0
+#define TEST_SWEEP_CNT  80
+
+
+void arm_dot_prod_f32(float32_t *pSrcA, float32_t *pSrcB, uint32_t blockSize, float32_t *result)
+{
+  float32_t sum = 0.0f;
+
+  for (uint32_t i=0; i<blockSize; i++)
+  {
+    sum += pSrcA[i] * pSrcB[i];
+  }
+  *result = sum;
+}
+
+
+static int32_t in_buf[TEST_OUT_LEN * 2];
+static int32_t out_buf[TEST_OUT_LEN * 2];
+
+
+static bool run(uint32_t in_rate, double f)
+{
+  uint32_t in_pos  = 0;
+  uint32_t out_pos = 0;
+
+
+  for (uint32_t i=0; i<TEST_OUT_LEN; i++)
+  {
+    int32_t x = (int32_t)(TEST_AMP * sin(2.0 * M_PI * f * i / in_rate) * 2147483647.0);
+
+    in_buf[i*2 + 0] = (int32_t)__ROR((uint32_t)x, 16);
+    in_buf[i*2 + 1] = (int32_t)__ROR((uint32_t)-x, 16);
+  }
+
+  resampleSetRate(in_rate, TEST_OUT_RATE);
+  while (out_pos + TEST_BLOCK <= TEST_OUT_LEN)
+  {
+    uint32_t in_frames = resampleGetInFrames(TEST_BLOCK);
+    uint32_t out_cnt;
+
+    out_cnt = resampleProcess(&out_buf[out_pos*2], TEST_BLOCK, &in_buf[in_pos*2], &in_frames);
+    if (out_cnt != TEST_BLOCK)
+    {
+      return false;
+    }
+    in_pos  += in_frames;
+    out_pos += out_cnt;
+  }
+  return true;
+}
+
+// 창을 씌운 DFT 로 구한 f 의 진폭 (ch 0)
+//
+static double level(double f)
+{
+  double complex acc = 0.0;
+  double w_sum = 0.0;
+
+  for (uint32_t i=0; i<TEST_WIN; i++)
+  {
+    double w = 0.5 - 0.5 * cos(2.0 * M_PI * i / TEST_WIN);
+    double x = out_buf[(TEST_SKIP + i)*2] / 2147483648.0;
+
+    acc   += w * x * cexp(-2.0 * M_PI * I * f * i / TEST_OUT_RATE);
+    w_sum += w;
+  }
+  return 2.0 * cabs(acc) / w_sum;
+}
+
+static bool check(const char *name, bool pass)
+{
+  printf("  %-54s %s\n", name, pass ? "OK":"FAIL");
+  return pass;
+}
+
+int main(void)
+{
+  const uint32_t rate_tbl[] = {44100, 48000};
+  bool ret = true;
+  char name[80];
+
+
+  for (uint32_t r=0; r<sizeof(rate_tbl)/sizeof(rate_tbl[0]); r++)
+  {
+    uint32_t in_rate = rate_tbl[r];
+    double gain_min =  100.0;
+    double gain_max = -100.0;
+    double image_max = -200.0;
+    double image_f   = 0.0;
+    bool   run_ok = true;
+
+    // 20Hz, 그리고 250Hz ~ 20kHz 를 250Hz 간격으로
+    //
+    printf("%d -> %d\n", in_rate, TEST_OUT_RATE);
+    for (uint32_t t=0; t<=TEST_SWEEP_CNT; t++)
+    {
+      double f = t == 0 ? 20.0 : t * TEST_SWEEP_STEP;
+      double gain;
+
+      run_ok &= run(in_rate, f);
+      gain = hostDb(level(f) / TEST_AMP);
+      gain_min = cmin(gain_min, gain);
+      gain_max = cmax(gain_max, gain);
+
+      // 출력 Nyquist 안에 들어오는 이미지만 본다.
+      //
+      for (int k=-1; k<=1; k+=2)
+      {
+        double f_img = in_rate + k * f;
+        double img;
+
+        if (f_img >= TEST_OUT_RATE / 2)
+        {
+          continue;
+        }
+        img = hostDb(level(f_img) / level(f));
+        if (img > image_max)
+        {
+          image_max = img;
+          image_f   = f_img;
+        }
+      }
+    }
+    printf("  passband : %+.4f / %+.4f dB\n", gain_min, gain_max);
+    printf("  image    : %.1f dBc at %.0f Hz (worst of %d tones)\n", image_max, image_f, TEST_SWEEP_CNT + 1);
+
+    snprintf(name, sizeof(name), "%d : every call fills the output block", in_rate);
+    ret &= check(name, run_ok);
+    snprintf(name, sizeof(name), "%d : passband 20Hz ~ 20kHz within +-0.01 dB", in_rate);
+    ret &= check(name, gain_min > -0.01 && gain_max < 0.01);
+    snprintf(name, sizeof(name), "%d : images < -90 dBc", in_rate);
+    ret &= check(name, image_max < -90.0);
+  }
+
+  printf("%s\n", ret ? "PASS":"FAIL");
+  return ret ? 0:1;
+}
@@ -0,0 +1,32 @@
+#ifndef ARM_MATH_H_
+#define ARM_MATH_H_
+
+#include "hw_def.h"
+
+// 호스트 테스트용 : 드라이버가 쓰는 CMSIS-DSP 함수만 선언하고 테스트 쪽에서 구현한다.
+//
+// real FFT 는 packed 형식을 맞춘다.
+//   정방향 출력 : [0] = DC, [1] = Nyquist 실수, 이후 bin 1 ~ N/2-1 의 (re, im)
+//   역방향      : 같은 형식을 받아 1/N 을 곱한 시간 영역 값을 낸다.
+//
+typedef float float32_t;
+
+#define PI                    3.14159265358979f
+
+typedef enum
+{
+  ARM_MATH_SUCCESS        =  0,
+  ARM_MATH_ARGUMENT_ERROR = -1,
+} arm_status;
+
+typedef struct
+{
+  uint16_t fftLenRFFT;
+} arm_rfft_fast_instance_f32;
+
+arm_status arm_rfft_fast_init_f32(arm_rfft_fast_instance_f32 *S, uint16_t fftLen);
+void       arm_rfft_fast_f32(arm_rfft_fast_instance_f32 *S, float32_t *p, float32_t *pOut, uint8_t ifftFlag);
+void       arm_dot_prod_f32(float32_t *pSrcA, float32_t *pSrcB, uint32_t blockSize, float32_t *result);
+float32_t  arm_cos_f32(float32_t x);
+
+#endif
@@ -0,0 +1,9 @@
+#ifndef BUZZER_H_
+#define BUZZER_H_
+
+#include "hw_def.h"
+
+// 호스트 테스트용 : gen.c 는 CLI 의 NOTE_* 만 쓰고, 호스트에서는 CLI 를 빼고 컴파일한다.
+//
+
+#endif
@@ -0,0 +1,6 @@
+#ifndef CLI_H_
+#define CLI_H_
+
+#define CLI_USE(module)       0
+
+#endif
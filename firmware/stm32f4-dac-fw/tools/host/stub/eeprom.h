@@ -0,0 +1,6 @@
+#ifndef EEPROM_H_
+#define EEPROM_H_
+
+#include "hw_def.h"
+
+#endif
@@ -0,0 +1,13 @@
+#ifndef ES8156_H_
+#define ES8156_H_
+
+#include "hw_def.h"
+
+// 호스트 테스트용 : 볼륨/보정 API 만 선언하고 테스트 쪽에서 코덱을 흉내 낸다.
+//
+bool    es8156SetVolume(uint8_t volume);
+bool    es8156SetVolumeTrim(uint8_t trim);
+uint8_t es8156GetVolume(void);
+uint8_t es8156GetVolumeTrim(void);
+
+#endif
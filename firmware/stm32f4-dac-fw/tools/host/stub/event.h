@@ -0,0 +1,16 @@
+#ifndef EVENT_H_
+#define EVENT_H_
+
+#include "hw_def.h"
+
+// 호스트 테스트용 : 테스트 쪽에서 구현한다.
+//
+typedef enum
+{
+  EVENT_AUDIO_CTRL,
+  EVENT_DSP,
+} EventId_t;
+
+void eventPost(EventId_t id);
+
+#endif
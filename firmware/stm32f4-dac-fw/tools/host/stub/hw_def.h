@@ -0,0 +1,217 @@
+#ifndef HW_DEF_H_
+#define HW_DEF_H_
+
+// 호스트 테스트용 hw_def.h : 드라이버 소스를 그대로 컴파일하기 위한 최소한의 정의
+//
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+#include <limits.h>
+
+
+#define constrain(in,low,high)  ((in)<(low)?(low):((in)>(high)?(high):(in)))
+#define cmax(a,b)               (((a) > (b)) ? (a) : (b))
+#define cmin(a,b)               (((a) < (b)) ? (a) : (b))
+#define cmap(value, in_min, in_max, out_min, out_max) ((value - in_min) * (out_max - out_min) / (in_max - in_min) + out_min)
+
+#define __RAMFUNC
+
+#define logPrintf(...)
+
+
+// PRIMASK
+//
+extern uint32_t host_primask;
+
+static inline uint32_t __get_PRIMASK(void)        { return host_primask; }
+static inline void     __set_PRIMASK(uint32_t v)  { host_primask = v; }
+static inline void     __disable_irq(void)        { host_primask = 1; }
+static inline void     __enable_irq(void)         { host_primask = 0; }
+static inline uint32_t __get_IPSR(void)           { return 0; }
+
+// Cortex-M4 DSP 명령
+//
+static inline int32_t __QADD(int32_t a, int32_t b)
+{
+  int64_t r = (int64_t)a + b;
+  return r > INT32_MAX ? INT32_MAX : (r < INT32_MIN ? INT32_MIN : (int32_t)r);
+}
+static inline int32_t __QSUB(int32_t a, int32_t b)
+{
+  int64_t r = (int64_t)a - b;
+  return r > INT32_MAX ? INT32_MAX : (r < INT32_MIN ? INT32_MIN : (int32_t)r);
+}
+static inline uint32_t __ROR(uint32_t v, uint32_t n)
+{
+  n &= 31;
+  return n == 0 ? v : (v >> n) | (v << (32 - n));
+}
+
+uint32_t millis(void);
+uint32_t micros(void);
+uint32_t cycles(void);
+void     delay(uint32_t ms);
+
+
+#ifdef HOST_USE_SWTIMER
+#define _USE_HW_SWTIMER
+#define      HW_SWTIMER_MAX_CH      8
+
+// TIM11 모델 : 1MHz 로 CNT 가 증가하고 ARR 에서 0 으로 돌아가며 UPDATE 플래그를 세운다.
+//
+typedef struct
+{
+  uint32_t Prescaler;
+  uint32_t CounterMode;
+  uint32_t Period;
+  uint32_t ClockDivision;
+  uint32_t RepetitionCounter;
+  uint32_t AutoReloadPreload;
+} TIM_Base_InitTypeDef;
+
+typedef struct __TIM_HandleTypeDef
+{
+  void                 *Instance;
+  TIM_Base_InitTypeDef  Init;
+  uint32_t              cnt;
+  uint32_t              arr;
+  bool                  update;
+  bool                  run;
+  void (*cb)(struct __TIM_HandleTypeDef *htim);
+} TIM_HandleTypeDef;
+
+typedef enum { HAL_OK = 0, HAL_ERROR } HAL_StatusTypeDef;
+
+#define TIM11                             ((void *)0x40014800)
+#define TIM_COUNTERMODE_UP                0
+#define TIM_CLOCKDIVISION_DIV1            0
+#define TIM_AUTORELOAD_PRELOAD_DISABLE    0
+#define TIM_FLAG_UPDATE                   1
+#define RESET                             0
+#define HAL_TIM_PERIOD_ELAPSED_CB_ID      0
+#define TIM1_TRG_COM_TIM11_IRQn           0
+
+#define __HAL_RCC_TIM11_CLK_ENABLE()
+#define __HAL_TIM_SET_AUTORELOAD(h, v)    ((h)->arr = (v))
+#define __HAL_TIM_SET_COUNTER(h, v)       ((h)->cnt = (v))
+#define __HAL_TIM_GET_COUNTER(h)          ((h)->cnt)
+#define __HAL_TIM_CLEAR_FLAG(h, f)        ((h)->update = false)
+#define __HAL_TIM_GET_FLAG(h, f)          ((h)->update ? 1:0)
+#define HAL_NVIC_SetPriority(i, p, s)
+#define HAL_NVIC_EnableIRQ(i)
+
+HAL_StatusTypeDef HAL_TIM_Base_Init(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIM_Base_Start_IT(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIM_Base_Stop_IT(TIM_HandleTypeDef *htim);
+HAL_StatusTypeDef HAL_TIM_RegisterCallback(TIM_HandleTypeDef *htim, int id, void (*cb)(TIM_HandleTypeDef *htim));
+void              HAL_TIM_IRQHandler(TIM_HandleTypeDef *htim);
+void              Error_Handler(void);
+#endif
+
+
+#ifdef HOST_USE_CROSSFEED
+#define _USE_HW_I2S
+#define _USE_HW_CROSSFEED
+#endif
+
+#ifdef HOST_USE_CONV
+#define _USE_HW_I2S
+#define _USE_HW_CONV
+#define      HW_CONV_PART_LEN       128
+#define      HW_CONV_PART_MAX       4
+#define      HW_CONV_LOAD_PCT       50
+#define      HW_EEPROM_MAX_SIZE     512
+#define      HW_EEPROM_ADDR_CONV    0x0040
+
+#endif
+
+#ifdef HOST_USE_METER
+#define _USE_HW_I2S
+#define _USE_HW_METER
+#define      HW_METER_WINDOW_MS     300
+#define      HW_METER_FFT_LEN       256
+#define      HW_METER_FFT_MS        100
+#define      HW_METER_BAND_MAX      16
+
+// Cortex-M4 SIMD 명령 : SSUB16 이 세운 GE 플래그를 SEL 이 읽는다.
+//
+extern uint32_t host_ge;
+
+static inline uint32_t __PKHTB(uint32_t a, uint32_t b, uint32_t n)
+{
+  return (a & 0xFFFF0000) | (((uint32_t)((int32_t)b >> n)) & 0xFFFF);
+}
+static inline uint64_t __SMLALD(uint32_t x, uint32_t y, uint64_t acc)
+{
+  return acc + (int64_t)((int16_t)x * (int16_t)y) + (int64_t)((int16_t)(x >> 16) * (int16_t)(y >> 16));
+}
+static inline uint32_t __SSUB16(uint32_t a, uint32_t b)
+{
+  int32_t lo = (int16_t)a - (int16_t)b;
+  int32_t hi = (int16_t)(a >> 16) - (int16_t)(b >> 16);
+
+  host_ge = (lo >= 0 ? 0x3:0) | (hi >= 0 ? 0xC:0);
+  return ((uint32_t)hi << 16) | ((uint32_t)lo & 0xFFFF);
+}
+static inline uint32_t __SEL(uint32_t a, uint32_t b)
+{
+  uint32_t mask = ((host_ge & 0x1) ? 0x0000FFFF:0) | ((host_ge & 0x4) ? 0xFFFF0000:0);
+
+  return (a & mask) | (b & ~mask);
+}
+#endif
+
+#if defined(HOST_USE_CONV) || defined(HOST_USE_METER)
+// 처리 시간 측정은 호스트에서 의미가 없으므로 0 으로 둔다.
+//
+typedef struct
+{
+  uint32_t CYCCNT;
+} DWT_Type;
+
+extern DWT_Type  host_dwt;
+extern uint32_t  SystemCoreClock;
+
+#define DWT                         (&host_dwt)
+#endif
+
+#ifdef HOST_USE_RESAMPLE
+#define _USE_HW_RESAMPLE
+#define      HW_RESAMPLE_OUT_RATE   96000
+#endif
+
+#ifdef HOST_USE_GEN
+#define _USE_HW_I2S
+#define _USE_HW_GEN
+#define      HW_GEN_TONE_MAX        4
+#define      HW_GEN_MELODY_MAX      16
+#endif
+
+#ifdef HOST_USE_LOUDNESS
+#define _USE_HW_I2S
+#define _USE_HW_LOUDNESS
+#endif
+
+#ifdef HOST_USE_MIXER
+#define _USE_HW_MIXER
+#define      HW_MIXER_MAX_CH        2
+#define      HW_MIXER_MAX_BUF_LEN   1024
+#define      HW_MIXER_MAX_SRC       1
+
+static inline void    __DMB(void)                   { __sync_synchronize(); }
+static inline int32_t __SSAT(int32_t v, uint32_t n)
+{
+  int32_t max = (1 << (n - 1)) - 1;
+  return v > max ? max : (v < -max - 1 ? -max - 1 : v);
+}
+#endif
+
+#ifdef HOST_USE_DITHER
+#define _USE_HW_I2S
+#define _USE_HW_DITHER
+#define      HW_DITHER_BITS         24
+#endif
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef I2S_H_
+#define I2S_H_
+
+#include "hw_def.h"
+
+// 호스트 테스트용 : 단계 등록 API 만 선언하고 테스트 쪽에서 구현한다.
+//
+typedef void (*I2sStageFunc_t)(int32_t *p_buf, uint32_t frames, void *arg);
+
+bool     i2sStageAdd(const char *name, I2sStageFunc_t func, void *arg);
+bool     i2sStageAddTap(const char *name, I2sStageFunc_t func, void *arg);
+bool     i2sStageEnable(const char *name, bool enable);
+bool     i2sStageSetQuantizer(const char *name, I2sStageFunc_t func, void *arg);
+bool     i2sSetSource(const char *name, I2sStageFunc_t func, void *arg);
+bool     i2sSourceEnable(bool enable, bool solo);
+uint32_t i2sGetSampleRate(void);
+int16_t  i2sGetVolume(void);
+bool     i2sMute(bool enable);
+bool     i2sIsMute(void);
+
+#endif
@@ -0,0 +1,261 @@
+// swtimer.c 호스트 테스트
+//
+//   TIM11 을 1us 단위로 흉내내고 ISR 지연을 무작위로 넣어서
+//   만료 순서와 주기 타이머의 누적 오차를 확인한다.
+//
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "swtimer.c"
+
+#define HOST_STUB_NO_TIME
+#include "host_stub.h"
+
+
+#define SIM_SEC             20
+#define SIM_LATENCY_MAX_US  3000            // 한 tick 보다 긴 ISR 지연도 넣는다. (주기보다는 짧게)
+#define SIM_LOOP_MAX        3
+
+
+typedef struct
+{
+  swtimer_handle_t handle;
+  uint32_t period_ms;
+  uint32_t start_us;
+  uint32_t fire_cnt;
+  int32_t  err_min;
+  int32_t  err_max;
+} loop_t;
+
+
+static uint32_t sim_us = 0;
+static uint32_t sim_pend_us = 0;
+static uint32_t sim_latency = 0;
+
+static loop_t   loop_tbl[SIM_LOOP_MAX];
+static swtimer_handle_t shot_handle;
+static uint32_t shot_expect_us;
+static uint32_t shot_fire_cnt = 0;
+static int32_t  shot_err_min = 0;
+static int32_t  shot_err_max = 0;
+
+static uint32_t order_us[4];
+static uint32_t order_cnt = 0;
+static uint32_t order_idx[4];
+
+
+
+
+uint32_t millis(void)         { return sim_us / 1000; }
+uint32_t micros(void)         { return sim_us; }
+uint32_t cycles(void)         { return sim_us * 96; }
+void     delay(uint32_t ms)   { (void)ms; }
+void     Error_Handler(void)  { printf("Error_Handler\n"); exit(1); }
+
+HAL_StatusTypeDef HAL_TIM_Base_Init(TIM_HandleTypeDef *htim)
+{
+  htim->arr = htim->Init.Period;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Start_IT(TIM_HandleTypeDef *htim)
+{
+  htim->run = true;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Stop_IT(TIM_HandleTypeDef *htim)
+{
+  htim->run = false;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_RegisterCallback(TIM_HandleTypeDef *htim, int id, void (*cb)(TIM_HandleTypeDef *htim))
+{
+  htim->cb = cb;
+  return HAL_OK;
+}
+
+void HAL_TIM_IRQHandler(TIM_HandleTypeDef *htim)
+{
+  htim->update = false;
+  htim->cb(htim);
+}
+
+static void simStep(void)
+{
+  sim_us++;
+
+  if (htim11.run)
+  {
+    if (htim11.cnt >= htim11.arr)
+    {
+      // ISR 은 다음 업데이트 전에는 처리된다고 본다. (그 이상 늦으면 한 주기를 잃는 것은 하드웨어 한계)
+      //
+      htim11.cnt    = 0;
+      htim11.update = true;
+      sim_pend_us   = sim_us;
+      sim_latency   = rand() % cmin(SIM_LATENCY_MAX_US + 1, htim11.arr);
+    }
+    else
+    {
+      htim11.cnt++;
+    }
+  }
+
+  if (htim11.update && host_primask == 0 && sim_us - sim_pend_us >= sim_latency)
+  {
+    HAL_TIM_IRQHandler(&htim11);
+  }
+}
+
+static void updateErr(int32_t err, int32_t *p_min, int32_t *p_max)
+{
+  if (err < *p_min) *p_min = err;
+  if (err > *p_max) *p_max = err;
+}
+
+static void loopFunc(void *arg)
+{
+  loop_t *p_loop = (loop_t *)arg;
+  uint32_t expect;
+
+  p_loop->fire_cnt++;
+  expect = p_loop->start_us + p_loop->fire_cnt * p_loop->period_ms * 1000;
+  updateErr((int32_t)(sim_us - expect), &p_loop->err_min, &p_loop->err_max);
+}
+
+static void shotFunc(void *arg)
+{
+  shot_fire_cnt++;
+  updateErr((int32_t)(sim_us - shot_expect_us), &shot_err_min, &shot_err_max);
+}
+
+static void orderFunc(void *arg)
+{
+  order_idx[order_cnt] = (uint32_t)(uintptr_t)arg;
+  order_us[order_cnt]  = sim_us;
+  order_cnt++;
+}
+
+static bool testOrder(void)
+{
+  const uint32_t period[4] = {9, 3, 64 + 5, 1};
+  const uint32_t expect[4] = {3, 1, 0, 2};     // 만료 순서 : 1, 3, 9, 69 ms
+  swtimer_handle_t h[4];
+  bool ret = true;
+
+
+  for (int i=0; i<4; i++)
+  {
+    h[i] = swtimerGetHandle();
+    swtimerSet(h[i], period[i], ONE_TIME, orderFunc, (void *)(uintptr_t)i);
+  }
+  for (int i=0; i<4; i++)
+  {
+    swtimerStart(h[i]);
+  }
+  for (uint32_t us=0; us<100*1000; us++)
+  {
+    simStep();
+  }
+
+  printf("order      : ");
+  for (uint32_t i=0; i<order_cnt; i++)
+  {
+    printf("%d(%d ms @ %d us) ", order_idx[i], period[order_idx[i]], order_us[i]);
+  }
+  printf("\n");
+
+  if (order_cnt != 4)
+  {
+    ret = false;
+  }
+  for (uint32_t i=0; i<order_cnt && ret; i++)
+  {
+    if (order_idx[i] != expect[i])
+      ret = false;
+  }
+  return ret;
+}
+
+static bool testAccuracy(void)
+{
+  const uint32_t period[SIM_LOOP_MAX] = {7, 10, 100};
+  uint32_t next_shot_us;
+  bool ret = true;
+
+
+  for (int i=0; i<SIM_LOOP_MAX; i++)
+  {
+    loop_tbl[i].handle    = swtimerGetHandle();
+    loop_tbl[i].period_ms = period[i];
+    loop_tbl[i].fire_cnt  = 0;
+    loop_tbl[i].err_min   = 0;
+    loop_tbl[i].err_max   = 0;
+    swtimerSet(loop_tbl[i].handle, period[i], LOOP_TIME, loopFunc, &loop_tbl[i]);
+  }
+  shot_handle = swtimerGetHandle();
+
+  for (int i=0; i<SIM_LOOP_MAX; i++)
+  {
+    loop_tbl[i].start_us = sim_us;
+    swtimerStart(loop_tbl[i].handle);
+  }
+
+  // 주기 중간에 짧은 one-shot 타이머를 다시 걸어서 TIM11 주기가 자주 바뀌게 한다.
+  //
+  next_shot_us = sim_us + 500;
+  for (uint32_t us=0; us<SIM_SEC*1000000U; us++)
+  {
+    if (sim_us == next_shot_us)
+    {
+      uint32_t ms = 1 + rand() % 5;
+
+      swtimerSet(shot_handle, ms, ONE_TIME, shotFunc, NULL);
+      shot_expect_us = sim_us + ms * 1000;
+      swtimerStart(shot_handle);
+      next_shot_us = sim_us + 300 + rand() % 9000;
+    }
+    simStep();
+  }
+
+  // 만료는 1 tick(1ms) 단위로 내림되므로 최대 1ms 빠를 수 있고, ISR 지연만큼 늦을 수 있다.
+  // 누적 오차가 있으면 max 가 계속 커진다.
+  //
+  for (int i=0; i<SIM_LOOP_MAX; i++)
+  {
+    uint32_t expect_cnt = (sim_us - loop_tbl[i].start_us) / (loop_tbl[i].period_ms * 1000);
+    bool pass;
+
+    pass = loop_tbl[i].err_min >= -1000 && loop_tbl[i].err_max <= SIM_LATENCY_MAX_US + 1000;
+    pass = pass && (loop_tbl[i].fire_cnt + 1 >= expect_cnt) && (loop_tbl[i].fire_cnt <= expect_cnt);
+    printf("loop %3d ms : fire %5d/%5d, err %6d ~ %6d us %s\n",
+      loop_tbl[i].period_ms, loop_tbl[i].fire_cnt, expect_cnt, loop_tbl[i].err_min, loop_tbl[i].err_max, pass ? "":"FAIL");
+    ret = ret && pass;
+  }
+  {
+    bool pass = shot_err_min >= -1000 && shot_err_max <= SIM_LATENCY_MAX_US + 1000;
+
+    printf("one-shot   : fire %5d, err %6d ~ %6d us %s\n", shot_fire_cnt, shot_err_min, shot_err_max, pass ? "":"FAIL");
+    ret = ret && pass;
+  }
+  printf("isr %d, late %d\n", swtimer_stat.isr_cnt, swtimer_stat.late_cnt);
+
+  return ret;
+}
+
+int main(void)
+{
+  bool ret = true;
+
+
+  srand(1);
+  swtimerInit();
+
+  ret = testOrder() && ret;
+  ret = testAccuracy() && ret;
+
+  printf("swtimer    : %s\n", ret ? "OK":"FAIL");
+  return ret ? 0:1;
+}
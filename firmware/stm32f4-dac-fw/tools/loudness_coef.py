@@ -0,0 +1,202 @@
+#!/usr/bin/env python3
+#
+# 볼륨 단계별 loudness 보상 shelf 계수 생성
+#
+#   python3 loudness_coef.py                  : src/hw/driver/loudness_coef.c 생성
+#   python3 loudness_coef.py --check          : 단계별 보상량과 오차만 출력
+#
+# 볼륨 100% 를 REF_PHON 으로 보고, ES8156 볼륨 레지스터(0.5dB/step)로 줄어든 만큼 낮은
+# ISO 226:2003 등청감 곡선과의 차이를 low/high shelf 2개로 맞춘다.
+# 가장 큰 boost 만큼 디지털로 미리 줄이고(첫 biquad 에 포함) 코덱 레지스터를 같은 양만큼 올린다.
+#
+import argparse
+import cmath
+import math
+import os
+
+
+RATE_TBL   = [96000, 48000, 44100, 32000, 22050, 16000, 11025, 8000]  # i2s 가 지원하는 전체 레이트, 순서대로 찾는다.
+STEP_MAX   = 101                            # 볼륨 0 ~ 100
+REF_PHON   = 80.0
+MIN_PHON   = 20.0
+
+LO_FC      = 200.0
+HI_FC      = 9000.0
+LO_MAX_DB  = 15.0
+HI_MAX_DB  = 8.0
+HI_LIMIT   = 0.4                            # 낮은 레이트에서는 high shelf 를 쓰지 않는다.
+GAIN_STEP  = 0.25
+FIT_RATE   = 48000
+
+# ISO 226:2003 Table 1
+ISO_F  = [20, 25, 31.5, 40, 50, 63, 80, 100, 125, 160, 200, 250, 315, 400, 500, 630, 800,
+          1000, 1250, 1600, 2000, 2500, 3150, 4000, 5000, 6300, 8000, 10000, 12500]
+ISO_AF = [0.532, 0.506, 0.480, 0.455, 0.432, 0.409, 0.387, 0.367, 0.349, 0.330, 0.315,
+          0.301, 0.288, 0.276, 0.267, 0.259, 0.253, 0.250, 0.246, 0.244, 0.243, 0.243,
+          0.243, 0.242, 0.242, 0.245, 0.254, 0.271, 0.301]
+ISO_LU = [-31.6, -27.2, -23.0, -19.1, -15.9, -13.0, -10.3, -8.1, -6.2, -4.5, -3.1, -2.0,
+          -1.1, -0.4, 0.0, 0.3, 0.5, 0.0, -2.7, -4.1, -1.0, 1.7, 2.5, 1.2, -2.1, -7.1,
+          -11.2, -10.7, -3.1]
+ISO_TF = [78.5, 68.7, 59.5, 51.1, 44.0, 37.5, 31.5, 26.5, 22.1, 17.9, 14.4, 11.4, 8.6,
+          6.2, 4.4, 3.0, 2.2, 2.4, 3.5, 1.7, -1.3, -4.2, -6.0, -5.4, -1.5, 6.0, 12.6,
+          13.9, 12.3]
+
+
+def iso226(phon):
+  out = []
+  for af, lu, tf in zip(ISO_AF, ISO_LU, ISO_TF):
+    a = 4.47e-3 * (10.0 ** (0.025 * phon) - 1.15) + (0.4 * 10.0 ** ((tf + lu) / 10.0 - 9.0)) ** af
+    out.append(10.0 / af * math.log10(a) - lu + 94.0)
+  return out
+
+
+def atten_db(volume):
+  # es8156.c writeVolume() 와 같은 레지스터 값, 0xBF = 0dB
+  d = volume * 0xBF // 100
+  return (0xBF - d) * 0.5
+
+
+def target_db(volume):
+  # 1kHz 기준으로 정규화한 보상량
+  a = min(atten_db(volume), REF_PHON - MIN_PHON)
+  ref = iso226(REF_PHON)
+  low = iso226(REF_PHON - a)
+  return [l - r + a for l, r in zip(low, ref)]
+
+
+def shelf(kind, gain_db, fc, rate):
+  # RBJ cookbook shelf, S = 1, a0 으로 정규화한 [b0, b1, b2, a1, a2]
+  a  = 10.0 ** (gain_db / 40.0)
+  w0 = 2.0 * math.pi * fc / rate
+  cs = math.cos(w0)
+  al = math.sin(w0) / 2.0 * math.sqrt(2.0)
+  sq = 2.0 * math.sqrt(a) * al
+  if kind == "lo":
+    b0 =      a * ((a + 1) - (a - 1) * cs + sq)
+    b1 =  2 * a * ((a - 1) - (a + 1) * cs)
+    b2 =      a * ((a + 1) - (a - 1) * cs - sq)
+    a0 =           (a + 1) + (a - 1) * cs + sq
+    a1 =     -2 * ((a - 1) + (a + 1) * cs)
+    a2 =           (a + 1) + (a - 1) * cs - sq
+  else:
+    b0 =      a * ((a + 1) + (a - 1) * cs + sq)
+    b1 = -2 * a * ((a - 1) + (a + 1) * cs)
+    b2 =      a * ((a + 1) + (a - 1) * cs - sq)
+    a0 =           (a + 1) - (a - 1) * cs + sq
+    a1 =      2 * ((a - 1) - (a + 1) * cs)
+    a2 =           (a + 1) - (a - 1) * cs - sq
+  return [b0 / a0, b1 / a0, b2 / a0, a1 / a0, a2 / a0]
+
+
+def response_db(c, f, rate):
+  z = cmath.exp(-1j * 2.0 * math.pi * f / rate)
+  h = (c[0] + c[1] * z + c[2] * z * z) / (1.0 + c[3] * z + c[4] * z * z)
+  return 20.0 * math.log10(max(abs(h), 1e-20))
+
+
+def gain_list(max_db):
+  return [i * GAIN_STEP for i in range(int(max_db / GAIN_STEP) + 1)]
+
+
+def fit(targets):
+  # shelf 응답을 dB 로 미리 계산해 두고 두 이득을 격자 탐색한다.
+  lo_g = gain_list(LO_MAX_DB)
+  hi_g = gain_list(HI_MAX_DB)
+  lo_r = [[response_db(shelf("lo", g, LO_FC, FIT_RATE), f, FIT_RATE) for f in ISO_F] for g in lo_g]
+  hi_r = [[response_db(shelf("hi", g, HI_FC, FIT_RATE), f, FIT_RATE) for f in ISO_F] for g in hi_g]
+  out = []
+  for t in targets:
+    best = None
+    for i, lr in enumerate(lo_r):
+      for j, hr in enumerate(hi_r):
+        e = sum((l + h - d) ** 2 for l, h, d in zip(lr, hr, t))
+        if best is None or e < best[0]:
+          best = (e, lo_g[i], hi_g[j])
+    out.append((best[1], best[2], math.sqrt(best[0] / len(ISO_F))))
+  return out
+
+
+def makeup(volume, lo_db, hi_db):
+  # 코덱 레지스터는 0xBF(0dB) 를 넘지 않게 올린다, 0.5dB 단위
+  if volume == 0:
+    return 0
+  return min(int(math.ceil(max(lo_db, hi_db) * 2.0)), 0xBF - volume * 0xBF // 100)
+
+
+def tables():
+  targets = [target_db(v) for v in range(STEP_MAX)]
+  gains   = fit(targets)
+  steps   = []
+  for v, (lo_db, hi_db, err) in enumerate(gains):
+    if v == 0:
+      lo_db, hi_db = 0.0, 0.0
+    steps.append((lo_db, hi_db, err, makeup(v, lo_db, hi_db)))
+
+  coef = []
+  for rate in RATE_TBL:
+    rows = []
+    for lo_db, hi_db, err, mk in steps:
+      lo = shelf("lo", lo_db, LO_FC, rate)
+      hi = shelf("hi", hi_db if HI_FC < HI_LIMIT * rate else 0.0, HI_FC, rate)
+      g  = 10.0 ** (-mk * 0.5 / 20.0)
+      lo = [lo[0] * g, lo[1] * g, lo[2] * g, lo[3], lo[4]]
+      rows.append([lo, hi])
+    coef.append(rows)
+  return steps, coef
+
+
+def check(steps):
+  print("shelf     : lo %.0f Hz (max %.1f dB), hi %.0f Hz (max %.1f dB)" % (LO_FC, LO_MAX_DB, HI_FC, HI_MAX_DB))
+  print("vol  atten    lo     hi  makeup  rms err")
+  for v in range(0, STEP_MAX, 5):
+    lo_db, hi_db, err, mk = steps[v]
+    print("%3d  %5.1f  %5.2f  %5.2f  %5.1f   %5.2f" % (v, atten_db(v), lo_db, hi_db, mk * 0.5, err))
+
+
+def write_c(path, steps, coef):
+  with open(path, "w") as f:
+    f.write("// tools/loudness_coef.py 로 생성된 파일, 직접 수정하지 않는다.\n")
+    f.write("//\n")
+    f.write("#include \"loudness.h\"\n\n\n")
+    f.write("#ifdef _USE_HW_LOUDNESS\n\n")
+    f.write("const uint32_t loudness_rate[LOUDNESS_RATE_MAX] =\n{\n")
+    f.write("  " + ", ".join("%d" % r for r in RATE_TBL) + ",\n};\n\n")
+    f.write("// 0.5dB 단위 코덱 레지스터 보정\n")
+    f.write("//\n")
+    f.write("const uint8_t loudness_makeup[LOUDNESS_STEP_MAX] =\n{\n")
+    for i in range(0, STEP_MAX, 16):
+      f.write("  " + " ".join("%d," % s[3] for s in steps[i:i + 16]) + "\n")
+    f.write("};\n\n")
+    f.write("// 0.1dB 단위 low/high shelf 이득\n")
+    f.write("//\n")
+    f.write("const int16_t loudness_gain[LOUDNESS_STEP_MAX][LOUDNESS_BIQUAD_MAX] =\n{\n")
+    for i in range(0, STEP_MAX, 8):
+      f.write("  " + " ".join("{%d, %d}," % (round(s[0] * 10), round(s[1] * 10)) for s in steps[i:i + 8]) + "\n")
+    f.write("};\n\n")
+    f.write("const float loudness_coef[LOUDNESS_RATE_MAX][LOUDNESS_STEP_MAX][LOUDNESS_BIQUAD_MAX][5] =\n{\n")
+    for rate, rows in zip(RATE_TBL, coef):
+      f.write("  // %d Hz\n" % rate)
+      f.write("  {\n")
+      for v, row in enumerate(rows):
+        f.write("    {" + ", ".join("{" + ", ".join("%.9ef" % c for c in bq) + "}" for bq in row) + "},  // %d\n" % v)
+      f.write("  },\n")
+    f.write("};\n\n#endif\n")
+
+
+def main():
+  parser = argparse.ArgumentParser()
+  parser.add_argument("--check", action="store_true")
+  args = parser.parse_args()
+
+  steps, coef = tables()
+  check(steps)
+  if args.check:
+    return
+
+  path = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src", "hw", "driver", "loudness_coef.c")
+  write_c(os.path.normpath(path), steps, coef)
+  print("write     : %s" % os.path.normpath(path))
+
+
+if __name__ == "__main__":
+  main()
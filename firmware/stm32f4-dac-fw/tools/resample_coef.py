@@ -0,0 +1,173 @@
+#!/usr/bin/env python3
+#
+# 96kHz 고정 출력용 polyphase 업샘플러 계수 생성
+#
+#   python3 resample_coef.py                  : src/hw/driver/resample_coef.c 생성
+#   python3 resample_coef.py --check          : 통과/저지 대역 특성만 출력 (원형 필터와 resample_coef.c 의 float 테이블)
+#
+# 원형 필터는 입력 샘플 단위로 정의한 Kaiser windowed sinc 이며 차단 주파수는 입력 Nyquist 이다.
+# 위상 수 320 = 96000/300 이므로 44.1k(147/320), 48k(160/320) 의 위상이 모두 정확히 맞는다.
+#
+import argparse
+import cmath
+import math
+import os
+import re
+import struct
+
+
+PHASE      = 320
+TAPS       = 64
+ATTEN_DB   = 93.0
+
+PASS_HZ    = 20000.0                    # 44.1k 입력 기준 통과 대역
+STOP_HZ    = 44100.0 - PASS_HZ          # 첫 이미지가 내려오는 위치
+IN_HZ      = 44100.0
+
+
+def bessel_i0(x):
+  s = 1.0
+  t = 1.0
+  k = 1
+  while t > 1e-12 * s:
+    t *= (x / (2.0 * k)) ** 2
+    s += t
+    k += 1
+  return s
+
+
+def design():
+  n_len  = PHASE * TAPS
+  center = n_len // 2
+  beta   = 0.1102 * (ATTEN_DB - 8.7)
+  i0_b   = bessel_i0(beta)
+  h      = [0.0] * n_len
+
+  for i in range(n_len):
+    t = (i - center) / PHASE            # 입력 샘플 단위 시간
+    if i == center:
+      s = 1.0
+    elif (i - center) % PHASE == 0:
+      s = 0.0                           # 정수 위치는 정확히 0 : 위상 0 = 지연만
+    else:
+      s = math.sin(math.pi * t) / (math.pi * t)
+    r = (i - center) / center
+    w = bessel_i0(beta * math.sqrt(max(0.0, 1.0 - r * r))) / i0_b
+    h[i] = s * w
+  return h, center
+
+
+def response_db(h, center, f_norm):
+  # 대칭 필터, f_norm 은 원형 필터 샘플레이트 기준
+  w = 2.0 * math.pi * f_norm
+  acc = h[center] + h[0] * math.cos(w * center)
+  for k in range(1, center):
+    acc += 2.0 * h[center + k] * math.cos(w * k)
+  return 20.0 * math.log10(max(abs(acc) / PHASE, 1e-20))
+
+
+def response_table_db(h, f_norm):
+  # 테이블에서 되돌린 원형 필터, 대칭을 가정하지 않는다.
+  w = -2.0 * math.pi * f_norm
+  acc = sum(v * cmath.exp(1j * w * n) for n, v in enumerate(h) if v != 0.0)
+  return 20.0 * math.log10(max(abs(acc) / PHASE, 1e-20))
+
+
+def check_grid():
+  fs = IN_HZ * PHASE
+  pass_f = [(PASS_HZ * i / 40) / fs for i in range(41)]
+  stop_f = [(STOP_HZ + (fs / 2 - STOP_HZ) * (i / 400) ** 3) / fs for i in range(401)]
+  return pass_f, stop_f
+
+
+def check(h, center):
+  pass_f, stop_f = check_grid()
+  pass_db = [response_db(h, center, f) for f in pass_f]
+  stop_db = [response_db(h, center, f) for f in stop_f]
+
+  print("taps      : %d x %d phase" % (TAPS, PHASE))
+  print("passband  : 0 ~ %.0f Hz, ripple %+.4f / %+.4f dB" % (PASS_HZ, min(pass_db), max(pass_db)))
+  print("stopband  : %.0f Hz ~, %.1f dB" % (STOP_HZ, -max(stop_db)))
+
+
+def f32(v):
+  return struct.unpack("f", struct.pack("f", v))[0]
+
+
+def load_c(path):
+  # write_c() 가 쓴 순서 그대로 위상별 TAPS 개씩 읽고 컴파일러처럼 float 로 반올림한다.
+  with open(path) as f:
+    vals = [f32(float(v)) for v in re.findall(r"([-+]?\d\.\d+e[-+]\d+)f", f.read())]
+  if len(vals) != PHASE * TAPS:
+    return None
+  return [vals[p * TAPS:(p + 1) * TAPS] for p in range(PHASE)]
+
+
+def check_table(path, tbl_ref):
+  tbl = load_c(path)
+  if tbl is None:
+    print("table     : %s, parse fail" % path)
+    return False
+
+  diff = max(abs(a - f32(float("%.9e" % b))) for row, ref in zip(tbl, tbl_ref) for a, b in zip(row, ref))
+
+  h = [0.0] * (PHASE * TAPS)
+  for p in range(PHASE):
+    for j in range(TAPS):
+      h[p + (TAPS - 1 - j) * PHASE] = tbl[p][j]
+
+  pass_f, stop_f = check_grid()
+  pass_db = [response_table_db(h, f) for f in pass_f]
+  stop_db = [response_table_db(h, f) for f in stop_f]
+
+  print("table     : %s" % os.path.basename(path))
+  print("  float   : max diff to design %.3g%s" % (diff, "" if diff == 0.0 else " (stale, regenerate)"))
+  print("  pass    : ripple %+.4f / %+.4f dB" % (min(pass_db), max(pass_db)))
+  print("  stop    : %.1f dB" % -max(stop_db))
+  return diff == 0.0
+
+
+def rows(h):
+  # 위상 p, 탭 j : h[p + (TAPS-1-j) * PHASE], 오래된 샘플부터 곱하도록 뒤집고 위상별 DC 이득을 1로 맞춘다.
+  out = []
+  for p in range(PHASE):
+    row = [h[p + (TAPS - 1 - j) * PHASE] for j in range(TAPS)]
+    g = sum(row)
+    out.append([v / g for v in row])
+  return out
+
+
+def write_c(path, tbl):
+  with open(path, "w") as f:
+    f.write("// tools/resample_coef.py 로 생성된 파일, 직접 수정하지 않는다.\n")
+    f.write("//\n")
+    f.write("#include \"resample.h\"\n\n\n")
+    f.write("#ifdef _USE_HW_RESAMPLE\n\n")
+    f.write("const float resample_coef[RESAMPLE_PHASE][RESAMPLE_TAPS] =\n{\n")
+    for row in tbl:
+      f.write("  {\n")
+      for j in range(0, len(row), 8):
+        f.write("    " + " ".join("%.9ef," % v for v in row[j:j + 8]) + "\n")
+      f.write("  },\n")
+    f.write("};\n\n#endif\n")
+
+
+def main():
+  parser = argparse.ArgumentParser()
+  parser.add_argument("--check", action="store_true")
+  args = parser.parse_args()
+
+  h, center = design()
+  check(h, center)
+
+  path = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src", "hw", "driver", "resample_coef.c")
+  if args.check:
+    check_table(os.path.normpath(path), rows(h))
+    return
+
+  write_c(os.path.normpath(path), rows(h))
+  print("write     : %s" % os.path.normpath(path))
+
+
+if __name__ == "__main__":
+  main()
@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+#
+# STM32F4-DAC-FW telemetry decoder
+#
+#   python3 telemetry.py /dev/ttyUSB0            : text view
+#   python3 telemetry.py /dev/ttyUSB0 --csv      : csv output
+#
+# 펌웨어에서 "telemetry start" 실행 후 사용한다.
+# 프레임은 COBS 인코딩, 앞뒤가 0x00 으로 구분되며 CLI 텍스트와 섞여 있어도 CRC로 걸러낸다.
+# 앞쪽 0x00 이 없는 이전 펌웨어에서도 텍스트 뒤에 붙은 프레임은 find_frame() 이 찾아낸다.
+#
+import argparse
+import struct
+import sys
+
+import serial
+
+
+TELEMETRY_TYPE_AUDIO = 0x01
+TELEMETRY_VERSION    = 0x01
+
+FIELDS = [
+  ("time_ms",        "I"),
+  ("alt",            "I"),
+  ("buf_level",      "I"),
+  ("freq",           "I"),
+  ("freq_real",      "I"),
+  ("host_rate_mhz",  "I"),
+  ("drift_ppm",      "i"),
+  ("feedback",       "I"),
+  ("fill",           "I"),
+  ("underrun",       "I"),
+  ("empty_sof",      "I"),
+  ("isr_cycles",     "I"),
+  ("isr_cycles_max", "I"),
+  ("iso_out_inc",    "I"),
+]
+
+
+def crc16(data):
+  # utilUpdateCrc() 와 같은 CRC-16 (poly 0x8005, init 0)
+  crc = 0
+  for b in data:
+    crc ^= b << 8
+    for _ in range(8):
+      crc = ((crc << 1) ^ 0x8005) if (crc & 0x8000) else (crc << 1)
+      crc &= 0xFFFF
+  return crc
+
+
+def cobs_decode(data):
+  out = bytearray()
+  i = 0
+  while i < len(data):
+    code = data[i]
+    if code == 0 or i + code > len(data) + 1:
+      return None
+    out += data[i + 1:i + code]
+    i += code
+    if code < 0xFF and i < len(data):
+      out.append(0)
+  return bytes(out)
+
+
+def parse(payload):
+  if payload is None or len(payload) < 10:
+    return None
+  if crc16(payload[:-2]) != struct.unpack("<H", payload[-2:])[0]:
+    return None
+
+  ptype, version, seq, mask = struct.unpack("<BBHI", payload[:8])
+  if ptype != TELEMETRY_TYPE_AUDIO or version != TELEMETRY_VERSION:
+    return None
+
+  ret = {"seq": seq}
+  index = 8
+  for bit, (name, fmt) in enumerate(FIELDS):
+    if mask & (1 << bit):
+      ret[name] = struct.unpack("<" + fmt, payload[index:index + 4])[0]
+      index += 4
+  return ret
+
+
+def find_frame(chunk):
+  # 0x00 사이의 조각 앞에 CLI 텍스트가 붙어 있을 수 있으므로
+  # 시작 위치를 하나씩 밀면서 CRC 가 맞는 가장 긴 프레임을 찾는다.
+  for start in range(len(chunk)):
+    t = parse(cobs_decode(chunk[start:]))
+    if t is not None:
+      return t
+  return None
+
+
+def print_text(t):
+  lines = [
+    "seq          : %d" % t["seq"],
+    "freq         : %s Hz, real %s Hz" % (t.get("freq", "-"), t.get("freq_real", "-")),
+    "buf level    : %s %%, fill %s" % (t.get("buf_level", "-"), t.get("fill", "-")),
+    "host rate    : %s mHz, %s ppm" % (t.get("host_rate_mhz", "-"), t.get("drift_ppm", "-")),
+    "feedback     : 0x%06X" % t["feedback"] if "feedback" in t else "feedback     : -",
+    "underrun     : %s" % t.get("underrun", "-"),
+    "empty sof    : %s" % t.get("empty_sof", "-"),
+    "isr cycles   : %s (max %s)" % (t.get("isr_cycles", "-"), t.get("isr_cycles_max", "-")),
+    "iso out inc  : %s /s" % t.get("iso_out_inc", "-"),
+  ]
+  sys.stdout.write("\n".join(l + "\033[K" for l in lines) + "\n")
+  sys.stdout.write("\033[%dA" % len(lines))
+  sys.stdout.flush()
+
+
+def print_csv(t, header):
+  names = ["seq"] + [name for name, _ in FIELDS]
+  if header:
+    print(",".join(names))
+  print(",".join(str(t.get(n, "")) for n in names))
+
+
+def main():
+  parser = argparse.ArgumentParser()
+  parser.add_argument("port")
+  parser.add_argument("--baud", type=int, default=115200)
+  parser.add_argument("--csv", action="store_true")
+  args = parser.parse_args()
+
+  ser = serial.Serial(args.port, args.baud, timeout=0.1)
+  buf = bytearray()
+  header = True
+
+  while True:
+    buf += ser.read(256)
+    while b"\x00" in buf:
+      frame, _, buf = buf.partition(b"\x00")
+      t = find_frame(bytes(frame))
+      if t is None:
+        continue
+      if args.csv:
+        print_csv(t, header)
+        header = False
+      else:
+        print_text(t)
+
+
+if __name__ == "__main__":
+  main()